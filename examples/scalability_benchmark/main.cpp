@@ -0,0 +1,593 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * Multi-threaded scalability benchmark for the tokenizers.
+ *
+ * For every tokenizer given on the command line, this sweeps the number of
+ * encoding threads from 1 to N, once with a single instance shared by all
+ * threads and once with one instance per thread, and reports throughput and
+ * the speedup curve relative to one thread. The gap between the two modes is
+ * the cost of sharing (RE2 DFA cache locks, shared allocations, false
+ * sharing); the per-thread curve shows the scaling limit of the machine.
+ *
+ * Contention can optionally be attributed with:
+ *  --alloc-stats: heap allocations and bytes per encode, counted by replacing
+ *    the global operator new in this binary, plus glibc arena statistics.
+ *  --lock-profile: voluntary context switches per encode, which on Linux are
+ *    dominated by futex waits when threads block on a contended lock, and the
+ *    RE2 DFA cache resets of the BPE tokenizers.
+ *
+ * --regex-replicas and --regex-max-mem set the RegexOptions of the BPE
+ * tokenizers, to compare a single shared DFA cache against per-thread ones.
+ *
+ * With --min-efficiency the tool exits non-zero if the shared-instance
+ * parallel efficiency (speedup / threads) at the largest thread count falls
+ * below the given value, so it can be used as a regression gate.
+ */
+
+// Standard
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <malloc.h>
+#include <sys/resource.h>
+#endif
+
+// Local
+#include "hf_tokenizer.h"
+#include "llama2c_tokenizer.h"
+#include "sentencepiece.h"
+#include "tekken.h"
+#include "tiktoken.h"
+
+using namespace tokenizers;
+
+// -- Allocation accounting ----------------------------------------------------
+
+namespace {
+
+struct AllocCounters {
+  uint64_t count = 0;
+  uint64_t bytes = 0;
+};
+
+thread_local AllocCounters tls_alloc_counters;
+
+} // namespace
+
+void* operator new(std::size_t size) {
+  tls_alloc_counters.count++;
+  tls_alloc_counters.bytes += size;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+  return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+
+// -- Options ------------------------------------------------------------------
+
+struct TokenizerSpec {
+  std::string type;
+  std::string model_path;
+};
+
+struct Options {
+  std::vector<TokenizerSpec> tokenizers;
+  std::string corpus_path;
+  size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+  double seconds = 1.0;
+  bool shared = true;
+  bool per_thread = true;
+  bool alloc_stats = false;
+  bool lock_profile = false;
+  double min_efficiency = 0.0;
+  RegexOptions regex_options;
+};
+
+std::string help(char* argv[]) {
+  std::stringstream ss;
+  ss << "Usage: " << argv[0] << " --tokenizer <type>=<model> [options]"
+     << std::endl
+     << std::endl;
+  ss << "Types: sentencepiece, tiktoken, hf_tokenizer, tekken, llama2c"
+     << std::endl
+     << std::endl;
+  ss << "Options:" << std::endl;
+  ss << "  --tokenizer <type>=<model>  Tokenizer to benchmark (repeatable)"
+     << std::endl;
+  ss << "  --corpus <path>             Text file, one document per line, or"
+     << " directory, one document per file" << std::endl;
+  ss << "  --max-threads <n>           Largest thread count of the sweep"
+     << std::endl;
+  ss << "  --seconds <s>               Measurement time per data point"
+     << std::endl;
+  ss << "  --mode <shared|per-thread|both>" << std::endl;
+  ss << "  --alloc-stats               Report allocations per encode"
+     << std::endl;
+  ss << "  --lock-profile              Report context switches per encode"
+     << std::endl;
+  ss << "  --regex-replicas <n>        Compiled regex replicas (0: one per"
+     << " hardware thread)" << std::endl;
+  ss << "  --regex-max-mem <bytes>     RE2 memory budget per pattern"
+     << std::endl;
+  ss << "  --min-efficiency <e>        Fail if shared efficiency at the"
+     << " largest thread count is below e" << std::endl;
+  return ss.str();
+}
+
+bool parse_args(int argc, char* argv[], Options& options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg(argv[i]);
+    auto next = [&]() -> const char* {
+      return i + 1 < argc ? argv[++i] : nullptr;
+    };
+    if (arg == "--tokenizer") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      const std::string spec(value);
+      const auto pos = spec.find('=');
+      if (pos == std::string::npos) {
+        return false;
+      }
+      options.tokenizers.push_back({spec.substr(0, pos), spec.substr(pos + 1)});
+    } else if (arg == "--corpus") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      options.corpus_path = value;
+    } else if (arg == "--max-threads") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      options.max_threads = std::max<size_t>(1, std::stoul(value));
+    } else if (arg == "--seconds") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      options.seconds = std::stod(value);
+    } else if (arg == "--mode") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      const std::string mode(value);
+      options.shared = mode == "shared" || mode == "both";
+      options.per_thread = mode == "per-thread" || mode == "both";
+      if (!options.shared && !options.per_thread) {
+        return false;
+      }
+    } else if (arg == "--alloc-stats") {
+      options.alloc_stats = true;
+    } else if (arg == "--lock-profile") {
+      options.lock_profile = true;
+    } else if (arg == "--regex-replicas") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      options.regex_options.num_replicas = std::stoul(value);
+    } else if (arg == "--regex-max-mem") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      options.regex_options.max_mem = std::stoll(value);
+    } else if (arg == "--min-efficiency") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      options.min_efficiency = std::stod(value);
+    } else {
+      return false;
+    }
+  }
+  return !options.tokenizers.empty();
+}
+
+// -- Corpus -------------------------------------------------------------------
+
+std::vector<std::string> default_corpus() {
+  return {
+      "The quick brown fox jumps over the lazy dog. It's 2024 and we're "
+      "benchmarking tokenizers on 64 cores!",
+      "def encode(self, text: str) -> list[int]:\n    return "
+      "self._core.encode(text)\n",
+      "Les tokenizers découpent le texte en unités plus petites appelées "
+      "jetons.",
+      "分词器将文本拆分为称为词元的更小单位。",
+      "Токенизаторы разбивают текст на более мелкие единицы.",
+      "    if (x == 1000000) {\n        return \"done\";\n    }\n",
+      "Numbers like 3.14159, 2.71828 and 1,234,567 appear in tables too.",
+      "Emoji 🙂🚀 and mixed scripts: ελληνικά, العربية, हिन्दी.",
+  };
+}
+
+std::vector<std::string> load_corpus(const std::string& path) {
+  if (path.empty()) {
+    return default_corpus();
+  }
+  std::vector<std::string> lines;
+  // A directory holds one document per file, e.g. the slow inputs saved by
+  // the fuzz targets
+  if (std::filesystem::is_directory(path)) {
+    for (const auto& entry : std::filesystem::directory_iterator(path)) {
+      std::ifstream file(entry.path(), std::ios::binary);
+      std::string document(
+          (std::istreambuf_iterator<char>(file)),
+          std::istreambuf_iterator<char>());
+      if (entry.is_regular_file() && !document.empty()) {
+        lines.push_back(std::move(document));
+      }
+    }
+    return lines;
+  }
+  std::ifstream file(path);
+  for (std::string line; std::getline(file, line);) {
+    if (!line.empty()) {
+      lines.push_back(std::move(line));
+    }
+  }
+  return lines;
+}
+
+// -- Tokenizers ---------------------------------------------------------------
+
+std::unique_ptr<Tokenizer> make_tokenizer(
+    const TokenizerSpec& spec,
+    const RegexOptions& regex_options) {
+  std::unique_ptr<Tokenizer> tok;
+  if (spec.type == "sentencepiece") {
+    tok.reset(new SPTokenizer());
+  } else if (spec.type == "tiktoken") {
+    tok.reset(new Tiktoken());
+  } else if (spec.type == "hf_tokenizer") {
+    tok.reset(new HFTokenizer());
+  } else if (spec.type == "tekken") {
+    tok.reset(new Tekken());
+  } else if (spec.type == "llama2c") {
+    tok.reset(new Llama2cTokenizer());
+  } else {
+    return nullptr;
+  }
+  if (auto* bpe = dynamic_cast<detail::BPETokenizerBase*>(tok.get())) {
+    bpe->set_regex_options(regex_options);
+  }
+  if (tok->load(spec.model_path) != Error::Ok) {
+    return nullptr;
+  }
+  return tok;
+}
+
+// -- Measurement --------------------------------------------------------------
+
+// Each worker writes its own padded record so that the benchmark itself does
+// not introduce false sharing.
+struct alignas(64) WorkerStats {
+  uint64_t calls = 0;
+  uint64_t bytes = 0;
+  uint64_t tokens = 0;
+  uint64_t failures = 0;
+  uint64_t allocations = 0;
+  uint64_t allocated_bytes = 0;
+  int64_t voluntary_switches = 0;
+  int64_t involuntary_switches = 0;
+};
+
+struct DataPoint {
+  size_t threads = 0;
+  double bytes_per_second = 0;
+  double allocations_per_call = 0;
+  double allocated_bytes_per_call = 0;
+  double voluntary_switches_per_call = 0;
+  double involuntary_switches_per_call = 0;
+  uint64_t failures = 0;
+};
+
+#if defined(__linux__) && defined(RUSAGE_THREAD)
+void thread_switches(int64_t& voluntary, int64_t& involuntary) {
+  struct rusage usage;
+  getrusage(RUSAGE_THREAD, &usage);
+  voluntary = usage.ru_nvcsw;
+  involuntary = usage.ru_nivcsw;
+}
+#else
+void thread_switches(int64_t& voluntary, int64_t& involuntary) {
+  voluntary = 0;
+  involuntary = 0;
+}
+#endif
+
+DataPoint run_point(
+    const std::vector<const Tokenizer*>& instances,
+    const std::vector<std::string>& corpus,
+    size_t num_threads,
+    double seconds) {
+  std::vector<WorkerStats> stats(num_threads);
+  std::atomic<size_t> ready{0};
+  std::atomic<bool> go{false};
+  std::atomic<bool> stop{false};
+
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < num_threads; ++t) {
+    workers.emplace_back([&, t] {
+      const Tokenizer* tok = instances[t % instances.size()];
+      WorkerStats local;
+      ready.fetch_add(1);
+      while (!go.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      const auto alloc_before = tls_alloc_counters;
+      int64_t vol_before = 0, invol_before = 0;
+      thread_switches(vol_before, invol_before);
+
+      // Start each thread at a different document
+      size_t idx = t;
+      while (!stop.load(std::memory_order_relaxed)) {
+        const auto& text = corpus[idx++ % corpus.size()];
+        auto result = tok->encode(text, 0, 0);
+        local.calls++;
+        local.bytes += text.size();
+        if (result.ok()) {
+          local.tokens += result.get().size();
+        } else {
+          local.failures++;
+        }
+      }
+
+      int64_t vol_after = 0, invol_after = 0;
+      thread_switches(vol_after, invol_after);
+      local.allocations = tls_alloc_counters.count - alloc_before.count;
+      local.allocated_bytes = tls_alloc_counters.bytes - alloc_before.bytes;
+      local.voluntary_switches = vol_after - vol_before;
+      local.involuntary_switches = invol_after - invol_before;
+      stats[t] = local;
+    });
+  }
+
+  while (ready.load() != num_threads) {
+    std::this_thread::yield();
+  }
+  const auto start = std::chrono::steady_clock::now();
+  go.store(true, std::memory_order_release);
+  std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+  stop.store(true);
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  const double elapsed = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+
+  WorkerStats total;
+  for (const auto& s : stats) {
+    total.calls += s.calls;
+    total.bytes += s.bytes;
+    total.failures += s.failures;
+    total.allocations += s.allocations;
+    total.allocated_bytes += s.allocated_bytes;
+    total.voluntary_switches += s.voluntary_switches;
+    total.involuntary_switches += s.involuntary_switches;
+  }
+
+  DataPoint point;
+  point.threads = num_threads;
+  point.bytes_per_second = total.bytes / elapsed;
+  point.failures = total.failures;
+  if (total.calls > 0) {
+    const double calls = static_cast<double>(total.calls);
+    point.allocations_per_call = total.allocations / calls;
+    point.allocated_bytes_per_call = total.allocated_bytes / calls;
+    point.voluntary_switches_per_call = total.voluntary_switches / calls;
+    point.involuntary_switches_per_call = total.involuntary_switches / calls;
+  }
+  return point;
+}
+
+std::vector<size_t> thread_sweep(size_t max_threads) {
+  std::vector<size_t> counts;
+  for (size_t n = 1; n < max_threads; n *= 2) {
+    counts.push_back(n);
+  }
+  counts.push_back(max_threads);
+  return counts;
+}
+
+void print_curve(
+    const std::string& label,
+    const std::vector<DataPoint>& points,
+    const Options& options) {
+  std::printf("  %s\n", label.c_str());
+  std::printf("    %8s %12s %9s %11s", "threads", "MB/s", "speedup", "efficiency");
+  if (options.alloc_stats) {
+    std::printf(" %11s %12s", "allocs/call", "alloc B/call");
+  }
+  if (options.lock_profile) {
+    std::printf(" %10s %10s", "vcsw/call", "ivcsw/call");
+  }
+  std::printf("\n");
+
+  const double base = points.front().bytes_per_second;
+  for (const auto& point : points) {
+    const double speedup = base > 0 ? point.bytes_per_second / base : 0;
+    std::printf(
+        "    %8zu %12.2f %9.2f %11.2f",
+        point.threads,
+        point.bytes_per_second / 1e6,
+        speedup,
+        speedup / point.threads);
+    if (options.alloc_stats) {
+      std::printf(
+          " %11.1f %12.1f",
+          point.allocations_per_call,
+          point.allocated_bytes_per_call);
+    }
+    if (options.lock_profile) {
+      std::printf(
+          " %10.4f %10.4f",
+          point.voluntary_switches_per_call,
+          point.involuntary_switches_per_call);
+    }
+    if (point.failures > 0) {
+      std::printf("  (%llu failed encodes)", (unsigned long long)point.failures);
+    }
+    std::printf("\n");
+  }
+}
+
+void print_allocator_stats() {
+#if defined(__linux__) && defined(__GLIBC__) && \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  const auto info = mallinfo2();
+  std::printf(
+      "  allocator: arena %zu KiB, in use %zu KiB, mmapped %zu KiB\n",
+      info.arena / 1024,
+      info.uordblks / 1024,
+      info.hblkhd / 1024);
+#endif
+}
+
+void print_regex_stats(const Tokenizer& tok) {
+  const auto* bpe = dynamic_cast<const detail::BPETokenizerBase*>(&tok);
+  if (!bpe) {
+    return;
+  }
+  const auto stats = bpe->regex_stats();
+  std::printf(
+      "  shared regex: %zu replicas, %llu searches, %llu DFA cache resets, "
+      "%llu DFA failures\n",
+      stats.replicas,
+      (unsigned long long)stats.searches,
+      (unsigned long long)stats.dfa_cache_resets,
+      (unsigned long long)stats.dfa_search_failures);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  Options options;
+  if (!parse_args(argc, argv, options)) {
+    std::cerr << help(argv) << std::endl;
+    return 1;
+  }
+
+  const auto corpus = load_corpus(options.corpus_path);
+  if (corpus.empty()) {
+    std::cerr << "ERROR: empty corpus: " << options.corpus_path << std::endl;
+    return 1;
+  }
+
+  const auto sweep = thread_sweep(options.max_threads);
+  bool gate_failed = false;
+
+  for (const auto& spec : options.tokenizers) {
+    std::printf("%s (%s)\n", spec.type.c_str(), spec.model_path.c_str());
+    auto shared = make_tokenizer(spec, options.regex_options);
+    if (!shared) {
+      std::cerr << "ERROR: failed to load " << spec.type << " from "
+                << spec.model_path << std::endl;
+      return 1;
+    }
+
+    if (options.shared) {
+      std::vector<DataPoint> points;
+      for (const auto n : sweep) {
+        points.push_back(run_point({shared.get()}, corpus, n, options.seconds));
+      }
+      print_curve("shared instance", points, options);
+
+      const double base = points.front().bytes_per_second;
+      const auto& last = points.back();
+      const double efficiency =
+          base > 0 ? last.bytes_per_second / base / last.threads : 0;
+      if (options.min_efficiency > 0 && efficiency < options.min_efficiency) {
+        std::printf(
+            "  FAIL: shared efficiency %.2f at %zu threads is below %.2f\n",
+            efficiency,
+            last.threads,
+            options.min_efficiency);
+        gate_failed = true;
+      }
+    }
+
+    if (options.per_thread) {
+      std::vector<std::unique_ptr<Tokenizer>> owned;
+      std::vector<const Tokenizer*> instances;
+      for (size_t i = 0; i < options.max_threads; ++i) {
+        auto tok = make_tokenizer(spec, options.regex_options);
+        if (!tok) {
+          std::cerr << "ERROR: failed to load " << spec.type << " instance "
+                    << i << " from " << spec.model_path << std::endl;
+          return 1;
+        }
+        instances.push_back(tok.get());
+        owned.push_back(std::move(tok));
+      }
+      std::vector<DataPoint> points;
+      for (const auto n : sweep) {
+        points.push_back(run_point(instances, corpus, n, options.seconds));
+      }
+      print_curve("per-thread instances", points, options);
+    }
+
+    if (options.alloc_stats) {
+      print_allocator_stats();
+    }
+    if (options.lock_profile) {
+      print_regex_stats(*shared);
+    }
+    std::printf("\n");
+  }
+
+  return gate_failed ? 2 : 0;
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * Token and piece frequency profiler.
+ *
+ * Runs a corpus through a BPE tokenizer on several threads and writes a
+ * binary profile (see token_profile.h) with token id and piece frequencies,
+ * piece length and merge count histograms, and piece cache hit rates for a
+ * range of cache sizes. A summary is printed to stdout.
+ */
+
+// Standard
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Local
+#include "hf_tokenizer.h"
+#include "tekken.h"
+#include "tiktoken.h"
+#include "token_profile.h"
+
+using namespace tokenizers;
+
+namespace {
+
+struct Options {
+  std::string type;
+  std::string model_path;
+  std::string corpus_path;
+  std::string output_path;
+  size_t top = 20;
+  TokenProfileConfig config;
+};
+
+std::string help(char* argv[]) {
+  std::stringstream ss;
+  ss << "Usage: " << argv[0]
+     << " --tokenizer <type>=<model> --corpus <path> [options]" << std::endl
+     << std::endl;
+  ss << "Types: tiktoken, hf_tokenizer, tekken" << std::endl << std::endl;
+  ss << "Options:" << std::endl;
+  ss << "  --corpus <path>             Text file, one document per line"
+     << std::endl;
+  ss << "  --output <path>             Write the binary profile" << std::endl;
+  ss << "  --threads <n>               Worker threads (default: all cores)"
+     << std::endl;
+  ss << "  --cache-sizes <n,n,...>     Piece cache capacities to simulate"
+     << std::endl;
+  ss << "  --max-pieces <n>            Pieces kept in the profile (0: all)"
+     << std::endl;
+  ss << "  --top <n>                   Most frequent pieces to print"
+     << std::endl;
+  return ss.str();
+}
+
+bool parse_args(int argc, char* argv[], Options& options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg(argv[i]);
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (!value) {
+      return false;
+    }
+    ++i;
+    if (arg == "--tokenizer") {
+      const std::string spec(value);
+      const auto pos = spec.find('=');
+      if (pos == std::string::npos) {
+        return false;
+      }
+      options.type = spec.substr(0, pos);
+      options.model_path = spec.substr(pos + 1);
+    } else if (arg == "--corpus") {
+      options.corpus_path = value;
+    } else if (arg == "--output") {
+      options.output_path = value;
+    } else if (arg == "--threads") {
+      options.config.num_threads = std::stoul(value);
+    } else if (arg == "--cache-sizes") {
+      options.config.cache_sizes.clear();
+      std::stringstream sizes(value);
+      for (std::string size; std::getline(sizes, size, ',');) {
+        options.config.cache_sizes.push_back(std::stoul(size));
+      }
+    } else if (arg == "--max-pieces") {
+      options.config.max_pieces = std::stoul(value);
+    } else if (arg == "--top") {
+      options.top = std::stoul(value);
+    } else {
+      return false;
+    }
+  }
+  return !options.type.empty() && !options.corpus_path.empty();
+}
+
+std::unique_ptr<Tokenizer> make_tokenizer(const std::string& type) {
+  if (type == "tiktoken") {
+    return std::make_unique<Tiktoken>();
+  }
+  if (type == "hf_tokenizer") {
+    return std::make_unique<HFTokenizer>();
+  }
+  if (type == "tekken") {
+    return std::make_unique<Tekken>();
+  }
+  return nullptr;
+}
+
+double percent(uint64_t part, uint64_t total) {
+  return total == 0 ? 0.0 : 100.0 * part / total;
+}
+
+void print_histogram(const char* name, const std::vector<uint64_t>& counts) {
+  const size_t last = counts.size() -
+      (std::find_if(counts.rbegin(), counts.rend(), [](uint64_t count) {
+         return count != 0;
+       }) -
+       counts.rbegin());
+  std::printf("%s:\n", name);
+  uint64_t total = 0;
+  for (const uint64_t count : counts) {
+    total += count;
+  }
+  for (size_t i = 0; i < last; ++i) {
+    std::printf(
+        "  %3zu%s %12llu %6.2f%%\n",
+        i,
+        i + 1 == counts.size() ? "+" : " ",
+        (unsigned long long)counts[i],
+        percent(counts[i], total));
+  }
+}
+
+void print_profile(const TokenProfile& profile, size_t top) {
+  size_t distinct_tokens = 0;
+  for (const uint64_t count : profile.token_counts) {
+    distinct_tokens += count != 0;
+  }
+  std::printf(
+      "documents %llu, bytes %llu, pieces %llu, tokens %llu (%.2f bytes per "
+      "token)\n",
+      (unsigned long long)profile.num_documents,
+      (unsigned long long)profile.num_bytes,
+      (unsigned long long)profile.num_pieces,
+      (unsigned long long)profile.num_tokens,
+      profile.num_tokens == 0 ? 0.0
+                              : double(profile.num_bytes) / profile.num_tokens);
+  std::printf(
+      "distinct tokens %zu of %zu, distinct pieces %zu\n\n",
+      distinct_tokens,
+      profile.token_counts.size(),
+      profile.pieces.size());
+
+  std::printf("most frequent pieces:\n");
+  for (size_t i = 0; i < std::min(top, profile.pieces.size()); ++i) {
+    const auto& piece = profile.pieces[i];
+    std::printf(
+        "  %12llu %6.2f%% %3u tokens  \"%s\"\n",
+        (unsigned long long)piece.count,
+        percent(piece.count, profile.num_pieces),
+        piece.num_tokens,
+        piece.piece.c_str());
+  }
+  std::printf("\n");
+  print_histogram("piece length (bytes)", profile.piece_length_histogram);
+  print_histogram("merges per piece", profile.merge_count_histogram);
+
+  std::printf("\npiece cache simulation:\n");
+  std::printf(
+      "  %10s %12s %10s %10s\n", "capacity", "lookups", "LRU", "static");
+  for (const auto& simulation : profile.cache_simulations) {
+    std::printf(
+        "  %10llu %12llu %9.2f%% %9.2f%%\n",
+        (unsigned long long)simulation.capacity,
+        (unsigned long long)simulation.lookups,
+        percent(simulation.lru_hits, simulation.lookups),
+        percent(simulation.static_hits, simulation.lookups));
+  }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  Options options;
+  if (!parse_args(argc, argv, options)) {
+    std::cerr << help(argv) << std::endl;
+    return 1;
+  }
+
+  auto tokenizer = make_tokenizer(options.type);
+  if (!tokenizer || tokenizer->load(options.model_path) != Error::Ok) {
+    std::cerr << "ERROR: failed to load " << options.type << " from "
+              << options.model_path << std::endl;
+    return 1;
+  }
+
+  std::ifstream file(options.corpus_path);
+  std::vector<std::string> documents;
+  for (std::string line; std::getline(file, line);) {
+    if (!line.empty()) {
+      documents.push_back(std::move(line));
+    }
+  }
+  if (documents.empty()) {
+    std::cerr << "ERROR: empty corpus: " << options.corpus_path << std::endl;
+    return 1;
+  }
+
+  const auto profile = profile_corpus(
+      static_cast<const detail::BPETokenizerBase&>(*tokenizer),
+      documents,
+      options.config);
+  if (!profile.ok()) {
+    std::cerr << "ERROR: profiling failed with error "
+              << static_cast<int>(profile.error()) << std::endl;
+    return 1;
+  }
+  print_profile(*profile, options.top);
+
+  if (!options.output_path.empty() &&
+      save_token_profile(*profile, options.output_path) != Error::Ok) {
+    std::cerr << "ERROR: failed to write " << options.output_path << std::endl;
+    return 1;
+  }
+  return 0;
+}
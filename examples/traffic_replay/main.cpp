@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * Replays a traffic log captured with CapturingTokenizer (traffic_capture.h)
+ * against the tokenizers given on the command line, so that builds and
+ * settings can be compared on the calls that production actually makes.
+ *
+ * The calls are issued from as many threads as the capturing process used,
+ * in the order they started. With --speed 1 each call is issued at its
+ * original time, with --speed N N times faster, and with --speed 0 (the
+ * default) as fast as the threads allow. The tool reports throughput, the
+ * latency percentiles of encode and decode next to those recorded in the
+ * log, how late calls were issued when paced, and the piece cache and regex
+ * statistics of the BPE tokenizers.
+ */
+
+// Standard
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Local
+#include "hf_tokenizer.h"
+#include "llama2c_tokenizer.h"
+#include "piece_cache.h"
+#include "sentencepiece.h"
+#include "tekken.h"
+#include "tiktoken.h"
+#include "traffic_capture.h"
+
+using namespace tokenizers;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// -- Options ------------------------------------------------------------------
+
+struct TokenizerSpec {
+  std::string type;
+  std::string model_path;
+};
+
+struct Options {
+  std::vector<TokenizerSpec> tokenizers;
+  std::string log_path;
+  double speed = 0.0;
+  size_t threads = 0;
+  size_t piece_cache_slots = 0;
+  RegexOptions regex_options;
+};
+
+std::string help(char* argv[]) {
+  std::stringstream ss;
+  ss << "Usage: " << argv[0]
+     << " --log <path> --tokenizer <type>=<model> [options]" << std::endl
+     << std::endl;
+  ss << "Types: sentencepiece, tiktoken, hf_tokenizer, tekken, llama2c"
+     << std::endl
+     << std::endl;
+  ss << "Options:" << std::endl;
+  ss << "  --log <path>                Traffic log to replay" << std::endl;
+  ss << "  --tokenizer <type>=<model>  Tokenizer to replay against"
+     << " (repeatable)" << std::endl;
+  ss << "  --speed <x>                 Pace calls x times faster than"
+     << " captured, 0 for no pacing" << std::endl;
+  ss << "  --threads <n>               Replay threads (default: the threads"
+     << " of the log)" << std::endl;
+  ss << "  --piece-cache <slots>       Attach a private piece cache to BPE"
+     << " tokenizers" << std::endl;
+  ss << "  --regex-replicas <n>        Compiled regex replicas (0: one per"
+     << " hardware thread)" << std::endl;
+  return ss.str();
+}
+
+bool parse_args(int argc, char* argv[], Options& options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg(argv[i]);
+    auto next = [&]() -> const char* {
+      return i + 1 < argc ? argv[++i] : nullptr;
+    };
+    if (arg == "--tokenizer") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      const std::string spec(value);
+      const auto pos = spec.find('=');
+      if (pos == std::string::npos) {
+        return false;
+      }
+      options.tokenizers.push_back({spec.substr(0, pos), spec.substr(pos + 1)});
+    } else if (arg == "--log") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      options.log_path = value;
+    } else if (arg == "--speed") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      options.speed = std::max(0.0, std::stod(value));
+    } else if (arg == "--threads") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      options.threads = std::stoul(value);
+    } else if (arg == "--piece-cache") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      options.piece_cache_slots = std::stoul(value);
+    } else if (arg == "--regex-replicas") {
+      const char* value = next();
+      if (!value) {
+        return false;
+      }
+      options.regex_options.num_replicas = std::stoul(value);
+    } else {
+      return false;
+    }
+  }
+  return !options.tokenizers.empty() && !options.log_path.empty();
+}
+
+// -- Tokenizers ---------------------------------------------------------------
+
+std::unique_ptr<Tokenizer> make_tokenizer(
+    const TokenizerSpec& spec,
+    const Options& options,
+    std::shared_ptr<PieceCache>& piece_cache) {
+  std::unique_ptr<Tokenizer> tok;
+  if (spec.type == "sentencepiece") {
+    tok.reset(new SPTokenizer());
+  } else if (spec.type == "tiktoken") {
+    tok.reset(new Tiktoken());
+  } else if (spec.type == "hf_tokenizer") {
+    tok.reset(new HFTokenizer());
+  } else if (spec.type == "tekken") {
+    tok.reset(new Tekken());
+  } else if (spec.type == "llama2c") {
+    tok.reset(new Llama2cTokenizer());
+  } else {
+    return nullptr;
+  }
+  auto* bpe = dynamic_cast<detail::BPETokenizerBase*>(tok.get());
+  if (bpe) {
+    bpe->set_regex_options(options.regex_options);
+  }
+  if (tok->load(spec.model_path) != Error::Ok) {
+    return nullptr;
+  }
+  if (bpe && options.piece_cache_slots > 0) {
+    auto cache = SharedPieceCache::open("", options.piece_cache_slots);
+    if (!cache.ok() || bpe->set_piece_cache(cache.get()) != Error::Ok) {
+      return nullptr;
+    }
+    piece_cache = cache.get();
+  }
+  return tok;
+}
+
+// -- Replay -------------------------------------------------------------------
+
+struct alignas(64) WorkerStats {
+  uint64_t bytes = 0;
+  uint64_t failures = 0;
+  // Nanoseconds
+  std::vector<uint64_t> encode_latencies;
+  std::vector<uint64_t> decode_latencies;
+  uint64_t max_lag = 0;
+  uint64_t total_lag = 0;
+};
+
+struct ReplayResult {
+  double seconds = 0;
+  WorkerStats total;
+};
+
+ReplayResult replay(
+    const Tokenizer& tok,
+    const std::vector<TrafficRecord>& records,
+    const std::vector<size_t>& order,
+    size_t num_threads,
+    double speed) {
+  std::vector<WorkerStats> stats(num_threads);
+  std::atomic<size_t> next{0};
+  const auto start = Clock::now();
+
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < num_threads; ++t) {
+    workers.emplace_back([&, t] {
+      WorkerStats local;
+      for (size_t i = next.fetch_add(1); i < order.size();
+           i = next.fetch_add(1)) {
+        const auto& record = records[order[i]];
+        if (speed > 0) {
+          const std::chrono::duration<double, std::micro> offset(
+              record.start_us / speed);
+          const auto scheduled =
+              start + std::chrono::duration_cast<Clock::duration>(offset);
+          std::this_thread::sleep_until(scheduled);
+          const uint64_t lag =
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  Clock::now() - scheduled)
+                  .count();
+          local.max_lag = std::max(local.max_lag, lag);
+          local.total_lag += lag;
+        }
+        const auto call_start = Clock::now();
+        bool ok = true;
+        if (record.kind == TrafficCallKind::Encode) {
+          ok = tok.encode(record.text, record.bos, record.eos).ok();
+          local.bytes += record.text.size();
+        } else {
+          ok = tok.decode(record.prev_token, record.token).ok();
+        }
+        const uint64_t latency =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now() - call_start)
+                .count();
+        if (record.kind == TrafficCallKind::Encode) {
+          local.encode_latencies.push_back(latency);
+        } else {
+          local.decode_latencies.push_back(latency);
+        }
+        local.failures += ok ? 0 : 1;
+      }
+      stats[t] = std::move(local);
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  ReplayResult result;
+  result.seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  auto& total = result.total;
+  for (auto& s : stats) {
+    total.bytes += s.bytes;
+    total.failures += s.failures;
+    total.max_lag = std::max(total.max_lag, s.max_lag);
+    total.total_lag += s.total_lag;
+    total.encode_latencies.insert(
+        total.encode_latencies.end(),
+        s.encode_latencies.begin(),
+        s.encode_latencies.end());
+    total.decode_latencies.insert(
+        total.decode_latencies.end(),
+        s.decode_latencies.begin(),
+        s.decode_latencies.end());
+  }
+  return result;
+}
+
+// -- Report -------------------------------------------------------------------
+
+void print_latencies(const char* label, std::vector<uint64_t> latencies) {
+  if (latencies.empty()) {
+    return;
+  }
+  std::sort(latencies.begin(), latencies.end());
+  const auto percentile = [&](double p) {
+    const size_t index = static_cast<size_t>(p * (latencies.size() - 1));
+    return latencies[index] / 1e3;
+  };
+  std::printf(
+      "    %-18s %10zu %10.2f %10.2f %10.2f %10.2f %10.2f\n",
+      label,
+      latencies.size(),
+      percentile(0.5),
+      percentile(0.9),
+      percentile(0.99),
+      percentile(0.999),
+      latencies.back() / 1e3);
+}
+
+void print_tokenizer_stats(
+    const Tokenizer& tok,
+    const std::shared_ptr<PieceCache>& piece_cache) {
+  const auto* bpe = dynamic_cast<const detail::BPETokenizerBase*>(&tok);
+  if (!bpe) {
+    return;
+  }
+  const auto regex = bpe->regex_stats();
+  std::printf(
+      "  regex: %llu searches, %llu DFA cache resets, %llu DFA failures\n",
+      (unsigned long long)regex.searches,
+      (unsigned long long)regex.dfa_cache_resets,
+      (unsigned long long)regex.dfa_search_failures);
+  if (piece_cache) {
+    const auto stats = piece_cache->stats();
+    const uint64_t lookups = stats.hits + stats.misses;
+    std::printf(
+        "  piece cache: %.1f%% hits of %llu lookups, %llu inserts, "
+        "%llu evictions\n",
+        lookups > 0 ? 100.0 * stats.hits / lookups : 0.0,
+        (unsigned long long)lookups,
+        (unsigned long long)stats.inserts,
+        (unsigned long long)stats.evictions);
+  }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  Options options;
+  if (!parse_args(argc, argv, options)) {
+    std::cerr << help(argv) << std::endl;
+    return 1;
+  }
+
+  TrafficLogReader log;
+  if (log.load(options.log_path) != Error::Ok) {
+    std::cerr << "ERROR: failed to read " << options.log_path << std::endl;
+    return 1;
+  }
+  const auto& records = log.records();
+  if (records.empty()) {
+    std::cerr << "ERROR: no calls in " << options.log_path << std::endl;
+    return 1;
+  }
+
+  // Records are logged as calls complete; replay them as they started
+  std::vector<size_t> order(records.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return records[a].start_us < records[b].start_us;
+  });
+  std::set<uint32_t> threads;
+  std::vector<uint64_t> encode_recorded;
+  std::vector<uint64_t> decode_recorded;
+  for (const auto& record : records) {
+    threads.insert(record.thread);
+    (record.kind == TrafficCallKind::Encode ? encode_recorded : decode_recorded)
+        .push_back(record.duration_ns);
+  }
+  const size_t num_threads =
+      options.threads > 0 ? options.threads : threads.size();
+  std::printf(
+      "%s: %zu calls from %zu threads over %.3f s%s%s\n\n",
+      options.log_path.c_str(),
+      records.size(),
+      threads.size(),
+      records[order.back()].start_us / 1e6,
+      log.redacted() ? ", redacted" : "",
+      log.truncated() ? ", truncated" : "");
+
+  for (const auto& spec : options.tokenizers) {
+    std::printf("%s (%s)\n", spec.type.c_str(), spec.model_path.c_str());
+    std::shared_ptr<PieceCache> piece_cache;
+    const auto tok = make_tokenizer(spec, options, piece_cache);
+    if (!tok) {
+      std::cerr << "ERROR: failed to load " << spec.type << " from "
+                << spec.model_path << std::endl;
+      return 1;
+    }
+
+    const auto result =
+        replay(*tok, records, order, num_threads, options.speed);
+    const auto& total = result.total;
+    std::printf(
+        "  %zu threads, %.3f s: %.2f MB/s, %.0f calls/s",
+        num_threads,
+        result.seconds,
+        total.bytes / result.seconds / 1e6,
+        records.size() / result.seconds);
+    if (total.failures > 0) {
+      std::printf(" (%llu failed calls)", (unsigned long long)total.failures);
+    }
+    std::printf("\n");
+    if (options.speed > 0) {
+      std::printf(
+          "  schedule lag at %gx: mean %.2f us, max %.2f us\n",
+          options.speed,
+          total.total_lag / 1e3 / records.size(),
+          total.max_lag / 1e3);
+    }
+
+    std::printf(
+        "    %-18s %10s %10s %10s %10s %10s %10s\n",
+        "latency (us)",
+        "calls",
+        "p50",
+        "p90",
+        "p99",
+        "p99.9",
+        "max");
+    print_latencies("encode", total.encode_latencies);
+    print_latencies("encode (captured)", encode_recorded);
+    print_latencies("decode", total.decode_latencies);
+    print_latencies("decode (captured)", decode_recorded);
+    print_tokenizer_stats(*tok, piece_cache);
+    std::printf("\n");
+  }
+
+  return 0;
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * Cost oracle of the performance fuzzers.
+ *
+ * A fuzz target hands the oracle a function that runs the code under test on
+ * its input repeated a given number of times. The oracle runs it once and
+ * kRepeat times over, with the work counters of work_counters.h reset, and
+ * reports a finding when
+ *  - a counter exceeds max_work_per_byte() per input byte, e.g. a single
+ *    piece that the merge loop takes quadratic time over, or
+ *  - a counter, or the run time for the engines that do not count their work
+ *    (RE2, PCRE2, std::regex, SentencePiece), grows more than kMaxGrowth
+ *    times faster than the input when the input is repeated.
+ *
+ * A finding writes the document that was slow to TK_FUZZ_SLOW_INPUTS, which
+ * the scalability benchmark encodes as a corpus, and aborts so that libFuzzer
+ * keeps the reproducer and -minimize_crash=1 can shrink it. Targets that do
+ * not encode save to a subdirectory, which the benchmark skips. Each target
+ * and counter keeps the smallest document found.
+ */
+
+#pragma once
+
+// Standard
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+// Local
+#include <pytorch/tokenizers/work_counters.h>
+
+#ifndef TK_FUZZ_TARGET
+#define TK_FUZZ_TARGET "fuzz"
+#endif
+
+#ifndef TK_FUZZ_SLOW_INPUTS
+#define TK_FUZZ_SLOW_INPUTS "slow_inputs"
+#endif
+
+namespace tokenizers {
+namespace fuzz {
+
+// Number of copies of the input in the scaling check
+constexpr size_t kRepeat = 8;
+
+// Factor over linear growth of the repeated input's cost that is a finding
+constexpr double kMaxGrowth = 2.0;
+
+// Growth is only judged once the repeated input costs this much work per
+// byte, so that short pieces merged in quadratic time do not count
+constexpr double kMinWorkPerByte = 16.0;
+
+// Run time growth is only judged once the repeated input takes this long, as
+// shorter timings are mostly noise
+constexpr double kMinSeconds = 1e-3;
+
+// Default of max_work_per_byte()
+constexpr double kMaxWorkPerByte = 256.0;
+
+/** Work per input byte above which a run is slow, TK_FUZZ_MAX_WORK_PER_BYTE */
+inline double max_work_per_byte() {
+  static const double value = [] {
+    const char* env = std::getenv("TK_FUZZ_MAX_WORK_PER_BYTE");
+    return env ? std::atof(env) : kMaxWorkPerByte;
+  }();
+  return value;
+}
+
+/** s repeated `repeat` times */
+inline std::string repeat_string(const std::string& s, size_t repeat) {
+  std::string result;
+  result.reserve(s.size() * repeat);
+  for (size_t i = 0; i < repeat; ++i) {
+    result += s;
+  }
+  return result;
+}
+
+struct Cost {
+  WorkCounters work;
+  double seconds = 0.0;
+};
+
+/** Run fn(repeat) and return the work it counted and its best of 3 times */
+template <typename Fn>
+Cost measure(Fn& fn, size_t repeat) {
+  Cost cost;
+  cost.seconds = 1e9;
+  for (int run = 0; run < 3; ++run) {
+    reset_work_counters();
+    const auto start = std::chrono::steady_clock::now();
+    fn(repeat);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    cost.seconds = std::min(cost.seconds, elapsed.count());
+    cost.work = work_counters();
+  }
+  return cost;
+}
+
+/**
+ * Save document as the slow input of the counter, in the subdirectory of
+ * TK_FUZZ_SLOW_INPUTS if one is given, and abort
+ */
+[[noreturn]] inline void report(
+    const char* counter,
+    const std::string& document,
+    const std::string& subdirectory,
+    const char* reason,
+    double value,
+    double limit) {
+  std::fprintf(
+      stderr,
+      "%s: super-linear %s on %zu bytes: %s %.1f > %.1f\n",
+      TK_FUZZ_TARGET,
+      counter,
+      document.size(),
+      reason,
+      value,
+      limit);
+  const auto directory =
+      std::filesystem::path(TK_FUZZ_SLOW_INPUTS) / subdirectory;
+  std::error_code error;
+  std::filesystem::create_directories(directory, error);
+  const auto path =
+      directory / (std::string(TK_FUZZ_TARGET) + "-" + counter + ".txt");
+  const auto size = std::filesystem::file_size(path, error);
+  if (error || document.size() < size) {
+    std::ofstream(path, std::ios::binary) << document;
+    std::fprintf(stderr, "saved to %s\n", path.string().c_str());
+  }
+  std::abort();
+}
+
+/**
+ * Check the cost of fn(repeat), which processes the input repeated `repeat`
+ * times. size is the size of the input, document the text to save if it is
+ * slow, and subdirectory where to save it if it is not text to encode.
+ */
+template <typename Fn>
+void check_cost(
+    size_t size,
+    const std::string& document,
+    Fn fn,
+    const std::string& subdirectory = "") {
+  if (size == 0) {
+    return;
+  }
+  const Cost once = measure(fn, 1);
+  const Cost repeated = measure(fn, kRepeat);
+
+  const auto check = [&](const char* counter,
+                         uint64_t once_work,
+                         uint64_t repeated_work) {
+    const double per_byte = double(once_work) / double(size);
+    if (per_byte > max_work_per_byte()) {
+      report(
+          counter,
+          document,
+          subdirectory,
+          "work per byte",
+          per_byte,
+          max_work_per_byte());
+    }
+    // The input size stands in for fixed costs of short inputs
+    const double linear =
+        double(kRepeat) * double(std::max<uint64_t>(once_work, size));
+    const double repeated_per_byte =
+        double(repeated_work) / double(kRepeat * size);
+    if (repeated_per_byte > kMinWorkPerByte &&
+        double(repeated_work) > kMaxGrowth * linear) {
+      report(
+          counter,
+          document,
+          subdirectory,
+          "work when repeated",
+          double(repeated_work),
+          kMaxGrowth * linear);
+    }
+  };
+  check("merge_steps", once.work.merge_steps, repeated.work.merge_steps);
+  check("regex_steps", once.work.regex_steps, repeated.work.regex_steps);
+  check("bytes_copied", once.work.bytes_copied, repeated.work.bytes_copied);
+
+  if (repeated.seconds >= kMinSeconds &&
+      repeated.seconds > kMaxGrowth * kRepeat * once.seconds) {
+    report(
+        "time",
+        document,
+        subdirectory,
+        "seconds when repeated",
+        repeated.seconds,
+        kMaxGrowth * kRepeat * once.seconds);
+  }
+}
+
+} // namespace fuzz
+} // namespace tokenizers
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// Decodes the input as token ids, three bytes each, and checks that the cost
+// is linear in the number of tokens.
+
+// Standard
+#include <vector>
+
+// Local
+#include "cost_oracle.h"
+#include "fuzz_tokenizer.h"
+
+using namespace tokenizers;
+
+namespace {
+
+std::string decode(
+    const Tokenizer& tokenizer,
+    const std::vector<uint64_t>& tokens,
+    size_t repeat) {
+  std::string text;
+  uint64_t prev = tokenizer.bos_tok();
+  for (size_t i = 0; i < repeat; ++i) {
+    for (const uint64_t token : tokens) {
+      auto piece = tokenizer.decode(prev, token);
+      if (piece.ok()) {
+        text += *piece;
+      }
+      prev = token;
+    }
+  }
+  return text;
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  static const auto tokenizer = fuzz::load_tokenizer();
+  const uint64_t vocab_size = std::max<int32_t>(1, tokenizer->vocab_size());
+  std::vector<uint64_t> tokens;
+  for (size_t i = 0; i + 3 <= size; i += 3) {
+    const uint64_t value = data[i] | (data[i + 1] << 8) | (data[i + 2] << 16);
+    tokens.push_back(value % vocab_size);
+  }
+  // Slow decodes are kept out of the slow inputs the scalability benchmark
+  // encodes
+  fuzz::check_cost(
+      tokens.size(),
+      decode(*tokenizer, tokens, 1),
+      [&](size_t repeat) { (void)decode(*tokenizer, tokens, repeat); },
+      "decode");
+  return 0;
+}
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// Encodes the input as text and checks that the cost is linear in its size.
+
+// Local
+#include "cost_oracle.h"
+#include "fuzz_tokenizer.h"
+
+using namespace tokenizers;
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  static const auto tokenizer = fuzz::load_tokenizer();
+  const std::string text(reinterpret_cast<const char*>(data), size);
+  const std::string repeated = fuzz::repeat_string(text, fuzz::kRepeat);
+  fuzz::check_cost(size, text, [&](size_t repeat) {
+    (void)tokenizer->encode(repeat == 1 ? text : repeated, 1, 1);
+  });
+  return 0;
+}
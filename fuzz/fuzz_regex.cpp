@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// Runs find_all of the regex engine TK_FUZZ_REGEX_ENGINE over the input and
+// checks that the cost is linear in its size. The first byte of the input
+// picks one of the pre-tokenizer patterns of the tokenizers, the rest is the
+// text. Patterns the engine does not compile are skipped.
+
+// Standard
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/regex.h>
+#include "cost_oracle.h"
+
+using namespace tokenizers;
+
+namespace {
+
+const char* const kPatterns[] = {
+    // cl100k, as in Tiktoken
+    R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+)",
+    // cl100k with its lookahead
+    R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+)",
+    // GPT-2, as in HF byte-level pre-tokenizers
+    R"('s|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+)",
+    // Tekken
+    R"([^\r\n\p{L}\p{N}]?[\p{Lu}\p{Lt}\p{Lm}\p{Lo}\p{M}]*[\p{Ll}\p{Lm}\p{Lo}\p{M}]+|[^\r\n\p{L}\p{N}]?[\p{Lu}\p{Lt}\p{Lm}\p{Lo}\p{M}]+[\p{Ll}\p{Lm}\p{Lo}\p{M}]*|\p{N}| ?[^\s\p{L}\p{N}]+[\r\n/]*|\s*[\r\n]+|\s+)",
+    // Special tokens
+    R"(<\|begin_of_text\|>|<\|end_of_text\|>|<\|eot_id\|>|<\|fim_prefix\|>)",
+};
+
+constexpr size_t kNumPatterns = sizeof(kPatterns) / sizeof(kPatterns[0]);
+
+std::vector<std::unique_ptr<IRegex>> compile_patterns() {
+  const auto engine = get_regex_engine(RegexEngine::TK_FUZZ_REGEX_ENGINE);
+  if (!engine) {
+    std::fprintf(stderr, "%s is not linked in\n", TK_FUZZ_TARGET);
+    std::exit(1);
+  }
+  std::vector<std::unique_ptr<IRegex>> regexes(kNumPatterns);
+  for (size_t i = 0; i < kNumPatterns; ++i) {
+    auto regex = engine(kPatterns[i], RegexOptions{});
+    if (regex.ok()) {
+      regexes[i] = std::move(*regex);
+    }
+  }
+  return regexes;
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  static const auto regexes = compile_patterns();
+  if (size < 2 || !regexes[data[0] % kNumPatterns]) {
+    return 0;
+  }
+  const IRegex& regex = *regexes[data[0] % kNumPatterns];
+  const std::string text(reinterpret_cast<const char*>(data) + 1, size - 1);
+  const std::string repeated = fuzz::repeat_string(text, fuzz::kRepeat);
+  fuzz::check_cost(text.size(), text, [&](size_t repeat) {
+    (void)regex.find_all(repeat == 1 ? text : repeated);
+  });
+  return 0;
+}
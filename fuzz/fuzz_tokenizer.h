@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// The tokenizer of the encode and decode fuzz targets, given at build time
+// as TK_FUZZ_TOKENIZER (its type) and TK_FUZZ_MODEL (its model file).
+
+#pragma once
+
+// Standard
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+// Local
+#include <pytorch/tokenizers/hf_tokenizer.h>
+#include <pytorch/tokenizers/llama2c_tokenizer.h>
+#include <pytorch/tokenizers/sentencepiece.h>
+#include <pytorch/tokenizers/tekken.h>
+#include <pytorch/tokenizers/tiktoken.h>
+
+namespace tokenizers {
+namespace fuzz {
+
+/** Load the tokenizer of the target, exiting if it cannot be loaded */
+inline std::unique_ptr<Tokenizer> load_tokenizer() {
+  const std::string type = TK_FUZZ_TOKENIZER;
+  std::unique_ptr<Tokenizer> tokenizer;
+  if (type == "sentencepiece") {
+    tokenizer.reset(new SPTokenizer());
+  } else if (type == "tiktoken") {
+    tokenizer.reset(new Tiktoken());
+  } else if (type == "hf_tokenizer") {
+    tokenizer.reset(new HFTokenizer());
+  } else if (type == "tekken") {
+    tokenizer.reset(new Tekken());
+  } else if (type == "llama2c") {
+    tokenizer.reset(new Llama2cTokenizer());
+  }
+  if (!tokenizer || tokenizer->load(TK_FUZZ_MODEL) != Error::Ok) {
+    std::fprintf(
+        stderr, "cannot load %s from %s\n", type.c_str(), TK_FUZZ_MODEL);
+    std::exit(1);
+  }
+  return tokenizer;
+}
+
+} // namespace fuzz
+} // namespace tokenizers
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// Entry point of the fuzz targets for compilers without libFuzzer. It only
+// replays inputs: every file given, and every file in the directories given,
+// is run through the target once, e.g. to check a corpus in CI.
+
+// Standard
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+namespace {
+
+void run_file(const std::filesystem::path& path) {
+  std::ifstream file(path, std::ios::binary);
+  const std::string input(
+      (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  std::fprintf(stderr, "Running %s\n", path.string().c_str());
+  LLVMFuzzerTestOneInput(
+      reinterpret_cast<const uint8_t*>(input.data()), input.size());
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  for (int i = 1; i < argc; ++i) {
+    const std::filesystem::path path(argv[i]);
+    if (std::filesystem::is_directory(path)) {
+      for (const auto& entry : std::filesystem::directory_iterator(path)) {
+        if (entry.is_regular_file()) {
+          run_file(entry.path());
+        }
+      }
+    } else {
+      run_file(path);
+    }
+  }
+  return 0;
+}
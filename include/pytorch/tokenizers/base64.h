@@ -38,8 +38,13 @@ using tokenizers::Result;
 
 Result<std::string> decode(const std::string_view& input);
 
+std::string encode(const std::string_view& input);
+
 namespace detail {
 
+constexpr char ENCODE_TABLE[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
 constexpr uint32_t DECODE_TABLE[] = {
     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
     255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
@@ -196,4 +201,34 @@ inline tokenizers::Result<std::string> decode(const std::string_view& input) {
 
   return output;
 }
+
+inline std::string encode(const std::string_view& input) {
+  std::string output;
+  output.reserve((input.size() + 2) / 3 * 4);
+  size_t idx = 0;
+  for (; idx + 3 <= input.size(); idx += 3) {
+    const uint32_t v = static_cast<uint8_t>(input[idx]) << 16 |
+        static_cast<uint8_t>(input[idx + 1]) << 8 |
+        static_cast<uint8_t>(input[idx + 2]);
+    output.push_back(detail::ENCODE_TABLE[v >> 18]);
+    output.push_back(detail::ENCODE_TABLE[(v >> 12) & 63]);
+    output.push_back(detail::ENCODE_TABLE[(v >> 6) & 63]);
+    output.push_back(detail::ENCODE_TABLE[v & 63]);
+  }
+
+  // Last 1 or 2 bytes, padded.
+  const size_t rest = input.size() - idx;
+  if (rest > 0) {
+    uint32_t v = static_cast<uint8_t>(input[idx]) << 16;
+    if (rest == 2) {
+      v |= static_cast<uint8_t>(input[idx + 1]) << 8;
+    }
+    output.push_back(detail::ENCODE_TABLE[v >> 18]);
+    output.push_back(detail::ENCODE_TABLE[(v >> 12) & 63]);
+    output.push_back(rest == 2 ? detail::ENCODE_TABLE[(v >> 6) & 63] : '=');
+    output.push_back('=');
+  }
+
+  return output;
+}
 } // namespace base64
@@ -11,30 +11,66 @@
 #pragma once
 
 // Standard
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
 
 // Local
+#include <pytorch/tokenizers/closed_form_pieces.h>
 #include <pytorch/tokenizers/error.h>
+#include <pytorch/tokenizers/piece_cache.h>
 #include <pytorch/tokenizers/regex.h>
 #include <pytorch/tokenizers/result.h>
 #include <pytorch/tokenizers/string_integer_map.h>
 #include <pytorch/tokenizers/tokenizer.h>
 
+#ifndef TOKENIZERS_MINIMAL
 #include "re2/re2.h"
+#endif
 
 namespace tokenizers {
+
+/**
+ * What a BPE tokenizer is loaded for. Services that only encode or only decode
+ * can skip the tables of the other direction: an EncodeOnly tokenizer keeps no
+ * id to token lookup and no decoder, a DecodeOnly one no token to id lookup,
+ * regexes, normalizer or merges. Calls in the direction that was not loaded
+ * return Error::Unsupported.
+ */
+enum class TokenizerMode {
+  EncodeDecode,
+  EncodeOnly,
+  DecodeOnly,
+};
+
 namespace detail {
 
 using TokenMap = StringIntegerMap<>;
 
+/**
+ * Return the direction the vocabulary map needs to be built with in the given
+ * mode.
+ */
+inline MapDirection token_map_direction(TokenizerMode mode) {
+  switch (mode) {
+    case TokenizerMode::EncodeOnly:
+      return MapDirection::StringToInteger;
+    case TokenizerMode::DecodeOnly:
+      return MapDirection::IntegerToString;
+    default:
+      return MapDirection::Both;
+  }
+}
+
 template <typename TToken, typename TRank>
 static Result<TokenMap> build_token_map(
-    std::vector<std::pair<TToken, TRank>> container) {
+    std::vector<std::pair<TToken, TRank>> container,
+    MapDirection direction = MapDirection::Both) {
   static_assert(
       std::is_same_v<TToken, std::string> ||
           std::is_same_v<TToken, std::string_view>,
@@ -78,7 +114,7 @@ static Result<TokenMap> build_token_map(
       static_cast<unsigned long long>(duplicate_begin->second),
       duplicate_begin->first.c_str());
 
-  return TokenMap(container);
+  return TokenMap(container, direction);
 };
 
 template <typename TContainer, typename TTokenAccessor, typename TRankAccessor>
@@ -107,7 +143,8 @@ static Result<TokenMap> build_token_map(
 }
 
 inline Result<std::unique_ptr<IRegex>> build_special_token_regex(
-    const TokenMap& special_token_map) {
+    const TokenMap& special_token_map,
+    const RegexOptions& options = {}) {
   std::string special_pattern;
   const std::size_t count = special_token_map.size();
 
@@ -116,14 +153,18 @@ inline Result<std::unique_ptr<IRegex>> build_special_token_regex(
     if (!special_pattern.empty()) {
       special_pattern += "|";
     }
+#ifdef TOKENIZERS_MINIMAL
+    special_pattern += IRegex::escape(std::string(token));
+#else
     special_pattern += re2::RE2::QuoteMeta(std::string(token));
+#endif
   }
 
   if (special_pattern.empty()) {
     return static_cast<std::unique_ptr<IRegex>>(nullptr);
   }
   // Wrap pattern in parentheses for proper grouping
-  return create_regex("(" + special_pattern + ")");
+  return create_regex("(" + special_pattern + ")", options);
 }
 
 class BPETokenizerBase : public Tokenizer {
@@ -131,26 +172,135 @@ class BPETokenizerBase : public Tokenizer {
   Result<std::vector<uint64_t>>
   encode(const std::string& input, int8_t bos, int8_t eos) const override;
 
+  Result<std::vector<uint64_t>>
+  encode_view(std::string_view input, int8_t bos, int8_t eos) const override;
+
   Result<std::string> decode(uint64_t prev_token, uint64_t token)
       const override;
 
+  /**
+   * Encode like encode(input, 0, 0) and also store in `token_ends` the offset
+   * in `input` at which each token ends. This needs the vocabulary to hold the
+   * raw bytes of the tokens, as Tiktoken and Tekken do, and a tokenizer
+   * loaded as EncodeDecode. EncodeFailure is returned if the tokens do not
+   * spell out the input.
+   */
+  Result<std::vector<uint64_t>> encode_with_offsets(
+      const std::string& input,
+      std::vector<size_t>& token_ends) const;
+
+  /**
+   * Encode UTF-16 input, as held by Java, .NET and JavaScript hosts. It is
+   * transcoded to UTF-8 with an ASCII fast path, unpaired surrogates becoming
+   * U+FFFD, and then encoded like encode().
+   */
+  Result<std::vector<uint64_t>>
+  encode_utf16(std::u16string_view input, int8_t bos, int8_t eos) const;
+
+  /**
+   * Encode like encode_utf16(input, 0, 0) and store in `token_ends` the offset
+   * in UTF-16 code units at which each token ends. A token that ends inside a
+   * character, or between the two halves of a surrogate pair, ends after it;
+   * the next token then starts there too. Same requirements as
+   * encode_with_offsets().
+   */
+  Result<std::vector<uint64_t>> encode_utf16_with_offsets(
+      std::u16string_view input,
+      std::vector<size_t>& token_ends) const;
+
+  /**
+   * Called for each piece of the input with the tokens it encodes to. Special
+   * tokens are reported as pieces of their own, with `special` set.
+   */
+  using PieceVisitor = std::function<void(
+      std::string_view piece,
+      const std::vector<uint64_t>& tokens,
+      bool special)>;
+
+  /**
+   * Split the input into the pieces that are merged independently, the same
+   * way encode() does, and encode each of them. The concatenated tokens of
+   * all pieces are those of encode(input, 0, 0). This is meant for analysis
+   * and does not use the piece cache.
+   */
+  Error visit_pieces(const std::string& input, const PieceVisitor& visitor)
+      const;
+
+  /**
+   * Set the options used to compile this tokenizer's regexes. This must be
+   * called before load() to take effect.
+   */
+  void set_regex_options(const RegexOptions& options) {
+    regex_options_ = options;
+  }
+
+  /**
+   * Set what the tokenizer is loaded for, see TokenizerMode. This must be
+   * called before load() to take effect.
+   */
+  void set_mode(TokenizerMode mode) {
+    mode_ = mode;
+  }
+
+  TokenizerMode mode() const {
+    return mode_;
+  }
+
+  /**
+   * Return the counters of all regexes used by this tokenizer, summed.
+   */
+  virtual RegexStats regex_stats() const;
+
+  /**
+   * Set how many pre-tokenized pieces are merged together. Above 1, the merge
+   * loops of that many pieces advance in lockstep and the rank lookups of all
+   * of them are issued as one prefetched batch, so that their cache misses
+   * overlap. The tokens produced do not depend on this setting; 1 merges the
+   * pieces one at a time.
+   */
+  void set_merge_batch_size(size_t batch_size) {
+    merge_batch_size_ = batch_size == 0 ? 1 : batch_size;
+  }
+
+  static constexpr size_t kDefaultMergeBatchSize = 8;
+
+  /**
+   * Look up and store merged pieces in the given cache, e.g. a
+   * SharedPieceCache shared by all processes on the host. Entries are keyed by
+   * a fingerprint of the loaded vocabulary, so this must be called after
+   * load(). Pass nullptr to stop using the cache. Only used by tokenizers that
+   * merge with the base implementation (Tiktoken, Tekken).
+   */
+  Error set_piece_cache(std::shared_ptr<PieceCache> cache);
+
+  /**
+   * Look up digit groups and runs of one white space or punctuation byte in
+   * tables built at load time, before the token map, the piece cache and the
+   * merge; see ClosedFormPieces. The tokens produced do not depend on this
+   * setting. This must be called before load() to take effect. Only used by
+   * tokenizers that merge with the base implementation (Tiktoken, Tekken).
+   */
+  void set_closed_form_pieces(bool enabled) {
+    use_closed_form_pieces_ = enabled;
+  }
+
+  const ClosedFormPieces& closed_form_pieces() const {
+    return closed_form_pieces_;
+  }
+
+  std::vector<MemoryRegion> memory_regions() const override;
+
  protected:
   explicit BPETokenizerBase() {}
   virtual ~BPETokenizerBase() override {}
 
-  std::pair<std::optional<std::string>, std::string>
-  split_with_allowed_special_token_(
-      const std::string& input,
-      const TokenMap& allowed_special) const;
-
-  std::pair<std::optional<std::string>, std::string>
-  split_with_allowed_special_token_(
-      const std::string& input,
-      size_t offset,
+  // The special tokens of input that are in allowed_special, in order
+  std::vector<Match> find_allowed_special_tokens_(
+      std::string_view input,
       const TokenMap& allowed_special) const;
 
   Result<std::pair<std::vector<uint64_t>, uint64_t>> encode_with_special_token_(
-      const std::string& text,
+      std::string_view text,
       const TokenMap& allowed_special) const;
 
   virtual Result<std::vector<uint64_t>> byte_pair_encode_(
@@ -166,14 +316,53 @@ class BPETokenizerBase : public Tokenizer {
       const TokenMap& ranks,
       std::function<uint64_t(uint64_t, uint64_t)> func) const;
 
+  // Encode the given pieces of `text` and append their tokens to `ret`. A
+  // piece in closed_form_pieces_ or that is a token is emitted as is, the
+  // others are merged with the base byte_pair_encode_ over token_map_, in
+  // batches of merge_batch_size_. Only for tokenizers that do not override
+  // the merge.
+  Error encode_pieces_(
+      std::string_view text,
+      const std::vector<Match>& pieces,
+      std::vector<uint64_t>& ret,
+      uint64_t& last_piece_token_len) const;
+
+  // encode_pieces_ without the piece cache. If piece_ends is given, the size
+  // of `ret` after each piece is appended to it.
+  Error merge_pieces_(
+      std::string_view text,
+      const std::vector<Match>& pieces,
+      std::vector<uint64_t>& ret,
+      uint64_t& last_piece_token_len,
+      std::vector<size_t>* piece_ends) const;
+
+  // Build closed_form_pieces_ from the base merge over token_map_, if enabled
+  // and the tokenizer encodes. Called by load() of tokenizers that use
+  // encode_pieces_.
+  Error build_closed_form_pieces_();
+
+  // Split text that contains no special token into the pieces _encode merges
+  // independently, after any normalization. The default reports EncodeFailure
+  // for tokenizers that do not support visit_pieces().
+  virtual Error _pre_tokenize(
+      std::string_view input,
+      std::vector<std::string>& pieces) const;
+
   // Protected members that can be overloaded by other BPE tokenizers
   std::unique_ptr<IRegex> special_token_regex_;
   std::optional<TokenMap> token_map_;
   std::optional<TokenMap> special_token_map_;
+  RegexOptions regex_options_;
+  TokenizerMode mode_ = TokenizerMode::EncodeDecode;
+  size_t merge_batch_size_ = kDefaultMergeBatchSize;
+  std::shared_ptr<PieceCache> piece_cache_;
+  uint64_t model_fingerprint_ = 0;
+  bool use_closed_form_pieces_ = true;
+  ClosedFormPieces closed_form_pieces_;
 
  private:
   virtual Error _encode(
-      const std::string& input,
+      std::string_view input,
       std::vector<uint64_t>& ret,
       uint64_t& last_piece_token_len) const = 0;
 
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * @file
+ * Native byte-level BPE trainer.
+ */
+
+#pragma once
+
+// Standard
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Third Party
+#include <nlohmann/json.hpp>
+
+// Local
+#include <pytorch/tokenizers/error.h>
+#include <pytorch/tokenizers/executor.h>
+#include <pytorch/tokenizers/pre_tokenizer.h>
+#include <pytorch/tokenizers/result.h>
+
+namespace tokenizers {
+
+struct BPETrainerConfig {
+  /// Size of the trained vocabulary: the 256 single bytes plus one token per
+  /// merge. Special tokens come on top.
+  size_t vocab_size = 32000;
+
+  /// Merges of pairs seen fewer times than this are not learned
+  uint64_t min_frequency = 2;
+
+  /// Number of parts the work is split into, 0 for the concurrency of the
+  /// executor
+  size_t num_threads = 0;
+
+  /// Executor the parts run on, nullptr for default_executor()
+  std::shared_ptr<Executor> executor;
+
+  /// Number of independently locked shards of the word counts
+  size_t num_shards = 64;
+
+  /// Special tokens, numbered after the trained vocabulary
+  std::vector<std::string> special_tokens;
+};
+
+/**
+ * Learns byte-level BPE merges from a corpus.
+ *
+ * feed() pre-tokenizes text on the executor and counts the resulting words
+ * in sharded hash maps, so it can be called from several threads at once.
+ * train() then starts from the 256 single bytes and repeatedly merges the most
+ * frequent adjacent pair. Pair counts live in a max-heap with lazy updates,
+ * and each merge only revisits the words that contain the merged pair.
+ * Ties are broken towards the lowest pair of token ids so training is
+ * deterministic.
+ *
+ * Token i of the result has rank i, matching the tiktoken convention. Tokens
+ * 0 to 255 are the single bytes and every merge adds one token, unless two
+ * merges spell the same bytes.
+ *
+ * Usage Example:
+ *
+ * BPETrainer trainer(
+ *     PreTokenizerConfig("Split")
+ *         .set_pattern(pattern)
+ *         .set_behavior("Isolated")
+ *         .create(),
+ *     config);
+ * trainer.feed(documents);
+ * trainer.train();
+ * trainer.save_tiktoken("tokenizer.model");
+ */
+class BPETrainer {
+ public:
+  /**
+   * @param pre_tokenizer: Splits text into words. Merges never cross word
+   *    boundaries. It must return raw text, not byte-level mapped pieces.
+   */
+  explicit BPETrainer(
+      PreTokenizer::Ptr pre_tokenizer,
+      BPETrainerConfig config = {});
+
+  BPETrainer(const BPETrainer&) = delete;
+  BPETrainer& operator=(const BPETrainer&) = delete;
+
+  /** Pre-tokenize the texts and add their words to the counts */
+  Error feed(const std::vector<std::string>& texts);
+
+  /** Add a word that was counted elsewhere */
+  void add_word(const std::string& word, uint64_t count = 1);
+
+  /** Learn merges from the words fed so far */
+  Error train();
+
+  /** Bytes of each trained token, indexed by rank */
+  const std::vector<std::string>& vocab() const {
+    return vocab_;
+  }
+
+  /** Ranks of the two tokens of each merge, in the order they were learned */
+  const std::vector<std::pair<uint32_t, uint32_t>>& merges() const {
+    return merges_;
+  }
+
+  /** Number of distinct words counted so far */
+  size_t num_words() const;
+
+  /**
+   * Write a tiktoken rank file: one "<base64 token> <rank>" line per token.
+   * Special tokens are not part of the format and are passed to the Tiktoken
+   * constructor instead.
+   */
+  Error save_tiktoken(const std::string& path) const;
+
+  /**
+   * Build a HuggingFace tokenizer.json with a byte-level BPE model.
+   *
+   * @param pre_tokenizer: The "pre_tokenizer" entry. It must end in a
+   *    ByteLevel pre-tokenizer and split like the one used for training. The
+   *    default is the GPT-2 ByteLevel pre-tokenizer.
+   */
+  nlohmann::json to_hf_json(const nlohmann::json& pre_tokenizer = {}) const;
+
+  /** Write to_hf_json() to path */
+  Error save_hf_tokenizer(
+      const std::string& path,
+      const nlohmann::json& pre_tokenizer = {}) const;
+
+ private:
+  struct Shard {
+    std::mutex mutex;
+    std::unordered_map<std::string, uint64_t> counts;
+  };
+
+  // Add locally counted words to the shared shards
+  void merge_counts(std::unordered_map<std::string, uint64_t>& counts);
+
+  std::shared_ptr<Executor> executor() const;
+
+  size_t num_parts(const Executor& executor) const;
+
+  PreTokenizer::Ptr pre_tokenizer_;
+  BPETrainerConfig config_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+
+  std::vector<std::string> vocab_;
+  std::vector<std::pair<uint32_t, uint32_t>> merges_;
+  bool trained_ = false;
+};
+
+} // namespace tokenizers
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * @file
+ * Stable C interface for FFI consumers.
+ *
+ * Tokenizers and stream decoders are opaque handles. Batch entry points work
+ * on caller-owned flat buffers: a batch of N strings is one byte buffer plus
+ * N + 1 offsets, string i being bytes [offsets[i], offsets[i + 1]). Token id
+ * sequences use the same layout. A whole batch therefore crosses the FFI
+ * boundary in one call and is written straight into memory owned by the
+ * foreign runtime.
+ *
+ * Output buffers are never written past their capacity. When one is too small
+ * the call returns TK_ERROR_BUFFER_TOO_SMALL and reports the required size, so
+ * the caller can grow the buffer and retry.
+ *
+ * A loaded tokenizer may be used from several threads at once. A stream
+ * decoder must only be used by one thread at a time.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32) && defined(TK_C_API_BUILD_DLL)
+#define TK_C_API __declspec(dllexport)
+#elif defined(__GNUC__)
+#define TK_C_API __attribute__((visibility("default")))
+#else
+#define TK_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Version of this interface, bumped on incompatible changes */
+#define TK_C_API_VERSION 1
+
+/**
+ * Status codes. Values below 0x100 mirror tokenizers::Error.
+ */
+typedef int32_t tk_status_t;
+
+enum {
+  TK_OK = 0x00,
+  TK_ERROR_INTERNAL = 0x01,
+  TK_ERROR_UNINITIALIZED = 0x02,
+  TK_ERROR_OUT_OF_RANGE = 0x03,
+  TK_ERROR_LOAD_FAILURE = 0x04,
+  TK_ERROR_ENCODE_FAILURE = 0x05,
+  TK_ERROR_BASE64_DECODE_FAILURE = 0x06,
+  TK_ERROR_PARSE_FAILURE = 0x07,
+  TK_ERROR_DECODE_FAILURE = 0x08,
+  TK_ERROR_REGEX_FAILURE = 0x09,
+  TK_ERROR_UNSUPPORTED = 0x0A,
+  /// A required pointer is null, an offset array is not monotonic or the
+  /// tokenizer type is unknown
+  TK_ERROR_INVALID_ARGUMENT = 0x100,
+  /// An output buffer is too small, see the *_required out parameter
+  TK_ERROR_BUFFER_TOO_SMALL = 0x101,
+};
+
+typedef struct tk_tokenizer tk_tokenizer;
+typedef struct tk_stream_decoder tk_stream_decoder;
+
+/** Return TK_C_API_VERSION of the library actually linked */
+TK_C_API uint32_t tk_api_version(void);
+
+/** Return a static, human-readable name for a status code */
+TK_C_API const char* tk_status_string(tk_status_t status);
+
+// -- Tokenizers ---------------------------------------------------------------
+
+/**
+ * Create and load a tokenizer.
+ *
+ * @param type One of "tiktoken", "hf_tokenizer", "sentencepiece", "tekken" or
+ * "llama2c". Builds with TOKENIZERS_MINIMAL only support "tiktoken" and
+ * "llama2c".
+ * @param path Path of the tokenizer artifact.
+ * @param out Receives the tokenizer, to be released with tk_tokenizer_free.
+ */
+TK_C_API tk_status_t
+tk_tokenizer_load(const char* type, const char* path, tk_tokenizer** out);
+
+/** Release a tokenizer. Accepts NULL. */
+TK_C_API void tk_tokenizer_free(tk_tokenizer* tokenizer);
+
+TK_C_API int32_t tk_vocab_size(const tk_tokenizer* tokenizer);
+TK_C_API uint64_t tk_bos_token(const tk_tokenizer* tokenizer);
+TK_C_API uint64_t tk_eos_token(const tk_tokenizer* tokenizer);
+
+// -- Batch encode and decode --------------------------------------------------
+
+/**
+ * Encode a batch of strings.
+ *
+ * @param text Bytes of all input strings, back to back.
+ * @param text_offsets num_texts + 1 offsets into text.
+ * @param bos Number of BOS tokens to prepend to each sequence.
+ * @param eos Number of EOS tokens to append to each sequence.
+ * @param ids Output token ids of all sequences, back to back.
+ * @param ids_capacity Number of elements ids can hold.
+ * @param id_offsets Output, num_texts + 1 offsets into ids.
+ * @param ids_required Optional output, total number of ids of the batch. Set
+ * on success and on TK_ERROR_BUFFER_TOO_SMALL.
+ */
+TK_C_API tk_status_t tk_encode_batch(
+    const tk_tokenizer* tokenizer,
+    const char* text,
+    const size_t* text_offsets,
+    size_t num_texts,
+    int8_t bos,
+    int8_t eos,
+    uint64_t* ids,
+    size_t ids_capacity,
+    size_t* id_offsets,
+    size_t* ids_required);
+
+/**
+ * Encode one UTF-16 string, as held by Java, .NET and JavaScript hosts,
+ * without transcoding it on the caller's side. Unpaired surrogates are
+ * encoded as U+FFFD.
+ *
+ * @param text UTF-16 code units of the string.
+ * @param length Number of code units of text.
+ * @param bos Number of BOS tokens to prepend.
+ * @param eos Number of EOS tokens to append.
+ * @param ids Output token ids.
+ * @param ids_capacity Number of elements ids and token_ends can hold.
+ * @param token_ends Optional output, for each token the offset in code units
+ * of text at which it ends. A token ending inside a character ends after it.
+ * Only Tiktoken and Tekken tokenizers report offsets; others return
+ * TK_ERROR_UNSUPPORTED.
+ * @param ids_required Optional output, number of ids of the string. Set on
+ * success and on TK_ERROR_BUFFER_TOO_SMALL.
+ */
+TK_C_API tk_status_t tk_encode_utf16(
+    const tk_tokenizer* tokenizer,
+    const uint16_t* text,
+    size_t length,
+    int8_t bos,
+    int8_t eos,
+    uint64_t* ids,
+    size_t ids_capacity,
+    size_t* token_ends,
+    size_t* ids_required);
+
+/**
+ * Decode a batch of token id sequences. Each sequence is decoded as if it
+ * followed a BOS token.
+ *
+ * @param ids Token ids of all sequences, back to back.
+ * @param id_offsets num_sequences + 1 offsets into ids.
+ * @param text Output bytes of all decoded strings, back to back. Strings are
+ * not NUL terminated.
+ * @param text_capacity Number of bytes text can hold.
+ * @param text_offsets Output, num_sequences + 1 offsets into text.
+ * @param text_required Optional output, total number of bytes of the batch.
+ * Set on success and on TK_ERROR_BUFFER_TOO_SMALL.
+ */
+TK_C_API tk_status_t tk_decode_batch(
+    const tk_tokenizer* tokenizer,
+    const uint64_t* ids,
+    const size_t* id_offsets,
+    size_t num_sequences,
+    char* text,
+    size_t text_capacity,
+    size_t* text_offsets,
+    size_t* text_required);
+
+// -- Warm-up ------------------------------------------------------------------
+
+/** Flags of tk_warm_start */
+enum {
+  /// Do not touch the pages of the model tables
+  TK_WARM_START_NO_PREFAULT = 0x1,
+  /// mlock the model tables. Regions that cannot be locked are skipped.
+  TK_WARM_START_LOCK_MEMORY = 0x2,
+};
+
+/**
+ * Bring a freshly loaded tokenizer to its steady-state speed by prefaulting
+ * its tables and encoding and decoding a sample corpus. Call it before
+ * reporting the tokenizer ready to serve.
+ *
+ * @param text Bytes of the sample texts, back to back, in the layout of
+ * tk_encode_batch. With num_texts 0 a built-in corpus is used.
+ * @param flags Bitwise or of TK_WARM_START_* flags.
+ * @param elapsed_ns Optional output, wall time of the warm-up.
+ */
+TK_C_API tk_status_t tk_warm_start(
+    const tk_tokenizer* tokenizer,
+    const char* text,
+    const size_t* text_offsets,
+    size_t num_texts,
+    uint32_t flags,
+    uint64_t* elapsed_ns);
+
+// -- Executor -----------------------------------------------------------------
+
+/** A unit of work handed to a tk_submit_fn. Call it once, as task(arg). */
+typedef void (*tk_task_fn)(void* arg);
+
+/**
+ * Run task(arg) at some point, on any thread of the caller's pool.
+ */
+typedef void (*tk_submit_fn)(void* context, tk_task_fn task, void* arg);
+
+/**
+ * Route the library's internal parallel work (e.g. the texts of
+ * tk_encode_batch) to a thread pool owned by the caller instead of the
+ * library's own worker threads.
+ *
+ * @param submit Called to queue a task, with context as first argument. Every
+ * queued task must eventually run. NULL restores the built-in executor.
+ * @param concurrency Number of tasks the pool runs at the same time. With 1
+ * the work runs on the calling thread.
+ */
+TK_C_API tk_status_t
+tk_set_executor(tk_submit_fn submit, void* context, uint32_t concurrency);
+
+// -- Stream decoding ----------------------------------------------------------
+
+/**
+ * Create a decoder turning tokens into text one at a time, e.g. while
+ * sampling. Output is only cut at UTF-8 character boundaries: bytes of a
+ * character split across tokens are held back until it is complete.
+ *
+ * The decoder refers to the tokenizer, which must outlive it.
+ */
+TK_C_API tk_status_t tk_stream_decoder_new(
+    const tk_tokenizer* tokenizer,
+    tk_stream_decoder** out);
+
+/** Release a stream decoder. Accepts NULL. */
+TK_C_API void tk_stream_decoder_free(tk_stream_decoder* decoder);
+
+/** Drop buffered bytes and start a new sequence */
+TK_C_API void tk_stream_decoder_reset(tk_stream_decoder* decoder);
+
+/**
+ * Decode one token and write the text that became complete.
+ *
+ * At most capacity bytes are written. Complete text that does not fit stays
+ * buffered and is written by later calls.
+ *
+ * @param written Output, number of bytes written to out.
+ */
+TK_C_API tk_status_t tk_stream_decoder_push(
+    tk_stream_decoder* decoder,
+    uint64_t token,
+    char* out,
+    size_t capacity,
+    size_t* written);
+
+/**
+ * Write all buffered bytes, including an incomplete trailing UTF-8 sequence,
+ * and start a new sequence.
+ *
+ * @param written Output, number of bytes written to out, or the number of
+ * bytes needed on TK_ERROR_BUFFER_TOO_SMALL, in which case nothing is
+ * written or dropped.
+ */
+TK_C_API tk_status_t tk_stream_decoder_flush(
+    tk_stream_decoder* decoder,
+    char* out,
+    size_t capacity,
+    size_t* written);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
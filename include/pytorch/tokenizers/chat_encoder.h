@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * @file
+ * Encoding of conversations for supervised fine-tuning.
+ */
+
+#pragma once
+
+// Standard
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/bpe_tokenizer_base.h>
+#include <pytorch/tokenizers/error.h>
+#include <pytorch/tokenizers/result.h>
+
+namespace tokenizers {
+
+struct ChatMessage {
+  std::string role;
+  std::string content;
+};
+
+/**
+ * How a conversation is rendered to text. Special tokens are written out as
+ * text and encoded like any other occurrence of them.
+ */
+struct ChatTemplate {
+  /// Text before the first message
+  std::string begin;
+
+  /// Text before the content of each message, "{role}" is replaced by the
+  /// role of the message
+  std::string message_begin;
+
+  /// Text after the content of each message
+  std::string message_end;
+
+  /// Text after the last message, e.g. the header of a turn to generate
+  std::string end;
+
+  /// Known roles. The role id of a message is the index of its role here.
+  std::vector<std::string> roles = {"system", "user", "assistant", "tool"};
+
+  /// Roles whose content and message_end are trained on
+  std::vector<std::string> trained_roles = {"assistant"};
+
+  /// Llama 3 header and end-of-turn tokens
+  static ChatTemplate llama3();
+
+  /// ChatML <|im_start|> / <|im_end|> markers
+  static ChatTemplate chatml();
+};
+
+/** Token ids of a conversation and parallel per-token annotations */
+struct ChatEncoding {
+  std::vector<uint64_t> tokens;
+
+  // Index of the message each token belongs to, -1 for the template's begin
+  // and end text
+  std::vector<int32_t> segment_ids;
+
+  // Index in ChatTemplate::roles of the role of that message, -1 outside of
+  // messages
+  std::vector<int32_t> role_ids;
+
+  // 1 for tokens to compute the loss on, 0 otherwise
+  std::vector<uint8_t> loss_mask;
+};
+
+/**
+ * Encodes conversations into token ids together with a segment id, a role id
+ * and a loss mask per token.
+ *
+ * The conversation is rendered with the template and encoded once. The tokens
+ * are therefore exactly those of encoding render(messages), whatever the
+ * content of the messages. Each token is then attributed to the part of the
+ * rendered text its first byte falls in: the template's begin or end, or the
+ * header, content or footer of a message. Tokens starting in the content or
+ * footer of a message with a trained role are masked in.
+ *
+ * The tokenizer must hold raw token bytes (Tiktoken, Tekken), see
+ * BPETokenizerBase::encode_with_offsets().
+ *
+ * Usage Example:
+ *
+ * ChatEncoder encoder(tokenizer, ChatTemplate::llama3());
+ * auto encoding = encoder.encode({{"user", "Hi"}, {"assistant", "Hello!"}});
+ */
+class ChatEncoder {
+ public:
+  /** The tokenizer must be loaded and outlive the encoder */
+  ChatEncoder(
+      const detail::BPETokenizerBase& tokenizer,
+      ChatTemplate chat_template);
+
+  /** Render the conversation to text */
+  std::string render(const std::vector<ChatMessage>& messages) const;
+
+  /**
+   * Encode the conversation. Messages with a role that is not in the
+   * template's roles are rejected with EncodeFailure.
+   */
+  Result<ChatEncoding> encode(const std::vector<ChatMessage>& messages) const;
+
+ private:
+  // Index of the role in chat_template_.roles, or -1
+  int32_t role_id(const std::string& role) const;
+
+  std::string message_begin(const std::string& role) const;
+
+  const detail::BPETokenizerBase& tokenizer_;
+  ChatTemplate chat_template_;
+  std::vector<bool> trained_;
+};
+
+} // namespace tokenizers
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * @file
+ * Tables of the tokens of pieces from small closed classes, looked up without
+ * hashing or merging: groups of one to three ASCII digits, and runs of one
+ * repeated white space or ASCII punctuation byte. Code and tabular data are
+ * full of both.
+ */
+
+#pragma once
+
+// Standard
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/error.h>
+#include <pytorch/tokenizers/result.h>
+
+namespace tokenizers {
+
+class ClosedFormPieces {
+ public:
+  /** Returns the token of a piece that is one */
+  using TokenLookup =
+      std::function<std::optional<uint64_t>(std::string_view piece)>;
+
+  /** Encodes one piece exactly as the tokenizer merges it */
+  using PieceEncoder =
+      std::function<Result<std::vector<uint64_t>>(std::string_view piece)>;
+
+  /** Longest digit group in the tables, as matched by \p{N}{1,3} */
+  static constexpr size_t kMaxDigits = 3;
+
+  /** Longest block looked for, and shortest run table */
+  static constexpr size_t kMaxRunBlock = 128;
+  static constexpr size_t kMinRunTable = 16;
+
+  ClosedFormPieces() {
+    clear();
+  }
+
+  /**
+   * Build the tables from the tokens `encode` gives every piece they cover.
+   * Runs are composed from blocks: a single-token run of `block` bytes, up
+   * to kMaxRunBlock, such that every run longer than a table of two blocks
+   * (at least kMinRunTable) encodes to one block followed by the run of the
+   * rest. That is checked against `encode` for the runs up to one block, and
+   * at least kMinRunTable bytes, past the table, trying the longest blocks
+   * first; longer runs then encode to blocks followed by a run from the
+   * table. A byte without such a block only has the runs up to its longest
+   * single-token run tabulated. Classes that `encode` fails on are left out.
+   */
+  Error build(const TokenLookup& find_token, const PieceEncoder& encode);
+
+  /** Drop the tables, lookup() then covers nothing */
+  void clear();
+
+  /**
+   * Append the tokens of the piece to `tokens` and return true, or return
+   * false leaving `tokens` untouched.
+   */
+  bool lookup(std::string_view piece, std::vector<uint64_t>& tokens) const;
+
+  /**
+   * Longest run of `byte` that lookup() covers: 0 if none, SIZE_MAX if runs
+   * of any length are composed.
+   */
+  size_t max_run(char byte) const;
+
+  bool empty() const {
+    return digit_offsets_.empty() && runs_.empty();
+  }
+
+ private:
+  // Tokens of the runs of one byte. The run of n bytes, 1 <= n <= size(),
+  // has tokens[offsets[n - 1], offsets[n]).
+  struct Run {
+    std::vector<uint32_t> offsets;
+    std::vector<uint64_t> tokens;
+    // Length and token of the block longer runs are composed from
+    size_t block = 0;
+    uint64_t block_token = 0;
+    bool composable = false;
+
+    size_t size() const {
+      return offsets.size() - 1;
+    }
+  };
+
+  static constexpr uint8_t kNoRun = 0xff;
+
+  void append_run(const Run& run, size_t n, std::vector<uint64_t>& tokens)
+      const;
+
+  // Digit group of length l and value v at index kDigitBase[l] + v
+  std::vector<uint32_t> digit_offsets_;
+  std::vector<uint64_t> digit_tokens_;
+  // Index in runs_ of the runs of each byte, or kNoRun
+  uint8_t run_index_[256];
+  std::vector<Run> runs_;
+};
+
+} // namespace tokenizers
@@ -58,6 +58,9 @@ enum class Error : error_code_t {
 
   /// No suitable regex implementation found.
   RegexFailure = 0x09,
+
+  /// Operation not available in the mode the tokenizer was loaded in.
+  Unsupported = 0x0A,
 };
 
 } // namespace tokenizers
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// Executors run the library's internal parallel work (corpus profiling, BPE
+// training, batch encoding). The library never starts threads of its own
+// outside of an executor, so an application can route all of it to the pools
+// it already runs.
+#pragma once
+
+// Standard
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tokenizers {
+
+/**
+ * @brief Runs tasks, possibly on other threads.
+ *
+ * Implementations only need submit() and concurrency(). parallel_for() is
+ * built on top of them; the calling thread takes part in the loop, so it also
+ * completes when called from a task of the same executor.
+ */
+class Executor {
+ public:
+  using Task = std::function<void()>;
+
+  virtual ~Executor() = default;
+
+  /**
+   * Run the task at some point, on any thread. Tasks must not throw.
+   */
+  virtual void submit(Task task) = 0;
+
+  /**
+   * Number of tasks the executor runs at the same time.
+   */
+  virtual size_t concurrency() const = 0;
+
+  /**
+   * Call body(begin, end) on disjoint ranges covering [0, size) and return
+   * once all calls returned. Ranges hold at least `grain` items (except the
+   * last one), so that cheap items are not scheduled one by one.
+   */
+  virtual void parallel_for(
+      size_t size,
+      size_t grain,
+      const std::function<void(size_t, size_t)>& body);
+};
+
+/**
+ * @brief Runs every task on the calling thread, for single-threaded builds.
+ */
+class InlineExecutor : public Executor {
+ public:
+  void submit(Task task) override;
+  size_t concurrency() const override;
+  void parallel_for(
+      size_t size,
+      size_t grain,
+      const std::function<void(size_t, size_t)>& body) override;
+};
+
+/**
+ * @brief Adapter for a pool owned by the caller, e.g. a serving executor or
+ * an intra-op thread pool.
+ *
+ * Usage Example:
+ *
+ * auto executor = std::make_shared<CallbackExecutor>(
+ *     [&pool](Executor::Task task) { pool.add(std::move(task)); },
+ *     pool.num_threads());
+ * set_default_executor(executor);
+ */
+class CallbackExecutor : public Executor {
+ public:
+  CallbackExecutor(std::function<void(Task)> submit, size_t concurrency);
+
+  void submit(Task task) override;
+  size_t concurrency() const override;
+
+ private:
+  std::function<void(Task)> submit_;
+  size_t concurrency_;
+};
+
+/**
+ * @brief Fixed set of worker threads with a task deque each.
+ *
+ * Tasks submitted from a worker go to the back of its own deque, and workers
+ * take their own tasks from the back. Other tasks are spread over the deques
+ * in turn. An idle worker steals from the front of the others' deques before
+ * going to sleep. The destructor runs the pending tasks and joins the workers.
+ */
+class WorkStealingExecutor : public Executor {
+ public:
+  /**
+   * @param num_threads number of workers, 0 for
+   * std::thread::hardware_concurrency()
+   */
+  explicit WorkStealingExecutor(size_t num_threads = 0);
+  ~WorkStealingExecutor() override;
+
+  void submit(Task task) override;
+  size_t concurrency() const override;
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  void run(size_t index);
+  bool try_pop(size_t index, Task& task);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+  std::atomic<size_t> next_worker_{0};
+  // Tasks submitted and not yet taken by a worker
+  std::atomic<size_t> pending_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stopping_ = false;
+};
+
+/**
+ * Return the executor used when none is configured. Unless replaced with
+ * set_default_executor(), it is a WorkStealingExecutor with a worker per core,
+ * started on first use, or an InlineExecutor in TOKENIZERS_MINIMAL builds.
+ */
+std::shared_ptr<Executor> default_executor();
+
+/**
+ * Replace the executor returned by default_executor(). Pass nullptr to go back
+ * to the built-in one. Work already running keeps the executor it started on.
+ */
+void set_default_executor(std::shared_ptr<Executor> executor);
+
+/**
+ * Split [0, size) into `parts` contiguous ranges of about the same size (fewer
+ * if size is smaller) and call fn(part, begin, end) for each of them on the
+ * executor. This is for loops that keep state per part, indexed by `part`.
+ * Trailing parts may be empty.
+ */
+void parallel_for_parts(
+    Executor& executor,
+    size_t size,
+    size_t parts,
+    const std::function<void(size_t, size_t, size_t)>& fn);
+
+} // namespace tokenizers
@@ -22,6 +22,7 @@
 #include <pytorch/tokenizers/pre_tokenizer.h>
 #include <pytorch/tokenizers/result.h>
 #include <pytorch/tokenizers/token_decoder.h>
+#include <pytorch/tokenizers/work_counters.h>
 
 namespace tokenizers {
 namespace detail {
@@ -45,7 +46,8 @@ using MergeMap = std::unordered_map<
 template <typename TMergeMap>
 inline Result<TokenMap> build_merge_ranks_map(
     const TMergeMap& merge_map,
-    const TokenMap& token_map) {
+    const TokenMap& token_map,
+    MapDirection direction = MapDirection::Both) {
   // Static assertions to verify TMergeMap has the expected key and value types
   using KeyType = typename TMergeMap::key_type;
   using ValueType = typename TMergeMap::mapped_type;
@@ -90,7 +92,7 @@ inline Result<TokenMap> build_merge_ranks_map(
     merge_rank_pairs.emplace_back(token, rank);
   }
 
-  return build_token_map(std::move(merge_rank_pairs));
+  return build_token_map(std::move(merge_rank_pairs), direction);
 }
 
 } // namespace detail
@@ -115,6 +117,7 @@ struct HFWord {
       const detail::TokenMap& token_map) {
     while (tokens.size() > 1) {
       std::optional<std::pair<size_t, uint32_t>> best_merge;
+      TK_COUNT_WORK(merge_steps, tokens.size());
 
       // Find the best merge (lowest rank) among adjacent token pairs
       for (size_t i = 0; i < tokens.size() - 1; ++i) {
@@ -182,12 +185,20 @@ class HFTokenizer : public detail::BPETokenizerBase {
    */
   Error load(const std::string& tokenizer_path) override;
 
+  std::vector<MemoryRegion> memory_regions() const override;
+
+  RegexStats regex_stats() const override;
+
  private:
   Error _encode(
-      const std::string& input,
+      std::string_view input,
       std::vector<uint64_t>& ret,
       uint64_t& last_piece_token_len) const override;
 
+  Error _pre_tokenize(
+      std::string_view input,
+      std::vector<std::string>& pieces) const override;
+
   void _decode(const std::string& input, std::string& ret) const override;
 
   Result<std::vector<uint64_t>> byte_pair_encode_(
@@ -206,7 +217,6 @@ class HFTokenizer : public detail::BPETokenizerBase {
   PreTokenizer::Ptr _pretokenizer;
   TokenDecoder::Ptr _decoder;
 
-  std::unique_ptr<detail::MergeMap> merge_map_;
   std::optional<detail::TokenMap>
       merge_ranks_; // Pre-computed merge ranks for BPE
 };
@@ -27,6 +27,8 @@ class Llama2cTokenizer : public Tokenizer {
   Result<std::string> decode(uint64_t prev_token, uint64_t token)
       const override;
 
+  std::vector<MemoryRegion> memory_regions() const override;
+
  private:
   inline Error _decode_verify(uint64_t token) const {
     if (!initialized_) {
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// Hand-written scanners for the regexes used by the built-in BPE tokenizers.
+// They need neither RE2 nor PCRE2 and back create_regex() in the
+// TOKENIZERS_MINIMAL build.
+#pragma once
+
+// Standard
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/regex.h>
+#include <pytorch/tokenizers/result.h>
+
+namespace tokenizers {
+
+/**
+ * @brief Scanner for the cl100k_base pre-tokenization pattern, also used by
+ * Llama 3:
+ *
+ *   (?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}|
+ *    ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+
+ *
+ * either verbatim, as found in tokenizer.json files, or without the
+ * \s+(?!\S) alternative, the RE2 compatible spelling used by Tiktoken. The
+ * verbatim spelling treats \s as White_Space like the regex engines it is
+ * written for, the RE2 spelling as [\t\n\f\r ] like RE2. Invalid UTF-8 bytes
+ * are never part of a match.
+ */
+class Cl100kRegex : public IRegex {
+ public:
+  /**
+   * @brief Accept one of the two spellings above, optionally wrapped in a
+   * capturing group. Any other pattern is a RegexFailure.
+   */
+  Error compile(const std::string& pattern) override;
+
+  std::vector<Match> find_all(std::string_view text) const override;
+
+ private:
+  // Length of the match starting at pos, 0 if there is none
+  size_t match_at(const char* data, size_t size, size_t pos) const;
+
+  bool compiled_ = false;
+  bool lookahead_ = false;
+};
+
+/**
+ * @brief Matcher for an alternation of literal strings, such as the special
+ * token patterns built by detail::build_special_token_regex().
+ *
+ * compile() accepts literals separated by '|', optionally wrapped in
+ * capturing groups, with regex metacharacters escaped by a backslash as done
+ * by IRegex::escape() and RE2::QuoteMeta(). As with RE2 the leftmost match
+ * wins and ties go to the earliest alternative.
+ */
+class LiteralRegex : public IRegex {
+ public:
+  Error compile(const std::string& pattern) override;
+
+  std::vector<Match> find_all(std::string_view text) const override;
+
+ private:
+  std::vector<std::string> literals_;
+  // Indices into literals_ by first byte, in pattern order
+  std::array<std::vector<uint32_t>, 256> by_first_byte_;
+};
+
+/**
+ * @brief Create the native scanner supporting the given pattern.
+ *
+ * @return RegexFailure if none of the scanners above supports the pattern.
+ */
+Result<std::unique_ptr<IRegex>> create_native_regex(const std::string& pattern);
+
+} // namespace tokenizers
@@ -10,9 +10,11 @@
 #pragma once
 
 // Standard
+#include <array>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 // Third Party
@@ -45,6 +47,21 @@ class Normalizer {
    */
   virtual std::string normalize(const std::string& input) const = 0;
 
+  /** Normalize the input into a caller-owned buffer
+   *
+   * Returns false if the normalized string is identical to the input. In that
+   * case `out` is left in an unspecified state and the caller should keep
+   * using `input`, which avoids copying text that needs no normalization.
+   * The output buffer is reused across calls, so steady-state normalization
+   * does not allocate.
+   *
+   * The default implementation delegates to normalize().
+   */
+  virtual bool normalize_into(std::string_view input, std::string& out) const {
+    out = normalize(std::string(input));
+    return true;
+  }
+
   virtual ~Normalizer() = default;
 }; // end class Normalizer
 
@@ -103,6 +120,46 @@ class NormalizerConfig {
    */
   NORMALIZER_CONFIG_MEMBER(std::vector<NormalizerConfig>, normalizers)
 
+  /**
+   * Used by: StripNormalizer
+   */
+  NORMALIZER_CONFIG_MEMBER(bool, strip_left)
+
+  /**
+   * Used by: StripNormalizer
+   */
+  NORMALIZER_CONFIG_MEMBER(bool, strip_right)
+
+  /**
+   * Used by: PrependNormalizer
+   */
+  NORMALIZER_CONFIG_MEMBER(std::string, prepend)
+
+  /**
+   * Used by: BertNormalizer
+   */
+  NORMALIZER_CONFIG_MEMBER(bool, clean_text)
+
+  /**
+   * Used by: BertNormalizer
+   */
+  NORMALIZER_CONFIG_MEMBER(bool, handle_chinese_chars)
+
+  /**
+   * Used by: BertNormalizer - Defaults to the value of lowercase if unset
+   */
+  NORMALIZER_CONFIG_MEMBER(bool, strip_accents)
+
+  /**
+   * Used by: BertNormalizer
+   */
+  NORMALIZER_CONFIG_MEMBER(bool, lowercase)
+
+  /**
+   * Used by: PrecompiledNormalizer - The base64 encoded charsmap
+   */
+  NORMALIZER_CONFIG_MEMBER(std::string, precompiled_charsmap)
+
   /*----------------*/
   /* Public methods */
   /*----------------*/
@@ -143,6 +200,8 @@ class ReplaceNormalizer : public Normalizer {
   /** Normalize with the stored pattern replacement */
   std::string normalize(const std::string& input) const override;
 
+  bool normalize_into(std::string_view input, std::string& out) const override;
+
  protected:
   static std::unique_ptr<IRegex> create_regex_(const std::string& pattern);
 
@@ -166,6 +225,10 @@ class SequenceNormalizer : public Normalizer {
   /** Perform normalization */
   std::string normalize(const std::string& input) const override;
 
+  /** Run all normalizers, ping-ponging between two buffers. Steps that leave
+   * their input unchanged cost a scan and no copy. */
+  bool normalize_into(std::string_view input, std::string& out) const override;
+
  private:
   const std::vector<Normalizer::Ptr> normalizers_;
 
@@ -184,6 +247,202 @@ class NFCNormalizer : public Normalizer {
   /** Normalize with NFC Unicode normalization */
   std::string normalize(const std::string& input) const override;
 
+  bool normalize_into(std::string_view input, std::string& out) const override;
+
 }; // end class NFCNormalizer
 
+// -- NFD / NFKC / NFKD -------------------------------------------------------
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/normalizers/unicode.rs
+
+class NFDNormalizer : public Normalizer {
+ public:
+  explicit NFDNormalizer() = default;
+
+  std::string normalize(const std::string& input) const override;
+
+  bool normalize_into(std::string_view input, std::string& out) const override;
+
+}; // end class NFDNormalizer
+
+class NFKCNormalizer : public Normalizer {
+ public:
+  explicit NFKCNormalizer() = default;
+
+  std::string normalize(const std::string& input) const override;
+
+  bool normalize_into(std::string_view input, std::string& out) const override;
+
+}; // end class NFKCNormalizer
+
+class NFKDNormalizer : public Normalizer {
+ public:
+  explicit NFKDNormalizer() = default;
+
+  std::string normalize(const std::string& input) const override;
+
+  bool normalize_into(std::string_view input, std::string& out) const override;
+
+}; // end class NFKDNormalizer
+
+// -- Lowercase ----------------------------------------------------------------
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/normalizers/utils.rs
+
+class LowercaseNormalizer : public Normalizer {
+ public:
+  explicit LowercaseNormalizer() = default;
+
+  /** Map every character to its full lowercase mapping */
+  std::string normalize(const std::string& input) const override;
+
+  bool normalize_into(std::string_view input, std::string& out) const override;
+
+}; // end class LowercaseNormalizer
+
+// -- Strip --------------------------------------------------------------------
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/normalizers/strip.rs
+
+class StripNormalizer : public Normalizer {
+ public:
+  /**
+   * @param left: Whether to strip leading whitespace
+   * @param right: Whether to strip trailing whitespace
+   */
+  explicit StripNormalizer(bool left = true, bool right = true)
+      : left_(left), right_(right) {}
+
+  std::string normalize(const std::string& input) const override;
+
+  bool normalize_into(std::string_view input, std::string& out) const override;
+
+ private:
+  const bool left_;
+  const bool right_;
+
+}; // end class StripNormalizer
+
+// -- StripAccents -------------------------------------------------------------
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/normalizers/strip.rs
+
+class StripAccentsNormalizer : public Normalizer {
+ public:
+  explicit StripAccentsNormalizer() = default;
+
+  /** Remove all non-spacing marks. This is usually preceded by NFD. */
+  std::string normalize(const std::string& input) const override;
+
+  bool normalize_into(std::string_view input, std::string& out) const override;
+
+}; // end class StripAccentsNormalizer
+
+// -- Prepend ------------------------------------------------------------------
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/normalizers/prepend.rs
+
+class PrependNormalizer : public Normalizer {
+ public:
+  /**
+   * @param prepend: The string to prepend to non-empty inputs
+   */
+  explicit PrependNormalizer(std::string prepend)
+      : prepend_(std::move(prepend)) {}
+
+  std::string normalize(const std::string& input) const override;
+
+  bool normalize_into(std::string_view input, std::string& out) const override;
+
+ private:
+  const std::string prepend_;
+
+}; // end class PrependNormalizer
+
+// -- Bert ---------------------------------------------------------------------
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/normalizers/bert.rs
+
+class BertNormalizer : public Normalizer {
+ public:
+  /**
+   * @param clean_text: Remove control characters and map all whitespace to a
+   *    plain space
+   * @param handle_chinese_chars: Surround CJK ideographs with spaces
+   * @param strip_accents: Decompose (NFD) and remove non-spacing marks. If
+   *    unset, follows `lowercase`
+   * @param lowercase: Lowercase the text
+   */
+  explicit BertNormalizer(
+      bool clean_text = true,
+      bool handle_chinese_chars = true,
+      std::optional<bool> strip_accents = std::nullopt,
+      bool lowercase = true)
+      : clean_text_(clean_text),
+        handle_chinese_chars_(handle_chinese_chars),
+        strip_accents_(strip_accents.value_or(lowercase)),
+        lowercase_(lowercase) {}
+
+  std::string normalize(const std::string& input) const override;
+
+  bool normalize_into(std::string_view input, std::string& out) const override;
+
+ private:
+  bool clean_text_and_chinese_chars(std::string_view input, std::string& out)
+      const;
+
+  const bool clean_text_;
+  const bool handle_chinese_chars_;
+  const bool strip_accents_;
+  const bool lowercase_;
+
+}; // end class BertNormalizer
+
+// -- Precompiled --------------------------------------------------------------
+// SentencePiece character map (e.g. nmt_nfkc) compiled to a double-array trie,
+// used by tokenizers converted from SentencePiece models
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/normalizers/precompiled.rs
+// https://github.com/google/sentencepiece/blob/master/src/normalizer.cc
+
+class PrecompiledNormalizer : public Normalizer {
+ public:
+  /**
+   * @param charsmap: The decoded charsmap: the size in bytes of the trie as a
+   *    little-endian uint32, the units of the Darts-clone double-array trie,
+   *    then the NUL-terminated replacement strings that the trie values point
+   *    into. The trie and strings are used in place. An empty charsmap leaves
+   *    the input unchanged.
+   */
+  explicit PrecompiledNormalizer(std::string charsmap);
+
+  std::string normalize(const std::string& input) const override;
+
+  /** Replace the longest key of the trie at each position. Runs of ASCII that
+   * the map leaves alone are skipped without trie lookups. */
+  bool normalize_into(std::string_view input, std::string& out) const override;
+
+ private:
+  // Length of the longest key that prefixes the text, 0 if there is none
+  size_t longest_match(
+      const char* text,
+      size_t size,
+      std::string_view& replacement) const;
+
+  uint32_t unit(size_t index) const;
+
+  const std::string charsmap_;
+
+  // Views into charsmap_
+  const char* units_ = nullptr;
+  size_t num_units_ = 0;
+  std::string_view normalized_;
+
+  // ASCII bytes that start no key and therefore map to themselves
+  std::array<bool, 128> ascii_identity_{};
+  // Whether all printable ASCII maps to itself
+  bool printable_ascii_identity_ = false;
+
+}; // end class PrecompiledNormalizer
+
 } // namespace tokenizers
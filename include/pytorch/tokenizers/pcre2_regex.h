@@ -44,7 +44,7 @@ class Pcre2Regex : public IRegex {
   /**
    * @brief Return all non-overlapping matches found in the input string.
    */
-  virtual std::vector<Match> find_all(const std::string& text) const override;
+  virtual std::vector<Match> find_all(std::string_view text) const override;
 
  private:
   pcre2_code* regex_;
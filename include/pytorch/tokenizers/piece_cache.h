@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * @file
+ * Caches of the tokens of BPE-merged pieces.
+ */
+
+#pragma once
+
+// Standard
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/error.h>
+#include <pytorch/tokenizers/result.h>
+
+namespace tokenizers {
+
+struct PieceCacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t inserts = 0;
+  // Inserts that replaced another entry
+  uint64_t evictions = 0;
+  // Entries skipped because a writer was updating them or they failed
+  // validation
+  uint64_t rejected_reads = 0;
+};
+
+/**
+ * Cache from (model, piece) to the tokens the piece merges into. Keys include
+ * a fingerprint of the model so that one cache can be shared by tokenizers
+ * with different vocabularies. Implementations must be thread safe, and may
+ * drop entries at any time.
+ */
+class PieceCache {
+ public:
+  virtual ~PieceCache() = default;
+
+  /**
+   * Append the cached tokens of the piece to `tokens` and return true, or
+   * return false leaving `tokens` untouched.
+   */
+  virtual bool lookup(
+      uint64_t model_fingerprint,
+      std::string_view piece,
+      std::vector<uint64_t>& tokens) const = 0;
+
+  /** Cache the tokens of the piece. Entries that do not fit are ignored. */
+  virtual void insert(
+      uint64_t model_fingerprint,
+      std::string_view piece,
+      const uint64_t* tokens,
+      size_t num_tokens) = 0;
+
+  /** Counters of this process */
+  virtual PieceCacheStats stats() const = 0;
+};
+
+/**
+ * PieceCache stored in a named POSIX shared-memory segment, so that every
+ * process on a host that opens the same name sees the pieces encoded by the
+ * others.
+ *
+ * The segment is a fixed-size open-addressing table of 128-byte slots. Each
+ * slot is guarded by a sequence number. Writers claim a slot by moving its
+ * sequence number from even to odd with a compare-and-swap, and publish it by
+ * making it even again. Readers treat an entry as a miss if its sequence
+ * number was odd or changed while it was copied. Entries also carry a checksum
+ * that is verified on every read, so torn or corrupted entries are never
+ * returned. Neither path takes a lock or makes a system call.
+ *
+ * A key is looked up in a window of kProbeWindow slots. When the window is
+ * full, the oldest entry in it is replaced. Pieces longer than
+ * kMaxPieceBytes or merging into more than kMaxTokens tokens are not cached.
+ *
+ * Usage Example:
+ *
+ * auto cache = SharedPieceCache::open("/tokenizers-cache", 1 << 20);
+ * tokenizer.set_piece_cache(cache.get());
+ */
+class SharedPieceCache : public PieceCache {
+ public:
+  static constexpr size_t kMaxPieceBytes = 48;
+  static constexpr size_t kMaxTokens = 12;
+  static constexpr size_t kProbeWindow = 8;
+
+  /**
+   * Open the segment with the given name, creating it if needed. All
+   * processes must use the same number of slots.
+   *
+   * @param name: POSIX shared-memory name, e.g. "/tokenizers-cache". Empty
+   *    for a cache private to this process.
+   * @param num_slots: Capacity in entries, rounded up to a power of two
+   */
+  static Result<std::shared_ptr<SharedPieceCache>> open(
+      const std::string& name,
+      size_t num_slots);
+
+  /** Remove the named segment. Processes that have it open keep using it. */
+  static Error unlink(const std::string& name);
+
+  ~SharedPieceCache() override;
+
+  SharedPieceCache(const SharedPieceCache&) = delete;
+  SharedPieceCache& operator=(const SharedPieceCache&) = delete;
+
+  bool lookup(
+      uint64_t model_fingerprint,
+      std::string_view piece,
+      std::vector<uint64_t>& tokens) const override;
+
+  void insert(
+      uint64_t model_fingerprint,
+      std::string_view piece,
+      const uint64_t* tokens,
+      size_t num_tokens) override;
+
+  PieceCacheStats stats() const override;
+
+  size_t num_slots() const {
+    return num_slots_;
+  }
+
+ private:
+  struct Header;
+  struct Slot;
+
+  SharedPieceCache(void* mapping, size_t mapping_size, size_t num_slots);
+
+  Slot* slot(size_t index) const;
+
+  void* mapping_;
+  size_t mapping_size_;
+  size_t num_slots_;
+
+  mutable std::atomic<uint64_t> hits_{0};
+  mutable std::atomic<uint64_t> misses_{0};
+  mutable std::atomic<uint64_t> rejected_reads_{0};
+  std::atomic<uint64_t> inserts_{0};
+  std::atomic<uint64_t> evictions_{0};
+};
+
+} // namespace tokenizers
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// Linear-time regex engine for the pattern syntax used by tokenizers. It backs
+// create_regex() for patterns that RE2 rejects, such as the \s+(?!\S)
+// alternative of GPT-2 style pre-tokenization patterns, in place of the
+// backtracking std::regex.
+#pragma once
+
+// Standard
+#include <memory>
+#include <string>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/regex.h>
+#include <pytorch/tokenizers/result.h>
+
+namespace tokenizers {
+
+/**
+ * @brief Pike VM over UTF-8 text. The pattern is compiled to a program whose
+ * threads all advance in lock step, one code point at a time, so a search
+ * takes time linear in the input and never recurses. Matches are leftmost
+ * first, with greedy and lazy quantifiers, as in PCRE2.
+ *
+ * Supported syntax:
+ *  - literals, `.` (anything but \n) and escapes: \t \n \r \f \v \e \0,
+ *    \xHH, \x{H...} and escaped punctuation
+ *  - \s \d \w and their negations, with Unicode semantics (White_Space, Nd,
+ *    and letters, marks, Nd, Pc and Join_Control)
+ *  - \p{..} and \P{..} for general categories (e.g. L, Lu, M, N, P, S, Z, C)
+ *    and scripts (e.g. Han, Latin), also in the one letter form \pL
+ *  - bracket expressions with ranges, negation and the escapes above
+ *  - groups (...), (?<name>...), (?:...), (?i:...) and (?i). Case-insensitive
+ *    parts may only contain ASCII literals and ranges, \s, \d and \p{N}
+ *  - alternation and the quantifiers * + ? {n} {n,} {n,m}, greedy or lazy
+ *  - the anchors ^ $ \A \z
+ *  - lookahead (?=X) and (?!X) where X matches a single code point
+ *
+ * compile() returns RegexFailure for anything else, such as backreferences,
+ * lookbehind or \b, so that create_regex() can fall back to another engine.
+ * Invalid UTF-8 bytes are never part of a match.
+ */
+class PikeRegex : public IRegex {
+ public:
+  PikeRegex();
+  ~PikeRegex() override;
+
+  Error compile(const std::string& pattern) override;
+
+  std::vector<Match> find_all(std::string_view text) const override;
+
+  struct Program;
+
+ private:
+  std::unique_ptr<Program> program_;
+};
+
+/**
+ * @brief Create a PikeRegex for the pattern, or a RegexFailure if the pattern
+ * uses syntax the engine does not support.
+ */
+Result<std::unique_ptr<IRegex>> create_pike_regex(const std::string& pattern);
+
+} // namespace tokenizers
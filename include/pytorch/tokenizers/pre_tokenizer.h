@@ -13,6 +13,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 // Third Party
@@ -47,9 +48,81 @@ class PreTokenizer {
   virtual std::vector<std::string> pre_tokenize(
       const std::string& input) const = 0;
 
+  /** Split the input string piece into sub-pieces given as byte ranges
+   *
+   * Appends the [start, end) range of each sub-piece to `out`. Pre-tokenizers
+   * that only split their input implement this so that the pieces never have
+   * to be materialized, and so that sequences of them compose without copies.
+   *
+   * Returns false, leaving `out` untouched, if this pre-tokenizer rewrites the
+   * text (e.g. ByteLevel, Metaspace). The caller must then use pre_tokenize().
+   */
+  virtual bool pre_tokenize_offsets(
+      std::string_view /* input */,
+      std::vector<Match>& /* out */) const {
+    return false;
+  }
+
+  /** Whether pre_tokenize_offsets() gives the pieces of every input
+   *
+   * Callers check this before trying the offsets path, so that a pre-tokenizer
+   * that rewrites the text never has the input split twice.
+   */
+  virtual bool supports_offsets() const {
+    return false;
+  }
+
+  /** Counters of the regexes this pre-tokenizer searches with, summed */
+  virtual RegexStats regex_stats() const {
+    return RegexStats{};
+  }
+
   virtual ~PreTokenizer() = default;
 }; // end class PreTokenizer
 
+/**
+ * Base class for pre-tokenizers that only split their input. Subclasses
+ * implement pre_tokenize_offsets() and the pieces are copied out of the input
+ * by pre_tokenize().
+ */
+class SplittingPreTokenizer : public PreTokenizer {
+ public:
+  std::vector<std::string> pre_tokenize(
+      const std::string& input) const override;
+
+  bool pre_tokenize_offsets(std::string_view input, std::vector<Match>& out)
+      const override = 0;
+
+  bool supports_offsets() const override {
+    return true;
+  }
+}; // end class SplittingPreTokenizer
+
+// -- Split behavior -----------------------------------------------------------
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/tokenizer/normalizer.rs
+
+/**
+ * What to do with the delimiters found when splitting a piece. For example,
+ * splitting "the-final--countdown" on "-" gives:
+ *
+ * - Removed: ["the", "final", "countdown"]
+ * - Isolated: ["the", "-", "final", "-", "-", "countdown"]
+ * - MergedWithPrevious: ["the-", "final-", "-", "countdown"]
+ * - MergedWithNext: ["the", "-final", "-", "-countdown"]
+ * - Contiguous: ["the", "-", "final", "--", "countdown"]
+ */
+enum class SplitDelimiterBehavior {
+  Removed,
+  Isolated,
+  MergedWithPrevious,
+  MergedWithNext,
+  Contiguous,
+};
+
+/** Parse a behavior name, throwing std::runtime_error if it is unknown */
+SplitDelimiterBehavior parse_split_delimiter_behavior(const std::string& name);
+
 // -- Factory ------------------------------------------------------------------
 
 // Helper macro to standardize addition of config member fields
@@ -100,7 +173,7 @@ class PreTokenizerConfig {
   CONFIG_MEMBER(bool, individual_digits)
 
   /**
-   * Used by: ByteLevelPreTokenizer
+   * Used by: ByteLevelPreTokenizer, MetaspacePreTokenizer
    */
   CONFIG_MEMBER(bool, add_prefix_space)
 
@@ -110,7 +183,7 @@ class PreTokenizerConfig {
   CONFIG_MEMBER(bool, is_delimiter)
 
   /**
-   * Used by RegexPreTokenizer - Split behavior
+   * Used by RegexPreTokenizer, PunctuationPreTokenizer - Split behavior
    */
   CONFIG_MEMBER(std::string, behavior)
 
@@ -124,6 +197,33 @@ class PreTokenizerConfig {
    */
   CONFIG_MEMBER(std::vector<PreTokenizerConfig>, pretokenizers)
 
+  /**
+   * Used by: CharDelimiterSplitPreTokenizer - A single UTF-8 character
+   */
+  CONFIG_MEMBER(std::string, delimiter)
+
+  /**
+   * Used by: MetaspacePreTokenizer
+   */
+  CONFIG_MEMBER(std::string, replacement)
+
+  /**
+   * Used by: MetaspacePreTokenizer - "always", "first" or "never"
+   */
+  CONFIG_MEMBER(std::string, prepend_scheme)
+
+  /**
+   * Used by: MetaspacePreTokenizer
+   */
+  CONFIG_MEMBER(bool, split)
+
+  /**
+   * Used by: RegexPreTokenizer, DigitsPreTokenizer - Options for compiling the
+   * regex. Inherited by the children of a SequencePreTokenizer that do not set
+   * their own.
+   */
+  CONFIG_MEMBER(RegexOptions, regex_options)
+
   /*----------------*/
   /* Public methods */
   /*----------------*/
@@ -149,57 +249,57 @@ class PreTokenizerConfig {
 // Used for general-purpose single-regex pre tokenization
 // CITE:
 // https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/pre_tokenizers/split.rs
-//
-// TODO: Support for "behavior" and "invert" options
-//  https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/tokenizer/normalizer.rs#L82
-//  https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/tokenizer/pattern.rs#L128
 
-class RegexPreTokenizer : public PreTokenizer {
+class RegexPreTokenizer : public SplittingPreTokenizer {
  public:
   /**
    * @param pattern: The regex pattern to use for token splitting
    * @param is_delimiter: Whether treat `pattern` as delimiter characters, or
    * use `pattern` as a regex pattern.
-   * @param behavior: Split behavior ("MergedWithPrevious" or "Isolated"
-   * supported) For example: "pre_tokenizer": { "type": "Split", "pattern": {
+   * @param behavior: Split behavior, one of the SplitDelimiterBehavior names.
+   * For example: "pre_tokenizer": { "type": "Split", "pattern": {
    *     "String": " "
    *   },
    *   "behavior": "Isolated",
    *   "invert": false
    * },
+   * @param invert: Split on the text that does not match `pattern` instead
    *
-   * Behavior options:
-   * - "MergedWithPrevious": Include delimiter with previous token
-   *   Example: "the-final--countdown" -> ["the-", "final-", "-", "countdown"]
-   * - "Isolated": Keep delimiters as separate tokens
-   *   Example: "the-final--countdown" -> ["the", "-", "final", "-", "-",
-   * "countdown"]
-   *
-   * Notice that the `invert` option is not supported.
+   * When `pattern` is a regex (is_delimiter == false) and neither `invert` nor
+   * a behavior other than "Removed" is given, the matches themselves are
+   * returned as the pieces.
    */
   explicit RegexPreTokenizer(
       const std::string& pattern,
       bool is_delimiter = false,
-      const std::string& behavior = "Removed")
-      : regex_(RegexPreTokenizer::create_regex_(pattern)),
+      const std::string& behavior = "Removed",
+      bool invert = false,
+      const RegexOptions& options = {})
+      : regex_(RegexPreTokenizer::create_regex_(pattern, options)),
         is_delimiter_(is_delimiter),
-        behavior_(behavior) {
-    if (behavior_.empty() ||
-        (behavior_ != "Removed" && behavior_ != "MergedWithPrevious" &&
-         behavior_ != "Isolated")) {
-      throw std::runtime_error("Unsupported behavior: " + behavior_);
-    }
-  }
+        behavior_(parse_split_delimiter_behavior(behavior)),
+        invert_(invert) {}
 
   /** Pre-tokenize with the stored regex */
-  std::vector<std::string> pre_tokenize(const std::string& input) const;
+  std::vector<std::string> pre_tokenize(
+      const std::string& input) const override;
+
+  bool pre_tokenize_offsets(std::string_view input, std::vector<Match>& out)
+      const override;
+
+  RegexStats regex_stats() const override;
 
  protected:
-  static std::unique_ptr<IRegex> create_regex_(const std::string& pattern);
+  static std::unique_ptr<IRegex> create_regex_(
+      const std::string& pattern,
+      const RegexOptions& options = {});
+
+  void split_(std::string_view input, std::vector<Match>& out) const;
 
   std::unique_ptr<IRegex> regex_;
   const bool is_delimiter_;
-  const std::string behavior_;
+  const SplitDelimiterBehavior behavior_;
+  const bool invert_;
 
 }; // end class RegexPreTokenizer
 
@@ -210,10 +310,16 @@ class RegexPreTokenizer : public PreTokenizer {
 
 class DigitsPreTokenizer : public RegexPreTokenizer {
  public:
-  explicit DigitsPreTokenizer(bool individual_digits = false)
+  explicit DigitsPreTokenizer(
+      bool individual_digits = false,
+      const RegexOptions& options = {})
       : RegexPreTokenizer(
             individual_digits ? R"([^\p{N}]+|\p{N})"
-                              : R"([^\p{N}]+|[\p{N}]+)") {}
+                              : R"([^\p{N}]+|[\p{N}]+)",
+            false,
+            "Removed",
+            false,
+            options) {}
 }; // end class DigitsPreTokenizer
 
 // -- ByteLevel ----------------------------------------------------------------
@@ -238,12 +344,152 @@ class ByteLevelPreTokenizer : public PreTokenizer {
   std::vector<std::string> pre_tokenize(
       const std::string& input) const override;
 
+  RegexStats regex_stats() const override;
+
  private:
   const std::string pattern_;
   const bool add_prefix_space_;
+  // The pattern compiled for the Pike VM. Null if it uses syntax the Pike VM
+  // does not support, in which case unicode_regex_split() splits the input.
+  std::unique_ptr<IRegex> regex_;
 
 }; // end class ByteLevelPreTokenizer
 
+// -- Whitespace ---------------------------------------------------------------
+// Splits on whitespace and on the boundaries between word characters and
+// other characters, like the regex \w+|[^\w\s]+
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/pre_tokenizers/whitespace.rs
+
+class WhitespacePreTokenizer : public SplittingPreTokenizer {
+ public:
+  explicit WhitespacePreTokenizer() = default;
+
+  bool pre_tokenize_offsets(std::string_view input, std::vector<Match>& out)
+      const override;
+}; // end class WhitespacePreTokenizer
+
+// -- WhitespaceSplit ----------------------------------------------------------
+// Splits on whitespace only
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/pre_tokenizers/whitespace.rs
+
+class WhitespaceSplitPreTokenizer : public SplittingPreTokenizer {
+ public:
+  explicit WhitespaceSplitPreTokenizer() = default;
+
+  bool pre_tokenize_offsets(std::string_view input, std::vector<Match>& out)
+      const override;
+}; // end class WhitespaceSplitPreTokenizer
+
+// -- Punctuation --------------------------------------------------------------
+// Splits on each punctuation character
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/pre_tokenizers/punctuation.rs
+
+class PunctuationPreTokenizer : public SplittingPreTokenizer {
+ public:
+  /**
+   * @param behavior: What to do with the punctuation characters
+   */
+  explicit PunctuationPreTokenizer(
+      SplitDelimiterBehavior behavior = SplitDelimiterBehavior::Isolated)
+      : behavior_(behavior) {}
+
+  bool pre_tokenize_offsets(std::string_view input, std::vector<Match>& out)
+      const override;
+
+ private:
+  const SplitDelimiterBehavior behavior_;
+}; // end class PunctuationPreTokenizer
+
+// -- CharDelimiterSplit -------------------------------------------------------
+// Splits on a single delimiter character, which is removed
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/pre_tokenizers/delimiter.rs
+
+class CharDelimiterSplitPreTokenizer : public SplittingPreTokenizer {
+ public:
+  /**
+   * @param delimiter: A single UTF-8 encoded character
+   */
+  explicit CharDelimiterSplitPreTokenizer(const std::string& delimiter);
+
+  bool pre_tokenize_offsets(std::string_view input, std::vector<Match>& out)
+      const override;
+
+ private:
+  const std::string delimiter_;
+}; // end class CharDelimiterSplitPreTokenizer
+
+// -- UnicodeScripts -----------------------------------------------------------
+// Splits where the script of the text changes. Hiragana and Katakana are
+// treated as Han, and spaces and unassigned characters never cause a split.
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/pre_tokenizers/unicode_scripts/pre_tokenizer.rs
+
+class UnicodeScriptsPreTokenizer : public SplittingPreTokenizer {
+ public:
+  explicit UnicodeScriptsPreTokenizer() = default;
+
+  bool pre_tokenize_offsets(std::string_view input, std::vector<Match>& out)
+      const override;
+}; // end class UnicodeScriptsPreTokenizer
+
+// -- Bert ---------------------------------------------------------------------
+// Splits on whitespace (removed) and on each punctuation character (isolated)
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/pre_tokenizers/bert.rs
+
+class BertPreTokenizer : public SplittingPreTokenizer {
+ public:
+  explicit BertPreTokenizer() = default;
+
+  bool pre_tokenize_offsets(std::string_view input, std::vector<Match>& out)
+      const override;
+}; // end class BertPreTokenizer
+
+// -- Metaspace ----------------------------------------------------------------
+// Replaces spaces with a visible character (▁ by default) and splits in front
+// of it, as used by SentencePiece models
+// CITE:
+// https://github.com/huggingface/tokenizers/blob/main/tokenizers/src/pre_tokenizers/metaspace.rs
+
+class MetaspacePreTokenizer : public PreTokenizer {
+ public:
+  /** When to prepend the replacement to the input */
+  enum class PrependScheme {
+    // Always prepend, unless the input already starts with it
+    Always,
+    // Only prepend to the first piece of the text. The text given to
+    // pre_tokenize() is treated as the first piece.
+    First,
+    // Never prepend
+    Never,
+  };
+
+  /**
+   * @param replacement: The UTF-8 character that replaces spaces
+   * @param prepend_scheme: When to prepend the replacement
+   * @param split: Whether to split the result in front of each replacement
+   */
+  explicit MetaspacePreTokenizer(
+      std::string replacement = "\xe2\x96\x81",
+      PrependScheme prepend_scheme = PrependScheme::Always,
+      bool split = true);
+
+  /** Parse a prepend scheme name, throwing if it is unknown */
+  static PrependScheme parse_prepend_scheme(const std::string& name);
+
+  std::vector<std::string> pre_tokenize(
+      const std::string& input) const override;
+
+ private:
+  const std::string replacement_;
+  const PrependScheme prepend_scheme_;
+  const bool split_;
+}; // end class MetaspacePreTokenizer
+
 // -- Sequence -----------------------------------------------------------------
 // Used by tokenizers
 // CITE:
@@ -260,8 +506,21 @@ class SequencePreTokenizer : public PreTokenizer {
   std::vector<std::string> pre_tokenize(
       const std::string& input) const override;
 
+  /** Supported only if all of the pre-tokenizers in the sequence support it */
+  bool pre_tokenize_offsets(std::string_view input, std::vector<Match>& out)
+      const override;
+
+  bool supports_offsets() const override {
+    return supports_offsets_;
+  }
+
+  RegexStats regex_stats() const override;
+
  private:
   const std::vector<PreTokenizer::Ptr> pre_tokenizers_;
+  // Whether every pre-tokenizer in the sequence supports offsets, decided
+  // once so that no stage runs on a path a later one abandons
+  bool supports_offsets_ = true;
 
 }; // end class ByteLevelPreTokenizer
 
@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <re2/re2.h>
 
@@ -19,13 +22,17 @@ namespace tokenizers {
 
 /**
  * @brief RE2-based implementation of IRegex.
+ *
+ * The pattern can be compiled into several replicas so that threads sharing
+ * one Re2Regex do not contend on a single DFA cache lock. Each thread always
+ * uses the same replica, which keeps that replica's DFA cache warm.
  */
 class Re2Regex : public IRegex {
  public:
   /**
    * @brief Construct a RE2 regex.
    */
-  explicit Re2Regex() {}
+  explicit Re2Regex(const RegexOptions& options = {}) : options_(options) {}
 
   /**
    * @brief compile the given regex pattern.
@@ -37,10 +44,34 @@ class Re2Regex : public IRegex {
   /**
    * @brief Return all non-overlapping matches found in the input string.
    */
-  virtual std::vector<Match> find_all(const std::string& text) const override;
+  virtual std::vector<Match> find_all(std::string_view text) const override;
+
+  /**
+   * @brief Return search and DFA cache counters summed over all replicas.
+   */
+  virtual RegexStats stats() const override;
 
  private:
-  std::unique_ptr<re2::RE2> regex_;
+  // Search counters per replica, so that up to this many threads sharing
+  // one replica do not write to the same cache line on every search
+  static constexpr size_t kSearchCounters = 16;
+
+  struct alignas(64) Counter {
+    mutable std::atomic<uint64_t> value{0};
+  };
+
+  // Each replica sits on its own cache lines so that the counters of one
+  // thread do not invalidate those of another. DFA cache resets and search
+  // failures are rare and share one line.
+  struct alignas(64) Replica {
+    std::unique_ptr<re2::RE2> regex;
+    mutable std::atomic<uint64_t> dfa_cache_resets{0};
+    mutable std::atomic<uint64_t> dfa_search_failures{0};
+    std::array<Counter, kSearchCounters> searches;
+  };
+
+  RegexOptions options_;
+  std::vector<std::unique_ptr<Replica>> replicas_;
 };
 
 } // namespace tokenizers
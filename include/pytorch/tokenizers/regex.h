@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <pytorch/tokenizers/result.h>
@@ -21,6 +23,80 @@ struct Match {
   size_t end; // ending index of the match (exclusive)
 };
 
+/**
+ * @brief Regex engines that can back an IRegex.
+ */
+enum class RegexEngine : uint8_t {
+  // RE2, then the fallback registered with register_override_fallback_regex(),
+  // which is the Pike VM unless regex_lookahead is linked
+  Default = 0,
+  // The hand-written scanners of native_regex.h
+  Native,
+  RE2,
+  PCRE2,
+  // std::regex
+  Std,
+  // The linear-time Pike VM of pike_regex.h
+  Pike,
+};
+
+/** Lower case name of the engine, e.g. "re2" */
+const char* regex_engine_name(RegexEngine engine);
+
+/**
+ * @brief Tuning options for compiled regexes.
+ *
+ * The memory and replica options are honoured by the RE2 backend and ignored
+ * by the other backends.
+ */
+struct RegexOptions {
+  // Memory budget in bytes for each compiled pattern, shared between the
+  // compiled program and its lazily built DFA state caches. When a DFA cache
+  // exceeds its share it is flushed and rebuilt. 0 keeps the RE2 default.
+  int64_t max_mem = 0;
+
+  // Number of independently compiled copies of the pattern. RE2 serialises
+  // access to each DFA cache behind a lock, so concurrent callers are spread
+  // over replicas by thread. 0 uses one replica per hardware thread.
+  size_t num_replicas = 1;
+
+  // Engine to compile the pattern with. A pattern that the engine cannot
+  // compile, or an engine that is not linked in, is a RegexFailure.
+  RegexEngine engine = RegexEngine::Default;
+
+  // With the Default engine, benchmark every engine that compiles the pattern
+  // on a sample and use the fastest one whose matches agree with the default
+  // engine. See regex_autotune.h.
+  bool autotune = false;
+
+  // File in which autotuning records the engine chosen for each pattern, so
+  // that later loads skip the benchmark. Empty to always benchmark. Processes
+  // update it one at a time, under a lock on the file "<autotune_cache>.lock".
+  std::string autotune_cache;
+};
+
+/**
+ * @brief Counters describing the runtime behaviour of a compiled regex.
+ */
+struct RegexStats {
+  // Number of find_all calls
+  uint64_t searches = 0;
+  // Number of times a DFA state cache was flushed for exceeding its budget
+  uint64_t dfa_cache_resets = 0;
+  // Number of searches where the DFA gave up and a slower engine was used
+  uint64_t dfa_search_failures = 0;
+  // Number of compiled replicas serving the searches
+  size_t replicas = 0;
+
+  RegexStats& operator+=(const RegexStats& other) {
+    searches += other.searches;
+    dfa_cache_resets += other.dfa_cache_resets;
+    dfa_search_failures += other.dfa_search_failures;
+    replicas += other.replicas;
+    return *this;
+  }
+};
+
 /**
  * @brief Abstract interface for regex wrappers.
  */
@@ -41,7 +117,16 @@ class IRegex {
    * @param text The input string to search.
    * @return A vector of strings containing all matched substrings.
    */
-  virtual std::vector<Match> find_all(const std::string& text) const = 0;
+  virtual std::vector<Match> find_all(std::string_view text) const = 0;
+
+  /**
+   * @brief Return runtime counters for this regex.
+   *
+   * Backends that do not track statistics return all zeros.
+   */
+  virtual RegexStats stats() const {
+    return RegexStats{};
+  }
 
   /**
    * @brief Escape special regex characters in a string to treat it as literal.
@@ -55,18 +140,35 @@ class IRegex {
 // Function pointer type for create_fallback_regex implementations
 using FallbackRegexFn = Result<std::unique_ptr<IRegex>> (*)(const std::string&);
 
+// Function pointer type for the implementations of a RegexEngine
+using RegexEngineFn = Result<std::unique_ptr<IRegex>> (*)(
+    const std::string& pattern,
+    const RegexOptions& options);
+
 /**
  * @brief Creates a regex instance. If no strong symbol defined, only
  * uses RE2. This is a weak symbol to allow other regex libraries to be
  * used.
  *
  * @param pattern The regex pattern to compile.
+ * @param options Tuning options for the RE2 backend.
  * @return A unique pointer to an IRegex-compatible object.
  */
-Result<std::unique_ptr<IRegex>> create_regex(const std::string& pattern);
+Result<std::unique_ptr<IRegex>> create_regex(
+    const std::string& pattern,
+    const RegexOptions& options = {});
 
 bool register_override_fallback_regex(FallbackRegexFn fn);
 
 FallbackRegexFn get_fallback_regex();
 
+/**
+ * @brief Make an engine available to RegexOptions::engine and autotuning.
+ * Native, RE2 and Pike are built in, regex_lookahead registers PCRE2 and Std.
+ */
+bool register_regex_engine(RegexEngine engine, RegexEngineFn fn);
+
+/** The implementation of the engine, or nullptr if it is not linked in */
+RegexEngineFn get_regex_engine(RegexEngine engine);
+
 } // namespace tokenizers
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * @file
+ * Choosing the fastest regex engine for a pattern at load time.
+ */
+
+#pragma once
+
+// Standard
+#include <memory>
+#include <string>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/regex.h>
+#include <pytorch/tokenizers/result.h>
+
+namespace tokenizers {
+
+struct RegexEngineTiming {
+  RegexEngine engine = RegexEngine::Default;
+  // Best time over the sample, in nanoseconds per byte
+  double nanos_per_byte = 0;
+  // Whether the matches were identical to those of the default engine
+  bool agrees = false;
+};
+
+struct RegexAutotuneResult {
+  // The fastest engine that agrees with the default engine
+  RegexEngine engine = RegexEngine::Default;
+  // Every engine that compiled the pattern, in RegexEngine order. Empty when
+  // the choice was read from the cache.
+  std::vector<RegexEngineTiming> timings;
+  bool from_cache = false;
+};
+
+/**
+ * Benchmark every registered engine that compiles the pattern by finding all
+ * matches in the sample, and pick the fastest one whose matches are identical
+ * to those of the default engine (RE2, then the fallback). If the default
+ * engine cannot compile the pattern, the first engine that can is the
+ * reference.
+ *
+ * If options.autotune_cache is set, a choice recorded there for the pattern
+ * is returned without benchmarking, and a new choice is recorded.
+ *
+ * @param sample Texts to search, empty for warm_start_corpus()
+ */
+Result<RegexAutotuneResult> autotune_regex(
+    const std::string& pattern,
+    const std::vector<std::string>& sample = {},
+    const RegexOptions& options = {});
+
+/**
+ * Compile the pattern with the engine chosen by autotune_regex(). This is what
+ * create_regex() does when options.autotune is set.
+ */
+Result<std::unique_ptr<IRegex>> create_autotuned_regex(
+    const std::string& pattern,
+    const RegexOptions& options);
+
+} // namespace tokenizers
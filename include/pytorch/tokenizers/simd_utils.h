@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// Byte scanning helpers with SSE2 / NEON fast paths and a portable scalar
+// fallback. They are used by the text processing hot paths (normalizers,
+// pre-tokenizers, UTF-16 input) to skip over runs of plain ASCII.
+#pragma once
+
+// Standard
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TK_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define TK_SIMD_NEON 1
+#endif
+
+namespace tokenizers {
+namespace detail {
+
+#if defined(TK_SIMD_SSE2)
+
+inline uint32_t simd_ctz(uint32_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return index;
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+// Byte mask of lanes in [lo, hi] (inclusive, both ASCII)
+inline __m128i simd_in_range(__m128i v, char lo, char hi) {
+  // Signed compares are fine because lo/hi are ASCII and bytes >= 0x80 are
+  // negative, so they never fall in the range.
+  return _mm_and_si128(
+      _mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+      _mm_cmplt_epi8(v, _mm_set1_epi8(hi + 1)));
+}
+
+#elif defined(TK_SIMD_NEON)
+
+// Index of the first non-zero lane of a comparison result, or 16
+inline size_t simd_first_set(uint8x16_t mask) {
+  // Narrow each 16-bit lane pair to 4 bits so the result fits in 64 bits
+  const uint64_t bits = vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(mask), 4)), 0);
+  return bits == 0 ? 16 : (__builtin_ctzll(bits) >> 2);
+}
+
+// Largest lane. vmaxvq_* only exist on AArch64; 32-bit ARM reduces pairwise.
+inline uint8_t simd_max_u8(uint8x16_t v) {
+#if defined(__aarch64__) || defined(_M_ARM64)
+  return vmaxvq_u8(v);
+#else
+  uint8x8_t max = vpmax_u8(vget_low_u8(v), vget_high_u8(v));
+  max = vpmax_u8(max, max);
+  max = vpmax_u8(max, max);
+  max = vpmax_u8(max, max);
+  return vget_lane_u8(max, 0);
+#endif
+}
+
+inline uint16_t simd_max_u16(uint16x8_t v) {
+#if defined(__aarch64__) || defined(_M_ARM64)
+  return vmaxvq_u16(v);
+#else
+  uint16x4_t max = vpmax_u16(vget_low_u16(v), vget_high_u16(v));
+  max = vpmax_u16(max, max);
+  max = vpmax_u16(max, max);
+  return vget_lane_u16(max, 0);
+#endif
+}
+
+#endif
+
+/**
+ * Return the length of the longest prefix of [data, data + size) made only of
+ * ASCII bytes.
+ */
+inline size_t ascii_prefix_length(const char* data, size_t size) {
+  size_t i = 0;
+#if defined(TK_SIMD_SSE2)
+  for (; i + 16 <= size; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(v));
+    if (mask) {
+      return i + simd_ctz(mask);
+    }
+  }
+#elif defined(TK_SIMD_NEON)
+  for (; i + 16 <= size; i += 16) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+    if (simd_max_u8(v) >= 0x80) {
+      return i + simd_first_set(vcgeq_u8(v, vdupq_n_u8(0x80)));
+    }
+  }
+#endif
+  for (; i < size; ++i) {
+    if (static_cast<unsigned char>(data[i]) >= 0x80) {
+      break;
+    }
+  }
+  return i;
+}
+
+/**
+ * Return the index of the first byte that is an ASCII upper case letter or a
+ * non-ASCII byte, or size if there is none.
+ */
+inline size_t find_ascii_upper_or_non_ascii(const char* data, size_t size) {
+  size_t i = 0;
+#if defined(TK_SIMD_SSE2)
+  for (; i + 16 <= size; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const __m128i hit = _mm_or_si128(simd_in_range(v, 'A', 'Z'), v);
+    const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(hit));
+    if (mask) {
+      return i + simd_ctz(mask);
+    }
+  }
+#elif defined(TK_SIMD_NEON)
+  for (; i + 16 <= size; i += 16) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+    const uint8x16_t upper =
+        vcleq_u8(vsubq_u8(v, vdupq_n_u8('A')), vdupq_n_u8('Z' - 'A'));
+    const uint8x16_t hit = vorrq_u8(upper, vcgeq_u8(v, vdupq_n_u8(0x80)));
+    if (simd_max_u8(hit)) {
+      return i + simd_first_set(hit);
+    }
+  }
+#endif
+  for (; i < size; ++i) {
+    const auto c = static_cast<unsigned char>(data[i]);
+    if (c >= 0x80 || (c >= 'A' && c <= 'Z')) {
+      break;
+    }
+  }
+  return i;
+}
+
+/**
+ * Return the index of the first byte that is an ASCII control character
+ * (0x00-0x1F, 0x7F) or a non-ASCII byte, or size if there is none.
+ */
+inline size_t find_ascii_control_or_non_ascii(const char* data, size_t size) {
+  size_t i = 0;
+#if defined(TK_SIMD_SSE2)
+  for (; i + 16 <= size; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    // Printable ASCII is 0x20..0x7E; everything else (including bytes >= 0x80,
+    // which are negative as signed) is a hit.
+    const __m128i printable = simd_in_range(v, 0x20, 0x7E);
+    const uint32_t mask =
+        static_cast<uint32_t>(_mm_movemask_epi8(printable)) ^ 0xFFFFu;
+    if (mask) {
+      return i + simd_ctz(mask);
+    }
+  }
+#elif defined(TK_SIMD_NEON)
+  for (; i + 16 <= size; i += 16) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+    const uint8x16_t printable =
+        vcleq_u8(vsubq_u8(v, vdupq_n_u8(0x20)), vdupq_n_u8(0x7E - 0x20));
+    const uint8x16_t hit = vmvnq_u8(printable);
+    if (simd_max_u8(hit)) {
+      return i + simd_first_set(hit);
+    }
+  }
+#endif
+  for (; i < size; ++i) {
+    const auto c = static_cast<unsigned char>(data[i]);
+    if (c < 0x20 || c >= 0x7F) {
+      break;
+    }
+  }
+  return i;
+}
+
+/**
+ * Copy size bytes from src to dst, mapping ASCII upper case letters to lower
+ * case. All other bytes are copied unchanged.
+ */
+inline void ascii_to_lower(const char* src, char* dst, size_t size) {
+  size_t i = 0;
+#if defined(TK_SIMD_SSE2)
+  for (; i + 16 <= size; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i upper = simd_in_range(v, 'A', 'Z');
+    const __m128i lowered =
+        _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), lowered);
+  }
+#elif defined(TK_SIMD_NEON)
+  for (; i + 16 <= size; i += 16) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(src + i));
+    const uint8x16_t upper =
+        vcleq_u8(vsubq_u8(v, vdupq_n_u8('A')), vdupq_n_u8('Z' - 'A'));
+    const uint8x16_t lowered = vorrq_u8(v, vandq_u8(upper, vdupq_n_u8(0x20)));
+    vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), lowered);
+  }
+#endif
+  for (; i < size; ++i) {
+    const char c = src[i];
+    dst[i] = (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+  }
+}
+
+/**
+ * Copy the longest prefix of [src, src + size) made only of ASCII UTF-16 code
+ * units to dst, one byte per unit, and return its length.
+ */
+inline size_t narrow_ascii_utf16(const char16_t* src, char* dst, size_t size) {
+  size_t i = 0;
+#if defined(TK_SIMD_SSE2)
+  for (; i + 16 <= size; i += 16) {
+    const __m128i lo =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+    const __m128i high_bits =
+        _mm_and_si128(_mm_or_si128(lo, hi), _mm_set1_epi16(-0x80));
+    if (_mm_movemask_epi8(
+            _mm_cmpeq_epi16(high_bits, _mm_setzero_si128())) != 0xFFFF) {
+      break;
+    }
+    // All units are below 0x80, so the saturating pack is exact
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+  }
+#elif defined(TK_SIMD_NEON)
+  for (; i + 16 <= size; i += 16) {
+    const uint16x8_t lo = vld1q_u16(reinterpret_cast<const uint16_t*>(src + i));
+    const uint16x8_t hi =
+        vld1q_u16(reinterpret_cast<const uint16_t*>(src + i + 8));
+    if (simd_max_u16(vorrq_u16(lo, hi)) >= 0x80) {
+      break;
+    }
+    vst1q_u8(
+        reinterpret_cast<uint8_t*>(dst + i),
+        vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+  }
+#endif
+  for (; i < size && src[i] < 0x80; ++i) {
+    dst[i] = static_cast<char>(src[i]);
+  }
+  return i;
+}
+
+} // namespace detail
+} // namespace tokenizers
@@ -35,7 +35,7 @@ class StdRegex : public IRegex {
   /**
    * @brief Find all non-overlapping matches in the input string.
    */
-  virtual std::vector<Match> find_all(const std::string& text) const override;
+  virtual std::vector<Match> find_all(std::string_view text) const override;
 
  private:
   std::regex regex_;
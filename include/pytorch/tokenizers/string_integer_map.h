@@ -25,6 +25,54 @@
 namespace tokenizers {
 namespace detail {
 
+/**
+ * The lookups a StringIntegerMap is built for. A map built for one direction
+ * does not store the buckets and elements of the other, and its lookups in the
+ * other direction find nothing.
+ */
+enum class MapDirection : std::uint8_t {
+  /// Both tryGetInteger and tryGetString.
+  Both,
+  /// tryGetInteger only.
+  StringToInteger,
+  /// tryGetString only.
+  IntegerToString,
+};
+
+/**
+ * Bound on the elements a StringIntegerMap lookup compares, which are those
+ * of one bucket. The builder measures the longest bucket chain of a layout
+ * and lays the buckets out again with a new hash seed, then with more
+ * buckets, until the bound holds.
+ */
+struct MapProbeBound {
+  /// Most elements one bucket may hold, 0 for no bound.
+  std::size_t max_chain_length = 8;
+  /// Hash seeds tried for each bucket count.
+  std::size_t seeds_per_bucket_count = 4;
+  /// Most buckets per element. The bucket count starts at the number of
+  /// elements and doubles up to this many times it.
+  std::size_t max_buckets_per_element = 4;
+};
+
+/**
+ * Bucket layout of one direction of a StringIntegerMap.
+ */
+struct MapChainStats {
+  std::size_t bucket_count = 0;
+  /// Seed mixed into the hash, 0 when buckets use the hash as is.
+  std::uint64_t seed = 0;
+  /// Elements in the longest bucket: the most one lookup compares.
+  std::size_t max_chain_length = 0;
+  /// Mean elements in the non-empty buckets.
+  double mean_chain_length = 0;
+  /// Other layouts measured before this one was kept.
+  std::size_t rebuilds = 0;
+  /// Whether max_chain_length is within the bound. When no layout meets it,
+  /// the one with the shortest longest chain is kept.
+  bool bound_met = true;
+};
+
 /**
  * StringIntegerMap is an immutable bidirectional map between strings and 64 bit
  * unsigned integers. The element data is stored in a contiguous array and is
@@ -33,7 +81,9 @@ namespace detail {
  *
  * Variable sized integers are used internally, which are sized based on the
  * data being stored. Custom hash functions are supported, with a stateful hash
- * functor being optionally provided at construction time.
+ * functor being optionally provided at construction time. A map that is only
+ * used in one direction can be built without the buckets of the other, see
+ * MapDirection.
  */
 template <
     typename TStringHash = std::hash<std::string_view>,
@@ -52,21 +102,30 @@ class StringIntegerMap {
    * Construct a StringIntegerMap from a map of strings to integers.  Each
    * string and integer in the map must be unique.
    * @param map map of strings to integers
+   * @param direction lookups to build the map for
+   * @param bound longest bucket chain to lay the buckets out for
    */
   template <typename TMap>
-  explicit StringIntegerMap(const TMap& map);
+  explicit StringIntegerMap(
+      const TMap& map,
+      MapDirection direction = MapDirection::Both,
+      const MapProbeBound& bound = {});
 
   /**
    * Construct a StringIntegerMap from a map of strings to integers, explicitly
    * intializing the integer and string hash objects.  Each string and integer
    * in the map must be unique.
    * @param map map of strings to integers
+   * @param direction lookups to build the map for
+   * @param bound longest bucket chain to lay the buckets out for
    */
   template <typename TMap>
   StringIntegerMap(
       const TMap& map,
       TStringHash string_hasher,
-      TIntegerHash integer_hasher);
+      TIntegerHash integer_hasher,
+      MapDirection direction = MapDirection::Both,
+      const MapProbeBound& bound = {});
 
   /// @}
   /// @name Accessors
@@ -80,6 +139,21 @@ class StringIntegerMap {
    */
   std::optional<std::uint64_t> tryGetInteger(std::string_view str) const;
 
+  /**
+   * Attempts to retrieve the integers mapped for several strings at once.
+   * The buckets and elements of all strings are prefetched before any of them
+   * is compared, so the cache misses of the independent lookups overlap
+   * instead of being paid one after the other.
+   * @param strs strings to lookup
+   * @param count number of strings
+   * @param results receives, for each string, the integer if it was found,
+   * std::nullopt otherwise
+   */
+  void tryGetIntegers(
+      const std::string_view* strs,
+      std::size_t count,
+      std::optional<std::uint64_t>* results) const;
+
   /**
    * Attempts to retrieve the string mapped for the given integer.
    * @param integer integer to lookup
@@ -95,12 +169,50 @@ class StringIntegerMap {
   std::size_t size() const;
 
   /**
-   * Retrieves the element in the map at the given index.
+   * Retrieves the lookups the map was built for.
+   * @return the direction passed at construction
+   */
+  MapDirection direction() const;
+
+  /**
+   * Retrieves the layout of the string buckets, searched by tryGetInteger.
+   * The string elements are ordered by it in maps built for either direction.
+   * @return the bucket count, seed and chain lengths
+   */
+  const MapChainStats& stringChainStats() const;
+
+  /**
+   * Retrieves the layout of the integer buckets, searched by tryGetString.
+   * All zero in maps built for StringToInteger.
+   * @return the bucket count, seed and chain lengths
+   */
+  const MapChainStats& integerChainStats() const;
+
+  /**
+   * Retrieves the element in the map at the given index. Only available in
+   * maps built with tryGetString support, see forEachElement otherwise.
    * @return A pair containing the string and integer at the given index.
    */
   std::pair<std::string_view, std::uint64_t> getElement(
       std::size_t index) const;
 
+  /**
+   * Calls func(str, integer) for each element in the map, in an order that
+   * only depends on the elements, the string hash and the probe bound.
+   * Available in maps built for either direction.
+   * @param func callable taking a std::string_view and a std::uint64_t
+   */
+  template <typename TFunc>
+  void forEachElement(TFunc&& func) const;
+
+  /**
+   * Calls func(data, size) for each of the internal buffers the map is stored
+   * in, e.g. to prefault or lock them in memory.
+   * @param func callable taking a const void* and a std::size_t
+   */
+  template <typename TFunc>
+  void forEachBuffer(TFunc&& func) const;
+
   /// @}
 
  private:
@@ -144,11 +256,33 @@ class StringIntegerMap {
 
   bool tryGetInteger(std::string_view str, std::uint64_t& result) const;
 
+  /// Compare str against the string elements in [lower_element_offset,
+  /// upper_element_offset) of its bucket.
+  bool probeString(
+      std::string_view str,
+      std::uint8_t small_hash,
+      std::size_t lower_element_offset,
+      std::size_t upper_element_offset,
+      std::uint64_t& result) const;
+
+  static void prefetch(const void* address);
+
+  /// Maximum number of lookups tryGetIntegers keeps in flight.
+  static constexpr std::size_t kLookupBatchSize = 16;
+
   bool tryGetString(std::uint64_t integer, std::string_view& result) const;
 
-  std::size_t getBucketIndex(std::string_view value) const;
+  std::size_t getStringBucketIndex(std::size_t hash) const;
 
-  std::size_t getBucketIndex(std::uint64_t value) const;
+  std::size_t getIntegerBucketIndex(std::size_t hash) const;
+
+  static std::size_t
+  getBucketIndex(std::size_t hash, std::uint64_t seed, std::size_t count);
+
+  /// Choose the bucket layout of elements with the given hashes.
+  static MapChainStats chooseBuckets(
+      const std::vector<std::size_t>& hashes,
+      const MapProbeBound& bound);
 
   static std::uint8_t getSmallHash(std::size_t hash);
 
@@ -184,12 +318,18 @@ class StringIntegerMap {
   /// }
   std::vector<std::uint8_t, TAllocator> string_element_data_;
 
-  /// Number of hash buckets to use.
-  std::size_t bucket_count_ = 0;
+  /// Layout of the string buckets.
+  MapChainStats string_chains_;
+
+  /// Layout of the integer buckets.
+  MapChainStats integer_chains_;
 
   /// Number of elements stored in the map.
   std::size_t size_ = 0;
 
+  /// Lookups the map was built for.
+  MapDirection direction_ = MapDirection::Both;
+
   /// Variable sized element offset info.
   VariableSizedInteger<std::size_t> element_offset_;
 
@@ -206,18 +346,30 @@ class StringIntegerMap {
 template <typename TStringHash, typename TIntegerHash, typename TAllocator>
 template <typename TMap>
 StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::StringIntegerMap(
-    const TMap& map)
-    : StringIntegerMap(map, TStringHash(), TIntegerHash()) {}
+    const TMap& map,
+    MapDirection direction,
+    const MapProbeBound& bound)
+    : StringIntegerMap(map, TStringHash(), TIntegerHash(), direction, bound) {}
 
 template <typename TStringHash, typename TIntegerHash, typename TAllocator>
 template <typename TMap>
 StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::StringIntegerMap(
     const TMap& map,
     TStringHash string_hasher,
-    TIntegerHash integer_hasher)
-    : string_hasher_(string_hasher), integer_hasher_(integer_hasher) {
+    TIntegerHash integer_hasher,
+    MapDirection direction,
+    const MapProbeBound& bound)
+    : string_hasher_(string_hasher),
+      integer_hasher_(integer_hasher),
+      direction_(direction) {
   assert(map.size() <= std::numeric_limits<std::uint32_t>::max());
-  bucket_count_ = size_ = map.size();
+  size_ = map.size();
+
+  // The string elements hold the string data, so they are laid out in both
+  // directions. Only the string buckets are specific to tryGetInteger.
+  const bool with_string_buckets = direction != MapDirection::IntegerToString;
+  const bool with_integer_elements =
+      direction != MapDirection::StringToInteger;
 
   struct BuilderElement {
     std::uint64_t integer = 0;
@@ -242,8 +394,10 @@ StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::StringIntegerMap(
     largest_string_size = std::max(largest_string_size, str.size());
     largest_integer = std::max(largest_integer, integer);
     builder_string_elements.push_back({integer, str, string_hasher_(str)});
-    builder_integer_elements.push_back(
-        {integer, str, integer_hasher_(integer)});
+    if (with_integer_elements) {
+      builder_integer_elements.push_back(
+          {integer, str, integer_hasher_(integer)});
+    }
   }
 
   integer_ = VariableSizedInteger<std::uint64_t>(largest_integer);
@@ -256,30 +410,55 @@ StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::StringIntegerMap(
       total_string_size;
   const auto integer_element_size = integer_.getByteCount() +
       string_offset_.getByteCount() + string_size_.getByteCount();
-  const auto integer_element_data_size = integer_element_size * map.size();
+  const auto integer_element_data_size =
+      with_integer_elements ? integer_element_size * map.size() : 0;
 
   element_offset_ = VariableSizedInteger<std::size_t>(
       std::max(string_element_data_size, integer_element_data_size));
 
-  string_bucket_data_.resize(
-      ((bucket_count_ + 1) * element_offset_.getByteCount()) +
-      sizeof(std::uint64_t));
-  integer_bucket_data_.resize(
-      ((bucket_count_ + 1) * element_offset_.getByteCount()) +
-      sizeof(std::uint64_t));
+  //
+  // Choose the bucket layouts. The string elements are laid out in string
+  // bucket order whatever the direction, so their layout is always chosen.
+  //
+
+  std::vector<std::size_t> hashes;
+  hashes.reserve(map.size());
+  for (const auto& builder_element : builder_string_elements) {
+    hashes.push_back(builder_element.hash);
+  }
+  string_chains_ = chooseBuckets(hashes, bound);
+  if (with_integer_elements) {
+    hashes.clear();
+    for (const auto& builder_element : builder_integer_elements) {
+      hashes.push_back(builder_element.hash);
+    }
+    integer_chains_ = chooseBuckets(hashes, bound);
+  }
 
   //
-  // Set up terminal bucket indices.
+  // Allocate the buckets and set up the terminal bucket indices.
   //
 
-  element_offset_.write(
-      string_bucket_data_.data() +
-          (bucket_count_ * element_offset_.getByteCount()),
-      string_element_data_size);
-  element_offset_.write(
-      integer_bucket_data_.data() +
-          (bucket_count_ * element_offset_.getByteCount()),
-      integer_element_data_size);
+  const auto string_bucket_count = string_chains_.bucket_count;
+  const auto integer_bucket_count = integer_chains_.bucket_count;
+  if (with_string_buckets) {
+    string_bucket_data_.resize(
+        ((string_bucket_count + 1) * element_offset_.getByteCount()) +
+        sizeof(std::uint64_t));
+    element_offset_.write(
+        string_bucket_data_.data() +
+            (string_bucket_count * element_offset_.getByteCount()),
+        string_element_data_size);
+  }
+  if (with_integer_elements) {
+    integer_bucket_data_.resize(
+        ((integer_bucket_count + 1) * element_offset_.getByteCount()) +
+        sizeof(std::uint64_t));
+    element_offset_.write(
+        integer_bucket_data_.data() +
+            (integer_bucket_count * element_offset_.getByteCount()),
+        integer_element_data_size);
+  }
   //
   // Sort the builder elements.
   //
@@ -288,8 +467,8 @@ StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::StringIntegerMap(
       std::begin(builder_string_elements),
       std::end(builder_string_elements),
       [this](const BuilderElement& first, const BuilderElement& second) {
-        const auto first_bucket = first.hash % bucket_count_;
-        const auto second_bucket = second.hash % bucket_count_;
+        const auto first_bucket = getStringBucketIndex(first.hash);
+        const auto second_bucket = getStringBucketIndex(second.hash);
         if (first_bucket == second_bucket) {
           const auto first_small_hash = getSmallHash(first.hash);
           const auto second_small_hash = getSmallHash(second.hash);
@@ -303,8 +482,8 @@ StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::StringIntegerMap(
       std::begin(builder_integer_elements),
       std::end(builder_integer_elements),
       [this](const BuilderElement& first, const BuilderElement& second) {
-        const auto first_bucket = first.hash % bucket_count_;
-        const auto second_bucket = second.hash % bucket_count_;
+        const auto first_bucket = getIntegerBucketIndex(first.hash);
+        const auto second_bucket = getIntegerBucketIndex(second.hash);
         if (first_bucket == second_bucket) {
           return first.integer < second.integer;
         }
@@ -324,10 +503,12 @@ StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::StringIntegerMap(
     builder_element.element_offset =
         string_element - string_element_data_.data();
 
-    auto insert_result = string_element_byte_index_map.insert(
-        {builder_element.string, builder_element.element_offset});
-    assert(insert_result.second);
-    (void)insert_result;
+    if (with_integer_elements) {
+      auto insert_result = string_element_byte_index_map.insert(
+          {builder_element.string, builder_element.element_offset});
+      assert(insert_result.second);
+      (void)insert_result;
+    }
 
     string_element = integer_.write(string_element, builder_element.integer);
     string_element =
@@ -349,8 +530,10 @@ StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::StringIntegerMap(
   // Lay out the integer elements.
   //
 
-  integer_element_data_.resize(
-      integer_element_data_size + sizeof(std::uint64_t));
+  if (with_integer_elements) {
+    integer_element_data_.resize(
+        integer_element_data_size + sizeof(std::uint64_t));
+  }
   auto* integer_element = integer_element_data_.data();
   for (auto& builder_element : builder_integer_elements) {
     builder_element.element_offset =
@@ -377,47 +560,58 @@ StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::StringIntegerMap(
   // and integer elements.
   //
 
-  auto builder_string_elements_iter = std::begin(builder_string_elements);
-  auto builder_integer_elements_iter = std::begin(builder_integer_elements);
-
-  for (std::size_t bucket_idx = 0; bucket_idx < bucket_count_; ++bucket_idx) {
-    auto* string_bucket = string_bucket_data_.data() +
-        (bucket_idx * element_offset_.getByteCount());
-    if (builder_string_elements_iter != std::end(builder_string_elements)) {
-      element_offset_.write(
-          string_bucket, builder_string_elements_iter->element_offset);
-    } else {
-      element_offset_.write(string_bucket, string_element_data_size);
-    }
-
-    auto* integer_bucket = integer_bucket_data_.data() +
-        (bucket_idx * element_offset_.getByteCount());
-    if (builder_integer_elements_iter != std::end(builder_integer_elements)) {
-      element_offset_.write(
-          integer_bucket, builder_integer_elements_iter->element_offset);
-    } else {
-      element_offset_.write(integer_bucket, integer_element_data_size);
-    }
+  if (with_string_buckets) {
+    auto builder_string_elements_iter = std::begin(builder_string_elements);
+    for (std::size_t bucket_idx = 0; bucket_idx < string_bucket_count;
+         ++bucket_idx) {
+      auto* string_bucket = string_bucket_data_.data() +
+          (bucket_idx * element_offset_.getByteCount());
+      if (builder_string_elements_iter != std::end(builder_string_elements)) {
+        element_offset_.write(
+            string_bucket, builder_string_elements_iter->element_offset);
+      } else {
+        element_offset_.write(string_bucket, string_element_data_size);
+      }
 
-    //
-    // Advance the string element iterator past all string elements that map
-    // into this bucket.
-    //
+      //
+      // Advance the string element iterator past all string elements that
+      // map into this bucket.
+      //
 
-    while (builder_string_elements_iter != std::end(builder_string_elements) &&
-           getBucketIndex(builder_string_elements_iter->string) == bucket_idx) {
-      ++builder_string_elements_iter;
+      while (
+          builder_string_elements_iter != std::end(builder_string_elements) &&
+          getStringBucketIndex(builder_string_elements_iter->hash) ==
+              bucket_idx) {
+        ++builder_string_elements_iter;
+      }
     }
+  }
 
-    //
-    // Advance the integer element index past all integer elements that map into
-    // this bucket.
-    //
+  if (with_integer_elements) {
+    auto builder_integer_elements_iter = std::begin(builder_integer_elements);
+    for (std::size_t bucket_idx = 0; bucket_idx < integer_bucket_count;
+         ++bucket_idx) {
+      auto* integer_bucket = integer_bucket_data_.data() +
+          (bucket_idx * element_offset_.getByteCount());
+      if (builder_integer_elements_iter !=
+          std::end(builder_integer_elements)) {
+        element_offset_.write(
+            integer_bucket, builder_integer_elements_iter->element_offset);
+      } else {
+        element_offset_.write(integer_bucket, integer_element_data_size);
+      }
+
+      //
+      // Advance the integer element index past all integer elements that map
+      // into this bucket.
+      //
 
-    while (
-        builder_integer_elements_iter != std::end(builder_integer_elements) &&
-        getBucketIndex(builder_integer_elements_iter->integer) == bucket_idx) {
-      ++builder_integer_elements_iter;
+      while (builder_integer_elements_iter !=
+                 std::end(builder_integer_elements) &&
+             getIntegerBucketIndex(builder_integer_elements_iter->hash) ==
+                 bucket_idx) {
+        ++builder_integer_elements_iter;
+      }
     }
   }
 }
@@ -435,13 +629,12 @@ template <typename TStringHash, typename TIntegerHash, typename TAllocator>
 bool StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::tryGetInteger(
     std::string_view str,
     std::uint64_t& result) const {
-  if (size_ == 0) {
+  if (size_ == 0 || string_bucket_data_.empty()) {
     return false;
   }
 
   const auto hash = string_hasher_(str);
-  const auto bucket_index = hash % bucket_count_;
-  const auto small_hash = getSmallHash(hash);
+  const auto bucket_index = getStringBucketIndex(hash);
 
   const auto* bucket_data = string_bucket_data_.data() +
       (bucket_index * element_offset_.getByteCount());
@@ -449,6 +642,81 @@ bool StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::tryGetInteger(
   const auto upper_element_offset =
       element_offset_.read(bucket_data + element_offset_.getByteCount());
 
+  return probeString(
+      str,
+      getSmallHash(hash),
+      lower_element_offset,
+      upper_element_offset,
+      result);
+}
+
+template <typename TStringHash, typename TIntegerHash, typename TAllocator>
+void StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::tryGetIntegers(
+    const std::string_view* strs,
+    std::size_t count,
+    std::optional<std::uint64_t>* results) const {
+  if (size_ == 0 || string_bucket_data_.empty()) {
+    std::fill(results, results + count, std::nullopt);
+    return;
+  }
+
+  std::size_t hashes[kLookupBatchSize];
+  const std::uint8_t* buckets[kLookupBatchSize];
+  std::size_t lower_element_offsets[kLookupBatchSize];
+  std::size_t upper_element_offsets[kLookupBatchSize];
+
+  for (std::size_t begin = 0; begin < count; begin += kLookupBatchSize) {
+    const std::size_t batch = std::min(kLookupBatchSize, count - begin);
+
+    //
+    // Stage 1: hash every string and prefetch its bucket.
+    //
+
+    for (std::size_t i = 0; i < batch; ++i) {
+      hashes[i] = string_hasher_(strs[begin + i]);
+      buckets[i] = string_bucket_data_.data() +
+          (getStringBucketIndex(hashes[i]) * element_offset_.getByteCount());
+      prefetch(buckets[i]);
+    }
+
+    //
+    // Stage 2: read the bucket ranges and prefetch the first element.
+    //
+
+    for (std::size_t i = 0; i < batch; ++i) {
+      lower_element_offsets[i] = element_offset_.read(buckets[i]);
+      upper_element_offsets[i] =
+          element_offset_.read(buckets[i] + element_offset_.getByteCount());
+      prefetch(string_element_data_.data() + lower_element_offsets[i]);
+    }
+
+    //
+    // Stage 3: compare against the elements, which are now in flight.
+    //
+
+    for (std::size_t i = 0; i < batch; ++i) {
+      std::uint64_t result;
+      if (probeString(
+              strs[begin + i],
+              getSmallHash(hashes[i]),
+              lower_element_offsets[i],
+              upper_element_offsets[i],
+              result)) {
+        results[begin + i] = result;
+      } else {
+        results[begin + i] = std::nullopt;
+      }
+    }
+  }
+}
+
+template <typename TStringHash, typename TIntegerHash, typename TAllocator>
+bool StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::probeString(
+    std::string_view str,
+    std::uint8_t small_hash,
+    std::size_t lower_element_offset,
+    std::size_t upper_element_offset,
+    std::uint64_t& result) const {
   const auto integer_size = integer_.getByteCount();
   const auto string_size_size = string_size_.getByteCount();
 
@@ -494,6 +762,16 @@ bool StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::tryGetInteger(
   return false;
 }
 
+template <typename TStringHash, typename TIntegerHash, typename TAllocator>
+void StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::prefetch(
+    const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(address, 0 /* read */, 3 /* keep in all caches */);
+#else
+  (void)address;
+#endif
+}
+
 template <typename TStringHash, typename TIntegerHash, typename TAllocator>
 std::optional<std::string_view>
 StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::tryGetString(
@@ -507,11 +785,11 @@ template <typename TStringHash, typename TIntegerHash, typename TAllocator>
 bool StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::tryGetString(
     std::uint64_t integer,
     std::string_view& result) const {
-  if (size_ == 0) {
+  if (size_ == 0 || integer_bucket_data_.empty()) {
     return false;
   }
 
-  const auto bucket_index = getBucketIndex(integer);
+  const auto bucket_index = getIntegerBucketIndex(integer_hasher_(integer));
 
   const auto* bucket_data = integer_bucket_data_.data() +
       (bucket_index * element_offset_.getByteCount());
@@ -557,6 +835,7 @@ std::pair<std::string_view, std::uint64_t>
 StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::getElement(
     std::size_t index) const {
   assert(index < size_);
+  assert(direction_ != MapDirection::StringToInteger);
 
   const auto integer_size = integer_.getByteCount();
   const auto string_offset_size = string_offset_.getByteCount();
@@ -579,18 +858,151 @@ StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::getElement(
       integer);
 }
 
+template <typename TStringHash, typename TIntegerHash, typename TAllocator>
+MapDirection
+StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::direction() const {
+  return direction_;
+}
+
+template <typename TStringHash, typename TIntegerHash, typename TAllocator>
+template <typename TFunc>
+void StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::forEachElement(
+    TFunc&& func) const {
+  const auto integer_size = integer_.getByteCount();
+  const auto string_size_size = string_size_.getByteCount();
+
+  const auto* element_data = string_element_data_.data();
+  for (std::size_t i = 0; i < size_; ++i) {
+    const auto integer = integer_.read(element_data);
+    const auto string_size = string_size_.read(element_data + integer_size);
+    element_data += integer_size + string_size_size + 1;
+    func(
+        std::string_view(
+            reinterpret_cast<const char*>(element_data), string_size),
+        integer);
+    element_data += string_size;
+  }
+}
+
+template <typename TStringHash, typename TIntegerHash, typename TAllocator>
+template <typename TFunc>
+void StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::forEachBuffer(
+    TFunc&& func) const {
+  for (const auto* buffer :
+       {&integer_bucket_data_,
+        &integer_element_data_,
+        &string_bucket_data_,
+        &string_element_data_}) {
+    if (!buffer->empty()) {
+      func(static_cast<const void*>(buffer->data()), buffer->size());
+    }
+  }
+}
+
+template <typename TStringHash, typename TIntegerHash, typename TAllocator>
+const MapChainStats&
+StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::stringChainStats()
+    const {
+  return string_chains_;
+}
+
+template <typename TStringHash, typename TIntegerHash, typename TAllocator>
+const MapChainStats&
+StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::integerChainStats()
+    const {
+  return integer_chains_;
+}
+
 template <typename TStringHash, typename TIntegerHash, typename TAllocator>
 std::size_t
-StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::getBucketIndex(
-    std::string_view value) const {
-  return string_hasher_(value) % bucket_count_;
+StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::getStringBucketIndex(
+    std::size_t hash) const {
+  return getBucketIndex(hash, string_chains_.seed, string_chains_.bucket_count);
+}
+
+template <typename TStringHash, typename TIntegerHash, typename TAllocator>
+std::size_t
+StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::getIntegerBucketIndex(
+    std::size_t hash) const {
+  return getBucketIndex(
+      hash, integer_chains_.seed, integer_chains_.bucket_count);
 }
 
 template <typename TStringHash, typename TIntegerHash, typename TAllocator>
 std::size_t
 StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::getBucketIndex(
-    std::uint64_t value) const {
-  return integer_hasher_(value) % bucket_count_;
+    std::size_t hash,
+    std::uint64_t seed,
+    std::size_t count) {
+  if (seed != 0) {
+    //
+    // splitmix64 finalizer, so that every seed spreads the hashes anew.
+    //
+
+    std::uint64_t x = static_cast<std::uint64_t>(hash) ^ seed;
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    hash = static_cast<std::size_t>(x);
+  }
+  return hash % count;
+}
+
+template <typename TStringHash, typename TIntegerHash, typename TAllocator>
+MapChainStats
+StringIntegerMap<TStringHash, TIntegerHash, TAllocator>::chooseBuckets(
+    const std::vector<std::size_t>& hashes,
+    const MapProbeBound& bound) {
+  MapChainStats best;
+  if (hashes.empty()) {
+    return best;
+  }
+
+  const std::size_t max_factor =
+      std::max<std::size_t>(bound.max_buckets_per_element, 1);
+  const std::size_t seed_count =
+      std::max<std::size_t>(bound.seeds_per_bucket_count, 1);
+  std::vector<std::uint32_t> chain_lengths;
+  std::size_t layouts = 0;
+  for (std::size_t factor = 1; factor <= max_factor; factor *= 2) {
+    for (std::size_t seed_index = 0; seed_index < seed_count; ++seed_index) {
+      //
+      // The first layout uses the hash as is. The seeds are fixed, so that a
+      // map is laid out the same way every time it is built.
+      //
+
+      MapChainStats stats;
+      stats.bucket_count = hashes.size() * factor;
+      stats.seed =
+          seed_index == 0 ? 0 : (layouts * 0x9e3779b97f4a7c15ULL) | 1;
+      stats.rebuilds = layouts++;
+
+      chain_lengths.assign(stats.bucket_count, 0);
+      for (const auto hash : hashes) {
+        ++chain_lengths[getBucketIndex(hash, stats.seed, stats.bucket_count)];
+      }
+      std::size_t used_buckets = 0;
+      for (const auto chain_length : chain_lengths) {
+        stats.max_chain_length =
+            std::max<std::size_t>(stats.max_chain_length, chain_length);
+        used_buckets += chain_length != 0;
+      }
+      stats.mean_chain_length =
+          static_cast<double>(hashes.size()) / used_buckets;
+      stats.bound_met = bound.max_chain_length == 0 ||
+          stats.max_chain_length <= bound.max_chain_length;
+      if (stats.bound_met) {
+        return stats;
+      }
+      if (layouts == 1 || stats.max_chain_length < best.max_chain_length) {
+        best = stats;
+      }
+    }
+  }
+  best.rebuilds = layouts - 1;
+  return best;
 }
 
 template <typename TStringHash, typename TIntegerHash, typename TAllocator>
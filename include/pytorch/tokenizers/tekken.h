@@ -54,6 +54,8 @@ class Tekken : public detail::BPETokenizerBase {
   // Load from tekken.json file
   Error load(const std::string& tokenizer_path) override;
 
+  RegexStats regex_stats() const override;
+
   // Support loading with explicit special tokens
   Error load_with_special_tokens(
       const std::string& tokenizer_path,
@@ -67,10 +69,14 @@ class Tekken : public detail::BPETokenizerBase {
  protected:
   // Virtual methods from BPETokenizerBase
   Error _encode(
-      const std::string& input,
+      std::string_view input,
       std::vector<uint64_t>& ret,
       uint64_t& last_piece_token_len) const override;
 
+  Error _pre_tokenize(
+      std::string_view input,
+      std::vector<std::string>& pieces) const override;
+
   void _decode(const std::string& input, std::string& ret) const override;
 
  private:
@@ -14,9 +14,6 @@
 // Standard
 #include <cstdint>
 
-// Third Party
-#include <re2/re2.h>
-
 // Local
 #include <pytorch/tokenizers/bpe_tokenizer_base.h>
 #include <pytorch/tokenizers/compiler.h>
@@ -86,6 +83,8 @@ class Tiktoken : public detail::BPETokenizerBase {
 
   Error load(const std::string& tokenizer_path) override;
 
+  RegexStats regex_stats() const override;
+
  private:
   static inline std::unique_ptr<std::vector<std::string>>
   _get_default_special_tokens() {
@@ -118,10 +117,14 @@ class Tiktoken : public detail::BPETokenizerBase {
   }
 
   Error _encode(
-      const std::string& input,
+      std::string_view input,
       std::vector<uint64_t>& ret,
       uint64_t& last_piece_token_len) const override;
 
+  Error _pre_tokenize(
+      std::string_view input,
+      std::vector<std::string>& pieces) const override;
+
   void _decode(const std::string& input, std::string& ret) const override;
 
   detail::TokenMap _build_special_token_map(ssize_t num_base_tokens) const;
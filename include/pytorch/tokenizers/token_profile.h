@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * @file
+ * Token and piece frequency profiles of a corpus.
+ */
+
+#pragma once
+
+// Standard
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/bpe_tokenizer_base.h>
+#include <pytorch/tokenizers/error.h>
+#include <pytorch/tokenizers/executor.h>
+#include <pytorch/tokenizers/result.h>
+
+namespace tokenizers {
+
+struct TokenProfileConfig {
+  /// Number of parts the corpus is split into, 0 for the concurrency of the
+  /// executor
+  size_t num_threads = 0;
+
+  /// Executor the parts run on, nullptr for default_executor()
+  std::shared_ptr<Executor> executor;
+
+  /// Capacities, in pieces, of the piece caches to simulate
+  std::vector<size_t> cache_sizes = {1024, 4096, 16384, 65536, 262144};
+
+  /// Number of most frequent pieces kept in the profile, 0 for all
+  size_t max_pieces = 0;
+};
+
+struct ProfiledPiece {
+  std::string piece;
+  uint64_t count = 0;
+  // Number of tokens the piece encodes to
+  uint32_t num_tokens = 0;
+};
+
+/**
+ * Hit rates of a piece cache of the given capacity over the pieces of the
+ * corpus that are not a single token, i.e. those that the tokenizer looks up
+ * in its piece cache.
+ */
+struct CacheSimulation {
+  uint64_t capacity = 0;
+  uint64_t lookups = 0;
+  // Hits of a least-recently-used cache that starts empty
+  uint64_t lru_hits = 0;
+  // Hits of a static table preloaded with the `capacity` most frequent pieces
+  uint64_t static_hits = 0;
+};
+
+struct TokenProfile {
+  // Histograms have this many buckets, the last one counting everything
+  // larger
+  static constexpr size_t kHistogramBuckets = 64;
+
+  uint64_t num_documents = 0;
+  uint64_t num_bytes = 0;
+  uint64_t num_pieces = 0;
+  uint64_t num_tokens = 0;
+
+  // Occurrences of each token id
+  std::vector<uint64_t> token_counts;
+
+  // Distinct pieces, most frequent first. Special tokens are not included.
+  std::vector<ProfiledPiece> pieces;
+
+  // Occurrences of pieces by length in bytes
+  std::vector<uint64_t> piece_length_histogram;
+
+  // Occurrences of pieces by number of merges, i.e. length minus tokens
+  std::vector<uint64_t> merge_count_histogram;
+
+  std::vector<CacheSimulation> cache_simulations;
+
+  /** The n most frequent pieces, e.g. as a warm_start() corpus */
+  std::vector<std::string> top_pieces(size_t n) const;
+};
+
+/**
+ * Run the documents through the tokenizer and profile the tokens and pieces
+ * it produces. Documents are split into parts run on the executor. The
+ * profile does not depend on the number of parts.
+ */
+Result<TokenProfile> profile_corpus(
+    const detail::BPETokenizerBase& tokenizer,
+    const std::vector<std::string>& documents,
+    const TokenProfileConfig& config = {});
+
+/**
+ * Write the profile in a compact binary format: a magic number, then
+ * variable-length integers, with token counts stored sparsely and delta
+ * encoded, and a trailing checksum.
+ */
+Error save_token_profile(const TokenProfile& profile, const std::string& path);
+
+/** Read a profile written by save_token_profile() */
+Result<TokenProfile> load_token_profile(const std::string& path);
+
+} // namespace tokenizers
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * @file
+ * Compact on-disk format for token id streams, e.g. training shards and
+ * token logs.
+ *
+ * Tokens are stored in blocks of a fixed number of tokens. Each block is
+ * bit-packed with the width that makes it smallest, at most the width of the
+ * vocabulary (17 bits for a 128k vocabulary). The few values that are wider
+ * are patched in from a list of exceptions. Values are packed four lanes wide
+ * so that SSE2 and NEON kernels unpack four tokens per instruction. An index
+ * of block offsets at the end of the stream gives random access to any token
+ * range.
+ *
+ * Layout, little endian:
+ *   magic "TKSTRM01"
+ *   u32 coding, u32 block_size, u64 vocab_size, u64 num_tokens,
+ *   u64 ranking size, u32 ranked token ids
+ *   blocks: u32 widths, u32 number of exceptions, u32 first token (Delta
+ *   only), packed groups of 128 values, u16 exception indices, bit-packed
+ *   exception high bits
+ *   u64 offset of each block
+ */
+
+#pragma once
+
+// Standard
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/error.h>
+#include <pytorch/tokenizers/result.h>
+
+namespace tokenizers {
+
+/** How token ids are turned into the packed values */
+enum class TokenStreamCoding : uint8_t {
+  /// The ids themselves
+  Plain = 0,
+  /// The difference to the previous token, zigzag encoded. This suits
+  /// streams of sorted or clustered ids.
+  Delta = 1,
+  /// The rank of the id by frequency, so that the frequent tokens, which make
+  /// up most of the stream, take few bits
+  Ranked = 2,
+};
+
+struct TokenStreamConfig {
+  /// Every token id is below this. At most 2^32, or 2^24 for Ranked coding,
+  /// whose writer keeps a table the size of the vocabulary.
+  uint64_t vocab_size = 0;
+
+  /// Tokens per block, a multiple of 128 up to 65536. Smaller blocks adapt
+  /// their width more closely and make random reads cheaper, larger ones have
+  /// less overhead.
+  uint32_t block_size = 4096;
+
+  TokenStreamCoding coding = TokenStreamCoding::Plain;
+
+  /// For Ranked coding, token ids from the most to the least frequent, e.g.
+  /// from TokenProfile::token_counts. Ids not listed rank after them in
+  /// increasing order. When empty, the ranking is computed from the tokens
+  /// written, which are then held in memory until finish().
+  std::vector<uint32_t> ranking;
+};
+
+/**
+ * Builds a token stream from tokens appended in order.
+ *
+ * Usage Example:
+ *
+ * TokenStreamConfig config;
+ * config.vocab_size = tokenizer.vocab_size();
+ * TokenStreamWriter writer(config);
+ * for (const auto& document : documents) {
+ *   auto tokens = tokenizer.encode(document, 1, 1);
+ *   writer.append(tokens->data(), tokens->size());
+ * }
+ * writer.save("shard_00.tks");
+ */
+class TokenStreamWriter {
+ public:
+  explicit TokenStreamWriter(TokenStreamConfig config);
+
+  /**
+   * Append tokens to the stream. Returns OutOfRange for a token that is not
+   * below vocab_size, in which case none of the tokens are appended.
+   */
+  Error append(const uint64_t* tokens, size_t count);
+
+  /** Number of tokens appended so far */
+  uint64_t size() const {
+    return num_tokens_;
+  }
+
+  /**
+   * Return the encoded stream. The writer is left empty, ready for the next
+   * stream.
+   */
+  Result<std::string> finish();
+
+  /** Write finish() to path */
+  Error save(const std::string& path);
+
+ private:
+  Error validate() const;
+  void build_ranks(const std::vector<uint32_t>& ranking);
+  void flush_block(const uint32_t* tokens, size_t count);
+
+  TokenStreamConfig config_;
+  Error config_error_;
+  // Rank of each token id, for Ranked coding
+  std::vector<uint32_t> ranks_;
+  // Tokens of the block being filled, or of the whole stream while the
+  // ranking is not known
+  std::vector<uint32_t> pending_;
+  std::string blocks_;
+  std::vector<uint64_t> block_offsets_;
+  uint64_t num_tokens_ = 0;
+};
+
+/**
+ * Random access reader of a token stream. read() decodes straight into the
+ * caller's buffer, e.g. a training batch, and only touches the blocks
+ * overlapping the requested range.
+ *
+ * A reader is immutable once loaded and may be shared between threads.
+ */
+class TokenStreamReader {
+ public:
+  /** Read the stream at path */
+  Error load(const std::string& path);
+
+  /** Use a stream held in memory, e.g. returned by TokenStreamWriter */
+  Error load_from_memory(std::string data);
+
+  /** Number of tokens of the stream */
+  uint64_t size() const {
+    return num_tokens_;
+  }
+
+  uint64_t vocab_size() const {
+    return vocab_size_;
+  }
+
+  TokenStreamCoding coding() const {
+    return coding_;
+  }
+
+  uint32_t block_size() const {
+    return block_size_;
+  }
+
+  /**
+   * Decode tokens [begin, begin + count) to out, which holds count elements.
+   * Returns OutOfRange if the range goes past the end of the stream.
+   */
+  Error read(uint64_t begin, size_t count, uint32_t* out) const;
+  Error read(uint64_t begin, size_t count, int32_t* out) const;
+  Error read(uint64_t begin, size_t count, uint64_t* out) const;
+  Error read(uint64_t begin, size_t count, int64_t* out) const;
+
+  /** Decode the whole stream */
+  Result<std::vector<uint64_t>> read_all() const;
+
+ private:
+  template <typename T>
+  Error read_impl(uint64_t begin, size_t count, T* out) const;
+
+  // Token id of a rank past the listed ones, for Ranked coding
+  uint32_t unlisted_id(uint32_t rank) const;
+
+  std::string data_;
+  TokenStreamCoding coding_ = TokenStreamCoding::Plain;
+  uint32_t block_size_ = 0;
+  uint64_t vocab_size_ = 0;
+  uint64_t num_tokens_ = 0;
+  // Token id of each rank listed in the stream, for Ranked coding
+  std::vector<uint32_t> ids_;
+  // For each listed id in increasing order, how many ids below it are not
+  // listed. Unlisted ids are found by searching this rather than a table as
+  // large as the vocabulary, which the header alone cannot be trusted with.
+  std::vector<uint32_t> unlisted_below_;
+  // Widest value a block may hold
+  uint32_t max_width_ = 0;
+  // Offset in data_ of each block, plus the end of the last block
+  std::vector<uint64_t> block_offsets_;
+  bool loaded_ = false;
+};
+
+} // namespace tokenizers
@@ -16,6 +16,7 @@
 #include <pytorch/tokenizers/error.h>
 #include <pytorch/tokenizers/result.h>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace tokenizers {
@@ -25,6 +26,12 @@ struct TokenIndex {
   int32_t id;
 };
 
+// A block of memory owned by a loaded tokenizer
+struct MemoryRegion {
+  const void* data;
+  size_t size;
+};
+
 class Tokenizer {
  public:
   explicit Tokenizer() {}
@@ -46,6 +53,20 @@ class Tokenizer {
   virtual Result<std::vector<uint64_t>>
   encode(const std::string& input, int8_t bos = 0, int8_t eos = 0) const = 0;
 
+  /**
+   * Encode like encode() from a view of the input, such as the UTF-8 buffer
+   * of a Python str. Tiktoken and Tekken never copy the whole input.
+   * HuggingFace does not copy it when its pre-tokenizer only splits (Split,
+   * Whitespace, Punctuation, Digits, and Sequences of those) and its
+   * normalizer leaves the text unchanged; ByteLevel and Metaspace rewrite the
+   * text, so the input is copied once for them. The default copies it once
+   * into a std::string.
+   */
+  virtual Result<std::vector<uint64_t>>
+  encode_view(std::string_view input, int8_t bos = 0, int8_t eos = 0) const {
+    return encode(std::string(input), bos, eos);
+  }
+
   virtual Result<std::string> decode(uint64_t prev_token, uint64_t token)
       const = 0;
 
@@ -66,6 +87,15 @@ class Tokenizer {
     return initialized_;
   }
 
+  /**
+   * Return the memory holding the tables of the loaded model, e.g. for
+   * warm_start() to prefault or lock. Tokenizers that do not report their
+   * tables return an empty list.
+   */
+  virtual std::vector<MemoryRegion> memory_regions() const {
+    return {};
+  }
+
  protected:
   bool initialized_ = false;
   int32_t vocab_size_ = 0;
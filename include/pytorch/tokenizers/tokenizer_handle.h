@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * @file
+ * Hot-swappable tokenizer handle.
+ */
+
+#pragma once
+
+// Standard
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/error.h>
+#include <pytorch/tokenizers/result.h>
+#include <pytorch/tokenizers/tokenizer.h>
+
+namespace tokenizers {
+
+/**
+ * TokenizerHandle owns a loaded Tokenizer and lets it be replaced while other
+ * threads keep encoding and decoding through the handle.
+ *
+ * Readers pin the current model with an epoch scheme: every reader bumps a
+ * counter in one of a fixed number of cache-line sized slots for the current
+ * epoch parity, then loads the model pointer. Publishing a new model swaps the
+ * pointer, flips the epoch and waits for the old parity to drain before
+ * deleting the previous model. In-flight calls therefore finish on the model
+ * they started with, new calls see the new one, and the read path only does
+ * atomic increments on a (mostly) thread-private cache line.
+ *
+ * Publishing is serialized and blocks until the old model is quiescent, so it
+ * must not be called from a thread that holds a Guard on the same handle.
+ *
+ * Usage Example:
+ *
+ * TokenizerHandle handle([] { return std::make_unique<Tiktoken>(); });
+ * handle.load("tokenizer.model");
+ * auto tokens = handle.encode("Hello world!", 1, 0);
+ * // Later, from any thread:
+ * handle.load("tokenizer_v2.model");
+ */
+class TokenizerHandle {
+ public:
+  /** Creates a fresh, unloaded tokenizer instance */
+  using Factory = std::function<std::unique_ptr<Tokenizer>()>;
+
+  /**
+   * RAII pin on the model that was current when it was acquired. The model
+   * stays alive until the guard is destroyed.
+   */
+  class Guard {
+   public:
+    Guard(Guard&& other) noexcept;
+    Guard& operator=(Guard&&) = delete;
+    Guard(const Guard&) = delete;
+    Guard& operator=(const Guard&) = delete;
+    ~Guard();
+
+    const Tokenizer* get() const {
+      return tokenizer_;
+    }
+
+    const Tokenizer* operator->() const {
+      return tokenizer_;
+    }
+
+    explicit operator bool() const {
+      return tokenizer_ != nullptr;
+    }
+
+   private:
+    friend class TokenizerHandle;
+    Guard(std::atomic<uint64_t>* counter, const Tokenizer* tokenizer)
+        : counter_(counter), tokenizer_(tokenizer) {}
+
+    std::atomic<uint64_t>* counter_;
+    const Tokenizer* tokenizer_;
+  };
+
+  /**
+   * @param factory: Used by load() to create the instance a new artifact is
+   *    loaded into
+   */
+  explicit TokenizerHandle(Factory factory);
+
+  /**
+   * @param tokenizer: An already loaded tokenizer to publish immediately
+   * @param factory: Optional, required to use load()
+   */
+  explicit TokenizerHandle(
+      std::unique_ptr<Tokenizer> tokenizer,
+      Factory factory = nullptr);
+
+  TokenizerHandle(const TokenizerHandle&) = delete;
+  TokenizerHandle& operator=(const TokenizerHandle&) = delete;
+
+  /** Must not be destroyed while guards are held */
+  ~TokenizerHandle();
+
+  /**
+   * Load the artifact into a new instance created by the factory and publish
+   * it. On failure the current model stays published.
+   */
+  Error load(const std::string& tokenizer_path);
+
+  /**
+   * Publish an already loaded tokenizer, reclaiming the previous one once no
+   * reader uses it anymore.
+   */
+  Error publish(std::unique_ptr<Tokenizer> tokenizer);
+
+  /** Pin the current model */
+  Guard acquire() const;
+
+  /** Encode with the current model, see Tokenizer::encode */
+  Result<std::vector<uint64_t>>
+  encode(const std::string& input, int8_t bos = 0, int8_t eos = 0) const;
+
+  /** Decode with the current model, see Tokenizer::decode */
+  Result<std::string> decode(uint64_t prev_token, uint64_t token) const;
+
+  /** Whether a loaded model has been published */
+  bool is_loaded() const;
+
+  /** Number of models published so far */
+  uint64_t generation() const {
+    return generation_.load(std::memory_order_acquire);
+  }
+
+ private:
+  static constexpr size_t kReaderSlots = 64;
+
+  struct alignas(64) ReaderSlot {
+    std::atomic<uint64_t> active[2] = {{0}, {0}};
+  };
+
+  static size_t reader_slot_index();
+
+  void wait_for_readers(size_t parity) const;
+
+  Factory factory_;
+  std::atomic<Tokenizer*> current_{nullptr};
+  std::atomic<uint64_t> epoch_{0};
+  std::atomic<uint64_t> generation_{0};
+  mutable std::array<ReaderSlot, kReaderSlots> slots_;
+  std::mutex publish_mutex_;
+};
+
+} // namespace tokenizers
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * @file
+ * Capture of encode and decode calls, to replay real traffic against other
+ * builds (examples/traffic_replay). The prompt lengths, languages, special
+ * token density and repetition of real traffic decide how caches behave,
+ * which synthetic corpora do not reproduce.
+ *
+ * Log layout, little endian:
+ *   magic "TKTRAF01", u8 flags (1: redacted)
+ *   records: u8 kind, varint start time in microseconds since the capture
+ *   started, varint duration in nanoseconds, varint thread index, then
+ *     Encode: i8 bos, i8 eos, varint text size, text
+ *     Decode: varint previous token, varint token
+ */
+
+#pragma once
+
+// Standard
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/error.h>
+#include <pytorch/tokenizers/result.h>
+#include <pytorch/tokenizers/tokenizer.h>
+
+namespace tokenizers {
+
+enum class TrafficCallKind : uint8_t {
+  Encode = 1,
+  Decode = 2,
+};
+
+/** One captured call */
+struct TrafficRecord {
+  TrafficCallKind kind = TrafficCallKind::Encode;
+  // Start of the call, in microseconds since the capture started
+  uint64_t start_us = 0;
+  // Duration of the call in the captured process
+  uint64_t duration_ns = 0;
+  // Index of the calling thread in the capturing process
+  uint32_t thread = 0;
+  // Encode
+  std::string text;
+  int8_t bos = 0;
+  int8_t eos = 0;
+  // Decode
+  uint64_t prev_token = 0;
+  uint64_t token = 0;
+};
+
+struct TrafficCaptureOptions {
+  /// Replace the text of encode calls by text of the same shape: letters and
+  /// digits are substituted with letters and digits of the same case, and the
+  /// last byte of each multi-byte character with another one, so that it
+  /// stays in the same Unicode block. White space, punctuation and the other
+  /// bytes are kept. The substitution depends only on the byte, so repeated
+  /// text stays repeated and caches behave as with the original traffic.
+  /// Decoded token ids are mapped to other ids of the vocabulary the same
+  /// way. This hides the content from casual reading, it is not encryption.
+  bool redact = false;
+
+  /// Key of the substitution, 0 for a random one
+  uint64_t redaction_key = 0;
+
+  /// Strings kept verbatim when redacting, e.g. the special tokens
+  std::vector<std::string> preserved;
+
+  /// Bytes buffered before they are written to the log
+  size_t buffer_size = 1 << 20;
+};
+
+/**
+ * Writes captured calls to a log. Thread safe; calls are appended in the
+ * order they complete.
+ */
+class TrafficRecorder {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /** Create or truncate the log at path */
+  static Result<std::shared_ptr<TrafficRecorder>> open(
+      const std::string& path,
+      TrafficCaptureOptions options = {});
+
+  /** Flushes the log */
+  ~TrafficRecorder();
+
+  TrafficRecorder(const TrafficRecorder&) = delete;
+  TrafficRecorder& operator=(const TrafficRecorder&) = delete;
+
+  void record_encode(
+      std::string_view text,
+      int8_t bos,
+      int8_t eos,
+      Clock::time_point start,
+      Clock::time_point end);
+
+  /** vocab_size bounds the ids that decoded tokens are redacted to */
+  void record_decode(
+      uint64_t prev_token,
+      uint64_t token,
+      uint64_t vocab_size,
+      Clock::time_point start,
+      Clock::time_point end);
+
+  /** Write the buffered records. Returns the first write error, if any. */
+  Error flush();
+
+  /** Number of calls recorded so far */
+  uint64_t size() const {
+    return num_records_.load(std::memory_order_relaxed);
+  }
+
+  /** The text that is recorded for an encode of text */
+  std::string redact(std::string_view text) const;
+
+ private:
+  TrafficRecorder(std::ofstream file, TrafficCaptureOptions options);
+
+  void append_header(
+      std::string& out,
+      TrafficCallKind kind,
+      Clock::time_point start,
+      Clock::time_point end) const;
+  void append(const std::string& record);
+  uint64_t redact_token(uint64_t token, uint64_t vocab_size) const;
+
+  TrafficCaptureOptions options_;
+  Clock::time_point origin_;
+  // Byte substitution used by redact()
+  uint8_t substitution_[256];
+  // Preserved strings indexed by their first byte
+  std::vector<uint32_t> preserved_by_first_byte_[256];
+  std::atomic<uint64_t> num_records_{0};
+  // Guards file_, buffer_ and error_
+  std::mutex mutex_;
+  std::ofstream file_;
+  std::string buffer_;
+  Error error_ = Error::Ok;
+};
+
+/**
+ * Tokenizer that forwards to another one and records every encode and decode
+ * call. Use it in place of the tokenizer to capture, e.g. when publishing to a
+ * TokenizerHandle.
+ *
+ * Usage Example:
+ *
+ * auto recorder = TrafficRecorder::open("/tmp/traffic.tklog");
+ * auto tokenizer = std::make_unique<CapturingTokenizer>(
+ *     std::make_unique<Tiktoken>(), *recorder);
+ * tokenizer->load(path);
+ */
+class CapturingTokenizer : public Tokenizer {
+ public:
+  CapturingTokenizer(
+      std::unique_ptr<Tokenizer> tokenizer,
+      std::shared_ptr<TrafficRecorder> recorder);
+
+  Error load(const std::string& tokenizer_path) override;
+
+  Result<std::vector<uint64_t>> encode(
+      const std::string& input,
+      int8_t bos = 0,
+      int8_t eos = 0) const override;
+
+  Result<std::vector<uint64_t>> encode_view(
+      std::string_view input,
+      int8_t bos = 0,
+      int8_t eos = 0) const override;
+
+  Result<std::string> decode(uint64_t prev_token, uint64_t token)
+      const override;
+
+  bool is_loaded() const override;
+
+  std::vector<MemoryRegion> memory_regions() const override;
+
+  /** The tokenizer calls are forwarded to */
+  const Tokenizer& wrapped() const {
+    return *tokenizer_;
+  }
+
+ private:
+  std::unique_ptr<Tokenizer> tokenizer_;
+  std::shared_ptr<TrafficRecorder> recorder_;
+};
+
+/**
+ * Reads a traffic log written by TrafficRecorder.
+ */
+class TrafficLogReader {
+ public:
+  /**
+   * Read the log at path. A record cut short at the end of the log, as left
+   * by a process that was killed while capturing, is dropped and reported by
+   * truncated().
+   */
+  Error load(const std::string& path);
+
+  const std::vector<TrafficRecord>& records() const {
+    return records_;
+  }
+
+  bool redacted() const {
+    return redacted_;
+  }
+
+  bool truncated() const {
+    return truncated_;
+  }
+
+ private:
+  std::vector<TrafficRecord> records_;
+  bool redacted_ = false;
+  bool truncated_ = false;
+};
+
+} // namespace tokenizers
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// Character classes and scripts used by the native pre-tokenizers and regex
+// scanners, backed by the tables in unicode_categories_data.cpp.
+#pragma once
+
+// Standard
+#include <cstddef>
+#include <cstdint>
+
+namespace tokenizers {
+namespace unicode {
+
+// Record flags
+constexpr uint8_t kWhiteSpace = 1 << 0; // White_Space property (regex \s)
+constexpr uint8_t kWordCharacter = 1 << 1; // Unicode regex \w
+constexpr uint8_t kPunctuation = 1 << 2; // General category P* or ASCII
+                                         // punctuation
+constexpr uint8_t kLetter = 1 << 3; // General category L* (regex \p{L})
+constexpr uint8_t kNumber = 1 << 4; // General category N* (regex \p{N})
+
+// Scripts with fixed ids. Unknown is used for unassigned code points and
+// invalid UTF-8 bytes.
+constexpr uint8_t kScriptUnknown = 0;
+constexpr uint8_t kScriptCommon = 1;
+constexpr uint8_t kScriptInherited = 2;
+constexpr uint8_t kScriptHan = 3;
+constexpr uint8_t kScriptHiragana = 4;
+constexpr uint8_t kScriptKatakana = 5;
+
+/**
+ * General categories, in the order of the Unicode standard. Values outside the
+ * code space have category Cn (unassigned).
+ */
+// clang-format off
+enum class GeneralCategory : uint8_t {
+  Lu, Ll, Lt, Lm, Lo,
+  Mn, Mc, Me,
+  Nd, Nl, No,
+  Pc, Pd, Ps, Pe, Pi, Pf, Po,
+  Sm, Sc, Sk, So,
+  Zs, Zl, Zp,
+  Cc, Cf, Cs, Co, Cn,
+};
+// clang-format on
+
+/** Per code point character class flags and script id */
+struct CategoryRecord {
+  uint8_t flags;
+  uint8_t script;
+};
+
+namespace data {
+extern const uint32_t kCategoryBlockShift;
+extern const uint16_t kCategoryStage1[];
+extern const uint16_t kCategoryStage2[];
+extern const CategoryRecord kCategoryRecords[];
+extern const char* const kScriptNames[];
+extern const size_t kNumScripts;
+extern const uint32_t kGeneralCategoryBlockShift;
+extern const uint16_t kGeneralCategoryStage1[];
+extern const uint8_t kGeneralCategoryStage2[];
+} // namespace data
+
+/**
+ * Look up the class flags and script of a code point. Values outside the code
+ * space (including kInvalidCodepoint) have no flags and the Unknown script.
+ */
+inline CategoryRecord categories(uint32_t cp) {
+  if (cp >= 0x110000) {
+    return CategoryRecord{0, kScriptUnknown};
+  }
+  const uint32_t block = data::kCategoryStage1[cp >> data::kCategoryBlockShift];
+  const uint32_t mask = (1u << data::kCategoryBlockShift) - 1;
+  const uint32_t index = (block << data::kCategoryBlockShift) + (cp & mask);
+  return data::kCategoryRecords[data::kCategoryStage2[index]];
+}
+
+/** General category of a code point, see unicode_general_category_data.cpp */
+inline GeneralCategory general_category(uint32_t cp) {
+  if (cp >= 0x110000) {
+    return GeneralCategory::Cn;
+  }
+  const uint32_t shift = data::kGeneralCategoryBlockShift;
+  const uint32_t block = data::kGeneralCategoryStage1[cp >> shift];
+  const uint32_t index = (block << shift) + (cp & ((1u << shift) - 1));
+  return static_cast<GeneralCategory>(data::kGeneralCategoryStage2[index]);
+}
+
+/** Name of a script id as found in Scripts.txt (e.g. "Latin") */
+inline const char* script_name(uint8_t script) {
+  return script < data::kNumScripts ? data::kScriptNames[script] : "Unknown";
+}
+
+} // namespace unicode
+} // namespace tokenizers
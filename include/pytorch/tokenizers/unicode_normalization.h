@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// Unicode normalization forms, case folding and mark filtering on UTF-8
+// strings, backed by the tables in unicode_normalization_data.cpp.
+//
+// All transforms follow the same convention: they return false when the input
+// is already in the requested form, in which case the output string is left in
+// an unspecified state and the caller should keep using the input. Inputs are
+// quick-checked first so that the common already-normalized case does not
+// allocate or copy. Invalid UTF-8 bytes are passed through unchanged.
+#pragma once
+
+// Standard
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace tokenizers {
+namespace unicode {
+
+// -- Property tables ----------------------------------------------------------
+
+// Record flags
+constexpr uint8_t kNFDNo = 1 << 0;
+constexpr uint8_t kNFKDNo = 1 << 1;
+constexpr uint8_t kNFCNo = 1 << 2;
+constexpr uint8_t kNFCMaybe = 1 << 3;
+constexpr uint8_t kNFKCNo = 1 << 4;
+constexpr uint8_t kNFKCMaybe = 1 << 5;
+constexpr uint8_t kNonspacingMark = 1 << 6; // General category Mn
+constexpr uint8_t kOther = 1 << 7; // General category C*
+
+/**
+ * Per code point properties. Decompositions and the lowercase mapping are
+ * stored as [offset, offset + length) ranges of code points in data::kPool.
+ */
+struct CodepointRecord {
+  uint8_t ccc; // Canonical combining class
+  uint8_t flags;
+  uint8_t canonical_length; // Full canonical decomposition (NFD)
+  uint8_t compat_length; // Full compatibility decomposition (NFKD)
+  uint8_t lower_length; // Full lowercase mapping
+  uint16_t canonical_offset;
+  uint16_t compat_offset;
+  uint16_t lower_offset;
+};
+
+/** A primary composite and the canonical pair it composes from */
+struct CompositionPair {
+  uint32_t first;
+  uint32_t second;
+  uint32_t composite;
+};
+
+namespace data {
+extern const uint32_t kBlockShift;
+extern const uint16_t kStage1[];
+extern const uint16_t kStage2[];
+extern const CodepointRecord kRecords[];
+extern const uint32_t kPool[];
+extern const CompositionPair kCompositions[];
+extern const size_t kNumCompositions;
+} // namespace data
+
+/** Look up the properties of a code point (must be < 0x110000) */
+inline const CodepointRecord& lookup(uint32_t cp) {
+  const uint32_t block = data::kStage1[cp >> data::kBlockShift];
+  const uint32_t mask = (1u << data::kBlockShift) - 1;
+  return data::kRecords
+      [data::kStage2[(block << data::kBlockShift) + (cp & mask)]];
+}
+
+// -- UTF-8 --------------------------------------------------------------------
+
+/**
+ * Decode the code point starting at data[0]. Returns the number of bytes
+ * consumed. Invalid or truncated sequences consume one byte and yield
+ * kInvalidCodepoint.
+ */
+constexpr uint32_t kInvalidCodepoint = 0xFFFFFFFF;
+size_t decode_utf8(const char* data, size_t size, uint32_t& cp);
+
+/** Append the UTF-8 encoding of cp to out */
+void append_utf8(uint32_t cp, std::string& out);
+
+// -- UTF-16 -------------------------------------------------------------------
+
+/**
+ * Append the UTF-8 encoding of a UTF-16 string to out. Unpaired surrogates
+ * become U+FFFD. Every code unit of the input then maps to whole UTF-8
+ * characters: a unit outside a surrogate pair to 1 to 3 bytes, a surrogate
+ * pair to 4 bytes.
+ */
+void append_utf16_as_utf8(std::u16string_view input, std::string& out);
+
+/**
+ * Number of UTF-16 code units of the UTF-8 characters starting in
+ * [data, data + size), for UTF-8 produced by append_utf16_as_utf8(). An offset
+ * inside a character is thus rounded up to the end of that character.
+ */
+size_t utf16_length(const char* data, size_t size);
+
+// -- Transforms ---------------------------------------------------------------
+
+enum class NormalizationForm { NFC, NFD, NFKC, NFKD };
+
+/**
+ * Normalize input to the given form.
+ *
+ * @return false if the input is already normalized.
+ */
+bool normalize(
+    std::string_view input,
+    NormalizationForm form,
+    std::string& out);
+
+/**
+ * Map every code point to its full lowercase mapping, independently of the
+ * surrounding context (e.g. a final capital sigma becomes σ).
+ *
+ * @return false if the input contains no upper case characters.
+ */
+bool to_lower(std::string_view input, std::string& out);
+
+/**
+ * Remove all non-spacing marks (general category Mn).
+ *
+ * @return false if the input contains no non-spacing marks.
+ */
+bool remove_nonspacing_marks(std::string_view input, std::string& out);
+
+/** Whether cp has the Unicode White_Space property */
+bool is_whitespace(uint32_t cp);
+
+} // namespace unicode
+} // namespace tokenizers
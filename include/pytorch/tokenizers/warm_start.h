@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+/**
+ * @file
+ * Warming up a freshly loaded tokenizer before it serves traffic.
+ */
+
+#pragma once
+
+// Standard
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/error.h>
+#include <pytorch/tokenizers/result.h>
+#include <pytorch/tokenizers/tokenizer.h>
+
+namespace tokenizers {
+
+struct WarmStartOptions {
+  /// Touch every page of the model tables
+  bool prefault = true;
+
+  /// mlock the model tables so they are never paged out. This is limited by
+  /// RLIMIT_MEMLOCK; regions that cannot be locked are counted in the report
+  /// and do not fail the warm-up. The locks are not released when the
+  /// tokenizer is destroyed.
+  bool lock_memory = false;
+
+  /// Texts to encode and decode, empty for warm_start_corpus()
+  std::vector<std::string> corpus;
+
+  /// Number of passes over the corpus
+  size_t rounds = 2;
+};
+
+struct WarmStartReport {
+  std::chrono::nanoseconds prefault_time{0};
+  std::chrono::nanoseconds lock_time{0};
+  std::chrono::nanoseconds encode_time{0};
+  std::chrono::nanoseconds decode_time{0};
+  // Wall time of the whole call
+  std::chrono::nanoseconds total_time{0};
+
+  // Encode and decode time of each pass over the corpus. The last ones show
+  // whether the tokenizer has reached its steady state.
+  std::vector<std::chrono::nanoseconds> round_times;
+
+  size_t bytes_prefaulted = 0;
+  size_t bytes_locked = 0;
+  // Regions mlock refused, e.g. because of RLIMIT_MEMLOCK
+  size_t lock_failures = 0;
+
+  size_t texts_encoded = 0;
+  size_t tokens_encoded = 0;
+};
+
+/**
+ * Bring a loaded tokenizer to its steady-state speed.
+ *
+ * The first requests served by a new instance are slowed down by page faults
+ * on the model tables, regex engines building their DFA state lazily and an
+ * empty piece cache. warm_start() prefaults (and optionally locks) the
+ * regions reported by Tokenizer::memory_regions(), then encodes every text of
+ * the corpus and decodes the result, `rounds` times. A tokenizer loaded for
+ * one direction only (see TokenizerMode) skips the other. Call it after load()
+ * and after attaching a piece cache, and only report the instance healthy once
+ * it returned.
+ *
+ * Usage Example:
+ *
+ * Tiktoken tokenizer;
+ * tokenizer.load("tokenizer.model");
+ * auto report = warm_start(tokenizer);
+ * if (report.ok()) {
+ *   log("warm after %lld ms", report->total_time.count() / 1000000);
+ * }
+ *
+ * @return The report, Uninitialized if the tokenizer is not loaded, or the
+ *    error of the first text that failed to encode or decode
+ */
+Result<WarmStartReport> warm_start(
+    const Tokenizer& tokenizer,
+    const WarmStartOptions& options = {});
+
+/**
+ * Built-in sample of English prose, code, numbers, whitespace runs and
+ * non-Latin scripts, used when no corpus is given
+ */
+const std::vector<std::string>& warm_start_corpus();
+
+} // namespace tokenizers
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// Work counters of the encode, decode and regex hot loops, read by the
+// performance fuzzers in fuzz/ to find inputs that cost more than linear time.
+// The loops count with TK_COUNT_WORK, which only does something in builds
+// with TK_WORK_COUNTERS defined (the TOKENIZERS_BUILD_FUZZERS option) and
+// compiles to nothing otherwise.
+#pragma once
+
+// Standard
+#include <cstdint>
+
+namespace tokenizers {
+
+/**
+ * @brief Units of work done by the calling thread.
+ */
+struct WorkCounters {
+  // Parts visited by the BPE merge loops, one per part and merge round
+  uint64_t merge_steps = 0;
+  // Thread or position steps of the regex engines that we implement, and
+  // bytes searched for special tokens
+  uint64_t regex_steps = 0;
+  // Bytes copied while splitting the input and building decoded text
+  uint64_t bytes_copied = 0;
+};
+
+/** Counters of the calling thread */
+inline WorkCounters& work_counters() {
+  static thread_local WorkCounters counters;
+  return counters;
+}
+
+/** Zero the counters of the calling thread */
+inline void reset_work_counters() {
+  work_counters() = WorkCounters{};
+}
+
+} // namespace tokenizers
+
+#ifdef TK_WORK_COUNTERS
+#define TK_COUNT_WORK(counter, amount) \
+  (::tokenizers::work_counters().counter += (amount))
+#else
+#define TK_COUNT_WORK(counter, amount) ((void)0)
+#endif
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+# Copyright (c) Meta Platforms, Inc. and affiliates.
+# All rights reserved.
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+# @lint-ignore-every LICENSELINT
+
+"""
+Generate src/unicode_categories_data.cpp from the Unicode Character Database.
+
+The tables back the native pre-tokenizers (Whitespace, WhitespaceSplit,
+Punctuation, BertPreTokenizer and UnicodeScripts) and the native regex
+scanners. Each code point maps through
+a two-stage lookup table to a record holding its character class flags and its
+script.
+
+General categories come from the Python unicodedata module. Scripts, White_Space,
+Join_Control and Alphabetic come from the UCD files of the same Unicode version,
+found in the directory given on the command line:
+
+    https://www.unicode.org/Public/<version>/ucd/Scripts.txt
+    https://www.unicode.org/Public/<version>/ucd/PropList.txt
+    https://www.unicode.org/Public/<version>/ucd/DerivedCoreProperties.txt
+
+Usage:
+    python3 scripts/generate_unicode_categories_data.py <ucd-dir> > \
+        src/unicode_categories_data.cpp
+"""
+
+import os
+import string
+import sys
+import unicodedata
+
+MAX_CP = 0x110000
+
+# Must match the flag constants in unicode_categories.h
+WHITE_SPACE = 1 << 0
+WORD = 1 << 1
+PUNCTUATION = 1 << 2
+LETTER = 1 << 3
+NUMBER = 1 << 4
+
+# Scripts with fixed ids, must match unicode_categories.h. All other scripts
+# follow in alphabetical order.
+FIXED_SCRIPTS = ["Unknown", "Common", "Inherited", "Han", "Hiragana", "Katakana"]
+
+
+def parse_ucd(path):
+    """Yield (first, last, value) for each data line of a UCD file"""
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            cps, value = (field.strip() for field in line.split(";")[:2])
+            if ".." in cps:
+                first, last = (int(cp, 16) for cp in cps.split(".."))
+            else:
+                first = last = int(cps, 16)
+            yield first, last, value
+
+
+def load_property(path, name):
+    result = set()
+    for first, last, value in parse_ucd(path):
+        if value == name:
+            result.update(range(first, last + 1))
+    return result
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__)
+    ucd_dir = sys.argv[1]
+
+    white_space = load_property(os.path.join(ucd_dir, "PropList.txt"), "White_Space")
+    join_control = load_property(
+        os.path.join(ucd_dir, "PropList.txt"), "Join_Control"
+    )
+    alphabetic = load_property(
+        os.path.join(ucd_dir, "DerivedCoreProperties.txt"), "Alphabetic"
+    )
+
+    script_names = set()
+    cp_scripts = [0] * MAX_CP
+    script_ranges = list(parse_ucd(os.path.join(ucd_dir, "Scripts.txt")))
+    for _, _, name in script_ranges:
+        script_names.add(name)
+    script_ids = {name: i for i, name in enumerate(FIXED_SCRIPTS)}
+    for name in sorted(script_names - set(FIXED_SCRIPTS)):
+        script_ids[name] = len(script_ids)
+    assert len(script_ids) < 1 << 8, len(script_ids)
+    for first, last, name in script_ranges:
+        for cp in range(first, last + 1):
+            cp_scripts[cp] = script_ids[name]
+
+    records = []
+    record_index = {}
+    cp_records = []
+    for cp in range(MAX_CP):
+        flags = 0
+        if 0xD800 <= cp <= 0xDFFF:
+            category = "Cs"
+        else:
+            category = unicodedata.category(chr(cp))
+        if cp in white_space:
+            flags |= WHITE_SPACE
+        # Unicode \w as defined by UTS #18 (and the Rust regex crate)
+        if (
+            cp in alphabetic
+            or category.startswith("M")
+            or category in ("Nd", "Pc")
+            or cp in join_control
+        ):
+            flags |= WORD
+        if category.startswith("P") or (
+            cp < 0x80 and chr(cp) in string.punctuation
+        ):
+            flags |= PUNCTUATION
+        if category.startswith("L"):
+            flags |= LETTER
+        if category.startswith("N"):
+            flags |= NUMBER
+        record = (flags, cp_scripts[cp])
+        if record not in record_index:
+            record_index[record] = len(records)
+            records.append(record)
+        cp_records.append(record_index[record])
+
+    assert len(records) < 1 << 16, len(records)
+
+    # Pick the block size giving the smallest two-stage table
+    best = None
+    for shift in range(5, 10):
+        block = 1 << shift
+        blocks = []
+        block_index = {}
+        stage1 = []
+        for start in range(0, MAX_CP, block):
+            key = tuple(cp_records[start : start + block])
+            if key not in block_index:
+                block_index[key] = len(blocks)
+                blocks.append(key)
+            stage1.append(block_index[key])
+        size = len(stage1) * 2 + len(blocks) * block * 2
+        if best is None or size < best[0]:
+            best = (size, shift, stage1, blocks)
+    _, shift, stage1, blocks = best
+
+    out = sys.stdout
+    out.write(
+        """/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// @generated by scripts/generate_unicode_categories_data.py from Unicode
+// %s. Do not edit by hand.
+
+#include <pytorch/tokenizers/unicode_categories.h>
+
+namespace tokenizers {
+namespace unicode {
+namespace data {
+
+"""
+        % unicodedata.unidata_version
+    )
+
+    def write_array(decl, values, per_line):
+        out.write("%s = {\n" % decl)
+        for i in range(0, len(values), per_line):
+            out.write(
+                "    " + ", ".join(str(v) for v in values[i : i + per_line]) + ",\n"
+            )
+        out.write("};\n\n")
+
+    out.write("const uint32_t kCategoryBlockShift = %d;\n\n" % shift)
+    write_array("const uint16_t kCategoryStage1[%d]" % len(stage1), stage1, 16)
+    stage2 = [r for block in blocks for r in block]
+    write_array("const uint16_t kCategoryStage2[%d]" % len(stage2), stage2, 16)
+
+    out.write("const CategoryRecord kCategoryRecords[%d] = {\n" % len(records))
+    for r in records:
+        out.write("    {%s},\n" % ", ".join(str(v) for v in r))
+    out.write("};\n\n")
+
+    names = sorted(script_ids, key=script_ids.get)
+    out.write("const char* const kScriptNames[%d] = {\n" % len(names))
+    for name in names:
+        out.write('    "%s",\n' % name)
+    out.write("};\n\n")
+    out.write("const size_t kNumScripts = %d;\n\n" % len(names))
+
+    out.write(
+        """} // namespace data
+} // namespace unicode
+} // namespace tokenizers
+"""
+    )
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+# Copyright (c) Meta Platforms, Inc. and affiliates.
+# All rights reserved.
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+# @lint-ignore-every LICENSELINT
+
+"""
+Generate src/unicode_general_category_data.cpp from the Python unicodedata
+module.
+
+The table backs the \\p{..} classes of the Pike VM regex engine. Each code point
+maps through a two-stage lookup table to its general category, numbered in the
+order of unicode::GeneralCategory.
+
+Usage:
+    python3 scripts/generate_unicode_general_category_data.py > \\
+        src/unicode_general_category_data.cpp
+"""
+
+import sys
+import unicodedata
+
+MAX_CP = 0x110000
+
+# Must match unicode::GeneralCategory in unicode_categories.h
+CATEGORIES = [
+    "Lu", "Ll", "Lt", "Lm", "Lo",
+    "Mn", "Mc", "Me",
+    "Nd", "Nl", "No",
+    "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po",
+    "Sm", "Sc", "Sk", "So",
+    "Zs", "Zl", "Zp",
+    "Cc", "Cf", "Cs", "Co", "Cn",
+]  # fmt: skip
+
+
+def main():
+    if len(sys.argv) != 1:
+        sys.exit(__doc__)
+
+    category_ids = {name: i for i, name in enumerate(CATEGORIES)}
+    cp_categories = []
+    for cp in range(MAX_CP):
+        if 0xD800 <= cp <= 0xDFFF:
+            category = "Cs"
+        else:
+            category = unicodedata.category(chr(cp))
+        cp_categories.append(category_ids[category])
+
+    # Pick the block size giving the smallest two-stage table
+    best = None
+    for shift in range(5, 10):
+        block = 1 << shift
+        blocks = []
+        block_index = {}
+        stage1 = []
+        for start in range(0, MAX_CP, block):
+            key = tuple(cp_categories[start : start + block])
+            if key not in block_index:
+                block_index[key] = len(blocks)
+                blocks.append(key)
+            stage1.append(block_index[key])
+        size = len(stage1) * 2 + len(blocks) * block
+        if best is None or size < best[0]:
+            best = (size, shift, stage1, blocks)
+    _, shift, stage1, blocks = best
+
+    out = sys.stdout
+    out.write(
+        """/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// @generated by scripts/generate_unicode_general_category_data.py from Unicode
+// %s. Do not edit by hand.
+
+#include <pytorch/tokenizers/unicode_categories.h>
+
+namespace tokenizers {
+namespace unicode {
+namespace data {
+
+"""
+        % unicodedata.unidata_version
+    )
+
+    def write_array(decl, values, per_line):
+        out.write("%s = {\n" % decl)
+        for i in range(0, len(values), per_line):
+            out.write(
+                "    " + ", ".join(str(v) for v in values[i : i + per_line]) + ",\n"
+            )
+        out.write("};\n\n")
+
+    out.write("const uint32_t kGeneralCategoryBlockShift = %d;\n\n" % shift)
+    write_array(
+        "const uint16_t kGeneralCategoryStage1[%d]" % len(stage1), stage1, 16
+    )
+    stage2 = [c for block in blocks for c in block]
+    write_array(
+        "const uint8_t kGeneralCategoryStage2[%d]" % len(stage2), stage2, 16
+    )
+
+    out.write(
+        """} // namespace data
+} // namespace unicode
+} // namespace tokenizers
+"""
+    )
+
+
+if __name__ == "__main__":
+    main()
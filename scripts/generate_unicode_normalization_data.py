@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+# Copyright (c) Meta Platforms, Inc. and affiliates.
+# All rights reserved.
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+# @lint-ignore-every LICENSELINT
+
+"""
+Generate src/unicode_normalization_data.cpp from the Python unicodedata module.
+
+The tables back the Unicode normalizers (NFC, NFD, NFKC, NFKD, Lowercase,
+StripAccents and BertNormalizer). Each code point maps through a two-stage
+lookup table to a property record holding its canonical combining class,
+quick-check flags and offsets of its full decompositions and lowercase mapping
+in a shared code point pool. Hangul syllables are handled algorithmically and
+are not part of the tables.
+
+Usage:
+    python3 scripts/generate_unicode_normalization_data.py > \
+        src/unicode_normalization_data.cpp
+"""
+
+import sys
+import unicodedata
+
+MAX_CP = 0x110000
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+# Must match the flag constants in unicode_normalization.h
+NFD_NO = 1 << 0
+NFKD_NO = 1 << 1
+NFC_NO = 1 << 2
+NFC_MAYBE = 1 << 3
+NFKC_NO = 1 << 4
+NFKC_MAYBE = 1 << 5
+NONSPACING_MARK = 1 << 6
+OTHER = 1 << 7
+
+
+def is_hangul_syllable(cp):
+    return HANGUL_FIRST <= cp <= HANGUL_LAST
+
+
+def is_surrogate(cp):
+    return 0xD800 <= cp <= 0xDFFF
+
+
+def main():
+    pool = []
+    pool_index = {}
+
+    def intern(seq):
+        key = tuple(seq)
+        if key not in pool_index:
+            pool_index[key] = len(pool)
+            pool.extend(seq)
+        return pool_index[key]
+
+    # Primary composites: canonical pairs that NFC recomposes
+    compositions = {}
+    maybe = set()
+    for cp in range(MAX_CP):
+        if is_surrogate(cp) or is_hangul_syllable(cp):
+            continue
+        decomposition = unicodedata.decomposition(chr(cp))
+        if not decomposition or decomposition.startswith("<"):
+            continue
+        parts = [int(p, 16) for p in decomposition.split()]
+        if len(parts) != 2:
+            continue
+        if unicodedata.normalize("NFC", chr(cp)) != chr(cp):
+            continue
+        compositions[(parts[0], parts[1])] = cp
+        maybe.add(parts[1])
+    # Conjoining jamo vowels and trailing consonants compose with a previous
+    # jamo or syllable
+    maybe.update(range(0x1161, 0x1176))
+    maybe.update(range(0x11A8, 0x11C3))
+
+    records = []
+    record_index = {}
+    cp_records = []
+    for cp in range(MAX_CP):
+        if is_surrogate(cp):
+            ch = None
+        else:
+            ch = chr(cp)
+        ccc = 0
+        flags = 0
+        canonical = ()
+        compat = ()
+        lower = ()
+        if ch is None:
+            flags |= OTHER
+        else:
+            category = unicodedata.category(ch)
+            ccc = unicodedata.combining(ch)
+            if category == "Mn":
+                flags |= NONSPACING_MARK
+            if category.startswith("C"):
+                flags |= OTHER
+            if not is_hangul_syllable(cp):
+                nfd = unicodedata.normalize("NFD", ch)
+                nfkd = unicodedata.normalize("NFKD", ch)
+                if nfd != ch:
+                    flags |= NFD_NO
+                    canonical = tuple(ord(c) for c in nfd)
+                if nfkd != ch:
+                    flags |= NFKD_NO
+                    compat = tuple(ord(c) for c in nfkd)
+            if unicodedata.normalize("NFC", ch) != ch:
+                flags |= NFC_NO
+            elif cp in maybe:
+                flags |= NFC_MAYBE
+            if unicodedata.normalize("NFKC", ch) != ch:
+                flags |= NFKC_NO
+            elif cp in maybe:
+                flags |= NFKC_MAYBE
+            lowered = ch.lower()
+            if lowered != ch:
+                lower = tuple(ord(c) for c in lowered)
+
+        canonical_offset = intern(canonical) if canonical else 0
+        compat_offset = intern(compat) if compat else 0
+        lower_offset = intern(lower) if lower else 0
+        record = (
+            ccc,
+            flags,
+            len(canonical),
+            len(compat),
+            len(lower),
+            canonical_offset,
+            compat_offset,
+            lower_offset,
+        )
+        if record not in record_index:
+            record_index[record] = len(records)
+            records.append(record)
+        cp_records.append(record_index[record])
+
+    assert len(pool) < 1 << 16, len(pool)
+    assert len(records) < 1 << 16, len(records)
+
+    # Pick the block size giving the smallest two-stage table
+    best = None
+    for shift in range(5, 10):
+        block = 1 << shift
+        blocks = []
+        block_index = {}
+        stage1 = []
+        for start in range(0, MAX_CP, block):
+            key = tuple(cp_records[start : start + block])
+            if key not in block_index:
+                block_index[key] = len(blocks)
+                blocks.append(key)
+            stage1.append(block_index[key])
+        size = len(stage1) * 2 + len(blocks) * block * 2
+        if best is None or size < best[0]:
+            best = (size, shift, stage1, blocks)
+    _, shift, stage1, blocks = best
+
+    out = sys.stdout
+    out.write(
+        """/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// @generated by scripts/generate_unicode_normalization_data.py from Unicode
+// %s. Do not edit by hand.
+
+#include <pytorch/tokenizers/unicode_normalization.h>
+
+namespace tokenizers {
+namespace unicode {
+namespace data {
+
+"""
+        % unicodedata.unidata_version
+    )
+
+    def write_array(decl, values, per_line):
+        out.write("%s = {\n" % decl)
+        for i in range(0, len(values), per_line):
+            out.write(
+                "    " + ", ".join(str(v) for v in values[i : i + per_line]) + ",\n"
+            )
+        out.write("};\n\n")
+
+    out.write("const uint32_t kBlockShift = %d;\n\n" % shift)
+    write_array(
+        "const uint16_t kStage1[%d]" % len(stage1), stage1, 16
+    )
+    stage2 = [r for block in blocks for r in block]
+    write_array("const uint16_t kStage2[%d]" % len(stage2), stage2, 16)
+
+    out.write("const CodepointRecord kRecords[%d] = {\n" % len(records))
+    for r in records:
+        out.write("    {%s},\n" % ", ".join(str(v) for v in r))
+    out.write("};\n\n")
+
+    write_array("const uint32_t kPool[%d]" % max(1, len(pool)), pool or [0], 12)
+
+    pairs = sorted(compositions.items())
+    out.write("const CompositionPair kCompositions[%d] = {\n" % len(pairs))
+    for (first, second), composite in pairs:
+        out.write("    {0x%04X, 0x%04X, 0x%04X},\n" % (first, second, composite))
+    out.write("};\n\n")
+    out.write("const size_t kNumCompositions = %d;\n\n" % len(pairs))
+
+    out.write(
+        """} // namespace data
+} // namespace unicode
+} // namespace tokenizers
+"""
+    )
+
+
+if __name__ == "__main__":
+    main()
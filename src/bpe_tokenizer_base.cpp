@@ -11,8 +11,13 @@
 
 // Standard
 #include <inttypes.h>
+#include <algorithm>
 #include <functional>
 
+// Local
+#include <pytorch/tokenizers/unicode_normalization.h>
+#include <pytorch/tokenizers/work_counters.h>
+
 namespace tokenizers {
 namespace detail {
 
@@ -23,6 +28,73 @@ static uint64_t _max_size() {
   return std::numeric_limits<uint64_t>::max();
 }
 
+// A piece whose merge loop is advanced by encode_pieces_
+struct MergeState {
+  std::string_view piece;
+  // Whole-piece token, if the piece is one
+  std::optional<uint64_t> token;
+  // Vector of (start, rank) as in _byte_pair_merge
+  std::vector<std::pair<uint64_t, uint64_t>> parts;
+  bool active = false;
+  // Tokens of a piece found in the closed-form tables
+  bool is_closed_form = false;
+  std::vector<uint64_t> closed_form;
+};
+
+// Token map lookups collected from several pieces and issued together
+class LookupBatch {
+ public:
+  void clear() {
+    keys_.clear();
+    targets_.clear();
+  }
+
+  bool empty() const {
+    return keys_.empty();
+  }
+
+  void add(std::string_view key, size_t state, size_t part) {
+    keys_.push_back(key);
+    targets_.emplace_back(state, part);
+  }
+
+  // Queue the lookup of the rank of the pair starting at parts[part], or mark
+  // it as unmergeable if it is the last part
+  void add_rank(MergeState& state, size_t state_index, size_t part) {
+    auto& parts = state.parts;
+    if (part + 2 < parts.size()) {
+      const auto start = parts[part].first;
+      add(state.piece.substr(start, parts[part + 2].first - start),
+          state_index,
+          part);
+    } else {
+      parts[part].second = _max_size();
+    }
+  }
+
+  void run(const TokenMap& map) {
+    results_.resize(keys_.size());
+    map.tryGetIntegers(keys_.data(), keys_.size(), results_.data());
+  }
+
+  size_t size() const {
+    return keys_.size();
+  }
+
+  const std::pair<size_t, size_t>& target(size_t i) const {
+    return targets_[i];
+  }
+
+  const std::optional<uint64_t>& result(size_t i) const {
+    return results_[i];
+  }
+
+ private:
+  std::vector<std::string_view> keys_;
+  std::vector<std::pair<size_t, size_t>> targets_;
+  std::vector<std::optional<uint64_t>> results_;
+};
+
 } // namespace
 
 // ---- Helper utils end -------------------------------------------------------
@@ -49,6 +121,7 @@ std::vector<uint64_t> BPETokenizerBase::_byte_pair_merge(
       auto s = parts[start_idx].first;
       auto e = parts[start_idx + skip + 2].first;
       auto key = piece.substr(s, e - s);
+      TK_COUNT_WORK(bytes_copied, key.size());
       return ranks.tryGetInteger(key);
     }
     return std::nullopt;
@@ -81,6 +154,7 @@ std::vector<uint64_t> BPETokenizerBase::_byte_pair_merge(
     if (parts.size() == 1) {
       break;
     }
+    TK_COUNT_WORK(merge_steps, parts.size());
 
     // usize::MAX is a sentinel rank value allowing us to
     // take the min more quickly
@@ -131,56 +205,59 @@ std::vector<uint64_t> BPETokenizerBase::_byte_pair_merge(
   return out;
 }
 
-std::pair<std::optional<std::string>, std::string>
-BPETokenizerBase::split_with_allowed_special_token_(
-    const std::string& input,
-    size_t offset,
+std::vector<Match> BPETokenizerBase::find_allowed_special_tokens_(
+    std::string_view input,
     const TokenMap& allowed_special) const {
   if (!special_token_regex_) {
-    return std::make_pair(std::nullopt, input.substr(offset));
-  }
-
-  auto matches = special_token_regex_->find_all(input.substr(offset));
-
-  for (const auto& m : matches) {
-    std::string matched_text = input.substr(offset + m.start, m.end - m.start);
-    if (allowed_special.tryGetInteger(matched_text).has_value()) {
-      return {matched_text, input.substr(offset, m.start)};
-    }
+    return {};
   }
-
-  return {std::nullopt, input.substr(offset)};
+  // One search over the whole input: searching again from each special
+  // token would make the cost quadratic in the number of special tokens
+  TK_COUNT_WORK(regex_steps, input.size());
+  auto matches = special_token_regex_->find_all(input);
+  matches.erase(
+      std::remove_if(
+          matches.begin(),
+          matches.end(),
+          [&](const Match& m) {
+            return !allowed_special
+                        .tryGetInteger(input.substr(m.start, m.end - m.start))
+                        .has_value();
+          }),
+      matches.end());
+  return matches;
 }
 
 Result<std::pair<std::vector<uint64_t>, uint64_t>>
 BPETokenizerBase::encode_with_special_token_(
-    const std::string& text,
+    std::string_view text,
     const TokenMap& allowed_special) const {
   std::vector<uint64_t> tokens;
   uint64_t last_piece_token_len = 0;
   size_t offset = 0;
 
-  while (offset < text.size()) {
-    auto [special, sub_input] =
-        split_with_allowed_special_token_(text, offset, allowed_special);
-
-    TK_CHECK_OK_OR_RETURN_ERROR(
-        _encode(sub_input, tokens, last_piece_token_len));
-    offset += sub_input.size();
-
-    if (special) {
-      const auto result = special_token_map_->tryGetInteger(*special);
-      if (!result) {
-        TK_LOG(Error, "unknown special token: %s\n", special->c_str());
-        return Error::EncodeFailure;
-      }
+  for (const auto& m : find_allowed_special_tokens_(text, allowed_special)) {
+    TK_CHECK_OK_OR_RETURN_ERROR(_encode(
+        text.substr(offset, m.start - offset), tokens, last_piece_token_len));
 
-      tokens.push_back(*result);
-      last_piece_token_len = 0;
-      offset += special->size(); // advance past the matched token
-    } else {
-      break;
+    const auto special = text.substr(m.start, m.end - m.start);
+    const auto result = special_token_map_->tryGetInteger(special);
+    if (!result) {
+      TK_LOG(
+          Error,
+          "unknown special token: %.*s\n",
+          static_cast<int>(special.size()),
+          special.data());
+      return Error::EncodeFailure;
     }
+
+    tokens.push_back(*result);
+    last_piece_token_len = 0;
+    offset = m.end; // advance past the matched token
+  }
+  if (offset < text.size()) {
+    TK_CHECK_OK_OR_RETURN_ERROR(
+        _encode(text.substr(offset), tokens, last_piece_token_len));
   }
 
   return std::make_pair(tokens, last_piece_token_len);
@@ -213,6 +290,306 @@ Result<std::vector<uint64_t>> BPETokenizerBase::byte_pair_encode_(
       });
 }
 
+Error BPETokenizerBase::encode_pieces_(
+    std::string_view text,
+    const std::vector<Match>& pieces,
+    std::vector<uint64_t>& ret,
+    uint64_t& last_piece_token_len) const {
+  if (!piece_cache_) {
+    return merge_pieces_(text, pieces, ret, last_piece_token_len, nullptr);
+  }
+
+  // Resolve the pieces that are tabulated, a token or cached, and merge the
+  // others together. resolved[i] is the end of the tokens of piece i in
+  // `found`, or npos if it is merged.
+  constexpr size_t npos = std::numeric_limits<size_t>::max();
+  std::vector<uint64_t> found;
+  std::vector<size_t> resolved(pieces.size(), npos);
+  std::vector<Match> missed;
+  for (size_t i = 0; i < pieces.size(); ++i) {
+    const auto& match = pieces[i];
+    const auto piece = text.substr(match.start, match.end - match.start);
+    if (!closed_form_pieces_.lookup(piece, found)) {
+      const auto token = token_map_->tryGetInteger(piece);
+      if (token) {
+        found.push_back(*token);
+      } else if (!piece_cache_->lookup(model_fingerprint_, piece, found)) {
+        missed.push_back(match);
+        continue;
+      }
+    }
+    resolved[i] = found.size();
+  }
+
+  std::vector<uint64_t> merged;
+  std::vector<size_t> merged_ends;
+  if (!missed.empty()) {
+    uint64_t unused_len = 0;
+    TK_CHECK_OK_OR_RETURN_ERROR(
+        merge_pieces_(text, missed, merged, unused_len, &merged_ends));
+  }
+
+  size_t found_begin = 0;
+  size_t merged_begin = 0;
+  size_t missed_index = 0;
+  for (size_t i = 0; i < pieces.size(); ++i) {
+    if (resolved[i] != npos) {
+      ret.insert(
+          ret.end(), found.begin() + found_begin, found.begin() + resolved[i]);
+      last_piece_token_len = resolved[i] - found_begin;
+      found_begin = resolved[i];
+      continue;
+    }
+    const auto& match = missed[missed_index];
+    const size_t merged_end = merged_ends[missed_index++];
+    piece_cache_->insert(
+        model_fingerprint_,
+        text.substr(match.start, match.end - match.start),
+        merged.data() + merged_begin,
+        merged_end - merged_begin);
+    ret.insert(
+        ret.end(), merged.begin() + merged_begin, merged.begin() + merged_end);
+    last_piece_token_len = merged_end - merged_begin;
+    merged_begin = merged_end;
+  }
+  return Error::Ok;
+}
+
+Error BPETokenizerBase::merge_pieces_(
+    std::string_view text,
+    const std::vector<Match>& pieces,
+    std::vector<uint64_t>& ret,
+    uint64_t& last_piece_token_len,
+    std::vector<size_t>* piece_ends) const {
+  if (merge_batch_size_ <= 1) {
+    for (const auto& match : pieces) {
+      const auto view = text.substr(match.start, match.end - match.start);
+      const size_t ret_size = ret.size();
+      if (closed_form_pieces_.lookup(view, ret)) {
+        last_piece_token_len = ret.size() - ret_size;
+        if (piece_ends) {
+          piece_ends->push_back(ret.size());
+        }
+        continue;
+      }
+      const std::string piece(view);
+      const auto result = token_map_->tryGetInteger(piece);
+      if (result) {
+        last_piece_token_len = 1;
+        ret.push_back(*result);
+      } else {
+        auto tokens_result = byte_pair_encode_(piece, *token_map_);
+        if (!tokens_result.ok()) {
+          return tokens_result.error();
+        }
+        auto tokens = std::move(*tokens_result);
+        last_piece_token_len = tokens.size();
+        ret.insert(ret.end(), tokens.begin(), tokens.end());
+      }
+      if (piece_ends) {
+        piece_ends->push_back(ret.size());
+      }
+    }
+    return Error::Ok;
+  }
+
+  // Batched engine. This runs the same merge loop as _byte_pair_merge for up
+  // to merge_batch_size_ pieces at a time: every round, each piece performs
+  // its next merge and queues the rank lookups it needs, and the lookups of
+  // all pieces then go to the token map as one batch.
+  const TokenMap& token_map = *token_map_;
+  std::vector<MergeState> states(merge_batch_size_);
+  LookupBatch batch;
+
+  for (size_t begin = 0; begin < pieces.size(); begin += merge_batch_size_) {
+    const size_t count = std::min(merge_batch_size_, pieces.size() - begin);
+
+    // Pieces that are tabulated or a token skip merging
+    batch.clear();
+    for (size_t i = 0; i < count; ++i) {
+      const auto& match = pieces[begin + i];
+      auto& state = states[i];
+      state.piece = text.substr(match.start, match.end - match.start);
+      state.token.reset();
+      state.closed_form.clear();
+      state.is_closed_form =
+          closed_form_pieces_.lookup(state.piece, state.closed_form);
+      if (!state.is_closed_form) {
+        batch.add(state.piece, i, 0);
+      }
+    }
+    batch.run(token_map);
+    for (size_t k = 0; k < batch.size(); ++k) {
+      states[batch.target(k).first].token = batch.result(k);
+    }
+
+    // Look up the ranks of all byte pairs once in the beginning
+    for (size_t i = 0; i < count; ++i) {
+      auto& state = states[i];
+      state.parts.clear();
+      state.active =
+          !state.is_closed_form && !state.token && state.piece.size() > 1;
+    }
+    batch.clear();
+    for (size_t i = 0; i < count; ++i) {
+      auto& state = states[i];
+      if (!state.active) {
+        continue;
+      }
+      for (size_t idx = 0; idx < state.piece.size() + 1; ++idx) {
+        state.parts.emplace_back(idx, _max_size());
+      }
+      for (size_t j = 0; j < state.parts.size() - 2; ++j) {
+        batch.add_rank(state, i, j);
+      }
+    }
+    batch.run(token_map);
+    for (size_t k = 0; k < batch.size(); ++k) {
+      const auto& [i, j] = batch.target(k);
+      const auto& rank = batch.result(k);
+      if (rank) {
+        // usize::MAX is a sentinel value and cannot be a valid rank
+        if (*rank == _max_size()) {
+          TK_LOG(Error, "at %zu rank is too large\n", j);
+        }
+        states[i].parts[j].second = *rank;
+      }
+    }
+
+    // Merge rounds
+    bool any_active = true;
+    while (any_active) {
+      any_active = false;
+      batch.clear();
+      for (size_t i = 0; i < count; ++i) {
+        auto& state = states[i];
+        if (!state.active) {
+          continue;
+        }
+        auto& parts = state.parts;
+        TK_COUNT_WORK(merge_steps, parts.size());
+        auto min_rank = std::make_pair<uint64_t, uint64_t>(_max_size(), 0);
+        for (size_t j = 0; j + 1 < parts.size(); ++j) {
+          if (parts[j].second < min_rank.first) {
+            min_rank.first = parts[j].second;
+            min_rank.second = j;
+          }
+        }
+        if (min_rank.first == _max_size()) {
+          state.active = false;
+          continue;
+        }
+        any_active = true;
+
+        // Removing parts[i + 1] first means the new ranks of parts[i] and
+        // parts[i - 1] are plain pair lookups, the same keys as get_rank with
+        // skip = 1 in _byte_pair_merge.
+        const size_t j = min_rank.second;
+        parts.erase(parts.begin() + (j + 1));
+        batch.add_rank(state, i, j);
+        if (j > 0) {
+          batch.add_rank(state, i, j - 1);
+        }
+      }
+      if (batch.empty()) {
+        continue;
+      }
+      batch.run(token_map);
+      for (size_t k = 0; k < batch.size(); ++k) {
+        const auto& [i, j] = batch.target(k);
+        const auto& rank = batch.result(k);
+        states[i].parts[j].second = rank ? *rank : _max_size();
+      }
+    }
+
+    // Map the merged parts to tokens
+    batch.clear();
+    for (size_t i = 0; i < count; ++i) {
+      auto& state = states[i];
+      if (state.is_closed_form || state.token || state.piece.size() <= 1) {
+        continue;
+      }
+      const auto& parts = state.parts;
+      for (size_t j = 0; j + 1 < parts.size(); ++j) {
+        batch.add(
+            state.piece.substr(
+                parts[j].first, parts[j + 1].first - parts[j].first),
+            i,
+            j);
+      }
+    }
+    batch.run(token_map);
+
+    size_t k = 0;
+    for (size_t i = 0; i < count; ++i) {
+      const auto& state = states[i];
+      if (state.is_closed_form) {
+        last_piece_token_len = state.closed_form.size();
+        ret.insert(
+            ret.end(), state.closed_form.begin(), state.closed_form.end());
+        if (piece_ends) {
+          piece_ends->push_back(ret.size());
+        }
+        continue;
+      }
+      if (state.token) {
+        last_piece_token_len = 1;
+        ret.push_back(*state.token);
+        if (piece_ends) {
+          piece_ends->push_back(ret.size());
+        }
+        continue;
+      }
+      if (state.piece.size() == 1) {
+        TK_LOG(Error, "unknown token: '%s'", std::string(state.piece).c_str());
+        return Error::EncodeFailure;
+      }
+      const size_t num_tokens =
+          state.parts.empty() ? 0 : state.parts.size() - 1;
+      for (size_t j = 0; j < num_tokens; ++j, ++k) {
+        const auto& token = batch.result(k);
+        if (token) {
+          ret.push_back(*token);
+        } else {
+          TK_LOG(
+              Error,
+              "BPE merge produced unknown token: '%s'",
+              std::string(
+                  state.piece.substr(
+                      state.parts[j].first,
+                      state.parts[j + 1].first - state.parts[j].first))
+                  .c_str());
+          ret.push_back(0);
+        }
+      }
+      last_piece_token_len = num_tokens;
+      if (piece_ends) {
+        piece_ends->push_back(ret.size());
+      }
+    }
+  }
+  return Error::Ok;
+}
+
+Error BPETokenizerBase::build_closed_form_pieces_() {
+  closed_form_pieces_.clear();
+  if (!use_closed_form_pieces_ || mode_ == TokenizerMode::DecodeOnly) {
+    return Error::Ok;
+  }
+  // The same tokens as merge_pieces_ gives the piece
+  return closed_form_pieces_.build(
+      [this](std::string_view piece) {
+        return token_map_->tryGetInteger(piece);
+      },
+      [this](std::string_view piece) -> Result<std::vector<uint64_t>> {
+        const auto token = token_map_->tryGetInteger(piece);
+        if (token) {
+          return std::vector<uint64_t>{*token};
+        }
+        return byte_pair_encode_(std::string(piece), *token_map_);
+      });
+}
+
 // ---- protected end ----------------------------------------------------------
 // ---- public start -----------------------------------------------------------
 
@@ -220,9 +597,20 @@ Result<std::vector<uint64_t>> BPETokenizerBase::encode(
     const std::string& text,
     int8_t bos,
     int8_t eos) const {
+  return encode_view(text, bos, eos);
+}
+
+Result<std::vector<uint64_t>> BPETokenizerBase::encode_view(
+    std::string_view text,
+    int8_t bos,
+    int8_t eos) const {
   if (!initialized_) {
     return Error::Uninitialized;
   }
+  TK_CHECK_OR_RETURN_ERROR(
+      mode_ != TokenizerMode::DecodeOnly,
+      Unsupported,
+      "encode is not available in a tokenizer loaded as DecodeOnly");
   auto encode_result = encode_with_special_token_(text, *special_token_map_);
   if (!encode_result.ok()) {
     return encode_result.error();
@@ -237,12 +625,148 @@ Result<std::vector<uint64_t>> BPETokenizerBase::encode(
   return Result<std::vector<uint64_t>>(std::move(res));
 }
 
+Result<std::vector<uint64_t>> BPETokenizerBase::encode_with_offsets(
+    const std::string& input,
+    std::vector<size_t>& token_ends) const {
+  TK_CHECK_OR_RETURN_ERROR(
+      mode_ == TokenizerMode::EncodeDecode,
+      Unsupported,
+      "encode_with_offsets needs a tokenizer loaded as EncodeDecode");
+  auto tokens = encode(input, 0, 0);
+  if (!tokens.ok()) {
+    return tokens.error();
+  }
+  token_ends.clear();
+  token_ends.reserve(tokens->size());
+  size_t offset = 0;
+  for (const uint64_t token : *tokens) {
+    auto bytes = token_map_->tryGetString(token);
+    if (!bytes) {
+      bytes = special_token_map_->tryGetString(token);
+    }
+    TK_CHECK_OR_RETURN_ERROR(
+        bytes && input.compare(offset, bytes->size(), *bytes) == 0,
+        EncodeFailure,
+        "token %" PRIu64 " does not match the input at offset %zu",
+        token,
+        offset);
+    offset += bytes->size();
+    token_ends.push_back(offset);
+  }
+  TK_CHECK_OR_RETURN_ERROR(
+      offset == input.size(),
+      EncodeFailure,
+      "tokens cover %zu of %zu input bytes",
+      offset,
+      input.size());
+  return tokens;
+}
+
+Result<std::vector<uint64_t>> BPETokenizerBase::encode_utf16(
+    std::u16string_view input,
+    int8_t bos,
+    int8_t eos) const {
+  std::string utf8;
+  unicode::append_utf16_as_utf8(input, utf8);
+  return encode(utf8, bos, eos);
+}
+
+Result<std::vector<uint64_t>> BPETokenizerBase::encode_utf16_with_offsets(
+    std::u16string_view input,
+    std::vector<size_t>& token_ends) const {
+  std::string utf8;
+  unicode::append_utf16_as_utf8(input, utf8);
+  auto tokens = encode_with_offsets(utf8, token_ends);
+  if (!tokens.ok()) {
+    return tokens.error();
+  }
+  // Token ends only grow, so the byte offsets are converted in one pass
+  size_t byte_offset = 0;
+  size_t unit_offset = 0;
+  for (auto& end : token_ends) {
+    unit_offset +=
+        unicode::utf16_length(utf8.data() + byte_offset, end - byte_offset);
+    byte_offset = end;
+    end = unit_offset;
+  }
+  return tokens;
+}
+
+Error BPETokenizerBase::visit_pieces(
+    const std::string& input,
+    const PieceVisitor& visitor) const {
+  if (!initialized_) {
+    return Error::Uninitialized;
+  }
+  TK_CHECK_OR_RETURN_ERROR(
+      mode_ != TokenizerMode::DecodeOnly,
+      Unsupported,
+      "visit_pieces is not available in a tokenizer loaded as DecodeOnly");
+  std::vector<std::string> pieces;
+  std::vector<uint64_t> tokens;
+  const auto visit_text = [&](std::string_view text) -> Error {
+    pieces.clear();
+    TK_CHECK_OK_OR_RETURN_ERROR(_pre_tokenize(text, pieces));
+    for (const auto& piece : pieces) {
+      tokens.clear();
+      const auto token = token_map_->tryGetInteger(piece);
+      if (token) {
+        tokens.push_back(*token);
+      } else {
+        auto result = byte_pair_encode_(piece, *token_map_);
+        if (!result.ok()) {
+          return result.error();
+        }
+        tokens = std::move(*result);
+      }
+      visitor(piece, tokens, false);
+    }
+    return Error::Ok;
+  };
+
+  const std::string_view text = input;
+  size_t offset = 0;
+  for (const auto& m :
+       find_allowed_special_tokens_(text, *special_token_map_)) {
+    TK_CHECK_OK_OR_RETURN_ERROR(
+        visit_text(text.substr(offset, m.start - offset)));
+    const auto special = text.substr(m.start, m.end - m.start);
+    const auto result = special_token_map_->tryGetInteger(special);
+    TK_CHECK_OR_RETURN_ERROR(
+        result,
+        EncodeFailure,
+        "unknown special token: %.*s",
+        static_cast<int>(special.size()),
+        special.data());
+    tokens.assign(1, *result);
+    visitor(special, tokens, true);
+    offset = m.end;
+  }
+  if (offset < text.size()) {
+    TK_CHECK_OK_OR_RETURN_ERROR(visit_text(text.substr(offset)));
+  }
+  return Error::Ok;
+}
+
+Error BPETokenizerBase::_pre_tokenize(
+    std::string_view input,
+    std::vector<std::string>& pieces) const {
+  (void)input;
+  (void)pieces;
+  TK_LOG(Error, "this tokenizer does not report its pieces");
+  return Error::EncodeFailure;
+}
+
 Result<std::string> BPETokenizerBase::decode(uint64_t prev, uint64_t cur)
     const {
   (void)prev;
   if (!initialized_) {
     return Error::Uninitialized;
   }
+  TK_CHECK_OR_RETURN_ERROR(
+      mode_ != TokenizerMode::EncodeOnly,
+      Unsupported,
+      "decode is not available in a tokenizer loaded as EncodeOnly");
   std::string ret;
 
   std::string_view token_bytes;
@@ -258,11 +782,64 @@ Result<std::string> BPETokenizerBase::decode(uint64_t prev, uint64_t cur)
   } else {
     token_bytes = *result;
   }
+  TK_COUNT_WORK(bytes_copied, token_bytes.size());
   _decode(std::string(token_bytes), ret);
 
   return ret;
 }
 
+Error BPETokenizerBase::set_piece_cache(std::shared_ptr<PieceCache> cache) {
+  if (!cache) {
+    piece_cache_.reset();
+    return Error::Ok;
+  }
+  if (!initialized_) {
+    return Error::Uninitialized;
+  }
+  TK_CHECK_OR_RETURN_ERROR(
+      mode_ != TokenizerMode::DecodeOnly,
+      Unsupported,
+      "a piece cache is not used by a tokenizer loaded as DecodeOnly");
+  // Fingerprint of the vocabulary: FNV-1a over every (token, rank). The
+  // elements are visited in the same order whatever the map direction.
+  uint64_t fingerprint = 0xcbf29ce484222325ULL;
+  const auto add = [&fingerprint](uint64_t value) {
+    fingerprint = (fingerprint ^ value) * 0x100000001b3ULL;
+  };
+  token_map_->forEachElement([&add](std::string_view token, uint64_t rank) {
+    add(token.size());
+    for (const char c : token) {
+      add(static_cast<uint8_t>(c));
+    }
+    add(rank);
+  });
+  model_fingerprint_ = fingerprint;
+  piece_cache_ = std::move(cache);
+  return Error::Ok;
+}
+
+RegexStats BPETokenizerBase::regex_stats() const {
+  RegexStats stats;
+  if (special_token_regex_) {
+    stats += special_token_regex_->stats();
+  }
+  return stats;
+}
+
+std::vector<MemoryRegion> BPETokenizerBase::memory_regions() const {
+  std::vector<MemoryRegion> regions;
+  const auto add = [&regions](const void* data, size_t size) {
+    regions.push_back({data, size});
+  };
+  if (token_map_) {
+    token_map_->forEachBuffer(add);
+  }
+  if (special_token_map_) {
+    special_token_map_->forEachBuffer(add);
+  }
+  return regions;
+}
+
 // ---- public end -------------------------------------------------------------
 
 } // namespace detail
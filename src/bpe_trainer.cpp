@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/bpe_trainer.h>
+
+// Standard
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <unordered_set>
+
+// Local
+#include <pytorch/tokenizers/base64.h>
+#include <pytorch/tokenizers/log.h>
+#include <unicode.h>
+
+using json = nlohmann::json;
+
+namespace tokenizers {
+
+namespace {
+
+constexpr uint32_t kNumBytes = 256;
+
+inline uint64_t pack(uint32_t left, uint32_t right) {
+  return static_cast<uint64_t>(left) << 32 | right;
+}
+
+struct Word {
+  std::vector<uint32_t> symbols;
+  uint64_t count;
+};
+
+struct HeapEntry {
+  uint64_t count;
+  uint64_t pair;
+};
+
+// Most frequent pair first, ties go to the lowest pair of ids
+struct HeapOrder {
+  bool operator()(const HeapEntry& a, const HeapEntry& b) const {
+    return a.count != b.count ? a.count < b.count : a.pair > b.pair;
+  }
+};
+
+using PairCounts = std::unordered_map<uint64_t, int64_t>;
+using PairWords = std::unordered_map<uint64_t, std::vector<uint32_t>>;
+
+// Replace each (left, right) in the word with merged, reporting the changes
+// to the counts of neighbouring pairs
+template <typename F>
+void merge_word(
+    Word& word,
+    uint32_t left,
+    uint32_t right,
+    uint32_t merged,
+    F&& change) {
+  auto& symbols = word.symbols;
+  const int64_t count = static_cast<int64_t>(word.count);
+  size_t out = 0;
+  for (size_t i = 0; i < symbols.size();) {
+    if (i + 1 < symbols.size() && symbols[i] == left &&
+        symbols[i + 1] == right) {
+      // symbols[out - 1] may be the result of the previous merge
+      if (out > 0) {
+        change(pack(symbols[out - 1], left), -count);
+        change(pack(symbols[out - 1], merged), count);
+      }
+      if (i + 2 < symbols.size()) {
+        change(pack(right, symbols[i + 2]), -count);
+        change(pack(merged, symbols[i + 2]), count);
+      }
+      symbols[out++] = merged;
+      i += 2;
+    } else {
+      symbols[out++] = symbols[i++];
+    }
+  }
+  symbols.resize(out);
+}
+
+std::string byte_level(const std::string& token) {
+  std::string result;
+  for (const char c : token) {
+    result += unicode_byte_to_utf8(static_cast<uint8_t>(c));
+  }
+  return result;
+}
+
+} // namespace
+
+// Construction ////////////////////////////////////////////////////////////////
+
+BPETrainer::BPETrainer(PreTokenizer::Ptr pre_tokenizer, BPETrainerConfig config)
+    : pre_tokenizer_(std::move(pre_tokenizer)), config_(std::move(config)) {
+  shards_.resize(std::max<size_t>(1, config_.num_shards));
+  for (auto& shard : shards_) {
+    shard = std::make_unique<Shard>();
+  }
+}
+
+std::shared_ptr<Executor> BPETrainer::executor() const {
+  return config_.executor ? config_.executor : default_executor();
+}
+
+size_t BPETrainer::num_parts(const Executor& executor) const {
+  return config_.num_threads > 0 ? config_.num_threads
+                                 : executor.concurrency();
+}
+
+// Word counting ///////////////////////////////////////////////////////////////
+
+void BPETrainer::merge_counts(
+    std::unordered_map<std::string, uint64_t>& counts) {
+  // Group by shard first so that every lock is taken once
+  std::vector<std::vector<std::pair<const std::string, uint64_t>*>> by_shard(
+      shards_.size());
+  const std::hash<std::string> hash;
+  for (auto& entry : counts) {
+    by_shard[hash(entry.first) % shards_.size()].push_back(&entry);
+  }
+  for (size_t i = 0; i < shards_.size(); ++i) {
+    if (by_shard[i].empty()) {
+      continue;
+    }
+    Shard& shard = *shards_[i];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (auto* entry : by_shard[i]) {
+      shard.counts[entry->first] += entry->second;
+    }
+  }
+}
+
+Error BPETrainer::feed(const std::vector<std::string>& texts) {
+  TK_CHECK_OR_RETURN_ERROR(
+      pre_tokenizer_ != nullptr, Uninitialized, "No pre-tokenizer");
+  const auto count_words = [&](size_t, size_t begin, size_t end) {
+    std::unordered_map<std::string, uint64_t> counts;
+    std::vector<Match> pieces;
+    for (size_t i = begin; i < end; ++i) {
+      const std::string& text = texts[i];
+      pieces.clear();
+      if (pre_tokenizer_->supports_offsets()) {
+        pre_tokenizer_->pre_tokenize_offsets(text, pieces);
+        for (const auto& piece : pieces) {
+          if (piece.end > piece.start) {
+            ++counts[text.substr(piece.start, piece.end - piece.start)];
+          }
+        }
+      } else {
+        for (auto& word : pre_tokenizer_->pre_tokenize(text)) {
+          if (!word.empty()) {
+            ++counts[std::move(word)];
+          }
+        }
+      }
+    }
+    merge_counts(counts);
+  };
+  const auto executor = this->executor();
+  parallel_for_parts(
+      *executor, texts.size(), num_parts(*executor), count_words);
+  return Error::Ok;
+}
+
+void BPETrainer::add_word(const std::string& word, uint64_t count) {
+  if (word.empty() || count == 0) {
+    return;
+  }
+  Shard& shard = *shards_[std::hash<std::string>{}(word) % shards_.size()];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.counts[word] += count;
+}
+
+size_t BPETrainer::num_words() const {
+  size_t total = 0;
+  for (const auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    total += shard->counts.size();
+  }
+  return total;
+}
+
+// Training ////////////////////////////////////////////////////////////////////
+
+Error BPETrainer::train() {
+  TK_CHECK_OR_RETURN_ERROR(
+      config_.vocab_size >= kNumBytes,
+      OutOfRange,
+      "vocab_size must be at least %u, got %zu",
+      kNumBytes,
+      config_.vocab_size);
+
+  std::vector<Word> words;
+  for (const auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    for (const auto& [text, count] : shard->counts) {
+      Word word{{}, count};
+      word.symbols.reserve(text.size());
+      for (const char c : text) {
+        word.symbols.push_back(static_cast<uint8_t>(c));
+      }
+      words.push_back(std::move(word));
+    }
+  }
+
+  vocab_.clear();
+  merges_.clear();
+  std::unordered_map<std::string, uint32_t> token_ids;
+  for (uint32_t i = 0; i < kNumBytes; ++i) {
+    vocab_.emplace_back(1, static_cast<char>(i));
+    token_ids.emplace(vocab_.back(), i);
+  }
+
+  // Initial pair counts, and the words each pair occurs in
+  const auto executor = this->executor();
+  const size_t parts = num_parts(*executor);
+  std::vector<PairCounts> local_counts(parts);
+  std::vector<PairWords> local_words(parts);
+  const auto count_pairs = [&](size_t t, size_t begin, size_t end) {
+    for (size_t w = begin; w < end; ++w) {
+      const auto& symbols = words[w].symbols;
+      for (size_t i = 0; i + 1 < symbols.size(); ++i) {
+        const uint64_t pair = pack(symbols[i], symbols[i + 1]);
+        local_counts[t][pair] += static_cast<int64_t>(words[w].count);
+        auto& where = local_words[t][pair];
+        if (where.empty() || where.back() != w) {
+          where.push_back(static_cast<uint32_t>(w));
+        }
+      }
+    }
+  };
+  parallel_for_parts(*executor, words.size(), parts, count_pairs);
+  PairCounts pair_counts = std::move(local_counts[0]);
+  PairWords pair_words = std::move(local_words[0]);
+  for (size_t t = 1; t < parts; ++t) {
+    for (const auto& [pair, count] : local_counts[t]) {
+      pair_counts[pair] += count;
+    }
+    for (auto& [pair, where] : local_words[t]) {
+      auto& all = pair_words[pair];
+      all.insert(all.end(), where.begin(), where.end());
+    }
+  }
+
+  std::priority_queue<HeapEntry, std::vector<HeapEntry>, HeapOrder> heap;
+  for (const auto& [pair, count] : pair_counts) {
+    heap.push({static_cast<uint64_t>(count), pair});
+  }
+
+  std::unordered_set<uint64_t> touched;
+  while (vocab_.size() < config_.vocab_size && !heap.empty()) {
+    const HeapEntry top = heap.top();
+    heap.pop();
+    // Entries are not updated in place: skip the outdated ones
+    const auto it = pair_counts.find(top.pair);
+    if (it == pair_counts.end() ||
+        static_cast<uint64_t>(it->second) != top.count) {
+      continue;
+    }
+    if (top.count < config_.min_frequency) {
+      break;
+    }
+
+    const auto left = static_cast<uint32_t>(top.pair >> 32);
+    const auto right = static_cast<uint32_t>(top.pair);
+    std::string bytes = vocab_[left] + vocab_[right];
+    // Different pairs can spell the same bytes, keep a single token for them
+    uint32_t merged;
+    const auto existing = token_ids.find(bytes);
+    if (existing != token_ids.end()) {
+      merged = existing->second;
+    } else {
+      merged = static_cast<uint32_t>(vocab_.size());
+      token_ids.emplace(bytes, merged);
+      vocab_.push_back(std::move(bytes));
+    }
+    merges_.emplace_back(left, right);
+
+    std::vector<uint32_t> where = std::move(pair_words[top.pair]);
+    pair_words.erase(top.pair);
+    pair_counts.erase(it);
+    std::sort(where.begin(), where.end());
+    where.erase(std::unique(where.begin(), where.end()), where.end());
+
+    touched.clear();
+    for (const uint32_t w : where) {
+      merge_word(words[w], left, right, merged, [&](uint64_t pair, int64_t d) {
+        if (pair == top.pair) {
+          return;
+        }
+        pair_counts[pair] += d;
+        touched.insert(pair);
+        if (d > 0) {
+          auto& pair_where = pair_words[pair];
+          if (pair_where.empty() || pair_where.back() != w) {
+            pair_where.push_back(w);
+          }
+        }
+      });
+    }
+    for (const uint64_t pair : touched) {
+      const auto count_it = pair_counts.find(pair);
+      if (count_it->second > 0) {
+        heap.push({static_cast<uint64_t>(count_it->second), pair});
+      } else {
+        pair_counts.erase(count_it);
+      }
+    }
+  }
+
+  TK_LOG(
+      Info,
+      "Learned %zu merges from %zu words",
+      merges_.size(),
+      words.size());
+  trained_ = true;
+  return Error::Ok;
+}
+
+// Artifacts ///////////////////////////////////////////////////////////////////
+
+Error BPETrainer::save_tiktoken(const std::string& path) const {
+  TK_CHECK_OR_RETURN_ERROR(trained_, Uninitialized, "train() was not called");
+  std::ofstream file(path, std::ios::binary);
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), Internal, "failed to open %s", path.c_str());
+  for (size_t rank = 0; rank < vocab_.size(); ++rank) {
+    file << base64::encode(vocab_[rank]) << ' ' << rank << '\n';
+  }
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), Internal, "failed to write %s", path.c_str());
+  return Error::Ok;
+}
+
+json BPETrainer::to_hf_json(const json& pre_tokenizer) const {
+  json vocab = json::object();
+  for (size_t id = 0; id < vocab_.size(); ++id) {
+    vocab[byte_level(vocab_[id])] = id;
+  }
+  json merges = json::array();
+  for (const auto& [left, right] : merges_) {
+    merges.push_back({byte_level(vocab_[left]), byte_level(vocab_[right])});
+  }
+  json added_tokens = json::array();
+  for (size_t i = 0; i < config_.special_tokens.size(); ++i) {
+    added_tokens.push_back({
+        {"id", vocab_.size() + i},
+        {"content", config_.special_tokens[i]},
+        {"single_word", false},
+        {"lstrip", false},
+        {"rstrip", false},
+        {"normalized", false},
+        {"special", true},
+    });
+  }
+
+  json byte_level_config = {
+      {"type", "ByteLevel"},
+      {"add_prefix_space", false},
+      {"trim_offsets", true},
+      {"use_regex", true},
+  };
+  return {
+      {"version", "1.0"},
+      {"truncation", nullptr},
+      {"padding", nullptr},
+      {"added_tokens", std::move(added_tokens)},
+      {"normalizer", nullptr},
+      {"pre_tokenizer",
+       pre_tokenizer.is_null() ? byte_level_config : pre_tokenizer},
+      {"post_processor", nullptr},
+      {"decoder", byte_level_config},
+      {"model",
+       {
+           {"type", "BPE"},
+           {"dropout", nullptr},
+           {"unk_token", nullptr},
+           {"continuing_subword_prefix", nullptr},
+           {"end_of_word_suffix", nullptr},
+           {"fuse_unk", false},
+           {"byte_fallback", false},
+           {"vocab", std::move(vocab)},
+           {"merges", std::move(merges)},
+       }},
+  };
+}
+
+Error BPETrainer::save_hf_tokenizer(
+    const std::string& path,
+    const json& pre_tokenizer) const {
+  TK_CHECK_OR_RETURN_ERROR(trained_, Uninitialized, "train() was not called");
+  std::ofstream file(path, std::ios::binary);
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), Internal, "failed to open %s", path.c_str());
+  file << to_hf_json(pre_tokenizer).dump(2) << '\n';
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), Internal, "failed to write %s", path.c_str());
+  return Error::Ok;
+}
+
+} // namespace tokenizers
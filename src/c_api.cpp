@@ -0,0 +1,544 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/c_api.h>
+
+// Standard
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Local
+#include <pytorch/tokenizers/executor.h>
+#include <pytorch/tokenizers/llama2c_tokenizer.h>
+#include <pytorch/tokenizers/tiktoken.h>
+#include <pytorch/tokenizers/tokenizer.h>
+#include <pytorch/tokenizers/unicode_normalization.h>
+#include <pytorch/tokenizers/warm_start.h>
+#ifndef TOKENIZERS_MINIMAL
+#include <pytorch/tokenizers/hf_tokenizer.h>
+#include <pytorch/tokenizers/sentencepiece.h>
+#include <pytorch/tokenizers/tekken.h>
+#endif
+
+using tokenizers::Error;
+using tokenizers::Tokenizer;
+using tokenizers::detail::BPETokenizerBase;
+
+struct tk_tokenizer {
+  std::unique_ptr<Tokenizer> impl;
+  // impl if its vocabulary holds the raw bytes of the tokens, as token
+  // offsets need
+  const BPETokenizerBase* raw_bytes;
+};
+
+struct tk_stream_decoder {
+  const Tokenizer* tokenizer;
+  uint64_t prev_token;
+  // Decoded bytes not returned yet
+  std::string pending;
+};
+
+namespace {
+
+tk_status_t to_status(Error error) {
+  return static_cast<tk_status_t>(error);
+}
+
+// Keep C++ exceptions (e.g. std::bad_alloc) from unwinding into the caller
+template <typename F>
+tk_status_t guarded(F&& f) noexcept {
+#ifdef __cpp_exceptions
+  try {
+    return f();
+  } catch (...) {
+    return TK_ERROR_INTERNAL;
+  }
+#else
+  return f();
+#endif
+}
+
+template <typename T>
+std::unique_ptr<Tokenizer> make_raw_bytes_tokenizer(
+    const BPETokenizerBase*& raw_bytes) {
+  auto tokenizer = std::make_unique<T>();
+  raw_bytes = tokenizer.get();
+  return tokenizer;
+}
+
+std::unique_ptr<Tokenizer> make_tokenizer(
+    std::string_view type,
+    const BPETokenizerBase*& raw_bytes) {
+  raw_bytes = nullptr;
+  if (type == "tiktoken") {
+    return make_raw_bytes_tokenizer<tokenizers::Tiktoken>(raw_bytes);
+  }
+  if (type == "llama2c") {
+    return std::make_unique<tokenizers::Llama2cTokenizer>();
+  }
+#ifndef TOKENIZERS_MINIMAL
+  if (type == "hf_tokenizer") {
+    return std::make_unique<tokenizers::HFTokenizer>();
+  }
+  if (type == "sentencepiece") {
+    return std::make_unique<tokenizers::SPTokenizer>();
+  }
+  if (type == "tekken") {
+    return make_raw_bytes_tokenizer<tokenizers::Tekken>(raw_bytes);
+  }
+#endif
+  return nullptr;
+}
+
+// Whether offsets[0..count] is non-decreasing
+bool valid_offsets(const size_t* offsets, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    if (offsets[i + 1] < offsets[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Length of the longest prefix of data that does not end inside a UTF-8
+// sequence. Invalid sequences count as complete.
+size_t complete_utf8_prefix(std::string_view data) {
+  size_t i = data.size();
+  size_t continuation = 0;
+  while (i > 0 && continuation < 3 &&
+         (static_cast<unsigned char>(data[i - 1]) & 0xC0) == 0x80) {
+    --i;
+    ++continuation;
+  }
+  if (i == 0) {
+    return data.size();
+  }
+  const auto lead = static_cast<unsigned char>(data[i - 1]);
+  size_t length = 1;
+  if ((lead & 0xE0) == 0xC0) {
+    length = 2;
+  } else if ((lead & 0xF0) == 0xE0) {
+    length = 3;
+  } else if ((lead & 0xF8) == 0xF0) {
+    length = 4;
+  }
+  return length > continuation + 1 ? i - 1 : data.size();
+}
+
+} // namespace
+
+extern "C" {
+
+uint32_t tk_api_version(void) {
+  return TK_C_API_VERSION;
+}
+
+const char* tk_status_string(tk_status_t status) {
+  switch (status) {
+    case TK_OK:
+      return "ok";
+    case TK_ERROR_INTERNAL:
+      return "internal error";
+    case TK_ERROR_UNINITIALIZED:
+      return "tokenizer not loaded";
+    case TK_ERROR_OUT_OF_RANGE:
+      return "token out of range";
+    case TK_ERROR_LOAD_FAILURE:
+      return "failed to load tokenizer artifact";
+    case TK_ERROR_ENCODE_FAILURE:
+      return "encode failure";
+    case TK_ERROR_BASE64_DECODE_FAILURE:
+      return "base64 decode failure";
+    case TK_ERROR_PARSE_FAILURE:
+      return "failed to parse tokenizer artifact";
+    case TK_ERROR_DECODE_FAILURE:
+      return "decode failure";
+    case TK_ERROR_REGEX_FAILURE:
+      return "unsupported regex";
+    case TK_ERROR_UNSUPPORTED:
+      return "not supported by the tokenizer mode";
+    case TK_ERROR_INVALID_ARGUMENT:
+      return "invalid argument";
+    case TK_ERROR_BUFFER_TOO_SMALL:
+      return "buffer too small";
+    default:
+      return "unknown status";
+  }
+}
+
+// -- Tokenizers ---------------------------------------------------------------
+
+tk_status_t
+tk_tokenizer_load(const char* type, const char* path, tk_tokenizer** out) {
+  return guarded([&]() -> tk_status_t {
+    if (type == nullptr || path == nullptr || out == nullptr) {
+      return TK_ERROR_INVALID_ARGUMENT;
+    }
+    *out = nullptr;
+    const BPETokenizerBase* raw_bytes = nullptr;
+    auto impl = make_tokenizer(type, raw_bytes);
+    if (!impl) {
+      TK_LOG(Error, "Unknown tokenizer type: %s", type);
+      return TK_ERROR_INVALID_ARGUMENT;
+    }
+    const Error error = impl->load(path);
+    if (error != Error::Ok) {
+      return to_status(error);
+    }
+    *out = new tk_tokenizer{std::move(impl), raw_bytes};
+    return TK_OK;
+  });
+}
+
+void tk_tokenizer_free(tk_tokenizer* tokenizer) {
+  delete tokenizer;
+}
+
+int32_t tk_vocab_size(const tk_tokenizer* tokenizer) {
+  return tokenizer ? tokenizer->impl->vocab_size() : 0;
+}
+
+uint64_t tk_bos_token(const tk_tokenizer* tokenizer) {
+  return tokenizer ? tokenizer->impl->bos_tok() : 0;
+}
+
+uint64_t tk_eos_token(const tk_tokenizer* tokenizer) {
+  return tokenizer ? tokenizer->impl->eos_tok() : 0;
+}
+
+// -- Batch encode and decode --------------------------------------------------
+
+tk_status_t tk_encode_batch(
+    const tk_tokenizer* tokenizer,
+    const char* text,
+    const size_t* text_offsets,
+    size_t num_texts,
+    int8_t bos,
+    int8_t eos,
+    uint64_t* ids,
+    size_t ids_capacity,
+    size_t* id_offsets,
+    size_t* ids_required) {
+  return guarded([&]() -> tk_status_t {
+    if (tokenizer == nullptr || text_offsets == nullptr ||
+        id_offsets == nullptr || (ids == nullptr && ids_capacity > 0) ||
+        (text == nullptr && text_offsets[num_texts] > text_offsets[0]) ||
+        !valid_offsets(text_offsets, num_texts)) {
+      return TK_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Texts are encoded in parallel, then copied in order
+    std::vector<std::vector<uint64_t>> tokens(num_texts);
+    std::vector<tk_status_t> statuses(num_texts, TK_OK);
+    tokenizers::default_executor()->parallel_for(
+        num_texts, 1, [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            statuses[i] = guarded([&]() -> tk_status_t {
+              const size_t length = text_offsets[i + 1] - text_offsets[i];
+              auto result = tokenizer->impl->encode_view(
+                  std::string_view(
+                      length > 0 ? text + text_offsets[i] : "", length),
+                  bos,
+                  eos);
+              if (!result.ok()) {
+                return to_status(result.error());
+              }
+              tokens[i] = std::move(result.get());
+              return TK_OK;
+            });
+          }
+        });
+
+    size_t total = 0;
+    bool fits = true;
+    id_offsets[0] = 0;
+    for (size_t i = 0; i < num_texts; ++i) {
+      if (statuses[i] != TK_OK) {
+        return statuses[i];
+      }
+      // Keep counting once the buffer is full to report the required size
+      fits = fits && tokens[i].size() <= ids_capacity - total;
+      if (fits) {
+        std::copy(tokens[i].begin(), tokens[i].end(), ids + total);
+      }
+      total += tokens[i].size();
+      id_offsets[i + 1] = total;
+    }
+    if (ids_required != nullptr) {
+      *ids_required = total;
+    }
+    return fits ? TK_OK : TK_ERROR_BUFFER_TOO_SMALL;
+  });
+}
+
+tk_status_t tk_encode_utf16(
+    const tk_tokenizer* tokenizer,
+    const uint16_t* text,
+    size_t length,
+    int8_t bos,
+    int8_t eos,
+    uint64_t* ids,
+    size_t ids_capacity,
+    size_t* token_ends,
+    size_t* ids_required) {
+  return guarded([&]() -> tk_status_t {
+    if (tokenizer == nullptr || (text == nullptr && length > 0) ||
+        (ids == nullptr && ids_capacity > 0) || bos < 0 || eos < 0) {
+      return TK_ERROR_INVALID_ARGUMENT;
+    }
+    const std::u16string_view input(
+        reinterpret_cast<const char16_t*>(text), length);
+
+    std::vector<uint64_t> tokens;
+    std::vector<size_t> ends;
+    if (token_ends == nullptr) {
+      std::string utf8;
+      tokenizers::unicode::append_utf16_as_utf8(input, utf8);
+      auto result = tokenizer->impl->encode(utf8, bos, eos);
+      if (!result.ok()) {
+        return to_status(result.error());
+      }
+      tokens = std::move(result.get());
+    } else {
+      if (tokenizer->raw_bytes == nullptr) {
+        return TK_ERROR_UNSUPPORTED;
+      }
+      auto result =
+          tokenizer->raw_bytes->encode_utf16_with_offsets(input, ends);
+      if (!result.ok()) {
+        return to_status(result.error());
+      }
+      // BOS tokens end at the start of the text, EOS tokens at its end
+      tokens.assign(bos, tokenizer->impl->bos_tok());
+      tokens.insert(tokens.end(), result->begin(), result->end());
+      tokens.insert(tokens.end(), eos, tokenizer->impl->eos_tok());
+      ends.insert(ends.begin(), bos, 0);
+      ends.insert(ends.end(), eos, length);
+    }
+
+    if (ids_required != nullptr) {
+      *ids_required = tokens.size();
+    }
+    if (tokens.size() > ids_capacity) {
+      return TK_ERROR_BUFFER_TOO_SMALL;
+    }
+    std::copy(tokens.begin(), tokens.end(), ids);
+    if (token_ends != nullptr) {
+      std::copy(ends.begin(), ends.end(), token_ends);
+    }
+    return TK_OK;
+  });
+}
+
+tk_status_t tk_decode_batch(
+    const tk_tokenizer* tokenizer,
+    const uint64_t* ids,
+    const size_t* id_offsets,
+    size_t num_sequences,
+    char* text,
+    size_t text_capacity,
+    size_t* text_offsets,
+    size_t* text_required) {
+  return guarded([&]() -> tk_status_t {
+    if (tokenizer == nullptr || id_offsets == nullptr ||
+        text_offsets == nullptr || (text == nullptr && text_capacity > 0) ||
+        (ids == nullptr && id_offsets[num_sequences] > id_offsets[0]) ||
+        !valid_offsets(id_offsets, num_sequences)) {
+      return TK_ERROR_INVALID_ARGUMENT;
+    }
+
+    const Tokenizer& impl = *tokenizer->impl;
+    size_t total = 0;
+    bool fits = true;
+    text_offsets[0] = 0;
+    for (size_t i = 0; i < num_sequences; ++i) {
+      uint64_t prev = impl.bos_tok();
+      for (size_t j = id_offsets[i]; j < id_offsets[i + 1]; ++j) {
+        const auto piece = impl.decode(prev, ids[j]);
+        if (!piece.ok()) {
+          return to_status(piece.error());
+        }
+        const std::string& bytes = piece.get();
+        fits = fits && bytes.size() <= text_capacity - total;
+        if (fits && !bytes.empty()) {
+          std::memcpy(text + total, bytes.data(), bytes.size());
+        }
+        total += bytes.size();
+        prev = ids[j];
+      }
+      text_offsets[i + 1] = total;
+    }
+    if (text_required != nullptr) {
+      *text_required = total;
+    }
+    return fits ? TK_OK : TK_ERROR_BUFFER_TOO_SMALL;
+  });
+}
+
+// -- Warm-up ------------------------------------------------------------------
+
+tk_status_t tk_warm_start(
+    const tk_tokenizer* tokenizer,
+    const char* text,
+    const size_t* text_offsets,
+    size_t num_texts,
+    uint32_t flags,
+    uint64_t* elapsed_ns) {
+  return guarded([&]() -> tk_status_t {
+    if (tokenizer == nullptr ||
+        (num_texts > 0 &&
+         (text_offsets == nullptr || !valid_offsets(text_offsets, num_texts) ||
+          (text == nullptr && text_offsets[num_texts] > text_offsets[0])))) {
+      return TK_ERROR_INVALID_ARGUMENT;
+    }
+
+    tokenizers::WarmStartOptions options;
+    options.prefault = (flags & TK_WARM_START_NO_PREFAULT) == 0;
+    options.lock_memory = (flags & TK_WARM_START_LOCK_MEMORY) != 0;
+    for (size_t i = 0; i < num_texts; ++i) {
+      const size_t length = text_offsets[i + 1] - text_offsets[i];
+      options.corpus.emplace_back(
+          length > 0 ? text + text_offsets[i] : "", length);
+    }
+    const auto report = tokenizers::warm_start(*tokenizer->impl, options);
+    if (!report.ok()) {
+      return to_status(report.error());
+    }
+    if (elapsed_ns != nullptr) {
+      *elapsed_ns = report->total_time.count();
+    }
+    return TK_OK;
+  });
+}
+
+// -- Executor -----------------------------------------------------------------
+
+namespace {
+
+void run_task(void* arg) {
+  std::unique_ptr<tokenizers::Executor::Task> task(
+      static_cast<tokenizers::Executor::Task*>(arg));
+  (*task)();
+}
+
+} // namespace
+
+tk_status_t
+tk_set_executor(tk_submit_fn submit, void* context, uint32_t concurrency) {
+  return guarded([&]() -> tk_status_t {
+    if (submit == nullptr) {
+      tokenizers::set_default_executor(nullptr);
+      return TK_OK;
+    }
+    if (concurrency == 0) {
+      return TK_ERROR_INVALID_ARGUMENT;
+    }
+    tokenizers::set_default_executor(
+        std::make_shared<tokenizers::CallbackExecutor>(
+            [submit, context](tokenizers::Executor::Task task) {
+              // Owned by the submitted task until it runs
+              submit(
+                  context,
+                  run_task,
+                  new tokenizers::Executor::Task(std::move(task)));
+            },
+            concurrency));
+    return TK_OK;
+  });
+}
+
+// -- Stream decoding ----------------------------------------------------------
+
+tk_status_t tk_stream_decoder_new(
+    const tk_tokenizer* tokenizer,
+    tk_stream_decoder** out) {
+  return guarded([&]() -> tk_status_t {
+    if (tokenizer == nullptr || out == nullptr) {
+      return TK_ERROR_INVALID_ARGUMENT;
+    }
+    const Tokenizer* impl = tokenizer->impl.get();
+    *out = new tk_stream_decoder{impl, impl->bos_tok(), {}};
+    return TK_OK;
+  });
+}
+
+void tk_stream_decoder_free(tk_stream_decoder* decoder) {
+  delete decoder;
+}
+
+void tk_stream_decoder_reset(tk_stream_decoder* decoder) {
+  if (decoder != nullptr) {
+    decoder->prev_token = decoder->tokenizer->bos_tok();
+    decoder->pending.clear();
+  }
+}
+
+tk_status_t tk_stream_decoder_push(
+    tk_stream_decoder* decoder,
+    uint64_t token,
+    char* out,
+    size_t capacity,
+    size_t* written) {
+  return guarded([&]() -> tk_status_t {
+    if (decoder == nullptr || written == nullptr ||
+        (out == nullptr && capacity > 0)) {
+      return TK_ERROR_INVALID_ARGUMENT;
+    }
+    *written = 0;
+    const auto piece = decoder->tokenizer->decode(decoder->prev_token, token);
+    if (!piece.ok()) {
+      return to_status(piece.error());
+    }
+    decoder->prev_token = token;
+    std::string& pending = decoder->pending;
+    pending += piece.get();
+
+    const size_t ready = complete_utf8_prefix(pending);
+    size_t count = std::min(ready, capacity);
+    // Do not cut a character in two when the buffer is full
+    while (count > 0 && count < ready &&
+           (static_cast<unsigned char>(pending[count]) & 0xC0) == 0x80) {
+      --count;
+    }
+    if (count > 0) {
+      std::memcpy(out, pending.data(), count);
+      pending.erase(0, count);
+    }
+    *written = count;
+    return TK_OK;
+  });
+}
+
+tk_status_t tk_stream_decoder_flush(
+    tk_stream_decoder* decoder,
+    char* out,
+    size_t capacity,
+    size_t* written) {
+  return guarded([&]() -> tk_status_t {
+    if (decoder == nullptr || written == nullptr ||
+        (out == nullptr && capacity > 0)) {
+      return TK_ERROR_INVALID_ARGUMENT;
+    }
+    *written = decoder->pending.size();
+    if (decoder->pending.size() > capacity) {
+      return TK_ERROR_BUFFER_TOO_SMALL;
+    }
+    if (!decoder->pending.empty()) {
+      std::memcpy(out, decoder->pending.data(), decoder->pending.size());
+    }
+    tk_stream_decoder_reset(decoder);
+    return TK_OK;
+  });
+}
+
+} // extern "C"
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/chat_encoder.h>
+
+// Standard
+#include <algorithm>
+
+// Local
+#include <pytorch/tokenizers/log.h>
+
+namespace tokenizers {
+
+namespace {
+
+// A part of the rendered conversation, ending at `end`
+struct Region {
+  size_t end;
+  int32_t segment_id;
+  int32_t role_id;
+  uint8_t loss_mask;
+};
+
+} // namespace
+
+ChatTemplate ChatTemplate::llama3() {
+  ChatTemplate chat_template;
+  chat_template.begin = "<|begin_of_text|>";
+  chat_template.message_begin =
+      "<|start_header_id|>{role}<|end_header_id|>\n\n";
+  chat_template.message_end = "<|eot_id|>";
+  chat_template.roles = {"system", "user", "assistant", "ipython"};
+  return chat_template;
+}
+
+ChatTemplate ChatTemplate::chatml() {
+  ChatTemplate chat_template;
+  chat_template.message_begin = "<|im_start|>{role}\n";
+  chat_template.message_end = "<|im_end|>\n";
+  return chat_template;
+}
+
+ChatEncoder::ChatEncoder(
+    const detail::BPETokenizerBase& tokenizer,
+    ChatTemplate chat_template)
+    : tokenizer_(tokenizer), chat_template_(std::move(chat_template)) {
+  for (const auto& role : chat_template_.roles) {
+    trained_.push_back(
+        std::find(
+            chat_template_.trained_roles.begin(),
+            chat_template_.trained_roles.end(),
+            role) != chat_template_.trained_roles.end());
+  }
+}
+
+int32_t ChatEncoder::role_id(const std::string& role) const {
+  const auto it =
+      std::find(chat_template_.roles.begin(), chat_template_.roles.end(), role);
+  return it == chat_template_.roles.end()
+      ? -1
+      : static_cast<int32_t>(it - chat_template_.roles.begin());
+}
+
+std::string ChatEncoder::message_begin(const std::string& role) const {
+  static const std::string kPlaceholder = "{role}";
+  std::string text = chat_template_.message_begin;
+  for (size_t pos = text.find(kPlaceholder); pos != std::string::npos;
+       pos = text.find(kPlaceholder, pos + role.size())) {
+    text.replace(pos, kPlaceholder.size(), role);
+  }
+  return text;
+}
+
+std::string ChatEncoder::render(
+    const std::vector<ChatMessage>& messages) const {
+  std::string text = chat_template_.begin;
+  for (const auto& message : messages) {
+    text += message_begin(message.role);
+    text += message.content;
+    text += chat_template_.message_end;
+  }
+  text += chat_template_.end;
+  return text;
+}
+
+Result<ChatEncoding> ChatEncoder::encode(
+    const std::vector<ChatMessage>& messages) const {
+  // Render, remembering which part of the conversation each byte is from
+  std::string text = chat_template_.begin;
+  std::vector<Region> regions;
+  regions.push_back({text.size(), -1, -1, 0});
+  for (size_t i = 0; i < messages.size(); ++i) {
+    const auto& message = messages[i];
+    const int32_t role = role_id(message.role);
+    TK_CHECK_OR_RETURN_ERROR(
+        role >= 0, EncodeFailure, "unknown role: %s", message.role.c_str());
+    const auto segment = static_cast<int32_t>(i);
+    const uint8_t mask = trained_[role] ? 1 : 0;
+    text += message_begin(message.role);
+    regions.push_back({text.size(), segment, role, 0});
+    text += message.content;
+    regions.push_back({text.size(), segment, role, mask});
+    text += chat_template_.message_end;
+    regions.push_back({text.size(), segment, role, mask});
+  }
+  text += chat_template_.end;
+  regions.push_back({text.size(), -1, -1, 0});
+
+  std::vector<size_t> token_ends;
+  auto tokens = tokenizer_.encode_with_offsets(text, token_ends);
+  if (!tokens.ok()) {
+    return tokens.error();
+  }
+
+  ChatEncoding encoding;
+  encoding.tokens = std::move(*tokens);
+  const size_t count = encoding.tokens.size();
+  encoding.segment_ids.reserve(count);
+  encoding.role_ids.reserve(count);
+  encoding.loss_mask.reserve(count);
+  size_t region = 0;
+  size_t start = 0;
+  for (size_t i = 0; i < count; ++i) {
+    // Regions may be empty, so skip every one that ends at or before start
+    while (regions[region].end <= start) {
+      ++region;
+    }
+    encoding.segment_ids.push_back(regions[region].segment_id);
+    encoding.role_ids.push_back(regions[region].role_id);
+    encoding.loss_mask.push_back(regions[region].loss_mask);
+    start = token_ends[i];
+  }
+  return encoding;
+}
+
+} // namespace tokenizers
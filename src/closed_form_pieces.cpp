@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/closed_form_pieces.h>
+
+// Standard
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace tokenizers {
+
+namespace {
+
+// Index of the first digit group of each length
+constexpr size_t kDigitBase[] = {0, 0, 10, 110};
+constexpr size_t kNumDigitGroups = 1110;
+
+// Bytes whose runs are tabulated
+bool is_run_byte(uint8_t c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' ||
+      (c > ' ' && c < 0x7f && !(c >= '0' && c <= '9') &&
+       !((c | 0x20) >= 'a' && (c | 0x20) <= 'z'));
+}
+
+void append_entry(
+    const std::vector<uint32_t>& offsets,
+    const std::vector<uint64_t>& tokens,
+    size_t index,
+    std::vector<uint64_t>& out) {
+  out.insert(
+      out.end(),
+      tokens.begin() + offsets[index],
+      tokens.begin() + offsets[index + 1]);
+}
+
+} // namespace
+
+Error ClosedFormPieces::build(
+    const TokenLookup& find_token,
+    const PieceEncoder& encode) {
+  clear();
+
+  // Digit groups, if every digit is a token
+  std::vector<uint32_t> digit_offsets{0};
+  std::vector<uint64_t> digit_tokens;
+  for (size_t length = 1; length <= kMaxDigits; ++length) {
+    size_t count = 1;
+    for (size_t i = 0; i < length; ++i) {
+      count *= 10;
+    }
+    std::string piece(length, '0');
+    for (size_t value = 0; value < count; ++value) {
+      for (size_t i = 0, v = value; i < length; ++i, v /= 10) {
+        piece[length - 1 - i] = static_cast<char>('0' + v % 10);
+      }
+      auto result = encode(piece);
+      if (!result.ok() || (length == 1 && result->size() != 1)) {
+        digit_tokens.clear();
+        break;
+      }
+      digit_tokens.insert(digit_tokens.end(), result->begin(), result->end());
+      digit_offsets.push_back(static_cast<uint32_t>(digit_tokens.size()));
+    }
+    if (digit_tokens.empty()) {
+      break;
+    }
+  }
+  if (!digit_tokens.empty() && digit_offsets.size() == kNumDigitGroups + 1) {
+    digit_offsets_ = std::move(digit_offsets);
+    digit_tokens_ = std::move(digit_tokens);
+  }
+
+  // Runs of one byte, if the byte is a token
+  for (int c = 0; c < 256; ++c) {
+    if (!is_run_byte(static_cast<uint8_t>(c))) {
+      continue;
+    }
+    // Lengths of the single-token runs, longest first
+    std::vector<std::pair<size_t, uint64_t>> blocks;
+    for (size_t n = kMaxRunBlock; n > 0; --n) {
+      const auto token = find_token(std::string(n, static_cast<char>(c)));
+      if (token) {
+        blocks.emplace_back(n, *token);
+      }
+    }
+    if (blocks.empty() || blocks.back().first != 1) {
+      continue;
+    }
+    // encoded[n - 1] holds the tokens of the run of n bytes
+    std::vector<std::vector<uint64_t>> encoded;
+    const auto encode_runs = [&](size_t max_length) {
+      while (encoded.size() < max_length) {
+        auto result =
+            encode(std::string(encoded.size() + 1, static_cast<char>(c)));
+        if (!result.ok()) {
+          return false;
+        }
+        encoded.push_back(std::move(*result));
+      }
+      return true;
+    };
+
+    // Find a block such that, past a table of two blocks, a run is one block
+    // followed by the run of the rest. Long runs merge into the longest
+    // single-token runs, but not always in that order, so try each of them,
+    // longest first.
+    Run run;
+    size_t table_size = std::max(blocks.front().first, kMinRunTable);
+    for (const auto& [block, token] : blocks) {
+      const size_t block_table = std::max(2 * block, kMinRunTable);
+      const size_t checked = block_table + std::max(block, kMinRunTable);
+      if (!encode_runs(checked)) {
+        break;
+      }
+      run.composable = true;
+      for (size_t n = block_table + 1; n <= checked; ++n) {
+        const auto& tokens = encoded[n - 1];
+        const auto& rest = encoded[n - block - 1];
+        if (tokens.size() != rest.size() + 1 || tokens[0] != token ||
+            !std::equal(rest.begin(), rest.end(), tokens.begin() + 1)) {
+          run.composable = false;
+          break;
+        }
+      }
+      if (run.composable) {
+        run.block = block;
+        run.block_token = token;
+        table_size = block_table;
+        break;
+      }
+    }
+    if (!encode_runs(table_size)) {
+      continue;
+    }
+
+    run.offsets.push_back(0);
+    for (size_t n = 1; n <= table_size; ++n) {
+      const auto& tokens = encoded[n - 1];
+      run.tokens.insert(run.tokens.end(), tokens.begin(), tokens.end());
+      run.offsets.push_back(static_cast<uint32_t>(run.tokens.size()));
+    }
+    run_index_[c] = static_cast<uint8_t>(runs_.size());
+    runs_.push_back(std::move(run));
+  }
+  return Error::Ok;
+}
+
+void ClosedFormPieces::clear() {
+  digit_offsets_.clear();
+  digit_tokens_.clear();
+  runs_.clear();
+  std::memset(run_index_, kNoRun, sizeof(run_index_));
+}
+
+void ClosedFormPieces::append_run(
+    const Run& run,
+    size_t n,
+    std::vector<uint64_t>& tokens) const {
+  if (n <= run.size()) {
+    append_entry(run.offsets, run.tokens, n - 1, tokens);
+    return;
+  }
+  // Blocks, then a run from the table
+  const size_t blocks = (n - run.size() + run.block - 1) / run.block;
+  tokens.insert(tokens.end(), blocks, run.block_token);
+  append_entry(run.offsets, run.tokens, n - blocks * run.block - 1, tokens);
+}
+
+bool ClosedFormPieces::lookup(
+    std::string_view piece,
+    std::vector<uint64_t>& tokens) const {
+  if (piece.empty()) {
+    return false;
+  }
+  const auto first = static_cast<uint8_t>(piece[0]);
+  if (static_cast<uint8_t>(first - '0') < 10) {
+    if (piece.size() > kMaxDigits || digit_offsets_.empty()) {
+      return false;
+    }
+    size_t value = 0;
+    for (const char c : piece) {
+      const auto digit = static_cast<uint8_t>(c - '0');
+      if (digit >= 10) {
+        return false;
+      }
+      value = value * 10 + digit;
+    }
+    append_entry(
+        digit_offsets_,
+        digit_tokens_,
+        kDigitBase[piece.size()] + value,
+        tokens);
+    return true;
+  }
+
+  const uint8_t index = run_index_[first];
+  if (index == kNoRun) {
+    return false;
+  }
+  const Run& run = runs_[index];
+  if (piece.size() > run.size() && !run.composable) {
+    return false;
+  }
+  for (const char c : piece) {
+    if (c != piece[0]) {
+      return false;
+    }
+  }
+  append_run(run, piece.size(), tokens);
+  return true;
+}
+
+size_t ClosedFormPieces::max_run(char byte) const {
+  const uint8_t index = run_index_[static_cast<uint8_t>(byte)];
+  if (index == kNoRun) {
+    return 0;
+  }
+  const Run& run = runs_[index];
+  return run.composable ? std::numeric_limits<size_t>::max() : run.size();
+}
+
+} // namespace tokenizers
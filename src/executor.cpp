@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/executor.h>
+
+// Standard
+#include <algorithm>
+
+namespace tokenizers {
+
+namespace {
+
+// Chunks per unit of concurrency in parallel_for, to even out uneven items
+constexpr size_t kChunksPerTask = 4;
+
+// The worker the current thread runs, if any
+thread_local const WorkStealingExecutor* current_executor = nullptr;
+thread_local size_t current_worker = 0;
+
+struct DefaultExecutor {
+  std::mutex mutex;
+  std::shared_ptr<Executor> custom;
+  std::shared_ptr<Executor> builtin;
+};
+
+DefaultExecutor& default_executor_state() {
+  static DefaultExecutor state;
+  return state;
+}
+
+} // namespace
+
+// Executor ////////////////////////////////////////////////////////////////////
+
+void Executor::parallel_for(
+    size_t size,
+    size_t grain,
+    const std::function<void(size_t, size_t)>& body) {
+  if (size == 0) {
+    return;
+  }
+  const size_t tasks = std::max<size_t>(1, concurrency());
+  const size_t target = kChunksPerTask * tasks;
+  const size_t chunk =
+      std::max({size_t(1), grain, (size + target - 1) / target});
+  const size_t num_chunks = (size + chunk - 1) / chunk;
+  if (tasks == 1 || num_chunks == 1) {
+    body(0, size);
+    return;
+  }
+
+  // Shared with the helper tasks, which may only start once the loop is over
+  struct Loop {
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> done{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+  auto loop = std::make_shared<Loop>();
+  // Only dereferenced for a claimed chunk, i.e. while the caller waits
+  const auto* loop_body = &body;
+  const auto run = [loop, loop_body, size, chunk, num_chunks]() {
+    for (size_t c; (c = loop->next.fetch_add(1)) < num_chunks;) {
+      const size_t begin = c * chunk;
+      (*loop_body)(begin, std::min(size, begin + chunk));
+      if (loop->done.fetch_add(1) + 1 == num_chunks) {
+        std::lock_guard<std::mutex> lock(loop->mutex);
+        loop->finished.notify_all();
+      }
+    }
+  };
+  for (size_t i = 1; i < std::min(tasks, num_chunks); ++i) {
+    submit(run);
+  }
+  run();
+  std::unique_lock<std::mutex> lock(loop->mutex);
+  loop->finished.wait(
+      lock, [&loop, num_chunks] { return loop->done.load() == num_chunks; });
+}
+
+// InlineExecutor //////////////////////////////////////////////////////////////
+
+void InlineExecutor::submit(Task task) {
+  task();
+}
+
+size_t InlineExecutor::concurrency() const {
+  return 1;
+}
+
+void InlineExecutor::parallel_for(
+    size_t size,
+    size_t grain,
+    const std::function<void(size_t, size_t)>& body) {
+  (void)grain;
+  if (size > 0) {
+    body(0, size);
+  }
+}
+
+// CallbackExecutor ////////////////////////////////////////////////////////////
+
+CallbackExecutor::CallbackExecutor(
+    std::function<void(Task)> submit,
+    size_t concurrency)
+    : submit_(std::move(submit)),
+      concurrency_(std::max<size_t>(1, concurrency)) {}
+
+void CallbackExecutor::submit(Task task) {
+  submit_(std::move(task));
+}
+
+size_t CallbackExecutor::concurrency() const {
+  return concurrency_;
+}
+
+// WorkStealingExecutor ////////////////////////////////////////////////////////
+
+WorkStealingExecutor::WorkStealingExecutor(size_t num_threads) {
+  if (num_threads == 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  workers_.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  threads_.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads_.emplace_back([this, i] { run(i); });
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkStealingExecutor::submit(Task task) {
+  // Counted before it is queued, so that pending_ never drops below zero
+  pending_.fetch_add(1);
+  const size_t index = current_executor == this
+      ? current_worker
+      : next_worker_.fetch_add(1) % workers_.size();
+  {
+    std::lock_guard<std::mutex> lock(workers_[index]->mutex);
+    workers_[index]->tasks.push_back(std::move(task));
+  }
+  // A worker checks pending_ under sleep_mutex_ before sleeping
+  { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+  wake_.notify_one();
+}
+
+size_t WorkStealingExecutor::concurrency() const {
+  return workers_.size();
+}
+
+bool WorkStealingExecutor::try_pop(size_t index, Task& task) {
+  {
+    auto& own = *workers_[index];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      return true;
+    }
+  }
+  for (size_t i = 1; i < workers_.size(); ++i) {
+    auto& victim = *workers_[(index + i) % workers_.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingExecutor::run(size_t index) {
+  current_executor = this;
+  current_worker = index;
+  Task task;
+  while (true) {
+    if (try_pop(index, task)) {
+      pending_.fetch_sub(1);
+      task();
+      task = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    wake_.wait(lock, [this] { return stopping_ || pending_.load() > 0; });
+    if (stopping_ && pending_.load() == 0) {
+      return;
+    }
+  }
+}
+
+// Default executor ////////////////////////////////////////////////////////////
+
+std::shared_ptr<Executor> default_executor() {
+  auto& state = default_executor_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (state.custom) {
+    return state.custom;
+  }
+  if (!state.builtin) {
+#ifdef TOKENIZERS_MINIMAL
+    state.builtin = std::make_shared<InlineExecutor>();
+#else
+    state.builtin = std::make_shared<WorkStealingExecutor>();
+#endif
+  }
+  return state.builtin;
+}
+
+void set_default_executor(std::shared_ptr<Executor> executor) {
+  auto& state = default_executor_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.custom = std::move(executor);
+}
+
+void parallel_for_parts(
+    Executor& executor,
+    size_t size,
+    size_t parts,
+    const std::function<void(size_t, size_t, size_t)>& fn) {
+  parts = std::max<size_t>(1, std::min(parts, size));
+  if (parts == 1) {
+    fn(0, 0, size);
+    return;
+  }
+  const size_t chunk = (size + parts - 1) / parts;
+  executor.parallel_for(parts, 1, [&](size_t begin, size_t end) {
+    for (size_t part = begin; part < end; ++part) {
+      const size_t part_begin = std::min(size, part * chunk);
+      fn(part, part_begin, std::min(size, part_begin + chunk));
+    }
+  });
+}
+
+} // namespace tokenizers
@@ -97,12 +97,14 @@ Error HFTokenizer::load(const std::string& path) {
     auto special_token_map = std::move(*special_token_map_result);
 
     // Create special token regex to help later with encoding.
-    auto special_token_regex_result =
-        detail::build_special_token_regex(special_token_map);
-    if (!special_token_regex_result.ok()) {
-      return special_token_regex_result.error();
+    if (mode_ != TokenizerMode::DecodeOnly) {
+      auto special_token_regex_result =
+          detail::build_special_token_regex(special_token_map, regex_options_);
+      if (!special_token_regex_result.ok()) {
+        return special_token_regex_result.error();
+      }
+      special_token_regex_ = std::move(*special_token_regex_result);
     }
-    special_token_regex_ = std::move(*special_token_regex_result);
 
     // Store for future use.
     special_token_map_.emplace(std::move(special_token_map));
@@ -124,7 +126,13 @@ Error HFTokenizer::load(const std::string& path) {
       }
     }
 
-    auto token_map_result = detail::build_token_map(std::move(token_pairs));
+    // Building the merges looks tokens up in both directions, so the map of
+    // an EncodeOnly tokenizer is only slimmed once they are built.
+    const auto direction = mode_ == TokenizerMode::DecodeOnly
+        ? detail::MapDirection::IntegerToString
+        : detail::MapDirection::Both;
+    auto token_map_result =
+        detail::build_token_map(std::move(token_pairs), direction);
     if (!token_map_result.ok()) {
       return token_map_result.error();
     }
@@ -138,123 +146,147 @@ Error HFTokenizer::load(const std::string& path) {
   // Set the vocab size to include special tokens
   vocab_size_ = token_map_->size() + special_token_map_->size();
 
-  // Set up the normalizer (optional)
-  try {
-    TK_LOG(Info, "Setting up normalizer...");
-    const auto& normalizer_json = parsed_json.at("normalizer");
-    if (!normalizer_json.is_null()) {
-      _normalizer = NormalizerConfig().parse_json(normalizer_json).create();
-      TK_LOG(Info, "Normalizer set up");
-    } else {
-      TK_LOG(Info, "Normalizer field is null, skipping");
+  // Set up the normalizer and pre-tokenizer, which only encoding uses
+  if (mode_ != TokenizerMode::DecodeOnly) {
+    // Set up the normalizer (optional)
+    try {
+      TK_LOG(Info, "Setting up normalizer...");
+      const auto& normalizer_json = parsed_json.at("normalizer");
+      if (!normalizer_json.is_null()) {
+        _normalizer = NormalizerConfig().parse_json(normalizer_json).create();
+        TK_LOG(Info, "Normalizer set up");
+      } else {
+        TK_LOG(Info, "Normalizer field is null, skipping");
+      }
+    } catch (const std::exception& e) {
+      // No "Normalizer" field found
+      TK_LOG(
+          Info,
+          "No 'Normalizer' field found in json, out of range error: %s",
+          e.what());
     }
-  } catch (const std::exception& e) {
-    // No "Normalizer" field found
-    TK_LOG(
-        Info,
-        "No 'Normalizer' field found in json, out of range error: %s",
-        e.what());
-  }
 
-  // Set up the pre-tokenizer
-  try {
-    TK_LOG(Info, "Setting up pretokenizer...");
-    _pretokenizer = PreTokenizerConfig()
-                        .parse_json(parsed_json.at("pre_tokenizer"))
-                        .create();
-    TK_LOG(Info, "Pretokenizer set up");
-  } catch (const std::exception& e) {
-    TK_LOG(Info, "Could not parse pre_tokenizer: %s", e.what());
-    return Error::LoadFailure;
+    // Set up the pre-tokenizer
+    try {
+      TK_LOG(Info, "Setting up pretokenizer...");
+      _pretokenizer = PreTokenizerConfig()
+                          .parse_json(parsed_json.at("pre_tokenizer"))
+                          .set_regex_options(regex_options_)
+                          .create();
+      TK_LOG(Info, "Pretokenizer set up");
+    } catch (const std::exception& e) {
+      TK_LOG(Info, "Could not parse pre_tokenizer: %s", e.what());
+      return Error::LoadFailure;
+    }
   }
 
   // Set up the decoder (optional)
-  try {
-    _decoder =
-        TokenDecoderConfig().parse_json(parsed_json.at("decoder")).create();
-  } catch (const std::exception&) {
-    // No decoder specified
+  if (mode_ != TokenizerMode::EncodeOnly) {
+    try {
+      _decoder =
+          TokenDecoderConfig().parse_json(parsed_json.at("decoder")).create();
+    } catch (const std::exception&) {
+      // No decoder specified
+    }
   }
 
-  // Parse the BPE merges
-  try {
-    TK_LOG(Info, "Loading BPE merges...");
-    const auto& merges = parsed_json.at("/model/merges"_json_pointer);
-    std::vector<std::pair<std::string, std::string>> merge_pairs;
-
-    for (const auto& merge : merges) {
-      std::string first, second;
-
-      if (merge.is_string()) {
-        // Legacy format: "token1 token2" (space-separated string)
-        // This is the standard HuggingFace tokenizer.json format
-        std::string merge_str = merge.get<std::string>();
-
-        // Skip #version header lines (like HuggingFace does)
-        if (merge_str.rfind("#version", 0) == 0) {
-          continue;
+  // Parse the BPE merges, which only encoding uses
+  if (mode_ != TokenizerMode::DecodeOnly) {
+    try {
+      TK_LOG(Info, "Loading BPE merges...");
+      const auto& merges = parsed_json.at("/model/merges"_json_pointer);
+      std::vector<std::pair<std::string, std::string>> merge_pairs;
+
+      for (const auto& merge : merges) {
+        std::string first, second;
+
+        if (merge.is_string()) {
+          // Legacy format: "token1 token2" (space-separated string)
+          // This is the standard HuggingFace tokenizer.json format
+          std::string merge_str = merge.get<std::string>();
+
+          // Skip #version header lines (like HuggingFace does)
+          if (merge_str.rfind("#version", 0) == 0) {
+            continue;
+          }
+
+          auto space_pos = merge_str.find(' ');
+          if (space_pos != std::string::npos) {
+            first = merge_str.substr(0, space_pos);
+            second = merge_str.substr(space_pos + 1);
+          }
+        } else if (merge.is_array() && merge.size() == 2) {
+          // Tuple format: ["token1", "token2"] (array of two strings)
+          // This format supports tokens containing spaces
+          first = merge[0].get<std::string>();
+          second = merge[1].get<std::string>();
         }
 
-        auto space_pos = merge_str.find(' ');
-        if (space_pos != std::string::npos) {
-          first = merge_str.substr(0, space_pos);
-          second = merge_str.substr(space_pos + 1);
+        if (!first.empty() && !second.empty()) {
+          merge_pairs.emplace_back(first, second);
         }
-      } else if (merge.is_array() && merge.size() == 2) {
-        // Tuple format: ["token1", "token2"] (array of two strings)
-        // This format supports tokens containing spaces
-        first = merge[0].get<std::string>();
-        second = merge[1].get<std::string>();
       }
 
-      if (!first.empty() && !second.empty()) {
-        merge_pairs.emplace_back(first, second);
-      }
-    }
-
-    // Build merge map: (token_id_1, token_id_2) -> (rank, merged_token_id)
-    merge_map_ = std::make_unique<detail::MergeMap>();
-    for (size_t i = 0; i < merge_pairs.size(); ++i) {
-      const auto& [first, second] = merge_pairs[i];
-
-      // Get token IDs for the merge pair
-      auto first_id = token_map_->tryGetInteger(first);
-      auto second_id = token_map_->tryGetInteger(second);
-
-      if (first_id && second_id) {
-        // Create merged token string
-        std::string merged = first + second;
-        auto merged_id = token_map_->tryGetInteger(merged);
-
-        if (merged_id) {
-          // Store merge rule: (first_id, second_id) -> (rank, merged_id)
-          merge_map_->emplace(
-              std::make_pair(*first_id, *second_id),
-              std::make_pair(static_cast<uint32_t>(i), *merged_id));
+      // Build merge map: (token_id_1, token_id_2) -> (rank, merged_token_id)
+      detail::MergeMap merge_map;
+      for (size_t i = 0; i < merge_pairs.size(); ++i) {
+        const auto& [first, second] = merge_pairs[i];
+
+        // Get token IDs for the merge pair
+        auto first_id = token_map_->tryGetInteger(first);
+        auto second_id = token_map_->tryGetInteger(second);
+
+        if (first_id && second_id) {
+          // Create merged token string
+          std::string merged = first + second;
+          auto merged_id = token_map_->tryGetInteger(merged);
+
+          if (merged_id) {
+            // Store merge rule: (first_id, second_id) -> (rank, merged_id)
+            merge_map.emplace(
+                std::make_pair(*first_id, *second_id),
+                std::make_pair(static_cast<uint32_t>(i), *merged_id));
+          }
         }
       }
-    }
 
-    TK_LOG(
-        Info,
-        "Loaded %" PRId64 " BPE merge rules",
-        static_cast<int64_t>(merge_map_->size()));
-
-    // Pre-compute merge ranks for efficient BPE encoding
-    auto merge_ranks_result =
-        detail::build_merge_ranks_map(*merge_map_, *token_map_);
-    if (!merge_ranks_result.ok()) {
-      return merge_ranks_result.error();
+      TK_LOG(
+          Info,
+          "Loaded %" PRId64 " BPE merge rules",
+          static_cast<int64_t>(merge_map.size()));
+
+      // Pre-compute merge ranks for efficient BPE encoding
+      auto merge_ranks_result = detail::build_merge_ranks_map(
+          merge_map, *token_map_, detail::MapDirection::StringToInteger);
+      if (!merge_ranks_result.ok()) {
+        return merge_ranks_result.error();
+      }
+      auto merge_ranks = std::move(*merge_ranks_result);
+      TK_LOG(
+          Info,
+          "Built merge ranks map with %" PRId64 " entries",
+          static_cast<int64_t>(merge_ranks.size()));
+      merge_ranks_.emplace(std::move(merge_ranks));
+
+      // Rebuild the vocabulary map of an EncodeOnly tokenizer without the
+      // id to token lookup
+      if (mode_ == TokenizerMode::EncodeOnly) {
+        std::vector<std::pair<std::string_view, std::uint64_t>> token_pairs;
+        token_pairs.reserve(token_map_->size());
+        token_map_->forEachElement(
+            [&token_pairs](std::string_view token, std::uint64_t id) {
+              token_pairs.emplace_back(token, id);
+            });
+        // The pairs point into the old map, which is only replaced once the
+        // new one is built
+        detail::TokenMap token_map(
+            token_pairs, detail::MapDirection::StringToInteger);
+        token_map_.emplace(std::move(token_map));
+      }
+    } catch (const std::exception& e) {
+      TK_LOG(Error, "Could not parse merges: %s", e.what());
+      return Error::LoadFailure;
     }
-    auto merge_ranks = std::move(*merge_ranks_result);
-    TK_LOG(
-        Info,
-        "Built merge ranks map with %" PRId64 " entries",
-        static_cast<int64_t>(merge_ranks.size()));
-    merge_ranks_.emplace(std::move(merge_ranks));
-  } catch (const std::exception& e) {
-    TK_LOG(Error, "Could not parse merges: %s", e.what());
-    return Error::LoadFailure;
   }
 
   // Try special_tokens_map.json first
@@ -402,27 +434,32 @@ Error HFTokenizer::load(const std::string& path) {
 // -------------------------private method start--------------------------------
 
 Error HFTokenizer::_encode(
-    const std::string& input,
+    std::string_view input,
     std::vector<uint64_t>& ret,
     uint64_t& last_piece_token_len) const {
-  // Apply normalization first if normalizer is available
-  std::string normalized_input = input;
-  if (_normalizer) {
-    normalized_input = _normalizer->normalize(input);
+  // Apply normalization first if normalizer is available. The input is only
+  // copied if the normalizer changes it.
+  std::string_view normalized_input = input;
+  std::string normalized_buffer;
+  const bool normalized =
+      _normalizer && _normalizer->normalize_into(input, normalized_buffer);
+  if (normalized) {
+    normalized_input = normalized_buffer;
     TK_LOG(
         Info,
-        "normalized input: '%s' -> '%s'",
-        input.c_str(),
-        normalized_input.c_str());
+        "normalized input: '%.*s' -> '%s'",
+        static_cast<int>(input.size()),
+        input.data(),
+        normalized_buffer.c_str());
   }
 
-  for (const auto& piece : _pretokenizer->pre_tokenize(normalized_input)) {
+  auto encode_piece = [&](const std::string& piece) -> Error {
     // Check if the entire word is already a token to skip merging.
     const auto result = token_map_->tryGetInteger(piece);
     if (result) {
       last_piece_token_len = 1;
       ret.push_back(*result);
-      continue;
+      return Error::Ok;
     }
     auto tokens_result = byte_pair_encode_(piece, *token_map_);
     if (!tokens_result.ok()) {
@@ -432,10 +469,64 @@ Error HFTokenizer::_encode(
 
     last_piece_token_len = tokens.size();
     ret.insert(ret.end(), tokens.begin(), tokens.end());
+    return Error::Ok;
+  };
+
+  // Pre-tokenizers that only split the text report the pieces as offsets, so
+  // they are copied one at a time into a reused buffer.
+  if (_pretokenizer->supports_offsets()) {
+    std::vector<Match> offsets;
+    _pretokenizer->pre_tokenize_offsets(normalized_input, offsets);
+    std::string piece;
+    for (const auto& offset : offsets) {
+      piece.assign(
+          normalized_input.substr(offset.start, offset.end - offset.start));
+      TK_CHECK_OK_OR_RETURN_ERROR(encode_piece(piece));
+    }
+    return Error::Ok;
+  }
+
+  // Pre-tokenizers that rewrite the text produce new strings anyway
+  if (!normalized) {
+    normalized_buffer.assign(input);
+  }
+  for (const auto& piece : _pretokenizer->pre_tokenize(normalized_buffer)) {
+    TK_CHECK_OK_OR_RETURN_ERROR(encode_piece(piece));
   }
   return Error::Ok;
 }
 
+Error HFTokenizer::_pre_tokenize(
+    std::string_view input,
+    std::vector<std::string>& pieces) const {
+  std::string normalized;
+  if (!_normalizer || !_normalizer->normalize_into(input, normalized)) {
+    normalized.assign(input);
+  }
+  for (auto& piece : _pretokenizer->pre_tokenize(normalized)) {
+    pieces.push_back(std::move(piece));
+  }
+  return Error::Ok;
+}
+
+std::vector<MemoryRegion> HFTokenizer::memory_regions() const {
+  auto regions = BPETokenizerBase::memory_regions();
+  if (merge_ranks_) {
+    merge_ranks_->forEachBuffer([&regions](const void* data, size_t size) {
+      regions.push_back({data, size});
+    });
+  }
+  return regions;
+}
+
+RegexStats HFTokenizer::regex_stats() const {
+  auto stats = BPETokenizerBase::regex_stats();
+  if (_pretokenizer) {
+    stats += _pretokenizer->regex_stats();
+  }
+  return stats;
+}
+
 void HFTokenizer::_decode(const std::string& input, std::string& ret) const {
   if (_decoder) {
     ret += _decoder->decode(input);
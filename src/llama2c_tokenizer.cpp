@@ -7,6 +7,7 @@
  */
 // @lint-ignore-every CLANGTIDY facebook-hte-RelativeInclude
 #include <pytorch/tokenizers/llama2c_tokenizer.h>
+#include <pytorch/tokenizers/work_counters.h>
 #include <cstring>
 
 namespace tokenizers {
@@ -117,6 +118,18 @@ Llama2cTokenizer::~Llama2cTokenizer() {
   }
 }
 
+std::vector<MemoryRegion> Llama2cTokenizer::memory_regions() const {
+  if (!initialized_) {
+    return {};
+  }
+  // The token strings are separate small allocations and are left out
+  return {
+      {vocab_.get(), vocab_size_ * sizeof(char*)},
+      {vocab_scores_.get(), vocab_size_ * sizeof(float)},
+      {sorted_vocab_.get(), vocab_size_ * sizeof(TokenIndex)},
+  };
+}
+
 /**
  * @brief Decode a token into string.
  *
@@ -142,6 +155,7 @@ Result<std::string> Llama2cTokenizer::decode(
     piece = (char*)byte_pieces_ + byte_val * 2;
   }
   std::string res(piece);
+  TK_COUNT_WORK(bytes_copied, res.size());
   return res;
 }
 
@@ -270,6 +284,7 @@ Result<std::vector<uint64_t>> Llama2cTokenizer::encode(
     int best_id = -1;
     int best_idx = -1;
 
+    TK_COUNT_WORK(merge_steps, tokens.size());
     for (int i = 0; i < tokens.size() - 1; i++) {
       // check if we can merge the pair (tokens[i], tokens[i+1])
       snprintf(
@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/native_regex.h>
+
+// Standard
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+// Local
+#include <pytorch/tokenizers/unicode_categories.h>
+#include <pytorch/tokenizers/unicode_normalization.h>
+#include <pytorch/tokenizers/work_counters.h>
+
+namespace tokenizers {
+
+namespace {
+
+constexpr std::string_view kCl100kPattern =
+    R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+)";
+constexpr std::string_view kCl100kPatternNoLookahead =
+    R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+)";
+
+// Strip capturing groups wrapping the whole pattern
+std::string_view strip_groups(std::string_view pattern) {
+  while (pattern.size() >= 2 && pattern.front() == '(' &&
+         pattern[1] != '?' && pattern.back() == ')') {
+    size_t backslashes = 0;
+    for (size_t i = pattern.size() - 1; i > 0 && pattern[i - 1] == '\\'; --i) {
+      ++backslashes;
+    }
+    if (backslashes % 2 != 0) {
+      break;
+    }
+    pattern = pattern.substr(1, pattern.size() - 2);
+  }
+  return pattern;
+}
+
+// How the cl100k pattern sees a character
+enum class CharClass : uint8_t {
+  Invalid, // not valid UTF-8, never matched
+  Letter, // \p{L}
+  Number, // \p{N}
+  Space, // \s other than \r and \n
+  Newline, // \r and \n
+  Other, // [^\s\p{L}\p{N}]
+};
+
+constexpr std::array<CharClass, 0x80> make_ascii_classes() {
+  std::array<CharClass, 0x80> classes{};
+  for (size_t c = 0; c < classes.size(); ++c) {
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
+      classes[c] = CharClass::Letter;
+    } else if (c >= '0' && c <= '9') {
+      classes[c] = CharClass::Number;
+    } else if (c == '\r' || c == '\n') {
+      classes[c] = CharClass::Newline;
+    } else if (c == '\t' || c == '\f' || c == ' ') {
+      classes[c] = CharClass::Space;
+    } else {
+      classes[c] = CharClass::Other;
+    }
+  }
+  return classes;
+}
+
+constexpr std::array<CharClass, 0x80> kAsciiClasses = make_ascii_classes();
+
+// Classify the character at data[pos] and return its length in bytes. \s is
+// [\t\n\f\r ] unless unicode_space is set, in which case it is White_Space.
+inline size_t classify_at(
+    const char* data,
+    size_t size,
+    size_t pos,
+    bool unicode_space,
+    CharClass& cls) {
+  const auto c = static_cast<unsigned char>(data[pos]);
+  if (c < 0x80) {
+    cls = unicode_space && c == '\v' ? CharClass::Space : kAsciiClasses[c];
+    return 1;
+  }
+  uint32_t cp;
+  size_t len = unicode::decode_utf8(data + pos, size - pos, cp);
+  if (cp == unicode::kInvalidCodepoint) {
+    // RE2 matches encoded surrogates (U+D800..U+DFFF) as characters of
+    // category Cs
+    const auto* s = reinterpret_cast<const unsigned char*>(data + pos);
+    if (c == 0xED && size - pos >= 3 && (s[1] & 0xE0) == 0xA0 &&
+        (s[2] & 0xC0) == 0x80) {
+      cls = CharClass::Other;
+      len = 3;
+    } else {
+      cls = CharClass::Invalid;
+    }
+  } else {
+    const uint8_t flags = unicode::categories(cp).flags;
+    if (unicode_space && (flags & unicode::kWhiteSpace)) {
+      cls = CharClass::Space;
+    } else if (flags & unicode::kLetter) {
+      cls = CharClass::Letter;
+    } else if (flags & unicode::kNumber) {
+      cls = CharClass::Number;
+    } else {
+      cls = CharClass::Other;
+    }
+  }
+  return len;
+}
+
+// End of the run of characters of class cls starting at pos
+inline size_t skip_class(
+    const char* data,
+    size_t size,
+    size_t pos,
+    bool unicode_space,
+    CharClass cls) {
+  while (pos < size) {
+    CharClass next;
+    const size_t len = classify_at(data, size, pos, unicode_space, next);
+    if (next != cls) {
+      break;
+    }
+    pos += len;
+  }
+  return pos;
+}
+
+inline char to_lower_ascii(char c) {
+  return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+// Length of the (?i:s|t|re|ve|m|ll|d) suffix at data[0], 0 if there is none
+size_t contraction_length(const char* data, size_t size) {
+  const char c = to_lower_ascii(data[0]);
+  if (c == 's' || c == 't' || c == 'm' || c == 'd') {
+    return 1;
+  }
+  if (size < 2) {
+    return 0;
+  }
+  // U+017F LATIN SMALL LETTER LONG S case folds to 's'
+  if (data[0] == '\xC5' && data[1] == '\xBF') {
+    return 2;
+  }
+  const char d = to_lower_ascii(data[1]);
+  if ((c == 'r' && d == 'e') || (c == 'v' && d == 'e') ||
+      (c == 'l' && d == 'l')) {
+    return 2;
+  }
+  return 0;
+}
+
+} // namespace
+
+// Cl100kRegex /////////////////////////////////////////////////////////////////
+
+Error Cl100kRegex::compile(const std::string& pattern) {
+  const std::string_view body = strip_groups(pattern);
+  if (body == kCl100kPattern) {
+    lookahead_ = true;
+  } else if (body == kCl100kPatternNoLookahead) {
+    lookahead_ = false;
+  } else {
+    return Error::RegexFailure;
+  }
+  compiled_ = true;
+  return Error::Ok;
+}
+
+size_t Cl100kRegex::match_at(const char* data, size_t size, size_t pos) const {
+  const bool unicode_space = lookahead_;
+  CharClass first;
+  const size_t next =
+      pos + classify_at(data, size, pos, unicode_space, first);
+  if (first == CharClass::Invalid) {
+    return 0;
+  }
+  CharClass second = CharClass::Invalid;
+  if (next < size) {
+    classify_at(data, size, next, unicode_space, second);
+  }
+
+  // (?i:'s|'t|'re|'ve|'m|'ll|'d)
+  if (data[pos] == '\'' && next < size) {
+    const size_t len = contraction_length(data + next, size - next);
+    if (len > 0) {
+      return next + len - pos;
+    }
+  }
+
+  // [^\r\n\p{L}\p{N}]?\p{L}+
+  if (first == CharClass::Letter ||
+      (first != CharClass::Number && first != CharClass::Newline &&
+       second == CharClass::Letter)) {
+    return skip_class(data, size, next, unicode_space, CharClass::Letter) -
+        pos;
+  }
+
+  // \p{N}{1,3}
+  if (first == CharClass::Number) {
+    size_t end = next;
+    for (int count = 1; count < 3 && end < size; ++count) {
+      CharClass cls;
+      const size_t len = classify_at(data, size, end, unicode_space, cls);
+      if (cls != CharClass::Number) {
+        break;
+      }
+      end += len;
+    }
+    return end - pos;
+  }
+
+  //  ?[^\s\p{L}\p{N}]+[\r\n]*
+  size_t start = std::string::npos;
+  if (data[pos] == ' ' && second == CharClass::Other) {
+    start = next;
+  } else if (first == CharClass::Other) {
+    start = pos;
+  }
+  if (start != std::string::npos) {
+    size_t end =
+        skip_class(data, size, start, unicode_space, CharClass::Other);
+    while (end < size && (data[end] == '\r' || data[end] == '\n')) {
+      ++end;
+    }
+    return end - pos;
+  }
+
+  // Only white space is left: \s*[\r\n]+|\s+(?!\S)|\s+
+  size_t end = pos;
+  size_t last_start = pos;
+  size_t last_newline = std::string::npos;
+  CharClass cls = first;
+  while (end < size) {
+    const size_t len = classify_at(data, size, end, unicode_space, cls);
+    if (cls == CharClass::Newline) {
+      last_newline = end;
+    } else if (cls != CharClass::Space) {
+      break;
+    }
+    last_start = end;
+    end += len;
+  }
+  if (last_newline != std::string::npos) {
+    return last_newline + 1 - pos;
+  }
+  // Give the last white space character to the following match
+  if (lookahead_ && end < size && cls != CharClass::Invalid &&
+      last_start > pos) {
+    return last_start - pos;
+  }
+  return end - pos;
+}
+
+std::vector<Match> Cl100kRegex::find_all(std::string_view text) const {
+  std::vector<Match> result;
+  if (!compiled_) {
+    TK_LOG(Error, "Regex is not compiled or invalid, run compile() first");
+    return result;
+  }
+  const char* data = text.data();
+  const size_t size = text.size();
+  size_t pos = 0;
+  while (pos < size) {
+    const size_t len = match_at(data, size, pos);
+    TK_COUNT_WORK(regex_steps, std::max<size_t>(len, 1));
+    if (len == 0) {
+      ++pos;
+      continue;
+    }
+    result.push_back({pos, pos + len});
+    pos += len;
+  }
+  return result;
+}
+
+// LiteralRegex ////////////////////////////////////////////////////////////////
+
+Error LiteralRegex::compile(const std::string& pattern) {
+  constexpr std::string_view kMetacharacters = "^$.?*+()[]{}";
+  const std::string_view body = strip_groups(pattern);
+
+  std::vector<std::string> literals(1);
+  for (size_t i = 0; i < body.size(); ++i) {
+    const char c = body[i];
+    if (c == '\\') {
+      if (i + 1 == body.size()) {
+        return Error::RegexFailure;
+      }
+      const char escaped = body[++i];
+      if (body.substr(i, 3) == "x00") {
+        // RE2::QuoteMeta spelling of NUL
+        literals.back().push_back('\0');
+        i += 2;
+      } else if (
+          (escaped >= 'a' && escaped <= 'z') ||
+          (escaped >= 'A' && escaped <= 'Z') ||
+          (escaped >= '0' && escaped <= '9')) {
+        // Character classes and other escape sequences
+        return Error::RegexFailure;
+      } else {
+        literals.back().push_back(escaped);
+      }
+    } else if (c == '|') {
+      literals.emplace_back();
+    } else if (kMetacharacters.find(c) != std::string_view::npos) {
+      return Error::RegexFailure;
+    } else {
+      literals.back().push_back(c);
+    }
+  }
+
+  for (auto& bucket : by_first_byte_) {
+    bucket.clear();
+  }
+  for (size_t i = 0; i < literals.size(); ++i) {
+    if (literals[i].empty()) {
+      return Error::RegexFailure;
+    }
+    const auto first = static_cast<unsigned char>(literals[i][0]);
+    by_first_byte_[first].push_back(static_cast<uint32_t>(i));
+  }
+  literals_ = std::move(literals);
+  return Error::Ok;
+}
+
+std::vector<Match> LiteralRegex::find_all(std::string_view text) const {
+  std::vector<Match> result;
+  const char* data = text.data();
+  const size_t size = text.size();
+  size_t pos = 0;
+  while (pos < size) {
+    size_t len = 0;
+    for (uint32_t index :
+         by_first_byte_[static_cast<unsigned char>(data[pos])]) {
+      const std::string& literal = literals_[index];
+      TK_COUNT_WORK(regex_steps, 1);
+      if (literal.size() <= size - pos &&
+          std::memcmp(data + pos, literal.data(), literal.size()) == 0) {
+        len = literal.size();
+        break;
+      }
+    }
+    TK_COUNT_WORK(regex_steps, 1);
+    if (len == 0) {
+      ++pos;
+      continue;
+    }
+    result.push_back({pos, pos + len});
+    pos += len;
+  }
+  return result;
+}
+
+// Factory /////////////////////////////////////////////////////////////////////
+
+Result<std::unique_ptr<IRegex>> create_native_regex(
+    const std::string& pattern) {
+  auto cl100k = std::make_unique<Cl100kRegex>();
+  if (cl100k->compile(pattern) == Error::Ok) {
+    return static_cast<std::unique_ptr<IRegex>>(std::move(cl100k));
+  }
+  auto literal = std::make_unique<LiteralRegex>();
+  if (literal->compile(pattern) == Error::Ok) {
+    return static_cast<std::unique_ptr<IRegex>>(std::move(literal));
+  }
+  return Error::RegexFailure;
+}
+
+} // namespace tokenizers
@@ -8,13 +8,14 @@
 // @lint-ignore-every LICENSELINT
 
 // Local
+#include <pytorch/tokenizers/base64.h>
 #include <pytorch/tokenizers/normalizer.h>
-
-// Third Party
-#include <unicode.h>
+#include <pytorch/tokenizers/simd_utils.h>
+#include <pytorch/tokenizers/unicode_normalization.h>
 
 // Standard
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <utility>
 
@@ -60,6 +61,51 @@ Normalizer::Ptr NormalizerConfig::create() const {
   if (type == "NFC") {
     return Normalizer::Ptr(new NFCNormalizer());
   }
+  if (type == "NFD") {
+    return Normalizer::Ptr(new NFDNormalizer());
+  }
+  if (type == "NFKC") {
+    return Normalizer::Ptr(new NFKCNormalizer());
+  }
+  if (type == "NFKD") {
+    return Normalizer::Ptr(new NFKDNormalizer());
+  }
+  if (type == "Lowercase") {
+    return Normalizer::Ptr(new LowercaseNormalizer());
+  }
+  if (type == "Strip") {
+    return Normalizer::Ptr(new StripNormalizer(
+        strip_left.value_or(true), strip_right.value_or(true)));
+  }
+  if (type == "StripAccents") {
+    return Normalizer::Ptr(new StripAccentsNormalizer());
+  }
+  if (type == "Prepend") {
+    if (!prepend) {
+      throw std::runtime_error(
+          "Missing prepend for Normalizer of type Prepend");
+    }
+    return Normalizer::Ptr(new PrependNormalizer(*prepend));
+  }
+  if (type == "BertNormalizer") {
+    return Normalizer::Ptr(new BertNormalizer(
+        clean_text.value_or(true),
+        handle_chinese_chars.value_or(true),
+        strip_accents,
+        lowercase.value_or(true)));
+  }
+  if (type == "Precompiled") {
+    std::string charsmap;
+    if (precompiled_charsmap && !precompiled_charsmap->empty()) {
+      auto decoded = base64::decode(*precompiled_charsmap);
+      if (!decoded.ok()) {
+        throw std::runtime_error(
+            "Invalid precompiled_charsmap for Normalizer of type Precompiled");
+      }
+      charsmap = std::move(decoded.get());
+    }
+    return Normalizer::Ptr(new PrecompiledNormalizer(std::move(charsmap)));
+  }
   throw std::runtime_error("Unsupported Normalizer type: " + type);
 }
 
@@ -82,17 +128,97 @@ NormalizerConfig& NormalizerConfig::parse_json(const json& json_config) {
     for (const auto& entry : json_config.at("normalizers")) {
       normalizers->push_back(NormalizerConfig().parse_json(entry));
     }
-  } else if (type == "NFC") {
-    // NFC normalizer has no additional configuration parameters
-    TK_LOG(
-        Info,
-        "Using NFC normalizer. Please notice that our implementation may not handle all edge cases.");
+  } else if (
+      type == "NFC" || type == "NFD" || type == "NFKC" || type == "NFKD" ||
+      type == "Lowercase" || type == "StripAccents") {
+    // No additional configuration parameters
+  } else if (type == "Strip") {
+    try {
+      strip_left = json_config.at("strip_left");
+    } catch (json::out_of_range&) {
+    }
+    try {
+      strip_right = json_config.at("strip_right");
+    } catch (json::out_of_range&) {
+    }
+  } else if (type == "Prepend") {
+    prepend = json_config.at("prepend");
+  } else if (type == "BertNormalizer") {
+    // All fields are optional, strip_accents may also be null
+    const auto parse_bool = [&](const char* key, std::optional<bool>& value) {
+      const auto it = json_config.find(key);
+      if (it != json_config.end() && !it->is_null()) {
+        value = it->get<bool>();
+      }
+    };
+    parse_bool("clean_text", clean_text);
+    parse_bool("handle_chinese_chars", handle_chinese_chars);
+    parse_bool("strip_accents", strip_accents);
+    parse_bool("lowercase", lowercase);
+  } else if (type == "Precompiled") {
+    // Null for SentencePiece models without a normalization rule
+    const auto it = json_config.find("precompiled_charsmap");
+    if (it != json_config.end() && !it->is_null()) {
+      precompiled_charsmap = it->get<std::string>();
+    }
   } else {
     throw std::runtime_error("Unsupported Normalizer type: " + type);
   }
   return *this;
 }
 
+//////////////////
+// Impl Details //
+//////////////////
+namespace {
+
+// Implements normalize() on top of normalize_into()
+std::string normalize_copy(
+    const Normalizer& normalizer,
+    const std::string& input) {
+  std::string out;
+  return normalizer.normalize_into(input, out) ? out : input;
+}
+
+/**
+ * Runs a chain of normalization steps over two alternating buffers, one of
+ * which is the caller's output buffer. A step that reports no change leaves
+ * the current text where it is.
+ */
+class BufferChain {
+ public:
+  BufferChain(std::string_view input, std::string& out)
+      : current_(input), buffers_{&out, &scratch_} {}
+
+  template <typename Step>
+  void apply(Step&& step) {
+    std::string& target = *buffers_[next_];
+    if (step(current_, target)) {
+      current_ = target;
+      next_ ^= 1;
+      changed_ = true;
+    }
+  }
+
+  /** Move the result into the output buffer, returns whether it changed */
+  bool finish() {
+    if (changed_ && next_ == 0) {
+      // The last step wrote to the scratch buffer
+      buffers_[0]->swap(scratch_);
+    }
+    return changed_;
+  }
+
+ private:
+  std::string_view current_;
+  std::string scratch_;
+  std::string* buffers_[2];
+  size_t next_ = 0;
+  bool changed_ = false;
+};
+
+} // namespace
+
 // ReplaceNormalizer ///////////////////////////////////////////////////////////
 
 std::unique_ptr<IRegex> ReplaceNormalizer::create_regex_(
@@ -107,19 +233,28 @@ std::unique_ptr<IRegex> ReplaceNormalizer::create_regex_(
 }
 
 std::string ReplaceNormalizer::normalize(const std::string& input) const {
-  if (!regex_)
-    return input;
-
-  std::string result = input;
-  auto matches = regex_->find_all(result);
+  return normalize_copy(*this, input);
+}
 
-  // Process matches in reverse order to avoid offset issues
-  for (auto it = matches.rbegin(); it != matches.rend(); ++it) {
-    const auto& match = *it;
-    result.replace(match.start, match.end - match.start, content_);
+bool ReplaceNormalizer::normalize_into(std::string_view input, std::string& out)
+    const {
+  if (!regex_) {
+    return false;
+  }
+  const auto matches = regex_->find_all(input);
+  if (matches.empty()) {
+    return false;
   }
 
-  return result;
+  out.clear();
+  size_t last_end = 0;
+  for (const auto& match : matches) {
+    out.append(input.data() + last_end, match.start - last_end);
+    out.append(content_);
+    last_end = match.end;
+  }
+  out.append(input.data() + last_end, input.size() - last_end);
+  return true;
 }
 
 // SequenceNormalizer //////////////////////////////////////////////////////////
@@ -128,29 +263,410 @@ SequenceNormalizer::SequenceNormalizer(std::vector<Normalizer::Ptr> normalizers)
     : normalizers_(std::move(normalizers)) {}
 
 std::string SequenceNormalizer::normalize(const std::string& input) const {
-  std::string result = input;
+  return normalize_copy(*this, input);
+}
+
+bool SequenceNormalizer::normalize_into(
+    std::string_view input,
+    std::string& out) const {
+  BufferChain chain(input, out);
   for (const auto& normalizer : normalizers_) {
-    result = normalizer->normalize(result);
+    chain.apply([&](std::string_view text, std::string& target) {
+      return normalizer->normalize_into(text, target);
+    });
   }
-  return result;
+  return chain.finish();
 }
 
 // NFCNormalizer ///////////////////////////////////////////////////////////////
 
 std::string NFCNormalizer::normalize(const std::string& input) const {
-  // Convert UTF-8 string to codepoints
-  auto codepoints = unicode_cpts_from_utf8(input);
+  return normalize_copy(*this, input);
+}
+
+bool NFCNormalizer::normalize_into(std::string_view input, std::string& out)
+    const {
+  return unicode::normalize(input, unicode::NormalizationForm::NFC, out);
+}
+
+// NFDNormalizer ///////////////////////////////////////////////////////////////
+
+std::string NFDNormalizer::normalize(const std::string& input) const {
+  return normalize_copy(*this, input);
+}
+
+bool NFDNormalizer::normalize_into(std::string_view input, std::string& out)
+    const {
+  return unicode::normalize(input, unicode::NormalizationForm::NFD, out);
+}
+
+// NFKCNormalizer //////////////////////////////////////////////////////////////
+
+std::string NFKCNormalizer::normalize(const std::string& input) const {
+  return normalize_copy(*this, input);
+}
+
+bool NFKCNormalizer::normalize_into(std::string_view input, std::string& out)
+    const {
+  return unicode::normalize(input, unicode::NormalizationForm::NFKC, out);
+}
+
+// NFKDNormalizer //////////////////////////////////////////////////////////////
+
+std::string NFKDNormalizer::normalize(const std::string& input) const {
+  return normalize_copy(*this, input);
+}
+
+bool NFKDNormalizer::normalize_into(std::string_view input, std::string& out)
+    const {
+  return unicode::normalize(input, unicode::NormalizationForm::NFKD, out);
+}
+
+// LowercaseNormalizer /////////////////////////////////////////////////////////
+
+std::string LowercaseNormalizer::normalize(const std::string& input) const {
+  return normalize_copy(*this, input);
+}
+
+bool LowercaseNormalizer::normalize_into(
+    std::string_view input,
+    std::string& out) const {
+  return unicode::to_lower(input, out);
+}
+
+// StripNormalizer /////////////////////////////////////////////////////////////
 
-  // Apply NFC normalization
-  auto normalized_cpts = unicode_cpts_normalize_nfc(codepoints);
+std::string StripNormalizer::normalize(const std::string& input) const {
+  return normalize_copy(*this, input);
+}
 
-  // Convert back to UTF-8 string
-  std::string result;
-  for (uint32_t cpt : normalized_cpts) {
-    result += unicode_cpt_to_utf8(cpt);
+bool StripNormalizer::normalize_into(std::string_view input, std::string& out)
+    const {
+  const char* data = input.data();
+  size_t begin = 0;
+  size_t end = input.size();
+  if (left_) {
+    while (begin < end) {
+      uint32_t cp;
+      const size_t len = unicode::decode_utf8(data + begin, end - begin, cp);
+      if (!unicode::is_whitespace(cp)) {
+        break;
+      }
+      begin += len;
+    }
+  }
+  if (right_) {
+    while (end > begin) {
+      // Step back to the first byte of the last code point
+      size_t start = end - 1;
+      while (start > begin && end - start < 4 &&
+             (static_cast<unsigned char>(data[start]) & 0xC0) == 0x80) {
+        --start;
+      }
+      uint32_t cp;
+      const size_t len = unicode::decode_utf8(data + start, end - start, cp);
+      if (start + len != end || !unicode::is_whitespace(cp)) {
+        break;
+      }
+      end = start;
+    }
+  }
+  if (begin == 0 && end == input.size()) {
+    return false;
   }
+  out.assign(data + begin, end - begin);
+  return true;
+}
+
+// StripAccentsNormalizer //////////////////////////////////////////////////////
+
+std::string StripAccentsNormalizer::normalize(const std::string& input) const {
+  return normalize_copy(*this, input);
+}
 
-  return result;
+bool StripAccentsNormalizer::normalize_into(
+    std::string_view input,
+    std::string& out) const {
+  return unicode::remove_nonspacing_marks(input, out);
+}
+
+// PrependNormalizer ///////////////////////////////////////////////////////////
+
+std::string PrependNormalizer::normalize(const std::string& input) const {
+  return normalize_copy(*this, input);
+}
+
+bool PrependNormalizer::normalize_into(std::string_view input, std::string& out)
+    const {
+  if (input.empty() || prepend_.empty()) {
+    return false;
+  }
+  out.reserve(prepend_.size() + input.size());
+  out.assign(prepend_);
+  out.append(input);
+  return true;
+}
+
+// BertNormalizer //////////////////////////////////////////////////////////////
+
+namespace {
+
+bool is_bert_whitespace(uint32_t cp) {
+  return cp == '\t' || cp == '\n' || cp == '\r' || unicode::is_whitespace(cp);
+}
+
+bool is_bert_control(uint32_t cp) {
+  if (cp == '\t' || cp == '\n' || cp == '\r') {
+    return false;
+  }
+  return unicode::lookup(cp).flags & unicode::kOther;
+}
+
+bool is_chinese_char(uint32_t cp) {
+  return (cp >= 0x4E00 && cp <= 0x9FFF) || (cp >= 0x3400 && cp <= 0x4DBF) ||
+      (cp >= 0x20000 && cp <= 0x2A6DF) || (cp >= 0x2A700 && cp <= 0x2B73F) ||
+      (cp >= 0x2B740 && cp <= 0x2B81F) || (cp >= 0x2B920 && cp <= 0x2CEAF) ||
+      (cp >= 0xF900 && cp <= 0xFAFF) || (cp >= 0x2F800 && cp <= 0x2FA1F);
+}
+
+} // namespace
+
+std::string BertNormalizer::normalize(const std::string& input) const {
+  return normalize_copy(*this, input);
+}
+
+bool BertNormalizer::normalize_into(std::string_view input, std::string& out)
+    const {
+  BufferChain chain(input, out);
+  if (clean_text_ || handle_chinese_chars_) {
+    chain.apply([&](std::string_view text, std::string& target) {
+      return clean_text_and_chinese_chars(text, target);
+    });
+  }
+  if (strip_accents_) {
+    chain.apply([](std::string_view text, std::string& target) {
+      return unicode::normalize(text, unicode::NormalizationForm::NFD, target);
+    });
+    chain.apply([](std::string_view text, std::string& target) {
+      return unicode::remove_nonspacing_marks(text, target);
+    });
+  }
+  if (lowercase_) {
+    chain.apply([](std::string_view text, std::string& target) {
+      return unicode::to_lower(text, target);
+    });
+  }
+  return chain.finish();
+}
+
+bool BertNormalizer::clean_text_and_chinese_chars(
+    std::string_view input,
+    std::string& out) const {
+  const char* data = input.data();
+  const size_t size = input.size();
+  bool changed = false;
+  size_t copied = 0;
+  size_t i = 0;
+  while (i < size) {
+    // Printable ASCII never changes, controls and whitespace only matter
+    // when cleaning text
+    i += clean_text_ ? detail::find_ascii_control_or_non_ascii(data + i, size - i)
+                     : detail::ascii_prefix_length(data + i, size - i);
+    if (i == size) {
+      break;
+    }
+    uint32_t cp;
+    const size_t len = unicode::decode_utf8(data + i, size - i, cp);
+    const char* replacement = nullptr;
+    bool surround = false;
+    if (cp == unicode::kInvalidCodepoint) {
+      // Pass through
+    } else if (
+        clean_text_ && (cp == 0 || cp == 0xFFFD || is_bert_control(cp))) {
+      replacement = "";
+    } else if (clean_text_ && cp != ' ' && is_bert_whitespace(cp)) {
+      replacement = " ";
+    } else if (handle_chinese_chars_ && is_chinese_char(cp)) {
+      surround = true;
+    }
+    if (replacement || surround) {
+      if (!changed) {
+        out.clear();
+        out.reserve(size + 16);
+        changed = true;
+      }
+      out.append(data + copied, i - copied);
+      if (surround) {
+        out.push_back(' ');
+        out.append(data + i, len);
+        out.push_back(' ');
+      } else {
+        out.append(replacement);
+      }
+      copied = i + len;
+    }
+    i += len;
+  }
+  if (changed) {
+    out.append(data + copied, size - copied);
+  }
+  return changed;
+}
+
+// PrecompiledNormalizer //////////////////////////////////////////////////////
+
+namespace {
+
+// Fields of a Darts-clone double-array unit
+
+bool unit_has_leaf(uint32_t unit) {
+  return (unit >> 8) & 1;
+}
+
+uint32_t unit_value(uint32_t unit) {
+  return unit & ((1U << 31) - 1);
+}
+
+uint32_t unit_label(uint32_t unit) {
+  return unit & ((1U << 31) | 0xFF);
+}
+
+uint32_t unit_offset(uint32_t unit) {
+  return (unit >> 10) << ((unit & (1U << 9)) >> 6);
+}
+
+// The charsmap is little-endian and its units may not be aligned
+uint32_t load_le32(const char* data) {
+  uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  value = __builtin_bswap32(value);
+#endif
+  return value;
+}
+
+} // namespace
+
+PrecompiledNormalizer::PrecompiledNormalizer(std::string charsmap)
+    : charsmap_(std::move(charsmap)) {
+  if (!charsmap_.empty()) {
+    if (charsmap_.size() < sizeof(uint32_t)) {
+      throw std::runtime_error("Truncated precompiled charsmap");
+    }
+    const size_t trie_size = load_le32(charsmap_.data());
+    if (trie_size % sizeof(uint32_t) != 0 ||
+        trie_size > charsmap_.size() - sizeof(uint32_t)) {
+      throw std::runtime_error("Invalid trie size in precompiled charsmap");
+    }
+    units_ = charsmap_.data() + sizeof(uint32_t);
+    num_units_ = trie_size / sizeof(uint32_t);
+    normalized_ = std::string_view(charsmap_)
+                      .substr(sizeof(uint32_t) + trie_size);
+  }
+
+  // An ASCII byte maps to itself unless it is the first byte of a key
+  const size_t root = num_units_ ? unit_offset(unit(0)) : 0;
+  for (uint32_t c = 0; c < ascii_identity_.size(); ++c) {
+    const size_t pos = root ^ c;
+    ascii_identity_[c] =
+        c == 0 || pos >= num_units_ || unit_label(unit(pos)) != c;
+  }
+  printable_ascii_identity_ = std::all_of(
+      ascii_identity_.begin() + 0x20,
+      ascii_identity_.begin() + 0x7F,
+      [](bool identity) { return identity; });
+}
+
+uint32_t PrecompiledNormalizer::unit(size_t index) const {
+  return load_le32(units_ + index * sizeof(uint32_t));
+}
+
+size_t PrecompiledNormalizer::longest_match(
+    const char* text,
+    size_t size,
+    std::string_view& replacement) const {
+  size_t match_length = 0;
+  size_t node = unit_offset(unit(0));
+  for (size_t i = 0; i < size && text[i] != '\0'; ++i) {
+    const uint8_t c = static_cast<uint8_t>(text[i]);
+    node ^= c;
+    if (node >= num_units_) {
+      break;
+    }
+    const uint32_t current = unit(node);
+    if (unit_label(current) != c) {
+      break;
+    }
+    node ^= unit_offset(current);
+    if (node >= num_units_) {
+      break;
+    }
+    if (unit_has_leaf(current)) {
+      const size_t value = unit_value(unit(node));
+      if (value < normalized_.size()) {
+        const size_t end = normalized_.find('\0', value);
+        replacement = normalized_.substr(
+            value, end == std::string_view::npos ? end : end - value);
+        match_length = i + 1;
+      }
+    }
+  }
+  return match_length;
+}
+
+std::string PrecompiledNormalizer::normalize(const std::string& input) const {
+  return normalize_copy(*this, input);
+}
+
+bool PrecompiledNormalizer::normalize_into(
+    std::string_view input,
+    std::string& out) const {
+  if (num_units_ == 0) {
+    return false;
+  }
+  const char* data = input.data();
+  const size_t size = input.size();
+  bool changed = false;
+  size_t copied = 0;
+  size_t i = 0;
+  while (i < size) {
+    if (printable_ascii_identity_) {
+      i += detail::find_ascii_control_or_non_ascii(data + i, size - i);
+      if (i == size) {
+        break;
+      }
+    }
+    const uint8_t c = static_cast<uint8_t>(data[i]);
+    if (c < 0x80 && ascii_identity_[c]) {
+      ++i;
+      continue;
+    }
+    std::string_view replacement;
+    const size_t length = longest_match(data + i, size - i, replacement);
+    if (length == 0) {
+      // Unmapped characters are copied as they are
+      uint32_t cp;
+      i += unicode::decode_utf8(data + i, size - i, cp);
+      continue;
+    }
+    if (replacement == input.substr(i, length)) {
+      i += length;
+      continue;
+    }
+    if (!changed) {
+      out.clear();
+      out.reserve(size + 16);
+      changed = true;
+    }
+    out.append(data + copied, i - copied);
+    out.append(replacement);
+    i += length;
+    copied = i;
+  }
+  if (changed) {
+    out.append(data + copied, size - copied);
+  }
+  return changed;
 }
 
 } // namespace tokenizers
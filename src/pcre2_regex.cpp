@@ -58,7 +58,7 @@ Pcre2Regex::~Pcre2Regex() {
   }
 }
 
-std::vector<Match> Pcre2Regex::find_all(const std::string& text) const {
+std::vector<Match> Pcre2Regex::find_all(std::string_view text) const {
   std::vector<Match> result;
 
   if (!regex_ || !match_data_) {
@@ -67,7 +67,7 @@ std::vector<Match> Pcre2Regex::find_all(const std::string& text) const {
   }
 
   PCRE2_SIZE* ovector;
-  PCRE2_SPTR subject = reinterpret_cast<PCRE2_SPTR>(text.c_str());
+  PCRE2_SPTR subject = reinterpret_cast<PCRE2_SPTR>(text.data());
   PCRE2_SIZE subject_length = text.length();
   PCRE2_SIZE offset = 0;
 
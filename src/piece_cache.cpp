@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/piece_cache.h>
+
+// Standard
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+// Local
+#include <pytorch/tokenizers/log.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tokenizers {
+
+namespace {
+
+constexpr uint64_t kMagic = 0x544b504345434845; // "TKPCECHE"
+constexpr uint32_t kVersion = 1;
+constexpr size_t kSlotWords = 15;
+constexpr size_t kPieceWords = SharedPieceCache::kMaxPieceBytes / 8;
+constexpr size_t kTokenWords = SharedPieceCache::kMaxTokens / 2;
+
+// Payload word layout
+constexpr size_t kKeyWord = 0;
+constexpr size_t kStampWord = 1;
+// Piece length, token count and checksum
+constexpr size_t kInfoWord = 2;
+constexpr size_t kPieceWord = 3;
+constexpr size_t kTokenWord = kPieceWord + kPieceWords;
+static_assert(kTokenWord + kTokenWords == kSlotWords);
+
+enum HeaderState : uint32_t {
+  kFresh = 0,
+  kInitializing = 1,
+  kReady = 2,
+};
+
+// splitmix64 finalizer, a bijection
+inline uint64_t mix(uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+inline uint64_t hash_bytes(std::string_view bytes) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char c : bytes) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+// Since mix is a bijection, equal keys for the same piece imply equal
+// fingerprints, so the fingerprint does not need to be stored
+inline uint64_t make_key(uint64_t fingerprint, std::string_view piece) {
+  return mix(fingerprint ^ hash_bytes(piece));
+}
+
+// Checksum of the payload, stored in the upper half of the info word
+inline uint32_t checksum(const uint64_t* words) {
+  uint64_t hash = 0;
+  for (size_t i = 0; i < kSlotWords; ++i) {
+    const uint64_t word = i == kInfoWord ? words[i] & 0xffffffff : words[i];
+    hash = mix(hash ^ word);
+  }
+  return static_cast<uint32_t>(hash >> 32);
+}
+
+size_t round_up_to_power_of_two(size_t n) {
+  size_t result = 1;
+  while (result < n) {
+    result <<= 1;
+  }
+  return result;
+}
+
+} // namespace
+
+struct alignas(128) SharedPieceCache::Header {
+  std::atomic<uint32_t> state;
+  uint32_t version;
+  uint64_t magic;
+  uint64_t num_slots;
+  // Source of the stamps used to pick the oldest entry to evict
+  std::atomic<uint64_t> clock;
+};
+
+struct alignas(128) SharedPieceCache::Slot {
+  // Odd while a writer is updating the payload
+  std::atomic<uint64_t> sequence;
+  std::atomic<uint64_t> words[kSlotWords];
+};
+
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t));
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+// Construction ////////////////////////////////////////////////////////////////
+
+SharedPieceCache::SharedPieceCache(
+    void* mapping,
+    size_t mapping_size,
+    size_t num_slots)
+    : mapping_(mapping), mapping_size_(mapping_size), num_slots_(num_slots) {}
+
+SharedPieceCache::~SharedPieceCache() {
+#ifndef _WIN32
+  munmap(mapping_, mapping_size_);
+#endif
+}
+
+Result<std::shared_ptr<SharedPieceCache>> SharedPieceCache::open(
+    const std::string& name,
+    size_t num_slots) {
+#if defined(_WIN32)
+  (void)name;
+  (void)num_slots;
+  TK_LOG(Error, "SharedPieceCache needs POSIX shared memory");
+  return Error::LoadFailure;
+#else
+  num_slots = round_up_to_power_of_two(std::max(num_slots, kProbeWindow));
+  const size_t mapping_size = sizeof(Header) + num_slots * sizeof(Slot);
+
+  void* mapping = MAP_FAILED;
+  if (name.empty()) {
+    mapping = mmap(
+        nullptr,
+        mapping_size,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_ANONYMOUS,
+        -1,
+        0);
+  } else {
+#ifdef __ANDROID__
+    TK_LOG(Error, "Named shared memory is not available on Android");
+    return Error::LoadFailure;
+#else
+    const int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+    TK_CHECK_OR_RETURN_ERROR(
+        fd >= 0, LoadFailure, "shm_open(%s) failed", name.c_str());
+    struct stat st;
+    bool ok = fstat(fd, &st) == 0;
+    // A new segment is empty. Every process that sees it empty sizes it, with
+    // the same result. Pages are zero-filled, i.e. all slots are empty.
+    if (ok && st.st_size == 0) {
+      ok = ftruncate(fd, static_cast<off_t>(mapping_size)) == 0;
+    } else if (ok && static_cast<size_t>(st.st_size) != mapping_size) {
+      TK_LOG(
+          Error,
+          "Segment %s has %zu bytes, expected %zu for %zu slots",
+          name.c_str(),
+          static_cast<size_t>(st.st_size),
+          mapping_size,
+          num_slots);
+      ok = false;
+    }
+    if (ok) {
+      mapping = mmap(
+          nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+#endif
+  }
+  TK_CHECK_OR_RETURN_ERROR(
+      mapping != MAP_FAILED, LoadFailure, "Could not map %s", name.c_str());
+
+  // The first process to get here fills in the header
+  auto* header = static_cast<Header*>(mapping);
+  uint32_t state = kFresh;
+  if (header->state.compare_exchange_strong(
+          state, kInitializing, std::memory_order_acquire)) {
+    header->magic = kMagic;
+    header->version = kVersion;
+    header->num_slots = num_slots;
+    header->state.store(kReady, std::memory_order_release);
+  } else {
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (header->state.load(std::memory_order_acquire) != kReady &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+  }
+  if (header->state.load(std::memory_order_acquire) != kReady ||
+      header->magic != kMagic || header->version != kVersion ||
+      header->num_slots != num_slots) {
+    TK_LOG(Error, "Segment %s is not a compatible cache", name.c_str());
+    munmap(mapping, mapping_size);
+    return Error::LoadFailure;
+  }
+
+  return std::shared_ptr<SharedPieceCache>(
+      new SharedPieceCache(mapping, mapping_size, num_slots));
+#endif
+}
+
+Error SharedPieceCache::unlink(const std::string& name) {
+#if defined(_WIN32) || defined(__ANDROID__)
+  (void)name;
+  return Error::LoadFailure;
+#else
+  TK_CHECK_OR_RETURN_ERROR(
+      shm_unlink(name.c_str()) == 0,
+      LoadFailure,
+      "shm_unlink(%s) failed",
+      name.c_str());
+  return Error::Ok;
+#endif
+}
+
+SharedPieceCache::Slot* SharedPieceCache::slot(size_t index) const {
+  auto* slots = reinterpret_cast<Slot*>(static_cast<Header*>(mapping_) + 1);
+  return slots + (index & (num_slots_ - 1));
+}
+
+// Lookup and insert ///////////////////////////////////////////////////////////
+
+bool SharedPieceCache::lookup(
+    uint64_t model_fingerprint,
+    std::string_view piece,
+    std::vector<uint64_t>& tokens) const {
+  if (piece.size() > kMaxPieceBytes) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  const uint64_t key = make_key(model_fingerprint, piece);
+  for (size_t i = 0; i < kProbeWindow; ++i) {
+    const Slot* entry = slot(key + i);
+    const uint64_t sequence = entry->sequence.load(std::memory_order_acquire);
+    if (entry->words[kKeyWord].load(std::memory_order_relaxed) != key) {
+      continue;
+    }
+    uint64_t words[kSlotWords] = {};
+    for (size_t w = 0; w < kSlotWords; ++w) {
+      words[w] = entry->words[w].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t sequence_after =
+        entry->sequence.load(std::memory_order_relaxed);
+
+    const uint64_t info = words[kInfoWord];
+    const size_t piece_size = info & 0xff;
+    const size_t num_tokens = (info >> 8) & 0xff;
+    if ((sequence & 1) != 0 || sequence != sequence_after ||
+        words[kKeyWord] != key || piece_size != piece.size() ||
+        num_tokens == 0 || num_tokens > kMaxTokens ||
+        static_cast<uint32_t>(info >> 32) != checksum(words) ||
+        std::memcmp(&words[kPieceWord], piece.data(), piece.size()) != 0) {
+      rejected_reads_.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+
+    const auto* ids = reinterpret_cast<const uint32_t*>(&words[kTokenWord]);
+    tokens.insert(tokens.end(), ids, ids + num_tokens);
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+void SharedPieceCache::insert(
+    uint64_t model_fingerprint,
+    std::string_view piece,
+    const uint64_t* tokens,
+    size_t num_tokens) {
+  if (piece.empty() || piece.size() > kMaxPieceBytes || num_tokens == 0 ||
+      num_tokens > kMaxTokens) {
+    return;
+  }
+  uint64_t words[kSlotWords] = {};
+  auto* ids = reinterpret_cast<uint32_t*>(&words[kTokenWord]);
+  for (size_t i = 0; i < num_tokens; ++i) {
+    if (tokens[i] > std::numeric_limits<uint32_t>::max()) {
+      return;
+    }
+    ids[i] = static_cast<uint32_t>(tokens[i]);
+  }
+  const uint64_t key = make_key(model_fingerprint, piece);
+  if (key == 0) {
+    // Reserved for empty slots
+    return;
+  }
+
+  // Pick the slot holding this key, else an empty one, else the oldest
+  Slot* victim = nullptr;
+  uint64_t victim_stamp = std::numeric_limits<uint64_t>::max();
+  for (size_t i = 0; i < kProbeWindow; ++i) {
+    Slot* entry = slot(key + i);
+    const uint64_t entry_key =
+        entry->words[kKeyWord].load(std::memory_order_relaxed);
+    if (entry_key == key) {
+      // Already cached, possibly by another process
+      return;
+    }
+    const uint64_t stamp = entry_key == 0
+        ? 0
+        : entry->words[kStampWord].load(std::memory_order_relaxed) + 1;
+    if (stamp < victim_stamp) {
+      victim = entry;
+      victim_stamp = stamp;
+    }
+  }
+
+  // Claim the slot. If another writer holds it, drop this entry instead of
+  // waiting.
+  uint64_t sequence = victim->sequence.load(std::memory_order_relaxed);
+  if ((sequence & 1) != 0 ||
+      !victim->sequence.compare_exchange_strong(
+          sequence, sequence + 1, std::memory_order_relaxed)) {
+    return;
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+
+  const bool evicted =
+      victim->words[kKeyWord].load(std::memory_order_relaxed) != 0;
+  auto* header = static_cast<Header*>(mapping_);
+  words[kKeyWord] = key;
+  words[kStampWord] = header->clock.fetch_add(1, std::memory_order_relaxed);
+  std::memcpy(&words[kPieceWord], piece.data(), piece.size());
+  words[kInfoWord] = piece.size() | num_tokens << 8;
+  words[kInfoWord] |= static_cast<uint64_t>(checksum(words)) << 32;
+  for (size_t w = 0; w < kSlotWords; ++w) {
+    victim->words[w].store(words[w], std::memory_order_relaxed);
+  }
+  victim->sequence.store(sequence + 2, std::memory_order_release);
+
+  inserts_.fetch_add(1, std::memory_order_relaxed);
+  if (evicted) {
+    evictions_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+PieceCacheStats SharedPieceCache::stats() const {
+  PieceCacheStats stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  stats.inserts = inserts_.load(std::memory_order_relaxed);
+  stats.evictions = evictions_.load(std::memory_order_relaxed);
+  stats.rejected_reads = rejected_reads_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+} // namespace tokenizers
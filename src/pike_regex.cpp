@@ -0,0 +1,1146 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/pike_regex.h>
+
+// Standard
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <utility>
+
+// Local
+#include <pytorch/tokenizers/log.h>
+#include <pytorch/tokenizers/unicode_categories.h>
+#include <pytorch/tokenizers/unicode_normalization.h>
+#include <pytorch/tokenizers/work_counters.h>
+
+namespace tokenizers {
+
+namespace {
+
+using unicode::GeneralCategory;
+using unicode::decode_utf8;
+using unicode::kInvalidCodepoint;
+
+constexpr uint32_t kMaxCodepoint = 0x10FFFF;
+
+// Bounds on the pattern, so that compiling stays cheap and does not recurse
+// too deep
+constexpr int kMaxDepth = 200;
+constexpr int kMaxRepeat = 1000;
+constexpr size_t kMaxInstructions = 1 << 16;
+
+// clang-format off
+constexpr const char* kCategoryNames[] = {
+    "Lu", "Ll", "Lt", "Lm", "Lo",
+    "Mn", "Mc", "Me",
+    "Nd", "Nl", "No",
+    "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po",
+    "Sm", "Sc", "Sk", "So",
+    "Zs", "Zl", "Zp",
+    "Cc", "Cf", "Cs", "Co", "Cn",
+};
+// clang-format on
+
+constexpr uint32_t category_bit(GeneralCategory category) {
+  return 1u << static_cast<uint32_t>(category);
+}
+
+// -- Character classes --------------------------------------------------------
+
+// A set of code points: the union of its items, complemented if negated
+struct CharClass {
+  struct Item {
+    enum Kind : uint8_t { kRange, kCategories, kFlags, kScript };
+    Kind kind;
+    bool negated;
+    // First code point, category bit mask, unicode:: flags or script id
+    uint32_t lo;
+    // Last code point of a range
+    uint32_t hi;
+  };
+
+  std::vector<Item> items;
+  bool negated = false;
+  // Membership of the ASCII code points, filled in by finalize()
+  uint64_t ascii[2] = {0, 0};
+
+  bool contains_slow(uint32_t cp) const {
+    bool found = false;
+    for (const auto& item : items) {
+      bool in = false;
+      switch (item.kind) {
+        case Item::kRange:
+          in = item.lo <= cp && cp <= item.hi;
+          break;
+        case Item::kCategories:
+          in = (item.lo & category_bit(unicode::general_category(cp))) != 0;
+          break;
+        case Item::kFlags:
+          in = (unicode::categories(cp).flags & item.lo) != 0;
+          break;
+        case Item::kScript:
+          in = unicode::categories(cp).script == item.lo;
+          break;
+      }
+      if (in != item.negated) {
+        found = true;
+        break;
+      }
+    }
+    return found != negated;
+  }
+
+  void finalize() {
+    for (uint32_t cp = 0; cp < 128; ++cp) {
+      if (contains_slow(cp)) {
+        ascii[cp >> 6] |= uint64_t(1) << (cp & 63);
+      }
+    }
+  }
+
+  bool contains(uint32_t cp) const {
+    if (cp < 128) {
+      return (ascii[cp >> 6] >> (cp & 63)) & 1;
+    }
+    // Invalid UTF-8 bytes are in no class, not even negated ones
+    return cp <= kMaxCodepoint && contains_slow(cp);
+  }
+};
+
+// -- Program ------------------------------------------------------------------
+
+enum class Op : uint8_t {
+  // Consume a code point of class x
+  kChar,
+  // Continue at x, then at the lower priority y
+  kSplit,
+  kJmp,
+  // Assertions on the current position
+  kBegin,
+  kEnd,
+  kEndOrNewline,
+  // Code point at the current position is (not) of class x
+  kLookahead,
+  kNegativeLookahead,
+  kMatch,
+};
+
+struct Inst {
+  Op op;
+  uint32_t x;
+  uint32_t y;
+};
+
+} // namespace
+
+struct PikeRegex::Program {
+  std::vector<Inst> insts;
+  std::vector<CharClass> classes;
+  // ASCII code points that can start a match. Searches skip other ASCII code
+  // points while no thread is running, unless can_skip is false because the
+  // pattern can match the empty string.
+  uint64_t first_ascii[2] = {0, 0};
+  bool can_skip = false;
+};
+
+namespace {
+
+// -- Parser -------------------------------------------------------------------
+
+struct Node {
+  enum Kind : uint8_t {
+    kEmpty,
+    kClass,
+    kConcat,
+    kAlternate,
+    kRepeat,
+    kAssert,
+    kLookahead,
+  };
+  Kind kind = kEmpty;
+  // Class index (kClass, kLookahead) or Op (kAssert)
+  uint32_t value = 0;
+  // kLookahead
+  bool negated = false;
+  // kRepeat, max < 0 is unbounded
+  int min = 0;
+  int max = 0;
+  bool greedy = true;
+  std::vector<uint32_t> children;
+};
+
+/**
+ * Recursive descent parser building a syntax tree, which emit() turns into
+ * the program. Every function returns false with error_ set on patterns
+ * outside the supported syntax.
+ */
+class Compiler {
+ public:
+  Compiler(const std::string& pattern, PikeRegex::Program& program)
+      : pattern_(pattern), program_(program) {}
+
+  bool compile() {
+    uint32_t root = 0;
+    if (!parse_alternation(root, 0)) {
+      return false;
+    }
+    if (pos_ < pattern_.size()) {
+      return fail("unbalanced )");
+    }
+    if (!emit(root)) {
+      return false;
+    }
+    program_.insts.push_back({Op::kMatch, 0, 0});
+    for (auto& cls : program_.classes) {
+      cls.finalize();
+    }
+    compute_first();
+    return true;
+  }
+
+  const char* error() const {
+    return error_;
+  }
+
+  size_t error_offset() const {
+    return pos_;
+  }
+
+ private:
+  bool fail(const char* error) {
+    error_ = error;
+    return false;
+  }
+
+  bool at(char c) const {
+    return pos_ < pattern_.size() && pattern_[pos_] == c;
+  }
+
+  bool at(const char* s) const {
+    return pattern_.compare(pos_, std::strlen(s), s) == 0;
+  }
+
+  uint32_t add_node(Node node) {
+    nodes_.push_back(std::move(node));
+    return static_cast<uint32_t>(nodes_.size() - 1);
+  }
+
+  uint32_t add_class_node(CharClass cls) {
+    program_.classes.push_back(std::move(cls));
+    Node node;
+    node.kind = Node::kClass;
+    node.value = static_cast<uint32_t>(program_.classes.size() - 1);
+    return add_node(std::move(node));
+  }
+
+  bool parse_alternation(uint32_t& out, int depth) {
+    if (depth > kMaxDepth) {
+      return fail("groups nested too deep");
+    }
+    Node alternate;
+    alternate.kind = Node::kAlternate;
+    while (true) {
+      uint32_t branch = 0;
+      if (!parse_concat(branch, depth)) {
+        return false;
+      }
+      alternate.children.push_back(branch);
+      if (!at('|')) {
+        break;
+      }
+      ++pos_;
+    }
+    out = alternate.children.size() == 1 ? alternate.children[0]
+                                         : add_node(std::move(alternate));
+    return true;
+  }
+
+  bool parse_concat(uint32_t& out, int depth) {
+    Node concat;
+    concat.kind = Node::kConcat;
+    while (pos_ < pattern_.size() && !at('|') && !at(')')) {
+      uint32_t atom = 0;
+      bool quantifiable = true;
+      if (!parse_atom(atom, quantifiable, depth) ||
+          !parse_quantifier(atom, quantifiable)) {
+        return false;
+      }
+      concat.children.push_back(atom);
+    }
+    if (concat.children.size() == 1) {
+      out = concat.children[0];
+    } else if (concat.children.empty()) {
+      out = add_node(Node());
+    } else {
+      out = add_node(std::move(concat));
+    }
+    return true;
+  }
+
+  // Parse {n}, {n,} or {n,m} at pos_. Returns false, without consuming
+  // anything, if the brace is not a counted quantifier and so a literal.
+  bool parse_counted(int& min, int& max) {
+    size_t pos = pos_ + 1;
+    auto parse_number = [&](int& value) {
+      const size_t start = pos;
+      value = 0;
+      while (pos < pattern_.size() && pattern_[pos] >= '0' &&
+             pattern_[pos] <= '9' && pos - start < 6) {
+        value = value * 10 + (pattern_[pos++] - '0');
+      }
+      return pos > start;
+    };
+    if (!parse_number(min)) {
+      return false;
+    }
+    max = min;
+    if (pos < pattern_.size() && pattern_[pos] == ',') {
+      ++pos;
+      if (!parse_number(max)) {
+        max = -1;
+      }
+    }
+    if (pos >= pattern_.size() || pattern_[pos] != '}') {
+      return false;
+    }
+    pos_ = pos + 1;
+    return true;
+  }
+
+  bool at_quantifier() {
+    if (at('*') || at('+') || at('?')) {
+      return true;
+    }
+    int min = 0;
+    int max = 0;
+    const size_t pos = pos_;
+    const bool counted = at('{') && parse_counted(min, max);
+    pos_ = pos;
+    return counted;
+  }
+
+  bool parse_quantifier(uint32_t& atom, bool quantifiable) {
+    int min = 0;
+    int max = 0;
+    if (at('*')) {
+      ++pos_;
+      max = -1;
+    } else if (at('+')) {
+      ++pos_;
+      min = 1;
+      max = -1;
+    } else if (at('?')) {
+      ++pos_;
+      max = 1;
+    } else if (!at('{') || !parse_counted(min, max)) {
+      return true;
+    }
+    if (!quantifiable) {
+      return fail("quantifier does not follow a repeatable item");
+    }
+    if (max >= 0 && min > max) {
+      return fail("numbers out of order in {} quantifier");
+    }
+    if (min > kMaxRepeat || max > kMaxRepeat) {
+      return fail("repeat count too large");
+    }
+
+    Node repeat;
+    repeat.kind = Node::kRepeat;
+    repeat.min = min;
+    repeat.max = max;
+    if (at('?')) {
+      ++pos_;
+      repeat.greedy = false;
+    } else if (at('+')) {
+      return fail("possessive quantifiers are not supported");
+    }
+    if (at_quantifier()) {
+      return fail("nested quantifiers are not supported");
+    }
+    repeat.children.push_back(atom);
+    atom = add_node(std::move(repeat));
+    return true;
+  }
+
+  bool parse_atom(uint32_t& out, bool& quantifiable, int depth) {
+    quantifiable = true;
+    const char c = pattern_[pos_];
+    switch (c) {
+      case '(':
+        return parse_group(out, quantifiable, depth);
+      case '[': {
+        CharClass cls;
+        if (!parse_class(cls)) {
+          return false;
+        }
+        out = add_class_node(std::move(cls));
+        return true;
+      }
+      case '.': {
+        ++pos_;
+        CharClass cls;
+        cls.negated = true;
+        cls.items.push_back({CharClass::Item::kRange, false, '\n', '\n'});
+        out = add_class_node(std::move(cls));
+        return true;
+      }
+      case '^':
+      case '$':
+        ++pos_;
+        quantifiable = false;
+        out = add_assert(c == '^' ? Op::kBegin : Op::kEndOrNewline);
+        return true;
+      case '*':
+      case '+':
+      case '?':
+        return fail("quantifier does not follow a repeatable item");
+      default:
+        break;
+    }
+
+    if (c == '\\' && pos_ + 1 < pattern_.size()) {
+      const char e = pattern_[pos_ + 1];
+      if (e == 'A' || e == 'z' || e == 'Z') {
+        pos_ += 2;
+        quantifiable = false;
+        out = add_assert(
+            e == 'A' ? Op::kBegin
+                     : (e == 'z' ? Op::kEnd : Op::kEndOrNewline));
+        return true;
+      }
+    }
+
+    CharClass cls;
+    uint32_t cp = 0;
+    bool is_cp = false;
+    if (!parse_item(cls, cp, is_cp)) {
+      return false;
+    }
+    if (is_cp && !add_range(cls, cp, cp)) {
+      return false;
+    }
+    out = add_class_node(std::move(cls));
+    return true;
+  }
+
+  uint32_t add_assert(Op op) {
+    Node node;
+    node.kind = Node::kAssert;
+    node.value = static_cast<uint32_t>(op);
+    return add_node(std::move(node));
+  }
+
+  bool parse_group(uint32_t& out, bool& quantifiable, int depth) {
+    ++pos_;
+    const bool case_insensitive = case_insensitive_;
+    bool lookahead = false;
+    bool negated = false;
+    if (at('?')) {
+      ++pos_;
+      if (at(':')) {
+        ++pos_;
+      } else if (at('=') || at('!')) {
+        lookahead = true;
+        negated = at('!');
+        ++pos_;
+      } else if (at("<=") || at("<!")) {
+        return fail("lookbehind is not supported");
+      } else if (at('<') || at("P<")) {
+        // Named groups capture nothing here either
+        const size_t end = pattern_.find('>', pos_);
+        if (end == std::string::npos) {
+          return fail("unterminated group name");
+        }
+        pos_ = end + 1;
+      } else {
+        bool on = true;
+        bool flags_only = false;
+        while (true) {
+          if (at('i')) {
+            case_insensitive_ = on;
+          } else if (at('-') && on) {
+            on = false;
+          } else if (at(':')) {
+            break;
+          } else if (at(')')) {
+            flags_only = true;
+            break;
+          } else {
+            return fail("unsupported group or flag");
+          }
+          ++pos_;
+        }
+        ++pos_;
+        if (flags_only) {
+          // (?i) applies until the end of the enclosing group
+          quantifiable = false;
+          out = add_node(Node());
+          return true;
+        }
+      }
+    }
+
+    uint32_t inner = 0;
+    if (!parse_alternation(inner, depth + 1)) {
+      return false;
+    }
+    if (!at(')')) {
+      return fail("missing )");
+    }
+    ++pos_;
+    case_insensitive_ = case_insensitive;
+
+    if (lookahead) {
+      if (nodes_[inner].kind != Node::kClass) {
+        return fail("lookahead may only match a single code point");
+      }
+      Node node;
+      node.kind = Node::kLookahead;
+      node.value = nodes_[inner].value;
+      node.negated = negated;
+      quantifiable = false;
+      out = add_node(std::move(node));
+      return true;
+    }
+    out = inner;
+    return true;
+  }
+
+  bool parse_class(CharClass& cls) {
+    ++pos_;
+    if (at('^')) {
+      ++pos_;
+      cls.negated = true;
+    }
+    for (bool first = true;; first = false) {
+      if (pos_ >= pattern_.size()) {
+        return fail("missing ]");
+      }
+      if (at(']') && !first) {
+        ++pos_;
+        return true;
+      }
+      if (at("[:") || at("[=") || at("[.")) {
+        return fail("POSIX classes are not supported");
+      }
+      uint32_t lo = 0;
+      bool is_cp = false;
+      if (!parse_item(cls, lo, is_cp)) {
+        return false;
+      }
+      if (!is_cp) {
+        continue;
+      }
+      uint32_t hi = lo;
+      if (at('-') && pos_ + 1 < pattern_.size() && pattern_[pos_ + 1] != ']') {
+        ++pos_;
+        bool hi_is_cp = false;
+        if (!parse_item(cls, hi, hi_is_cp)) {
+          return false;
+        }
+        if (!hi_is_cp) {
+          return fail("invalid range in character class");
+        }
+        if (hi < lo) {
+          return fail("range out of order in character class");
+        }
+      }
+      if (!add_range(cls, lo, hi)) {
+        return false;
+      }
+    }
+  }
+
+  // Parse a literal or an escape. Single code points are returned in cp with
+  // is_cp set, sets like \s are added to cls.
+  bool parse_item(CharClass& cls, uint32_t& cp, bool& is_cp) {
+    is_cp = true;
+    if (!at('\\')) {
+      const size_t len =
+          decode_utf8(pattern_.data() + pos_, pattern_.size() - pos_, cp);
+      if (cp == kInvalidCodepoint) {
+        return fail("invalid UTF-8");
+      }
+      pos_ += len;
+      return true;
+    }
+    ++pos_;
+    if (pos_ >= pattern_.size()) {
+      return fail("\\ at end of pattern");
+    }
+    const char e = pattern_[pos_++];
+    switch (e) {
+      case 't':
+        cp = '\t';
+        return true;
+      case 'n':
+        cp = '\n';
+        return true;
+      case 'r':
+        cp = '\r';
+        return true;
+      case 'f':
+        cp = '\f';
+        return true;
+      case 'v':
+        // \v is a single code point in std::regex but all vertical space in
+        // PCRE2, so leave it to them
+        return fail("\\v is ambiguous");
+      case 'a':
+        cp = 0x07;
+        return true;
+      case 'e':
+        cp = 0x1B;
+        return true;
+      case '0':
+        if (pos_ < pattern_.size() && pattern_[pos_] >= '0' &&
+            pattern_[pos_] <= '7') {
+          return fail("octal escapes are not supported");
+        }
+        cp = 0;
+        return true;
+      case 'x':
+        return parse_hex(cp);
+      case 's':
+      case 'S':
+        is_cp = false;
+        return add_set(
+            cls, {CharClass::Item::kFlags, e == 'S', unicode::kWhiteSpace, 0});
+      case 'd':
+      case 'D':
+        is_cp = false;
+        return add_set(
+            cls,
+            {CharClass::Item::kCategories,
+             e == 'D',
+             category_bit(GeneralCategory::Nd),
+             0});
+      case 'w':
+      case 'W':
+        is_cp = false;
+        return add_set(
+            cls,
+            {CharClass::Item::kFlags, e == 'W', unicode::kWordCharacter, 0});
+      case 'p':
+      case 'P':
+        is_cp = false;
+        return parse_property(cls, e == 'P');
+      default:
+        break;
+    }
+    const auto c = static_cast<unsigned char>(e);
+    if (c < 128 && !std::isalnum(c)) {
+      cp = c;
+      return true;
+    }
+    return fail("unsupported escape");
+  }
+
+  bool parse_hex(uint32_t& cp) {
+    const bool braced = at('{');
+    if (braced) {
+      ++pos_;
+    }
+    cp = 0;
+    size_t digits = 0;
+    while (pos_ < pattern_.size() && (braced || digits < 2) &&
+           std::isxdigit(static_cast<unsigned char>(pattern_[pos_]))) {
+      const char c = pattern_[pos_++];
+      cp = cp * 16 +
+          (c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+      if (++digits > 6) {
+        return fail("hex escape out of range");
+      }
+    }
+    if (braced) {
+      if (!at('}') || digits == 0) {
+        return fail("invalid \\x{...} escape");
+      }
+      ++pos_;
+    }
+    if (cp > kMaxCodepoint || (cp >= 0xD800 && cp <= 0xDFFF)) {
+      return fail("hex escape out of range");
+    }
+    return true;
+  }
+
+  bool parse_property(CharClass& cls, bool negated) {
+    std::string name;
+    if (at('{')) {
+      const size_t end = pattern_.find('}', pos_);
+      if (end == std::string::npos) {
+        return fail("missing } in \\p{...}");
+      }
+      name = pattern_.substr(pos_ + 1, end - pos_ - 1);
+      pos_ = end + 1;
+      if (!name.empty() && name[0] == '^') {
+        negated = !negated;
+        name.erase(0, 1);
+      }
+    } else if (pos_ < pattern_.size()) {
+      name = pattern_.substr(pos_++, 1);
+    }
+
+    using Item = CharClass::Item;
+    // The record flags save a general category lookup for the common cases
+    if (name == "L") {
+      return add_set(cls, {Item::kFlags, negated, unicode::kLetter, 0});
+    }
+    if (name == "N") {
+      return add_set(cls, {Item::kFlags, negated, unicode::kNumber, 0});
+    }
+    if (name == "Any") {
+      return add_set(cls, {Item::kRange, negated, 0, kMaxCodepoint});
+    }
+    if (name == "L&" || name == "LC") {
+      return add_set(
+          cls,
+          {Item::kCategories,
+           negated,
+           category_bit(GeneralCategory::Lu) |
+               category_bit(GeneralCategory::Ll) |
+               category_bit(GeneralCategory::Lt),
+           0});
+    }
+    uint32_t mask = 0;
+    for (size_t i = 0; i < sizeof(kCategoryNames) / sizeof(char*); ++i) {
+      const char* category = kCategoryNames[i];
+      if ((name.size() == 1 && name[0] == category[0]) || name == category) {
+        mask |= 1u << i;
+      }
+    }
+    if (mask != 0) {
+      return add_set(cls, {Item::kCategories, negated, mask, 0});
+    }
+    for (size_t script = 0; script < unicode::data::kNumScripts; ++script) {
+      if (name == unicode::script_name(static_cast<uint8_t>(script))) {
+        return add_set(
+            cls,
+            {Item::kScript, negated, static_cast<uint32_t>(script), 0});
+      }
+    }
+    return fail("unknown property");
+  }
+
+  // Case-insensitive matching is only supported where it reduces to the
+  // ASCII letters, plus the two non-ASCII code points that fold into them
+  bool add_range(CharClass& cls, uint32_t lo, uint32_t hi) {
+    using Item = CharClass::Item;
+    cls.items.push_back({Item::kRange, false, lo, hi});
+    if (!case_insensitive_) {
+      return true;
+    }
+    if (hi >= 128) {
+      return fail("case-insensitive non-ASCII code points are not supported");
+    }
+    auto fold = [&](uint32_t first, uint32_t last, int32_t delta) {
+      const uint32_t from = std::max(lo, first);
+      const uint32_t to = std::min(hi, last);
+      if (from <= to) {
+        cls.items.push_back({Item::kRange, false, from + delta, to + delta});
+      }
+    };
+    fold('a', 'z', 'A' - 'a');
+    fold('A', 'Z', 'a' - 'A');
+    auto contains = [&](char c) {
+      return (lo <= uint32_t(c) && uint32_t(c) <= hi) ||
+          (lo <= uint32_t(c | 0x20) && uint32_t(c | 0x20) <= hi);
+    };
+    if (contains('K')) {
+      // KELVIN SIGN
+      cls.items.push_back({Item::kRange, false, 0x212A, 0x212A});
+    }
+    if (contains('S')) {
+      // LATIN SMALL LETTER LONG S
+      cls.items.push_back({Item::kRange, false, 0x17F, 0x17F});
+    }
+    return true;
+  }
+
+  bool add_set(CharClass& cls, CharClass::Item item) {
+    using Item = CharClass::Item;
+    const bool caseless = (item.kind == Item::kFlags &&
+                           (item.lo == unicode::kWhiteSpace ||
+                            item.lo == unicode::kNumber)) ||
+        (item.kind == Item::kCategories &&
+         item.lo == category_bit(GeneralCategory::Nd));
+    if (case_insensitive_ && !caseless) {
+      return fail("case-insensitive classes are not supported");
+    }
+    cls.items.push_back(item);
+    return true;
+  }
+
+  // -- Code generation --------------------------------------------------------
+
+  size_t push(Op op, uint32_t x = 0, uint32_t y = 0) {
+    program_.insts.push_back({op, x, y});
+    return program_.insts.size() - 1;
+  }
+
+  uint32_t next_pc() const {
+    return static_cast<uint32_t>(program_.insts.size());
+  }
+
+  bool emit(uint32_t index) {
+    if (program_.insts.size() > kMaxInstructions) {
+      return fail("pattern too large");
+    }
+    const Node& node = nodes_[index];
+    switch (node.kind) {
+      case Node::kEmpty:
+        return true;
+      case Node::kClass:
+        push(Op::kChar, node.value);
+        return true;
+      case Node::kAssert:
+        push(static_cast<Op>(node.value));
+        return true;
+      case Node::kLookahead:
+        push(
+            node.negated ? Op::kNegativeLookahead : Op::kLookahead,
+            node.value);
+        return true;
+      case Node::kConcat:
+        for (const auto child : node.children) {
+          if (!emit(child)) {
+            return false;
+          }
+        }
+        return true;
+      case Node::kAlternate: {
+        std::vector<size_t> jumps;
+        for (size_t i = 0; i < node.children.size(); ++i) {
+          if (i + 1 == node.children.size()) {
+            if (!emit(node.children[i])) {
+              return false;
+            }
+            break;
+          }
+          const size_t split = push(Op::kSplit);
+          program_.insts[split].x = next_pc();
+          if (!emit(node.children[i])) {
+            return false;
+          }
+          jumps.push_back(push(Op::kJmp));
+          program_.insts[split].y = next_pc();
+        }
+        for (const auto jump : jumps) {
+          program_.insts[jump].x = next_pc();
+        }
+        return true;
+      }
+      case Node::kRepeat:
+        return emit_repeat(node);
+    }
+    return true;
+  }
+
+  bool emit_repeat(const Node& node) {
+    const uint32_t child = node.children[0];
+    for (int i = 0; i < node.min; ++i) {
+      if (!emit(child)) {
+        return false;
+      }
+    }
+    auto set_split = [&](size_t split, uint32_t body, uint32_t exit) {
+      program_.insts[split].x = node.greedy ? body : exit;
+      program_.insts[split].y = node.greedy ? exit : body;
+    };
+    if (node.max < 0) {
+      const size_t split = push(Op::kSplit);
+      if (!emit(child)) {
+        return false;
+      }
+      push(Op::kJmp, static_cast<uint32_t>(split));
+      set_split(split, static_cast<uint32_t>(split + 1), next_pc());
+      return true;
+    }
+    // x{n,m} is x{n}(x(x...)?)?
+    std::vector<size_t> splits;
+    for (int i = node.min; i < node.max; ++i) {
+      splits.push_back(push(Op::kSplit));
+      if (!emit(child)) {
+        return false;
+      }
+    }
+    for (const auto split : splits) {
+      set_split(split, static_cast<uint32_t>(split + 1), next_pc());
+    }
+    return true;
+  }
+
+  // Collect the ASCII code points that can start a match, treating every
+  // assertion as satisfied
+  void compute_first() {
+    const auto& insts = program_.insts;
+    std::vector<bool> seen(insts.size());
+    std::vector<uint32_t> stack = {0};
+    program_.can_skip = true;
+    while (!stack.empty()) {
+      const uint32_t pc = stack.back();
+      stack.pop_back();
+      if (seen[pc]) {
+        continue;
+      }
+      seen[pc] = true;
+      const Inst& inst = insts[pc];
+      switch (inst.op) {
+        case Op::kChar:
+          program_.first_ascii[0] |= program_.classes[inst.x].ascii[0];
+          program_.first_ascii[1] |= program_.classes[inst.x].ascii[1];
+          break;
+        case Op::kSplit:
+          stack.push_back(inst.y);
+          stack.push_back(inst.x);
+          break;
+        case Op::kJmp:
+          stack.push_back(inst.x);
+          break;
+        case Op::kMatch:
+          program_.can_skip = false;
+          break;
+        default:
+          stack.push_back(pc + 1);
+          break;
+      }
+    }
+  }
+
+  const std::string& pattern_;
+  PikeRegex::Program& program_;
+  std::vector<Node> nodes_;
+  size_t pos_ = 0;
+  bool case_insensitive_ = false;
+  const char* error_ = "";
+};
+
+// -- VM -----------------------------------------------------------------------
+
+// Threads at one position, in priority order, as a sparse set of their pcs
+struct ThreadList {
+  explicit ThreadList(size_t num_insts)
+      : sparse(num_insts), dense(num_insts), starts(num_insts) {}
+
+  bool contains(uint32_t pc) const {
+    const uint32_t i = sparse[pc];
+    return i < size && dense[i] == pc;
+  }
+
+  void add(uint32_t pc, size_t start) {
+    sparse[pc] = size;
+    dense[size] = pc;
+    starts[size] = start;
+    ++size;
+  }
+
+  std::vector<uint32_t> sparse;
+  std::vector<uint32_t> dense;
+  // Start of the match of each thread
+  std::vector<size_t> starts;
+  uint32_t size = 0;
+};
+
+class Searcher {
+ public:
+  Searcher(const PikeRegex::Program& program, std::string_view text)
+      : program_(program),
+        data_(text.data()),
+        size_(text.size()),
+        current_(program.insts.size()),
+        next_(program.insts.size()) {}
+
+  // Find the leftmost-first match starting at or after pos
+  bool search(size_t pos, Match& match) {
+    current_.size = 0;
+    bool matched = false;
+    uint32_t cp = 0;
+    size_t len = decode(pos, cp);
+    while (true) {
+      if (!matched) {
+        if (current_.size == 0 && program_.can_skip) {
+          while (cp < 128 && !first(cp)) {
+            ++pos;
+            len = decode(pos, cp);
+          }
+        }
+        add_thread(current_, 0, pos, pos, cp);
+      }
+
+      const size_t next_pos = pos + len;
+      uint32_t next_cp = 0;
+      const size_t next_len = pos < size_ ? decode(next_pos, next_cp) : 0;
+      next_.size = 0;
+      TK_COUNT_WORK(regex_steps, current_.size + 1);
+      for (uint32_t i = 0; i < current_.size; ++i) {
+        const uint32_t pc = current_.dense[i];
+        const Inst& inst = program_.insts[pc];
+        if (inst.op == Op::kMatch) {
+          // Lower priority threads are cut
+          matched = true;
+          match = {current_.starts[i], pos};
+          break;
+        }
+        if (inst.op == Op::kChar && pos < size_ &&
+            program_.classes[inst.x].contains(cp)) {
+          add_thread(next_, pc + 1, current_.starts[i], next_pos, next_cp);
+        }
+      }
+      if (pos >= size_) {
+        break;
+      }
+      std::swap(current_, next_);
+      if (matched && current_.size == 0) {
+        break;
+      }
+      pos = next_pos;
+      cp = next_cp;
+      len = next_len;
+    }
+    return matched;
+  }
+
+  // Length of the code point at pos, kInvalidCodepoint past the end
+  size_t decode(size_t pos, uint32_t& cp) const {
+    if (pos >= size_) {
+      cp = kInvalidCodepoint;
+      return 0;
+    }
+    const auto byte = static_cast<unsigned char>(data_[pos]);
+    if (byte < 128) {
+      cp = byte;
+      return 1;
+    }
+    return decode_utf8(data_ + pos, size_ - pos, cp);
+  }
+
+ private:
+  bool first(uint32_t cp) const {
+    return (program_.first_ascii[cp >> 6] >> (cp & 63)) & 1;
+  }
+
+  // Add the thread at pc and everything reachable from it without consuming
+  // input, in priority order. Uses an explicit stack instead of recursion so
+  // that long chains of splits cannot overflow the call stack.
+  void add_thread(
+      ThreadList& list,
+      uint32_t pc,
+      size_t start,
+      size_t pos,
+      uint32_t cp) {
+    stack_.push_back(pc);
+    while (!stack_.empty()) {
+      pc = stack_.back();
+      stack_.pop_back();
+      if (list.contains(pc)) {
+        continue;
+      }
+      list.add(pc, start);
+      const Inst& inst = program_.insts[pc];
+      switch (inst.op) {
+        case Op::kChar:
+        case Op::kMatch:
+          break;
+        case Op::kSplit:
+          stack_.push_back(inst.y);
+          stack_.push_back(inst.x);
+          break;
+        case Op::kJmp:
+          stack_.push_back(inst.x);
+          break;
+        case Op::kBegin:
+          if (pos == 0) {
+            stack_.push_back(pc + 1);
+          }
+          break;
+        case Op::kEnd:
+          if (pos == size_) {
+            stack_.push_back(pc + 1);
+          }
+          break;
+        case Op::kEndOrNewline:
+          if (pos == size_ || (pos + 1 == size_ && data_[pos] == '\n')) {
+            stack_.push_back(pc + 1);
+          }
+          break;
+        case Op::kLookahead:
+          if (program_.classes[inst.x].contains(cp)) {
+            stack_.push_back(pc + 1);
+          }
+          break;
+        case Op::kNegativeLookahead:
+          if (!program_.classes[inst.x].contains(cp)) {
+            stack_.push_back(pc + 1);
+          }
+          break;
+      }
+    }
+  }
+
+  const PikeRegex::Program& program_;
+  const char* data_;
+  size_t size_;
+  ThreadList current_;
+  ThreadList next_;
+  std::vector<uint32_t> stack_;
+};
+
+} // namespace
+
+PikeRegex::PikeRegex() = default;
+
+PikeRegex::~PikeRegex() = default;
+
+Error PikeRegex::compile(const std::string& pattern) {
+  auto program = std::make_unique<Program>();
+  Compiler compiler(pattern, *program);
+  if (!compiler.compile()) {
+    TK_LOG(
+        Info,
+        "PikeRegex cannot compile the pattern at offset %zu: %s",
+        compiler.error_offset(),
+        compiler.error());
+    return Error::RegexFailure;
+  }
+  program_ = std::move(program);
+  return Error::Ok;
+}
+
+std::vector<Match> PikeRegex::find_all(std::string_view text) const {
+  std::vector<Match> result;
+  if (!program_) {
+    TK_LOG(Error, "Regex is not compiled or invalid, run compile() first");
+    return result;
+  }
+
+  Searcher searcher(*program_, text);
+  size_t pos = 0;
+  Match match{0, 0};
+  while (pos < text.size() && searcher.search(pos, match)) {
+    result.push_back(match);
+    pos = match.end;
+    if (match.start == match.end) {
+      // Step over the code point after an empty match
+      uint32_t cp = 0;
+      pos += std::max<size_t>(searcher.decode(pos, cp), 1);
+    }
+  }
+  return result;
+}
+
+Result<std::unique_ptr<IRegex>> create_pike_regex(const std::string& pattern) {
+  auto regex = std::make_unique<PikeRegex>();
+  TK_CHECK_OK_OR_RETURN_ERROR(regex->compile(pattern));
+  return static_cast<std::unique_ptr<IRegex>>(std::move(regex));
+}
+
+} // namespace tokenizers
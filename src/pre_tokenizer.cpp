@@ -9,6 +9,9 @@
 
 // Local
 #include <pytorch/tokenizers/pre_tokenizer.h>
+#include <pytorch/tokenizers/pike_regex.h>
+#include <pytorch/tokenizers/unicode_categories.h>
+#include <pytorch/tokenizers/unicode_normalization.h>
 #include <unicode.h>
 
 // Standard
@@ -29,6 +32,220 @@ using json = nlohmann::json;
 
 namespace tokenizers {
 
+// SplitDelimiterBehavior //////////////////////////////////////////////////////
+
+SplitDelimiterBehavior parse_split_delimiter_behavior(const std::string& name) {
+  if (name == "Removed") {
+    return SplitDelimiterBehavior::Removed;
+  }
+  if (name == "Isolated") {
+    return SplitDelimiterBehavior::Isolated;
+  }
+  if (name == "MergedWithPrevious") {
+    return SplitDelimiterBehavior::MergedWithPrevious;
+  }
+  if (name == "MergedWithNext") {
+    return SplitDelimiterBehavior::MergedWithNext;
+  }
+  if (name == "Contiguous") {
+    return SplitDelimiterBehavior::Contiguous;
+  }
+  throw std::runtime_error("Unsupported behavior: " + name);
+}
+
+//////////////////
+// Impl Details //
+//////////////////
+namespace {
+
+/**
+ * Applies a SplitDelimiterBehavior to a stream of adjacent matched and
+ * unmatched segments, appending the resulting pieces to `out`. This mirrors
+ * NormalizedString::split in tokenizers, but runs in a single forward pass.
+ */
+class SplitBuilder {
+ public:
+  SplitBuilder(
+      SplitDelimiterBehavior behavior,
+      bool invert,
+      std::vector<Match>& out)
+      : behavior_(behavior), invert_(invert), out_(out), first_(out.size()) {}
+
+  void add(size_t start, size_t end, bool is_match) {
+    if (start == end) {
+      return;
+    }
+    is_match = is_match != invert_;
+    switch (behavior_) {
+      case SplitDelimiterBehavior::Removed:
+        if (!is_match) {
+          out_.push_back({start, end});
+        }
+        break;
+      case SplitDelimiterBehavior::Isolated:
+        out_.push_back({start, end});
+        break;
+      case SplitDelimiterBehavior::MergedWithPrevious:
+        if (is_match && !previous_match_ && has_last()) {
+          out_.back().end = end;
+        } else {
+          out_.push_back({start, end});
+        }
+        break;
+      case SplitDelimiterBehavior::MergedWithNext:
+        // A match is held back until we know whether the next segment is a
+        // match too. If it is not, the two are merged.
+        if (pending_) {
+          if (is_match) {
+            out_.push_back(*pending_);
+            pending_ = Match{start, end};
+          } else {
+            out_.push_back({pending_->start, end});
+            pending_.reset();
+          }
+        } else if (is_match) {
+          pending_ = Match{start, end};
+        } else {
+          out_.push_back({start, end});
+        }
+        break;
+      case SplitDelimiterBehavior::Contiguous:
+        if (is_match == previous_match_ && has_last()) {
+          out_.back().end = end;
+        } else {
+          out_.push_back({start, end});
+        }
+        break;
+    }
+    previous_match_ = is_match;
+  }
+
+  void finish() {
+    if (pending_) {
+      out_.push_back(*pending_);
+      pending_.reset();
+    }
+  }
+
+ private:
+  bool has_last() const {
+    return out_.size() > first_;
+  }
+
+  const SplitDelimiterBehavior behavior_;
+  const bool invert_;
+  std::vector<Match>& out_;
+  const size_t first_;
+  bool previous_match_ = false;
+  std::optional<Match> pending_;
+};
+
+// Character classes for split_runs
+enum class CharClass : uint8_t {
+  // Dropped, and ends the current piece
+  Separator,
+  // Always a piece of its own
+  Isolated,
+  // Pieces are maximal runs of characters of the same class
+  Word,
+  Other,
+};
+
+/**
+ * Split input into maximal runs of characters of the same class, as given by
+ * classify(code point, category record).
+ */
+template <typename Classify>
+void split_runs(
+    std::string_view input,
+    Classify classify,
+    std::vector<Match>& out) {
+  const char* data = input.data();
+  const size_t size = input.size();
+  size_t start = 0;
+  CharClass current = CharClass::Separator;
+  size_t i = 0;
+  while (i < size) {
+    uint32_t cp = static_cast<unsigned char>(data[i]);
+    const size_t len =
+        cp < 0x80 ? 1 : unicode::decode_utf8(data + i, size - i, cp);
+    const CharClass cls = classify(cp, unicode::categories(cp));
+    if (cls != current || cls == CharClass::Isolated) {
+      if (current != CharClass::Separator) {
+        out.push_back({start, i});
+      }
+      start = i;
+      current = cls;
+    }
+    i += len;
+  }
+  if (current != CharClass::Separator) {
+    out.push_back({start, size});
+  }
+}
+
+/**
+ * Split input on each character for which is_delimiter(code point, category
+ * record) returns true, applying the given behavior to the delimiters.
+ */
+template <typename Predicate>
+void split_chars(
+    std::string_view input,
+    Predicate is_delimiter,
+    SplitDelimiterBehavior behavior,
+    std::vector<Match>& out) {
+  SplitBuilder builder(behavior, false, out);
+  const char* data = input.data();
+  const size_t size = input.size();
+  size_t start = 0;
+  size_t i = 0;
+  while (i < size) {
+    uint32_t cp = static_cast<unsigned char>(data[i]);
+    const size_t len =
+        cp < 0x80 ? 1 : unicode::decode_utf8(data + i, size - i, cp);
+    if (is_delimiter(cp, unicode::categories(cp))) {
+      builder.add(start, i, false);
+      builder.add(i, i + len, true);
+      start = i + len;
+    }
+    i += len;
+  }
+  builder.add(start, size, false);
+  builder.finish();
+}
+
+inline bool is_whitespace(const unicode::CategoryRecord& record) {
+  return record.flags & unicode::kWhiteSpace;
+}
+
+inline bool is_punctuation(const unicode::CategoryRecord& record) {
+  return record.flags & unicode::kPunctuation;
+}
+
+// Whether str is exactly one valid UTF-8 encoded character
+bool is_single_character(const std::string& str) {
+  uint32_t cp = unicode::kInvalidCodepoint;
+  return !str.empty() &&
+      unicode::decode_utf8(str.data(), str.size(), cp) == str.size() &&
+      cp != unicode::kInvalidCodepoint;
+}
+
+} // namespace
+
+// PreTokenizer ////////////////////////////////////////////////////////////////
+
+std::vector<std::string> SplittingPreTokenizer::pre_tokenize(
+    const std::string& input) const {
+  std::vector<Match> offsets;
+  pre_tokenize_offsets(input, offsets);
+  std::vector<std::string> results;
+  results.reserve(offsets.size());
+  for (const auto& piece : offsets) {
+    results.emplace_back(input, piece.start, piece.end - piece.start);
+  }
+  return results;
+}
+
 // PreTokenizerConfig //////////////////////////////////////////////////////////
 
 PreTokenizerConfig::PreTokenizerConfig(std::string type)
@@ -44,31 +261,17 @@ PreTokenizer::Ptr PreTokenizerConfig::create() const {
           "Missing pattern for PreTokenizer of type Split");
     }
 
-    // Validate behavior parameter, if missing set to default "Removed"
-    std::string behavior_str = behavior ? *behavior : "Removed";
-    if (behavior_str != "MergedWithPrevious" && behavior_str != "Isolated" &&
-        behavior_str != "Removed") {
-      throw std::runtime_error(
-          "Unsupported behavior '" + behavior_str +
-          "' for Split PreTokenizer. Only 'MergedWithPrevious', 'Removed' and 'Isolated' are supported.");
-    }
-
-    // Validate invert parameter
-    const bool invert_flag = invert ? *invert : false;
-    const bool delimiter_flag = is_delimiter ? *is_delimiter : false;
-    if (invert_flag && delimiter_flag) {
-      throw std::runtime_error(
-          "invert=true is not supported for Split PreTokenizer with a String pattern.");
-    }
-
-    return PreTokenizer::Ptr(
-        new RegexPreTokenizer(*pattern, delimiter_flag, behavior_str));
+    return PreTokenizer::Ptr(new RegexPreTokenizer(
+        *pattern,
+        is_delimiter.value_or(false),
+        behavior.value_or("Removed"),
+        invert.value_or(false),
+        regex_options.value_or(RegexOptions{})));
   }
   if (type == "Digits") {
-    if (individual_digits) {
-      return PreTokenizer::Ptr(new DigitsPreTokenizer(*individual_digits));
-    }
-    return PreTokenizer::Ptr(new DigitsPreTokenizer());
+    return PreTokenizer::Ptr(new DigitsPreTokenizer(
+        individual_digits.value_or(false),
+        regex_options.value_or(RegexOptions{})));
   }
   if (type == "ByteLevel") {
     if (add_prefix_space && pattern) {
@@ -83,6 +286,40 @@ PreTokenizer::Ptr PreTokenizerConfig::create() const {
     }
     return PreTokenizer::Ptr(new ByteLevelPreTokenizer());
   }
+  if (type == "Whitespace") {
+    return PreTokenizer::Ptr(new WhitespacePreTokenizer());
+  }
+  if (type == "WhitespaceSplit") {
+    return PreTokenizer::Ptr(new WhitespaceSplitPreTokenizer());
+  }
+  if (type == "Punctuation") {
+    return PreTokenizer::Ptr(new PunctuationPreTokenizer(
+        parse_split_delimiter_behavior(behavior.value_or("Isolated"))));
+  }
+  if (type == "CharDelimiterSplit") {
+    if (!delimiter) {
+      throw std::runtime_error(
+          "Missing delimiter for PreTokenizer of type CharDelimiterSplit");
+    }
+    return PreTokenizer::Ptr(new CharDelimiterSplitPreTokenizer(*delimiter));
+  }
+  if (type == "UnicodeScripts") {
+    return PreTokenizer::Ptr(new UnicodeScriptsPreTokenizer());
+  }
+  if (type == "BertPreTokenizer") {
+    return PreTokenizer::Ptr(new BertPreTokenizer());
+  }
+  if (type == "Metaspace") {
+    // Older configs use add_prefix_space instead of prepend_scheme
+    auto scheme = MetaspacePreTokenizer::PrependScheme::Always;
+    if (prepend_scheme) {
+      scheme = MetaspacePreTokenizer::parse_prepend_scheme(*prepend_scheme);
+    } else if (add_prefix_space && !*add_prefix_space) {
+      scheme = MetaspacePreTokenizer::PrependScheme::Never;
+    }
+    return PreTokenizer::Ptr(new MetaspacePreTokenizer(
+        replacement.value_or("\xe2\x96\x81"), scheme, split.value_or(true)));
+  }
   if (type == "Sequence") {
     if (!pretokenizers || pretokenizers->empty()) {
       throw std::runtime_error(
@@ -93,7 +330,14 @@ PreTokenizer::Ptr PreTokenizerConfig::create() const {
         pretokenizers->begin(),
         pretokenizers->end(),
         std::back_inserter(pretoks),
-        [](const PreTokenizerConfig& cfg) { return cfg.create(); });
+        [this](const PreTokenizerConfig& cfg) {
+          if (regex_options && !cfg.regex_options) {
+            return PreTokenizerConfig(cfg)
+                .set_regex_options(*regex_options)
+                .create();
+          }
+          return cfg.create();
+        });
     return PreTokenizer::Ptr(new SequencePreTokenizer(pretoks));
   }
   throw std::runtime_error("Unsupported PreTokenizer type: " + type);
@@ -137,6 +381,34 @@ PreTokenizerConfig& PreTokenizerConfig::parse_json(const json& json_config) {
     } catch (json::out_of_range&) {
     }
     // TODO: trim_offsets, use_regex
+  } else if (type == "Punctuation") {
+    try {
+      behavior = json_config.at("behavior");
+    } catch (json::out_of_range&) {
+    }
+  } else if (type == "CharDelimiterSplit") {
+    delimiter = json_config.at("delimiter");
+  } else if (type == "Metaspace") {
+    try {
+      replacement = json_config.at("replacement");
+    } catch (json::out_of_range&) {
+    }
+    try {
+      prepend_scheme = json_config.at("prepend_scheme");
+    } catch (json::out_of_range&) {
+    }
+    try {
+      add_prefix_space = json_config.at("add_prefix_space");
+    } catch (json::out_of_range&) {
+    }
+    try {
+      split = json_config.at("split");
+    } catch (json::out_of_range&) {
+    }
+  } else if (
+      type == "Whitespace" || type == "WhitespaceSplit" ||
+      type == "UnicodeScripts" || type == "BertPreTokenizer") {
+    // No parameters
   } else if (type == "Sequence") {
     pretokenizers = std::vector<PreTokenizerConfig>();
     for (const auto& entry : json_config.at("pretokenizers")) {
@@ -151,9 +423,10 @@ PreTokenizerConfig& PreTokenizerConfig::parse_json(const json& json_config) {
 // RegexPreTokenizer ///////////////////////////////////////////////////////////
 
 std::unique_ptr<IRegex> RegexPreTokenizer::create_regex_(
-    const std::string& pattern) {
+    const std::string& pattern,
+    const RegexOptions& options) {
   assert(!pattern.empty());
-  auto regex_result = create_regex(pattern);
+  auto regex_result = create_regex(pattern, options);
   if (!regex_result.ok()) {
     throw std::runtime_error(
         "Error: " + std::to_string(static_cast<int>(regex_result.error())));
@@ -163,94 +436,61 @@ std::unique_ptr<IRegex> RegexPreTokenizer::create_regex_(
 
 std::vector<std::string> RegexPreTokenizer::pre_tokenize(
     const std::string& input) const {
-  if (!regex_) {
-    return {};
-  }
-
+  std::vector<Match> offsets;
+  split_(input, offsets);
   std::vector<std::string> results;
-  auto matches = regex_->find_all(input);
-
-  if (!is_delimiter_) {
-    // Original behavior: return the matches themselves
-    for (const auto& match : matches) {
-      results.push_back(input.substr(match.start, match.end - match.start));
-    }
-  } else {
-    // Delimiter behavior
-    if (matches.empty()) {
-      // No matches found, return the entire input
-      results.push_back(input);
-      return results;
-    }
-
-    if (behavior_ == "MergedWithPrevious") {
-      // MergedWithPrevious: Include delimiter with previous token
-      // Example: "the-final--countdown" with delimiter "-"
-      // -> ["the-", "final-", "-", "countdown"]
-      size_t last_end = 0;
-
-      for (size_t i = 0; i < matches.size(); ++i) {
-        const auto& match = matches[i];
+  results.reserve(offsets.size());
+  for (const auto& piece : offsets) {
+    results.emplace_back(input, piece.start, piece.end - piece.start);
+  }
+  return results;
+}
 
-        // Add text before the match plus the delimiter
-        if (match.start > last_end) {
-          std::string token = input.substr(last_end, match.end - last_end);
-          results.push_back(token);
-        } else {
-          // Only delimiter, no preceding text
-          std::string delimiter =
-              input.substr(match.start, match.end - match.start);
-          results.push_back(delimiter);
-        }
+bool RegexPreTokenizer::pre_tokenize_offsets(
+    std::string_view input,
+    std::vector<Match>& out) const {
+  split_(input, out);
+  return true;
+}
 
-        last_end = match.end;
-      }
+RegexStats RegexPreTokenizer::regex_stats() const {
+  return regex_ ? regex_->stats() : RegexStats{};
+}
 
-      // Add remaining text after the last match (if any)
-      if (last_end < input.length()) {
-        results.push_back(input.substr(last_end));
-      }
-    } else if (behavior_ == "Isolated") {
-      // Isolated: Keep delimiters as separate tokens
-      // Example: "the-final--countdown" with delimiter "-"
-      // -> ["the", "-", "final", "-", "-", "countdown"]
-      size_t last_end = 0;
-      for (const auto& match : matches) {
-        // Add text before the match (if any)
-        if (match.start > last_end) {
-          results.push_back(input.substr(last_end, match.start - last_end));
-        }
+void RegexPreTokenizer::split_(std::string_view input, std::vector<Match>& out)
+    const {
+  if (!regex_) {
+    return;
+  }
 
-        // Add the delimiter itself as a separate token
-        std::string delimiter =
-            input.substr(match.start, match.end - match.start);
-        results.push_back(delimiter);
+  const auto matches = regex_->find_all(input);
 
-        last_end = match.end;
-      }
+  if (!is_delimiter_ && !invert_ &&
+      behavior_ == SplitDelimiterBehavior::Removed) {
+    // The pattern describes the pieces: return the matches themselves
+    out.insert(out.end(), matches.begin(), matches.end());
+    return;
+  }
 
-      // Add remaining text after the last match (if any)
-      if (last_end < input.length()) {
-        results.push_back(input.substr(last_end));
-      }
-    } else if (behavior_ == "Removed" || behavior_.empty()) {
-      // Default delimiter behavior (split on delimiters, remove delimiters)
-      size_t last_end = 0;
-      for (const auto& match : matches) {
-        // Add text before the match (if any)
-        if (match.start > last_end) {
-          results.push_back(input.substr(last_end, match.start - last_end));
-        }
-        last_end = match.end;
-      }
+  if (matches.empty() && !invert_) {
+    // No matches found, return the entire input
+    out.push_back({0, input.size()});
+    return;
+  }
 
-      // Add remaining text after the last match (if any)
-      if (last_end < input.length()) {
-        results.push_back(input.substr(last_end));
-      }
-    }
+  // Example: "the-final--countdown" with delimiter "-"
+  // Removed -> ["the", "final", "countdown"]
+  // Isolated -> ["the", "-", "final", "-", "-", "countdown"]
+  // MergedWithPrevious -> ["the-", "final-", "-", "countdown"]
+  SplitBuilder builder(behavior_, invert_, out);
+  size_t last_end = 0;
+  for (const auto& match : matches) {
+    builder.add(last_end, match.start, false);
+    builder.add(match.start, match.end, true);
+    last_end = match.end;
   }
-  return results;
+  builder.add(last_end, input.size(), false);
+  builder.finish();
 }
 
 // ByteLevelPreTokenizer ///////////////////////////////////////////////////////
@@ -275,7 +515,12 @@ ByteLevelPreTokenizer::ByteLevelPreTokenizer(
     bool add_prefix_space,
     const std::string& pattern)
     : pattern_(pattern.empty() ? GPT2_EXPR : pattern),
-      add_prefix_space_(add_prefix_space) {}
+      add_prefix_space_(add_prefix_space) {
+  auto regex = create_pike_regex(pattern_);
+  if (regex.ok()) {
+    regex_ = std::move(*regex);
+  }
+}
 
 std::vector<std::string> ByteLevelPreTokenizer::pre_tokenize(
     const std::string& input) const {
@@ -286,17 +531,268 @@ std::vector<std::string> ByteLevelPreTokenizer::pre_tokenize(
     formatted_input.insert(formatted_input.begin(), ' ');
   }
 
-  return unicode_regex_split(formatted_input, {pattern_});
+  if (!regex_) {
+    return unicode_regex_split(formatted_input, {pattern_});
+  }
+
+  // Like unicode_regex_split, the text between matches is a piece too, and
+  // every byte is mapped to its printable code point
+  std::vector<std::string> result;
+  auto add_piece = [&](size_t start, size_t end) {
+    if (start == end) {
+      return;
+    }
+    std::string piece;
+    piece.reserve(2 * (end - start));
+    for (size_t i = start; i < end; ++i) {
+      piece += unicode_byte_to_utf8(static_cast<uint8_t>(formatted_input[i]));
+    }
+    result.push_back(std::move(piece));
+  };
+  size_t last = 0;
+  for (const auto& match : regex_->find_all(formatted_input)) {
+    add_piece(last, match.start);
+    add_piece(match.start, match.end);
+    last = match.end;
+  }
+  add_piece(last, formatted_input.size());
+  return result;
+}
+
+RegexStats ByteLevelPreTokenizer::regex_stats() const {
+  return regex_ ? regex_->stats() : RegexStats{};
+}
+
+// WhitespacePreTokenizer //////////////////////////////////////////////////////
+
+bool WhitespacePreTokenizer::pre_tokenize_offsets(
+    std::string_view input,
+    std::vector<Match>& out) const {
+  // Equivalent to the regex \w+|[^\w\s]+
+  split_runs(
+      input,
+      [](uint32_t, const unicode::CategoryRecord& record) {
+        if (record.flags & unicode::kWordCharacter) {
+          return CharClass::Word;
+        }
+        return is_whitespace(record) ? CharClass::Separator : CharClass::Other;
+      },
+      out);
+  return true;
+}
+
+// WhitespaceSplitPreTokenizer /////////////////////////////////////////////////
+
+bool WhitespaceSplitPreTokenizer::pre_tokenize_offsets(
+    std::string_view input,
+    std::vector<Match>& out) const {
+  split_runs(
+      input,
+      [](uint32_t, const unicode::CategoryRecord& record) {
+        return is_whitespace(record) ? CharClass::Separator : CharClass::Word;
+      },
+      out);
+  return true;
+}
+
+// PunctuationPreTokenizer /////////////////////////////////////////////////////
+
+bool PunctuationPreTokenizer::pre_tokenize_offsets(
+    std::string_view input,
+    std::vector<Match>& out) const {
+  split_chars(
+      input,
+      [](uint32_t, const unicode::CategoryRecord& record) {
+        return is_punctuation(record);
+      },
+      behavior_,
+      out);
+  return true;
+}
+
+// CharDelimiterSplitPreTokenizer //////////////////////////////////////////////
+
+CharDelimiterSplitPreTokenizer::CharDelimiterSplitPreTokenizer(
+    const std::string& delimiter)
+    : delimiter_(delimiter) {
+  if (!is_single_character(delimiter_)) {
+    throw std::runtime_error(
+        "CharDelimiterSplit delimiter must be a single character: " +
+        delimiter_);
+  }
+}
+
+bool CharDelimiterSplitPreTokenizer::pre_tokenize_offsets(
+    std::string_view input,
+    std::vector<Match>& out) const {
+  // The delimiter is a whole UTF-8 sequence, so a byte search can not match
+  // in the middle of another character
+  size_t start = 0;
+  for (size_t pos = input.find(delimiter_); pos != std::string_view::npos;
+       pos = input.find(delimiter_, start)) {
+    if (pos > start) {
+      out.push_back({start, pos});
+    }
+    start = pos + delimiter_.size();
+  }
+  if (start < input.size()) {
+    out.push_back({start, input.size()});
+  }
+  return true;
+}
+
+// UnicodeScriptsPreTokenizer //////////////////////////////////////////////////
+
+bool UnicodeScriptsPreTokenizer::pre_tokenize_offsets(
+    std::string_view input,
+    std::vector<Match>& out) const {
+  constexpr int kNone = -1;
+  // Script of the last character that was not a space
+  int last_script = kNone;
+  // Like tokenizers, leading characters without a script are dropped
+  size_t start = std::string_view::npos;
+  const char* data = input.data();
+  const size_t size = input.size();
+  size_t i = 0;
+  while (i < size) {
+    uint32_t cp = static_cast<unsigned char>(data[i]);
+    const size_t len =
+        cp < 0x80 ? 1 : unicode::decode_utf8(data + i, size - i, cp);
+    int script = unicode::categories(cp).script;
+    if (cp == ' ' || script == unicode::kScriptUnknown) {
+      script = kNone;
+    } else if (
+        cp == 0x30FC || script == unicode::kScriptHiragana ||
+        script == unicode::kScriptKatakana) {
+      // The prolonged sound mark is Common, but belongs with the kana
+      script = unicode::kScriptHan;
+    }
+    if (script != kNone) {
+      if (script != last_script) {
+        if (start != std::string_view::npos) {
+          out.push_back({start, i});
+        }
+        start = i;
+      }
+      last_script = script;
+    }
+    i += len;
+  }
+  if (start != std::string_view::npos) {
+    out.push_back({start, size});
+  }
+  return true;
+}
+
+// BertPreTokenizer ////////////////////////////////////////////////////////////
+
+bool BertPreTokenizer::pre_tokenize_offsets(
+    std::string_view input,
+    std::vector<Match>& out) const {
+  split_runs(
+      input,
+      [](uint32_t, const unicode::CategoryRecord& record) {
+        if (is_whitespace(record)) {
+          return CharClass::Separator;
+        }
+        return is_punctuation(record) ? CharClass::Isolated : CharClass::Word;
+      },
+      out);
+  return true;
+}
+
+// MetaspacePreTokenizer ///////////////////////////////////////////////////////
+
+MetaspacePreTokenizer::MetaspacePreTokenizer(
+    std::string replacement,
+    PrependScheme prepend_scheme,
+    bool split)
+    : replacement_(std::move(replacement)),
+      prepend_scheme_(prepend_scheme),
+      split_(split) {
+  if (!is_single_character(replacement_)) {
+    throw std::runtime_error(
+        "Metaspace replacement must be a single character: " + replacement_);
+  }
+}
+
+MetaspacePreTokenizer::PrependScheme MetaspacePreTokenizer::parse_prepend_scheme(
+    const std::string& name) {
+  if (name == "always") {
+    return PrependScheme::Always;
+  }
+  if (name == "first") {
+    return PrependScheme::First;
+  }
+  if (name == "never") {
+    return PrependScheme::Never;
+  }
+  throw std::runtime_error("Unsupported Metaspace prepend_scheme: " + name);
+}
+
+std::vector<std::string> MetaspacePreTokenizer::pre_tokenize(
+    const std::string& input) const {
+  if (input.empty()) {
+    return {};
+  }
+
+  // Replace the spaces. After the replacement the text already starts with it
+  // if the input starts with a space or with the replacement itself.
+  std::string text;
+  text.reserve(input.size() + replacement_.size() * 4);
+  if (prepend_scheme_ != PrependScheme::Never && input[0] != ' ' &&
+      input.compare(0, replacement_.size(), replacement_) != 0) {
+    text = replacement_;
+  }
+  size_t start = 0;
+  for (size_t pos = input.find(' '); pos != std::string::npos;
+       pos = input.find(' ', start)) {
+    text.append(input, start, pos - start);
+    text += replacement_;
+    start = pos + 1;
+  }
+  text.append(input, start, std::string::npos);
+
+  if (!split_) {
+    return {std::move(text)};
+  }
+
+  // Split in front of every replacement (MergedWithNext)
+  std::vector<std::string> results;
+  size_t piece_start = 0;
+  for (size_t pos = text.find(replacement_, 1); pos != std::string::npos;
+       pos = text.find(replacement_, pos + replacement_.size())) {
+    results.emplace_back(text, piece_start, pos - piece_start);
+    piece_start = pos;
+  }
+  results.emplace_back(text, piece_start, std::string::npos);
+  return results;
 }
 
 // SequencePreTokenizer ////////////////////////////////////////////////////////
 
 SequencePreTokenizer::SequencePreTokenizer(
     std::vector<PreTokenizer::Ptr> pre_tokenizers)
-    : pre_tokenizers_(std::move(pre_tokenizers)) {}
+    : pre_tokenizers_(std::move(pre_tokenizers)) {
+  for (const auto& pre_tokenizer : pre_tokenizers_) {
+    supports_offsets_ = supports_offsets_ && pre_tokenizer->supports_offsets();
+  }
+}
 
 std::vector<std::string> SequencePreTokenizer::pre_tokenize(
     const std::string& input) const {
+  // If every step only splits, refine offsets and copy the pieces out once
+  if (supports_offsets_) {
+    std::vector<Match> offsets;
+    pre_tokenize_offsets(input, offsets);
+    std::vector<std::string> results;
+    results.reserve(offsets.size());
+    for (const auto& piece : offsets) {
+      results.emplace_back(input, piece.start, piece.end - piece.start);
+    }
+    return results;
+  }
+
   std::vector<std::string> pieces{std::string(input)};
   for (const auto& pre_tokenizer : pre_tokenizers_) {
     std::vector<std::string> new_pieces;
@@ -310,4 +806,40 @@ std::vector<std::string> SequencePreTokenizer::pre_tokenize(
   return pieces;
 }
 
+bool SequencePreTokenizer::pre_tokenize_offsets(
+    std::string_view input,
+    std::vector<Match>& out) const {
+  if (!supports_offsets_) {
+    return false;
+  }
+  std::vector<Match> pieces{{0, input.size()}};
+  std::vector<Match> new_pieces;
+  for (const auto& pre_tokenizer : pre_tokenizers_) {
+    new_pieces.clear();
+    for (const auto& piece : pieces) {
+      const size_t first = new_pieces.size();
+      if (!pre_tokenizer->pre_tokenize_offsets(
+              input.substr(piece.start, piece.end - piece.start),
+              new_pieces)) {
+        return false;
+      }
+      for (size_t i = first; i < new_pieces.size(); ++i) {
+        new_pieces[i].start += piece.start;
+        new_pieces[i].end += piece.start;
+      }
+    }
+    std::swap(pieces, new_pieces);
+  }
+  out.insert(out.end(), pieces.begin(), pieces.end());
+  return true;
+}
+
+RegexStats SequencePreTokenizer::regex_stats() const {
+  RegexStats stats;
+  for (const auto& pre_tokenizer : pre_tokenizers_) {
+    stats += pre_tokenizer->regex_stats();
+  }
+  return stats;
+}
+
 } // namespace tokenizers
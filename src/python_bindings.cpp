@@ -12,6 +12,9 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <string>
+#include <string_view>
+
 #include <pytorch/tokenizers/error.h>
 #include <pytorch/tokenizers/hf_tokenizer.h>
 #include <pytorch/tokenizers/llama2c_tokenizer.h>
@@ -60,6 +63,9 @@ T unwrap_result(const Result<T>& result) {
       case Error::RegexFailure:
         error_msg = "RegexFailure";
         break;
+      case Error::Unsupported:
+        error_msg = "Unsupported";
+        break;
       default:
         error_msg = "Unknown error";
         break;
@@ -69,6 +75,68 @@ T unwrap_result(const Result<T>& result) {
   return result.get();
 }
 
+// The UTF-8 bytes of an encode() argument, viewed in place. A str is viewed
+// through the UTF-8 representation CPython caches in the object, so it is
+// converted at most once; bytes and other contiguous buffers (bytearray,
+// memoryview, numpy uint8 arrays) are viewed directly.
+class InputView {
+ public:
+  explicit InputView(py::handle input) {
+    PyObject* object = input.ptr();
+    if (PyUnicode_Check(object)) {
+      Py_ssize_t size = 0;
+      const char* data = PyUnicode_AsUTF8AndSize(object, &size);
+      if (data == nullptr) {
+        throw py::error_already_set();
+      }
+      text_ = std::string_view(data, static_cast<size_t>(size));
+    } else if (PyBytes_Check(object)) {
+      text_ = std::string_view(
+          PyBytes_AS_STRING(object),
+          static_cast<size_t>(PyBytes_GET_SIZE(object)));
+    } else if (PyObject_CheckBuffer(object)) {
+      if (PyObject_GetBuffer(object, &buffer_, PyBUF_SIMPLE) != 0) {
+        throw py::error_already_set();
+      }
+      has_buffer_ = true;
+      text_ = std::string_view(
+          static_cast<const char*>(buffer_.buf),
+          static_cast<size_t>(buffer_.len));
+    } else {
+      throw py::type_error(
+          "encode() expects str, bytes or a bytes-like object, got " +
+          std::string(Py_TYPE(object)->tp_name));
+    }
+  }
+
+  ~InputView() {
+    if (has_buffer_) {
+      PyBuffer_Release(&buffer_);
+    }
+  }
+
+  InputView(const InputView&) = delete;
+  InputView& operator=(const InputView&) = delete;
+
+  std::string_view text() const {
+    return text_;
+  }
+
+ private:
+  std::string_view text_;
+  Py_buffer buffer_{};
+  bool has_buffer_ = false;
+};
+
+// encode() binding of every tokenizer. The input is valid for the whole call
+// since the caller holds a reference to it.
+template <typename T>
+std::vector<uint64_t>
+encode_input(const T& self, py::handle input, int8_t bos, int8_t eos) {
+  const InputView view(input);
+  return unwrap_result(self.encode_view(view.text(), bos, eos));
+}
+
 PYBIND11_MODULE(pytorch_tokenizers_cpp, m) {
   m.doc() = "PyTorch Tokenizers Python bindings";
 
@@ -83,7 +151,8 @@ PYBIND11_MODULE(pytorch_tokenizers_cpp, m) {
       .value("Base64DecodeFailure", Error::Base64DecodeFailure)
       .value("ParseFailure", Error::ParseFailure)
       .value("DecodeFailure", Error::DecodeFailure)
-      .value("RegexFailure", Error::RegexFailure);
+      .value("RegexFailure", Error::RegexFailure)
+      .value("Unsupported", Error::Unsupported);
 
   // Bind TokenIndex struct
   py::class_<TokenIndex>(m, "TokenIndex")
@@ -103,12 +172,7 @@ PYBIND11_MODULE(pytorch_tokenizers_cpp, m) {
           py::arg("tokenizer_path"))
       .def(
           "encode",
-          [](const Tokenizer& self,
-             const std::string& input,
-             int8_t bos,
-             int8_t eos) {
-            return unwrap_result(self.encode(input, bos, eos));
-          },
+          &encode_input<Tokenizer>,
           py::arg("input"),
           py::arg("bos") = 0,
           py::arg("eos") = 0)
@@ -137,12 +201,7 @@ PYBIND11_MODULE(pytorch_tokenizers_cpp, m) {
           py::arg("tokenizer_path"))
       .def(
           "encode",
-          [](const HFTokenizer& self,
-             const std::string& input,
-             int8_t bos,
-             int8_t eos) {
-            return unwrap_result(self.encode(input, bos, eos));
-          },
+          &encode_input<HFTokenizer>,
           py::arg("input"),
           py::arg("bos") = 0,
           py::arg("eos") = 0)
@@ -178,12 +237,7 @@ PYBIND11_MODULE(pytorch_tokenizers_cpp, m) {
           py::arg("tokenizer_path"))
       .def(
           "encode",
-          [](const Tiktoken& self,
-             const std::string& input,
-             int8_t bos,
-             int8_t eos) {
-            return unwrap_result(self.encode(input, bos, eos));
-          },
+          &encode_input<Tiktoken>,
           py::arg("input"),
           py::arg("bos") = 0,
           py::arg("eos") = 0)
@@ -208,12 +262,7 @@ PYBIND11_MODULE(pytorch_tokenizers_cpp, m) {
           py::arg("tokenizer_path"))
       .def(
           "encode",
-          [](const Llama2cTokenizer& self,
-             const std::string& input,
-             int8_t bos,
-             int8_t eos) {
-            return unwrap_result(self.encode(input, bos, eos));
-          },
+          &encode_input<Llama2cTokenizer>,
           py::arg("input"),
           py::arg("bos") = 0,
           py::arg("eos") = 0)
@@ -239,12 +288,7 @@ PYBIND11_MODULE(pytorch_tokenizers_cpp, m) {
           py::arg("tokenizer_path"))
       .def(
           "encode",
-          [](const SPTokenizer& self,
-             const std::string& input,
-             int8_t bos,
-             int8_t eos) {
-            return unwrap_result(self.encode(input, bos, eos));
-          },
+          &encode_input<SPTokenizer>,
           py::arg("input"),
           py::arg("bos") = 0,
           py::arg("eos") = 0)
@@ -269,12 +313,7 @@ PYBIND11_MODULE(pytorch_tokenizers_cpp, m) {
           py::arg("tokenizer_path"))
       .def(
           "encode",
-          [](const Tekken& self,
-             const std::string& input,
-             int8_t bos,
-             int8_t eos) {
-            return unwrap_result(self.encode(input, bos, eos));
-          },
+          &encode_input<Tekken>,
           py::arg("input"),
           py::arg("bos") = 0,
           py::arg("eos") = 0)
@@ -8,44 +8,146 @@
 
 #include <pytorch/tokenizers/re2_regex.h>
 
+// Standard
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
 namespace tokenizers {
 
+namespace {
+
+// RE2 reports DFA cache resets and search failures through process-wide
+// hooks without saying which RE2 object they belong to. The hooks count them
+// per thread, and find_all attributes to its replica what the count grew by
+// during its search, which runs on that thread.
+thread_local uint64_t thread_cache_resets = 0;
+thread_local uint64_t thread_search_failures = 0;
+
+re2::hooks::DFAStateCacheResetCallback* previous_cache_reset_hook = nullptr;
+re2::hooks::DFASearchFailureCallback* previous_search_failure_hook = nullptr;
+
+void on_dfa_cache_reset(const re2::hooks::DFAStateCacheReset& event) {
+  ++thread_cache_resets;
+  if (previous_cache_reset_hook) {
+    previous_cache_reset_hook(event);
+  }
+}
+
+void on_dfa_search_failure(const re2::hooks::DFASearchFailure& event) {
+  ++thread_search_failures;
+  if (previous_search_failure_hook) {
+    previous_search_failure_hook(event);
+  }
+}
+
+void install_hooks() {
+  static std::once_flag once;
+  std::call_once(once, [] {
+    previous_cache_reset_hook = re2::hooks::GetDFAStateCacheResetHook();
+    previous_search_failure_hook = re2::hooks::GetDFASearchFailureHook();
+    re2::hooks::SetDFAStateCacheResetHook(on_dfa_cache_reset);
+    re2::hooks::SetDFASearchFailureHook(on_dfa_search_failure);
+  });
+}
+
+// Threads are assigned round-robin indices so that up to num_replicas
+// threads each get a replica of their own.
+size_t thread_index() {
+  static std::atomic<size_t> next_index{0};
+  thread_local const size_t index =
+      next_index.fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+
+} // namespace
+
 Error Re2Regex::compile(const std::string& pattern) {
-  regex_ = std::make_unique<re2::RE2>(pattern);
-  // Warmup re2 as it is slow on the first run, void the return value as it's
-  // not needed Refer to
-  // https://github.com/google/re2/blob/6dcd83d60f7944926bfd308cc13979fc53dd69ca/re2/fuzzing/re2_fuzzer.cc#L136-L141
-  (void)regex_->ReverseProgramSize();
-  if (regex_->ok()) {
-    return Error::Ok;
-  } else {
-    // It should log using Error level but it's too confusing.
-    TK_LOG(
-        Info,
-        "Re2 failed to compile regex: %s, error: %s\nThis may be ok if a fallback regex is used.",
-        pattern.c_str(),
-        regex_->error().c_str());
-    return Error::RegexFailure;
+  install_hooks();
+
+  re2::RE2::Options re2_options;
+  if (options_.max_mem > 0) {
+    re2_options.set_max_mem(options_.max_mem);
+    // With an explicit budget, running out of DFA memory is expected and is
+    // reported through stats() instead of once per search.
+    re2_options.set_log_errors(false);
+  }
+  size_t num_replicas = options_.num_replicas;
+  if (num_replicas == 0) {
+    num_replicas = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  replicas_.clear();
+  for (size_t i = 0; i < num_replicas; ++i) {
+    auto replica = std::make_unique<Replica>();
+    replica->regex = std::make_unique<re2::RE2>(pattern, re2_options);
+    // Warmup re2 as it is slow on the first run, void the return value as
+    // it's not needed Refer to
+    // https://github.com/google/re2/blob/6dcd83d60f7944926bfd308cc13979fc53dd69ca/re2/fuzzing/re2_fuzzer.cc#L136-L141
+    (void)replica->regex->ReverseProgramSize();
+    if (!replica->regex->ok()) {
+      // It should log using Error level but it's too confusing.
+      TK_LOG(
+          Info,
+          "Re2 failed to compile regex: %s, error: %s\nThis may be ok if a fallback regex is used.",
+          pattern.c_str(),
+          replica->regex->error().c_str());
+      replicas_.clear();
+      return Error::RegexFailure;
+    }
+    replicas_.push_back(std::move(replica));
   }
+  return Error::Ok;
 }
 
-std::vector<Match> Re2Regex::find_all(const std::string& text) const {
-  if (!regex_ || !regex_->ok()) {
+std::vector<Match> Re2Regex::find_all(std::string_view text) const {
+  if (replicas_.empty()) {
     TK_LOG(Error, "Regex is not compiled or invalid, run compile() first");
     return std::vector<Match>{};
   }
+  const size_t index = thread_index();
+  const auto& replica = *replicas_[index % replicas_.size()];
+  // Threads sharing a replica count their searches on separate cache lines
+  replica.searches[index % kSearchCounters].value.fetch_add(
+      1, std::memory_order_relaxed);
+  const uint64_t cache_resets = thread_cache_resets;
+  const uint64_t search_failures = thread_search_failures;
+
   std::vector<Match> result;
-  re2::StringPiece input(text);
+  re2::StringPiece input(text.data(), text.size());
   re2::StringPiece piece;
 
   const char* base = input.data();
 
-  while (RE2::FindAndConsume(&input, *regex_, &piece)) {
+  while (RE2::FindAndConsume(&input, *replica.regex, &piece)) {
     size_t start = piece.data() - base;
     result.push_back({start, start + piece.size()});
   }
 
+  if (thread_cache_resets != cache_resets) {
+    replica.dfa_cache_resets.fetch_add(
+        thread_cache_resets - cache_resets, std::memory_order_relaxed);
+  }
+  if (thread_search_failures != search_failures) {
+    replica.dfa_search_failures.fetch_add(
+        thread_search_failures - search_failures, std::memory_order_relaxed);
+  }
   return result;
 }
 
+RegexStats Re2Regex::stats() const {
+  RegexStats stats;
+  for (const auto& replica : replicas_) {
+    for (const auto& searches : replica->searches) {
+      stats.searches += searches.value.load(std::memory_order_relaxed);
+    }
+    stats.dfa_cache_resets +=
+        replica->dfa_cache_resets.load(std::memory_order_relaxed);
+    stats.dfa_search_failures +=
+        replica->dfa_search_failures.load(std::memory_order_relaxed);
+  }
+  stats.replicas = replicas_.size();
+  return stats;
+}
+
 } // namespace tokenizers
@@ -5,21 +5,36 @@
  * This source code is licensed under the BSD-style license found in the
  * LICENSE file in the root directory of this source tree.
  */
-// Default implementation for create_regex, only using RE2 regex library.
-// regex_lookahead.cpp has the implementation of create_regex with lookahead
-// support, backed by PCRE2 and std::regex.
+// Default implementation for create_regex, using the RE2 regex library and
+// falling back to the linear-time Pike VM for the lookahead patterns RE2
+// rejects. regex_lookahead.cpp has the implementation of create_fallback_regex
+// backed by PCRE2, then the Pike VM and std::regex. The TOKENIZERS_MINIMAL
+// build has no regex engine and only supports the patterns of native_regex.h.
 
-#include <pytorch/tokenizers/re2_regex.h>
+#include <pytorch/tokenizers/native_regex.h>
 #include <pytorch/tokenizers/regex.h>
+#ifndef TOKENIZERS_MINIMAL
+#include <pytorch/tokenizers/pike_regex.h>
+#include <pytorch/tokenizers/re2_regex.h>
+#include <pytorch/tokenizers/regex_autotune.h>
+#endif
 
 namespace tokenizers {
 
+#ifndef TOKENIZERS_MINIMAL
+// Default implementation backed by the Pike VM
+static Result<std::unique_ptr<IRegex>> default_create_fallback_regex(
+    const std::string& pattern) {
+  return create_pike_regex(pattern);
+}
+#else
 // Default implementation that returns failure
 static Result<std::unique_ptr<IRegex>> default_create_fallback_regex(
     const std::string& pattern) {
   (void)pattern;
   return tokenizers::Error::RegexFailure;
 }
+#endif // TOKENIZERS_MINIMAL
 
 FallbackRegexFn fallback_regex = default_create_fallback_regex;
 
@@ -33,6 +48,84 @@ FallbackRegexFn get_fallback_regex() {
   return fallback_regex;
 }
 
+const char* regex_engine_name(RegexEngine engine) {
+  switch (engine) {
+    case RegexEngine::Default:
+      return "default";
+    case RegexEngine::Native:
+      return "native";
+    case RegexEngine::RE2:
+      return "re2";
+    case RegexEngine::PCRE2:
+      return "pcre2";
+    case RegexEngine::Std:
+      return "std";
+    case RegexEngine::Pike:
+      return "pike";
+  }
+  return "unknown";
+}
+
+static Result<std::unique_ptr<IRegex>> create_native_engine_regex(
+    const std::string& pattern,
+    const RegexOptions& options) {
+  (void)options;
+  return create_native_regex(pattern);
+}
+
+#ifndef TOKENIZERS_MINIMAL
+static Result<std::unique_ptr<IRegex>> create_re2_engine_regex(
+    const std::string& pattern,
+    const RegexOptions& options) {
+  auto re2 = std::make_unique<Re2Regex>(options);
+  TK_CHECK_OK_OR_RETURN_ERROR(re2->compile("(" + pattern + ")"));
+  return static_cast<std::unique_ptr<IRegex>>(std::move(re2));
+}
+
+static Result<std::unique_ptr<IRegex>> create_pike_engine_regex(
+    const std::string& pattern,
+    const RegexOptions& options) {
+  (void)options;
+  return create_pike_regex(pattern);
+}
+#endif // TOKENIZERS_MINIMAL
+
+// Indexed by RegexEngine
+static RegexEngineFn regex_engines[] = {
+    nullptr,
+    create_native_engine_regex,
+#ifndef TOKENIZERS_MINIMAL
+    create_re2_engine_regex,
+#else
+    nullptr,
+#endif
+    nullptr,
+    nullptr,
+#ifndef TOKENIZERS_MINIMAL
+    create_pike_engine_regex,
+#else
+    nullptr,
+#endif
+};
+
+bool register_regex_engine(RegexEngine engine, RegexEngineFn fn) {
+  const auto index = static_cast<size_t>(engine);
+  if (engine == RegexEngine::Default ||
+      index >= sizeof(regex_engines) / sizeof(regex_engines[0])) {
+    return false;
+  }
+  TK_LOG(Info, "Registering regex engine %s", regex_engine_name(engine));
+  regex_engines[index] = fn;
+  return true;
+}
+
+RegexEngineFn get_regex_engine(RegexEngine engine) {
+  const auto index = static_cast<size_t>(engine);
+  return index < sizeof(regex_engines) / sizeof(regex_engines[0])
+      ? regex_engines[index]
+      : nullptr;
+}
+
 std::string IRegex::escape(const std::string& input) {
   std::string result;
   result.reserve(input.size() * 2); // Reserve space for potential escaping
@@ -50,9 +143,47 @@ std::string IRegex::escape(const std::string& input) {
   return result;
 }
 
-Result<std::unique_ptr<IRegex>> create_regex(const std::string& pattern) {
+#ifdef TOKENIZERS_MINIMAL
+Result<std::unique_ptr<IRegex>> create_regex(
+    const std::string& pattern,
+    const RegexOptions& options) {
+  (void)options;
+  auto native = create_native_regex(pattern);
+  if (native.ok()) {
+    return native;
+  }
+
+  auto res = get_fallback_regex()(pattern);
+  if (res.ok()) {
+    return res;
+  }
+  TK_LOG(
+      Error,
+      "Pattern is not supported by the minimal build: %s",
+      pattern.c_str());
+  return tokenizers::Error::RegexFailure;
+}
+#else
+Result<std::unique_ptr<IRegex>> create_regex(
+    const std::string& pattern,
+    const RegexOptions& options) {
+  if (options.engine != RegexEngine::Default) {
+    const auto engine = get_regex_engine(options.engine);
+    if (!engine) {
+      TK_LOG(
+          Error,
+          "Regex engine %s is not linked in",
+          regex_engine_name(options.engine));
+      return tokenizers::Error::RegexFailure;
+    }
+    return engine(pattern, options);
+  }
+  if (options.autotune) {
+    return create_autotuned_regex(pattern, options);
+  }
+
   // Try RE2 first
-  auto re2 = std::make_unique<Re2Regex>();
+  auto re2 = std::make_unique<Re2Regex>(options);
   auto err = re2->compile("(" + pattern + ")");
 
   if (err == Error::Ok) {
@@ -63,11 +194,13 @@ Result<std::unique_ptr<IRegex>> create_regex(const std::string& pattern) {
   if (!res.ok()) {
     TK_LOG(
         Error,
-        "RE2 doesn't support lookahead patterns. Link with `regex_lookahead` to enable support.");
+        "Neither RE2 nor the fallback regex engine support the pattern. Link with `regex_lookahead` to enable PCRE2.");
   } else {
     return res;
   }
 
   return tokenizers::Error::RegexFailure;
 }
+#endif // TOKENIZERS_MINIMAL
+
 } // namespace tokenizers
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/regex_autotune.h>
+
+// Standard
+#include <cerrno>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <sstream>
+
+// Local
+#include <pytorch/tokenizers/log.h>
+#include <pytorch/tokenizers/warm_start.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+namespace tokenizers {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr RegexEngine kEngines[] = {
+    RegexEngine::Native,
+    RegexEngine::RE2,
+    RegexEngine::PCRE2,
+    RegexEngine::Std,
+    RegexEngine::Pike,
+};
+
+// Passes over the sample per engine, the fastest one counts
+constexpr int kRounds = 3;
+
+// -- Cache --------------------------------------------------------------------
+// One "<pattern hash> <engine name>" line per pattern
+
+std::string cache_key(const std::string& pattern) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char c : pattern) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001b3ULL;
+  }
+  char key[17];
+  std::snprintf(key, sizeof(key), "%016" PRIx64, hash);
+  return key;
+}
+
+std::optional<RegexEngine> read_cache(
+    const std::string& path,
+    const std::string& key) {
+  std::ifstream file(path);
+  std::string line_key;
+  std::string name;
+  while (file >> line_key >> name) {
+    if (line_key != key) {
+      continue;
+    }
+    if (name == regex_engine_name(RegexEngine::Default)) {
+      return RegexEngine::Default;
+    }
+    for (const auto engine : kEngines) {
+      if (name == regex_engine_name(engine)) {
+        return engine;
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+// Exclusive lock on "<path>.lock" while in scope, so that processes tuning
+// at the same time merge their entries into the cache one after the other.
+// Where the lock file cannot be used, writes are still atomic but may drop a
+// concurrent writer's entries.
+class CacheLock {
+ public:
+  explicit CacheLock(const std::string& path) {
+#ifndef _WIN32
+    const std::string lock_path = path + ".lock";
+    fd_ = ::open(lock_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+      TK_LOG(Info, "Failed to open %s, not locking", lock_path.c_str());
+      return;
+    }
+    while (::flock(fd_, LOCK_EX) != 0) {
+      if (errno != EINTR) {
+        TK_LOG(Info, "Failed to lock %s", lock_path.c_str());
+        break;
+      }
+    }
+#else
+    (void)path;
+#endif
+  }
+
+  ~CacheLock() {
+#ifndef _WIN32
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+#endif
+  }
+
+  CacheLock(const CacheLock&) = delete;
+  CacheLock& operator=(const CacheLock&) = delete;
+
+ private:
+  int fd_ = -1;
+};
+
+void write_cache(
+    const std::string& path,
+    const std::string& key,
+    RegexEngine engine) {
+  // Read, merge and replace under the lock, or entries written by another
+  // process between the read and the rename would be lost
+  const CacheLock lock(path);
+  std::stringstream contents;
+  {
+    std::ifstream file(path);
+    std::string line_key;
+    std::string name;
+    while (file >> line_key >> name) {
+      if (line_key != key) {
+        contents << line_key << ' ' << name << '\n';
+      }
+    }
+  }
+  contents << key << ' ' << regex_engine_name(engine) << '\n';
+
+  // Replace the file atomically, so that concurrent loads read either the old
+  // or the new choices
+  std::string temp_path = path + ".tmp";
+#ifndef _WIN32
+  temp_path += std::to_string(::getpid()) + ".";
+#endif
+  temp_path += std::to_string(Clock::now().time_since_epoch().count());
+  {
+    std::ofstream file(temp_path, std::ios::trunc);
+    file << contents.str();
+    if (!file) {
+      TK_LOG(Error, "Failed to write regex autotune cache %s", path.c_str());
+      std::remove(temp_path.c_str());
+      return;
+    }
+  }
+  if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+    TK_LOG(Error, "Failed to write regex autotune cache %s", path.c_str());
+    std::remove(temp_path.c_str());
+  }
+}
+
+// -- Benchmark ----------------------------------------------------------------
+
+std::vector<std::vector<Match>> find_all(
+    const IRegex& regex,
+    const std::vector<std::string>& sample) {
+  std::vector<std::vector<Match>> matches;
+  matches.reserve(sample.size());
+  for (const auto& text : sample) {
+    matches.push_back(regex.find_all(text));
+  }
+  return matches;
+}
+
+bool same_matches(
+    const std::vector<std::vector<Match>>& a,
+    const std::vector<std::vector<Match>>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].size() != b[i].size()) {
+      return false;
+    }
+    for (size_t j = 0; j < a[i].size(); ++j) {
+      if (a[i][j].start != b[i][j].start || a[i][j].end != b[i][j].end) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+double nanos_per_byte(
+    const IRegex& regex,
+    const std::vector<std::string>& sample,
+    size_t bytes) {
+  auto best = Clock::duration::max();
+  size_t num_matches = 0;
+  for (int round = 0; round < kRounds; ++round) {
+    const auto start = Clock::now();
+    for (const auto& text : sample) {
+      num_matches += regex.find_all(text).size();
+    }
+    best = std::min(best, Clock::now() - start);
+  }
+  (void)num_matches;
+  return std::chrono::duration<double, std::nano>(best).count() /
+      std::max<size_t>(bytes, 1);
+}
+
+/**
+ * Benchmark the engines, and hand out the compiled regex of the winner so that
+ * create_autotuned_regex() does not compile it again
+ */
+Result<RegexAutotuneResult> tune(
+    const std::string& pattern,
+    const std::vector<std::string>& sample_or_empty,
+    const RegexOptions& options,
+    std::unique_ptr<IRegex>* winner) {
+  const auto& sample =
+      sample_or_empty.empty() ? warm_start_corpus() : sample_or_empty;
+  size_t bytes = 0;
+  for (const auto& text : sample) {
+    bytes += text.size();
+  }
+
+  RegexOptions engine_options = options;
+  engine_options.autotune = false;
+  engine_options.engine = RegexEngine::Default;
+  auto reference = create_regex(pattern, engine_options);
+
+  struct Candidate {
+    RegexEngineTiming timing;
+    std::unique_ptr<IRegex> regex;
+  };
+  std::vector<Candidate> candidates;
+  for (const auto engine : kEngines) {
+    const auto create = get_regex_engine(engine);
+    if (!create) {
+      continue;
+    }
+    engine_options.engine = engine;
+    auto regex = create(pattern, engine_options);
+    if (regex.ok()) {
+      candidates.push_back({{engine, 0, false}, std::move(*regex)});
+    }
+  }
+  if (!reference.ok() && candidates.empty()) {
+    TK_LOG(Error, "No regex engine compiles the pattern %s", pattern.c_str());
+    return Error::RegexFailure;
+  }
+
+  const auto expected =
+      find_all(reference.ok() ? **reference : *candidates[0].regex, sample);
+  RegexAutotuneResult result;
+  double best = std::numeric_limits<double>::infinity();
+  Candidate* fastest = nullptr;
+  for (auto& candidate : candidates) {
+    auto& timing = candidate.timing;
+    timing.agrees = same_matches(find_all(*candidate.regex, sample), expected);
+    timing.nanos_per_byte = nanos_per_byte(*candidate.regex, sample, bytes);
+    TK_LOG(
+        Info,
+        "Regex engine %s: %.3f ns/byte%s",
+        regex_engine_name(timing.engine),
+        timing.nanos_per_byte,
+        timing.agrees ? "" : ", matches differ");
+    if (timing.agrees && timing.nanos_per_byte < best) {
+      best = timing.nanos_per_byte;
+      fastest = &candidate;
+    }
+    result.timings.push_back(timing);
+  }
+
+  // A custom fallback may agree with none of the engines, keep it then
+  result.engine = fastest ? fastest->timing.engine : RegexEngine::Default;
+  if (winner) {
+    *winner = fastest ? std::move(fastest->regex) : std::move(*reference);
+  }
+  if (!options.autotune_cache.empty()) {
+    write_cache(options.autotune_cache, cache_key(pattern), result.engine);
+  }
+  return result;
+}
+
+std::optional<RegexEngine> cached_engine(
+    const std::string& pattern,
+    const RegexOptions& options) {
+  if (options.autotune_cache.empty()) {
+    return std::nullopt;
+  }
+  const auto engine = read_cache(options.autotune_cache, cache_key(pattern));
+  if (engine && *engine != RegexEngine::Default &&
+      !get_regex_engine(*engine)) {
+    // Recorded by a build with more engines
+    return std::nullopt;
+  }
+  return engine;
+}
+
+} // namespace
+
+Result<RegexAutotuneResult> autotune_regex(
+    const std::string& pattern,
+    const std::vector<std::string>& sample,
+    const RegexOptions& options) {
+  if (const auto engine = cached_engine(pattern, options)) {
+    RegexAutotuneResult result;
+    result.engine = *engine;
+    result.from_cache = true;
+    return result;
+  }
+  return tune(pattern, sample, options, nullptr);
+}
+
+Result<std::unique_ptr<IRegex>> create_autotuned_regex(
+    const std::string& pattern,
+    const RegexOptions& options) {
+  RegexOptions engine_options = options;
+  engine_options.autotune = false;
+  if (const auto engine = cached_engine(pattern, options)) {
+    engine_options.engine = *engine;
+    auto regex = create_regex(pattern, engine_options);
+    if (regex.ok()) {
+      return regex;
+    }
+  }
+
+  std::unique_ptr<IRegex> regex;
+  const auto result = tune(pattern, {}, options, &regex);
+  TK_CHECK_OK_OR_RETURN_ERROR(result.error());
+  TK_LOG(
+      Info,
+      "Autotuned regex engine: %s",
+      regex_engine_name(result->engine));
+  return regex;
+}
+
+} // namespace tokenizers
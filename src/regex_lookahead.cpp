@@ -9,6 +9,7 @@
 // This file contains the implementation of create_regex with lookahead support
 
 #include <pytorch/tokenizers/pcre2_regex.h>
+#include <pytorch/tokenizers/pike_regex.h>
 #include <pytorch/tokenizers/regex.h>
 #include <pytorch/tokenizers/std_regex.h>
 
@@ -20,7 +21,7 @@ namespace tokenizers {
 /**
  * @brief Implementation of the fallback regex function with lookahead support.
  *        Falls back to PCRE2 if RE2 rejects the pattern due to lookahead.
- *        Falls back to std::regex if PCRE2 also fails.
+ *        Falls back to the Pike VM, then std::regex, if PCRE2 also fails.
  */
 Result<std::unique_ptr<IRegex>> create_fallback_regex(
     const std::string& pattern) {
@@ -32,7 +33,15 @@ Result<std::unique_ptr<IRegex>> create_fallback_regex(
     return static_cast<std::unique_ptr<IRegex>>(std::move(pcre2));
   }
 
-  // If PCRE2 also fails, fall back to std::regex
+  // If PCRE2 also fails, try the linear-time Pike VM, which unlike std::regex
+  // cannot overflow the stack on long inputs
+  auto pike = create_pike_regex(pattern);
+  if (pike.ok()) {
+    TK_LOG(Info, "PCRE2 failed to compile pattern, falling back to PikeRegex.");
+    return pike;
+  }
+
+  // Last resort, std::regex
   auto std_regex = std::make_unique<StdRegex>();
   err = std_regex->compile(pattern);
   if (err == Error::Ok) {
@@ -47,4 +56,20 @@ Result<std::unique_ptr<IRegex>> create_fallback_regex(
 static bool registered =
     register_override_fallback_regex(create_fallback_regex);
 
+template <typename T>
+static Result<std::unique_ptr<IRegex>> create_engine_regex(
+    const std::string& pattern,
+    const RegexOptions& options) {
+  (void)options;
+  auto regex = std::make_unique<T>();
+  TK_CHECK_OK_OR_RETURN_ERROR(regex->compile(pattern));
+  return static_cast<std::unique_ptr<IRegex>>(std::move(regex));
+}
+
+static bool registered_pcre2 = register_regex_engine(
+    RegexEngine::PCRE2,
+    create_engine_regex<Pcre2Regex>);
+static bool registered_std =
+    register_regex_engine(RegexEngine::Std, create_engine_regex<StdRegex>);
+
 } // namespace tokenizers
@@ -24,10 +24,10 @@ Error StdRegex::compile(const std::string& pattern) {
   }
 }
 
-std::vector<Match> StdRegex::find_all(const std::string& text) const {
+std::vector<Match> StdRegex::find_all(std::string_view text) const {
   std::vector<Match> result;
-  std::sregex_iterator iter(text.begin(), text.end(), regex_);
-  std::sregex_iterator end;
+  std::cregex_iterator iter(text.data(), text.data() + text.size(), regex_);
+  std::cregex_iterator end;
 
   for (; iter != end; ++iter) {
     const auto& match = *iter;
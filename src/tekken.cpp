@@ -25,31 +25,20 @@ using namespace detail;
 Tekken::Tekken() {}
 
 Error Tekken::_encode(
-    const std::string& input,
+    std::string_view input,
     std::vector<uint64_t>& ret,
     uint64_t& last_piece_token_len) const {
-  std::string piece;
   assert(_regex);
-  for (const auto& match : _regex->find_all(input)) {
-    std::string matched_text =
-        input.substr(match.start, match.end - match.start);
-
-    // Try to find the whole word in token map first
-    const auto result = token_map_->tryGetInteger(matched_text);
-    if (result) {
-      last_piece_token_len = 1;
-      ret.push_back(*result);
-      continue;
-    }
+  return encode_pieces_(
+      input, _regex->find_all(input), ret, last_piece_token_len);
+}
 
-    // Fall back to BPE encoding
-    auto tokens_result = byte_pair_encode_(matched_text, *token_map_);
-    if (!tokens_result.ok()) {
-      return tokens_result.error();
-    }
-    auto tokens = std::move(*tokens_result);
-    last_piece_token_len = tokens.size();
-    ret.insert(ret.end(), tokens.begin(), tokens.end());
+Error Tekken::_pre_tokenize(
+    std::string_view input,
+    std::vector<std::string>& pieces) const {
+  assert(_regex);
+  for (const auto& match : _regex->find_all(input)) {
+    pieces.emplace_back(input.substr(match.start, match.end - match.start));
   }
   return Error::Ok;
 }
@@ -165,18 +154,21 @@ Error Tekken::load(const std::string& tokenizer_path) {
 
   special_token_map_.emplace(TokenMap(special_token_pairs));
 
-  // Initialize regex with the pattern from config
-  auto regex_result = create_regex(_pattern);
-  if (!regex_result.ok()) {
-    return regex_result.error();
-  }
-  _regex = std::move(*regex_result);
-  auto special_token_regex_result =
-      build_special_token_regex(*special_token_map_);
-  if (!special_token_regex_result.ok()) {
-    return special_token_regex_result.error();
+  // Initialize regex with the pattern from config, unless only decoding
+  if (mode_ != TokenizerMode::DecodeOnly) {
+    auto regex_result = create_regex(_pattern, regex_options_);
+    if (!regex_result.ok()) {
+      return regex_result.error();
+    }
+    _regex = std::move(*regex_result);
+    auto special_token_regex_result =
+        build_special_token_regex(*special_token_map_, regex_options_);
+    if (!special_token_regex_result.ok()) {
+      return special_token_regex_result.error();
+    }
+    special_token_regex_ = std::move(*special_token_regex_result);
+    TK_CHECK_OK_OR_RETURN_ERROR(build_closed_form_pieces_());
   }
-  special_token_regex_ = std::move(*special_token_regex_result);
 
   // Set vocab size and special token indices
   vocab_size_ = token_map_->size() + special_token_map_->size();
@@ -209,6 +201,14 @@ Error Tekken::load(const std::string& tokenizer_path) {
   return Error::Ok;
 }
 
+RegexStats Tekken::regex_stats() const {
+  auto stats = BPETokenizerBase::regex_stats();
+  if (_regex) {
+    stats += _regex->stats();
+  }
+  return stats;
+}
+
 Error Tekken::load_with_special_tokens(
     const std::string& tokenizer_path,
     const std::vector<SpecialTokenInfo>& explicit_special_tokens) {
@@ -278,7 +278,7 @@ Result<TokenMap> Tekken::_load_vocab_from_json(
   }
 
   TK_LOG(Info, "Built vocabulary with %zu tokens", pairs.size());
-  return build_token_map(pairs);
+  return build_token_map(pairs, detail::token_map_direction(mode_));
 }
 
 std::vector<Tekken::SpecialTokenInfo> Tekken::_initialize_special_tokens(
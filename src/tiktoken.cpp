@@ -28,6 +28,8 @@
 #include <pytorch/tokenizers/base64.h>
 #include <pytorch/tokenizers/tiktoken.h>
 #include <algorithm>
+#include <cctype>
+#include <charconv>
 #include <cinttypes>
 #include <fstream>
 #include <limits>
@@ -41,9 +43,10 @@ using namespace detail;
 namespace {
 
 static Result<std::unique_ptr<IRegex>> _create_regex(
-    const std::string& pattern) {
+    const std::string& pattern,
+    const RegexOptions& options) {
   assert(!pattern.empty());
-  return create_regex(pattern);
+  return create_regex(pattern, options);
 }
 
 static Result<std::pair<std::string, uint64_t>> _parse(
@@ -63,18 +66,28 @@ static Result<std::pair<std::string, uint64_t>> _parse(
     return token_result.error();
   }
   auto token = std::move(*token_result);
+  // Parsed without exceptions so that the minimal build can disable them.
+  // Leading white space and trailing characters such as '\r' are ignored.
   uint64_t rank = 0;
-  try {
-    rank = std::stoul(line.substr(pos + 1));
-  } catch (const std::exception&) {
-    TK_CHECK_OR_RETURN_ERROR(
-        false, EncodeFailure, "invalid encoder rank: %s", line.c_str());
+  const char* rank_begin = line.data() + pos + 1;
+  const char* rank_end = line.data() + line.size();
+  while (rank_begin < rank_end &&
+         std::isspace(static_cast<unsigned char>(*rank_begin))) {
+    ++rank_begin;
   }
+  const auto rank_result = std::from_chars(rank_begin, rank_end, rank);
+  TK_CHECK_OR_RETURN_ERROR(
+      rank_result.ec == std::errc(),
+      EncodeFailure,
+      "invalid encoder rank: %s",
+      line.c_str());
 
   return std::pair{std::move(token), rank};
 }
 
-static Result<TokenMap> _load_token_map(const std::string& path) {
+static Result<TokenMap> _load_token_map(
+    const std::string& path,
+    detail::MapDirection direction) {
   std::ifstream file(path);
   TK_CHECK_OR_RETURN_ERROR(
       file, LoadFailure, "failed to open encoder file: %s", path.c_str());
@@ -95,7 +108,7 @@ static Result<TokenMap> _load_token_map(const std::string& path) {
     pairs.emplace_back(std::move(token), rank);
   }
 
-  return build_token_map(pairs);
+  return build_token_map(pairs, direction);
 }
 
 } // namespace
@@ -104,27 +117,20 @@ static Result<TokenMap> _load_token_map(const std::string& path) {
 // -------------------------private method start-------------------------------
 
 Error Tiktoken::_encode(
-    const std::string& input,
+    std::string_view input,
     std::vector<uint64_t>& ret,
     uint64_t& last_piece_token_len) const {
-  std::string piece;
+  assert(_regex);
+  return encode_pieces_(
+      input, _regex->find_all(input), ret, last_piece_token_len);
+}
+
+Error Tiktoken::_pre_tokenize(
+    std::string_view input,
+    std::vector<std::string>& pieces) const {
   assert(_regex);
   for (const auto& match : _regex->find_all(input)) {
-    std::string matched_text =
-        input.substr(match.start, match.end - match.start);
-    const auto result = token_map_->tryGetInteger(matched_text);
-    if (result) {
-      last_piece_token_len = 1;
-      ret.push_back(*result);
-      continue;
-    }
-    auto tokens_result = byte_pair_encode_(matched_text, *token_map_);
-    if (!tokens_result.ok()) {
-      return tokens_result.error();
-    }
-    auto tokens = std::move(*tokens_result);
-    last_piece_token_len = tokens.size();
-    ret.insert(ret.end(), tokens.begin(), tokens.end());
+    pieces.emplace_back(input.substr(match.start, match.end - match.start));
   }
   return Error::Ok;
 }
@@ -137,7 +143,8 @@ void Tiktoken::_decode(const std::string& input, std::string& ret) const {
 // -------------------------public method start-------------------------------
 
 Error Tiktoken::load(const std::string& path) {
-  auto token_map_result = _load_token_map(path);
+  auto token_map_result =
+      _load_token_map(path, detail::token_map_direction(mode_));
   if (!token_map_result.ok()) {
     return token_map_result.error();
   }
@@ -151,17 +158,22 @@ Error Tiktoken::load(const std::string& path) {
 
   special_token_map_.emplace(TokenMap(special_token_map));
 
-  auto regex_result = _create_regex(_pattern);
-  if (!regex_result.ok()) {
-    return regex_result.error();
-  }
-  _regex = std::move(*regex_result);
-  auto special_token_regex_result =
-      detail::build_special_token_regex(TokenMap(special_token_map));
-  if (!special_token_regex_result.ok()) {
-    return special_token_regex_result.error();
+  // The regexes only split text to encode
+  if (mode_ != TokenizerMode::DecodeOnly) {
+    auto regex_result = _create_regex(_pattern, regex_options_);
+    if (!regex_result.ok()) {
+      return regex_result.error();
+    }
+    _regex = std::move(*regex_result);
+    auto special_token_regex_result =
+        detail::build_special_token_regex(
+            TokenMap(special_token_map), regex_options_);
+    if (!special_token_regex_result.ok()) {
+      return special_token_regex_result.error();
+    }
+    special_token_regex_ = std::move(*special_token_regex_result);
+    TK_CHECK_OK_OR_RETURN_ERROR(build_closed_form_pieces_());
   }
-  special_token_regex_ = std::move(*special_token_regex_result);
 
   // initialize vocab_size, bos_tok, eos_tok
   vocab_size_ = token_map_->size() + special_token_map_->size();
@@ -174,6 +186,14 @@ Error Tiktoken::load(const std::string& path) {
   return Error::Ok;
 }
 
+RegexStats Tiktoken::regex_stats() const {
+  auto stats = BPETokenizerBase::regex_stats();
+  if (_regex) {
+    stats += _regex->stats();
+  }
+  return stats;
+}
+
 // -------------------------public method end-------------------------------
 
 } // namespace tokenizers
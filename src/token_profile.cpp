@@ -0,0 +1,471 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/token_profile.h>
+
+// Standard
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <unordered_map>
+
+// Local
+#include <pytorch/tokenizers/log.h>
+
+namespace tokenizers {
+
+namespace {
+
+constexpr char kMagic[8] = {'T', 'K', 'P', 'R', 'O', 'F', '0', '1'};
+
+// Token counts are stored sparsely, so a profile of a large vocabulary can be
+// tiny. The dense table a profile loads into is bounded instead by the
+// largest vocabulary it may describe, well past any tokenizer's.
+constexpr uint64_t kMaxVocabSize = uint64_t(1) << 24;
+
+// What one part of the corpus contained, with pieces numbered in order of
+// appearance
+struct WorkerProfile {
+  uint64_t num_bytes = 0;
+  uint64_t num_pieces = 0;
+  uint64_t num_tokens = 0;
+  std::vector<uint64_t> token_counts;
+  std::unordered_map<std::string, uint32_t> piece_ids;
+  std::vector<ProfiledPiece> pieces;
+  // Ids of the pieces that are looked up in the piece cache, in order
+  std::vector<uint32_t> lookups;
+  std::vector<uint64_t> piece_length_histogram;
+  std::vector<uint64_t> merge_count_histogram;
+  Error error = Error::Ok;
+};
+
+size_t bucket(uint64_t value) {
+  return std::min<uint64_t>(value, TokenProfile::kHistogramBuckets - 1);
+}
+
+// Hits of an LRU cache of the given capacity over the stream of piece ids
+uint64_t simulate_lru(
+    const std::vector<uint32_t>& lookups,
+    size_t num_pieces,
+    size_t capacity) {
+  if (capacity == 0) {
+    return 0;
+  }
+  // Doubly linked recency list threaded through arrays indexed by piece id
+  constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+  std::vector<uint32_t> prev(num_pieces, kNone);
+  std::vector<uint32_t> next(num_pieces, kNone);
+  std::vector<bool> cached(num_pieces, false);
+  uint32_t head = kNone;
+  uint32_t tail = kNone;
+  size_t size = 0;
+  uint64_t hits = 0;
+
+  const auto unlink = [&](uint32_t id) {
+    (prev[id] == kNone ? head : next[prev[id]]) = next[id];
+    (next[id] == kNone ? tail : prev[next[id]]) = prev[id];
+  };
+  const auto push_front = [&](uint32_t id) {
+    prev[id] = kNone;
+    next[id] = head;
+    (head == kNone ? tail : prev[head]) = id;
+    head = id;
+  };
+
+  for (const uint32_t id : lookups) {
+    if (cached[id]) {
+      ++hits;
+      unlink(id);
+    } else if (size == capacity) {
+      const uint32_t victim = tail;
+      unlink(victim);
+      cached[victim] = false;
+      cached[id] = true;
+    } else {
+      cached[id] = true;
+      ++size;
+    }
+    push_front(id);
+  }
+  return hits;
+}
+
+// -- Serialization ------------------------------------------------------------
+
+uint64_t fnv1a(const char* data, size_t size) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ static_cast<uint8_t>(data[i])) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+void put_varint(std::string& out, uint64_t value) {
+  while (value >= 0x80) {
+    out += static_cast<char>((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+  out += static_cast<char>(value);
+}
+
+void put_counts(std::string& out, const std::vector<uint64_t>& counts) {
+  put_varint(out, counts.size());
+  for (const uint64_t count : counts) {
+    put_varint(out, count);
+  }
+}
+
+class Reader {
+ public:
+  Reader(const char* data, size_t size) : data_(data), end_(data + size) {}
+
+  bool varint(uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (data_ == end_) {
+        return false;
+      }
+      const auto byte = static_cast<uint8_t>(*data_++);
+      value |= uint64_t(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // A count of elements that each take at least one more byte
+  bool size(uint64_t& value) {
+    return varint(value) && value <= static_cast<uint64_t>(end_ - data_);
+  }
+
+  bool bytes(std::string& value, size_t size) {
+    if (static_cast<size_t>(end_ - data_) < size) {
+      return false;
+    }
+    value.assign(data_, size);
+    data_ += size;
+    return true;
+  }
+
+  bool counts(std::vector<uint64_t>& counts) {
+    uint64_t count = 0;
+    if (!size(count)) {
+      return false;
+    }
+    counts.resize(count);
+    for (auto& value : counts) {
+      if (!varint(value)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool done() const {
+    return data_ == end_;
+  }
+
+ private:
+  const char* data_;
+  const char* end_;
+};
+
+} // namespace
+
+std::vector<std::string> TokenProfile::top_pieces(size_t n) const {
+  std::vector<std::string> result;
+  for (size_t i = 0; i < std::min(n, pieces.size()); ++i) {
+    result.push_back(pieces[i].piece);
+  }
+  return result;
+}
+
+Result<TokenProfile> profile_corpus(
+    const detail::BPETokenizerBase& tokenizer,
+    const std::vector<std::string>& documents,
+    const TokenProfileConfig& config) {
+  if (!tokenizer.is_loaded()) {
+    return Error::Uninitialized;
+  }
+  const auto executor = config.executor ? config.executor : default_executor();
+  const size_t num_parts = config.num_threads > 0 ? config.num_threads
+                                                  : executor->concurrency();
+  const size_t vocab_size = std::max(0, tokenizer.vocab_size());
+
+  std::vector<WorkerProfile> workers(
+      std::max<size_t>(1, std::min(num_parts, documents.size())));
+  parallel_for_parts(
+      *executor,
+      documents.size(),
+      num_parts,
+      [&](size_t t, size_t begin, size_t end) {
+        WorkerProfile& worker = workers[t];
+        worker.token_counts.assign(vocab_size, 0);
+        worker.piece_length_histogram.assign(
+            TokenProfile::kHistogramBuckets, 0);
+        worker.merge_count_histogram.assign(TokenProfile::kHistogramBuckets, 0);
+        const auto visit = [&worker](
+                               std::string_view piece,
+                               const std::vector<uint64_t>& tokens,
+                               bool special) {
+          for (const uint64_t token : tokens) {
+            if (token >= worker.token_counts.size()) {
+              worker.token_counts.resize(token + 1, 0);
+            }
+            ++worker.token_counts[token];
+          }
+          worker.num_tokens += tokens.size();
+          if (special) {
+            return;
+          }
+          ++worker.num_pieces;
+          const auto [it, inserted] = worker.piece_ids.emplace(
+              std::string(piece), worker.pieces.size());
+          if (inserted) {
+            worker.pieces.push_back(
+                {it->first, 0, static_cast<uint32_t>(tokens.size())});
+          }
+          ++worker.pieces[it->second].count;
+          if (tokens.size() > 1) {
+            worker.lookups.push_back(it->second);
+          }
+          ++worker.piece_length_histogram[bucket(piece.size())];
+          ++worker.merge_count_histogram[bucket(
+              piece.size() > tokens.size() ? piece.size() - tokens.size()
+                                           : 0)];
+        };
+        for (size_t i = begin; i < end && worker.error == Error::Ok; ++i) {
+          worker.num_bytes += documents[i].size();
+          worker.error = tokenizer.visit_pieces(documents[i], visit);
+        }
+      });
+
+  // Merge the workers in document order
+  TokenProfile profile;
+  profile.num_documents = documents.size();
+  profile.token_counts.assign(vocab_size, 0);
+  profile.piece_length_histogram.assign(TokenProfile::kHistogramBuckets, 0);
+  profile.merge_count_histogram.assign(TokenProfile::kHistogramBuckets, 0);
+  std::unordered_map<std::string, uint32_t> piece_ids;
+  std::vector<uint32_t> lookups;
+  for (auto& worker : workers) {
+    if (worker.error != Error::Ok) {
+      return worker.error;
+    }
+    profile.num_bytes += worker.num_bytes;
+    profile.num_pieces += worker.num_pieces;
+    profile.num_tokens += worker.num_tokens;
+    if (worker.token_counts.size() > profile.token_counts.size()) {
+      profile.token_counts.resize(worker.token_counts.size(), 0);
+    }
+    for (size_t i = 0; i < worker.token_counts.size(); ++i) {
+      profile.token_counts[i] += worker.token_counts[i];
+    }
+    for (size_t i = 0; i < TokenProfile::kHistogramBuckets; ++i) {
+      profile.piece_length_histogram[i] += worker.piece_length_histogram[i];
+      profile.merge_count_histogram[i] += worker.merge_count_histogram[i];
+    }
+    std::vector<uint32_t> global_ids(worker.pieces.size());
+    for (size_t i = 0; i < worker.pieces.size(); ++i) {
+      auto& piece = worker.pieces[i];
+      const auto [it, inserted] =
+          piece_ids.emplace(piece.piece, profile.pieces.size());
+      if (inserted) {
+        profile.pieces.push_back({std::move(piece.piece), 0, piece.num_tokens});
+      }
+      profile.pieces[it->second].count += piece.count;
+      global_ids[i] = it->second;
+    }
+    for (const uint32_t id : worker.lookups) {
+      lookups.push_back(global_ids[id]);
+    }
+    worker = WorkerProfile();
+  }
+
+  for (const size_t capacity : config.cache_sizes) {
+    CacheSimulation simulation;
+    simulation.capacity = capacity;
+    simulation.lookups = lookups.size();
+    simulation.lru_hits =
+        simulate_lru(lookups, profile.pieces.size(), capacity);
+    profile.cache_simulations.push_back(simulation);
+  }
+
+  std::sort(
+      profile.pieces.begin(),
+      profile.pieces.end(),
+      [](const ProfiledPiece& a, const ProfiledPiece& b) {
+        return a.count != b.count ? a.count > b.count : a.piece < b.piece;
+      });
+
+  // A static table holds the most frequent of the looked up pieces
+  for (auto& simulation : profile.cache_simulations) {
+    size_t held = 0;
+    for (const auto& piece : profile.pieces) {
+      if (held == simulation.capacity) {
+        break;
+      }
+      if (piece.num_tokens > 1) {
+        simulation.static_hits += piece.count;
+        ++held;
+      }
+    }
+  }
+
+  if (config.max_pieces > 0 && profile.pieces.size() > config.max_pieces) {
+    profile.pieces.resize(config.max_pieces);
+  }
+  return profile;
+}
+
+Error save_token_profile(const TokenProfile& profile, const std::string& path) {
+  std::string out(kMagic, sizeof(kMagic));
+  put_varint(out, profile.num_documents);
+  put_varint(out, profile.num_bytes);
+  put_varint(out, profile.num_pieces);
+  put_varint(out, profile.num_tokens);
+
+  // Token counts: the vocabulary size, then (id delta, count) of the tokens
+  // that occurred
+  put_varint(out, profile.token_counts.size());
+  const auto nonzero = profile.token_counts.size() -
+      std::count(profile.token_counts.begin(), profile.token_counts.end(), 0);
+  put_varint(out, nonzero);
+  uint64_t prev = 0;
+  for (size_t id = 0; id < profile.token_counts.size(); ++id) {
+    if (profile.token_counts[id] != 0) {
+      put_varint(out, id - prev);
+      put_varint(out, profile.token_counts[id]);
+      prev = id;
+    }
+  }
+
+  put_varint(out, profile.pieces.size());
+  for (const auto& piece : profile.pieces) {
+    put_varint(out, piece.piece.size());
+    out += piece.piece;
+    put_varint(out, piece.count);
+    put_varint(out, piece.num_tokens);
+  }
+
+  put_counts(out, profile.piece_length_histogram);
+  put_counts(out, profile.merge_count_histogram);
+
+  put_varint(out, profile.cache_simulations.size());
+  for (const auto& simulation : profile.cache_simulations) {
+    put_varint(out, simulation.capacity);
+    put_varint(out, simulation.lookups);
+    put_varint(out, simulation.lru_hits);
+    put_varint(out, simulation.static_hits);
+  }
+
+  const uint64_t checksum = fnv1a(out.data(), out.size());
+  for (int i = 0; i < 8; ++i) {
+    out += static_cast<char>(checksum >> (8 * i));
+  }
+
+  std::ofstream file(path, std::ios::binary);
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), Internal, "failed to open %s", path.c_str());
+  file.write(out.data(), out.size());
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), Internal, "failed to write %s", path.c_str());
+  return Error::Ok;
+}
+
+Result<TokenProfile> load_token_profile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), LoadFailure, "failed to open %s", path.c_str());
+  const std::string data(
+      (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  TK_CHECK_OR_RETURN_ERROR(
+      data.size() >= sizeof(kMagic) + 8 &&
+          std::memcmp(data.data(), kMagic, sizeof(kMagic)) == 0,
+      ParseFailure,
+      "%s is not a token profile",
+      path.c_str());
+  const size_t body_size = data.size() - 8;
+  uint64_t checksum = 0;
+  for (int i = 0; i < 8; ++i) {
+    checksum |= uint64_t(static_cast<uint8_t>(data[body_size + i])) << (8 * i);
+  }
+  TK_CHECK_OR_RETURN_ERROR(
+      checksum == fnv1a(data.data(), body_size),
+      ParseFailure,
+      "checksum mismatch in %s",
+      path.c_str());
+
+  TokenProfile profile;
+  Reader reader(data.data() + sizeof(kMagic), body_size - sizeof(kMagic));
+  bool ok = reader.varint(profile.num_documents) &&
+      reader.varint(profile.num_bytes) && reader.varint(profile.num_pieces) &&
+      reader.varint(profile.num_tokens);
+
+  uint64_t vocab_size = 0;
+  uint64_t nonzero = 0;
+  ok = ok && reader.varint(vocab_size) && reader.size(nonzero) &&
+      nonzero <= vocab_size && vocab_size <= kMaxVocabSize;
+  // The listed counts take at least two bytes each, and are read before the
+  // dense table is allocated so that a truncated table fails first
+  std::vector<std::pair<uint64_t, uint64_t>> listed(ok ? nonzero : 0);
+  uint64_t id = 0;
+  for (auto& [listed_id, count] : listed) {
+    uint64_t delta = 0;
+    ok = ok && reader.varint(delta) && delta < vocab_size - id &&
+        reader.varint(count);
+    id += delta;
+    listed_id = id;
+  }
+  if (ok) {
+    profile.token_counts.assign(vocab_size, 0);
+    for (const auto& [listed_id, count] : listed) {
+      profile.token_counts[listed_id] = count;
+    }
+  }
+
+  uint64_t num_pieces = 0;
+  ok = ok && reader.size(num_pieces);
+  if (ok) {
+    profile.pieces.resize(num_pieces);
+  }
+  for (auto& piece : profile.pieces) {
+    uint64_t length = 0;
+    uint64_t num_tokens = 0;
+    ok = ok && reader.varint(length) && reader.bytes(piece.piece, length) &&
+        reader.varint(piece.count) && reader.varint(num_tokens);
+    piece.num_tokens = static_cast<uint32_t>(num_tokens);
+  }
+
+  ok = ok && reader.counts(profile.piece_length_histogram) &&
+      reader.counts(profile.merge_count_histogram);
+
+  uint64_t num_simulations = 0;
+  ok = ok && reader.size(num_simulations);
+  if (ok) {
+    profile.cache_simulations.resize(num_simulations);
+  }
+  for (auto& simulation : profile.cache_simulations) {
+    ok = ok && reader.varint(simulation.capacity) &&
+        reader.varint(simulation.lookups) &&
+        reader.varint(simulation.lru_hits) &&
+        reader.varint(simulation.static_hits);
+  }
+
+  TK_CHECK_OR_RETURN_ERROR(
+      ok && reader.done(), ParseFailure, "malformed profile %s", path.c_str());
+  return profile;
+}
+
+} // namespace tokenizers
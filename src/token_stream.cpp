@@ -0,0 +1,816 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/token_stream.h>
+
+// Standard
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Local
+#include <pytorch/tokenizers/log.h>
+#include <pytorch/tokenizers/simd_utils.h>
+
+namespace tokenizers {
+
+namespace {
+
+constexpr char kMagic[8] = {'T', 'K', 'S', 'T', 'R', 'M', '0', '1'};
+constexpr size_t kHeaderSize = sizeof(kMagic) + 4 + 4 + 8 + 8 + 8;
+
+// Values per packed group: 32 in each of 4 lanes
+constexpr size_t kGroupSize = 128;
+
+// Exceptions are indexed with 16 bits
+constexpr uint32_t kMaxBlockSize = 1 << 16;
+
+// The Ranked writer keeps a rank and a count for every id of the vocabulary
+constexpr uint64_t kMaxRankedVocabSize = uint64_t(1) << 24;
+
+uint32_t bit_width(uint64_t value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index;
+  return _BitScanReverse64(&index, value) ? index + 1 : 0;
+#else
+  return value == 0 ? 0 : 64 - __builtin_clzll(value);
+#endif
+}
+
+// Widest value a block of the given coding may hold
+uint32_t max_width(TokenStreamCoding coding, uint64_t vocab_size) {
+  const uint32_t width = bit_width(vocab_size - 1);
+  return coding == TokenStreamCoding::Delta ? std::min(32u, width + 1) : width;
+}
+
+uint32_t zigzag(uint32_t delta) {
+  const auto sign = static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31);
+  return (delta << 1) ^ sign;
+}
+
+uint32_t unzigzag(uint32_t value) {
+  return (value >> 1) ^ (0u - (value & 1));
+}
+
+void put_u32(std::string& out, uint32_t value) {
+  for (int i = 0; i < 4; ++i) {
+    out += static_cast<char>(value >> (8 * i));
+  }
+}
+
+void put_u64(std::string& out, uint64_t value) {
+  for (int i = 0; i < 8; ++i) {
+    out += static_cast<char>(value >> (8 * i));
+  }
+}
+
+uint32_t get_u32(const char* data) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    value |= uint32_t(static_cast<uint8_t>(data[i])) << (8 * i);
+  }
+  return value;
+}
+
+uint64_t get_u64(const char* data) {
+  uint64_t value = 0;
+  for (int i = 0; i < 8; ++i) {
+    value |= uint64_t(static_cast<uint8_t>(data[i])) << (8 * i);
+  }
+  return value;
+}
+
+// -- Bit packing --------------------------------------------------------------
+//
+// A group of 128 values is packed in 4 interleaved lanes: value 4 * j + l is
+// the j-th value of lane l, and each lane packs its 32 values into `width`
+// 32-bit words. Word k of the four lanes is stored as 16 consecutive bytes,
+// so one vector load brings in a word of every lane and all lanes shift by
+// the same amount. Words are stored in host order; all supported targets are
+// little endian.
+
+size_t packed_group_bytes(uint32_t width) {
+  return size_t(width) * 16;
+}
+
+void pack_group(const uint32_t* in, uint32_t width, char* out) {
+  if (width == 0) {
+    return;
+  }
+#if defined(TK_SIMD_SSE2)
+  __m128i acc = _mm_setzero_si128();
+  uint32_t shift = 0;
+  for (size_t j = 0; j < 32; ++j) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 4 * j));
+    acc = _mm_or_si128(acc, _mm_sll_epi32(v, _mm_cvtsi32_si128(shift)));
+    shift += width;
+    if (shift >= 32) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out), acc);
+      out += 16;
+      shift -= 32;
+      acc = shift == 0
+          ? _mm_setzero_si128()
+          : _mm_srl_epi32(v, _mm_cvtsi32_si128(width - shift));
+    }
+  }
+#elif defined(TK_SIMD_NEON)
+  uint32x4_t acc = vdupq_n_u32(0);
+  int32_t shift = 0;
+  for (size_t j = 0; j < 32; ++j) {
+    const uint32x4_t v = vld1q_u32(in + 4 * j);
+    acc = vorrq_u32(acc, vshlq_u32(v, vdupq_n_s32(shift)));
+    shift += width;
+    if (shift >= 32) {
+      vst1q_u8(reinterpret_cast<uint8_t*>(out), vreinterpretq_u8_u32(acc));
+      out += 16;
+      shift -= 32;
+      acc = shift == 0
+          ? vdupq_n_u32(0)
+          : vshlq_u32(v, vdupq_n_s32(shift - static_cast<int32_t>(width)));
+    }
+  }
+#else
+  uint32_t acc[4] = {0, 0, 0, 0};
+  uint32_t shift = 0;
+  for (size_t j = 0; j < 32; ++j) {
+    const uint32_t* v = in + 4 * j;
+    for (size_t lane = 0; lane < 4; ++lane) {
+      acc[lane] |= v[lane] << shift;
+    }
+    shift += width;
+    if (shift >= 32) {
+      std::memcpy(out, acc, 16);
+      out += 16;
+      shift -= 32;
+      for (size_t lane = 0; lane < 4; ++lane) {
+        acc[lane] = shift == 0 ? 0 : v[lane] >> (width - shift);
+      }
+    }
+  }
+#endif
+}
+
+void unpack_group(const char* in, uint32_t width, uint32_t* out) {
+  if (width == 0) {
+    std::fill(out, out + kGroupSize, 0);
+    return;
+  }
+  const uint32_t mask = width == 32 ? ~0u : (1u << width) - 1;
+  uint32_t bit = 0;
+#if defined(TK_SIMD_SSE2)
+  const __m128i mask_v = _mm_set1_epi32(static_cast<int32_t>(mask));
+  for (size_t j = 0; j < 32; ++j, bit += width) {
+    const char* word = in + 16 * (bit >> 5);
+    const uint32_t shift = bit & 31;
+    __m128i v = _mm_srl_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(word)),
+        _mm_cvtsi32_si128(shift));
+    if (shift + width > 32) {
+      const __m128i next =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(word + 16));
+      v = _mm_or_si128(v, _mm_sll_epi32(next, _mm_cvtsi32_si128(32 - shift)));
+    }
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(out + 4 * j), _mm_and_si128(v, mask_v));
+  }
+#elif defined(TK_SIMD_NEON)
+  const uint32x4_t mask_v = vdupq_n_u32(mask);
+  for (size_t j = 0; j < 32; ++j, bit += width) {
+    const char* word = in + 16 * (bit >> 5);
+    const int32_t shift = static_cast<int32_t>(bit & 31);
+    uint32x4_t v = vshlq_u32(
+        vreinterpretq_u32_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(word))),
+        vdupq_n_s32(-shift));
+    if (shift + width > 32) {
+      const uint32x4_t next = vreinterpretq_u32_u8(
+          vld1q_u8(reinterpret_cast<const uint8_t*>(word + 16)));
+      v = vorrq_u32(v, vshlq_u32(next, vdupq_n_s32(32 - shift)));
+    }
+    vst1q_u32(out + 4 * j, vandq_u32(v, mask_v));
+  }
+#else
+  for (size_t j = 0; j < 32; ++j, bit += width) {
+    const char* word = in + 16 * (bit >> 5);
+    const uint32_t shift = bit & 31;
+    uint32_t lo[4];
+    std::memcpy(lo, word, 16);
+    for (size_t lane = 0; lane < 4; ++lane) {
+      uint32_t v = lo[lane] >> shift;
+      if (shift + width > 32) {
+        uint32_t hi;
+        std::memcpy(&hi, word + 16 + 4 * lane, 4);
+        v |= hi << (32 - shift);
+      }
+      out[4 * j + lane] = v & mask;
+    }
+  }
+#endif
+}
+
+// -- Blocks -------------------------------------------------------------------
+
+// A block: u32 width | exception width << 8, u32 number of exceptions, u32
+// first token (Delta only), the packed groups, then the exceptions: their u16
+// indices in the block, ascending, and the bits above `width` of their
+// values, packed LSB first. Both exception arrays are padded to 4 bytes.
+struct Block {
+  uint32_t width;
+  uint32_t exception_width;
+  uint32_t num_exceptions;
+  uint32_t first;
+  const char* packed;
+  const char* exception_indices;
+  const char* exception_values;
+};
+
+size_t block_header_bytes(bool delta) {
+  return delta ? 12 : 8;
+}
+
+size_t num_groups(uint64_t count) {
+  return (count + kGroupSize - 1) / kGroupSize;
+}
+
+uint64_t pad4(uint64_t size) {
+  return (size + 3) & ~uint64_t(3);
+}
+
+uint64_t exception_indices_bytes(uint64_t num_exceptions) {
+  return pad4(2 * num_exceptions);
+}
+
+uint64_t exception_values_bytes(uint64_t num_exceptions, uint32_t width) {
+  return pad4((num_exceptions * width + 7) / 8);
+}
+
+Block parse_block(const char* data, bool delta, uint64_t count) {
+  Block block;
+  const uint32_t widths = get_u32(data);
+  block.width = widths & 0xFF;
+  block.exception_width = widths >> 8;
+  block.num_exceptions = get_u32(data + 4);
+  block.first = delta ? get_u32(data + 8) : 0;
+  block.packed = data + block_header_bytes(delta);
+  block.exception_indices =
+      block.packed + num_groups(count) * packed_group_bytes(block.width);
+  block.exception_values = block.exception_indices +
+      exception_indices_bytes(block.num_exceptions);
+  return block;
+}
+
+uint64_t block_bytes(const Block& block, bool delta, uint64_t count) {
+  return block_header_bytes(delta) +
+      uint64_t(num_groups(count)) * packed_group_bytes(block.width) +
+      exception_indices_bytes(block.num_exceptions) +
+      exception_values_bytes(block.num_exceptions, block.exception_width);
+}
+
+uint32_t exception_index(const Block& block, uint32_t e) {
+  const auto* p =
+      reinterpret_cast<const uint8_t*>(block.exception_indices + 2 * e);
+  return p[0] | (uint32_t(p[1]) << 8);
+}
+
+// Bits of exception e above the block width
+uint32_t exception_value(const Block& block, uint32_t e) {
+  const uint64_t bit = uint64_t(e) * block.exception_width;
+  const auto* p =
+      reinterpret_cast<const uint8_t*>(block.exception_values + bit / 8);
+  const uint32_t bytes = (bit % 8 + block.exception_width + 7) / 8;
+  uint64_t value = 0;
+  for (uint32_t i = 0; i < bytes; ++i) {
+    value |= uint64_t(p[i]) << (8 * i);
+  }
+  return static_cast<uint32_t>(
+      (value >> (bit % 8)) & ((uint64_t(1) << block.exception_width) - 1));
+}
+
+} // namespace
+
+// TokenStreamWriter ///////////////////////////////////////////////////////////
+
+TokenStreamWriter::TokenStreamWriter(TokenStreamConfig config)
+    : config_(std::move(config)), config_error_(validate()) {
+  if (config_error_ == Error::Ok && !config_.ranking.empty() &&
+      config_.coding == TokenStreamCoding::Ranked) {
+    build_ranks(config_.ranking);
+  }
+}
+
+Error TokenStreamWriter::validate() const {
+  TK_CHECK_OR_RETURN_ERROR(
+      config_.vocab_size > 0 && config_.vocab_size <= (uint64_t(1) << 32),
+      EncodeFailure,
+      "token stream vocab_size must be in [1, 2^32], got %" PRIu64,
+      config_.vocab_size);
+  TK_CHECK_OR_RETURN_ERROR(
+      config_.block_size > 0 && config_.block_size <= kMaxBlockSize &&
+          config_.block_size % kGroupSize == 0,
+      EncodeFailure,
+      "token stream block_size must be a multiple of %zu up to %" PRIu32
+      ", got %" PRIu32,
+      kGroupSize,
+      kMaxBlockSize,
+      config_.block_size);
+  if (config_.coding == TokenStreamCoding::Ranked) {
+    TK_CHECK_OR_RETURN_ERROR(
+        config_.vocab_size <= kMaxRankedVocabSize,
+        EncodeFailure,
+        "Ranked token streams support a vocab_size of at most %" PRIu64
+        ", got %" PRIu64,
+        kMaxRankedVocabSize,
+        config_.vocab_size);
+    std::vector<bool> seen(config_.vocab_size, false);
+    for (const uint32_t id : config_.ranking) {
+      TK_CHECK_OR_RETURN_ERROR(
+          id < config_.vocab_size && !seen[id],
+          EncodeFailure,
+          "token %" PRIu32 " is out of range or ranked twice",
+          id);
+      seen[id] = true;
+    }
+  }
+  return Error::Ok;
+}
+
+void TokenStreamWriter::build_ranks(const std::vector<uint32_t>& ranking) {
+  // Listed ids first, then the others in increasing order
+  ranks_.assign(config_.vocab_size, 0);
+  std::vector<bool> listed(config_.vocab_size, false);
+  uint32_t rank = 0;
+  for (const uint32_t id : ranking) {
+    ranks_[id] = rank++;
+    listed[id] = true;
+  }
+  for (uint64_t id = 0; id < config_.vocab_size; ++id) {
+    if (!listed[id]) {
+      ranks_[id] = rank++;
+    }
+  }
+}
+
+void TokenStreamWriter::flush_block(const uint32_t* tokens, size_t count) {
+  const size_t padded = (count + kGroupSize - 1) / kGroupSize * kGroupSize;
+  std::vector<uint32_t> values(padded, 0);
+  switch (config_.coding) {
+    case TokenStreamCoding::Plain:
+      std::copy(tokens, tokens + count, values.begin());
+      break;
+    case TokenStreamCoding::Delta:
+      // values[0] stays 0, the first token is stored in the block header
+      for (size_t i = 1; i < count; ++i) {
+        values[i] = zigzag(tokens[i] - tokens[i - 1]);
+      }
+      break;
+    case TokenStreamCoding::Ranked:
+      for (size_t i = 0; i < count; ++i) {
+        values[i] = ranks_[tokens[i]];
+      }
+      break;
+  }
+  // Pick the width that makes the block smallest. Values wider than that are
+  // patched in as exceptions, so that a few rare tokens do not widen the
+  // whole block.
+  const size_t groups = padded / kGroupSize;
+  size_t values_of_width[33] = {};
+  for (size_t i = 0; i < count; ++i) {
+    ++values_of_width[bit_width(values[i])];
+  }
+  uint32_t widest = 32;
+  while (widest > 0 && values_of_width[widest] == 0) {
+    --widest;
+  }
+  uint32_t width = widest;
+  uint64_t best_size = groups * packed_group_bytes(widest);
+  uint64_t wider = 0;
+  for (uint32_t w = widest; w-- > 0;) {
+    wider += values_of_width[w + 1];
+    const uint64_t size = groups * packed_group_bytes(w) +
+        exception_indices_bytes(wider) +
+        exception_values_bytes(wider, widest - w);
+    if (size < best_size) {
+      best_size = size;
+      width = w;
+    }
+  }
+  const uint32_t exception_width = widest - width;
+  std::vector<uint16_t> exception_indices;
+  std::vector<uint32_t> exception_values;
+  if (exception_width > 0) {
+    for (size_t i = 0; i < count; ++i) {
+      if (values[i] >> width) {
+        exception_indices.push_back(static_cast<uint16_t>(i));
+        exception_values.push_back(values[i] >> width);
+        values[i] &= (1u << width) - 1;
+      }
+    }
+  }
+
+  block_offsets_.push_back(blocks_.size());
+  put_u32(blocks_, width | (exception_width << 8));
+  put_u32(blocks_, static_cast<uint32_t>(exception_indices.size()));
+  if (config_.coding == TokenStreamCoding::Delta) {
+    put_u32(blocks_, tokens[0]);
+  }
+  const size_t start = blocks_.size();
+  blocks_.resize(start + groups * packed_group_bytes(width));
+  char* out = &blocks_[start];
+  for (size_t i = 0; i < padded; i += kGroupSize) {
+    pack_group(values.data() + i, width, out);
+    out += packed_group_bytes(width);
+  }
+
+  const size_t num_exceptions = exception_indices.size();
+  std::string exceptions(
+      exception_indices_bytes(num_exceptions) +
+          exception_values_bytes(num_exceptions, exception_width),
+      '\0');
+  for (size_t e = 0; e < num_exceptions; ++e) {
+    exceptions[2 * e] = static_cast<char>(exception_indices[e]);
+    exceptions[2 * e + 1] = static_cast<char>(exception_indices[e] >> 8);
+  }
+  char* bits = &exceptions[exception_indices_bytes(num_exceptions)];
+  for (size_t e = 0; e < num_exceptions; ++e) {
+    const uint64_t bit = uint64_t(e) * exception_width;
+    const uint64_t value = uint64_t(exception_values[e]) << (bit % 8);
+    for (uint32_t i = 0; i * 8 < bit % 8 + exception_width; ++i) {
+      bits[bit / 8 + i] |= static_cast<char>(value >> (8 * i));
+    }
+  }
+  blocks_ += exceptions;
+}
+
+Error TokenStreamWriter::append(const uint64_t* tokens, size_t count) {
+  TK_CHECK_OK_OR_RETURN_ERROR(config_error_);
+  for (size_t i = 0; i < count; ++i) {
+    TK_CHECK_OR_RETURN_ERROR(
+        tokens[i] < config_.vocab_size,
+        OutOfRange,
+        "token %" PRIu64 " is not below the vocab size %" PRIu64,
+        tokens[i],
+        config_.vocab_size);
+  }
+  const bool hold_all = config_.coding == TokenStreamCoding::Ranked &&
+      config_.ranking.empty();
+  for (size_t i = 0; i < count; ++i) {
+    pending_.push_back(static_cast<uint32_t>(tokens[i]));
+    if (!hold_all && pending_.size() == config_.block_size) {
+      flush_block(pending_.data(), pending_.size());
+      pending_.clear();
+    }
+  }
+  num_tokens_ += count;
+  return Error::Ok;
+}
+
+Result<std::string> TokenStreamWriter::finish() {
+  TK_CHECK_OK_OR_RETURN_ERROR(config_error_);
+  std::vector<uint32_t> ranking = config_.ranking;
+  if (config_.coding == TokenStreamCoding::Ranked && ranking.empty()) {
+    // Rank the held tokens by frequency, ties by id
+    std::vector<uint64_t> counts(config_.vocab_size, 0);
+    for (const uint32_t token : pending_) {
+      ++counts[token];
+    }
+    for (uint64_t id = 0; id < config_.vocab_size; ++id) {
+      if (counts[id] > 0) {
+        ranking.push_back(static_cast<uint32_t>(id));
+      }
+    }
+    std::stable_sort(
+        ranking.begin(), ranking.end(), [&counts](uint32_t a, uint32_t b) {
+          return counts[a] > counts[b];
+        });
+    build_ranks(ranking);
+  }
+  for (size_t i = 0; i < pending_.size(); i += config_.block_size) {
+    flush_block(
+        pending_.data() + i,
+        std::min<size_t>(config_.block_size, pending_.size() - i));
+  }
+
+  std::string out(kMagic, sizeof(kMagic));
+  put_u32(out, static_cast<uint32_t>(config_.coding));
+  put_u32(out, config_.block_size);
+  put_u64(out, config_.vocab_size);
+  put_u64(out, num_tokens_);
+  put_u64(out, ranking.size());
+  for (const uint32_t id : ranking) {
+    put_u32(out, id);
+  }
+  const uint64_t data_start = out.size();
+  out += blocks_;
+  for (const uint64_t offset : block_offsets_) {
+    put_u64(out, data_start + offset);
+  }
+
+  if (config_.ranking.empty()) {
+    ranks_.clear();
+  }
+  pending_.clear();
+  blocks_.clear();
+  block_offsets_.clear();
+  num_tokens_ = 0;
+  return out;
+}
+
+Error TokenStreamWriter::save(const std::string& path) {
+  auto data = finish();
+  if (!data.ok()) {
+    return data.error();
+  }
+  std::ofstream file(path, std::ios::binary);
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), Internal, "failed to open %s", path.c_str());
+  file.write(data->data(), data->size());
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), Internal, "failed to write %s", path.c_str());
+  return Error::Ok;
+}
+
+// TokenStreamReader ///////////////////////////////////////////////////////////
+
+Error TokenStreamReader::load(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), LoadFailure, "failed to open %s", path.c_str());
+  std::string data(
+      (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  return load_from_memory(std::move(data));
+}
+
+Error TokenStreamReader::load_from_memory(std::string data) {
+  loaded_ = false;
+  data_ = std::move(data);
+  const char* p = data_.data();
+  const size_t size = data_.size();
+  TK_CHECK_OR_RETURN_ERROR(
+      size >= kHeaderSize && std::memcmp(p, kMagic, sizeof(kMagic)) == 0,
+      ParseFailure,
+      "not a token stream");
+  const uint32_t coding = get_u32(p + 8);
+  block_size_ = get_u32(p + 12);
+  vocab_size_ = get_u64(p + 16);
+  num_tokens_ = get_u64(p + 24);
+  const uint64_t ranking_size = get_u64(p + 32);
+  TK_CHECK_OR_RETURN_ERROR(
+      coding <= static_cast<uint32_t>(TokenStreamCoding::Ranked) &&
+          block_size_ > 0 && block_size_ <= kMaxBlockSize &&
+          block_size_ % kGroupSize == 0 &&
+          vocab_size_ > 0 && vocab_size_ <= (uint64_t(1) << 32) &&
+          ranking_size <= vocab_size_ &&
+          ranking_size <= (size - kHeaderSize) / 4,
+      ParseFailure,
+      "malformed token stream header");
+  coding_ = static_cast<TokenStreamCoding>(coding);
+  max_width_ = max_width(coding_, vocab_size_);
+
+  ids_.clear();
+  unlisted_below_.clear();
+  if (coding_ == TokenStreamCoding::Ranked) {
+    ids_.resize(ranking_size);
+    for (uint64_t i = 0; i < ranking_size; ++i) {
+      ids_[i] = get_u32(p + kHeaderSize + 4 * i);
+    }
+    std::vector<uint32_t> listed(ids_);
+    std::sort(listed.begin(), listed.end());
+    TK_CHECK_OR_RETURN_ERROR(
+        (listed.empty() || listed.back() < vocab_size_) &&
+            std::adjacent_find(listed.begin(), listed.end()) == listed.end(),
+        ParseFailure,
+        "malformed token stream ranking");
+    unlisted_below_.resize(listed.size());
+    for (size_t j = 0; j < listed.size(); ++j) {
+      unlisted_below_[j] = listed[j] - static_cast<uint32_t>(j);
+    }
+  }
+
+  // The index of block offsets ends the stream
+  const uint64_t data_start = kHeaderSize + 4 * ranking_size;
+  const uint64_t num_blocks = (num_tokens_ + block_size_ - 1) / block_size_;
+  TK_CHECK_OR_RETURN_ERROR(
+      num_blocks <= (size - data_start) / 8,
+      ParseFailure,
+      "truncated token stream index");
+  const uint64_t index_start = size - 8 * num_blocks;
+  const bool delta = coding_ == TokenStreamCoding::Delta;
+  block_offsets_.clear();
+  block_offsets_.reserve(num_blocks + 1);
+  for (uint64_t b = 0; b < num_blocks; ++b) {
+    block_offsets_.push_back(get_u64(p + index_start + 8 * b));
+  }
+  block_offsets_.push_back(index_start);
+  TK_CHECK_OR_RETURN_ERROR(
+      block_offsets_[0] == data_start,
+      ParseFailure,
+      "malformed token stream blocks");
+  // Blocks must be contiguous, exactly as long as their header implies, and
+  // end before the index, which is checked before any exception is read
+  for (uint64_t b = 0; b < num_blocks; ++b) {
+    const uint64_t offset = block_offsets_[b];
+    const uint64_t count =
+        std::min<uint64_t>(block_size_, num_tokens_ - b * block_size_);
+    TK_CHECK_OR_RETURN_ERROR(
+        offset <= index_start &&
+            index_start - offset >= block_header_bytes(delta),
+        ParseFailure,
+        "malformed token stream block %" PRIu64,
+        b);
+    const Block block = parse_block(p + offset, delta, count);
+    bool ok = block.width <= max_width_ && block.num_exceptions <= count &&
+        (block.num_exceptions == 0
+             ? block.exception_width == 0
+             : block.exception_width > 0 &&
+                 block.width + block.exception_width <= max_width_) &&
+        block_bytes(block, delta, count) <= index_start - offset &&
+        block_offsets_[b + 1] == offset + block_bytes(block, delta, count);
+    for (uint32_t e = 0; ok && e < block.num_exceptions; ++e) {
+      const uint32_t index = exception_index(block, e);
+      ok = index < count && (e == 0 || index > exception_index(block, e - 1));
+    }
+    TK_CHECK_OR_RETURN_ERROR(
+        ok, ParseFailure, "malformed token stream block %" PRIu64, b);
+  }
+  loaded_ = true;
+  return Error::Ok;
+}
+
+template <typename T>
+Error TokenStreamReader::read_impl(uint64_t begin, size_t count, T* out)
+    const {
+  if (!loaded_) {
+    return Error::Uninitialized;
+  }
+  TK_CHECK_OR_RETURN_ERROR(
+      begin <= num_tokens_ && count <= num_tokens_ - begin,
+      OutOfRange,
+      "tokens [%" PRIu64 ", %" PRIu64 ") are past the end of the stream",
+      begin,
+      begin + count);
+
+  const bool delta = coding_ == TokenStreamCoding::Delta;
+  uint32_t values[kGroupSize];
+  const uint64_t end = begin + count;
+  uint64_t position = begin;
+  while (position < end) {
+    const uint64_t block_index = position / block_size_;
+    const uint64_t block_start = block_index * block_size_;
+    const uint64_t block_count =
+        std::min<uint64_t>(block_size_, num_tokens_ - block_start);
+    const uint64_t block_end = std::min(end, block_start + block_count);
+    const Block block = parse_block(
+        data_.data() + block_offsets_[block_index], delta, block_count);
+    const size_t group_bytes = packed_group_bytes(block.width);
+
+    // Delta needs the whole prefix of the block, the others only the groups
+    // in range
+    uint64_t group = delta ? 0 : (position - block_start) / kGroupSize;
+    const char* packed = block.packed + group * group_bytes;
+    // First exception of the group
+    uint32_t e = 0;
+    for (uint32_t n = block.num_exceptions; n > 0;) {
+      const uint32_t half = n / 2;
+      if (exception_index(block, e + half) < group * kGroupSize) {
+        e += half + 1;
+        n -= half + 1;
+      } else {
+        n = half;
+      }
+    }
+    uint32_t prev = block.first;
+
+    for (; block_start + group * kGroupSize < block_end; ++group) {
+      const uint64_t group_start = block_start + group * kGroupSize;
+      const uint64_t from = std::max(position, group_start);
+      const uint64_t to =
+          std::min<uint64_t>(block_end, group_start + kGroupSize);
+      T* dst = out + (from - begin);
+
+      uint32_t* unpacked = values;
+      bool direct = false;
+      if constexpr (std::is_same_v<T, uint32_t>) {
+        // Whole groups of plain ids unpack straight into the output
+        direct = coding_ == TokenStreamCoding::Plain && from == group_start &&
+            to == group_start + kGroupSize;
+        if (direct) {
+          unpacked = dst;
+        }
+      }
+      unpack_group(packed, block.width, unpacked);
+      packed += group_bytes;
+      for (; e < block.num_exceptions; ++e) {
+        const uint32_t index =
+            exception_index(block, e) - group * kGroupSize;
+        if (index >= kGroupSize) {
+          break;
+        }
+        unpacked[index] |= exception_value(block, e) << block.width;
+      }
+      if (direct) {
+        uint32_t max_id = 0;
+        for (size_t i = 0; i < kGroupSize; ++i) {
+          max_id = std::max(max_id, unpacked[i]);
+        }
+        TK_CHECK_OR_RETURN_ERROR(
+            max_id < vocab_size_,
+            ParseFailure,
+            "token id %" PRIu32 " is out of range",
+            max_id);
+        continue;
+      }
+
+      switch (coding_) {
+        case TokenStreamCoding::Plain:
+          for (uint64_t i = from; i < to; ++i) {
+            const uint32_t id = values[i - group_start];
+            TK_CHECK_OR_RETURN_ERROR(
+                id < vocab_size_,
+                ParseFailure,
+                "token id %" PRIu32 " is out of range",
+                id);
+            *dst++ = static_cast<T>(id);
+          }
+          break;
+        case TokenStreamCoding::Delta:
+          for (uint64_t i = group_start; i < to; ++i) {
+            prev += unzigzag(values[i - group_start]);
+            if (i >= from) {
+              TK_CHECK_OR_RETURN_ERROR(
+                  prev < vocab_size_,
+                  ParseFailure,
+                  "token id %" PRIu32 " is out of range",
+                  prev);
+              *dst++ = static_cast<T>(prev);
+            }
+          }
+          break;
+        case TokenStreamCoding::Ranked:
+          for (uint64_t i = from; i < to; ++i) {
+            const uint32_t rank = values[i - group_start];
+            TK_CHECK_OR_RETURN_ERROR(
+                rank < vocab_size_,
+                ParseFailure,
+                "token rank %" PRIu32 " is out of range",
+                rank);
+            *dst++ = static_cast<T>(
+                rank < ids_.size() ? ids_[rank] : unlisted_id(rank));
+          }
+          break;
+      }
+    }
+    position = block_end;
+  }
+  return Error::Ok;
+}
+
+uint32_t TokenStreamReader::unlisted_id(uint32_t rank) const {
+  // The k-th unlisted id is k plus the number of listed ids below it, which
+  // are those with fewer than k + 1 unlisted ids below them
+  const uint32_t k = rank - static_cast<uint32_t>(ids_.size());
+  const size_t listed_below =
+      std::upper_bound(unlisted_below_.begin(), unlisted_below_.end(), k) -
+      unlisted_below_.begin();
+  return k + static_cast<uint32_t>(listed_below);
+}
+
+Error TokenStreamReader::read(uint64_t begin, size_t count, uint32_t* out)
+    const {
+  return read_impl(begin, count, out);
+}
+
+Error TokenStreamReader::read(uint64_t begin, size_t count, int32_t* out)
+    const {
+  return read_impl(begin, count, out);
+}
+
+Error TokenStreamReader::read(uint64_t begin, size_t count, uint64_t* out)
+    const {
+  return read_impl(begin, count, out);
+}
+
+Error TokenStreamReader::read(uint64_t begin, size_t count, int64_t* out)
+    const {
+  return read_impl(begin, count, out);
+}
+
+Result<std::vector<uint64_t>> TokenStreamReader::read_all() const {
+  std::vector<uint64_t> tokens(num_tokens_);
+  TK_CHECK_OK_OR_RETURN_ERROR(read(0, tokens.size(), tokens.data()));
+  return tokens;
+}
+
+} // namespace tokenizers
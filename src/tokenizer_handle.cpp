@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/tokenizer_handle.h>
+
+// Standard
+#include <thread>
+#include <utility>
+
+namespace tokenizers {
+
+// Guard ///////////////////////////////////////////////////////////////////////
+
+TokenizerHandle::Guard::Guard(Guard&& other) noexcept
+    : counter_(other.counter_), tokenizer_(other.tokenizer_) {
+  other.counter_ = nullptr;
+  other.tokenizer_ = nullptr;
+}
+
+TokenizerHandle::Guard::~Guard() {
+  if (counter_) {
+    counter_->fetch_sub(1, std::memory_order_release);
+  }
+}
+
+// TokenizerHandle /////////////////////////////////////////////////////////////
+
+TokenizerHandle::TokenizerHandle(Factory factory)
+    : factory_(std::move(factory)) {}
+
+TokenizerHandle::TokenizerHandle(
+    std::unique_ptr<Tokenizer> tokenizer,
+    Factory factory)
+    : factory_(std::move(factory)) {
+  if (tokenizer) {
+    current_.store(tokenizer.release(), std::memory_order_release);
+    generation_.store(1, std::memory_order_release);
+  }
+}
+
+TokenizerHandle::~TokenizerHandle() {
+  delete current_.load(std::memory_order_acquire);
+}
+
+size_t TokenizerHandle::reader_slot_index() {
+  // Threads are spread round-robin over the slots so that concurrent readers
+  // rarely share a cache line.
+  static std::atomic<size_t> next_index{0};
+  thread_local const size_t index =
+      next_index.fetch_add(1, std::memory_order_relaxed) % kReaderSlots;
+  return index;
+}
+
+TokenizerHandle::Guard TokenizerHandle::acquire() const {
+  auto& slot = slots_[reader_slot_index()];
+  while (true) {
+    const auto epoch = epoch_.load();
+    auto& counter = slot.active[epoch & 1];
+    counter.fetch_add(1);
+    // If the epoch moved between reading it and announcing ourselves, a
+    // publisher may already have scanned this parity. Retry on the new one.
+    if (epoch_.load() == epoch) {
+      return Guard(&counter, current_.load());
+    }
+    counter.fetch_sub(1, std::memory_order_release);
+  }
+}
+
+void TokenizerHandle::wait_for_readers(size_t parity) const {
+  for (const auto& slot : slots_) {
+    while (slot.active[parity].load(std::memory_order_acquire) != 0) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+Error TokenizerHandle::publish(std::unique_ptr<Tokenizer> tokenizer) {
+  TK_CHECK_OR_RETURN_ERROR(
+      tokenizer && tokenizer->is_loaded(),
+      Uninitialized,
+      "Only loaded tokenizers can be published");
+
+  std::lock_guard<std::mutex> lock(publish_mutex_);
+  Tokenizer* previous = current_.exchange(tokenizer.release());
+  const auto epoch = epoch_.fetch_add(1);
+  generation_.fetch_add(1, std::memory_order_release);
+
+  // Readers that pinned the previous model did so under the old parity.
+  wait_for_readers(epoch & 1);
+  delete previous;
+  return Error::Ok;
+}
+
+Error TokenizerHandle::load(const std::string& tokenizer_path) {
+  TK_CHECK_OR_RETURN_ERROR(
+      factory_, Internal, "TokenizerHandle has no factory to load with");
+  auto tokenizer = factory_();
+  TK_CHECK_OR_RETURN_ERROR(
+      tokenizer, Internal, "TokenizerHandle factory returned null");
+  TK_CHECK_OK_OR_RETURN_ERROR(tokenizer->load(tokenizer_path));
+  return publish(std::move(tokenizer));
+}
+
+Result<std::vector<uint64_t>> TokenizerHandle::encode(
+    const std::string& input,
+    int8_t bos,
+    int8_t eos) const {
+  const auto guard = acquire();
+  if (!guard) {
+    return Error::Uninitialized;
+  }
+  return guard->encode(input, bos, eos);
+}
+
+Result<std::string> TokenizerHandle::decode(uint64_t prev_token, uint64_t token)
+    const {
+  const auto guard = acquire();
+  if (!guard) {
+    return Error::Uninitialized;
+  }
+  return guard->decode(prev_token, token);
+}
+
+bool TokenizerHandle::is_loaded() const {
+  const auto guard = acquire();
+  return guard && guard->is_loaded();
+}
+
+} // namespace tokenizers
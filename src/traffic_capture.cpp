@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/traffic_capture.h>
+
+// Standard
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <random>
+
+// Local
+#include <pytorch/tokenizers/log.h>
+
+namespace tokenizers {
+
+namespace {
+
+constexpr char kMagic[8] = {'T', 'K', 'T', 'R', 'A', 'F', '0', '1'};
+constexpr uint8_t kRedactedFlag = 1;
+
+std::atomic<uint32_t> next_thread_index{0};
+
+uint32_t thread_index() {
+  thread_local const uint32_t index = next_thread_index.fetch_add(1);
+  return index;
+}
+
+uint64_t splitmix64(uint64_t& state) {
+  uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+// Shuffle the bytes [first, last] of the substitution among themselves
+void shuffle_range(uint8_t* substitution, int first, int last, uint64_t& key) {
+  for (int i = last; i > first; --i) {
+    const int j = first + static_cast<int>(splitmix64(key) % (i - first + 1));
+    std::swap(substitution[i], substitution[j]);
+  }
+}
+
+bool is_continuation(uint8_t byte) {
+  return (byte & 0xC0) == 0x80;
+}
+
+void put_varint(std::string& out, uint64_t value) {
+  while (value >= 0x80) {
+    out += static_cast<char>((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+  out += static_cast<char>(value);
+}
+
+class Reader {
+ public:
+  Reader(const char* data, size_t size) : data_(data), end_(data + size) {}
+
+  bool varint(uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (data_ == end_) {
+        return false;
+      }
+      const auto byte = static_cast<uint8_t>(*data_++);
+      value |= uint64_t(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool byte(uint8_t& value) {
+    if (data_ == end_) {
+      return false;
+    }
+    value = static_cast<uint8_t>(*data_++);
+    return true;
+  }
+
+  bool bytes(std::string& value, uint64_t size) {
+    if (size > static_cast<uint64_t>(end_ - data_)) {
+      return false;
+    }
+    value.assign(data_, size);
+    data_ += size;
+    return true;
+  }
+
+  bool done() const {
+    return data_ == end_;
+  }
+
+ private:
+  const char* data_;
+  const char* end_;
+};
+
+} // namespace
+
+// TrafficRecorder /////////////////////////////////////////////////////////////
+
+Result<std::shared_ptr<TrafficRecorder>> TrafficRecorder::open(
+    const std::string& path,
+    TrafficCaptureOptions options) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), LoadFailure, "failed to open %s", path.c_str());
+  file.write(kMagic, sizeof(kMagic));
+  file.put(static_cast<char>(options.redact ? kRedactedFlag : 0));
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), Internal, "failed to write %s", path.c_str());
+  return std::shared_ptr<TrafficRecorder>(
+      new TrafficRecorder(std::move(file), std::move(options)));
+}
+
+TrafficRecorder::TrafficRecorder(
+    std::ofstream file,
+    TrafficCaptureOptions options)
+    : options_(std::move(options)),
+      origin_(Clock::now()),
+      file_(std::move(file)) {
+  if (options_.redaction_key == 0) {
+    options_.redaction_key =
+        (uint64_t(std::random_device{}()) << 32) | std::random_device{}();
+  }
+  std::iota(substitution_, substitution_ + 256, 0);
+  uint64_t key = options_.redaction_key;
+  shuffle_range(substitution_, '0', '9', key);
+  shuffle_range(substitution_, 'A', 'Z', key);
+  shuffle_range(substitution_, 'a', 'z', key);
+  shuffle_range(substitution_, 0x80, 0xBF, key);
+  for (size_t i = 0; i < options_.preserved.size(); ++i) {
+    const auto& preserved = options_.preserved[i];
+    if (!preserved.empty()) {
+      preserved_by_first_byte_[static_cast<uint8_t>(preserved[0])].push_back(
+          static_cast<uint32_t>(i));
+    }
+  }
+  buffer_.reserve(options_.buffer_size);
+}
+
+TrafficRecorder::~TrafficRecorder() {
+  (void)flush();
+}
+
+std::string TrafficRecorder::redact(std::string_view text) const {
+  std::string out(text);
+  if (!options_.redact) {
+    return out;
+  }
+  size_t pos = 0;
+  while (pos < out.size()) {
+    const auto byte = static_cast<uint8_t>(out[pos]);
+    size_t kept = 0;
+    for (const uint32_t index : preserved_by_first_byte_[byte]) {
+      const auto& preserved = options_.preserved[index];
+      if (text.substr(pos, preserved.size()) == preserved) {
+        kept = preserved.size();
+        break;
+      }
+    }
+    if (kept > 0) {
+      pos += kept;
+      continue;
+    }
+    // Only the last byte of a multi-byte character is substituted, as the
+    // other ones may be restricted to part of the continuation range
+    if (is_continuation(byte) &&
+        (pos + 1 == out.size() ||
+         !is_continuation(static_cast<uint8_t>(out[pos + 1])))) {
+      out[pos] = static_cast<char>(substitution_[byte]);
+    } else if (byte < 0x80) {
+      out[pos] = static_cast<char>(substitution_[byte]);
+    }
+    ++pos;
+  }
+  return out;
+}
+
+uint64_t TrafficRecorder::redact_token(uint64_t token, uint64_t vocab_size)
+    const {
+  if (!options_.redact || vocab_size == 0 || token >= vocab_size) {
+    return token;
+  }
+  // token * a + b modulo the vocabulary size, with a coprime to it
+  uint64_t a = (options_.redaction_key | 1) % vocab_size;
+  while (std::gcd(a, vocab_size) != 1) {
+    ++a;
+  }
+  const uint64_t b = (options_.redaction_key >> 32) % vocab_size;
+  return static_cast<uint64_t>(
+      (static_cast<unsigned __int128>(token) * a + b) % vocab_size);
+}
+
+void TrafficRecorder::append_header(
+    std::string& out,
+    TrafficCallKind kind,
+    Clock::time_point start,
+    Clock::time_point end) const {
+  using std::chrono::duration_cast;
+  out += static_cast<char>(kind);
+  put_varint(
+      out,
+      duration_cast<std::chrono::microseconds>(start - origin_).count());
+  put_varint(
+      out, duration_cast<std::chrono::nanoseconds>(end - start).count());
+  put_varint(out, thread_index());
+}
+
+void TrafficRecorder::record_encode(
+    std::string_view text,
+    int8_t bos,
+    int8_t eos,
+    Clock::time_point start,
+    Clock::time_point end) {
+  std::string record;
+  record.reserve(text.size() + 24);
+  append_header(record, TrafficCallKind::Encode, start, end);
+  record += static_cast<char>(bos);
+  record += static_cast<char>(eos);
+  put_varint(record, text.size());
+  if (options_.redact) {
+    record += redact(text);
+  } else {
+    record += text;
+  }
+  append(record);
+}
+
+void TrafficRecorder::record_decode(
+    uint64_t prev_token,
+    uint64_t token,
+    uint64_t vocab_size,
+    Clock::time_point start,
+    Clock::time_point end) {
+  std::string record;
+  append_header(record, TrafficCallKind::Decode, start, end);
+  put_varint(record, redact_token(prev_token, vocab_size));
+  put_varint(record, redact_token(token, vocab_size));
+  append(record);
+}
+
+void TrafficRecorder::append(const std::string& record) {
+  num_records_.fetch_add(1, std::memory_order_relaxed);
+  std::lock_guard<std::mutex> lock(mutex_);
+  buffer_ += record;
+  if (buffer_.size() >= options_.buffer_size) {
+    file_.write(buffer_.data(), buffer_.size());
+    buffer_.clear();
+    if (!file_.good() && error_ == Error::Ok) {
+      TK_LOG(Error, "failed to write the traffic log");
+      error_ = Error::Internal;
+    }
+  }
+}
+
+Error TrafficRecorder::flush() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  file_.write(buffer_.data(), buffer_.size());
+  buffer_.clear();
+  file_.flush();
+  if (!file_.good() && error_ == Error::Ok) {
+    error_ = Error::Internal;
+  }
+  return error_;
+}
+
+// CapturingTokenizer //////////////////////////////////////////////////////////
+
+CapturingTokenizer::CapturingTokenizer(
+    std::unique_ptr<Tokenizer> tokenizer,
+    std::shared_ptr<TrafficRecorder> recorder)
+    : tokenizer_(std::move(tokenizer)), recorder_(std::move(recorder)) {
+  vocab_size_ = tokenizer_->vocab_size();
+  bos_tok_ = tokenizer_->bos_tok();
+  eos_tok_ = tokenizer_->eos_tok();
+  initialized_ = tokenizer_->is_loaded();
+}
+
+Error CapturingTokenizer::load(const std::string& tokenizer_path) {
+  const Error error = tokenizer_->load(tokenizer_path);
+  vocab_size_ = tokenizer_->vocab_size();
+  bos_tok_ = tokenizer_->bos_tok();
+  eos_tok_ = tokenizer_->eos_tok();
+  initialized_ = tokenizer_->is_loaded();
+  return error;
+}
+
+Result<std::vector<uint64_t>> CapturingTokenizer::encode(
+    const std::string& input,
+    int8_t bos,
+    int8_t eos) const {
+  const auto start = TrafficRecorder::Clock::now();
+  auto result = tokenizer_->encode(input, bos, eos);
+  recorder_->record_encode(
+      input, bos, eos, start, TrafficRecorder::Clock::now());
+  return result;
+}
+
+Result<std::vector<uint64_t>> CapturingTokenizer::encode_view(
+    std::string_view input,
+    int8_t bos,
+    int8_t eos) const {
+  const auto start = TrafficRecorder::Clock::now();
+  auto result = tokenizer_->encode_view(input, bos, eos);
+  recorder_->record_encode(
+      input, bos, eos, start, TrafficRecorder::Clock::now());
+  return result;
+}
+
+Result<std::string> CapturingTokenizer::decode(
+    uint64_t prev_token,
+    uint64_t token) const {
+  const auto start = TrafficRecorder::Clock::now();
+  auto result = tokenizer_->decode(prev_token, token);
+  recorder_->record_decode(
+      prev_token,
+      token,
+      static_cast<uint64_t>(vocab_size_),
+      start,
+      TrafficRecorder::Clock::now());
+  return result;
+}
+
+bool CapturingTokenizer::is_loaded() const {
+  return tokenizer_->is_loaded();
+}
+
+std::vector<MemoryRegion> CapturingTokenizer::memory_regions() const {
+  return tokenizer_->memory_regions();
+}
+
+// TrafficLogReader ////////////////////////////////////////////////////////////
+
+Error TrafficLogReader::load(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  TK_CHECK_OR_RETURN_ERROR(
+      file.good(), LoadFailure, "failed to open %s", path.c_str());
+  const std::string data(
+      (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  TK_CHECK_OR_RETURN_ERROR(
+      data.size() > sizeof(kMagic) &&
+          std::memcmp(data.data(), kMagic, sizeof(kMagic)) == 0,
+      ParseFailure,
+      "%s is not a traffic log",
+      path.c_str());
+  const auto flags = static_cast<uint8_t>(data[sizeof(kMagic)]);
+  TK_CHECK_OR_RETURN_ERROR(
+      (flags & ~kRedactedFlag) == 0,
+      ParseFailure,
+      "unknown flags %u in %s",
+      static_cast<unsigned>(flags),
+      path.c_str());
+
+  std::vector<TrafficRecord> records;
+  Reader reader(
+      data.data() + sizeof(kMagic) + 1, data.size() - sizeof(kMagic) - 1);
+  bool truncated = false;
+  while (!reader.done()) {
+    TrafficRecord record;
+    uint8_t kind = 0;
+    uint64_t thread = 0;
+    bool ok = reader.byte(kind) && reader.varint(record.start_us) &&
+        reader.varint(record.duration_ns) && reader.varint(thread);
+    record.kind = static_cast<TrafficCallKind>(kind);
+    record.thread = static_cast<uint32_t>(thread);
+    if (ok && record.kind == TrafficCallKind::Encode) {
+      uint8_t bos = 0;
+      uint8_t eos = 0;
+      uint64_t size = 0;
+      ok = reader.byte(bos) && reader.byte(eos) && reader.varint(size) &&
+          reader.bytes(record.text, size);
+      record.bos = static_cast<int8_t>(bos);
+      record.eos = static_cast<int8_t>(eos);
+    } else if (ok && record.kind == TrafficCallKind::Decode) {
+      ok = reader.varint(record.prev_token) && reader.varint(record.token);
+    } else if (ok) {
+      TK_LOG(Error, "unknown call kind %u in %s", kind, path.c_str());
+      return Error::ParseFailure;
+    }
+    if (!ok) {
+      // Only the last record can be cut short
+      truncated = true;
+      break;
+    }
+    records.push_back(std::move(record));
+  }
+
+  records_ = std::move(records);
+  redacted_ = (flags & kRedactedFlag) != 0;
+  truncated_ = truncated;
+  return Error::Ok;
+}
+
+} // namespace tokenizers
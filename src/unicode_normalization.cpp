@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// Local
+#include <pytorch/tokenizers/simd_utils.h>
+#include <pytorch/tokenizers/unicode_normalization.h>
+
+// Standard
+#include <algorithm>
+#include <vector>
+
+namespace tokenizers {
+namespace unicode {
+
+namespace {
+
+// Hangul syllable composition constants
+// https://www.unicode.org/versions/Unicode15.0.0/ch03.pdf#G56669
+constexpr uint32_t kSBase = 0xAC00;
+constexpr uint32_t kLBase = 0x1100;
+constexpr uint32_t kVBase = 0x1161;
+constexpr uint32_t kTBase = 0x11A7;
+constexpr uint32_t kLCount = 19;
+constexpr uint32_t kVCount = 21;
+constexpr uint32_t kTCount = 28;
+constexpr uint32_t kNCount = kVCount * kTCount;
+constexpr uint32_t kSCount = kLCount * kNCount;
+
+// Invalid UTF-8 bytes travel through the code point buffers above the Unicode
+// range so they can be written back verbatim.
+constexpr uint32_t kRawByteBase = 0x110000;
+
+inline bool is_hangul_syllable(uint32_t cp) {
+  return cp >= kSBase && cp < kSBase + kSCount;
+}
+
+inline uint8_t combining_class(uint32_t cp) {
+  return cp < kRawByteBase ? lookup(cp).ccc : 0;
+}
+
+bool is_compat(NormalizationForm form) {
+  return form == NormalizationForm::NFKC || form == NormalizationForm::NFKD;
+}
+
+bool is_composed(NormalizationForm form) {
+  return form == NormalizationForm::NFC || form == NormalizationForm::NFKC;
+}
+
+uint8_t quick_check_mask(NormalizationForm form) {
+  switch (form) {
+    case NormalizationForm::NFC:
+      return kNFCNo | kNFCMaybe;
+    case NormalizationForm::NFD:
+      return kNFDNo;
+    case NormalizationForm::NFKC:
+      return kNFKCNo | kNFKCMaybe;
+    case NormalizationForm::NFKD:
+      return kNFKDNo;
+  }
+  return 0;
+}
+
+/**
+ * Run the normalization quick check over input. Returns input.size() if the
+ * whole input is known to be normalized. Otherwise returns the byte offset of
+ * the last starter before the first offending code point; everything before
+ * that offset is normalized and unaffected by what follows.
+ */
+size_t quick_check(std::string_view input, NormalizationForm form) {
+  const uint8_t mask = quick_check_mask(form);
+  const bool decomposed = !is_composed(form);
+  const char* data = input.data();
+  const size_t size = input.size();
+  size_t last_starter = 0;
+  uint8_t last_ccc = 0;
+  size_t i = 0;
+  while (i < size) {
+    const size_t ascii = detail::ascii_prefix_length(data + i, size - i);
+    if (ascii > 0) {
+      i += ascii;
+      last_starter = i - 1;
+      last_ccc = 0;
+      continue;
+    }
+    uint32_t cp;
+    const size_t len = decode_utf8(data + i, size - i, cp);
+    if (cp == kInvalidCodepoint) {
+      last_starter = i;
+      last_ccc = 0;
+      i += len;
+      continue;
+    }
+    if (is_hangul_syllable(cp)) {
+      if (decomposed) {
+        return last_starter;
+      }
+      last_starter = i;
+      last_ccc = 0;
+      i += len;
+      continue;
+    }
+    const auto& record = lookup(cp);
+    if ((record.ccc != 0 && last_ccc > record.ccc) || (record.flags & mask)) {
+      return last_starter;
+    }
+    if (record.ccc == 0) {
+      last_starter = i;
+    }
+    last_ccc = record.ccc;
+    i += len;
+  }
+  return size;
+}
+
+void decompose(uint32_t cp, bool compat, std::vector<uint32_t>& out) {
+  if (is_hangul_syllable(cp)) {
+    const uint32_t s = cp - kSBase;
+    out.push_back(kLBase + s / kNCount);
+    out.push_back(kVBase + (s % kNCount) / kTCount);
+    if (s % kTCount != 0) {
+      out.push_back(kTBase + s % kTCount);
+    }
+    return;
+  }
+  const auto& record = lookup(cp);
+  const uint8_t length = compat ? record.compat_length : record.canonical_length;
+  if (length == 0) {
+    out.push_back(cp);
+    return;
+  }
+  const uint32_t* begin =
+      data::kPool + (compat ? record.compat_offset : record.canonical_offset);
+  out.insert(out.end(), begin, begin + length);
+}
+
+// Stable sort every run of non-starters by combining class
+void canonical_order(std::vector<uint32_t>& cps) {
+  const size_t n = cps.size();
+  size_t i = 0;
+  while (i < n) {
+    if (combining_class(cps[i]) == 0) {
+      ++i;
+      continue;
+    }
+    size_t end = i;
+    while (end < n && combining_class(cps[end]) != 0) {
+      ++end;
+    }
+    if (end - i > 1) {
+      std::stable_sort(
+          cps.begin() + i, cps.begin() + end, [](uint32_t a, uint32_t b) {
+            return combining_class(a) < combining_class(b);
+          });
+    }
+    i = end;
+  }
+}
+
+uint32_t compose_pair(uint32_t first, uint32_t second) {
+  // Hangul L + V -> LV
+  if (first >= kLBase && first < kLBase + kLCount && second >= kVBase &&
+      second < kVBase + kVCount) {
+    return kSBase + ((first - kLBase) * kVCount + (second - kVBase)) * kTCount;
+  }
+  // Hangul LV + T -> LVT
+  if (is_hangul_syllable(first) && (first - kSBase) % kTCount == 0 &&
+      second > kTBase && second < kTBase + kTCount) {
+    return first + (second - kTBase);
+  }
+  const auto* begin = data::kCompositions;
+  const auto* end = data::kCompositions + data::kNumCompositions;
+  const auto* it = std::lower_bound(
+      begin, end, std::make_pair(first, second), [](const auto& a, auto key) {
+        return a.first < key.first ||
+            (a.first == key.first && a.second < key.second);
+      });
+  if (it != end && it->first == first && it->second == second) {
+    return it->composite;
+  }
+  return kInvalidCodepoint;
+}
+
+// Canonical composition algorithm
+// https://www.unicode.org/reports/tr15/#Canonical_Composition_Algorithm
+void compose(std::vector<uint32_t>& cps) {
+  if (cps.empty()) {
+    return;
+  }
+  size_t starter = 0;
+  // A leading non-starter can never be composed with
+  int last_ccc = combining_class(cps[0]) == 0 ? 0 : 256;
+  size_t write = 1;
+  for (size_t read = 1; read < cps.size(); ++read) {
+    const uint32_t cp = cps[read];
+    const int ccc = combining_class(cp);
+    // A character is blocked from the last starter if a character of the same
+    // or higher class sits between them. last_ccc == 0 means the starter is
+    // the previous character.
+    const uint32_t composite = (last_ccc < ccc || last_ccc == 0)
+        ? compose_pair(cps[starter], cp)
+        : kInvalidCodepoint;
+    if (composite != kInvalidCodepoint) {
+      cps[starter] = composite;
+      continue;
+    }
+    if (ccc == 0) {
+      starter = write;
+    }
+    last_ccc = ccc;
+    cps[write++] = cp;
+  }
+  cps.resize(write);
+}
+
+} // namespace
+
+// Transforms //////////////////////////////////////////////////////////////////
+
+bool normalize(
+    std::string_view input,
+    NormalizationForm form,
+    std::string& out) {
+  const size_t stable = quick_check(input, form);
+  if (stable == input.size()) {
+    return false;
+  }
+
+  const bool compat = is_compat(form);
+  std::vector<uint32_t> cps;
+  cps.reserve(input.size() - stable + 8);
+  const char* data = input.data();
+  for (size_t i = stable; i < input.size();) {
+    uint32_t cp;
+    const size_t len = decode_utf8(data + i, input.size() - i, cp);
+    if (cp == kInvalidCodepoint) {
+      cps.push_back(kRawByteBase + static_cast<unsigned char>(data[i]));
+    } else if (cp < 0x80) {
+      cps.push_back(cp);
+    } else {
+      decompose(cp, compat, cps);
+    }
+    i += len;
+  }
+  canonical_order(cps);
+  if (is_composed(form)) {
+    compose(cps);
+  }
+
+  out.assign(data, stable);
+  out.reserve(input.size() + cps.size());
+  for (const uint32_t cp : cps) {
+    if (cp >= kRawByteBase) {
+      out.push_back(static_cast<char>(cp - kRawByteBase));
+    } else {
+      append_utf8(cp, out);
+    }
+  }
+  // Code points flagged as "maybe" can turn out to be normalized already
+  return out != input;
+}
+
+bool to_lower(std::string_view input, std::string& out) {
+  const char* data = input.data();
+  const size_t size = input.size();
+
+  // Find the first code point that changes
+  size_t i = 0;
+  while (true) {
+    i += detail::find_ascii_upper_or_non_ascii(data + i, size - i);
+    if (i == size) {
+      return false;
+    }
+    if (static_cast<unsigned char>(data[i]) < 0x80) {
+      break;
+    }
+    uint32_t cp;
+    const size_t len = decode_utf8(data + i, size - i, cp);
+    if (cp != kInvalidCodepoint && lookup(cp).lower_length != 0) {
+      break;
+    }
+    i += len;
+  }
+
+  out.assign(data, i);
+  out.reserve(size + 8);
+  while (i < size) {
+    const size_t ascii = detail::ascii_prefix_length(data + i, size - i);
+    if (ascii > 0) {
+      const size_t offset = out.size();
+      out.resize(offset + ascii);
+      detail::ascii_to_lower(data + i, &out[offset], ascii);
+      i += ascii;
+      continue;
+    }
+    uint32_t cp;
+    const size_t len = decode_utf8(data + i, size - i, cp);
+    const CodepointRecord* record =
+        cp == kInvalidCodepoint ? nullptr : &lookup(cp);
+    if (record && record->lower_length != 0) {
+      const uint32_t* lower = data::kPool + record->lower_offset;
+      for (size_t j = 0; j < record->lower_length; ++j) {
+        append_utf8(lower[j], out);
+      }
+    } else {
+      out.append(data + i, len);
+    }
+    i += len;
+  }
+  return true;
+}
+
+bool remove_nonspacing_marks(std::string_view input, std::string& out) {
+  const char* data = input.data();
+  const size_t size = input.size();
+  bool changed = false;
+  size_t copied = 0;
+  size_t i = 0;
+  while (i < size) {
+    i += detail::ascii_prefix_length(data + i, size - i);
+    if (i == size) {
+      break;
+    }
+    uint32_t cp;
+    const size_t len = decode_utf8(data + i, size - i, cp);
+    if (cp != kInvalidCodepoint && (lookup(cp).flags & kNonspacingMark)) {
+      if (!changed) {
+        out.clear();
+        out.reserve(size);
+        changed = true;
+      }
+      out.append(data + copied, i - copied);
+      copied = i + len;
+    }
+    i += len;
+  }
+  if (changed) {
+    out.append(data + copied, size - copied);
+  }
+  return changed;
+}
+
+bool is_whitespace(uint32_t cp) {
+  switch (cp) {
+    case 0x0009:
+    case 0x000A:
+    case 0x000B:
+    case 0x000C:
+    case 0x000D:
+    case 0x0020:
+    case 0x0085:
+    case 0x00A0:
+    case 0x1680:
+    case 0x2028:
+    case 0x2029:
+    case 0x202F:
+    case 0x205F:
+    case 0x3000:
+      return true;
+    default:
+      return cp >= 0x2000 && cp <= 0x200A;
+  }
+}
+
+} // namespace unicode
+} // namespace tokenizers
@@ -0,0 +1,9043 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// @generated by scripts/generate_unicode_normalization_data.py from Unicode
+// 14.0.0. Do not edit by hand.
+
+#include <pytorch/tokenizers/unicode_normalization.h>
+
+namespace tokenizers {
+namespace unicode {
+namespace data {
+
+const uint32_t kBlockShift = 7;
+
+const uint16_t kStage1[8704] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 40, 40, 40, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 40, 67, 68, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 89, 40, 40, 90, 91, 92, 93,
+    94, 95, 96, 97, 98, 99, 100, 101, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 102,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    118, 119, 120, 121, 103, 122, 123, 124, 125, 126, 127, 128, 40, 40, 129, 130,
+    131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 103, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 103, 153, 154, 103, 155, 156, 157, 158, 103,
+    159, 160, 161, 162, 163, 164, 103, 103, 165, 166, 167, 168, 103, 169, 103, 170,
+    40, 40, 40, 40, 40, 40, 40, 171, 172, 40, 173, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 174,
+    40, 40, 40, 40, 40, 40, 40, 40, 175, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 40, 40, 40, 40, 176, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    40, 40, 40, 40, 177, 178, 179, 180, 103, 103, 103, 103, 181, 182, 183, 184,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 185,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 186, 187, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 188,
+    40, 40, 189, 40, 40, 190, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 191, 192, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 193, 173,
+    40, 194, 195, 196, 197, 198, 199, 103, 200, 201, 202, 203, 204, 205, 206, 207,
+    40, 40, 40, 40, 208, 209, 103, 103, 103, 103, 103, 103, 103, 103, 210, 103,
+    211, 103, 212, 103, 103, 213, 103, 103, 103, 103, 103, 103, 103, 103, 103, 214,
+    40, 215, 216, 103, 103, 103, 103, 103, 217, 218, 219, 103, 220, 221, 103, 103,
+    222, 223, 224, 225, 226, 103, 40, 40, 40, 40, 40, 40, 40, 227, 228, 229,
+    230, 231, 40, 40, 232, 233, 40, 234, 103, 103, 103, 103, 103, 103, 103, 103,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 235, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 236, 40,
+    237, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 238, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 239, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    240, 241, 242, 243, 244, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 245, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 246, 247, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+};
+
+const uint16_t kStage2[31744] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    28, 1, 1, 1, 1, 1, 1, 1, 29, 1, 30, 1, 1, 0, 1, 31,
+    1, 1, 32, 33, 34, 35, 1, 1, 36, 37, 38, 1, 39, 40, 41, 1,
+    42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+    58, 59, 60, 61, 62, 63, 64, 1, 65, 66, 67, 68, 69, 70, 71, 1,
+    72, 73, 74, 75, 76, 77, 1, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+    1, 87, 88, 89, 90, 91, 92, 1, 1, 93, 94, 95, 96, 97, 1, 98,
+    99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 1, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 135, 136, 1, 137, 138, 139, 140, 141, 142, 143, 144,
+    145, 1, 146, 147, 148, 149, 150, 151, 1, 152, 153, 154, 155, 156, 157, 158,
+    159, 160, 1, 161, 162, 163, 164, 165, 166, 167, 168, 1, 169, 170, 171, 172,
+    173, 174, 175, 1, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
+    188, 189, 190, 191, 192, 193, 194, 1, 195, 196, 197, 198, 199, 200, 201, 202,
+    203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+    1, 219, 220, 1, 221, 1, 222, 223, 1, 224, 225, 226, 1, 1, 227, 228,
+    229, 230, 1, 231, 232, 1, 233, 234, 235, 1, 1, 1, 236, 237, 1, 238,
+    239, 240, 241, 1, 242, 1, 243, 244, 1, 245, 1, 1, 246, 1, 247, 248,
+    249, 250, 251, 252, 1, 253, 1, 254, 255, 1, 1, 1, 256, 1, 1, 1,
+    1, 1, 1, 1, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268,
+    269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 1, 282, 283,
+    284, 285, 286, 287, 288, 1, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298,
+    299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314,
+    315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330,
+    331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 1, 344, 345,
+    346, 1, 347, 1, 348, 1, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358,
+    359, 360, 361, 362, 1, 1, 1, 1, 1, 1, 363, 364, 1, 365, 366, 1,
+    1, 367, 1, 368, 369, 370, 371, 1, 372, 1, 373, 1, 374, 1, 375, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    376, 377, 378, 379, 380, 381, 382, 383, 384, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 385, 386, 387, 388, 389, 390, 1, 1,
+    391, 392, 218, 393, 394, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    395, 395, 395, 395, 395, 396, 395, 395, 395, 395, 395, 395, 395, 396, 396, 395,
+    396, 395, 396, 395, 395, 397, 398, 398, 398, 398, 397, 399, 398, 398, 398, 398,
+    398, 400, 400, 401, 401, 401, 401, 402, 402, 398, 398, 398, 398, 401, 401, 398,
+    401, 401, 398, 398, 403, 403, 403, 403, 404, 398, 398, 398, 398, 396, 396, 396,
+    405, 406, 395, 407, 408, 409, 396, 398, 398, 398, 396, 396, 396, 398, 398, 410,
+    396, 396, 396, 398, 398, 398, 398, 396, 397, 398, 398, 396, 411, 412, 412, 411,
+    412, 412, 411, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+    413, 1, 414, 1, 415, 1, 416, 1, 0, 0, 417, 1, 1, 1, 418, 419,
+    0, 0, 0, 0, 34, 420, 421, 422, 423, 424, 425, 0, 426, 0, 427, 428,
+    429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
+    445, 446, 0, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459,
+    460, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 461, 462, 463, 464, 465, 466,
+    467, 468, 469, 470, 471, 472, 473, 1, 474, 1, 475, 1, 476, 1, 477, 1,
+    478, 1, 479, 1, 480, 1, 481, 1, 482, 1, 483, 1, 484, 1, 485, 1,
+    486, 487, 488, 1, 489, 490, 1, 491, 1, 492, 493, 1, 1, 494, 495, 496,
+    497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512,
+    513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528,
+    529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 545, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    546, 547, 1, 548, 1, 1, 1, 549, 1, 1, 1, 1, 550, 551, 552, 1,
+    553, 1, 554, 1, 555, 1, 556, 1, 557, 1, 558, 1, 559, 1, 560, 1,
+    561, 1, 562, 1, 563, 1, 564, 565, 566, 1, 567, 1, 568, 1, 569, 1,
+    570, 1, 1, 396, 396, 396, 396, 396, 1, 1, 571, 1, 572, 1, 573, 1,
+    574, 1, 575, 1, 576, 1, 577, 1, 578, 1, 579, 1, 580, 1, 581, 1,
+    582, 1, 583, 1, 584, 1, 585, 1, 586, 1, 587, 1, 588, 1, 589, 1,
+    590, 1, 591, 1, 592, 1, 593, 1, 594, 1, 595, 1, 596, 1, 597, 1,
+    598, 599, 600, 601, 1, 602, 1, 603, 1, 604, 1, 605, 1, 606, 1, 1,
+    607, 608, 609, 610, 611, 1, 612, 613, 614, 1, 615, 616, 617, 618, 619, 620,
+    621, 1, 622, 623, 624, 625, 626, 627, 628, 1, 629, 630, 631, 632, 633, 634,
+    635, 636, 637, 638, 639, 640, 641, 1, 642, 643, 644, 1, 645, 1, 646, 1,
+    647, 1, 648, 1, 649, 1, 650, 1, 651, 1, 652, 1, 653, 1, 654, 1,
+    655, 1, 656, 1, 657, 1, 658, 1, 659, 1, 660, 1, 661, 1, 662, 1,
+    663, 1, 664, 1, 665, 1, 666, 1, 667, 1, 668, 1, 669, 1, 670, 1,
+    0, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685,
+    686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701,
+    702, 703, 704, 705, 706, 707, 708, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 709, 1, 1, 1, 0, 0, 1, 1, 1,
+    0, 398, 396, 396, 396, 396, 398, 396, 396, 396, 710, 398, 396, 396, 396, 396,
+    396, 396, 398, 398, 398, 398, 398, 398, 396, 396, 398, 396, 396, 710, 711, 396,
+    712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 721, 722, 723, 724, 1, 725,
+    1, 726, 727, 1, 396, 398, 1, 720, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    396, 396, 396, 396, 396, 396, 396, 396, 728, 729, 730, 1, 0, 1, 1, 1,
+    1, 1, 731, 732, 733, 734, 735, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 736, 737, 738, 728, 729,
+    730, 739, 740, 395, 395, 401, 398, 396, 396, 396, 396, 396, 398, 396, 396, 398,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    741, 1, 1, 1, 1, 742, 743, 744, 745, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    746, 1, 747, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 748, 1, 1, 396, 396, 396, 396, 396, 396, 396, 0, 1, 396,
+    396, 396, 396, 398, 396, 1, 1, 396, 396, 1, 398, 396, 396, 398, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    1, 749, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    396, 398, 396, 396, 398, 396, 396, 398, 398, 398, 396, 398, 398, 396, 398, 396,
+    396, 396, 398, 396, 398, 396, 398, 396, 398, 396, 396, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 396, 396, 396, 396, 396,
+    396, 396, 398, 396, 1, 1, 1, 1, 1, 1, 1, 0, 0, 398, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 396, 396, 396, 396, 1, 396, 396, 396, 396, 396,
+    396, 396, 396, 396, 1, 396, 396, 396, 1, 396, 396, 396, 396, 396, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 398, 398, 398, 0, 0, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 396, 398, 398, 398, 396, 396, 396, 396,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 396, 396, 396, 396, 396, 398,
+    398, 398, 398, 398, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+    396, 396, 0, 398, 396, 396, 398, 396, 396, 398, 396, 396, 396, 398, 398, 398,
+    736, 737, 738, 396, 396, 396, 398, 396, 396, 398, 398, 396, 396, 396, 396, 396,
+    410, 410, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 750, 1, 1, 1, 1, 1, 1,
+    1, 751, 1, 1, 752, 1, 1, 1, 1, 1, 410, 1, 753, 1, 1, 1,
+    1, 410, 410, 410, 410, 410, 410, 410, 410, 1, 1, 1, 1, 754, 1, 1,
+    1, 396, 398, 396, 396, 410, 410, 410, 755, 756, 757, 758, 759, 760, 761, 762,
+    1, 1, 410, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 410, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1,
+    1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 763, 1, 764, 1,
+    1, 410, 410, 410, 410, 0, 0, 1, 1, 0, 0, 765, 766, 754, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 764, 0, 0, 0, 0, 767, 768, 0, 769,
+    1, 1, 410, 410, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 396, 0,
+    0, 410, 410, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,
+    1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 770, 0, 1, 771, 0, 1, 1, 0, 0, 763, 0, 1, 1,
+    1, 410, 410, 0, 0, 0, 0, 410, 410, 0, 0, 410, 410, 754, 0, 0,
+    0, 410, 0, 0, 0, 0, 0, 0, 0, 772, 773, 774, 1, 0, 775, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    410, 410, 1, 1, 1, 410, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 410, 410, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 763, 1, 1, 1,
+    1, 410, 410, 410, 410, 410, 0, 410, 410, 1, 0, 1, 1, 754, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 410, 410, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 410, 410, 410, 410, 410, 410,
+    0, 410, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1,
+    1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 763, 1, 764, 410,
+    1, 410, 410, 410, 410, 0, 0, 1, 776, 0, 0, 777, 778, 754, 0, 0,
+    0, 0, 0, 0, 0, 410, 779, 764, 0, 0, 0, 0, 780, 781, 0, 1,
+    1, 1, 410, 410, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 410, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1,
+    1, 0, 1, 1, 782, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1,
+    0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 764, 1,
+    410, 1, 1, 0, 0, 0, 1, 1, 1, 0, 783, 784, 785, 754, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 764, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    410, 1, 1, 1, 410, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+    1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 763, 1, 410, 410,
+    410, 1, 1, 1, 1, 0, 410, 410, 786, 0, 410, 410, 410, 754, 0, 0,
+    0, 0, 0, 0, 0, 787, 788, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+    1, 1, 410, 410, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+    1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 763, 1, 1, 410,
+    789, 1, 764, 1, 1, 0, 410, 790, 791, 0, 792, 793, 410, 754, 0, 0,
+    0, 0, 0, 0, 0, 764, 764, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+    1, 1, 410, 410, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    410, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+    1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 754, 754, 1, 764, 1,
+    1, 410, 410, 410, 410, 0, 1, 1, 1, 0, 794, 795, 796, 754, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 764, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 410, 410, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 410, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 797, 0, 0, 0, 0, 764,
+    1, 1, 410, 410, 410, 0, 410, 0, 1, 1, 798, 1, 799, 800, 801, 764,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 410, 1, 802, 410, 410, 410, 410, 803, 803, 754, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 410, 804, 804, 804, 804, 410, 410, 410, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 410, 1, 805, 410, 410, 410, 410, 806, 806, 754, 410, 410, 1, 0, 0,
+    1, 1, 1, 1, 1, 0, 1, 0, 807, 807, 807, 807, 410, 410, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 808, 809, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 810, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 398, 398, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 398, 1, 398, 1, 811, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 812, 1, 1, 1, 1, 0, 1, 1, 1, 1, 813, 1, 1,
+    1, 1, 814, 1, 1, 1, 1, 815, 1, 1, 1, 1, 816, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 817, 1, 1, 1, 0, 0, 0,
+    0, 818, 819, 820, 821, 822, 823, 824, 825, 826, 819, 819, 819, 819, 410, 1,
+    819, 827, 396, 396, 754, 1, 396, 396, 1, 1, 1, 1, 1, 410, 410, 410,
+    410, 410, 410, 828, 410, 410, 410, 410, 0, 410, 410, 410, 410, 829, 410, 410,
+    410, 410, 830, 410, 410, 410, 410, 831, 410, 410, 410, 410, 832, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 833, 410, 410, 410, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 398, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 834, 1, 1, 1, 1, 1, 1, 410, 779, 410,
+    410, 1, 410, 410, 410, 410, 410, 763, 1, 754, 754, 1, 1, 410, 410, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 410, 410, 1, 1, 1, 1, 410, 410,
+    410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 410, 410, 410, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 410, 1, 1, 410, 410, 1, 1, 1, 1, 1, 1, 398, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 410, 1, 1,
+    835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850,
+    851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866,
+    867, 868, 869, 870, 871, 872, 0, 873, 0, 0, 0, 0, 0, 874, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 875, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764,
+    764, 764, 764, 764, 764, 764, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 764, 764, 764, 764, 764, 764, 764, 764,
+    764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764,
+    764, 764, 764, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 396, 396, 396,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891,
+    892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907,
+    908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923,
+    924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939,
+    940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955,
+    956, 957, 958, 959, 960, 961, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 410, 410, 754, 962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 410, 410, 962, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 410, 410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+    1, 0, 410, 410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 410, 410, 1, 410, 410, 410, 410, 410, 410, 410, 1, 1,
+    1, 1, 1, 1, 1, 1, 410, 1, 1, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 754, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 396, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 410, 410, 410, 0, 410,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 410, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 711, 1, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    410, 410, 410, 1, 1, 1, 1, 410, 410, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 410, 1, 1, 1, 1, 1, 1, 710, 396, 398, 0, 0, 0, 0,
+    1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 396, 398, 1, 1, 410, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 410, 1, 410, 410, 410, 410, 410, 410, 410, 0,
+    754, 1, 410, 1, 1, 410, 410, 410, 410, 410, 410, 410, 410, 1, 1, 1,
+    1, 1, 1, 410, 410, 396, 396, 396, 396, 396, 396, 396, 396, 0, 0, 398,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    396, 396, 396, 396, 396, 398, 398, 398, 398, 398, 398, 396, 396, 398, 1, 398,
+    398, 396, 396, 398, 398, 396, 396, 396, 396, 396, 398, 396, 396, 396, 396, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    410, 410, 410, 410, 1, 1, 963, 1, 964, 1, 965, 1, 966, 1, 967, 1,
+    1, 1, 968, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 763, 764, 410, 410, 410, 410, 410, 969, 410, 970, 1, 1,
+    971, 972, 410, 973, 962, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 396, 398, 396, 396, 396,
+    396, 396, 396, 396, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    410, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 410, 410, 410, 410, 1, 1, 410, 410, 962, 754, 410, 410, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 763, 1, 410, 410, 1, 1, 1, 410, 1, 410,
+    410, 410, 962, 962, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 410, 410, 410, 410,
+    410, 410, 410, 410, 1, 1, 410, 763, 0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989,
+    990, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005,
+    1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 0, 0, 1017, 1018, 1019,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    396, 396, 396, 1, 403, 398, 398, 398, 398, 398, 396, 396, 398, 398, 398, 398,
+    396, 1, 403, 403, 403, 403, 403, 403, 403, 1, 1, 1, 1, 398, 1, 1,
+    1, 1, 1, 1, 396, 1, 1, 1, 396, 396, 1, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1020, 1021, 1022, 1,
+    1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1, 1034, 1035, 1036, 1037,
+    1038, 1039, 1040, 30, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1, 1051,
+    1052, 1053, 38, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 467, 1064, 1065,
+    472, 1066, 1067, 379, 1059, 1062, 467, 1064, 487, 472, 1066, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1068, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1069, 1070, 1071, 1072, 1049,
+    1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
+    1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 468,
+    396, 396, 398, 396, 396, 396, 396, 396, 396, 396, 398, 396, 396, 412, 1104, 398,
+    400, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+    396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+    396, 396, 396, 396, 396, 396, 397, 711, 711, 398, 1105, 396, 411, 398, 396, 398,
+    1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121,
+    1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137,
+    1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153,
+    1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169,
+    1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185,
+    1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201,
+    1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217,
+    1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
+    1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249,
+    1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1, 1, 1262, 1,
+    1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278,
+    1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294,
+    1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310,
+    1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326,
+    1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342,
+    1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1, 1354, 1, 1355, 1,
+    1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371,
+    1372, 1373, 1374, 1375, 1376, 1377, 0, 0, 1378, 1379, 1380, 1381, 1382, 1383, 0, 0,
+    1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399,
+    1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415,
+    1416, 1417, 1418, 1419, 1420, 1421, 0, 0, 1422, 1423, 1424, 1425, 1426, 1427, 0, 0,
+    1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 0, 1436, 0, 1437, 0, 1438, 0, 1439,
+    1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455,
+    1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 0, 0,
+    1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485,
+    1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501,
+    1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517,
+    1518, 1519, 1520, 1521, 1522, 0, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1530,
+    1532, 1533, 1534, 1535, 1536, 0, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546,
+    1547, 1548, 1549, 1550, 0, 0, 1551, 1552, 1553, 1554, 1555, 1556, 0, 1557, 1558, 1559,
+    1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575,
+    0, 0, 1576, 1577, 1578, 0, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 0,
+    1588, 1589, 28, 28, 28, 28, 28, 28, 28, 28, 28, 0, 0, 0, 0, 0,
+    1, 1590, 1, 1, 1, 1, 1, 1591, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1592, 1593, 1594, 1, 1, 1, 0, 0, 0, 0, 0, 28,
+    1, 1, 1, 1595, 1596, 1, 1597, 1598, 1, 1, 1, 1, 1599, 1, 1600, 1,
+    1, 1, 1, 1, 1, 1, 1, 1601, 1602, 1603, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1604, 1, 1, 1, 1, 1, 1, 1, 28,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1605, 1067, 0, 0, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617,
+    1605, 37, 32, 33, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 0,
+    30, 1046, 38, 393, 1047, 376, 1051, 392, 1052, 1617, 1057, 218, 1058, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1618, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    396, 396, 403, 403, 396, 396, 396, 396, 403, 403, 403, 396, 396, 1, 1, 1,
+    1, 396, 1, 1, 1, 403, 403, 396, 398, 396, 403, 403, 398, 398, 398, 398,
+    396, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1619, 1620, 1621, 1622, 1, 1623, 1624, 1625, 1, 1626, 1050, 1027, 1027, 1027, 376, 1627,
+    1028, 1028, 1031, 392, 1, 1033, 1628, 1, 1, 1036, 1629, 1037, 1037, 1037, 1, 1,
+    1630, 1631, 1632, 1, 1633, 1, 1634, 1, 1633, 1, 1635, 1636, 1022, 1621, 1, 1046,
+    1024, 1637, 1638, 1032, 38, 1639, 1640, 1641, 1642, 1067, 1, 1643, 473, 1064, 1644, 1645,
+    1646, 1, 1, 1, 1, 1023, 1045, 1046, 1067, 378, 1, 1, 1, 1, 1, 1,
+    1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662,
+    1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678,
+    1067, 1679, 1680, 1681, 1062, 1682, 1683, 1684, 1685, 393, 1686, 1687, 392, 1070, 1045, 1052,
+    1, 1, 1, 1688, 1, 1, 1, 1, 1, 1689, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1690, 1691, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1692, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1693, 1694, 1695,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1696, 1, 1, 1, 1, 1697, 1, 1, 1698, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1699, 1, 1700, 1, 1, 1, 1, 1, 1701, 1702, 1, 1703,
+    1704, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1705, 1, 1, 1706, 1, 1, 1707, 1, 1708, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1709, 1, 1710, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1711, 1712, 1713,
+    1714, 1715, 1, 1, 1716, 1717, 1, 1, 1718, 1719, 1, 1, 1, 1, 1, 1,
+    1720, 1721, 1, 1, 1722, 1723, 1, 1, 1724, 1725, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1726, 1727, 1728, 1729,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1730, 1731, 1732, 1733, 1, 1, 1, 1, 1, 1, 1734, 1735, 1736, 1737, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1738, 1739, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 32, 33, 1606, 1607, 1608, 1609, 1610, 1611, 1740, 1741, 1742, 1743, 1744, 1745, 1746,
+    1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762,
+    1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778,
+    1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794,
+    1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810,
+    1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826,
+    1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842,
+    30, 1044, 1070, 1045, 1046, 1073, 1050, 376, 1067, 378, 1051, 392, 1052, 1617, 38, 1057,
+    1843, 379, 218, 1058, 1059, 1062, 383, 393, 384, 1100, 1605, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1844, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1845, 1846, 1847, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1848, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864,
+    1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880,
+    1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1897, 1, 1898, 1899, 1900, 1, 1, 1901, 1, 1902, 1, 1903, 1, 1904, 1905, 1906,
+    1907, 1, 1908, 1, 1, 1909, 1, 1, 1, 1, 1, 1, 378, 1910, 1911, 1912,
+    1913, 1, 1914, 1, 1915, 1, 1916, 1, 1917, 1, 1918, 1, 1919, 1, 1920, 1,
+    1921, 1, 1922, 1, 1923, 1, 1924, 1, 1925, 1, 1926, 1, 1927, 1, 1928, 1,
+    1929, 1, 1930, 1, 1931, 1, 1932, 1, 1933, 1, 1934, 1, 1935, 1, 1936, 1,
+    1937, 1, 1938, 1, 1939, 1, 1940, 1, 1941, 1, 1942, 1, 1943, 1, 1944, 1,
+    1945, 1, 1946, 1, 1947, 1, 1948, 1, 1949, 1, 1950, 1, 1951, 1, 1952, 1,
+    1953, 1, 1954, 1, 1955, 1, 1956, 1, 1957, 1, 1958, 1, 1959, 1, 1960, 1,
+    1961, 1, 1962, 1, 1, 1, 1, 1, 1, 1, 1, 1963, 1, 1964, 1, 396,
+    396, 396, 1965, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1966,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 754,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+    396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+    396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1967,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1968, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984,
+    1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000,
+    2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+    2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032,
+    2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048,
+    2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064,
+    2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080,
+    2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096,
+    2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112,
+    2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128,
+    2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144,
+    2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160,
+    2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176,
+    2177, 2178, 2179, 2180, 2181, 2182, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    28, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1105, 711, 397, 710, 2183, 2183,
+    1, 1, 1, 1, 1, 1, 2184, 1, 1992, 2185, 2186, 1, 1, 1, 1, 1,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2187, 1, 2188, 1,
+    2189, 1, 2190, 1, 2191, 1, 2192, 1, 2193, 1, 2194, 1, 2195, 1, 2196, 1,
+    2197, 1, 2198, 1, 1, 2199, 1, 2200, 1, 2201, 1, 1, 1, 1, 1, 1,
+    2202, 2203, 1, 2204, 2205, 1, 2206, 2207, 1, 2208, 2209, 1, 2210, 2211, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2212, 1, 1, 0, 0, 2213, 2213, 2214, 2215, 1, 2216, 2217,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2218, 1, 2219, 1,
+    2220, 1, 2221, 1, 2222, 1, 2223, 1, 2224, 1, 2225, 1, 2226, 1, 2227, 1,
+    2228, 1, 2229, 1, 1, 2230, 1, 2231, 1, 2232, 1, 1, 1, 1, 1, 1,
+    2233, 2234, 1, 2235, 2236, 1, 2237, 2238, 1, 2239, 2240, 1, 2241, 2242, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2243, 1, 1, 2244, 2245, 2246, 2247, 1, 1, 1, 2248, 2249,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264,
+    2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280,
+    2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296,
+    2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312,
+    2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328,
+    2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 0,
+    1, 1, 1969, 1975, 2344, 2345, 2346, 2347, 2348, 2349, 1973, 2350, 2351, 2352, 2353, 1977,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369,
+    2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384, 0,
+    2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400,
+    2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416,
+    2417, 2418, 2419, 2420, 2421, 2422, 2035, 2423, 1, 1, 1, 1, 1, 1, 1, 1,
+    2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439,
+    2250, 2253, 2256, 2258, 2266, 2267, 2270, 2272, 2273, 2275, 2276, 2277, 2278, 2279, 2440, 2441,
+    2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 1,
+    1969, 1975, 2344, 2345, 2457, 2458, 2459, 1980, 2460, 1992, 2042, 2054, 2053, 2043, 2135, 2000,
+    2040, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2006, 2471, 2472, 2473, 2474,
+    2475, 2476, 2477, 2478, 2346, 2347, 2348, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487,
+    2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503,
+    2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519,
+    2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535,
+    2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551,
+    2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567,
+    2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583,
+    2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599,
+    2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615,
+    2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631,
+    2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647,
+    2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663,
+    2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679,
+    2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 2694, 2695,
+    2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711,
+    2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727,
+    2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743,
+    2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759,
+    2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775,
+    2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791,
+    2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807,
+    2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2824, 1, 2825, 1, 2826, 1, 2827, 1, 2828, 1, 2829, 1, 2830, 1, 2831, 1,
+    2832, 1, 2833, 1, 2834, 1, 2835, 1, 2836, 1, 2837, 1, 2838, 1, 2839, 1,
+    2840, 1, 2841, 1, 2842, 1, 2843, 1, 2844, 1, 2845, 1, 2846, 1, 1, 396,
+    1, 1, 1, 1, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 1, 1,
+    2847, 1, 2848, 1, 2849, 1, 2850, 1, 2851, 1, 2852, 1, 2853, 1, 2854, 1,
+    2855, 1, 2856, 1, 2857, 1, 2858, 1, 2859, 1, 2860, 1, 2861, 2862, 396, 396,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    396, 396, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 2863, 1, 2864, 1, 2865, 1, 2866, 1, 2867, 1, 2868, 1, 2869, 1,
+    1, 1, 2870, 1, 2871, 1, 2872, 1, 2873, 1, 2874, 1, 2875, 1, 2876, 1,
+    2877, 1, 2878, 1, 2879, 1, 2880, 1, 2881, 1, 2882, 1, 2883, 1, 2884, 1,
+    2885, 1, 2886, 1, 2887, 1, 2888, 1, 2889, 1, 2890, 1, 2891, 1, 2892, 1,
+    2893, 1, 2894, 1, 2895, 1, 2896, 1, 2897, 1, 2898, 1, 2899, 1, 2900, 1,
+    2901, 1, 1, 1, 1, 1, 1, 1, 1, 2902, 1, 2903, 1, 2904, 2905, 1,
+    2906, 1, 2907, 1, 2908, 1, 2909, 1, 1, 1, 1, 2910, 1, 2911, 1, 1,
+    2912, 1, 2913, 1, 1, 1, 2914, 1, 2915, 1, 2916, 1, 2917, 1, 2918, 1,
+    2919, 1, 2920, 1, 2921, 1, 2922, 1, 2923, 1, 2924, 2925, 2926, 2927, 2928, 1,
+    2929, 2930, 2931, 2932, 2933, 1, 2934, 1, 2935, 1, 2936, 1, 2937, 1, 2938, 1,
+    2939, 1, 2940, 1, 2941, 2942, 2943, 2944, 1, 2945, 1, 0, 0, 0, 0, 0,
+    2946, 1, 0, 1, 0, 1, 2947, 1, 2948, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1621, 1637, 1629, 2949, 1, 1, 2950, 2951, 1, 1, 1, 1, 1, 1,
+    1, 1, 410, 1, 1, 1, 754, 1, 1, 1, 1, 410, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 410, 410, 1, 1, 1, 1, 1, 754, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 754, 410, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+    396, 396, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 410,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 410, 410, 410, 410, 410, 398, 398, 398, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 1, 962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    410, 410, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 763, 1, 1, 410, 410, 410, 410, 1, 1, 410, 410, 1, 1,
+    962, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 410, 410, 410, 410, 410, 410, 1,
+    1, 410, 410, 1, 1, 410, 410, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 410, 1, 1, 1, 1, 1, 1, 1, 1, 410, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 410, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    396, 1, 396, 396, 398, 1, 1, 396, 396, 1, 1, 1, 1, 1, 396, 396,
+    1, 396, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 410, 410, 1, 1,
+    1, 1, 1, 1, 1, 1, 754, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0,
+    0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2952, 2953, 2954, 2955,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2956, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 410, 1, 1, 410, 1, 1, 1, 1, 754, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971,
+    2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987,
+    2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003,
+    3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019,
+    3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035,
+    3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 2976, 3048, 3049, 3050,
+    3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066,
+    3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082,
+    3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098,
+    3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114,
+    3115, 3066, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3050, 3124, 3125, 3126, 3127, 3128,
+    3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 2976,
+    3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156, 3157, 3158, 3159,
+    3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 3168, 3169, 3170, 3052, 3171, 3172, 3173, 3174,
+    3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 3190,
+    3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205, 3206,
+    3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216, 3217, 3218, 3219, 3220, 1, 1,
+    3221, 1, 3222, 1, 1, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 1,
+    3233, 1, 3234, 1, 1, 3235, 3236, 1, 1, 1, 3237, 3238, 3239, 3240, 3241, 3242,
+    3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257, 3258,
+    3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274,
+    3275, 3276, 3277, 3278, 3279, 3280, 3281, 3105, 3282, 3283, 3284, 3285, 3286, 3287, 3287, 3288,
+    3289, 3290, 3291, 3292, 3293, 3294, 3295, 3235, 3296, 3297, 3298, 3299, 3300, 3301, 0, 0,
+    3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3249, 3310, 3311, 3312, 3221, 3313, 3314, 3315,
+    3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3258, 3325, 3259, 3326, 3327, 3328, 3329,
+    3330, 3222, 2997, 3331, 3332, 3333, 3067, 3154, 3334, 3335, 3266, 3336, 3267, 3337, 3338, 3339,
+    3224, 3340, 3341, 3342, 3343, 3344, 3225, 3345, 3346, 3347, 3348, 3349, 3350, 3281, 3351, 3352,
+    3105, 3353, 3285, 3354, 3355, 3356, 3357, 3358, 3290, 3359, 3234, 3360, 3291, 3048, 3361, 3292,
+    3362, 3294, 3363, 3364, 3365, 3366, 3367, 3296, 3230, 3368, 3297, 3369, 3298, 3370, 2964, 3371,
+    3372, 3373, 3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3382, 3383, 3384, 3385, 3386, 3387, 3387, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3388, 3389, 3390, 3391, 3392, 0, 0, 0, 0, 0, 3393, 3394, 3395,
+    3396, 1639, 1642, 3397, 3398, 3399, 3400, 3401, 3402, 1612, 3403, 3404, 3405, 3406, 3407, 3408,
+    3409, 3410, 3411, 3412, 3413, 3414, 3415, 0, 3416, 3417, 3418, 3419, 3420, 0, 3421, 0,
+    3422, 3423, 0, 3424, 3425, 0, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435,
+    3436, 3436, 3437, 3437, 3437, 3437, 3438, 3438, 3438, 3438, 3439, 3439, 3439, 3439, 3440, 3440,
+    3440, 3440, 3441, 3441, 3441, 3441, 3442, 3442, 3442, 3442, 3443, 3443, 3443, 3443, 3444, 3444,
+    3444, 3444, 3445, 3445, 3445, 3445, 3446, 3446, 3446, 3446, 3447, 3447, 3447, 3447, 3448, 3448,
+    3448, 3448, 3449, 3449, 3450, 3450, 3451, 3451, 3452, 3452, 3453, 3453, 3454, 3454, 3455, 3455,
+    3455, 3455, 3456, 3456, 3456, 3456, 3457, 3457, 3457, 3457, 3458, 3458, 3458, 3458, 3459, 3459,
+    3460, 3460, 3460, 3460, 3461, 3461, 3462, 3462, 3462, 3462, 3463, 3463, 3463, 3463, 3464, 3464,
+    3465, 3465, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3466, 3466, 3466, 3466, 3467, 3467, 3468, 3468, 3469, 3469, 744, 3470, 3470,
+    3471, 3471, 3472, 3472, 3473, 3473, 3473, 3473, 3474, 3474, 3475, 3475, 3476, 3476, 3477, 3477,
+    3478, 3478, 3479, 3479, 3480, 3480, 3481, 3481, 3481, 3482, 3482, 3482, 3483, 3483, 3483, 3483,
+    3484, 3485, 3486, 3482, 3487, 3488, 3489, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498,
+    3499, 3500, 3501, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514,
+    3515, 3516, 3517, 3518, 3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530,
+    3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546,
+    3547, 3548, 3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562,
+    3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578,
+    3579, 3580, 3581, 3582, 3583, 3584, 3486, 3585, 3482, 3487, 3586, 3587, 3491, 3588, 3492, 3493,
+    3589, 3590, 3497, 3591, 3498, 3499, 3592, 3593, 3501, 3594, 3502, 3503, 3532, 3533, 3536, 3537,
+    3538, 3542, 3543, 3544, 3545, 3549, 3550, 3551, 3595, 3555, 3596, 3597, 3561, 3598, 3562, 3563,
+    3576, 3599, 3600, 3571, 3601, 3572, 3573, 3484, 3485, 3602, 3486, 3603, 3488, 3489, 3490, 3491,
+    3604, 3494, 3495, 3496, 3497, 3605, 3501, 3504, 3505, 3506, 3507, 3508, 3510, 3511, 3512, 3513,
+    3514, 3515, 3606, 3516, 3517, 3518, 3519, 3520, 3521, 3523, 3524, 3525, 3526, 3527, 3528, 3529,
+    3530, 3531, 3534, 3535, 3539, 3540, 3541, 3542, 3543, 3546, 3547, 3548, 3549, 3607, 3552, 3553,
+    3554, 3555, 3558, 3559, 3560, 3561, 3608, 3564, 3565, 3609, 3568, 3569, 3570, 3571, 3610, 3486,
+    3603, 3491, 3604, 3497, 3605, 3501, 3611, 3514, 3612, 3613, 3614, 3542, 3543, 3549, 3561, 3608,
+    3571, 3610, 3615, 3616, 3617, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628,
+    3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639, 3640, 3613, 3641, 3642, 3643,
+    3644, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632,
+    3633, 3634, 3635, 3636, 3637, 3638, 3639, 3640, 3613, 3641, 3642, 3643, 3644, 3638, 3639, 3640,
+    3613, 3612, 3614, 3522, 3511, 3512, 3513, 3638, 3639, 3640, 3522, 3523, 3645, 3645, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    3646, 3647, 3647, 3648, 3649, 3650, 3651, 3652, 3653, 3653, 3654, 3655, 3656, 3657, 3658, 3659,
+    3659, 3660, 3661, 3661, 3662, 3662, 3663, 3664, 3664, 3665, 3666, 3666, 3667, 3667, 3668, 3669,
+    3669, 3670, 3670, 3671, 3672, 3673, 3674, 3674, 3675, 3676, 3677, 3678, 3679, 3679, 3680, 3681,
+    3682, 3683, 3684, 3685, 3685, 3686, 3686, 3687, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694,
+    0, 0, 3695, 3696, 3697, 3698, 3699, 3700, 3700, 3701, 3702, 3703, 3704, 3704, 3705, 3706,
+    3707, 3708, 3709, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721, 3722,
+    3723, 3724, 3725, 3726, 3680, 3682, 3727, 3728, 3729, 3730, 3731, 3732, 3731, 3729, 3733, 3734,
+    3735, 3736, 3737, 3732, 3673, 3663, 3738, 3739, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 1, 1, 1,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    3753, 3754, 3755, 3756, 3757, 3758, 3759, 3760, 3761, 1594, 0, 0, 0, 0, 0, 0,
+    396, 396, 396, 396, 396, 396, 396, 398, 398, 398, 398, 398, 398, 398, 396, 396,
+    1593, 3762, 3763, 3764, 3764, 1615, 1616, 3765, 3766, 3767, 3768, 3769, 3770, 3771, 3772, 3773,
+    3774, 3775, 3776, 3777, 3778, 1, 1, 3779, 3780, 1600, 1600, 1600, 1600, 3764, 3764, 3764,
+    3753, 3754, 1592, 0, 3757, 3756, 3759, 3758, 3762, 1615, 1616, 3765, 3766, 3767, 3768, 3781,
+    3782, 3783, 1612, 3784, 3785, 3786, 1614, 0, 3787, 3788, 3789, 3790, 0, 0, 0, 0,
+    3791, 3792, 3793, 1, 3794, 0, 3795, 3796, 3797, 3798, 3799, 3800, 3801, 3802, 3803, 3804,
+    3805, 3806, 3806, 3807, 3807, 3808, 3808, 3809, 3809, 3810, 3810, 3810, 3810, 3811, 3811, 3812,
+    3812, 3812, 3812, 3813, 3813, 3814, 3814, 3814, 3814, 3815, 3815, 3815, 3815, 3816, 3816, 3816,
+    3816, 3817, 3817, 3817, 3817, 3818, 3818, 3818, 3818, 3819, 3819, 3820, 3820, 3821, 3821, 3822,
+    3822, 3823, 3823, 3823, 3823, 3824, 3824, 3824, 3824, 3825, 3825, 3825, 3825, 3826, 3826, 3826,
+    3826, 3827, 3827, 3827, 3827, 3828, 3828, 3828, 3828, 3829, 3829, 3829, 3829, 3830, 3830, 3830,
+    3830, 3831, 3831, 3831, 3831, 3832, 3832, 3832, 3832, 3833, 3833, 3833, 3833, 3834, 3834, 3834,
+    3834, 3835, 3835, 3835, 3835, 3836, 3836, 3836, 3836, 3837, 3837, 3837, 3837, 3838, 3838, 3474,
+    3474, 3839, 3839, 3839, 3839, 3840, 3840, 3841, 3841, 3842, 3842, 3843, 3843, 0, 0, 0,
+    0, 3758, 3844, 3781, 3788, 3789, 3782, 3845, 1615, 1616, 3783, 1612, 3753, 3784, 1592, 3846,
+    1605, 37, 32, 33, 1606, 1607, 1608, 1609, 1610, 1611, 3756, 3757, 3785, 1614, 3786, 3759,
+    3790, 3847, 3848, 3849, 3850, 3851, 3852, 3853, 3854, 3855, 3856, 3857, 3858, 3859, 3860, 3861,
+    3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869, 3870, 3871, 3872, 3779, 3787, 3780, 3873, 3764,
+    3874, 30, 1044, 1070, 1045, 1046, 1073, 1050, 376, 1067, 378, 1051, 392, 1052, 1617, 38,
+    1057, 1843, 379, 218, 1058, 1059, 1062, 383, 393, 384, 1100, 3765, 3875, 3766, 3876, 3877,
+    3878, 3755, 3775, 3776, 3754, 3879, 2566, 3880, 3881, 3882, 3883, 3884, 3885, 3886, 3887, 3888,
+    3889, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534,
+    2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550,
+    2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 3890, 3891, 3892,
+    2301, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264,
+    2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 0,
+    0, 0, 2280, 2281, 2282, 2283, 2284, 2285, 0, 0, 2286, 2287, 2288, 2289, 2290, 2291,
+    0, 0, 2292, 2293, 2294, 2295, 2296, 2297, 0, 0, 2298, 2299, 2300, 0, 0, 0,
+    3893, 3894, 3895, 31, 3896, 3897, 3898, 0, 3899, 3900, 3901, 3902, 3903, 3904, 3905, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 398, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    398, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 396, 396, 396, 396, 396, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3906, 3907, 3908, 3909, 3910, 3911, 3912, 3913, 3914, 3915, 3916, 3917, 3918, 3919, 3920, 3921,
+    3922, 3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932, 3933, 3934, 3935, 3936, 3937,
+    3938, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955, 3956, 3957, 3958, 3959, 3960, 3961,
+    3962, 3963, 3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977,
+    3978, 3979, 3980, 3981, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 0, 3993, 3994, 3995, 3996,
+    3997, 3998, 3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006, 4007, 0, 4008, 4009, 4010, 4011,
+    4012, 4013, 4014, 0, 4015, 4016, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 4017, 4018, 4019, 4020, 4021, 0, 4022, 4023, 4024, 4025, 4026, 4027, 4028, 4029, 4030,
+    4031, 4032, 4033, 4034, 4035, 1627, 4036, 4037, 4038, 4039, 4040, 4041, 4042, 4043, 4044, 4045,
+    4046, 4047, 4048, 4049, 4050, 1843, 4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058, 4059, 4060,
+    4061, 0, 4062, 4063, 4064, 4065, 4066, 4067, 4068, 4069, 4070, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 410, 410, 410, 0, 410, 410, 0, 0, 0, 0, 0, 410, 398, 410, 396,
+    1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 396, 403, 398, 0, 0, 0, 0, 754,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 396, 398, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4071, 4072, 4073, 4074, 4075, 4076, 4077, 4078, 4079, 4080, 4081, 4082, 4083, 4084, 4085, 4086,
+    4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4095, 4096, 4097, 4098, 4099, 4100, 4101, 4102,
+    4103, 4104, 4105, 4106, 4107, 4108, 4109, 4110, 4111, 4112, 4113, 4114, 4115, 4116, 4117, 4118,
+    4119, 4120, 4121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 396, 396, 396, 396, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 396, 396, 1, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 398, 398, 396, 396, 396, 398, 396, 398, 398, 398,
+    398, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 396, 398, 396, 398, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 754, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    754, 1, 1, 410, 410, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 754,
+    410, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4122, 1, 4123, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4124, 1, 1, 1, 1,
+    1, 1, 1, 410, 410, 410, 410, 1, 1, 754, 753, 1, 1, 0, 1, 1,
+    1, 1, 410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    396, 396, 396, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 779, 410, 410, 410, 410, 1, 410, 4125, 4126,
+    410, 410, 410, 754, 754, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 763, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    410, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 410, 410, 410, 410, 410, 410, 410, 410, 410, 1,
+    962, 1, 1, 1, 1, 1, 1, 1, 1, 410, 763, 410, 410, 1, 1, 410,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 410,
+    410, 410, 1, 1, 410, 962, 763, 410, 1, 1, 1, 1, 1, 1, 410, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 410,
+    1, 1, 1, 410, 410, 410, 410, 410, 410, 763, 754, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    410, 410, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1,
+    1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 763, 763, 1, 764, 1,
+    410, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 4127, 4128, 962, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 764, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 396, 396, 396, 396, 396, 396, 396, 0, 0, 0,
+    396, 396, 396, 396, 396, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 410, 410, 410, 410, 410, 410, 410, 410,
+    1, 1, 754, 410, 410, 1, 763, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 396, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    764, 1, 1, 410, 410, 410, 410, 410, 410, 1, 779, 4129, 4130, 764, 4131, 410,
+    410, 1, 754, 763, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 764,
+    1, 1, 410, 410, 410, 410, 0, 0, 1, 1, 4132, 4133, 410, 410, 1, 754,
+    763, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 410, 410, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 410, 410, 410, 410, 410, 410, 410, 410, 1, 1, 410, 1, 754,
+    410, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 410, 1, 410, 1, 1,
+    410, 410, 410, 410, 410, 410, 962, 763, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 410, 410, 410,
+    1, 1, 410, 410, 410, 410, 1, 410, 410, 410, 410, 754, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 1, 754, 763, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4134, 4135, 4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 4144, 4145, 4146, 4147, 4148, 4149,
+    4150, 4151, 4152, 4153, 4154, 4155, 4156, 4157, 4158, 4159, 4160, 4161, 4162, 4163, 4164, 4165,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    764, 1, 1, 1, 1, 1, 0, 1, 4166, 0, 0, 410, 410, 962, 754, 1,
+    1, 1, 1, 763, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 410, 410, 410, 410, 0, 0, 410, 410, 1, 1, 1, 1,
+    754, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 410, 754, 410, 410, 410, 410, 1, 1, 410, 410, 410, 410, 1,
+    1, 1, 1, 1, 1, 1, 1, 754, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 410, 410, 410, 410, 410, 410, 1, 1, 410, 410, 410, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 1, 410, 754, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    410, 410, 410, 410, 410, 410, 410, 0, 410, 410, 410, 410, 410, 410, 1, 754,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 0, 1, 410, 410, 410, 410, 410, 410,
+    410, 1, 410, 410, 1, 410, 410, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 410, 410, 410, 410, 410, 410, 0, 0, 0, 410, 0, 410, 410, 0, 410,
+    410, 410, 763, 410, 754, 754, 1, 410, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    410, 410, 0, 1, 1, 410, 1, 754, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 410, 410, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    403, 403, 403, 403, 403, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    396, 396, 396, 396, 396, 396, 396, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4167, 4168, 4169, 4170, 4171, 4172, 4173, 4174, 4175, 4176, 4177, 4178, 4179, 4180, 4181, 4182,
+    4183, 4184, 4185, 4186, 4187, 4188, 4189, 4190, 4191, 4192, 4193, 4194, 4195, 4196, 4197, 4198,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 410,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 410,
+    410, 410, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4199, 4199, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 410, 403, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 0, 0,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4200, 4201,
+    4202, 4203, 4204, 4205, 4206, 4207, 4207, 403, 403, 403, 1, 1, 1, 4208, 4207, 4207,
+    4207, 4207, 4207, 0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 398, 398, 398,
+    398, 398, 398, 1, 1, 396, 396, 396, 396, 396, 398, 398, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 396, 396, 396, 396, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4209, 4210, 4211, 4212, 4213,
+    4214, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 396, 396, 396, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    1020, 1022, 1621, 1023, 1024, 1637, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1036,
+    1629, 1037, 4215, 1038, 1039, 1910, 1040, 4216, 4217, 1633, 30, 1044, 1070, 1045, 1046, 1073,
+    1050, 376, 1067, 378, 1051, 392, 1052, 1617, 38, 1057, 1843, 379, 218, 1058, 1059, 1062,
+    383, 393, 384, 1100, 1020, 1022, 1621, 1023, 1024, 1637, 1026, 1027, 1028, 1029, 1030, 1031,
+    1032, 1033, 1034, 1036, 1629, 1037, 4215, 1038, 1039, 1910, 1040, 4216, 4217, 1633, 30, 1044,
+    1070, 1045, 1046, 1073, 1050, 0, 1067, 378, 1051, 392, 1052, 1617, 38, 1057, 1843, 379,
+    218, 1058, 1059, 1062, 383, 393, 384, 1100, 1020, 1022, 1621, 1023, 1024, 1637, 1026, 1027,
+    1028, 1029, 1030, 1031, 1032, 1033, 1034, 1036, 1629, 1037, 4215, 1038, 1039, 1910, 1040, 4216,
+    4217, 1633, 30, 1044, 1070, 1045, 1046, 1073, 1050, 376, 1067, 378, 1051, 392, 1052, 1617,
+    38, 1057, 1843, 379, 218, 1058, 1059, 1062, 383, 393, 384, 1100, 1020, 0, 1621, 1023,
+    0, 0, 1026, 0, 0, 1029, 1030, 0, 0, 1033, 1034, 1036, 1629, 0, 4215, 1038,
+    1039, 1910, 1040, 4216, 4217, 1633, 30, 1044, 1070, 1045, 0, 1073, 0, 376, 1067, 378,
+    1051, 392, 1052, 1617, 0, 1057, 1843, 379, 218, 1058, 1059, 1062, 383, 393, 384, 1100,
+    1020, 1022, 1621, 1023, 1024, 1637, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1036,
+    1629, 1037, 4215, 1038, 1039, 1910, 1040, 4216, 4217, 1633, 30, 1044, 1070, 1045, 1046, 1073,
+    1050, 376, 1067, 378, 1051, 392, 1052, 1617, 38, 1057, 1843, 379, 218, 1058, 1059, 1062,
+    383, 393, 384, 1100, 1020, 1022, 0, 1023, 1024, 1637, 1026, 0, 0, 1029, 1030, 1031,
+    1032, 1033, 1034, 1036, 1629, 0, 4215, 1038, 1039, 1910, 1040, 4216, 4217, 0, 30, 1044,
+    1070, 1045, 1046, 1073, 1050, 376, 1067, 378, 1051, 392, 1052, 1617, 38, 1057, 1843, 379,
+    218, 1058, 1059, 1062, 383, 393, 384, 1100, 1020, 1022, 0, 1023, 1024, 1637, 1026, 0,
+    1028, 1029, 1030, 1031, 1032, 0, 1034, 0, 0, 0, 4215, 1038, 1039, 1910, 1040, 4216,
+    4217, 0, 30, 1044, 1070, 1045, 1046, 1073, 1050, 376, 1067, 378, 1051, 392, 1052, 1617,
+    38, 1057, 1843, 379, 218, 1058, 1059, 1062, 383, 393, 384, 1100, 1020, 1022, 1621, 1023,
+    1024, 1637, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1036, 1629, 1037, 4215, 1038,
+    1039, 1910, 1040, 4216, 4217, 1633, 30, 1044, 1070, 1045, 1046, 1073, 1050, 376, 1067, 378,
+    1051, 392, 1052, 1617, 38, 1057, 1843, 379, 218, 1058, 1059, 1062, 383, 393, 384, 1100,
+    1020, 1022, 1621, 1023, 1024, 1637, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1036,
+    1629, 1037, 4215, 1038, 1039, 1910, 1040, 4216, 4217, 1633, 30, 1044, 1070, 1045, 1046, 1073,
+    1050, 376, 1067, 378, 1051, 392, 1052, 1617, 38, 1057, 1843, 379, 218, 1058, 1059, 1062,
+    383, 393, 384, 1100, 1020, 1022, 1621, 1023, 1024, 1637, 1026, 1027, 1028, 1029, 1030, 1031,
+    1032, 1033, 1034, 1036, 1629, 1037, 4215, 1038, 1039, 1910, 1040, 4216, 4217, 1633, 30, 1044,
+    1070, 1045, 1046, 1073, 1050, 376, 1067, 378, 1051, 392, 1052, 1617, 38, 1057, 1843, 379,
+    218, 1058, 1059, 1062, 383, 393, 384, 1100, 1020, 1022, 1621, 1023, 1024, 1637, 1026, 1027,
+    1028, 1029, 1030, 1031, 1032, 1033, 1034, 1036, 1629, 1037, 4215, 1038, 1039, 1910, 1040, 4216,
+    4217, 1633, 30, 1044, 1070, 1045, 1046, 1073, 1050, 376, 1067, 378, 1051, 392, 1052, 1617,
+    38, 1057, 1843, 379, 218, 1058, 1059, 1062, 383, 393, 384, 1100, 1020, 1022, 1621, 1023,
+    1024, 1637, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1036, 1629, 1037, 4215, 1038,
+    1039, 1910, 1040, 4216, 4217, 1633, 30, 1044, 1070, 1045, 1046, 1073, 1050, 376, 1067, 378,
+    1051, 392, 1052, 1617, 38, 1057, 1843, 379, 218, 1058, 1059, 1062, 383, 393, 384, 1100,
+    1020, 1022, 1621, 1023, 1024, 1637, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1036,
+    1629, 1037, 4215, 1038, 1039, 1910, 1040, 4216, 4217, 1633, 30, 1044, 1070, 1045, 1046, 1073,
+    1050, 376, 1067, 378, 1051, 392, 1052, 1617, 38, 1057, 1843, 379, 218, 1058, 1059, 1062,
+    383, 393, 384, 1100, 4218, 4219, 0, 0, 4220, 4221, 1644, 4222, 4223, 4224, 4225, 4226,
+    4227, 4228, 4229, 4230, 4231, 4232, 4233, 1645, 4234, 4226, 4235, 4236, 469, 4237, 4238, 4239,
+    4240, 4241, 4242, 467, 1064, 1065, 490, 4243, 4244, 468, 4245, 486, 4246, 35, 4247, 4248,
+    4249, 473, 487, 488, 4250, 4251, 4252, 472, 1066, 4253, 4254, 4255, 490, 468, 486, 472,
+    487, 473, 4220, 4221, 1644, 4222, 4223, 4224, 4225, 4226, 4227, 4228, 4229, 4230, 4231, 4232,
+    4233, 1645, 4234, 4226, 4235, 4236, 469, 4237, 4238, 4239, 4240, 4241, 4242, 467, 1064, 1065,
+    490, 4243, 4244, 468, 4245, 486, 4246, 35, 4247, 4248, 4249, 473, 487, 488, 4250, 4251,
+    4252, 472, 1066, 4253, 4254, 4255, 490, 468, 486, 472, 487, 473, 4220, 4221, 1644, 4222,
+    4223, 4224, 4225, 4226, 4227, 4228, 4229, 4230, 4231, 4232, 4233, 1645, 4234, 4226, 4235, 4236,
+    469, 4237, 4238, 4239, 4240, 4241, 4242, 467, 1064, 1065, 490, 4243, 4244, 468, 4245, 486,
+    4246, 35, 4247, 4248, 4249, 473, 487, 488, 4250, 4251, 4252, 472, 1066, 4253, 4254, 4255,
+    490, 468, 486, 472, 487, 473, 4220, 4221, 1644, 4222, 4223, 4224, 4225, 4226, 4227, 4228,
+    4229, 4230, 4231, 4232, 4233, 1645, 4234, 4226, 4235, 4236, 469, 4237, 4238, 4239, 4240, 4241,
+    4242, 467, 1064, 1065, 490, 4243, 4244, 468, 4245, 486, 4246, 35, 4247, 4248, 4249, 473,
+    487, 488, 4250, 4251, 4252, 472, 1066, 4253, 4254, 4255, 490, 468, 486, 472, 487, 473,
+    4220, 4221, 1644, 4222, 4223, 4224, 4225, 4226, 4227, 4228, 4229, 4230, 4231, 4232, 4233, 1645,
+    4234, 4226, 4235, 4236, 469, 4237, 4238, 4239, 4240, 4241, 4242, 467, 1064, 1065, 490, 4243,
+    4244, 468, 4245, 486, 4246, 35, 4247, 4248, 4249, 473, 487, 488, 4250, 4251, 4252, 472,
+    1066, 4253, 4254, 4255, 490, 468, 486, 472, 487, 473, 4256, 4257, 0, 0, 1605, 37,
+    32, 33, 1606, 1607, 1608, 1609, 1610, 1611, 1605, 37, 32, 33, 1606, 1607, 1608, 1609,
+    1610, 1611, 1605, 37, 32, 33, 1606, 1607, 1608, 1609, 1610, 1611, 1605, 37, 32, 33,
+    1606, 1607, 1608, 1609, 1610, 1611, 1605, 37, 32, 33, 1606, 1607, 1608, 1609, 1610, 1611,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 1, 1, 1, 1, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 1, 1, 1,
+    1, 1, 1, 1, 1, 410, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 410, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 410, 410, 410, 410, 410,
+    0, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    396, 396, 396, 396, 396, 396, 396, 0, 396, 396, 396, 396, 396, 396, 396, 396,
+    396, 396, 396, 396, 396, 396, 396, 396, 396, 0, 0, 396, 396, 396, 396, 396,
+    396, 396, 0, 396, 396, 0, 396, 396, 396, 396, 396, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    396, 396, 396, 396, 396, 396, 396, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 396, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 396, 396, 396, 396,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    398, 398, 398, 398, 398, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4258, 4259, 4260, 4261, 4262, 4263, 4264, 4265, 4266, 4267, 4268, 4269, 4270, 4271, 4272, 4273,
+    4274, 4275, 4276, 4277, 4278, 4279, 4280, 4281, 4282, 4283, 4284, 4285, 4286, 4287, 4288, 4289,
+    4290, 4291, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 396, 396, 396, 396, 396, 396, 763, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3811, 3812, 3816, 3819, 0, 3838, 3822, 3817, 3827, 3839, 3833, 3834, 3835, 3836, 3823, 3829,
+    3831, 3825, 3832, 3821, 3824, 3814, 3815, 3818, 3820, 3826, 3828, 3830, 4292, 3459, 4293, 4294,
+    0, 3812, 3816, 0, 3837, 0, 0, 3817, 0, 3839, 3833, 3834, 3835, 3836, 3823, 3829,
+    3831, 3825, 3832, 0, 3824, 3814, 3815, 3818, 0, 3826, 0, 3830, 0, 0, 0, 0,
+    0, 0, 3816, 0, 0, 0, 0, 3817, 0, 3839, 0, 3834, 0, 3836, 3823, 3829,
+    0, 3825, 3832, 0, 3824, 0, 0, 3818, 0, 3826, 0, 3830, 0, 3459, 0, 4294,
+    0, 3812, 3816, 0, 3837, 0, 0, 3817, 3827, 3839, 3833, 0, 3835, 3836, 3823, 3829,
+    3831, 3825, 3832, 0, 3824, 3814, 3815, 3818, 0, 3826, 3828, 3830, 4292, 0, 4293, 0,
+    3811, 3812, 3816, 3819, 3837, 3838, 3822, 3817, 3827, 3839, 0, 3834, 3835, 3836, 3823, 3829,
+    3831, 3825, 3832, 3821, 3824, 3814, 3815, 3818, 3820, 3826, 3828, 3830, 0, 0, 0, 0,
+    0, 3812, 3816, 3819, 0, 3838, 3822, 3817, 3827, 3839, 0, 3834, 3835, 3836, 3823, 3829,
+    3831, 3825, 3832, 3821, 3824, 3814, 3815, 3818, 3820, 3826, 3828, 3830, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4295, 4296, 4297, 4298, 4299, 4300, 4301, 4302, 4303, 4304, 4305, 1, 1, 1, 1, 1,
+    4306, 4307, 4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319, 4320, 4321,
+    4322, 4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330, 4331, 4332, 1621, 1037, 4333, 4334, 1,
+    1020, 1022, 1621, 1023, 1024, 1637, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1036,
+    1629, 1037, 4215, 1038, 1039, 1910, 1040, 4216, 4217, 1633, 4335, 2753, 4336, 4337, 4338, 4339,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4340, 4341, 4342, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    4343, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    4344, 4345, 2530, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2032, 4346, 4347, 4348, 1975, 4349, 4350, 2352, 4351, 4352, 4353, 4354, 4355, 4356, 4357, 4358,
+    4359, 4360, 2068, 4361, 4362, 4363, 4364, 4365, 4366, 1969, 2344, 4367, 2479, 2347, 2480, 4368,
+    2124, 4369, 4370, 4371, 4372, 4373, 2462, 2042, 4374, 4375, 4376, 4377, 0, 0, 0, 0,
+    4378, 4379, 4380, 4381, 4382, 4383, 4384, 4385, 4386, 0, 0, 0, 0, 0, 0, 0,
+    4387, 4388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1605, 37, 32, 33, 1606, 1607, 1608, 1609, 1610, 1611, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4389, 4390, 4391, 4392, 4393, 3243, 4394, 4395, 4396, 4397, 3244, 4398, 4399, 4400, 3245, 4401,
+    4402, 4403, 4404, 4405, 4406, 4407, 4408, 4409, 4410, 4411, 4412, 3303, 4413, 4414, 4415, 4416,
+    4417, 4418, 4419, 4420, 4421, 3308, 3246, 3247, 3309, 4422, 4423, 3054, 4424, 3248, 4425, 4426,
+    4427, 4428, 4428, 4428, 4429, 4430, 4431, 4432, 4433, 4434, 4435, 4436, 4437, 4438, 4439, 4440,
+    4441, 4442, 4443, 4444, 4445, 4446, 4446, 3311, 4447, 4448, 4449, 4450, 3250, 4451, 4452, 4453,
+    3207, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468,
+    4469, 4470, 4471, 4472, 4473, 4474, 4475, 4476, 4477, 4478, 4479, 4479, 4480, 4481, 4482, 3050,
+    4483, 4484, 4485, 4486, 4487, 4488, 4489, 4490, 3255, 4491, 4492, 4493, 4494, 4495, 4496, 4497,
+    4498, 4499, 4500, 4501, 4502, 4503, 4504, 4505, 4506, 4507, 4508, 4509, 4510, 4511, 2996, 4512,
+    4513, 4514, 4514, 4515, 4516, 4516, 4517, 4518, 4519, 4520, 4521, 4522, 4523, 4524, 4525, 4526,
+    4527, 4528, 4529, 3256, 4530, 4531, 4532, 4533, 3323, 4533, 4534, 3258, 4535, 4536, 4537, 4538,
+    3259, 2969, 4539, 4540, 4541, 4542, 4543, 4544, 4545, 4546, 4547, 4548, 4549, 4550, 4551, 4552,
+    4553, 4554, 4555, 4556, 4557, 4558, 4559, 4560, 3260, 4561, 4562, 4563, 4564, 4565, 4566, 3262,
+    4567, 4568, 4569, 4570, 4571, 4572, 4573, 4574, 2997, 3331, 4575, 4576, 4577, 4578, 4579, 4580,
+    4581, 4582, 3263, 4583, 4584, 4585, 4586, 3374, 4587, 4588, 4589, 4590, 4591, 4592, 4593, 4594,
+    4595, 4596, 4597, 4598, 4599, 3067, 4600, 4601, 4602, 4603, 4604, 4605, 4606, 4607, 4608, 4609,
+    4610, 3264, 3154, 4611, 4612, 4613, 4614, 4615, 4616, 4617, 4618, 3335, 4619, 4620, 4621, 4622,
+    4623, 4624, 4625, 4626, 3336, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637,
+    4638, 3338, 4639, 4640, 4641, 4642, 4643, 4644, 4645, 4646, 4647, 4648, 4649, 4649, 4650, 4651,
+    3340, 4652, 4653, 4654, 4655, 4656, 4657, 4658, 3053, 4659, 4660, 4661, 4662, 4663, 4664, 4665,
+    3346, 4666, 4667, 4668, 4669, 4670, 4671, 4671, 3347, 3376, 4672, 4673, 4674, 4675, 4676, 3015,
+    3349, 4677, 4678, 3275, 4679, 4680, 3229, 4681, 4682, 3279, 4683, 4684, 4685, 4686, 4686, 4687,
+    4688, 4689, 4690, 4691, 4692, 4693, 4694, 4695, 4696, 4697, 4698, 4699, 4700, 4701, 4702, 4703,
+    4704, 4705, 4706, 4707, 4708, 4709, 4710, 4711, 4712, 4713, 3285, 4714, 4715, 4716, 4717, 4718,
+    4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726, 4727, 4728, 4729, 4515, 4730, 4731, 4732, 4733,
+    4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 3071, 4742, 4743, 4744, 4745, 4746, 4747, 3288,
+    4748, 4749, 4750, 4751, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4759, 4760, 4761, 4762, 4763,
+    4764, 4765, 4766, 4767, 3010, 4768, 4769, 4770, 4771, 4772, 4773, 3356, 4774, 4775, 4776, 4777,
+    4778, 4779, 4780, 4781, 4782, 4783, 4784, 4785, 4786, 4787, 4788, 4789, 4790, 4791, 4792, 4793,
+    3361, 3362, 4794, 4795, 4796, 4797, 4798, 4799, 4800, 4801, 4802, 4803, 4804, 4805, 4806, 3363,
+    4807, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4815, 4816, 4817, 4818, 4819, 4820, 4821, 4822,
+    4823, 4824, 4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833, 4834, 4835, 4836, 3369, 3369,
+    4837, 4838, 4839, 4840, 4841, 4842, 4843, 4844, 4845, 4846, 3370, 4847, 4848, 4849, 4850, 4851,
+    4852, 4853, 4854, 4855, 4856, 4857, 4858, 4859, 4860, 4861, 4862, 4863, 4864, 4865, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const CodepointRecord kRecords[4866] = {
+    {0, 128, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 1, 0, 0, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1},
+    {0, 0, 0, 0, 1, 0, 0, 2},
+    {0, 0, 0, 0, 1, 0, 0, 3},
+    {0, 0, 0, 0, 1, 0, 0, 4},
+    {0, 0, 0, 0, 1, 0, 0, 5},
+    {0, 0, 0, 0, 1, 0, 0, 6},
+    {0, 0, 0, 0, 1, 0, 0, 7},
+    {0, 0, 0, 0, 1, 0, 0, 8},
+    {0, 0, 0, 0, 1, 0, 0, 9},
+    {0, 0, 0, 0, 1, 0, 0, 10},
+    {0, 0, 0, 0, 1, 0, 0, 11},
+    {0, 0, 0, 0, 1, 0, 0, 12},
+    {0, 0, 0, 0, 1, 0, 0, 13},
+    {0, 0, 0, 0, 1, 0, 0, 14},
+    {0, 0, 0, 0, 1, 0, 0, 15},
+    {0, 0, 0, 0, 1, 0, 0, 16},
+    {0, 0, 0, 0, 1, 0, 0, 17},
+    {0, 0, 0, 0, 1, 0, 0, 18},
+    {0, 0, 0, 0, 1, 0, 0, 19},
+    {0, 0, 0, 0, 1, 0, 0, 20},
+    {0, 0, 0, 0, 1, 0, 0, 21},
+    {0, 0, 0, 0, 1, 0, 0, 22},
+    {0, 0, 0, 0, 1, 0, 0, 23},
+    {0, 0, 0, 0, 1, 0, 0, 24},
+    {0, 0, 0, 0, 1, 0, 0, 25},
+    {0, 18, 0, 1, 0, 0, 26, 0},
+    {0, 18, 0, 2, 0, 0, 27, 0},
+    {0, 18, 0, 1, 0, 0, 0, 0},
+    {0, 18, 0, 2, 0, 0, 29, 0},
+    {0, 18, 0, 1, 0, 0, 31, 0},
+    {0, 18, 0, 1, 0, 0, 32, 0},
+    {0, 18, 0, 2, 0, 0, 33, 0},
+    {0, 18, 0, 1, 0, 0, 35, 0},
+    {0, 18, 0, 2, 0, 0, 36, 0},
+    {0, 18, 0, 1, 0, 0, 38, 0},
+    {0, 18, 0, 1, 0, 0, 14, 0},
+    {0, 18, 0, 3, 0, 0, 39, 0},
+    {0, 18, 0, 3, 0, 0, 42, 0},
+    {0, 18, 0, 3, 0, 0, 45, 0},
+    {0, 3, 2, 2, 1, 48, 48, 50},
+    {0, 3, 2, 2, 1, 51, 51, 53},
+    {0, 3, 2, 2, 1, 54, 54, 56},
+    {0, 3, 2, 2, 1, 57, 57, 59},
+    {0, 3, 2, 2, 1, 60, 60, 62},
+    {0, 3, 2, 2, 1, 63, 63, 65},
+    {0, 0, 0, 0, 1, 0, 0, 66},
+    {0, 3, 2, 2, 1, 67, 67, 69},
+    {0, 3, 2, 2, 1, 70, 70, 72},
+    {0, 3, 2, 2, 1, 73, 73, 75},
+    {0, 3, 2, 2, 1, 76, 76, 78},
+    {0, 3, 2, 2, 1, 79, 79, 81},
+    {0, 3, 2, 2, 1, 82, 82, 84},
+    {0, 3, 2, 2, 1, 85, 85, 87},
+    {0, 3, 2, 2, 1, 88, 88, 90},
+    {0, 3, 2, 2, 1, 91, 91, 93},
+    {0, 0, 0, 0, 1, 0, 0, 94},
+    {0, 3, 2, 2, 1, 95, 95, 97},
+    {0, 3, 2, 2, 1, 98, 98, 100},
+    {0, 3, 2, 2, 1, 101, 101, 103},
+    {0, 3, 2, 2, 1, 104, 104, 106},
+    {0, 3, 2, 2, 1, 107, 107, 109},
+    {0, 3, 2, 2, 1, 110, 110, 112},
+    {0, 0, 0, 0, 1, 0, 0, 113},
+    {0, 3, 2, 2, 1, 114, 114, 116},
+    {0, 3, 2, 2, 1, 117, 117, 119},
+    {0, 3, 2, 2, 1, 120, 120, 122},
+    {0, 3, 2, 2, 1, 123, 123, 125},
+    {0, 3, 2, 2, 1, 126, 126, 128},
+    {0, 0, 0, 0, 1, 0, 0, 129},
+    {0, 3, 2, 2, 0, 130, 130, 0},
+    {0, 3, 2, 2, 0, 132, 132, 0},
+    {0, 3, 2, 2, 0, 134, 134, 0},
+    {0, 3, 2, 2, 0, 136, 136, 0},
+    {0, 3, 2, 2, 0, 138, 138, 0},
+    {0, 3, 2, 2, 0, 140, 140, 0},
+    {0, 3, 2, 2, 0, 142, 142, 0},
+    {0, 3, 2, 2, 0, 144, 144, 0},
+    {0, 3, 2, 2, 0, 146, 146, 0},
+    {0, 3, 2, 2, 0, 148, 148, 0},
+    {0, 3, 2, 2, 0, 150, 150, 0},
+    {0, 3, 2, 2, 0, 152, 152, 0},
+    {0, 3, 2, 2, 0, 154, 154, 0},
+    {0, 3, 2, 2, 0, 156, 156, 0},
+    {0, 3, 2, 2, 0, 158, 158, 0},
+    {0, 3, 2, 2, 0, 160, 160, 0},
+    {0, 3, 2, 2, 0, 162, 162, 0},
+    {0, 3, 2, 2, 0, 164, 164, 0},
+    {0, 3, 2, 2, 0, 166, 166, 0},
+    {0, 3, 2, 2, 0, 168, 168, 0},
+    {0, 3, 2, 2, 0, 170, 170, 0},
+    {0, 3, 2, 2, 0, 172, 172, 0},
+    {0, 3, 2, 2, 0, 174, 174, 0},
+    {0, 3, 2, 2, 0, 176, 176, 0},
+    {0, 3, 2, 2, 0, 178, 178, 0},
+    {0, 3, 2, 2, 0, 180, 180, 0},
+    {0, 3, 2, 2, 0, 182, 182, 0},
+    {0, 3, 2, 2, 1, 184, 184, 186},
+    {0, 3, 2, 2, 0, 187, 187, 0},
+    {0, 3, 2, 2, 1, 189, 189, 191},
+    {0, 3, 2, 2, 0, 192, 192, 0},
+    {0, 3, 2, 2, 1, 194, 194, 196},
+    {0, 3, 2, 2, 0, 197, 197, 0},
+    {0, 3, 2, 2, 1, 199, 199, 201},
+    {0, 3, 2, 2, 0, 202, 202, 0},
+    {0, 3, 2, 2, 1, 204, 204, 206},
+    {0, 3, 2, 2, 0, 207, 207, 0},
+    {0, 3, 2, 2, 1, 209, 209, 211},
+    {0, 3, 2, 2, 0, 212, 212, 0},
+    {0, 3, 2, 2, 1, 214, 214, 216},
+    {0, 3, 2, 2, 0, 217, 217, 0},
+    {0, 3, 2, 2, 1, 219, 219, 221},
+    {0, 3, 2, 2, 0, 222, 222, 0},
+    {0, 0, 0, 0, 1, 0, 0, 224},
+    {0, 3, 2, 2, 1, 225, 225, 227},
+    {0, 3, 2, 2, 0, 228, 228, 0},
+    {0, 3, 2, 2, 1, 230, 230, 232},
+    {0, 3, 2, 2, 0, 233, 233, 0},
+    {0, 3, 2, 2, 1, 235, 235, 237},
+    {0, 3, 2, 2, 0, 238, 238, 0},
+    {0, 3, 2, 2, 1, 240, 240, 242},
+    {0, 3, 2, 2, 0, 243, 243, 0},
+    {0, 3, 2, 2, 1, 245, 245, 247},
+    {0, 3, 2, 2, 0, 248, 248, 0},
+    {0, 3, 2, 2, 1, 250, 250, 252},
+    {0, 3, 2, 2, 0, 253, 253, 0},
+    {0, 3, 2, 2, 1, 255, 255, 257},
+    {0, 3, 2, 2, 0, 258, 258, 0},
+    {0, 3, 2, 2, 1, 260, 260, 262},
+    {0, 3, 2, 2, 0, 263, 263, 0},
+    {0, 3, 2, 2, 1, 265, 265, 267},
+    {0, 3, 2, 2, 0, 268, 268, 0},
+    {0, 3, 2, 2, 1, 270, 270, 272},
+    {0, 3, 2, 2, 0, 273, 273, 0},
+    {0, 0, 0, 0, 1, 0, 0, 275},
+    {0, 3, 2, 2, 1, 276, 276, 278},
+    {0, 3, 2, 2, 0, 279, 279, 0},
+    {0, 3, 2, 2, 1, 281, 281, 283},
+    {0, 3, 2, 2, 0, 284, 284, 0},
+    {0, 3, 2, 2, 1, 286, 286, 288},
+    {0, 3, 2, 2, 0, 289, 289, 0},
+    {0, 3, 2, 2, 1, 291, 291, 293},
+    {0, 3, 2, 2, 0, 294, 294, 0},
+    {0, 3, 2, 2, 2, 296, 296, 298},
+    {0, 18, 0, 2, 1, 0, 300, 302},
+    {0, 18, 0, 2, 0, 0, 303, 0},
+    {0, 3, 2, 2, 1, 305, 305, 307},
+    {0, 3, 2, 2, 0, 308, 308, 0},
+    {0, 3, 2, 2, 1, 310, 310, 312},
+    {0, 3, 2, 2, 0, 313, 313, 0},
+    {0, 3, 2, 2, 1, 315, 315, 317},
+    {0, 3, 2, 2, 0, 318, 318, 0},
+    {0, 3, 2, 2, 1, 320, 320, 322},
+    {0, 3, 2, 2, 0, 323, 323, 0},
+    {0, 3, 2, 2, 1, 325, 325, 327},
+    {0, 3, 2, 2, 0, 328, 328, 0},
+    {0, 18, 0, 2, 1, 0, 330, 332},
+    {0, 18, 0, 2, 0, 0, 333, 0},
+    {0, 0, 0, 0, 1, 0, 0, 335},
+    {0, 3, 2, 2, 1, 336, 336, 338},
+    {0, 3, 2, 2, 0, 339, 339, 0},
+    {0, 3, 2, 2, 1, 341, 341, 343},
+    {0, 3, 2, 2, 0, 344, 344, 0},
+    {0, 3, 2, 2, 1, 346, 346, 348},
+    {0, 3, 2, 2, 0, 349, 349, 0},
+    {0, 18, 0, 2, 0, 0, 351, 0},
+    {0, 0, 0, 0, 1, 0, 0, 353},
+    {0, 3, 2, 2, 1, 354, 354, 356},
+    {0, 3, 2, 2, 0, 357, 357, 0},
+    {0, 3, 2, 2, 1, 359, 359, 361},
+    {0, 3, 2, 2, 0, 362, 362, 0},
+    {0, 3, 2, 2, 1, 364, 364, 366},
+    {0, 3, 2, 2, 0, 367, 367, 0},
+    {0, 0, 0, 0, 1, 0, 0, 369},
+    {0, 3, 2, 2, 1, 370, 370, 372},
+    {0, 3, 2, 2, 0, 373, 373, 0},
+    {0, 3, 2, 2, 1, 375, 375, 377},
+    {0, 3, 2, 2, 0, 378, 378, 0},
+    {0, 3, 2, 2, 1, 380, 380, 382},
+    {0, 3, 2, 2, 0, 383, 383, 0},
+    {0, 3, 2, 2, 1, 385, 385, 387},
+    {0, 3, 2, 2, 0, 388, 388, 0},
+    {0, 3, 2, 2, 1, 390, 390, 392},
+    {0, 3, 2, 2, 0, 393, 393, 0},
+    {0, 3, 2, 2, 1, 395, 395, 397},
+    {0, 3, 2, 2, 0, 398, 398, 0},
+    {0, 3, 2, 2, 1, 400, 400, 402},
+    {0, 3, 2, 2, 0, 403, 403, 0},
+    {0, 3, 2, 2, 1, 405, 405, 407},
+    {0, 3, 2, 2, 0, 408, 408, 0},
+    {0, 3, 2, 2, 1, 410, 410, 412},
+    {0, 3, 2, 2, 0, 413, 413, 0},
+    {0, 0, 0, 0, 1, 0, 0, 415},
+    {0, 3, 2, 2, 1, 416, 416, 418},
+    {0, 3, 2, 2, 0, 419, 419, 0},
+    {0, 3, 2, 2, 1, 421, 421, 423},
+    {0, 3, 2, 2, 0, 424, 424, 0},
+    {0, 3, 2, 2, 1, 426, 426, 428},
+    {0, 3, 2, 2, 0, 429, 429, 0},
+    {0, 3, 2, 2, 1, 431, 431, 433},
+    {0, 3, 2, 2, 0, 434, 434, 0},
+    {0, 3, 2, 2, 1, 436, 436, 438},
+    {0, 3, 2, 2, 0, 439, 439, 0},
+    {0, 3, 2, 2, 1, 441, 441, 443},
+    {0, 3, 2, 2, 0, 444, 444, 0},
+    {0, 3, 2, 2, 1, 446, 446, 448},
+    {0, 3, 2, 2, 0, 449, 449, 0},
+    {0, 3, 2, 2, 1, 451, 451, 453},
+    {0, 3, 2, 2, 0, 454, 454, 0},
+    {0, 3, 2, 2, 1, 456, 456, 458},
+    {0, 3, 2, 2, 1, 459, 459, 461},
+    {0, 3, 2, 2, 0, 462, 462, 0},
+    {0, 3, 2, 2, 1, 464, 464, 466},
+    {0, 3, 2, 2, 0, 467, 467, 0},
+    {0, 3, 2, 2, 1, 469, 469, 471},
+    {0, 3, 2, 2, 0, 472, 472, 0},
+    {0, 18, 0, 1, 0, 0, 18, 0},
+    {0, 0, 0, 0, 1, 0, 0, 474},
+    {0, 0, 0, 0, 1, 0, 0, 475},
+    {0, 0, 0, 0, 1, 0, 0, 476},
+    {0, 0, 0, 0, 1, 0, 0, 477},
+    {0, 0, 0, 0, 1, 0, 0, 478},
+    {0, 0, 0, 0, 1, 0, 0, 479},
+    {0, 0, 0, 0, 1, 0, 0, 480},
+    {0, 0, 0, 0, 1, 0, 0, 481},
+    {0, 0, 0, 0, 1, 0, 0, 482},
+    {0, 0, 0, 0, 1, 0, 0, 483},
+    {0, 0, 0, 0, 1, 0, 0, 484},
+    {0, 0, 0, 0, 1, 0, 0, 485},
+    {0, 0, 0, 0, 1, 0, 0, 486},
+    {0, 0, 0, 0, 1, 0, 0, 487},
+    {0, 0, 0, 0, 1, 0, 0, 488},
+    {0, 0, 0, 0, 1, 0, 0, 489},
+    {0, 0, 0, 0, 1, 0, 0, 490},
+    {0, 0, 0, 0, 1, 0, 0, 491},
+    {0, 0, 0, 0, 1, 0, 0, 492},
+    {0, 0, 0, 0, 1, 0, 0, 493},
+    {0, 3, 2, 2, 1, 494, 494, 496},
+    {0, 3, 2, 2, 0, 497, 497, 0},
+    {0, 0, 0, 0, 1, 0, 0, 499},
+    {0, 0, 0, 0, 1, 0, 0, 500},
+    {0, 0, 0, 0, 1, 0, 0, 501},
+    {0, 0, 0, 0, 1, 0, 0, 502},
+    {0, 0, 0, 0, 1, 0, 0, 503},
+    {0, 0, 0, 0, 1, 0, 0, 504},
+    {0, 0, 0, 0, 1, 0, 0, 505},
+    {0, 3, 2, 2, 1, 506, 506, 508},
+    {0, 3, 2, 2, 0, 509, 509, 0},
+    {0, 0, 0, 0, 1, 0, 0, 511},
+    {0, 0, 0, 0, 1, 0, 0, 512},
+    {0, 0, 0, 0, 1, 0, 0, 513},
+    {0, 0, 0, 0, 1, 0, 0, 514},
+    {0, 0, 0, 0, 1, 0, 0, 515},
+    {0, 0, 0, 0, 1, 0, 0, 516},
+    {0, 0, 0, 0, 1, 0, 0, 517},
+    {0, 18, 0, 3, 1, 0, 518, 521},
+    {0, 18, 0, 3, 1, 0, 522, 521},
+    {0, 18, 0, 3, 0, 0, 525, 0},
+    {0, 18, 0, 2, 1, 0, 528, 530},
+    {0, 18, 0, 2, 1, 0, 531, 530},
+    {0, 18, 0, 2, 0, 0, 533, 0},
+    {0, 18, 0, 2, 1, 0, 535, 537},
+    {0, 18, 0, 2, 1, 0, 538, 537},
+    {0, 18, 0, 2, 0, 0, 540, 0},
+    {0, 3, 2, 2, 1, 542, 542, 544},
+    {0, 3, 2, 2, 0, 545, 545, 0},
+    {0, 3, 2, 2, 1, 547, 547, 549},
+    {0, 3, 2, 2, 0, 550, 550, 0},
+    {0, 3, 2, 2, 1, 552, 552, 554},
+    {0, 3, 2, 2, 0, 555, 555, 0},
+    {0, 3, 2, 2, 1, 557, 557, 559},
+    {0, 3, 2, 2, 0, 560, 560, 0},
+    {0, 3, 3, 3, 1, 562, 562, 565},
+    {0, 3, 3, 3, 0, 566, 566, 0},
+    {0, 3, 3, 3, 1, 569, 569, 572},
+    {0, 3, 3, 3, 0, 573, 573, 0},
+    {0, 3, 3, 3, 1, 576, 576, 579},
+    {0, 3, 3, 3, 0, 580, 580, 0},
+    {0, 3, 3, 3, 1, 583, 583, 586},
+    {0, 3, 3, 3, 0, 587, 587, 0},
+    {0, 3, 3, 3, 1, 590, 590, 593},
+    {0, 3, 3, 3, 0, 594, 594, 0},
+    {0, 3, 3, 3, 1, 597, 597, 600},
+    {0, 3, 3, 3, 0, 601, 601, 0},
+    {0, 3, 2, 2, 1, 604, 604, 606},
+    {0, 3, 2, 2, 0, 607, 607, 0},
+    {0, 0, 0, 0, 1, 0, 0, 609},
+    {0, 3, 2, 2, 1, 610, 610, 612},
+    {0, 3, 2, 2, 0, 613, 613, 0},
+    {0, 3, 2, 2, 1, 615, 615, 617},
+    {0, 3, 2, 2, 0, 618, 618, 0},
+    {0, 3, 2, 2, 1, 620, 620, 622},
+    {0, 3, 2, 2, 0, 623, 623, 0},
+    {0, 3, 3, 3, 1, 625, 625, 628},
+    {0, 3, 3, 3, 0, 629, 629, 0},
+    {0, 3, 2, 2, 1, 632, 632, 634},
+    {0, 3, 2, 2, 0, 635, 635, 0},
+    {0, 3, 2, 2, 0, 637, 637, 0},
+    {0, 18, 0, 2, 1, 0, 639, 641},
+    {0, 18, 0, 2, 1, 0, 642, 641},
+    {0, 18, 0, 2, 0, 0, 644, 0},
+    {0, 3, 2, 2, 1, 646, 646, 648},
+    {0, 3, 2, 2, 0, 649, 649, 0},
+    {0, 0, 0, 0, 1, 0, 0, 651},
+    {0, 0, 0, 0, 1, 0, 0, 652},
+    {0, 3, 2, 2, 1, 653, 653, 655},
+    {0, 3, 2, 2, 0, 656, 656, 0},
+    {0, 3, 3, 3, 1, 658, 658, 661},
+    {0, 3, 3, 3, 0, 662, 662, 0},
+    {0, 3, 2, 2, 1, 665, 665, 667},
+    {0, 3, 2, 2, 0, 668, 668, 0},
+    {0, 3, 2, 2, 1, 670, 670, 672},
+    {0, 3, 2, 2, 0, 673, 673, 0},
+    {0, 3, 2, 2, 1, 675, 675, 677},
+    {0, 3, 2, 2, 0, 678, 678, 0},
+    {0, 3, 2, 2, 1, 680, 680, 682},
+    {0, 3, 2, 2, 0, 683, 683, 0},
+    {0, 3, 2, 2, 1, 685, 685, 687},
+    {0, 3, 2, 2, 0, 688, 688, 0},
+    {0, 3, 2, 2, 1, 690, 690, 692},
+    {0, 3, 2, 2, 0, 693, 693, 0},
+    {0, 3, 2, 2, 1, 695, 695, 697},
+    {0, 3, 2, 2, 0, 698, 698, 0},
+    {0, 3, 2, 2, 1, 700, 700, 702},
+    {0, 3, 2, 2, 0, 703, 703, 0},
+    {0, 3, 2, 2, 1, 705, 705, 707},
+    {0, 3, 2, 2, 0, 708, 708, 0},
+    {0, 3, 2, 2, 1, 710, 710, 712},
+    {0, 3, 2, 2, 0, 713, 713, 0},
+    {0, 3, 2, 2, 1, 715, 715, 717},
+    {0, 3, 2, 2, 0, 718, 718, 0},
+    {0, 3, 2, 2, 1, 720, 720, 722},
+    {0, 3, 2, 2, 0, 723, 723, 0},
+    {0, 3, 2, 2, 1, 725, 725, 727},
+    {0, 3, 2, 2, 0, 728, 728, 0},
+    {0, 3, 2, 2, 1, 730, 730, 732},
+    {0, 3, 2, 2, 0, 733, 733, 0},
+    {0, 3, 2, 2, 1, 735, 735, 737},
+    {0, 3, 2, 2, 0, 738, 738, 0},
+    {0, 3, 2, 2, 1, 740, 740, 742},
+    {0, 3, 2, 2, 0, 743, 743, 0},
+    {0, 0, 0, 0, 1, 0, 0, 745},
+    {0, 3, 2, 2, 1, 746, 746, 748},
+    {0, 3, 2, 2, 0, 749, 749, 0},
+    {0, 0, 0, 0, 1, 0, 0, 751},
+    {0, 0, 0, 0, 1, 0, 0, 752},
+    {0, 0, 0, 0, 1, 0, 0, 753},
+    {0, 3, 2, 2, 1, 754, 754, 756},
+    {0, 3, 2, 2, 0, 757, 757, 0},
+    {0, 3, 2, 2, 1, 759, 759, 761},
+    {0, 3, 2, 2, 0, 762, 762, 0},
+    {0, 3, 3, 3, 1, 764, 764, 767},
+    {0, 3, 3, 3, 0, 768, 768, 0},
+    {0, 3, 3, 3, 1, 771, 771, 774},
+    {0, 3, 3, 3, 0, 775, 775, 0},
+    {0, 3, 2, 2, 1, 778, 778, 780},
+    {0, 3, 2, 2, 0, 781, 781, 0},
+    {0, 3, 3, 3, 1, 783, 783, 786},
+    {0, 3, 3, 3, 0, 787, 787, 0},
+    {0, 3, 2, 2, 1, 790, 790, 792},
+    {0, 3, 2, 2, 0, 793, 793, 0},
+    {0, 0, 0, 0, 1, 0, 0, 795},
+    {0, 0, 0, 0, 1, 0, 0, 796},
+    {0, 0, 0, 0, 1, 0, 0, 797},
+    {0, 0, 0, 0, 1, 0, 0, 798},
+    {0, 0, 0, 0, 1, 0, 0, 799},
+    {0, 0, 0, 0, 1, 0, 0, 800},
+    {0, 0, 0, 0, 1, 0, 0, 801},
+    {0, 0, 0, 0, 1, 0, 0, 802},
+    {0, 0, 0, 0, 1, 0, 0, 803},
+    {0, 0, 0, 0, 1, 0, 0, 804},
+    {0, 0, 0, 0, 1, 0, 0, 805},
+    {0, 0, 0, 0, 1, 0, 0, 806},
+    {0, 0, 0, 0, 1, 0, 0, 807},
+    {0, 18, 0, 1, 0, 0, 7, 0},
+    {0, 18, 0, 1, 0, 0, 808, 0},
+    {0, 18, 0, 1, 0, 0, 9, 0},
+    {0, 18, 0, 1, 0, 0, 17, 0},
+    {0, 18, 0, 1, 0, 0, 809, 0},
+    {0, 18, 0, 1, 0, 0, 810, 0},
+    {0, 18, 0, 1, 0, 0, 811, 0},
+    {0, 18, 0, 1, 0, 0, 22, 0},
+    {0, 18, 0, 1, 0, 0, 24, 0},
+    {0, 18, 0, 2, 0, 0, 812, 0},
+    {0, 18, 0, 2, 0, 0, 814, 0},
+    {0, 18, 0, 2, 0, 0, 816, 0},
+    {0, 18, 0, 2, 0, 0, 818, 0},
+    {0, 18, 0, 2, 0, 0, 820, 0},
+    {0, 18, 0, 2, 0, 0, 822, 0},
+    {0, 18, 0, 1, 0, 0, 487, 0},
+    {0, 18, 0, 1, 0, 0, 11, 0},
+    {0, 18, 0, 1, 0, 0, 23, 0},
+    {0, 18, 0, 1, 0, 0, 824, 0},
+    {230, 104, 0, 0, 0, 0, 0, 0},
+    {230, 64, 0, 0, 0, 0, 0, 0},
+    {232, 64, 0, 0, 0, 0, 0, 0},
+    {220, 64, 0, 0, 0, 0, 0, 0},
+    {216, 104, 0, 0, 0, 0, 0, 0},
+    {202, 64, 0, 0, 0, 0, 0, 0},
+    {220, 104, 0, 0, 0, 0, 0, 0},
+    {202, 104, 0, 0, 0, 0, 0, 0},
+    {1, 64, 0, 0, 0, 0, 0, 0},
+    {1, 104, 0, 0, 0, 0, 0, 0},
+    {230, 87, 1, 1, 0, 825, 825, 0},
+    {230, 87, 1, 1, 0, 826, 826, 0},
+    {230, 87, 1, 1, 0, 827, 827, 0},
+    {230, 87, 2, 2, 0, 828, 828, 0},
+    {240, 104, 0, 0, 0, 0, 0, 0},
+    {0, 64, 0, 0, 0, 0, 0, 0},
+    {233, 64, 0, 0, 0, 0, 0, 0},
+    {234, 64, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 1, 0, 0, 830},
+    {0, 0, 0, 0, 1, 0, 0, 831},
+    {0, 23, 1, 1, 0, 832, 832, 0},
+    {0, 0, 0, 0, 1, 0, 0, 833},
+    {0, 18, 0, 2, 0, 0, 834, 0},
+    {0, 23, 1, 1, 0, 836, 836, 0},
+    {0, 0, 0, 0, 1, 0, 0, 837},
+    {0, 19, 2, 3, 0, 838, 840, 0},
+    {0, 3, 2, 2, 1, 843, 843, 845},
+    {0, 23, 1, 1, 0, 846, 846, 0},
+    {0, 3, 2, 2, 1, 847, 847, 849},
+    {0, 3, 2, 2, 1, 850, 850, 852},
+    {0, 3, 2, 2, 1, 853, 853, 855},
+    {0, 3, 2, 2, 1, 856, 856, 858},
+    {0, 3, 2, 2, 1, 859, 859, 861},
+    {0, 3, 2, 2, 1, 862, 862, 864},
+    {0, 3, 3, 3, 0, 865, 865, 0},
+    {0, 0, 0, 0, 1, 0, 0, 868},
+    {0, 0, 0, 0, 1, 0, 0, 869},
+    {0, 0, 0, 0, 1, 0, 0, 870},
+    {0, 0, 0, 0, 1, 0, 0, 871},
+    {0, 0, 0, 0, 1, 0, 0, 872},
+    {0, 0, 0, 0, 1, 0, 0, 873},
+    {0, 0, 0, 0, 1, 0, 0, 874},
+    {0, 0, 0, 0, 1, 0, 0, 875},
+    {0, 0, 0, 0, 1, 0, 0, 876},
+    {0, 0, 0, 0, 1, 0, 0, 877},
+    {0, 0, 0, 0, 1, 0, 0, 878},
+    {0, 0, 0, 0, 1, 0, 0, 35},
+    {0, 0, 0, 0, 1, 0, 0, 879},
+    {0, 0, 0, 0, 1, 0, 0, 880},
+    {0, 0, 0, 0, 1, 0, 0, 881},
+    {0, 0, 0, 0, 1, 0, 0, 882},
+    {0, 0, 0, 0, 1, 0, 0, 883},
+    {0, 0, 0, 0, 1, 0, 0, 884},
+    {0, 0, 0, 0, 1, 0, 0, 885},
+    {0, 0, 0, 0, 1, 0, 0, 886},
+    {0, 0, 0, 0, 1, 0, 0, 887},
+    {0, 0, 0, 0, 1, 0, 0, 888},
+    {0, 0, 0, 0, 1, 0, 0, 889},
+    {0, 0, 0, 0, 1, 0, 0, 890},
+    {0, 3, 2, 2, 1, 891, 891, 893},
+    {0, 3, 2, 2, 1, 894, 894, 896},
+    {0, 3, 2, 2, 0, 897, 897, 0},
+    {0, 3, 2, 2, 0, 899, 899, 0},
+    {0, 3, 2, 2, 0, 901, 901, 0},
+    {0, 3, 2, 2, 0, 903, 903, 0},
+    {0, 3, 3, 3, 0, 905, 905, 0},
+    {0, 3, 2, 2, 0, 908, 908, 0},
+    {0, 3, 2, 2, 0, 910, 910, 0},
+    {0, 3, 2, 2, 0, 912, 912, 0},
+    {0, 3, 2, 2, 0, 914, 914, 0},
+    {0, 3, 2, 2, 0, 916, 916, 0},
+    {0, 0, 0, 0, 1, 0, 0, 918},
+    {0, 18, 0, 1, 0, 0, 869, 0},
+    {0, 18, 0, 1, 0, 0, 875, 0},
+    {0, 18, 0, 1, 0, 0, 919, 0},
+    {0, 19, 2, 2, 0, 920, 859, 0},
+    {0, 19, 2, 2, 0, 922, 894, 0},
+    {0, 18, 0, 1, 0, 0, 887, 0},
+    {0, 18, 0, 1, 0, 0, 882, 0},
+    {0, 0, 0, 0, 1, 0, 0, 924},
+    {0, 0, 0, 0, 1, 0, 0, 925},
+    {0, 0, 0, 0, 1, 0, 0, 926},
+    {0, 0, 0, 0, 1, 0, 0, 927},
+    {0, 0, 0, 0, 1, 0, 0, 928},
+    {0, 0, 0, 0, 1, 0, 0, 929},
+    {0, 0, 0, 0, 1, 0, 0, 930},
+    {0, 0, 0, 0, 1, 0, 0, 931},
+    {0, 0, 0, 0, 1, 0, 0, 932},
+    {0, 0, 0, 0, 1, 0, 0, 933},
+    {0, 0, 0, 0, 1, 0, 0, 934},
+    {0, 0, 0, 0, 1, 0, 0, 935},
+    {0, 18, 0, 1, 0, 0, 877, 0},
+    {0, 18, 0, 1, 0, 0, 883, 0},
+    {0, 18, 0, 1, 0, 0, 936, 0},
+    {0, 18, 0, 1, 1, 0, 937, 875},
+    {0, 18, 0, 1, 0, 0, 872, 0},
+    {0, 0, 0, 0, 1, 0, 0, 938},
+    {0, 18, 0, 1, 1, 0, 939, 940},
+    {0, 0, 0, 0, 1, 0, 0, 941},
+    {0, 0, 0, 0, 1, 0, 0, 942},
+    {0, 0, 0, 0, 1, 0, 0, 943},
+    {0, 0, 0, 0, 1, 0, 0, 944},
+    {0, 3, 2, 2, 1, 945, 945, 947},
+    {0, 3, 2, 2, 1, 948, 948, 950},
+    {0, 0, 0, 0, 1, 0, 0, 951},
+    {0, 3, 2, 2, 1, 952, 952, 954},
+    {0, 0, 0, 0, 1, 0, 0, 955},
+    {0, 0, 0, 0, 1, 0, 0, 956},
+    {0, 0, 0, 0, 1, 0, 0, 957},
+    {0, 3, 2, 2, 1, 958, 958, 960},
+    {0, 0, 0, 0, 1, 0, 0, 961},
+    {0, 0, 0, 0, 1, 0, 0, 962},
+    {0, 0, 0, 0, 1, 0, 0, 963},
+    {0, 0, 0, 0, 1, 0, 0, 964},
+    {0, 3, 2, 2, 1, 965, 965, 967},
+    {0, 3, 2, 2, 1, 968, 968, 970},
+    {0, 3, 2, 2, 1, 971, 971, 973},
+    {0, 0, 0, 0, 1, 0, 0, 974},
+    {0, 0, 0, 0, 1, 0, 0, 975},
+    {0, 0, 0, 0, 1, 0, 0, 976},
+    {0, 0, 0, 0, 1, 0, 0, 977},
+    {0, 0, 0, 0, 1, 0, 0, 978},
+    {0, 0, 0, 0, 1, 0, 0, 979},
+    {0, 0, 0, 0, 1, 0, 0, 980},
+    {0, 0, 0, 0, 1, 0, 0, 981},
+    {0, 0, 0, 0, 1, 0, 0, 982},
+    {0, 0, 0, 0, 1, 0, 0, 983},
+    {0, 3, 2, 2, 1, 984, 984, 986},
+    {0, 0, 0, 0, 1, 0, 0, 987},
+    {0, 0, 0, 0, 1, 0, 0, 988},
+    {0, 0, 0, 0, 1, 0, 0, 989},
+    {0, 0, 0, 0, 1, 0, 0, 990},
+    {0, 0, 0, 0, 1, 0, 0, 991},
+    {0, 0, 0, 0, 1, 0, 0, 992},
+    {0, 0, 0, 0, 1, 0, 0, 993},
+    {0, 0, 0, 0, 1, 0, 0, 994},
+    {0, 0, 0, 0, 1, 0, 0, 995},
+    {0, 0, 0, 0, 1, 0, 0, 996},
+    {0, 0, 0, 0, 1, 0, 0, 997},
+    {0, 0, 0, 0, 1, 0, 0, 998},
+    {0, 0, 0, 0, 1, 0, 0, 999},
+    {0, 0, 0, 0, 1, 0, 0, 1000},
+    {0, 0, 0, 0, 1, 0, 0, 1001},
+    {0, 0, 0, 0, 1, 0, 0, 1002},
+    {0, 0, 0, 0, 1, 0, 0, 1003},
+    {0, 0, 0, 0, 1, 0, 0, 1004},
+    {0, 0, 0, 0, 1, 0, 0, 1005},
+    {0, 0, 0, 0, 1, 0, 0, 1006},
+    {0, 0, 0, 0, 1, 0, 0, 1007},
+    {0, 0, 0, 0, 1, 0, 0, 1008},
+    {0, 3, 2, 2, 0, 1009, 1009, 0},
+    {0, 3, 2, 2, 0, 1011, 1011, 0},
+    {0, 3, 2, 2, 0, 1013, 1013, 0},
+    {0, 3, 2, 2, 0, 1015, 1015, 0},
+    {0, 3, 2, 2, 0, 1017, 1017, 0},
+    {0, 3, 2, 2, 0, 1019, 1019, 0},
+    {0, 3, 2, 2, 0, 1021, 1021, 0},
+    {0, 3, 2, 2, 0, 1023, 1023, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1025},
+    {0, 0, 0, 0, 1, 0, 0, 1026},
+    {0, 0, 0, 0, 1, 0, 0, 1027},
+    {0, 0, 0, 0, 1, 0, 0, 1028},
+    {0, 0, 0, 0, 1, 0, 0, 1029},
+    {0, 0, 0, 0, 1, 0, 0, 1030},
+    {0, 0, 0, 0, 1, 0, 0, 1031},
+    {0, 0, 0, 0, 1, 0, 0, 1032},
+    {0, 0, 0, 0, 1, 0, 0, 1033},
+    {0, 0, 0, 0, 1, 0, 0, 1034},
+    {0, 0, 0, 0, 1, 0, 0, 1035},
+    {0, 3, 2, 2, 1, 1036, 1036, 1038},
+    {0, 3, 2, 2, 0, 1039, 1039, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1041},
+    {0, 0, 0, 0, 1, 0, 0, 1042},
+    {0, 0, 0, 0, 1, 0, 0, 1043},
+    {0, 0, 0, 0, 1, 0, 0, 1044},
+    {0, 0, 0, 0, 1, 0, 0, 1045},
+    {0, 0, 0, 0, 1, 0, 0, 1046},
+    {0, 0, 0, 0, 1, 0, 0, 1047},
+    {0, 0, 0, 0, 1, 0, 0, 1048},
+    {0, 0, 0, 0, 1, 0, 0, 1049},
+    {0, 0, 0, 0, 1, 0, 0, 1050},
+    {0, 0, 0, 0, 1, 0, 0, 1051},
+    {0, 0, 0, 0, 1, 0, 0, 1052},
+    {0, 0, 0, 0, 1, 0, 0, 1053},
+    {0, 0, 0, 0, 1, 0, 0, 1054},
+    {0, 0, 0, 0, 1, 0, 0, 1055},
+    {0, 0, 0, 0, 1, 0, 0, 1056},
+    {0, 0, 0, 0, 1, 0, 0, 1057},
+    {0, 0, 0, 0, 1, 0, 0, 1058},
+    {0, 0, 0, 0, 1, 0, 0, 1059},
+    {0, 0, 0, 0, 1, 0, 0, 1060},
+    {0, 0, 0, 0, 1, 0, 0, 1061},
+    {0, 0, 0, 0, 1, 0, 0, 1062},
+    {0, 0, 0, 0, 1, 0, 0, 1063},
+    {0, 0, 0, 0, 1, 0, 0, 1064},
+    {0, 0, 0, 0, 1, 0, 0, 1065},
+    {0, 0, 0, 0, 1, 0, 0, 1066},
+    {0, 0, 0, 0, 1, 0, 0, 1067},
+    {0, 0, 0, 0, 1, 0, 0, 1068},
+    {0, 0, 0, 0, 1, 0, 0, 1069},
+    {0, 0, 0, 0, 1, 0, 0, 1070},
+    {0, 0, 0, 0, 1, 0, 0, 1071},
+    {0, 0, 0, 0, 1, 0, 0, 1072},
+    {0, 0, 0, 0, 1, 0, 0, 1073},
+    {0, 3, 2, 2, 1, 1074, 1074, 1076},
+    {0, 3, 2, 2, 0, 1077, 1077, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1079},
+    {0, 0, 0, 0, 1, 0, 0, 1080},
+    {0, 0, 0, 0, 1, 0, 0, 1081},
+    {0, 0, 0, 0, 1, 0, 0, 1082},
+    {0, 0, 0, 0, 1, 0, 0, 1083},
+    {0, 0, 0, 0, 1, 0, 0, 1084},
+    {0, 3, 2, 2, 1, 1085, 1085, 1087},
+    {0, 3, 2, 2, 0, 1088, 1088, 0},
+    {0, 3, 2, 2, 1, 1090, 1090, 1092},
+    {0, 3, 2, 2, 0, 1093, 1093, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1095},
+    {0, 3, 2, 2, 1, 1096, 1096, 1098},
+    {0, 3, 2, 2, 0, 1099, 1099, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1101},
+    {0, 3, 2, 2, 1, 1102, 1102, 1104},
+    {0, 3, 2, 2, 0, 1105, 1105, 0},
+    {0, 3, 2, 2, 1, 1107, 1107, 1109},
+    {0, 3, 2, 2, 0, 1110, 1110, 0},
+    {0, 3, 2, 2, 1, 1112, 1112, 1114},
+    {0, 3, 2, 2, 0, 1115, 1115, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1117},
+    {0, 3, 2, 2, 1, 1118, 1118, 1120},
+    {0, 3, 2, 2, 0, 1121, 1121, 0},
+    {0, 3, 2, 2, 1, 1123, 1123, 1125},
+    {0, 3, 2, 2, 0, 1126, 1126, 0},
+    {0, 3, 2, 2, 1, 1128, 1128, 1130},
+    {0, 3, 2, 2, 0, 1131, 1131, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1133},
+    {0, 3, 2, 2, 1, 1134, 1134, 1136},
+    {0, 3, 2, 2, 0, 1137, 1137, 0},
+    {0, 3, 2, 2, 1, 1139, 1139, 1141},
+    {0, 3, 2, 2, 0, 1142, 1142, 0},
+    {0, 3, 2, 2, 1, 1144, 1144, 1146},
+    {0, 3, 2, 2, 0, 1147, 1147, 0},
+    {0, 3, 2, 2, 1, 1149, 1149, 1151},
+    {0, 3, 2, 2, 0, 1152, 1152, 0},
+    {0, 3, 2, 2, 1, 1154, 1154, 1156},
+    {0, 3, 2, 2, 0, 1157, 1157, 0},
+    {0, 3, 2, 2, 1, 1159, 1159, 1161},
+    {0, 3, 2, 2, 0, 1162, 1162, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1164},
+    {0, 3, 2, 2, 1, 1165, 1165, 1167},
+    {0, 3, 2, 2, 0, 1168, 1168, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1170},
+    {0, 0, 0, 0, 1, 0, 0, 1171},
+    {0, 0, 0, 0, 1, 0, 0, 1172},
+    {0, 0, 0, 0, 1, 0, 0, 1173},
+    {0, 0, 0, 0, 1, 0, 0, 1174},
+    {0, 0, 0, 0, 1, 0, 0, 1175},
+    {0, 0, 0, 0, 1, 0, 0, 1176},
+    {0, 0, 0, 0, 1, 0, 0, 1177},
+    {0, 0, 0, 0, 1, 0, 0, 1178},
+    {0, 0, 0, 0, 1, 0, 0, 1179},
+    {0, 0, 0, 0, 1, 0, 0, 1180},
+    {0, 0, 0, 0, 1, 0, 0, 1181},
+    {0, 0, 0, 0, 1, 0, 0, 1182},
+    {0, 0, 0, 0, 1, 0, 0, 1183},
+    {0, 0, 0, 0, 1, 0, 0, 1184},
+    {0, 0, 0, 0, 1, 0, 0, 1185},
+    {0, 0, 0, 0, 1, 0, 0, 1186},
+    {0, 0, 0, 0, 1, 0, 0, 1187},
+    {0, 0, 0, 0, 1, 0, 0, 1188},
+    {0, 0, 0, 0, 1, 0, 0, 1189},
+    {0, 0, 0, 0, 1, 0, 0, 1190},
+    {0, 0, 0, 0, 1, 0, 0, 1191},
+    {0, 0, 0, 0, 1, 0, 0, 1192},
+    {0, 0, 0, 0, 1, 0, 0, 1193},
+    {0, 0, 0, 0, 1, 0, 0, 1194},
+    {0, 0, 0, 0, 1, 0, 0, 1195},
+    {0, 0, 0, 0, 1, 0, 0, 1196},
+    {0, 0, 0, 0, 1, 0, 0, 1197},
+    {0, 0, 0, 0, 1, 0, 0, 1198},
+    {0, 0, 0, 0, 1, 0, 0, 1199},
+    {0, 0, 0, 0, 1, 0, 0, 1200},
+    {0, 0, 0, 0, 1, 0, 0, 1201},
+    {0, 0, 0, 0, 1, 0, 0, 1202},
+    {0, 0, 0, 0, 1, 0, 0, 1203},
+    {0, 0, 0, 0, 1, 0, 0, 1204},
+    {0, 0, 0, 0, 1, 0, 0, 1205},
+    {0, 0, 0, 0, 1, 0, 0, 1206},
+    {0, 0, 0, 0, 1, 0, 0, 1207},
+    {0, 0, 0, 0, 1, 0, 0, 1208},
+    {0, 0, 0, 0, 1, 0, 0, 1209},
+    {0, 0, 0, 0, 1, 0, 0, 1210},
+    {0, 0, 0, 0, 1, 0, 0, 1211},
+    {0, 0, 0, 0, 1, 0, 0, 1212},
+    {0, 0, 0, 0, 1, 0, 0, 1213},
+    {0, 0, 0, 0, 1, 0, 0, 1214},
+    {0, 0, 0, 0, 1, 0, 0, 1215},
+    {0, 0, 0, 0, 1, 0, 0, 1216},
+    {0, 0, 0, 0, 1, 0, 0, 1217},
+    {0, 0, 0, 0, 1, 0, 0, 1218},
+    {0, 0, 0, 0, 1, 0, 0, 1219},
+    {0, 0, 0, 0, 1, 0, 0, 1220},
+    {0, 0, 0, 0, 1, 0, 0, 1221},
+    {0, 0, 0, 0, 1, 0, 0, 1222},
+    {0, 0, 0, 0, 1, 0, 0, 1223},
+    {0, 0, 0, 0, 1, 0, 0, 1224},
+    {0, 0, 0, 0, 1, 0, 0, 1225},
+    {0, 0, 0, 0, 1, 0, 0, 1226},
+    {0, 0, 0, 0, 1, 0, 0, 1227},
+    {0, 0, 0, 0, 1, 0, 0, 1228},
+    {0, 0, 0, 0, 1, 0, 0, 1229},
+    {0, 0, 0, 0, 1, 0, 0, 1230},
+    {0, 0, 0, 0, 1, 0, 0, 1231},
+    {0, 0, 0, 0, 1, 0, 0, 1232},
+    {0, 0, 0, 0, 1, 0, 0, 1233},
+    {0, 0, 0, 0, 1, 0, 0, 1234},
+    {0, 18, 0, 2, 0, 0, 1235, 0},
+    {222, 64, 0, 0, 0, 0, 0, 0},
+    {228, 64, 0, 0, 0, 0, 0, 0},
+    {10, 64, 0, 0, 0, 0, 0, 0},
+    {11, 64, 0, 0, 0, 0, 0, 0},
+    {12, 64, 0, 0, 0, 0, 0, 0},
+    {13, 64, 0, 0, 0, 0, 0, 0},
+    {14, 64, 0, 0, 0, 0, 0, 0},
+    {15, 64, 0, 0, 0, 0, 0, 0},
+    {16, 64, 0, 0, 0, 0, 0, 0},
+    {17, 64, 0, 0, 0, 0, 0, 0},
+    {18, 64, 0, 0, 0, 0, 0, 0},
+    {19, 64, 0, 0, 0, 0, 0, 0},
+    {20, 64, 0, 0, 0, 0, 0, 0},
+    {21, 64, 0, 0, 0, 0, 0, 0},
+    {22, 64, 0, 0, 0, 0, 0, 0},
+    {23, 64, 0, 0, 0, 0, 0, 0},
+    {24, 64, 0, 0, 0, 0, 0, 0},
+    {25, 64, 0, 0, 0, 0, 0, 0},
+    {30, 64, 0, 0, 0, 0, 0, 0},
+    {31, 64, 0, 0, 0, 0, 0, 0},
+    {32, 64, 0, 0, 0, 0, 0, 0},
+    {0, 3, 2, 2, 0, 1237, 1237, 0},
+    {0, 3, 2, 2, 0, 1239, 1239, 0},
+    {0, 3, 2, 2, 0, 1241, 1241, 0},
+    {0, 3, 2, 2, 0, 1243, 1243, 0},
+    {0, 3, 2, 2, 0, 1245, 1245, 0},
+    {27, 64, 0, 0, 0, 0, 0, 0},
+    {28, 64, 0, 0, 0, 0, 0, 0},
+    {29, 64, 0, 0, 0, 0, 0, 0},
+    {33, 64, 0, 0, 0, 0, 0, 0},
+    {34, 64, 0, 0, 0, 0, 0, 0},
+    {35, 64, 0, 0, 0, 0, 0, 0},
+    {0, 18, 0, 2, 0, 0, 1247, 0},
+    {0, 18, 0, 2, 0, 0, 1249, 0},
+    {0, 18, 0, 2, 0, 0, 1251, 0},
+    {0, 18, 0, 2, 0, 0, 1253, 0},
+    {0, 3, 2, 2, 0, 1255, 1255, 0},
+    {0, 3, 2, 2, 0, 1257, 1257, 0},
+    {0, 3, 2, 2, 0, 1259, 1259, 0},
+    {36, 64, 0, 0, 0, 0, 0, 0},
+    {0, 3, 2, 2, 0, 1261, 1261, 0},
+    {0, 3, 2, 2, 0, 1263, 1263, 0},
+    {0, 3, 2, 2, 0, 1265, 1265, 0},
+    {7, 104, 0, 0, 0, 0, 0, 0},
+    {9, 64, 0, 0, 0, 0, 0, 0},
+    {0, 23, 2, 2, 0, 1267, 1267, 0},
+    {0, 23, 2, 2, 0, 1269, 1269, 0},
+    {0, 23, 2, 2, 0, 1271, 1271, 0},
+    {0, 23, 2, 2, 0, 1273, 1273, 0},
+    {0, 23, 2, 2, 0, 1275, 1275, 0},
+    {0, 23, 2, 2, 0, 1277, 1277, 0},
+    {0, 23, 2, 2, 0, 1279, 1279, 0},
+    {0, 23, 2, 2, 0, 1281, 1281, 0},
+    {7, 64, 0, 0, 0, 0, 0, 0},
+    {0, 40, 0, 0, 0, 0, 0, 0},
+    {0, 3, 2, 2, 0, 1283, 1283, 0},
+    {0, 3, 2, 2, 0, 1285, 1285, 0},
+    {0, 23, 2, 2, 0, 1287, 1287, 0},
+    {0, 23, 2, 2, 0, 1289, 1289, 0},
+    {0, 23, 2, 2, 0, 1291, 1291, 0},
+    {0, 23, 2, 2, 0, 1293, 1293, 0},
+    {0, 23, 2, 2, 0, 1295, 1295, 0},
+    {0, 23, 2, 2, 0, 1297, 1297, 0},
+    {0, 23, 2, 2, 0, 1299, 1299, 0},
+    {0, 23, 2, 2, 0, 1301, 1301, 0},
+    {0, 23, 2, 2, 0, 1303, 1303, 0},
+    {0, 3, 2, 2, 0, 1305, 1305, 0},
+    {0, 3, 2, 2, 0, 1307, 1307, 0},
+    {0, 3, 2, 2, 0, 1309, 1309, 0},
+    {0, 104, 0, 0, 0, 0, 0, 0},
+    {0, 23, 2, 2, 0, 1311, 1311, 0},
+    {0, 23, 2, 2, 0, 1313, 1313, 0},
+    {0, 3, 2, 2, 0, 1315, 1315, 0},
+    {0, 3, 2, 2, 0, 1317, 1317, 0},
+    {0, 3, 2, 2, 0, 1319, 1319, 0},
+    {0, 3, 2, 2, 0, 1321, 1321, 0},
+    {0, 67, 2, 2, 0, 1323, 1323, 0},
+    {84, 64, 0, 0, 0, 0, 0, 0},
+    {91, 104, 0, 0, 0, 0, 0, 0},
+    {0, 3, 2, 2, 0, 1325, 1325, 0},
+    {0, 3, 2, 2, 0, 1327, 1327, 0},
+    {0, 3, 2, 2, 0, 1329, 1329, 0},
+    {0, 3, 2, 2, 0, 1331, 1331, 0},
+    {0, 3, 3, 3, 0, 1333, 1333, 0},
+    {0, 3, 2, 2, 0, 1336, 1336, 0},
+    {0, 3, 2, 2, 0, 1338, 1338, 0},
+    {0, 3, 2, 2, 0, 1340, 1340, 0},
+    {9, 104, 0, 0, 0, 0, 0, 0},
+    {0, 3, 2, 2, 0, 1342, 1342, 0},
+    {0, 3, 2, 2, 0, 1344, 1344, 0},
+    {0, 3, 3, 3, 0, 1346, 1346, 0},
+    {0, 3, 2, 2, 0, 1349, 1349, 0},
+    {0, 18, 0, 2, 0, 0, 1351, 0},
+    {103, 64, 0, 0, 0, 0, 0, 0},
+    {107, 64, 0, 0, 0, 0, 0, 0},
+    {0, 18, 0, 2, 0, 0, 1353, 0},
+    {118, 64, 0, 0, 0, 0, 0, 0},
+    {122, 64, 0, 0, 0, 0, 0, 0},
+    {0, 18, 0, 2, 0, 0, 1355, 0},
+    {0, 18, 0, 2, 0, 0, 1357, 0},
+    {0, 18, 0, 1, 0, 0, 1359, 0},
+    {216, 64, 0, 0, 0, 0, 0, 0},
+    {0, 23, 2, 2, 0, 1360, 1360, 0},
+    {0, 23, 2, 2, 0, 1362, 1362, 0},
+    {0, 23, 2, 2, 0, 1364, 1364, 0},
+    {0, 23, 2, 2, 0, 1366, 1366, 0},
+    {0, 23, 2, 2, 0, 1368, 1368, 0},
+    {0, 23, 2, 2, 0, 1370, 1370, 0},
+    {129, 64, 0, 0, 0, 0, 0, 0},
+    {130, 64, 0, 0, 0, 0, 0, 0},
+    {0, 87, 2, 2, 0, 1372, 1372, 0},
+    {132, 64, 0, 0, 0, 0, 0, 0},
+    {0, 87, 2, 2, 0, 1374, 1374, 0},
+    {0, 87, 2, 2, 0, 1376, 1376, 0},
+    {0, 82, 0, 3, 0, 0, 1378, 0},
+    {0, 87, 2, 2, 0, 1381, 1381, 0},
+    {0, 82, 0, 3, 0, 0, 1383, 0},
+    {0, 87, 2, 2, 0, 1386, 1386, 0},
+    {0, 87, 2, 2, 0, 1388, 1388, 0},
+    {0, 87, 2, 2, 0, 1390, 1390, 0},
+    {0, 87, 2, 2, 0, 1392, 1392, 0},
+    {0, 87, 2, 2, 0, 1394, 1394, 0},
+    {0, 87, 2, 2, 0, 1396, 1396, 0},
+    {0, 87, 2, 2, 0, 1398, 1398, 0},
+    {0, 3, 2, 2, 0, 1400, 1400, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1402},
+    {0, 0, 0, 0, 1, 0, 0, 1403},
+    {0, 0, 0, 0, 1, 0, 0, 1404},
+    {0, 0, 0, 0, 1, 0, 0, 1405},
+    {0, 0, 0, 0, 1, 0, 0, 1406},
+    {0, 0, 0, 0, 1, 0, 0, 1407},
+    {0, 0, 0, 0, 1, 0, 0, 1408},
+    {0, 0, 0, 0, 1, 0, 0, 1409},
+    {0, 0, 0, 0, 1, 0, 0, 1410},
+    {0, 0, 0, 0, 1, 0, 0, 1411},
+    {0, 0, 0, 0, 1, 0, 0, 1412},
+    {0, 0, 0, 0, 1, 0, 0, 1413},
+    {0, 0, 0, 0, 1, 0, 0, 1414},
+    {0, 0, 0, 0, 1, 0, 0, 1415},
+    {0, 0, 0, 0, 1, 0, 0, 1416},
+    {0, 0, 0, 0, 1, 0, 0, 1417},
+    {0, 0, 0, 0, 1, 0, 0, 1418},
+    {0, 0, 0, 0, 1, 0, 0, 1419},
+    {0, 0, 0, 0, 1, 0, 0, 1420},
+    {0, 0, 0, 0, 1, 0, 0, 1421},
+    {0, 0, 0, 0, 1, 0, 0, 1422},
+    {0, 0, 0, 0, 1, 0, 0, 1423},
+    {0, 0, 0, 0, 1, 0, 0, 1424},
+    {0, 0, 0, 0, 1, 0, 0, 1425},
+    {0, 0, 0, 0, 1, 0, 0, 1426},
+    {0, 0, 0, 0, 1, 0, 0, 1427},
+    {0, 0, 0, 0, 1, 0, 0, 1428},
+    {0, 0, 0, 0, 1, 0, 0, 1429},
+    {0, 0, 0, 0, 1, 0, 0, 1430},
+    {0, 0, 0, 0, 1, 0, 0, 1431},
+    {0, 0, 0, 0, 1, 0, 0, 1432},
+    {0, 0, 0, 0, 1, 0, 0, 1433},
+    {0, 0, 0, 0, 1, 0, 0, 1434},
+    {0, 0, 0, 0, 1, 0, 0, 1435},
+    {0, 0, 0, 0, 1, 0, 0, 1436},
+    {0, 0, 0, 0, 1, 0, 0, 1437},
+    {0, 0, 0, 0, 1, 0, 0, 1438},
+    {0, 0, 0, 0, 1, 0, 0, 1439},
+    {0, 0, 0, 0, 1, 0, 0, 1440},
+    {0, 0, 0, 0, 1, 0, 0, 1441},
+    {0, 18, 0, 1, 0, 0, 1442, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1443},
+    {0, 0, 0, 0, 1, 0, 0, 1444},
+    {0, 0, 0, 0, 1, 0, 0, 1445},
+    {0, 0, 0, 0, 1, 0, 0, 1446},
+    {0, 0, 0, 0, 1, 0, 0, 1447},
+    {0, 0, 0, 0, 1, 0, 0, 1448},
+    {0, 0, 0, 0, 1, 0, 0, 1449},
+    {0, 0, 0, 0, 1, 0, 0, 1450},
+    {0, 0, 0, 0, 1, 0, 0, 1451},
+    {0, 0, 0, 0, 1, 0, 0, 1452},
+    {0, 0, 0, 0, 1, 0, 0, 1453},
+    {0, 0, 0, 0, 1, 0, 0, 1454},
+    {0, 0, 0, 0, 1, 0, 0, 1455},
+    {0, 0, 0, 0, 1, 0, 0, 1456},
+    {0, 0, 0, 0, 1, 0, 0, 1457},
+    {0, 0, 0, 0, 1, 0, 0, 1458},
+    {0, 0, 0, 0, 1, 0, 0, 1459},
+    {0, 0, 0, 0, 1, 0, 0, 1460},
+    {0, 0, 0, 0, 1, 0, 0, 1461},
+    {0, 0, 0, 0, 1, 0, 0, 1462},
+    {0, 0, 0, 0, 1, 0, 0, 1463},
+    {0, 0, 0, 0, 1, 0, 0, 1464},
+    {0, 0, 0, 0, 1, 0, 0, 1465},
+    {0, 0, 0, 0, 1, 0, 0, 1466},
+    {0, 0, 0, 0, 1, 0, 0, 1467},
+    {0, 0, 0, 0, 1, 0, 0, 1468},
+    {0, 0, 0, 0, 1, 0, 0, 1469},
+    {0, 0, 0, 0, 1, 0, 0, 1470},
+    {0, 0, 0, 0, 1, 0, 0, 1471},
+    {0, 0, 0, 0, 1, 0, 0, 1472},
+    {0, 0, 0, 0, 1, 0, 0, 1473},
+    {0, 0, 0, 0, 1, 0, 0, 1474},
+    {0, 0, 0, 0, 1, 0, 0, 1475},
+    {0, 0, 0, 0, 1, 0, 0, 1476},
+    {0, 0, 0, 0, 1, 0, 0, 1477},
+    {0, 0, 0, 0, 1, 0, 0, 1478},
+    {0, 0, 0, 0, 1, 0, 0, 1479},
+    {0, 0, 0, 0, 1, 0, 0, 1480},
+    {0, 0, 0, 0, 1, 0, 0, 1481},
+    {0, 0, 0, 0, 1, 0, 0, 1482},
+    {0, 0, 0, 0, 1, 0, 0, 1483},
+    {0, 0, 0, 0, 1, 0, 0, 1484},
+    {0, 0, 0, 0, 1, 0, 0, 1485},
+    {0, 0, 0, 0, 1, 0, 0, 1486},
+    {0, 0, 0, 0, 1, 0, 0, 1487},
+    {0, 0, 0, 0, 1, 0, 0, 1488},
+    {0, 0, 0, 0, 1, 0, 0, 1489},
+    {0, 0, 0, 0, 1, 0, 0, 1490},
+    {0, 0, 0, 0, 1, 0, 0, 1491},
+    {0, 0, 0, 0, 1, 0, 0, 1492},
+    {0, 0, 0, 0, 1, 0, 0, 1493},
+    {0, 0, 0, 0, 1, 0, 0, 1494},
+    {0, 0, 0, 0, 1, 0, 0, 1495},
+    {0, 0, 0, 0, 1, 0, 0, 1496},
+    {0, 0, 0, 0, 1, 0, 0, 1497},
+    {0, 0, 0, 0, 1, 0, 0, 1498},
+    {0, 0, 0, 0, 1, 0, 0, 1499},
+    {0, 0, 0, 0, 1, 0, 0, 1500},
+    {0, 0, 0, 0, 1, 0, 0, 1501},
+    {0, 0, 0, 0, 1, 0, 0, 1502},
+    {0, 0, 0, 0, 1, 0, 0, 1503},
+    {0, 0, 0, 0, 1, 0, 0, 1504},
+    {0, 0, 0, 0, 1, 0, 0, 1505},
+    {0, 0, 0, 0, 1, 0, 0, 1506},
+    {0, 0, 0, 0, 1, 0, 0, 1507},
+    {0, 0, 0, 0, 1, 0, 0, 1508},
+    {0, 0, 0, 0, 1, 0, 0, 1509},
+    {0, 0, 0, 0, 1, 0, 0, 1510},
+    {0, 0, 0, 0, 1, 0, 0, 1511},
+    {0, 0, 0, 0, 1, 0, 0, 1512},
+    {0, 0, 0, 0, 1, 0, 0, 1513},
+    {0, 0, 0, 0, 1, 0, 0, 1514},
+    {0, 0, 0, 0, 1, 0, 0, 1515},
+    {0, 0, 0, 0, 1, 0, 0, 1516},
+    {0, 0, 0, 0, 1, 0, 0, 1517},
+    {0, 0, 0, 0, 1, 0, 0, 1518},
+    {0, 0, 0, 0, 1, 0, 0, 1519},
+    {0, 0, 0, 0, 1, 0, 0, 1520},
+    {0, 0, 0, 0, 1, 0, 0, 1521},
+    {0, 0, 0, 0, 1, 0, 0, 1522},
+    {0, 0, 0, 0, 1, 0, 0, 1523},
+    {0, 0, 0, 0, 1, 0, 0, 1524},
+    {0, 0, 0, 0, 1, 0, 0, 1525},
+    {0, 0, 0, 0, 1, 0, 0, 1526},
+    {0, 0, 0, 0, 1, 0, 0, 1527},
+    {0, 0, 0, 0, 1, 0, 0, 1528},
+    {9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 3, 2, 2, 0, 1529, 1529, 0},
+    {0, 3, 2, 2, 0, 1531, 1531, 0},
+    {0, 3, 2, 2, 0, 1533, 1533, 0},
+    {0, 3, 2, 2, 0, 1535, 1535, 0},
+    {0, 3, 2, 2, 0, 1537, 1537, 0},
+    {0, 3, 2, 2, 0, 1539, 1539, 0},
+    {0, 3, 2, 2, 0, 1541, 1541, 0},
+    {0, 3, 2, 2, 0, 1543, 1543, 0},
+    {0, 3, 2, 2, 0, 1545, 1545, 0},
+    {0, 3, 2, 2, 0, 1547, 1547, 0},
+    {0, 3, 2, 2, 0, 1549, 1549, 0},
+    {0, 0, 0, 0, 1, 0, 0, 1551},
+    {0, 0, 0, 0, 1, 0, 0, 1552},
+    {0, 0, 0, 0, 1, 0, 0, 1553},
+    {0, 0, 0, 0, 1, 0, 0, 1554},
+    {0, 0, 0, 0, 1, 0, 0, 1555},
+    {0, 0, 0, 0, 1, 0, 0, 1556},
+    {0, 0, 0, 0, 1, 0, 0, 1557},
+    {0, 0, 0, 0, 1, 0, 0, 1558},
+    {0, 0, 0, 0, 1, 0, 0, 1559},
+    {0, 0, 0, 0, 1, 0, 0, 1560},
+    {0, 0, 0, 0, 1, 0, 0, 1561},
+    {0, 0, 0, 0, 1, 0, 0, 1562},
+    {0, 0, 0, 0, 1, 0, 0, 1442},
+    {0, 0, 0, 0, 1, 0, 0, 1563},
+    {0, 0, 0, 0, 1, 0, 0, 1564},
+    {0, 0, 0, 0, 1, 0, 0, 1565},
+    {0, 0, 0, 0, 1, 0, 0, 1566},
+    {0, 0, 0, 0, 1, 0, 0, 1567},
+    {0, 0, 0, 0, 1, 0, 0, 1568},
+    {0, 0, 0, 0, 1, 0, 0, 1569},
+    {0, 0, 0, 0, 1, 0, 0, 1570},
+    {0, 0, 0, 0, 1, 0, 0, 1571},
+    {0, 0, 0, 0, 1, 0, 0, 1572},
+    {0, 0, 0, 0, 1, 0, 0, 1573},
+    {0, 0, 0, 0, 1, 0, 0, 1574},
+    {0, 0, 0, 0, 1, 0, 0, 1575},
+    {0, 0, 0, 0, 1, 0, 0, 1576},
+    {0, 0, 0, 0, 1, 0, 0, 1577},
+    {0, 0, 0, 0, 1, 0, 0, 1578},
+    {0, 0, 0, 0, 1, 0, 0, 1579},
+    {0, 0, 0, 0, 1, 0, 0, 1580},
+    {0, 0, 0, 0, 1, 0, 0, 1581},
+    {0, 0, 0, 0, 1, 0, 0, 1582},
+    {0, 0, 0, 0, 1, 0, 0, 1583},
+    {0, 0, 0, 0, 1, 0, 0, 1584},
+    {0, 0, 0, 0, 1, 0, 0, 1585},
+    {0, 0, 0, 0, 1, 0, 0, 1586},
+    {0, 0, 0, 0, 1, 0, 0, 1587},
+    {0, 0, 0, 0, 1, 0, 0, 1588},
+    {0, 0, 0, 0, 1, 0, 0, 1589},
+    {0, 0, 0, 0, 1, 0, 0, 1590},
+    {0, 0, 0, 0, 1, 0, 0, 1591},
+    {0, 0, 0, 0, 1, 0, 0, 1592},
+    {0, 0, 0, 0, 1, 0, 0, 1593},
+    {0, 0, 0, 0, 1, 0, 0, 1594},
+    {0, 0, 0, 0, 1, 0, 0, 1595},
+    {0, 18, 0, 1, 0, 0, 1596, 0},
+    {0, 18, 0, 1, 0, 0, 1597, 0},
+    {0, 18, 0, 1, 0, 0, 1598, 0},
+    {0, 18, 0, 1, 0, 0, 1599, 0},
+    {0, 18, 0, 1, 0, 0, 1600, 0},
+    {0, 18, 0, 1, 0, 0, 1601, 0},
+    {0, 18, 0, 1, 0, 0, 1602, 0},
+    {0, 18, 0, 1, 0, 0, 1603, 0},
+    {0, 18, 0, 1, 0, 0, 1604, 0},
+    {0, 18, 0, 1, 0, 0, 1605, 0},
+    {0, 18, 0, 1, 0, 0, 1606, 0},
+    {0, 18, 0, 1, 0, 0, 1607, 0},
+    {0, 18, 0, 1, 0, 0, 1608, 0},
+    {0, 18, 0, 1, 0, 0, 1609, 0},
+    {0, 18, 0, 1, 0, 0, 1610, 0},
+    {0, 18, 0, 1, 0, 0, 1611, 0},
+    {0, 18, 0, 1, 0, 0, 1612, 0},
+    {0, 18, 0, 1, 0, 0, 1613, 0},
+    {0, 18, 0, 1, 0, 0, 1614, 0},
+    {0, 18, 0, 1, 0, 0, 1615, 0},
+    {0, 18, 0, 1, 0, 0, 1616, 0},
+    {0, 18, 0, 1, 0, 0, 1617, 0},
+    {0, 18, 0, 1, 0, 0, 1618, 0},
+    {0, 18, 0, 1, 0, 0, 1619, 0},
+    {0, 18, 0, 1, 0, 0, 1, 0},
+    {0, 18, 0, 1, 0, 0, 3, 0},
+    {0, 18, 0, 1, 0, 0, 4, 0},
+    {0, 18, 0, 1, 0, 0, 483, 0},
+    {0, 18, 0, 1, 0, 0, 484, 0},
+    {0, 18, 0, 1, 0, 0, 1620, 0},
+    {0, 18, 0, 1, 0, 0, 6, 0},
+    {0, 18, 0, 1, 0, 0, 10, 0},
+    {0, 18, 0, 1, 0, 0, 12, 0},
+    {0, 18, 0, 1, 0, 0, 353, 0},
+    {0, 18, 0, 1, 0, 0, 477, 0},
+    {0, 18, 0, 1, 0, 0, 1621, 0},
+    {0, 18, 0, 1, 0, 0, 1622, 0},
+    {0, 18, 0, 1, 0, 0, 15, 0},
+    {0, 18, 0, 1, 0, 0, 19, 0},
+    {0, 18, 0, 1, 0, 0, 20, 0},
+    {0, 18, 0, 1, 0, 0, 1623, 0},
+    {0, 18, 0, 1, 0, 0, 491, 0},
+    {0, 18, 0, 1, 0, 0, 21, 0},
+    {0, 18, 0, 1, 0, 0, 1624, 0},
+    {0, 18, 0, 1, 0, 0, 870, 0},
+    {0, 18, 0, 1, 0, 0, 871, 0},
+    {0, 18, 0, 1, 0, 0, 888, 0},
+    {0, 18, 0, 1, 0, 0, 8, 0},
+    {0, 18, 0, 1, 0, 0, 990, 0},
+    {0, 18, 0, 1, 0, 0, 1625, 0},
+    {0, 18, 0, 1, 0, 0, 2, 0},
+    {0, 18, 0, 1, 0, 0, 1626, 0},
+    {0, 18, 0, 1, 0, 0, 94, 0},
+    {0, 18, 0, 1, 0, 0, 5, 0},
+    {0, 18, 0, 1, 0, 0, 1627, 0},
+    {0, 18, 0, 1, 0, 0, 1628, 0},
+    {0, 18, 0, 1, 0, 0, 1629, 0},
+    {0, 18, 0, 1, 0, 0, 489, 0},
+    {0, 18, 0, 1, 0, 0, 488, 0},
+    {0, 18, 0, 1, 0, 0, 1630, 0},
+    {0, 18, 0, 1, 0, 0, 1631, 0},
+    {0, 18, 0, 1, 0, 0, 1632, 0},
+    {0, 18, 0, 1, 0, 0, 1633, 0},
+    {0, 18, 0, 1, 0, 0, 1634, 0},
+    {0, 18, 0, 1, 0, 0, 1635, 0},
+    {0, 18, 0, 1, 0, 0, 1636, 0},
+    {0, 18, 0, 1, 0, 0, 1637, 0},
+    {0, 18, 0, 1, 0, 0, 492, 0},
+    {0, 18, 0, 1, 0, 0, 1638, 0},
+    {0, 18, 0, 1, 0, 0, 1639, 0},
+    {0, 18, 0, 1, 0, 0, 493, 0},
+    {0, 18, 0, 1, 0, 0, 1640, 0},
+    {0, 18, 0, 1, 0, 0, 1641, 0},
+    {0, 18, 0, 1, 0, 0, 503, 0},
+    {0, 18, 0, 1, 0, 0, 1642, 0},
+    {0, 18, 0, 1, 0, 0, 801, 0},
+    {0, 18, 0, 1, 0, 0, 511, 0},
+    {0, 18, 0, 1, 0, 0, 1643, 0},
+    {0, 18, 0, 1, 0, 0, 512, 0},
+    {0, 18, 0, 1, 0, 0, 802, 0},
+    {0, 18, 0, 1, 0, 0, 25, 0},
+    {0, 18, 0, 1, 0, 0, 1644, 0},
+    {0, 18, 0, 1, 0, 0, 1645, 0},
+    {0, 18, 0, 1, 0, 0, 515, 0},
+    {214, 64, 0, 0, 0, 0, 0, 0},
+    {218, 64, 0, 0, 0, 0, 0, 0},
+    {0, 3, 2, 2, 1, 1646, 1646, 1648},
+    {0, 3, 2, 2, 0, 1649, 1649, 0},
+    {0, 3, 2, 2, 1, 1651, 1651, 1653},
+    {0, 3, 2, 2, 0, 1654, 1654, 0},
+    {0, 3, 2, 2, 1, 1656, 1656, 1658},
+    {0, 3, 2, 2, 0, 1659, 1659, 0},
+    {0, 3, 2, 2, 1, 1661, 1661, 1663},
+    {0, 3, 2, 2, 0, 1664, 1664, 0},
+    {0, 3, 3, 3, 1, 1666, 1666, 1669},
+    {0, 3, 3, 3, 0, 1670, 1670, 0},
+    {0, 3, 2, 2, 1, 1673, 1673, 1675},
+    {0, 3, 2, 2, 0, 1676, 1676, 0},
+    {0, 3, 2, 2, 1, 1678, 1678, 1680},
+    {0, 3, 2, 2, 0, 1681, 1681, 0},
+    {0, 3, 2, 2, 1, 1683, 1683, 1685},
+    {0, 3, 2, 2, 0, 1686, 1686, 0},
+    {0, 3, 2, 2, 1, 1688, 1688, 1690},
+    {0, 3, 2, 2, 0, 1691, 1691, 0},
+    {0, 3, 2, 2, 1, 1693, 1693, 1695},
+    {0, 3, 2, 2, 0, 1696, 1696, 0},
+    {0, 3, 3, 3, 1, 1698, 1698, 1701},
+    {0, 3, 3, 3, 0, 1702, 1702, 0},
+    {0, 3, 3, 3, 1, 1705, 1705, 1708},
+    {0, 3, 3, 3, 0, 1709, 1709, 0},
+    {0, 3, 2, 2, 1, 1712, 1712, 1714},
+    {0, 3, 2, 2, 0, 1715, 1715, 0},
+    {0, 3, 2, 2, 1, 1717, 1717, 1719},
+    {0, 3, 2, 2, 0, 1720, 1720, 0},
+    {0, 3, 3, 3, 1, 1722, 1722, 1725},
+    {0, 3, 3, 3, 0, 1726, 1726, 0},
+    {0, 3, 2, 2, 1, 1729, 1729, 1731},
+    {0, 3, 2, 2, 0, 1732, 1732, 0},
+    {0, 3, 2, 2, 1, 1734, 1734, 1736},
+    {0, 3, 2, 2, 0, 1737, 1737, 0},
+    {0, 3, 2, 2, 1, 1739, 1739, 1741},
+    {0, 3, 2, 2, 0, 1742, 1742, 0},
+    {0, 3, 2, 2, 1, 1744, 1744, 1746},
+    {0, 3, 2, 2, 0, 1747, 1747, 0},
+    {0, 3, 2, 2, 1, 1749, 1749, 1751},
+    {0, 3, 2, 2, 0, 1752, 1752, 0},
+    {0, 3, 2, 2, 1, 1754, 1754, 1756},
+    {0, 3, 2, 2, 0, 1757, 1757, 0},
+    {0, 3, 2, 2, 1, 1759, 1759, 1761},
+    {0, 3, 2, 2, 0, 1762, 1762, 0},
+    {0, 3, 2, 2, 1, 1764, 1764, 1766},
+    {0, 3, 2, 2, 0, 1767, 1767, 0},
+    {0, 3, 3, 3, 1, 1769, 1769, 1772},
+    {0, 3, 3, 3, 0, 1773, 1773, 0},
+    {0, 3, 2, 2, 1, 1776, 1776, 1778},
+    {0, 3, 2, 2, 0, 1779, 1779, 0},
+    {0, 3, 2, 2, 1, 1781, 1781, 1783},
+    {0, 3, 2, 2, 0, 1784, 1784, 0},
+    {0, 3, 2, 2, 1, 1786, 1786, 1788},
+    {0, 3, 2, 2, 0, 1789, 1789, 0},
+    {0, 3, 2, 2, 1, 1791, 1791, 1793},
+    {0, 3, 2, 2, 0, 1794, 1794, 0},
+    {0, 3, 3, 3, 1, 1796, 1796, 1799},
+    {0, 3, 3, 3, 0, 1800, 1800, 0},
+    {0, 3, 2, 2, 1, 1803, 1803, 1805},
+    {0, 3, 2, 2, 0, 1806, 1806, 0},
+    {0, 3, 2, 2, 1, 1808, 1808, 1810},
+    {0, 3, 2, 2, 0, 1811, 1811, 0},
+    {0, 3, 2, 2, 1, 1813, 1813, 1815},
+    {0, 3, 2, 2, 0, 1816, 1816, 0},
+    {0, 3, 2, 2, 1, 1818, 1818, 1820},
+    {0, 3, 2, 2, 0, 1821, 1821, 0},
+    {0, 3, 2, 2, 1, 1823, 1823, 1825},
+    {0, 3, 2, 2, 0, 1826, 1826, 0},
+    {0, 3, 2, 2, 1, 1828, 1828, 1830},
+    {0, 3, 2, 2, 0, 1831, 1831, 0},
+    {0, 3, 2, 2, 1, 1833, 1833, 1835},
+    {0, 3, 2, 2, 0, 1836, 1836, 0},
+    {0, 3, 2, 2, 1, 1838, 1838, 1840},
+    {0, 3, 2, 2, 0, 1841, 1841, 0},
+    {0, 3, 2, 2, 1, 1843, 1843, 1845},
+    {0, 3, 2, 2, 0, 1846, 1846, 0},
+    {0, 3, 3, 3, 1, 1848, 1848, 1851},
+    {0, 3, 3, 3, 0, 1852, 1852, 0},
+    {0, 3, 3, 3, 1, 1855, 1855, 1858},
+    {0, 3, 3, 3, 0, 1859, 1859, 0},
+    {0, 3, 3, 3, 1, 1862, 1862, 1865},
+    {0, 3, 3, 3, 0, 1866, 1866, 0},
+    {0, 3, 3, 3, 1, 1869, 1869, 1872},
+    {0, 3, 3, 3, 0, 1873, 1873, 0},
+    {0, 3, 2, 2, 1, 1876, 1876, 1878},
+    {0, 3, 2, 2, 0, 1879, 1879, 0},
+    {0, 3, 2, 2, 1, 1881, 1881, 1883},
+    {0, 3, 2, 2, 0, 1884, 1884, 0},
+    {0, 3, 2, 2, 1, 1886, 1886, 1888},
+    {0, 3, 2, 2, 0, 1889, 1889, 0},
+    {0, 3, 2, 2, 1, 1891, 1891, 1893},
+    {0, 3, 2, 2, 0, 1894, 1894, 0},
+    {0, 3, 3, 3, 1, 1896, 1896, 1899},
+    {0, 3, 3, 3, 0, 1900, 1900, 0},
+    {0, 3, 2, 2, 1, 1903, 1903, 1905},
+    {0, 3, 2, 2, 0, 1906, 1906, 0},
+    {0, 3, 2, 2, 1, 1908, 1908, 1910},
+    {0, 3, 2, 2, 0, 1911, 1911, 0},
+    {0, 3, 2, 2, 1, 1913, 1913, 1915},
+    {0, 3, 2, 2, 0, 1916, 1916, 0},
+    {0, 3, 3, 3, 1, 1918, 1918, 1921},
+    {0, 3, 3, 3, 0, 1922, 1922, 0},
+    {0, 3, 3, 3, 1, 1925, 1925, 1928},
+    {0, 3, 3, 3, 0, 1929, 1929, 0},
+    {0, 3, 3, 3, 1, 1932, 1932, 1935},
+    {0, 3, 3, 3, 0, 1936, 1936, 0},
+    {0, 3, 2, 2, 1, 1939, 1939, 1941},
+    {0, 3, 2, 2, 0, 1942, 1942, 0},
+    {0, 3, 2, 2, 1, 1944, 1944, 1946},
+    {0, 3, 2, 2, 0, 1947, 1947, 0},
+    {0, 3, 2, 2, 1, 1949, 1949, 1951},
+    {0, 3, 2, 2, 0, 1952, 1952, 0},
+    {0, 3, 2, 2, 1, 1954, 1954, 1956},
+    {0, 3, 2, 2, 0, 1957, 1957, 0},
+    {0, 3, 2, 2, 1, 1959, 1959, 1961},
+    {0, 3, 2, 2, 0, 1962, 1962, 0},
+    {0, 3, 2, 2, 1, 1964, 1964, 1966},
+    {0, 3, 2, 2, 0, 1967, 1967, 0},
+    {0, 3, 2, 2, 1, 1969, 1969, 1971},
+    {0, 3, 2, 2, 0, 1972, 1972, 0},
+    {0, 3, 3, 3, 1, 1974, 1974, 1977},
+    {0, 3, 3, 3, 0, 1978, 1978, 0},
+    {0, 3, 3, 3, 1, 1981, 1981, 1984},
+    {0, 3, 3, 3, 0, 1985, 1985, 0},
+    {0, 3, 2, 2, 1, 1988, 1988, 1990},
+    {0, 3, 2, 2, 0, 1991, 1991, 0},
+    {0, 3, 2, 2, 1, 1993, 1993, 1995},
+    {0, 3, 2, 2, 0, 1996, 1996, 0},
+    {0, 3, 2, 2, 1, 1998, 1998, 2000},
+    {0, 3, 2, 2, 0, 2001, 2001, 0},
+    {0, 3, 2, 2, 1, 2003, 2003, 2005},
+    {0, 3, 2, 2, 0, 2006, 2006, 0},
+    {0, 3, 2, 2, 1, 2008, 2008, 2010},
+    {0, 3, 2, 2, 0, 2011, 2011, 0},
+    {0, 3, 2, 2, 1, 2013, 2013, 2015},
+    {0, 3, 2, 2, 0, 2016, 2016, 0},
+    {0, 3, 2, 2, 1, 2018, 2018, 2020},
+    {0, 3, 2, 2, 0, 2021, 2021, 0},
+    {0, 3, 2, 2, 1, 2023, 2023, 2025},
+    {0, 3, 2, 2, 0, 2026, 2026, 0},
+    {0, 3, 2, 2, 1, 2028, 2028, 2030},
+    {0, 3, 2, 2, 0, 2031, 2031, 0},
+    {0, 3, 2, 2, 1, 2033, 2033, 2035},
+    {0, 3, 2, 2, 0, 2036, 2036, 0},
+    {0, 3, 2, 2, 1, 2038, 2038, 2040},
+    {0, 3, 2, 2, 0, 2041, 2041, 0},
+    {0, 3, 2, 2, 1, 2043, 2043, 2045},
+    {0, 3, 2, 2, 0, 2046, 2046, 0},
+    {0, 3, 2, 2, 1, 2048, 2048, 2050},
+    {0, 3, 2, 2, 0, 2051, 2051, 0},
+    {0, 3, 2, 2, 0, 2053, 2053, 0},
+    {0, 3, 2, 2, 0, 2055, 2055, 0},
+    {0, 3, 2, 2, 0, 2057, 2057, 0},
+    {0, 3, 2, 2, 0, 2059, 2059, 0},
+    {0, 18, 0, 2, 0, 0, 2061, 0},
+    {0, 19, 2, 2, 0, 2063, 1911, 0},
+    {0, 0, 0, 0, 1, 0, 0, 2065},
+    {0, 3, 2, 2, 1, 2066, 2066, 2068},
+    {0, 3, 2, 2, 0, 2069, 2069, 0},
+    {0, 3, 2, 2, 1, 2071, 2071, 2073},
+    {0, 3, 2, 2, 0, 2074, 2074, 0},
+    {0, 3, 3, 3, 1, 2076, 2076, 2079},
+    {0, 3, 3, 3, 0, 2080, 2080, 0},
+    {0, 3, 3, 3, 1, 2083, 2083, 2086},
+    {0, 3, 3, 3, 0, 2087, 2087, 0},
+    {0, 3, 3, 3, 1, 2090, 2090, 2093},
+    {0, 3, 3, 3, 0, 2094, 2094, 0},
+    {0, 3, 3, 3, 1, 2097, 2097, 2100},
+    {0, 3, 3, 3, 0, 2101, 2101, 0},
+    {0, 3, 3, 3, 1, 2104, 2104, 2107},
+    {0, 3, 3, 3, 0, 2108, 2108, 0},
+    {0, 3, 3, 3, 1, 2111, 2111, 2114},
+    {0, 3, 3, 3, 0, 2115, 2115, 0},
+    {0, 3, 3, 3, 1, 2118, 2118, 2121},
+    {0, 3, 3, 3, 0, 2122, 2122, 0},
+    {0, 3, 3, 3, 1, 2125, 2125, 2128},
+    {0, 3, 3, 3, 0, 2129, 2129, 0},
+    {0, 3, 3, 3, 1, 2132, 2132, 2135},
+    {0, 3, 3, 3, 0, 2136, 2136, 0},
+    {0, 3, 3, 3, 1, 2139, 2139, 2142},
+    {0, 3, 3, 3, 0, 2143, 2143, 0},
+    {0, 3, 2, 2, 1, 2146, 2146, 2148},
+    {0, 3, 2, 2, 0, 2149, 2149, 0},
+    {0, 3, 2, 2, 1, 2151, 2151, 2153},
+    {0, 3, 2, 2, 0, 2154, 2154, 0},
+    {0, 3, 2, 2, 1, 2156, 2156, 2158},
+    {0, 3, 2, 2, 0, 2159, 2159, 0},
+    {0, 3, 3, 3, 1, 2161, 2161, 2164},
+    {0, 3, 3, 3, 0, 2165, 2165, 0},
+    {0, 3, 3, 3, 1, 2168, 2168, 2171},
+    {0, 3, 3, 3, 0, 2172, 2172, 0},
+    {0, 3, 3, 3, 1, 2175, 2175, 2178},
+    {0, 3, 3, 3, 0, 2179, 2179, 0},
+    {0, 3, 3, 3, 1, 2182, 2182, 2185},
+    {0, 3, 3, 3, 0, 2186, 2186, 0},
+    {0, 3, 3, 3, 1, 2189, 2189, 2192},
+    {0, 3, 3, 3, 0, 2193, 2193, 0},
+    {0, 3, 2, 2, 1, 2196, 2196, 2198},
+    {0, 3, 2, 2, 0, 2199, 2199, 0},
+    {0, 3, 2, 2, 1, 2201, 2201, 2203},
+    {0, 3, 2, 2, 0, 2204, 2204, 0},
+    {0, 3, 2, 2, 1, 2206, 2206, 2208},
+    {0, 3, 2, 2, 0, 2209, 2209, 0},
+    {0, 3, 2, 2, 1, 2211, 2211, 2213},
+    {0, 3, 2, 2, 0, 2214, 2214, 0},
+    {0, 3, 3, 3, 1, 2216, 2216, 2219},
+    {0, 3, 3, 3, 0, 2220, 2220, 0},
+    {0, 3, 3, 3, 1, 2223, 2223, 2226},
+    {0, 3, 3, 3, 0, 2227, 2227, 0},
+    {0, 3, 3, 3, 1, 2230, 2230, 2233},
+    {0, 3, 3, 3, 0, 2234, 2234, 0},
+    {0, 3, 3, 3, 1, 2237, 2237, 2240},
+    {0, 3, 3, 3, 0, 2241, 2241, 0},
+    {0, 3, 3, 3, 1, 2244, 2244, 2247},
+    {0, 3, 3, 3, 0, 2248, 2248, 0},
+    {0, 3, 3, 3, 1, 2251, 2251, 2254},
+    {0, 3, 3, 3, 0, 2255, 2255, 0},
+    {0, 3, 3, 3, 1, 2258, 2258, 2261},
+    {0, 3, 3, 3, 0, 2262, 2262, 0},
+    {0, 3, 3, 3, 1, 2265, 2265, 2268},
+    {0, 3, 3, 3, 0, 2269, 2269, 0},
+    {0, 3, 3, 3, 1, 2272, 2272, 2275},
+    {0, 3, 3, 3, 0, 2276, 2276, 0},
+    {0, 3, 3, 3, 1, 2279, 2279, 2282},
+    {0, 3, 3, 3, 0, 2283, 2283, 0},
+    {0, 3, 2, 2, 1, 2286, 2286, 2288},
+    {0, 3, 2, 2, 0, 2289, 2289, 0},
+    {0, 3, 2, 2, 1, 2291, 2291, 2293},
+    {0, 3, 2, 2, 0, 2294, 2294, 0},
+    {0, 3, 3, 3, 1, 2296, 2296, 2299},
+    {0, 3, 3, 3, 0, 2300, 2300, 0},
+    {0, 3, 3, 3, 1, 2303, 2303, 2306},
+    {0, 3, 3, 3, 0, 2307, 2307, 0},
+    {0, 3, 3, 3, 1, 2310, 2310, 2313},
+    {0, 3, 3, 3, 0, 2314, 2314, 0},
+    {0, 3, 3, 3, 1, 2317, 2317, 2320},
+    {0, 3, 3, 3, 0, 2321, 2321, 0},
+    {0, 3, 3, 3, 1, 2324, 2324, 2327},
+    {0, 3, 3, 3, 0, 2328, 2328, 0},
+    {0, 3, 2, 2, 1, 2331, 2331, 2333},
+    {0, 3, 2, 2, 0, 2334, 2334, 0},
+    {0, 3, 2, 2, 1, 2336, 2336, 2338},
+    {0, 3, 2, 2, 0, 2339, 2339, 0},
+    {0, 3, 2, 2, 1, 2341, 2341, 2343},
+    {0, 3, 2, 2, 0, 2344, 2344, 0},
+    {0, 3, 2, 2, 1, 2346, 2346, 2348},
+    {0, 3, 2, 2, 0, 2349, 2349, 0},
+    {0, 0, 0, 0, 1, 0, 0, 2351},
+    {0, 0, 0, 0, 1, 0, 0, 2352},
+    {0, 0, 0, 0, 1, 0, 0, 2353},
+    {0, 3, 2, 2, 0, 2354, 2354, 0},
+    {0, 3, 2, 2, 0, 2356, 2356, 0},
+    {0, 3, 3, 3, 0, 2358, 2358, 0},
+    {0, 3, 3, 3, 0, 2361, 2361, 0},
+    {0, 3, 3, 3, 0, 2364, 2364, 0},
+    {0, 3, 3, 3, 0, 2367, 2367, 0},
+    {0, 3, 3, 3, 0, 2370, 2370, 0},
+    {0, 3, 3, 3, 0, 2373, 2373, 0},
+    {0, 3, 2, 2, 1, 2376, 2376, 2378},
+    {0, 3, 2, 2, 1, 2379, 2379, 2381},
+    {0, 3, 3, 3, 1, 2382, 2382, 2385},
+    {0, 3, 3, 3, 1, 2386, 2386, 2389},
+    {0, 3, 3, 3, 1, 2390, 2390, 2393},
+    {0, 3, 3, 3, 1, 2394, 2394, 2397},
+    {0, 3, 3, 3, 1, 2398, 2398, 2401},
+    {0, 3, 3, 3, 1, 2402, 2402, 2405},
+    {0, 3, 2, 2, 0, 2406, 2406, 0},
+    {0, 3, 2, 2, 0, 2408, 2408, 0},
+    {0, 3, 3, 3, 0, 2410, 2410, 0},
+    {0, 3, 3, 3, 0, 2413, 2413, 0},
+    {0, 3, 3, 3, 0, 2416, 2416, 0},
+    {0, 3, 3, 3, 0, 2419, 2419, 0},
+    {0, 3, 2, 2, 1, 2422, 2422, 2424},
+    {0, 3, 2, 2, 1, 2425, 2425, 2427},
+    {0, 3, 3, 3, 1, 2428, 2428, 2431},
+    {0, 3, 3, 3, 1, 2432, 2432, 2435},
+    {0, 3, 3, 3, 1, 2436, 2436, 2439},
+    {0, 3, 3, 3, 1, 2440, 2440, 2443},
+    {0, 3, 2, 2, 0, 2444, 2444, 0},
+    {0, 3, 2, 2, 0, 2446, 2446, 0},
+    {0, 3, 3, 3, 0, 2448, 2448, 0},
+    {0, 3, 3, 3, 0, 2451, 2451, 0},
+    {0, 3, 3, 3, 0, 2454, 2454, 0},
+    {0, 3, 3, 3, 0, 2457, 2457, 0},
+    {0, 3, 3, 3, 0, 2460, 2460, 0},
+    {0, 3, 3, 3, 0, 2463, 2463, 0},
+    {0, 3, 2, 2, 1, 2466, 2466, 2468},
+    {0, 3, 2, 2, 1, 2469, 2469, 2471},
+    {0, 3, 3, 3, 1, 2472, 2472, 2475},
+    {0, 3, 3, 3, 1, 2476, 2476, 2479},
+    {0, 3, 3, 3, 1, 2480, 2480, 2483},
+    {0, 3, 3, 3, 1, 2484, 2484, 2487},
+    {0, 3, 3, 3, 1, 2488, 2488, 2491},
+    {0, 3, 3, 3, 1, 2492, 2492, 2495},
+    {0, 3, 2, 2, 0, 2496, 2496, 0},
+    {0, 3, 2, 2, 0, 2498, 2498, 0},
+    {0, 3, 3, 3, 0, 2500, 2500, 0},
+    {0, 3, 3, 3, 0, 2503, 2503, 0},
+    {0, 3, 3, 3, 0, 2506, 2506, 0},
+    {0, 3, 3, 3, 0, 2509, 2509, 0},
+    {0, 3, 3, 3, 0, 2512, 2512, 0},
+    {0, 3, 3, 3, 0, 2515, 2515, 0},
+    {0, 3, 2, 2, 1, 2518, 2518, 2520},
+    {0, 3, 2, 2, 1, 2521, 2521, 2523},
+    {0, 3, 3, 3, 1, 2524, 2524, 2527},
+    {0, 3, 3, 3, 1, 2528, 2528, 2531},
+    {0, 3, 3, 3, 1, 2532, 2532, 2535},
+    {0, 3, 3, 3, 1, 2536, 2536, 2539},
+    {0, 3, 3, 3, 1, 2540, 2540, 2543},
+    {0, 3, 3, 3, 1, 2544, 2544, 2547},
+    {0, 3, 2, 2, 0, 2548, 2548, 0},
+    {0, 3, 2, 2, 0, 2550, 2550, 0},
+    {0, 3, 3, 3, 0, 2552, 2552, 0},
+    {0, 3, 3, 3, 0, 2555, 2555, 0},
+    {0, 3, 3, 3, 0, 2558, 2558, 0},
+    {0, 3, 3, 3, 0, 2561, 2561, 0},
+    {0, 3, 2, 2, 1, 2564, 2564, 2566},
+    {0, 3, 2, 2, 1, 2567, 2567, 2569},
+    {0, 3, 3, 3, 1, 2570, 2570, 2573},
+    {0, 3, 3, 3, 1, 2574, 2574, 2577},
+    {0, 3, 3, 3, 1, 2578, 2578, 2581},
+    {0, 3, 3, 3, 1, 2582, 2582, 2585},
+    {0, 3, 2, 2, 0, 2586, 2586, 0},
+    {0, 3, 2, 2, 0, 2588, 2588, 0},
+    {0, 3, 3, 3, 0, 2590, 2590, 0},
+    {0, 3, 3, 3, 0, 2593, 2593, 0},
+    {0, 3, 3, 3, 0, 2596, 2596, 0},
+    {0, 3, 3, 3, 0, 2599, 2599, 0},
+    {0, 3, 3, 3, 0, 2602, 2602, 0},
+    {0, 3, 3, 3, 0, 2605, 2605, 0},
+    {0, 3, 2, 2, 1, 2608, 2608, 2610},
+    {0, 3, 3, 3, 1, 2611, 2611, 2614},
+    {0, 3, 3, 3, 1, 2615, 2615, 2618},
+    {0, 3, 3, 3, 1, 2619, 2619, 2622},
+    {0, 3, 2, 2, 0, 2623, 2623, 0},
+    {0, 3, 2, 2, 0, 2625, 2625, 0},
+    {0, 3, 3, 3, 0, 2627, 2627, 0},
+    {0, 3, 3, 3, 0, 2630, 2630, 0},
+    {0, 3, 3, 3, 0, 2633, 2633, 0},
+    {0, 3, 3, 3, 0, 2636, 2636, 0},
+    {0, 3, 3, 3, 0, 2639, 2639, 0},
+    {0, 3, 3, 3, 0, 2642, 2642, 0},
+    {0, 3, 2, 2, 1, 2645, 2645, 2647},
+    {0, 3, 2, 2, 1, 2648, 2648, 2650},
+    {0, 3, 3, 3, 1, 2651, 2651, 2654},
+    {0, 3, 3, 3, 1, 2655, 2655, 2658},
+    {0, 3, 3, 3, 1, 2659, 2659, 2662},
+    {0, 3, 3, 3, 1, 2663, 2663, 2666},
+    {0, 3, 3, 3, 1, 2667, 2667, 2670},
+    {0, 3, 3, 3, 1, 2671, 2671, 2674},
+    {0, 3, 2, 2, 0, 2675, 2675, 0},
+    {0, 23, 2, 2, 0, 897, 897, 0},
+    {0, 3, 2, 2, 0, 2677, 2677, 0},
+    {0, 23, 2, 2, 0, 899, 899, 0},
+    {0, 3, 2, 2, 0, 2679, 2679, 0},
+    {0, 23, 2, 2, 0, 901, 901, 0},
+    {0, 3, 2, 2, 0, 2681, 2681, 0},
+    {0, 23, 2, 2, 0, 903, 903, 0},
+    {0, 3, 2, 2, 0, 2683, 2683, 0},
+    {0, 23, 2, 2, 0, 912, 912, 0},
+    {0, 3, 2, 2, 0, 2685, 2685, 0},
+    {0, 23, 2, 2, 0, 914, 914, 0},
+    {0, 3, 2, 2, 0, 2687, 2687, 0},
+    {0, 23, 2, 2, 0, 916, 916, 0},
+    {0, 3, 3, 3, 0, 2689, 2689, 0},
+    {0, 3, 3, 3, 0, 2692, 2692, 0},
+    {0, 3, 4, 4, 0, 2695, 2695, 0},
+    {0, 3, 4, 4, 0, 2699, 2699, 0},
+    {0, 3, 4, 4, 0, 2703, 2703, 0},
+    {0, 3, 4, 4, 0, 2707, 2707, 0},
+    {0, 3, 4, 4, 0, 2711, 2711, 0},
+    {0, 3, 4, 4, 0, 2715, 2715, 0},
+    {0, 3, 3, 3, 1, 2719, 2719, 2722},
+    {0, 3, 3, 3, 1, 2723, 2723, 2726},
+    {0, 3, 4, 4, 1, 2727, 2727, 2731},
+    {0, 3, 4, 4, 1, 2732, 2732, 2736},
+    {0, 3, 4, 4, 1, 2737, 2737, 2741},
+    {0, 3, 4, 4, 1, 2742, 2742, 2746},
+    {0, 3, 4, 4, 1, 2747, 2747, 2751},
+    {0, 3, 4, 4, 1, 2752, 2752, 2756},
+    {0, 3, 3, 3, 0, 2757, 2757, 0},
+    {0, 3, 3, 3, 0, 2760, 2760, 0},
+    {0, 3, 4, 4, 0, 2763, 2763, 0},
+    {0, 3, 4, 4, 0, 2767, 2767, 0},
+    {0, 3, 4, 4, 0, 2771, 2771, 0},
+    {0, 3, 4, 4, 0, 2775, 2775, 0},
+    {0, 3, 4, 4, 0, 2779, 2779, 0},
+    {0, 3, 4, 4, 0, 2783, 2783, 0},
+    {0, 3, 3, 3, 1, 2787, 2787, 2790},
+    {0, 3, 3, 3, 1, 2791, 2791, 2794},
+    {0, 3, 4, 4, 1, 2795, 2795, 2799},
+    {0, 3, 4, 4, 1, 2800, 2800, 2804},
+    {0, 3, 4, 4, 1, 2805, 2805, 2809},
+    {0, 3, 4, 4, 1, 2810, 2810, 2814},
+    {0, 3, 4, 4, 1, 2815, 2815, 2819},
+    {0, 3, 4, 4, 1, 2820, 2820, 2824},
+    {0, 3, 3, 3, 0, 2825, 2825, 0},
+    {0, 3, 3, 3, 0, 2828, 2828, 0},
+    {0, 3, 4, 4, 0, 2831, 2831, 0},
+    {0, 3, 4, 4, 0, 2835, 2835, 0},
+    {0, 3, 4, 4, 0, 2839, 2839, 0},
+    {0, 3, 4, 4, 0, 2843, 2843, 0},
+    {0, 3, 4, 4, 0, 2847, 2847, 0},
+    {0, 3, 4, 4, 0, 2851, 2851, 0},
+    {0, 3, 3, 3, 1, 2855, 2855, 2858},
+    {0, 3, 3, 3, 1, 2859, 2859, 2862},
+    {0, 3, 4, 4, 1, 2863, 2863, 2867},
+    {0, 3, 4, 4, 1, 2868, 2868, 2872},
+    {0, 3, 4, 4, 1, 2873, 2873, 2877},
+    {0, 3, 4, 4, 1, 2878, 2878, 2882},
+    {0, 3, 4, 4, 1, 2883, 2883, 2887},
+    {0, 3, 4, 4, 1, 2888, 2888, 2892},
+    {0, 3, 2, 2, 0, 2893, 2893, 0},
+    {0, 3, 2, 2, 0, 2895, 2895, 0},
+    {0, 3, 3, 3, 0, 2897, 2897, 0},
+    {0, 3, 2, 2, 0, 2900, 2900, 0},
+    {0, 3, 3, 3, 0, 2902, 2902, 0},
+    {0, 3, 2, 2, 0, 2905, 2905, 0},
+    {0, 3, 3, 3, 0, 2907, 2907, 0},
+    {0, 3, 2, 2, 1, 2910, 2910, 2912},
+    {0, 3, 2, 2, 1, 2913, 2913, 2915},
+    {0, 3, 2, 2, 1, 2916, 2916, 2918},
+    {0, 23, 2, 2, 1, 843, 843, 2919},
+    {0, 3, 2, 2, 1, 2920, 2920, 2922},
+    {0, 18, 0, 2, 0, 0, 2923, 0},
+    {0, 23, 1, 1, 0, 876, 876, 0},
+    {0, 18, 0, 2, 0, 0, 2925, 0},
+    {0, 19, 2, 3, 0, 2927, 2929, 0},
+    {0, 3, 3, 3, 0, 2932, 2932, 0},
+    {0, 3, 2, 2, 0, 2935, 2935, 0},
+    {0, 3, 3, 3, 0, 2937, 2937, 0},
+    {0, 3, 2, 2, 0, 2940, 2940, 0},
+    {0, 3, 3, 3, 0, 2942, 2942, 0},
+    {0, 3, 2, 2, 1, 2945, 2945, 2947},
+    {0, 23, 2, 2, 1, 847, 847, 2948},
+    {0, 3, 2, 2, 1, 2949, 2949, 2951},
+    {0, 23, 2, 2, 1, 850, 850, 2952},
+    {0, 3, 2, 2, 1, 2953, 2953, 2955},
+    {0, 19, 2, 3, 0, 2956, 2958, 0},
+    {0, 19, 2, 3, 0, 2961, 2963, 0},
+    {0, 19, 2, 3, 0, 2966, 2968, 0},
+    {0, 3, 2, 2, 0, 2971, 2971, 0},
+    {0, 3, 2, 2, 0, 2973, 2973, 0},
+    {0, 3, 3, 3, 0, 2975, 2975, 0},
+    {0, 23, 3, 3, 0, 865, 865, 0},
+    {0, 3, 2, 2, 0, 2978, 2978, 0},
+    {0, 3, 3, 3, 0, 2980, 2980, 0},
+    {0, 3, 2, 2, 1, 2983, 2983, 2985},
+    {0, 3, 2, 2, 1, 2986, 2986, 2988},
+    {0, 3, 2, 2, 1, 2989, 2989, 2991},
+    {0, 23, 2, 2, 1, 853, 853, 2992},
+    {0, 19, 2, 3, 0, 2993, 2995, 0},
+    {0, 19, 2, 3, 0, 2998, 3000, 0},
+    {0, 19, 2, 3, 0, 3003, 3005, 0},
+    {0, 3, 2, 2, 0, 3008, 3008, 0},
+    {0, 3, 2, 2, 0, 3010, 3010, 0},
+    {0, 3, 3, 3, 0, 3012, 3012, 0},
+    {0, 23, 3, 3, 0, 905, 905, 0},
+    {0, 3, 2, 2, 0, 3015, 3015, 0},
+    {0, 3, 2, 2, 0, 3017, 3017, 0},
+    {0, 3, 2, 2, 0, 3019, 3019, 0},
+    {0, 3, 3, 3, 0, 3021, 3021, 0},
+    {0, 3, 2, 2, 1, 3024, 3024, 3026},
+    {0, 3, 2, 2, 1, 3027, 3027, 3029},
+    {0, 3, 2, 2, 1, 3030, 3030, 3032},
+    {0, 23, 2, 2, 1, 859, 859, 3033},
+    {0, 3, 2, 2, 1, 3034, 3034, 3036},
+    {0, 19, 2, 3, 0, 3037, 3039, 0},
+    {0, 23, 2, 3, 0, 838, 840, 0},
+    {0, 23, 1, 1, 0, 3042, 3042, 0},
+    {0, 3, 3, 3, 0, 3043, 3043, 0},
+    {0, 3, 2, 2, 0, 3046, 3046, 0},
+    {0, 3, 3, 3, 0, 3048, 3048, 0},
+    {0, 3, 2, 2, 0, 3051, 3051, 0},
+    {0, 3, 3, 3, 0, 3053, 3053, 0},
+    {0, 3, 2, 2, 1, 3056, 3056, 3058},
+    {0, 23, 2, 2, 1, 856, 856, 3059},
+    {0, 3, 2, 2, 1, 3060, 3060, 3062},
+    {0, 23, 2, 2, 1, 862, 862, 3063},
+    {0, 3, 2, 2, 1, 3064, 3064, 3066},
+    {0, 23, 1, 2, 0, 3067, 33, 0},
+    {0, 18, 0, 2, 0, 0, 3068, 0},
+    {0, 23, 1, 1, 0, 3070, 26, 0},
+    {0, 23, 1, 1, 0, 3071, 26, 0},
+    {0, 18, 0, 1, 0, 0, 3072, 0},
+    {0, 18, 0, 2, 0, 0, 3073, 0},
+    {0, 18, 0, 1, 0, 0, 3075, 0},
+    {0, 18, 0, 2, 0, 0, 3076, 0},
+    {0, 18, 0, 3, 0, 0, 3078, 0},
+    {0, 18, 0, 2, 0, 0, 3081, 0},
+    {0, 18, 0, 3, 0, 0, 3083, 0},
+    {0, 18, 0, 2, 0, 0, 3086, 0},
+    {0, 18, 0, 3, 0, 0, 3088, 0},
+    {0, 18, 0, 2, 0, 0, 3091, 0},
+    {0, 18, 0, 2, 0, 0, 3093, 0},
+    {0, 18, 0, 2, 0, 0, 3095, 0},
+    {0, 18, 0, 2, 0, 0, 3097, 0},
+    {0, 18, 0, 2, 0, 0, 3099, 0},
+    {0, 18, 0, 4, 0, 0, 3101, 0},
+    {0, 18, 0, 1, 0, 0, 3105, 0},
+    {0, 18, 0, 1, 0, 0, 3106, 0},
+    {0, 18, 0, 1, 0, 0, 3107, 0},
+    {0, 18, 0, 1, 0, 0, 3108, 0},
+    {0, 18, 0, 1, 0, 0, 3109, 0},
+    {0, 18, 0, 1, 0, 0, 3110, 0},
+    {0, 18, 0, 1, 0, 0, 3111, 0},
+    {0, 18, 0, 1, 0, 0, 3112, 0},
+    {0, 18, 0, 1, 0, 0, 3113, 0},
+    {0, 18, 0, 1, 0, 0, 3114, 0},
+    {0, 18, 0, 1, 0, 0, 3115, 0},
+    {0, 18, 0, 1, 0, 0, 3116, 0},
+    {0, 18, 0, 1, 0, 0, 13, 0},
+    {0, 18, 0, 2, 0, 0, 3117, 0},
+    {0, 18, 0, 3, 0, 0, 3119, 0},
+    {0, 18, 0, 3, 0, 0, 3122, 0},
+    {0, 18, 0, 1, 0, 0, 3125, 0},
+    {0, 18, 0, 2, 0, 0, 3126, 0},
+    {0, 18, 0, 3, 0, 0, 3128, 0},
+    {0, 18, 0, 3, 0, 0, 3131, 0},
+    {0, 18, 0, 1, 0, 0, 3134, 0},
+    {0, 18, 0, 2, 0, 0, 3135, 0},
+    {0, 18, 0, 1, 0, 0, 275, 0},
+    {0, 18, 0, 2, 0, 0, 3137, 0},
+    {0, 18, 0, 1, 0, 0, 3139, 0},
+    {0, 18, 0, 2, 0, 0, 3140, 0},
+    {0, 18, 0, 3, 0, 0, 3142, 0},
+    {0, 18, 0, 2, 0, 0, 3145, 0},
+    {0, 18, 0, 1, 0, 0, 3147, 0},
+    {0, 23, 1, 1, 1, 3148, 3148, 890},
+    {0, 23, 1, 1, 1, 1606, 1606, 10},
+    {0, 23, 2, 2, 1, 63, 63, 65},
+    {0, 18, 0, 1, 0, 0, 3149, 0},
+    {0, 0, 0, 0, 1, 0, 0, 3150},
+    {0, 18, 0, 1, 0, 0, 3151, 0},
+    {0, 18, 0, 1, 0, 0, 3152, 0},
+    {0, 18, 0, 1, 0, 0, 3153, 0},
+    {0, 18, 0, 1, 0, 0, 3154, 0},
+    {0, 18, 0, 3, 0, 0, 3155, 0},
+    {0, 18, 0, 1, 0, 0, 3158, 0},
+    {0, 18, 0, 1, 0, 0, 3159, 0},
+    {0, 18, 0, 1, 0, 0, 3160, 0},
+    {0, 18, 0, 3, 0, 0, 3161, 0},
+    {0, 18, 0, 3, 0, 0, 3164, 0},
+    {0, 18, 0, 4, 0, 0, 3167, 0},
+    {0, 18, 0, 3, 0, 0, 3171, 0},
+    {0, 18, 0, 3, 0, 0, 3174, 0},
+    {0, 18, 0, 3, 0, 0, 3177, 0},
+    {0, 18, 0, 3, 0, 0, 3180, 0},
+    {0, 18, 0, 3, 0, 0, 3183, 0},
+    {0, 18, 0, 3, 0, 0, 3186, 0},
+    {0, 18, 0, 3, 0, 0, 3189, 0},
+    {0, 18, 0, 3, 0, 0, 3192, 0},
+    {0, 18, 0, 3, 0, 0, 3195, 0},
+    {0, 18, 0, 3, 0, 0, 3198, 0},
+    {0, 18, 0, 3, 0, 0, 3201, 0},
+    {0, 18, 0, 3, 0, 0, 3204, 0},
+    {0, 18, 0, 2, 0, 0, 3207, 0},
+    {0, 18, 0, 1, 1, 0, 1604, 3209},
+    {0, 18, 0, 2, 1, 0, 3210, 3212},
+    {0, 18, 0, 3, 1, 0, 3213, 3216},
+    {0, 18, 0, 2, 1, 0, 3217, 3219},
+    {0, 18, 0, 1, 1, 0, 3220, 3221},
+    {0, 18, 0, 2, 1, 0, 3222, 3224},
+    {0, 18, 0, 3, 1, 0, 3225, 3228},
+    {0, 18, 0, 4, 1, 0, 3229, 3233},
+    {0, 18, 0, 2, 1, 0, 3234, 3236},
+    {0, 18, 0, 1, 1, 0, 3237, 3238},
+    {0, 18, 0, 2, 1, 0, 3239, 3241},
+    {0, 18, 0, 3, 1, 0, 3242, 3245},
+    {0, 18, 0, 1, 1, 0, 1607, 3246},
+    {0, 18, 0, 1, 1, 0, 3125, 3247},
+    {0, 18, 0, 1, 1, 0, 1599, 3248},
+    {0, 18, 0, 1, 1, 0, 1608, 3249},
+    {0, 18, 0, 2, 0, 0, 3250, 0},
+    {0, 18, 0, 3, 0, 0, 3252, 0},
+    {0, 18, 0, 2, 0, 0, 3255, 0},
+    {0, 18, 0, 2, 0, 0, 3257, 0},
+    {0, 18, 0, 3, 0, 0, 3259, 0},
+    {0, 18, 0, 4, 0, 0, 3262, 0},
+    {0, 18, 0, 2, 0, 0, 3266, 0},
+    {0, 18, 0, 2, 0, 0, 3268, 0},
+    {0, 18, 0, 3, 0, 0, 3270, 0},
+    {0, 0, 0, 0, 1, 0, 0, 3273},
+    {0, 18, 0, 3, 0, 0, 3274, 0},
+    {0, 3, 2, 2, 0, 3277, 3277, 0},
+    {0, 3, 2, 2, 0, 3279, 3279, 0},
+    {0, 3, 2, 2, 0, 3281, 3281, 0},
+    {0, 3, 2, 2, 0, 3283, 3283, 0},
+    {0, 3, 2, 2, 0, 3285, 3285, 0},
+    {0, 3, 2, 2, 0, 3287, 3287, 0},
+    {0, 3, 2, 2, 0, 3289, 3289, 0},
+    {0, 3, 2, 2, 0, 3291, 3291, 0},
+    {0, 3, 2, 2, 0, 3293, 3293, 0},
+    {0, 3, 2, 2, 0, 3295, 3295, 0},
+    {0, 3, 2, 2, 0, 3297, 3297, 0},
+    {0, 18, 0, 2, 0, 0, 3299, 0},
+    {0, 18, 0, 3, 0, 0, 3301, 0},
+    {0, 18, 0, 2, 0, 0, 3304, 0},
+    {0, 18, 0, 3, 0, 0, 3306, 0},
+    {0, 3, 2, 2, 0, 3309, 3309, 0},
+    {0, 3, 2, 2, 0, 3311, 3311, 0},
+    {0, 3, 2, 2, 0, 3313, 3313, 0},
+    {0, 3, 2, 2, 0, 3315, 3315, 0},
+    {0, 3, 2, 2, 0, 3317, 3317, 0},
+    {0, 3, 2, 2, 0, 3319, 3319, 0},
+    {0, 3, 2, 2, 0, 3321, 3321, 0},
+    {0, 3, 2, 2, 0, 3323, 3323, 0},
+    {0, 3, 2, 2, 0, 3325, 3325, 0},
+    {0, 3, 2, 2, 0, 3327, 3327, 0},
+    {0, 3, 2, 2, 0, 3329, 3329, 0},
+    {0, 3, 2, 2, 0, 3331, 3331, 0},
+    {0, 3, 2, 2, 0, 3333, 3333, 0},
+    {0, 3, 2, 2, 0, 3335, 3335, 0},
+    {0, 3, 2, 2, 0, 3337, 3337, 0},
+    {0, 3, 2, 2, 0, 3339, 3339, 0},
+    {0, 3, 2, 2, 0, 3341, 3341, 0},
+    {0, 3, 2, 2, 0, 3343, 3343, 0},
+    {0, 3, 2, 2, 0, 3345, 3345, 0},
+    {0, 3, 2, 2, 0, 3347, 3347, 0},
+    {0, 3, 2, 2, 0, 3349, 3349, 0},
+    {0, 3, 2, 2, 0, 3351, 3351, 0},
+    {0, 3, 2, 2, 0, 3353, 3353, 0},
+    {0, 3, 2, 2, 0, 3355, 3355, 0},
+    {0, 3, 2, 2, 0, 3357, 3357, 0},
+    {0, 3, 2, 2, 0, 3359, 3359, 0},
+    {0, 3, 2, 2, 0, 3361, 3361, 0},
+    {0, 3, 2, 2, 0, 3363, 3363, 0},
+    {0, 3, 2, 2, 0, 3365, 3365, 0},
+    {0, 3, 2, 2, 0, 3367, 3367, 0},
+    {0, 3, 2, 2, 0, 3369, 3369, 0},
+    {0, 3, 2, 2, 0, 3371, 3371, 0},
+    {0, 3, 2, 2, 0, 3373, 3373, 0},
+    {0, 23, 1, 1, 0, 3375, 3375, 0},
+    {0, 23, 1, 1, 0, 3376, 3376, 0},
+    {0, 18, 0, 2, 0, 0, 3377, 0},
+    {0, 18, 0, 2, 0, 0, 3379, 0},
+    {0, 18, 0, 2, 0, 0, 3381, 0},
+    {0, 18, 0, 2, 0, 0, 3383, 0},
+    {0, 18, 0, 2, 0, 0, 3385, 0},
+    {0, 18, 0, 2, 0, 0, 3387, 0},
+    {0, 18, 0, 2, 0, 0, 3389, 0},
+    {0, 18, 0, 2, 0, 0, 3391, 0},
+    {0, 18, 0, 2, 0, 0, 3393, 0},
+    {0, 18, 0, 2, 0, 0, 3395, 0},
+    {0, 18, 0, 2, 0, 0, 3397, 0},
+    {0, 18, 0, 3, 0, 0, 3399, 0},
+    {0, 18, 0, 3, 0, 0, 3402, 0},
+    {0, 18, 0, 3, 0, 0, 3405, 0},
+    {0, 18, 0, 3, 0, 0, 3408, 0},
+    {0, 18, 0, 3, 0, 0, 3411, 0},
+    {0, 18, 0, 3, 0, 0, 3414, 0},
+    {0, 18, 0, 3, 0, 0, 3417, 0},
+    {0, 18, 0, 3, 0, 0, 3420, 0},
+    {0, 18, 0, 3, 0, 0, 3423, 0},
+    {0, 18, 0, 4, 0, 0, 3426, 0},
+    {0, 18, 0, 4, 0, 0, 3430, 0},
+    {0, 18, 0, 4, 0, 0, 3434, 0},
+    {0, 18, 0, 4, 0, 0, 3438, 0},
+    {0, 18, 0, 4, 0, 0, 3442, 0},
+    {0, 18, 0, 4, 0, 0, 3446, 0},
+    {0, 18, 0, 4, 0, 0, 3450, 0},
+    {0, 18, 0, 4, 0, 0, 3454, 0},
+    {0, 18, 0, 4, 0, 0, 3458, 0},
+    {0, 18, 0, 4, 0, 0, 3462, 0},
+    {0, 18, 0, 4, 0, 0, 3466, 0},
+    {0, 18, 0, 2, 0, 0, 3470, 0},
+    {0, 18, 0, 2, 0, 0, 3472, 0},
+    {0, 18, 0, 2, 0, 0, 3474, 0},
+    {0, 18, 0, 2, 0, 0, 3476, 0},
+    {0, 18, 0, 2, 0, 0, 3478, 0},
+    {0, 18, 0, 2, 0, 0, 3480, 0},
+    {0, 18, 0, 2, 0, 0, 3482, 0},
+    {0, 18, 0, 2, 0, 0, 3484, 0},
+    {0, 18, 0, 2, 0, 0, 3486, 0},
+    {0, 18, 0, 3, 0, 0, 3488, 0},
+    {0, 18, 0, 3, 0, 0, 3491, 0},
+    {0, 18, 0, 3, 0, 0, 3494, 0},
+    {0, 18, 0, 3, 0, 0, 3497, 0},
+    {0, 18, 0, 3, 0, 0, 3500, 0},
+    {0, 18, 0, 3, 0, 0, 3503, 0},
+    {0, 18, 0, 3, 0, 0, 3506, 0},
+    {0, 18, 0, 3, 0, 0, 3509, 0},
+    {0, 18, 0, 3, 0, 0, 3512, 0},
+    {0, 18, 0, 3, 0, 0, 3515, 0},
+    {0, 18, 0, 3, 0, 0, 3518, 0},
+    {0, 18, 0, 3, 0, 0, 3521, 0},
+    {0, 18, 0, 3, 0, 0, 3524, 0},
+    {0, 18, 0, 3, 0, 0, 3527, 0},
+    {0, 18, 0, 3, 0, 0, 3530, 0},
+    {0, 18, 0, 3, 0, 0, 3533, 0},
+    {0, 18, 0, 3, 0, 0, 3536, 0},
+    {0, 18, 0, 3, 0, 0, 3539, 0},
+    {0, 18, 0, 3, 0, 0, 3542, 0},
+    {0, 18, 0, 3, 0, 0, 3545, 0},
+    {0, 18, 0, 3, 0, 0, 3548, 0},
+    {0, 18, 0, 3, 0, 0, 3551, 0},
+    {0, 18, 0, 3, 0, 0, 3554, 0},
+    {0, 18, 0, 3, 0, 0, 3557, 0},
+    {0, 18, 0, 3, 0, 0, 3560, 0},
+    {0, 18, 0, 3, 0, 0, 3563, 0},
+    {0, 18, 0, 3, 0, 0, 3566, 0},
+    {0, 18, 0, 3, 0, 0, 3569, 0},
+    {0, 18, 0, 3, 0, 0, 3572, 0},
+    {0, 18, 0, 3, 0, 0, 3575, 0},
+    {0, 18, 0, 3, 0, 0, 3578, 0},
+    {0, 18, 0, 3, 0, 0, 3581, 0},
+    {0, 18, 0, 3, 0, 0, 3584, 0},
+    {0, 18, 0, 3, 0, 0, 3587, 0},
+    {0, 18, 0, 3, 0, 0, 3590, 0},
+    {0, 18, 0, 3, 0, 0, 3593, 0},
+    {0, 18, 0, 3, 0, 0, 3596, 0},
+    {0, 18, 0, 1, 1, 0, 1596, 3599},
+    {0, 18, 0, 1, 1, 0, 1598, 3600},
+    {0, 18, 0, 1, 1, 0, 3125, 3601},
+    {0, 18, 0, 1, 1, 0, 1599, 3602},
+    {0, 18, 0, 1, 1, 0, 1600, 3603},
+    {0, 18, 0, 1, 1, 0, 3149, 3604},
+    {0, 18, 0, 1, 1, 0, 1602, 3605},
+    {0, 18, 0, 1, 1, 0, 1603, 3606},
+    {0, 18, 0, 1, 1, 0, 1604, 3607},
+    {0, 18, 0, 1, 1, 0, 1605, 3608},
+    {0, 18, 0, 1, 1, 0, 1606, 3609},
+    {0, 18, 0, 1, 1, 0, 1607, 3610},
+    {0, 18, 0, 1, 1, 0, 1608, 3611},
+    {0, 18, 0, 1, 1, 0, 1609, 3612},
+    {0, 18, 0, 1, 1, 0, 1610, 3613},
+    {0, 18, 0, 1, 1, 0, 1612, 3614},
+    {0, 18, 0, 1, 1, 0, 3139, 3615},
+    {0, 18, 0, 1, 1, 0, 1613, 3616},
+    {0, 18, 0, 1, 1, 0, 3617, 3618},
+    {0, 18, 0, 1, 1, 0, 1614, 3619},
+    {0, 18, 0, 1, 1, 0, 1615, 3620},
+    {0, 18, 0, 1, 1, 0, 3220, 3621},
+    {0, 18, 0, 1, 1, 0, 1616, 3622},
+    {0, 18, 0, 1, 1, 0, 3237, 3623},
+    {0, 18, 0, 1, 1, 0, 3624, 3625},
+    {0, 18, 0, 1, 1, 0, 3147, 3626},
+    {0, 18, 0, 1, 0, 0, 16, 0},
+    {0, 18, 0, 4, 0, 0, 3627, 0},
+    {0, 18, 0, 3, 0, 0, 3631, 0},
+    {0, 18, 0, 2, 0, 0, 3634, 0},
+    {0, 18, 0, 3, 0, 0, 3636, 0},
+    {0, 23, 2, 2, 0, 3639, 3639, 0},
+    {0, 0, 0, 0, 1, 0, 0, 3641},
+    {0, 0, 0, 0, 1, 0, 0, 3642},
+    {0, 0, 0, 0, 1, 0, 0, 3643},
+    {0, 0, 0, 0, 1, 0, 0, 3644},
+    {0, 0, 0, 0, 1, 0, 0, 3645},
+    {0, 0, 0, 0, 1, 0, 0, 3646},
+    {0, 0, 0, 0, 1, 0, 0, 3647},
+    {0, 0, 0, 0, 1, 0, 0, 3648},
+    {0, 0, 0, 0, 1, 0, 0, 3649},
+    {0, 0, 0, 0, 1, 0, 0, 3650},
+    {0, 0, 0, 0, 1, 0, 0, 3651},
+    {0, 0, 0, 0, 1, 0, 0, 3652},
+    {0, 0, 0, 0, 1, 0, 0, 3653},
+    {0, 0, 0, 0, 1, 0, 0, 3654},
+    {0, 0, 0, 0, 1, 0, 0, 3655},
+    {0, 0, 0, 0, 1, 0, 0, 3656},
+    {0, 0, 0, 0, 1, 0, 0, 3657},
+    {0, 0, 0, 0, 1, 0, 0, 3658},
+    {0, 0, 0, 0, 1, 0, 0, 3659},
+    {0, 0, 0, 0, 1, 0, 0, 3660},
+    {0, 0, 0, 0, 1, 0, 0, 3661},
+    {0, 0, 0, 0, 1, 0, 0, 3662},
+    {0, 0, 0, 0, 1, 0, 0, 3663},
+    {0, 0, 0, 0, 1, 0, 0, 3664},
+    {0, 0, 0, 0, 1, 0, 0, 3665},
+    {0, 0, 0, 0, 1, 0, 0, 3666},
+    {0, 0, 0, 0, 1, 0, 0, 3667},
+    {0, 0, 0, 0, 1, 0, 0, 3668},
+    {0, 0, 0, 0, 1, 0, 0, 3669},
+    {0, 0, 0, 0, 1, 0, 0, 3670},
+    {0, 0, 0, 0, 1, 0, 0, 3671},
+    {0, 0, 0, 0, 1, 0, 0, 3672},
+    {0, 0, 0, 0, 1, 0, 0, 3673},
+    {0, 0, 0, 0, 1, 0, 0, 3674},
+    {0, 0, 0, 0, 1, 0, 0, 3675},
+    {0, 0, 0, 0, 1, 0, 0, 3676},
+    {0, 0, 0, 0, 1, 0, 0, 3677},
+    {0, 0, 0, 0, 1, 0, 0, 3678},
+    {0, 0, 0, 0, 1, 0, 0, 3679},
+    {0, 0, 0, 0, 1, 0, 0, 3680},
+    {0, 0, 0, 0, 1, 0, 0, 3681},
+    {0, 0, 0, 0, 1, 0, 0, 3682},
+    {0, 0, 0, 0, 1, 0, 0, 3683},
+    {0, 0, 0, 0, 1, 0, 0, 3684},
+    {0, 0, 0, 0, 1, 0, 0, 3685},
+    {0, 0, 0, 0, 1, 0, 0, 3686},
+    {0, 0, 0, 0, 1, 0, 0, 3687},
+    {0, 0, 0, 0, 1, 0, 0, 3688},
+    {0, 0, 0, 0, 1, 0, 0, 3689},
+    {0, 0, 0, 0, 1, 0, 0, 3690},
+    {0, 0, 0, 0, 1, 0, 0, 3691},
+    {0, 0, 0, 0, 1, 0, 0, 3692},
+    {0, 0, 0, 0, 1, 0, 0, 3693},
+    {0, 0, 0, 0, 1, 0, 0, 3694},
+    {0, 0, 0, 0, 1, 0, 0, 3695},
+    {0, 0, 0, 0, 1, 0, 0, 1618},
+    {0, 0, 0, 0, 1, 0, 0, 1636},
+    {0, 0, 0, 0, 1, 0, 0, 1617},
+    {0, 0, 0, 0, 1, 0, 0, 1625},
+    {0, 0, 0, 0, 1, 0, 0, 3696},
+    {0, 0, 0, 0, 1, 0, 0, 3697},
+    {0, 18, 0, 1, 0, 0, 3220, 0},
+    {0, 0, 0, 0, 1, 0, 0, 3698},
+    {0, 0, 0, 0, 1, 0, 0, 3699},
+    {0, 0, 0, 0, 1, 0, 0, 3700},
+    {0, 0, 0, 0, 1, 0, 0, 3701},
+    {0, 0, 0, 0, 1, 0, 0, 3702},
+    {0, 0, 0, 0, 1, 0, 0, 3703},
+    {0, 0, 0, 0, 1, 0, 0, 3704},
+    {0, 0, 0, 0, 1, 0, 0, 3705},
+    {0, 0, 0, 0, 1, 0, 0, 3706},
+    {0, 0, 0, 0, 1, 0, 0, 3707},
+    {0, 0, 0, 0, 1, 0, 0, 3708},
+    {0, 0, 0, 0, 1, 0, 0, 3709},
+    {0, 0, 0, 0, 1, 0, 0, 3710},
+    {0, 0, 0, 0, 1, 0, 0, 3711},
+    {0, 0, 0, 0, 1, 0, 0, 3712},
+    {0, 0, 0, 0, 1, 0, 0, 3713},
+    {0, 0, 0, 0, 1, 0, 0, 3714},
+    {0, 0, 0, 0, 1, 0, 0, 3715},
+    {0, 0, 0, 0, 1, 0, 0, 3716},
+    {0, 0, 0, 0, 1, 0, 0, 3717},
+    {0, 0, 0, 0, 1, 0, 0, 3718},
+    {0, 0, 0, 0, 1, 0, 0, 3719},
+    {0, 0, 0, 0, 1, 0, 0, 3720},
+    {0, 0, 0, 0, 1, 0, 0, 3721},
+    {0, 0, 0, 0, 1, 0, 0, 3722},
+    {0, 0, 0, 0, 1, 0, 0, 3723},
+    {0, 0, 0, 0, 1, 0, 0, 3724},
+    {0, 0, 0, 0, 1, 0, 0, 3725},
+    {0, 0, 0, 0, 1, 0, 0, 3726},
+    {0, 0, 0, 0, 1, 0, 0, 3727},
+    {0, 0, 0, 0, 1, 0, 0, 3728},
+    {0, 0, 0, 0, 1, 0, 0, 3729},
+    {0, 0, 0, 0, 1, 0, 0, 3730},
+    {0, 0, 0, 0, 1, 0, 0, 3731},
+    {0, 0, 0, 0, 1, 0, 0, 3732},
+    {0, 0, 0, 0, 1, 0, 0, 3733},
+    {0, 0, 0, 0, 1, 0, 0, 3734},
+    {0, 0, 0, 0, 1, 0, 0, 3735},
+    {0, 0, 0, 0, 1, 0, 0, 3736},
+    {0, 0, 0, 0, 1, 0, 0, 3737},
+    {0, 0, 0, 0, 1, 0, 0, 3738},
+    {0, 0, 0, 0, 1, 0, 0, 3739},
+    {0, 0, 0, 0, 1, 0, 0, 3740},
+    {0, 0, 0, 0, 1, 0, 0, 3741},
+    {0, 0, 0, 0, 1, 0, 0, 3742},
+    {0, 0, 0, 0, 1, 0, 0, 3743},
+    {0, 0, 0, 0, 1, 0, 0, 3744},
+    {0, 0, 0, 0, 1, 0, 0, 3745},
+    {0, 0, 0, 0, 1, 0, 0, 3746},
+    {0, 0, 0, 0, 1, 0, 0, 3747},
+    {0, 0, 0, 0, 1, 0, 0, 3748},
+    {0, 0, 0, 0, 1, 0, 0, 3749},
+    {0, 0, 0, 0, 1, 0, 0, 3750},
+    {0, 0, 0, 0, 1, 0, 0, 3751},
+    {0, 0, 0, 0, 1, 0, 0, 3752},
+    {0, 18, 0, 1, 0, 0, 3753, 0},
+    {0, 18, 0, 1, 0, 0, 3754, 0},
+    {0, 18, 0, 1, 0, 0, 3755, 0},
+    {0, 18, 0, 1, 0, 0, 3756, 0},
+    {0, 18, 0, 1, 0, 0, 3757, 0},
+    {0, 18, 0, 1, 0, 0, 3758, 0},
+    {0, 18, 0, 1, 0, 0, 3759, 0},
+    {0, 18, 0, 1, 0, 0, 3760, 0},
+    {0, 18, 0, 1, 0, 0, 3761, 0},
+    {0, 18, 0, 1, 0, 0, 3762, 0},
+    {0, 18, 0, 1, 0, 0, 3763, 0},
+    {0, 18, 0, 1, 0, 0, 3764, 0},
+    {0, 18, 0, 1, 0, 0, 3765, 0},
+    {0, 18, 0, 1, 0, 0, 3766, 0},
+    {0, 18, 0, 1, 0, 0, 3767, 0},
+    {0, 18, 0, 1, 0, 0, 3768, 0},
+    {0, 18, 0, 1, 0, 0, 3769, 0},
+    {0, 18, 0, 1, 0, 0, 3770, 0},
+    {0, 18, 0, 1, 0, 0, 3771, 0},
+    {0, 18, 0, 1, 0, 0, 3772, 0},
+    {0, 18, 0, 1, 0, 0, 3773, 0},
+    {0, 18, 0, 1, 0, 0, 3774, 0},
+    {0, 18, 0, 1, 0, 0, 3775, 0},
+    {0, 18, 0, 1, 0, 0, 3776, 0},
+    {0, 18, 0, 1, 0, 0, 3777, 0},
+    {0, 18, 0, 1, 0, 0, 3778, 0},
+    {0, 18, 0, 1, 0, 0, 3779, 0},
+    {0, 18, 0, 1, 0, 0, 3780, 0},
+    {0, 18, 0, 1, 0, 0, 3781, 0},
+    {0, 18, 0, 1, 0, 0, 3782, 0},
+    {0, 18, 0, 1, 0, 0, 3783, 0},
+    {0, 18, 0, 1, 0, 0, 3784, 0},
+    {0, 18, 0, 1, 0, 0, 3785, 0},
+    {0, 18, 0, 1, 0, 0, 3786, 0},
+    {0, 18, 0, 1, 0, 0, 3787, 0},
+    {0, 18, 0, 1, 0, 0, 3788, 0},
+    {0, 18, 0, 1, 0, 0, 3789, 0},
+    {0, 18, 0, 1, 0, 0, 3790, 0},
+    {0, 18, 0, 1, 0, 0, 3791, 0},
+    {0, 18, 0, 1, 0, 0, 3792, 0},
+    {0, 18, 0, 1, 0, 0, 3793, 0},
+    {0, 18, 0, 1, 0, 0, 3794, 0},
+    {0, 18, 0, 1, 0, 0, 3795, 0},
+    {0, 18, 0, 1, 0, 0, 3796, 0},
+    {0, 18, 0, 1, 0, 0, 3797, 0},
+    {0, 18, 0, 1, 0, 0, 3798, 0},
+    {0, 18, 0, 1, 0, 0, 3799, 0},
+    {0, 18, 0, 1, 0, 0, 3800, 0},
+    {0, 18, 0, 1, 0, 0, 3801, 0},
+    {0, 18, 0, 1, 0, 0, 3802, 0},
+    {0, 18, 0, 1, 0, 0, 3803, 0},
+    {0, 18, 0, 1, 0, 0, 3804, 0},
+    {0, 18, 0, 1, 0, 0, 3805, 0},
+    {0, 18, 0, 1, 0, 0, 3806, 0},
+    {0, 18, 0, 1, 0, 0, 3807, 0},
+    {0, 18, 0, 1, 0, 0, 3808, 0},
+    {0, 18, 0, 1, 0, 0, 3809, 0},
+    {0, 18, 0, 1, 0, 0, 3810, 0},
+    {0, 18, 0, 1, 0, 0, 3811, 0},
+    {0, 18, 0, 1, 0, 0, 3812, 0},
+    {0, 18, 0, 1, 0, 0, 3813, 0},
+    {0, 18, 0, 1, 0, 0, 3814, 0},
+    {0, 18, 0, 1, 0, 0, 3815, 0},
+    {0, 18, 0, 1, 0, 0, 3816, 0},
+    {0, 18, 0, 1, 0, 0, 3817, 0},
+    {0, 18, 0, 1, 0, 0, 3818, 0},
+    {0, 18, 0, 1, 0, 0, 3819, 0},
+    {0, 18, 0, 1, 0, 0, 3820, 0},
+    {0, 18, 0, 1, 0, 0, 3821, 0},
+    {0, 18, 0, 1, 0, 0, 3822, 0},
+    {0, 18, 0, 1, 0, 0, 3823, 0},
+    {0, 18, 0, 1, 0, 0, 3824, 0},
+    {0, 18, 0, 1, 0, 0, 3825, 0},
+    {0, 18, 0, 1, 0, 0, 3826, 0},
+    {0, 18, 0, 1, 0, 0, 3827, 0},
+    {0, 18, 0, 1, 0, 0, 3828, 0},
+    {0, 18, 0, 1, 0, 0, 3829, 0},
+    {0, 18, 0, 1, 0, 0, 3830, 0},
+    {0, 18, 0, 1, 0, 0, 3831, 0},
+    {0, 18, 0, 1, 0, 0, 3832, 0},
+    {0, 18, 0, 1, 0, 0, 3833, 0},
+    {0, 18, 0, 1, 0, 0, 3834, 0},
+    {0, 18, 0, 1, 0, 0, 3835, 0},
+    {0, 18, 0, 1, 0, 0, 3836, 0},
+    {0, 18, 0, 1, 0, 0, 3837, 0},
+    {0, 18, 0, 1, 0, 0, 3838, 0},
+    {0, 18, 0, 1, 0, 0, 3839, 0},
+    {0, 18, 0, 1, 0, 0, 3840, 0},
+    {0, 18, 0, 1, 0, 0, 3841, 0},
+    {0, 18, 0, 1, 0, 0, 3842, 0},
+    {0, 18, 0, 1, 0, 0, 3843, 0},
+    {0, 18, 0, 1, 0, 0, 3844, 0},
+    {0, 18, 0, 1, 0, 0, 3845, 0},
+    {0, 18, 0, 1, 0, 0, 3846, 0},
+    {0, 18, 0, 1, 0, 0, 3847, 0},
+    {0, 18, 0, 1, 0, 0, 3848, 0},
+    {0, 18, 0, 1, 0, 0, 3849, 0},
+    {0, 18, 0, 1, 0, 0, 3850, 0},
+    {0, 18, 0, 1, 0, 0, 3851, 0},
+    {0, 18, 0, 1, 0, 0, 3852, 0},
+    {0, 18, 0, 1, 0, 0, 3853, 0},
+    {0, 18, 0, 1, 0, 0, 3854, 0},
+    {0, 18, 0, 1, 0, 0, 3855, 0},
+    {0, 18, 0, 1, 0, 0, 3856, 0},
+    {0, 18, 0, 1, 0, 0, 3857, 0},
+    {0, 18, 0, 1, 0, 0, 3858, 0},
+    {0, 18, 0, 1, 0, 0, 3859, 0},
+    {0, 18, 0, 1, 0, 0, 3860, 0},
+    {0, 18, 0, 1, 0, 0, 3861, 0},
+    {0, 18, 0, 1, 0, 0, 3862, 0},
+    {0, 18, 0, 1, 0, 0, 3863, 0},
+    {0, 18, 0, 1, 0, 0, 3864, 0},
+    {0, 18, 0, 1, 0, 0, 3865, 0},
+    {0, 18, 0, 1, 0, 0, 3866, 0},
+    {0, 18, 0, 1, 0, 0, 3867, 0},
+    {0, 18, 0, 1, 0, 0, 3868, 0},
+    {0, 18, 0, 1, 0, 0, 3869, 0},
+    {0, 18, 0, 1, 0, 0, 3870, 0},
+    {0, 18, 0, 1, 0, 0, 3871, 0},
+    {0, 18, 0, 1, 0, 0, 3872, 0},
+    {0, 18, 0, 1, 0, 0, 3873, 0},
+    {0, 18, 0, 1, 0, 0, 3874, 0},
+    {0, 18, 0, 1, 0, 0, 3875, 0},
+    {0, 18, 0, 1, 0, 0, 3876, 0},
+    {0, 18, 0, 1, 0, 0, 3877, 0},
+    {0, 18, 0, 1, 0, 0, 3878, 0},
+    {0, 18, 0, 1, 0, 0, 3879, 0},
+    {0, 18, 0, 1, 0, 0, 3880, 0},
+    {0, 18, 0, 1, 0, 0, 3881, 0},
+    {0, 18, 0, 1, 0, 0, 3882, 0},
+    {0, 18, 0, 1, 0, 0, 3883, 0},
+    {0, 18, 0, 1, 0, 0, 3884, 0},
+    {0, 18, 0, 1, 0, 0, 3885, 0},
+    {0, 18, 0, 1, 0, 0, 3886, 0},
+    {0, 18, 0, 1, 0, 0, 3887, 0},
+    {0, 18, 0, 1, 0, 0, 3888, 0},
+    {0, 18, 0, 1, 0, 0, 3889, 0},
+    {0, 18, 0, 1, 0, 0, 3890, 0},
+    {0, 18, 0, 1, 0, 0, 3891, 0},
+    {0, 18, 0, 1, 0, 0, 3892, 0},
+    {0, 18, 0, 1, 0, 0, 3893, 0},
+    {0, 18, 0, 1, 0, 0, 3894, 0},
+    {0, 18, 0, 1, 0, 0, 3895, 0},
+    {0, 18, 0, 1, 0, 0, 3896, 0},
+    {0, 18, 0, 1, 0, 0, 3897, 0},
+    {0, 18, 0, 1, 0, 0, 3898, 0},
+    {0, 18, 0, 1, 0, 0, 3899, 0},
+    {0, 18, 0, 1, 0, 0, 3900, 0},
+    {0, 18, 0, 1, 0, 0, 3901, 0},
+    {0, 18, 0, 1, 0, 0, 3902, 0},
+    {0, 18, 0, 1, 0, 0, 3903, 0},
+    {0, 18, 0, 1, 0, 0, 3904, 0},
+    {0, 18, 0, 1, 0, 0, 3905, 0},
+    {0, 18, 0, 1, 0, 0, 3906, 0},
+    {0, 18, 0, 1, 0, 0, 3907, 0},
+    {0, 18, 0, 1, 0, 0, 3908, 0},
+    {0, 18, 0, 1, 0, 0, 3909, 0},
+    {0, 18, 0, 1, 0, 0, 3910, 0},
+    {0, 18, 0, 1, 0, 0, 3911, 0},
+    {0, 18, 0, 1, 0, 0, 3912, 0},
+    {0, 18, 0, 1, 0, 0, 3913, 0},
+    {0, 18, 0, 1, 0, 0, 3914, 0},
+    {0, 18, 0, 1, 0, 0, 3915, 0},
+    {0, 18, 0, 1, 0, 0, 3916, 0},
+    {0, 18, 0, 1, 0, 0, 3917, 0},
+    {0, 18, 0, 1, 0, 0, 3918, 0},
+    {0, 18, 0, 1, 0, 0, 3919, 0},
+    {0, 18, 0, 1, 0, 0, 3920, 0},
+    {0, 18, 0, 1, 0, 0, 3921, 0},
+    {0, 18, 0, 1, 0, 0, 3922, 0},
+    {0, 18, 0, 1, 0, 0, 3923, 0},
+    {0, 18, 0, 1, 0, 0, 3924, 0},
+    {0, 18, 0, 1, 0, 0, 3925, 0},
+    {0, 18, 0, 1, 0, 0, 3926, 0},
+    {0, 18, 0, 1, 0, 0, 3927, 0},
+    {0, 18, 0, 1, 0, 0, 3928, 0},
+    {0, 18, 0, 1, 0, 0, 3929, 0},
+    {0, 18, 0, 1, 0, 0, 3930, 0},
+    {0, 18, 0, 1, 0, 0, 3931, 0},
+    {0, 18, 0, 1, 0, 0, 3932, 0},
+    {0, 18, 0, 1, 0, 0, 3933, 0},
+    {0, 18, 0, 1, 0, 0, 3934, 0},
+    {0, 18, 0, 1, 0, 0, 3935, 0},
+    {0, 18, 0, 1, 0, 0, 3936, 0},
+    {0, 18, 0, 1, 0, 0, 3937, 0},
+    {0, 18, 0, 1, 0, 0, 3938, 0},
+    {0, 18, 0, 1, 0, 0, 3939, 0},
+    {0, 18, 0, 1, 0, 0, 3940, 0},
+    {0, 18, 0, 1, 0, 0, 3941, 0},
+    {0, 18, 0, 1, 0, 0, 3942, 0},
+    {0, 18, 0, 1, 0, 0, 3943, 0},
+    {0, 18, 0, 1, 0, 0, 3944, 0},
+    {0, 18, 0, 1, 0, 0, 3945, 0},
+    {0, 18, 0, 1, 0, 0, 3946, 0},
+    {0, 18, 0, 1, 0, 0, 3947, 0},
+    {0, 18, 0, 1, 0, 0, 3948, 0},
+    {0, 18, 0, 1, 0, 0, 3949, 0},
+    {0, 18, 0, 1, 0, 0, 3950, 0},
+    {0, 18, 0, 1, 0, 0, 3951, 0},
+    {0, 18, 0, 1, 0, 0, 3952, 0},
+    {0, 18, 0, 1, 0, 0, 3953, 0},
+    {0, 18, 0, 1, 0, 0, 3954, 0},
+    {0, 18, 0, 1, 0, 0, 3955, 0},
+    {0, 18, 0, 1, 0, 0, 3956, 0},
+    {0, 18, 0, 1, 0, 0, 3957, 0},
+    {0, 18, 0, 1, 0, 0, 3958, 0},
+    {0, 18, 0, 1, 0, 0, 3959, 0},
+    {0, 18, 0, 1, 0, 0, 3960, 0},
+    {0, 18, 0, 1, 0, 0, 3961, 0},
+    {0, 18, 0, 1, 0, 0, 3962, 0},
+    {0, 18, 0, 1, 0, 0, 3963, 0},
+    {0, 18, 0, 1, 0, 0, 3964, 0},
+    {0, 18, 0, 1, 0, 0, 3965, 0},
+    {0, 18, 0, 1, 0, 0, 3966, 0},
+    {0, 18, 0, 1, 0, 0, 3967, 0},
+    {0, 18, 0, 1, 0, 0, 3968, 0},
+    {0, 18, 0, 1, 0, 0, 3969, 0},
+    {224, 0, 0, 0, 0, 0, 0, 0},
+    {0, 18, 0, 1, 0, 0, 3970, 0},
+    {0, 18, 0, 1, 0, 0, 3971, 0},
+    {0, 18, 0, 1, 0, 0, 3972, 0},
+    {0, 3, 2, 2, 0, 3973, 3973, 0},
+    {0, 3, 2, 2, 0, 3975, 3975, 0},
+    {0, 3, 2, 2, 0, 3977, 3977, 0},
+    {0, 3, 2, 2, 0, 3979, 3979, 0},
+    {0, 3, 2, 2, 0, 3981, 3981, 0},
+    {0, 3, 2, 2, 0, 3983, 3983, 0},
+    {0, 3, 2, 2, 0, 3985, 3985, 0},
+    {0, 3, 2, 2, 0, 3987, 3987, 0},
+    {0, 3, 2, 2, 0, 3989, 3989, 0},
+    {0, 3, 2, 2, 0, 3991, 3991, 0},
+    {0, 3, 2, 2, 0, 3993, 3993, 0},
+    {0, 3, 2, 2, 0, 3995, 3995, 0},
+    {0, 3, 2, 2, 0, 3997, 3997, 0},
+    {0, 3, 2, 2, 0, 3999, 3999, 0},
+    {0, 3, 2, 2, 0, 4001, 4001, 0},
+    {0, 3, 2, 2, 0, 4003, 4003, 0},
+    {0, 3, 2, 2, 0, 4005, 4005, 0},
+    {0, 3, 2, 2, 0, 4007, 4007, 0},
+    {0, 3, 2, 2, 0, 4009, 4009, 0},
+    {0, 3, 2, 2, 0, 4011, 4011, 0},
+    {0, 3, 2, 2, 0, 4013, 4013, 0},
+    {0, 3, 2, 2, 0, 4015, 4015, 0},
+    {0, 3, 2, 2, 0, 4017, 4017, 0},
+    {0, 3, 2, 2, 0, 4019, 4019, 0},
+    {0, 3, 2, 2, 0, 4021, 4021, 0},
+    {0, 3, 2, 2, 0, 4023, 4023, 0},
+    {8, 104, 0, 0, 0, 0, 0, 0},
+    {0, 18, 0, 2, 0, 0, 4025, 0},
+    {0, 18, 0, 2, 0, 0, 4027, 0},
+    {0, 3, 2, 2, 0, 4029, 4029, 0},
+    {0, 18, 0, 2, 0, 0, 4031, 0},
+    {0, 3, 2, 2, 0, 4033, 4033, 0},
+    {0, 3, 2, 2, 0, 4035, 4035, 0},
+    {0, 3, 2, 2, 0, 4037, 4037, 0},
+    {0, 3, 2, 2, 0, 4039, 4039, 0},
+    {0, 3, 2, 2, 0, 4041, 4041, 0},
+    {0, 3, 2, 2, 0, 4043, 4043, 0},
+    {0, 3, 2, 2, 0, 4045, 4045, 0},
+    {0, 3, 2, 2, 0, 4047, 4047, 0},
+    {0, 3, 2, 2, 0, 4049, 4049, 0},
+    {0, 3, 2, 2, 0, 4051, 4051, 0},
+    {0, 3, 2, 2, 0, 4053, 4053, 0},
+    {0, 3, 2, 2, 0, 4055, 4055, 0},
+    {0, 3, 2, 2, 0, 4057, 4057, 0},
+    {0, 3, 2, 2, 0, 4059, 4059, 0},
+    {0, 3, 2, 2, 0, 4061, 4061, 0},
+    {0, 3, 2, 2, 0, 4063, 4063, 0},
+    {0, 3, 2, 2, 0, 4065, 4065, 0},
+    {0, 3, 2, 2, 0, 4067, 4067, 0},
+    {0, 3, 2, 2, 0, 4069, 4069, 0},
+    {0, 3, 2, 2, 0, 4071, 4071, 0},
+    {0, 3, 2, 2, 0, 4073, 4073, 0},
+    {0, 3, 2, 2, 0, 4075, 4075, 0},
+    {0, 3, 2, 2, 0, 4077, 4077, 0},
+    {0, 3, 2, 2, 0, 4079, 4079, 0},
+    {0, 3, 2, 2, 0, 4081, 4081, 0},
+    {0, 3, 2, 2, 0, 4083, 4083, 0},
+    {0, 3, 2, 2, 0, 4085, 4085, 0},
+    {0, 3, 2, 2, 0, 4087, 4087, 0},
+    {0, 3, 2, 2, 0, 4089, 4089, 0},
+    {0, 3, 2, 2, 0, 4091, 4091, 0},
+    {0, 3, 2, 2, 0, 4093, 4093, 0},
+    {0, 18, 0, 2, 0, 0, 4095, 0},
+    {0, 18, 0, 1, 0, 0, 4097, 0},
+    {0, 18, 0, 1, 0, 0, 4098, 0},
+    {0, 18, 0, 1, 0, 0, 4099, 0},
+    {0, 18, 0, 1, 0, 0, 4100, 0},
+    {0, 18, 0, 1, 0, 0, 4101, 0},
+    {0, 18, 0, 1, 0, 0, 4102, 0},
+    {0, 18, 0, 1, 0, 0, 4103, 0},
+    {0, 18, 0, 1, 0, 0, 4104, 0},
+    {0, 18, 0, 1, 0, 0, 4105, 0},
+    {0, 18, 0, 1, 0, 0, 4106, 0},
+    {0, 18, 0, 1, 0, 0, 4107, 0},
+    {0, 18, 0, 1, 0, 0, 4108, 0},
+    {0, 18, 0, 1, 0, 0, 4109, 0},
+    {0, 18, 0, 1, 0, 0, 4110, 0},
+    {0, 18, 0, 1, 0, 0, 4111, 0},
+    {0, 18, 0, 1, 0, 0, 4112, 0},
+    {0, 18, 0, 1, 0, 0, 4113, 0},
+    {0, 18, 0, 1, 0, 0, 4114, 0},
+    {0, 18, 0, 1, 0, 0, 4115, 0},
+    {0, 18, 0, 1, 0, 0, 4116, 0},
+    {0, 18, 0, 1, 0, 0, 4117, 0},
+    {0, 18, 0, 1, 0, 0, 4118, 0},
+    {0, 18, 0, 1, 0, 0, 4119, 0},
+    {0, 18, 0, 1, 0, 0, 4120, 0},
+    {0, 18, 0, 1, 0, 0, 4121, 0},
+    {0, 18, 0, 1, 0, 0, 4122, 0},
+    {0, 18, 0, 1, 0, 0, 4123, 0},
+    {0, 18, 0, 1, 0, 0, 4124, 0},
+    {0, 18, 0, 1, 0, 0, 4125, 0},
+    {0, 18, 0, 1, 0, 0, 4126, 0},
+    {0, 18, 0, 1, 0, 0, 4127, 0},
+    {0, 18, 0, 1, 0, 0, 4128, 0},
+    {0, 18, 0, 1, 0, 0, 4129, 0},
+    {0, 18, 0, 1, 0, 0, 4130, 0},
+    {0, 18, 0, 1, 0, 0, 4131, 0},
+    {0, 18, 0, 1, 0, 0, 4132, 0},
+    {0, 18, 0, 1, 0, 0, 4133, 0},
+    {0, 18, 0, 1, 0, 0, 4134, 0},
+    {0, 18, 0, 1, 0, 0, 4135, 0},
+    {0, 18, 0, 1, 0, 0, 4136, 0},
+    {0, 18, 0, 1, 0, 0, 4137, 0},
+    {0, 18, 0, 1, 0, 0, 4138, 0},
+    {0, 18, 0, 1, 0, 0, 4139, 0},
+    {0, 18, 0, 1, 0, 0, 4140, 0},
+    {0, 18, 0, 1, 0, 0, 4141, 0},
+    {0, 18, 0, 1, 0, 0, 4142, 0},
+    {0, 18, 0, 1, 0, 0, 4143, 0},
+    {0, 18, 0, 1, 0, 0, 4144, 0},
+    {0, 18, 0, 1, 0, 0, 4145, 0},
+    {0, 18, 0, 1, 0, 0, 4146, 0},
+    {0, 18, 0, 1, 0, 0, 4147, 0},
+    {0, 18, 0, 1, 0, 0, 4148, 0},
+    {0, 18, 0, 1, 0, 0, 4149, 0},
+    {0, 18, 0, 1, 0, 0, 4150, 0},
+    {0, 18, 0, 1, 0, 0, 4151, 0},
+    {0, 18, 0, 1, 0, 0, 4152, 0},
+    {0, 18, 0, 1, 0, 0, 4153, 0},
+    {0, 18, 0, 1, 0, 0, 4154, 0},
+    {0, 18, 0, 1, 0, 0, 4155, 0},
+    {0, 18, 0, 1, 0, 0, 4156, 0},
+    {0, 18, 0, 1, 0, 0, 4157, 0},
+    {0, 18, 0, 1, 0, 0, 4158, 0},
+    {0, 18, 0, 1, 0, 0, 4159, 0},
+    {0, 18, 0, 1, 0, 0, 4160, 0},
+    {0, 18, 0, 1, 0, 0, 4161, 0},
+    {0, 18, 0, 1, 0, 0, 4162, 0},
+    {0, 18, 0, 1, 0, 0, 4163, 0},
+    {0, 18, 0, 1, 0, 0, 4164, 0},
+    {0, 18, 0, 1, 0, 0, 4165, 0},
+    {0, 18, 0, 1, 0, 0, 4166, 0},
+    {0, 18, 0, 1, 0, 0, 4167, 0},
+    {0, 18, 0, 1, 0, 0, 4168, 0},
+    {0, 18, 0, 1, 0, 0, 4169, 0},
+    {0, 18, 0, 1, 0, 0, 4170, 0},
+    {0, 18, 0, 1, 0, 0, 4171, 0},
+    {0, 18, 0, 1, 0, 0, 4172, 0},
+    {0, 18, 0, 1, 0, 0, 4173, 0},
+    {0, 18, 0, 1, 0, 0, 4174, 0},
+    {0, 18, 0, 1, 0, 0, 4175, 0},
+    {0, 18, 0, 1, 0, 0, 4176, 0},
+    {0, 18, 0, 1, 0, 0, 4177, 0},
+    {0, 18, 0, 1, 0, 0, 4178, 0},
+    {0, 18, 0, 1, 0, 0, 4179, 0},
+    {0, 18, 0, 1, 0, 0, 4180, 0},
+    {0, 18, 0, 1, 0, 0, 4181, 0},
+    {0, 18, 0, 1, 0, 0, 4182, 0},
+    {0, 18, 0, 1, 0, 0, 4183, 0},
+    {0, 18, 0, 1, 0, 0, 4184, 0},
+    {0, 18, 0, 1, 0, 0, 4185, 0},
+    {0, 18, 0, 1, 0, 0, 4186, 0},
+    {0, 18, 0, 1, 0, 0, 4187, 0},
+    {0, 18, 0, 1, 0, 0, 4188, 0},
+    {0, 18, 0, 1, 0, 0, 4189, 0},
+    {0, 18, 0, 1, 0, 0, 4190, 0},
+    {0, 18, 0, 1, 0, 0, 4191, 0},
+    {0, 18, 0, 1, 0, 0, 4192, 0},
+    {0, 18, 0, 1, 0, 0, 4193, 0},
+    {0, 18, 0, 1, 0, 0, 4194, 0},
+    {0, 18, 0, 1, 0, 0, 4195, 0},
+    {0, 18, 0, 1, 0, 0, 4196, 0},
+    {0, 18, 0, 1, 0, 0, 4197, 0},
+    {0, 18, 0, 1, 0, 0, 4198, 0},
+    {0, 18, 0, 1, 0, 0, 4199, 0},
+    {0, 18, 0, 1, 0, 0, 4200, 0},
+    {0, 18, 0, 3, 0, 0, 4201, 0},
+    {0, 18, 0, 3, 0, 0, 4204, 0},
+    {0, 18, 0, 3, 0, 0, 4207, 0},
+    {0, 18, 0, 3, 0, 0, 4210, 0},
+    {0, 18, 0, 3, 0, 0, 4213, 0},
+    {0, 18, 0, 3, 0, 0, 4216, 0},
+    {0, 18, 0, 3, 0, 0, 4219, 0},
+    {0, 18, 0, 3, 0, 0, 4222, 0},
+    {0, 18, 0, 3, 0, 0, 4225, 0},
+    {0, 18, 0, 3, 0, 0, 4228, 0},
+    {0, 18, 0, 3, 0, 0, 4231, 0},
+    {0, 18, 0, 3, 0, 0, 4234, 0},
+    {0, 18, 0, 3, 0, 0, 4237, 0},
+    {0, 18, 0, 3, 0, 0, 4240, 0},
+    {0, 18, 0, 4, 0, 0, 4243, 0},
+    {0, 18, 0, 4, 0, 0, 4247, 0},
+    {0, 18, 0, 4, 0, 0, 4251, 0},
+    {0, 18, 0, 4, 0, 0, 4255, 0},
+    {0, 18, 0, 4, 0, 0, 4259, 0},
+    {0, 18, 0, 4, 0, 0, 4263, 0},
+    {0, 18, 0, 4, 0, 0, 4267, 0},
+    {0, 18, 0, 4, 0, 0, 4271, 0},
+    {0, 18, 0, 4, 0, 0, 4275, 0},
+    {0, 18, 0, 4, 0, 0, 4279, 0},
+    {0, 18, 0, 4, 0, 0, 4283, 0},
+    {0, 18, 0, 4, 0, 0, 4287, 0},
+    {0, 18, 0, 4, 0, 0, 4291, 0},
+    {0, 18, 0, 4, 0, 0, 4295, 0},
+    {0, 18, 0, 4, 0, 0, 4299, 0},
+    {0, 18, 0, 7, 0, 0, 4303, 0},
+    {0, 18, 0, 6, 0, 0, 4310, 0},
+    {0, 18, 0, 3, 0, 0, 4316, 0},
+    {0, 18, 0, 3, 0, 0, 4319, 0},
+    {0, 18, 0, 3, 0, 0, 4322, 0},
+    {0, 18, 0, 3, 0, 0, 4325, 0},
+    {0, 18, 0, 3, 0, 0, 4328, 0},
+    {0, 18, 0, 3, 0, 0, 4331, 0},
+    {0, 18, 0, 3, 0, 0, 4334, 0},
+    {0, 18, 0, 3, 0, 0, 4337, 0},
+    {0, 18, 0, 3, 0, 0, 4340, 0},
+    {0, 18, 0, 3, 0, 0, 4343, 0},
+    {0, 18, 0, 3, 0, 0, 4346, 0},
+    {0, 18, 0, 3, 0, 0, 4349, 0},
+    {0, 18, 0, 3, 0, 0, 4352, 0},
+    {0, 18, 0, 3, 0, 0, 4355, 0},
+    {0, 18, 0, 3, 0, 0, 4358, 0},
+    {0, 18, 0, 3, 0, 0, 4361, 0},
+    {0, 18, 0, 3, 0, 0, 4364, 0},
+    {0, 18, 0, 3, 0, 0, 4367, 0},
+    {0, 18, 0, 3, 0, 0, 4370, 0},
+    {0, 18, 0, 3, 0, 0, 4373, 0},
+    {0, 18, 0, 3, 0, 0, 4376, 0},
+    {0, 18, 0, 3, 0, 0, 4379, 0},
+    {0, 18, 0, 3, 0, 0, 4382, 0},
+    {0, 18, 0, 3, 0, 0, 4385, 0},
+    {0, 18, 0, 3, 0, 0, 4388, 0},
+    {0, 18, 0, 3, 0, 0, 4391, 0},
+    {0, 18, 0, 3, 0, 0, 4394, 0},
+    {0, 18, 0, 3, 0, 0, 4397, 0},
+    {0, 18, 0, 3, 0, 0, 4400, 0},
+    {0, 18, 0, 3, 0, 0, 4403, 0},
+    {0, 18, 0, 3, 0, 0, 4406, 0},
+    {0, 18, 0, 3, 0, 0, 4409, 0},
+    {0, 18, 0, 3, 0, 0, 4412, 0},
+    {0, 18, 0, 3, 0, 0, 4415, 0},
+    {0, 18, 0, 3, 0, 0, 4418, 0},
+    {0, 18, 0, 3, 0, 0, 4421, 0},
+    {0, 18, 0, 1, 0, 0, 4424, 0},
+    {0, 18, 0, 1, 0, 0, 4425, 0},
+    {0, 18, 0, 1, 0, 0, 4426, 0},
+    {0, 18, 0, 3, 0, 0, 4427, 0},
+    {0, 18, 0, 2, 0, 0, 4430, 0},
+    {0, 18, 0, 2, 0, 0, 4432, 0},
+    {0, 18, 0, 2, 0, 0, 4434, 0},
+    {0, 18, 0, 2, 0, 0, 4436, 0},
+    {0, 18, 0, 2, 0, 0, 4438, 0},
+    {0, 18, 0, 2, 0, 0, 4440, 0},
+    {0, 18, 0, 2, 0, 0, 4442, 0},
+    {0, 18, 0, 2, 0, 0, 4444, 0},
+    {0, 18, 0, 2, 0, 0, 4446, 0},
+    {0, 18, 0, 2, 0, 0, 4448, 0},
+    {0, 18, 0, 2, 0, 0, 4450, 0},
+    {0, 18, 0, 2, 0, 0, 4452, 0},
+    {0, 18, 0, 2, 0, 0, 4454, 0},
+    {0, 18, 0, 2, 0, 0, 4456, 0},
+    {0, 18, 0, 2, 0, 0, 4458, 0},
+    {0, 18, 0, 2, 0, 0, 4460, 0},
+    {0, 18, 0, 2, 0, 0, 4462, 0},
+    {0, 18, 0, 2, 0, 0, 4464, 0},
+    {0, 18, 0, 2, 0, 0, 4466, 0},
+    {0, 18, 0, 2, 0, 0, 4468, 0},
+    {0, 18, 0, 2, 0, 0, 4470, 0},
+    {0, 18, 0, 2, 0, 0, 4472, 0},
+    {0, 18, 0, 2, 0, 0, 4474, 0},
+    {0, 18, 0, 2, 0, 0, 4476, 0},
+    {0, 18, 0, 2, 0, 0, 4478, 0},
+    {0, 18, 0, 2, 0, 0, 4480, 0},
+    {0, 18, 0, 2, 0, 0, 4482, 0},
+    {0, 18, 0, 2, 0, 0, 4484, 0},
+    {0, 18, 0, 2, 0, 0, 4486, 0},
+    {0, 18, 0, 5, 0, 0, 4488, 0},
+    {0, 18, 0, 4, 0, 0, 4493, 0},
+    {0, 18, 0, 2, 0, 0, 4497, 0},
+    {0, 18, 0, 1, 0, 0, 4499, 0},
+    {0, 18, 0, 1, 0, 0, 4500, 0},
+    {0, 18, 0, 1, 0, 0, 4501, 0},
+    {0, 18, 0, 1, 0, 0, 4502, 0},
+    {0, 18, 0, 1, 0, 0, 4503, 0},
+    {0, 18, 0, 1, 0, 0, 4504, 0},
+    {0, 18, 0, 1, 0, 0, 4505, 0},
+    {0, 18, 0, 1, 0, 0, 4506, 0},
+    {0, 18, 0, 1, 0, 0, 4507, 0},
+    {0, 18, 0, 1, 0, 0, 4508, 0},
+    {0, 18, 0, 1, 0, 0, 4509, 0},
+    {0, 18, 0, 1, 0, 0, 4510, 0},
+    {0, 18, 0, 1, 0, 0, 4511, 0},
+    {0, 18, 0, 1, 0, 0, 4512, 0},
+    {0, 18, 0, 1, 0, 0, 4513, 0},
+    {0, 18, 0, 1, 0, 0, 4514, 0},
+    {0, 18, 0, 1, 0, 0, 4515, 0},
+    {0, 18, 0, 1, 0, 0, 4516, 0},
+    {0, 18, 0, 1, 0, 0, 4517, 0},
+    {0, 18, 0, 1, 0, 0, 4518, 0},
+    {0, 18, 0, 1, 0, 0, 4519, 0},
+    {0, 18, 0, 1, 0, 0, 4520, 0},
+    {0, 18, 0, 1, 0, 0, 4521, 0},
+    {0, 18, 0, 1, 0, 0, 4522, 0},
+    {0, 18, 0, 1, 0, 0, 4523, 0},
+    {0, 18, 0, 1, 0, 0, 4524, 0},
+    {0, 18, 0, 1, 0, 0, 4525, 0},
+    {0, 18, 0, 1, 0, 0, 4526, 0},
+    {0, 18, 0, 1, 0, 0, 4527, 0},
+    {0, 18, 0, 1, 0, 0, 4528, 0},
+    {0, 18, 0, 1, 0, 0, 4529, 0},
+    {0, 18, 0, 1, 0, 0, 4530, 0},
+    {0, 18, 0, 2, 0, 0, 4531, 0},
+    {0, 18, 0, 2, 0, 0, 4533, 0},
+    {0, 18, 0, 2, 0, 0, 4535, 0},
+    {0, 18, 0, 2, 0, 0, 4537, 0},
+    {0, 18, 0, 2, 0, 0, 4539, 0},
+    {0, 18, 0, 2, 0, 0, 4541, 0},
+    {0, 18, 0, 2, 0, 0, 4543, 0},
+    {0, 18, 0, 2, 0, 0, 4545, 0},
+    {0, 18, 0, 2, 0, 0, 4547, 0},
+    {0, 18, 0, 2, 0, 0, 4549, 0},
+    {0, 18, 0, 2, 0, 0, 4551, 0},
+    {0, 18, 0, 2, 0, 0, 4553, 0},
+    {0, 18, 0, 2, 0, 0, 4555, 0},
+    {0, 18, 0, 2, 0, 0, 4557, 0},
+    {0, 18, 0, 2, 0, 0, 4559, 0},
+    {0, 18, 0, 2, 0, 0, 4561, 0},
+    {0, 18, 0, 2, 0, 0, 4563, 0},
+    {0, 18, 0, 2, 0, 0, 4565, 0},
+    {0, 18, 0, 2, 0, 0, 4567, 0},
+    {0, 18, 0, 2, 0, 0, 4569, 0},
+    {0, 18, 0, 2, 0, 0, 4571, 0},
+    {0, 18, 0, 2, 0, 0, 4573, 0},
+    {0, 18, 0, 2, 0, 0, 4575, 0},
+    {0, 18, 0, 2, 0, 0, 4577, 0},
+    {0, 18, 0, 3, 0, 0, 4579, 0},
+    {0, 18, 0, 3, 0, 0, 4582, 0},
+    {0, 18, 0, 3, 0, 0, 4585, 0},
+    {0, 18, 0, 2, 0, 0, 4588, 0},
+    {0, 18, 0, 3, 0, 0, 4590, 0},
+    {0, 18, 0, 2, 0, 0, 4593, 0},
+    {0, 18, 0, 3, 0, 0, 4595, 0},
+    {0, 18, 0, 1, 0, 0, 4598, 0},
+    {0, 18, 0, 1, 0, 0, 4599, 0},
+    {0, 18, 0, 1, 0, 0, 4600, 0},
+    {0, 18, 0, 1, 0, 0, 4601, 0},
+    {0, 18, 0, 1, 0, 0, 4602, 0},
+    {0, 18, 0, 1, 0, 0, 4603, 0},
+    {0, 18, 0, 1, 0, 0, 4604, 0},
+    {0, 18, 0, 1, 0, 0, 4605, 0},
+    {0, 18, 0, 1, 0, 0, 4606, 0},
+    {0, 18, 0, 1, 0, 0, 4607, 0},
+    {0, 18, 0, 1, 0, 0, 4608, 0},
+    {0, 18, 0, 1, 0, 0, 4609, 0},
+    {0, 18, 0, 1, 0, 0, 4610, 0},
+    {0, 18, 0, 1, 0, 0, 4611, 0},
+    {0, 18, 0, 1, 0, 0, 4612, 0},
+    {0, 18, 0, 1, 0, 0, 4613, 0},
+    {0, 18, 0, 1, 0, 0, 4614, 0},
+    {0, 18, 0, 1, 0, 0, 4615, 0},
+    {0, 18, 0, 1, 0, 0, 4616, 0},
+    {0, 18, 0, 1, 0, 0, 4617, 0},
+    {0, 18, 0, 1, 0, 0, 4618, 0},
+    {0, 18, 0, 1, 0, 0, 4619, 0},
+    {0, 18, 0, 1, 0, 0, 4620, 0},
+    {0, 18, 0, 1, 0, 0, 4621, 0},
+    {0, 18, 0, 1, 0, 0, 4622, 0},
+    {0, 18, 0, 1, 0, 0, 4623, 0},
+    {0, 18, 0, 1, 0, 0, 4624, 0},
+    {0, 18, 0, 1, 0, 0, 4625, 0},
+    {0, 18, 0, 1, 0, 0, 4626, 0},
+    {0, 18, 0, 1, 0, 0, 4627, 0},
+    {0, 18, 0, 1, 0, 0, 4628, 0},
+    {0, 18, 0, 1, 0, 0, 4629, 0},
+    {0, 18, 0, 1, 0, 0, 4630, 0},
+    {0, 18, 0, 1, 0, 0, 4631, 0},
+    {0, 18, 0, 1, 0, 0, 4632, 0},
+    {0, 18, 0, 1, 0, 0, 4633, 0},
+    {0, 18, 0, 1, 0, 0, 4634, 0},
+    {0, 18, 0, 1, 0, 0, 4635, 0},
+    {0, 18, 0, 1, 0, 0, 4636, 0},
+    {0, 18, 0, 1, 0, 0, 4637, 0},
+    {0, 18, 0, 1, 0, 0, 4638, 0},
+    {0, 18, 0, 1, 0, 0, 4639, 0},
+    {0, 18, 0, 1, 0, 0, 4640, 0},
+    {0, 18, 0, 1, 0, 0, 4641, 0},
+    {0, 18, 0, 1, 0, 0, 4642, 0},
+    {0, 18, 0, 1, 0, 0, 4643, 0},
+    {0, 18, 0, 1, 0, 0, 4644, 0},
+    {0, 18, 0, 2, 0, 0, 4645, 0},
+    {0, 18, 0, 5, 0, 0, 4647, 0},
+    {0, 18, 0, 4, 0, 0, 4652, 0},
+    {0, 18, 0, 5, 0, 0, 4656, 0},
+    {0, 18, 0, 3, 0, 0, 4661, 0},
+    {0, 18, 0, 5, 0, 0, 4664, 0},
+    {0, 18, 0, 3, 0, 0, 4669, 0},
+    {0, 18, 0, 3, 0, 0, 4672, 0},
+    {0, 18, 0, 6, 0, 0, 4675, 0},
+    {0, 18, 0, 4, 0, 0, 4681, 0},
+    {0, 18, 0, 3, 0, 0, 4685, 0},
+    {0, 18, 0, 3, 0, 0, 4688, 0},
+    {0, 18, 0, 3, 0, 0, 4691, 0},
+    {0, 18, 0, 4, 0, 0, 4694, 0},
+    {0, 18, 0, 4, 0, 0, 4698, 0},
+    {0, 18, 0, 4, 0, 0, 4702, 0},
+    {0, 18, 0, 4, 0, 0, 4706, 0},
+    {0, 18, 0, 4, 0, 0, 4710, 0},
+    {0, 18, 0, 4, 0, 0, 4714, 0},
+    {0, 18, 0, 4, 0, 0, 4718, 0},
+    {0, 18, 0, 6, 0, 0, 4722, 0},
+    {0, 18, 0, 2, 0, 0, 4728, 0},
+    {0, 18, 0, 6, 0, 0, 4730, 0},
+    {0, 18, 0, 6, 0, 0, 4736, 0},
+    {0, 18, 0, 5, 0, 0, 4742, 0},
+    {0, 18, 0, 4, 0, 0, 4747, 0},
+    {0, 18, 0, 6, 0, 0, 4751, 0},
+    {0, 18, 0, 6, 0, 0, 4757, 0},
+    {0, 18, 0, 4, 0, 0, 4763, 0},
+    {0, 18, 0, 3, 0, 0, 4767, 0},
+    {0, 18, 0, 3, 0, 0, 4770, 0},
+    {0, 18, 0, 4, 0, 0, 4773, 0},
+    {0, 18, 0, 4, 0, 0, 4777, 0},
+    {0, 18, 0, 5, 0, 0, 4781, 0},
+    {0, 18, 0, 5, 0, 0, 4786, 0},
+    {0, 18, 0, 3, 0, 0, 4791, 0},
+    {0, 18, 0, 3, 0, 0, 4794, 0},
+    {0, 18, 0, 4, 0, 0, 4797, 0},
+    {0, 18, 0, 3, 0, 0, 4801, 0},
+    {0, 18, 0, 3, 0, 0, 4804, 0},
+    {0, 18, 0, 2, 0, 0, 4807, 0},
+    {0, 18, 0, 2, 0, 0, 4809, 0},
+    {0, 18, 0, 3, 0, 0, 4811, 0},
+    {0, 18, 0, 3, 0, 0, 4814, 0},
+    {0, 18, 0, 6, 0, 0, 4817, 0},
+    {0, 18, 0, 4, 0, 0, 4823, 0},
+    {0, 18, 0, 5, 0, 0, 4827, 0},
+    {0, 18, 0, 6, 0, 0, 4832, 0},
+    {0, 18, 0, 4, 0, 0, 4838, 0},
+    {0, 18, 0, 3, 0, 0, 4842, 0},
+    {0, 18, 0, 3, 0, 0, 4845, 0},
+    {0, 18, 0, 6, 0, 0, 4848, 0},
+    {0, 18, 0, 4, 0, 0, 4854, 0},
+    {0, 18, 0, 6, 0, 0, 4858, 0},
+    {0, 18, 0, 3, 0, 0, 4864, 0},
+    {0, 18, 0, 5, 0, 0, 4867, 0},
+    {0, 18, 0, 3, 0, 0, 4872, 0},
+    {0, 18, 0, 4, 0, 0, 4875, 0},
+    {0, 18, 0, 3, 0, 0, 4879, 0},
+    {0, 18, 0, 4, 0, 0, 4882, 0},
+    {0, 18, 0, 5, 0, 0, 4886, 0},
+    {0, 18, 0, 4, 0, 0, 4891, 0},
+    {0, 18, 0, 5, 0, 0, 4895, 0},
+    {0, 18, 0, 4, 0, 0, 4900, 0},
+    {0, 18, 0, 2, 0, 0, 4904, 0},
+    {0, 18, 0, 5, 0, 0, 4906, 0},
+    {0, 18, 0, 3, 0, 0, 4911, 0},
+    {0, 18, 0, 3, 0, 0, 4914, 0},
+    {0, 18, 0, 4, 0, 0, 4917, 0},
+    {0, 18, 0, 3, 0, 0, 4921, 0},
+    {0, 18, 0, 3, 0, 0, 4924, 0},
+    {0, 18, 0, 3, 0, 0, 4927, 0},
+    {0, 18, 0, 5, 0, 0, 4930, 0},
+    {0, 18, 0, 4, 0, 0, 4935, 0},
+    {0, 18, 0, 2, 0, 0, 4939, 0},
+    {0, 18, 0, 6, 0, 0, 4941, 0},
+    {0, 18, 0, 3, 0, 0, 4947, 0},
+    {0, 18, 0, 5, 0, 0, 4950, 0},
+    {0, 18, 0, 4, 0, 0, 4955, 0},
+    {0, 18, 0, 4, 0, 0, 4959, 0},
+    {0, 18, 0, 3, 0, 0, 4963, 0},
+    {0, 18, 0, 3, 0, 0, 4966, 0},
+    {0, 18, 0, 4, 0, 0, 4969, 0},
+    {0, 18, 0, 2, 0, 0, 4973, 0},
+    {0, 18, 0, 4, 0, 0, 4975, 0},
+    {0, 18, 0, 5, 0, 0, 4979, 0},
+    {0, 18, 0, 2, 0, 0, 4984, 0},
+    {0, 18, 0, 6, 0, 0, 4986, 0},
+    {0, 18, 0, 3, 0, 0, 4992, 0},
+    {0, 18, 0, 2, 0, 0, 4995, 0},
+    {0, 18, 0, 2, 0, 0, 4997, 0},
+    {0, 18, 0, 2, 0, 0, 4999, 0},
+    {0, 18, 0, 2, 0, 0, 5001, 0},
+    {0, 18, 0, 2, 0, 0, 5003, 0},
+    {0, 18, 0, 2, 0, 0, 5005, 0},
+    {0, 18, 0, 2, 0, 0, 5007, 0},
+    {0, 18, 0, 2, 0, 0, 5009, 0},
+    {0, 18, 0, 2, 0, 0, 5011, 0},
+    {0, 18, 0, 2, 0, 0, 5013, 0},
+    {0, 18, 0, 3, 0, 0, 5015, 0},
+    {0, 18, 0, 3, 0, 0, 5018, 0},
+    {0, 18, 0, 3, 0, 0, 5021, 0},
+    {0, 18, 0, 3, 0, 0, 5024, 0},
+    {0, 18, 0, 3, 0, 0, 5027, 0},
+    {0, 18, 0, 3, 0, 0, 5030, 0},
+    {0, 18, 0, 3, 0, 0, 5033, 0},
+    {0, 18, 0, 3, 0, 0, 5036, 0},
+    {0, 18, 0, 3, 0, 0, 5039, 0},
+    {0, 18, 0, 3, 0, 0, 5042, 0},
+    {0, 18, 0, 3, 0, 0, 5045, 0},
+    {0, 18, 0, 3, 0, 0, 5048, 0},
+    {0, 18, 0, 3, 0, 0, 5051, 0},
+    {0, 18, 0, 3, 0, 0, 5054, 0},
+    {0, 18, 0, 3, 0, 0, 5057, 0},
+    {0, 18, 0, 3, 0, 0, 5060, 0},
+    {0, 18, 0, 2, 0, 0, 5063, 0},
+    {0, 18, 0, 2, 0, 0, 5065, 0},
+    {0, 18, 0, 3, 0, 0, 5067, 0},
+    {0, 18, 0, 2, 0, 0, 5070, 0},
+    {0, 18, 0, 2, 0, 0, 5072, 0},
+    {0, 18, 0, 2, 0, 0, 5074, 0},
+    {0, 18, 0, 3, 0, 0, 5076, 0},
+    {0, 18, 0, 3, 0, 0, 5079, 0},
+    {0, 18, 0, 2, 0, 0, 5082, 0},
+    {0, 18, 0, 2, 0, 0, 5084, 0},
+    {0, 18, 0, 2, 0, 0, 5086, 0},
+    {0, 18, 0, 2, 0, 0, 5088, 0},
+    {0, 18, 0, 2, 0, 0, 5090, 0},
+    {0, 18, 0, 4, 0, 0, 5092, 0},
+    {0, 18, 0, 2, 0, 0, 5096, 0},
+    {0, 18, 0, 2, 0, 0, 5098, 0},
+    {0, 18, 0, 2, 0, 0, 5100, 0},
+    {0, 18, 0, 2, 0, 0, 5102, 0},
+    {0, 18, 0, 2, 0, 0, 5104, 0},
+    {0, 18, 0, 2, 0, 0, 5106, 0},
+    {0, 18, 0, 2, 0, 0, 5108, 0},
+    {0, 18, 0, 2, 0, 0, 5110, 0},
+    {0, 18, 0, 3, 0, 0, 5112, 0},
+    {0, 18, 0, 4, 0, 0, 5115, 0},
+    {0, 18, 0, 2, 0, 0, 5119, 0},
+    {0, 18, 0, 2, 0, 0, 5121, 0},
+    {0, 18, 0, 2, 0, 0, 5123, 0},
+    {0, 18, 0, 2, 0, 0, 5125, 0},
+    {0, 18, 0, 2, 0, 0, 5127, 0},
+    {0, 18, 0, 2, 0, 0, 5129, 0},
+    {0, 18, 0, 2, 0, 0, 5131, 0},
+    {0, 18, 0, 3, 0, 0, 5133, 0},
+    {0, 18, 0, 3, 0, 0, 5136, 0},
+    {0, 18, 0, 3, 0, 0, 5139, 0},
+    {0, 18, 0, 3, 0, 0, 5142, 0},
+    {0, 18, 0, 2, 0, 0, 5145, 0},
+    {0, 18, 0, 2, 0, 0, 5147, 0},
+    {0, 18, 0, 2, 0, 0, 5149, 0},
+    {0, 18, 0, 2, 0, 0, 5151, 0},
+    {0, 18, 0, 2, 0, 0, 5153, 0},
+    {0, 18, 0, 2, 0, 0, 5155, 0},
+    {0, 18, 0, 2, 0, 0, 5157, 0},
+    {0, 18, 0, 2, 0, 0, 5159, 0},
+    {0, 18, 0, 2, 0, 0, 5161, 0},
+    {0, 18, 0, 2, 0, 0, 5163, 0},
+    {0, 18, 0, 3, 0, 0, 5165, 0},
+    {0, 18, 0, 3, 0, 0, 5168, 0},
+    {0, 18, 0, 2, 0, 0, 5171, 0},
+    {0, 18, 0, 3, 0, 0, 5173, 0},
+    {0, 18, 0, 3, 0, 0, 5176, 0},
+    {0, 18, 0, 3, 0, 0, 5179, 0},
+    {0, 18, 0, 2, 0, 0, 5182, 0},
+    {0, 18, 0, 3, 0, 0, 5184, 0},
+    {0, 18, 0, 3, 0, 0, 5187, 0},
+    {0, 18, 0, 4, 0, 0, 5190, 0},
+    {0, 18, 0, 2, 0, 0, 5194, 0},
+    {0, 18, 0, 3, 0, 0, 5196, 0},
+    {0, 18, 0, 3, 0, 0, 5199, 0},
+    {0, 18, 0, 3, 0, 0, 5202, 0},
+    {0, 18, 0, 3, 0, 0, 5205, 0},
+    {0, 18, 0, 5, 0, 0, 5208, 0},
+    {0, 18, 0, 6, 0, 0, 5213, 0},
+    {0, 18, 0, 2, 0, 0, 5219, 0},
+    {0, 18, 0, 2, 0, 0, 5221, 0},
+    {0, 18, 0, 2, 0, 0, 5223, 0},
+    {0, 18, 0, 2, 0, 0, 5225, 0},
+    {0, 18, 0, 2, 0, 0, 5227, 0},
+    {0, 18, 0, 2, 0, 0, 5229, 0},
+    {0, 18, 0, 2, 0, 0, 5231, 0},
+    {0, 18, 0, 2, 0, 0, 5233, 0},
+    {0, 18, 0, 2, 0, 0, 5235, 0},
+    {0, 18, 0, 2, 0, 0, 5237, 0},
+    {0, 18, 0, 2, 0, 0, 5239, 0},
+    {0, 18, 0, 2, 0, 0, 5241, 0},
+    {0, 18, 0, 2, 0, 0, 5243, 0},
+    {0, 18, 0, 2, 0, 0, 5245, 0},
+    {0, 18, 0, 2, 0, 0, 5247, 0},
+    {0, 18, 0, 2, 0, 0, 5249, 0},
+    {0, 18, 0, 2, 0, 0, 5251, 0},
+    {0, 18, 0, 2, 0, 0, 5253, 0},
+    {0, 18, 0, 4, 0, 0, 5255, 0},
+    {0, 18, 0, 2, 0, 0, 5259, 0},
+    {0, 18, 0, 2, 0, 0, 5261, 0},
+    {0, 18, 0, 2, 0, 0, 5263, 0},
+    {0, 18, 0, 4, 0, 0, 5265, 0},
+    {0, 18, 0, 3, 0, 0, 5269, 0},
+    {0, 18, 0, 2, 0, 0, 5272, 0},
+    {0, 18, 0, 2, 0, 0, 5274, 0},
+    {0, 18, 0, 2, 0, 0, 5276, 0},
+    {0, 18, 0, 2, 0, 0, 5278, 0},
+    {0, 18, 0, 2, 0, 0, 5280, 0},
+    {0, 18, 0, 2, 0, 0, 5282, 0},
+    {0, 18, 0, 2, 0, 0, 5284, 0},
+    {0, 18, 0, 2, 0, 0, 5286, 0},
+    {0, 18, 0, 2, 0, 0, 5288, 0},
+    {0, 18, 0, 2, 0, 0, 5290, 0},
+    {0, 18, 0, 3, 0, 0, 5292, 0},
+    {0, 18, 0, 2, 0, 0, 5295, 0},
+    {0, 18, 0, 2, 0, 0, 5297, 0},
+    {0, 18, 0, 3, 0, 0, 5299, 0},
+    {0, 18, 0, 3, 0, 0, 5302, 0},
+    {0, 18, 0, 2, 0, 0, 5305, 0},
+    {0, 18, 0, 4, 0, 0, 5307, 0},
+    {0, 18, 0, 3, 0, 0, 5311, 0},
+    {0, 18, 0, 2, 0, 0, 5314, 0},
+    {0, 18, 0, 2, 0, 0, 5316, 0},
+    {0, 18, 0, 2, 0, 0, 5318, 0},
+    {0, 18, 0, 2, 0, 0, 5320, 0},
+    {0, 18, 0, 3, 0, 0, 5322, 0},
+    {0, 18, 0, 3, 0, 0, 5325, 0},
+    {0, 18, 0, 2, 0, 0, 5328, 0},
+    {0, 18, 0, 2, 0, 0, 5330, 0},
+    {0, 18, 0, 2, 0, 0, 5332, 0},
+    {0, 18, 0, 2, 0, 0, 5334, 0},
+    {0, 18, 0, 2, 0, 0, 5336, 0},
+    {0, 18, 0, 2, 0, 0, 5338, 0},
+    {0, 18, 0, 2, 0, 0, 5340, 0},
+    {0, 18, 0, 2, 0, 0, 5342, 0},
+    {0, 18, 0, 2, 0, 0, 5344, 0},
+    {0, 18, 0, 3, 0, 0, 5346, 0},
+    {0, 18, 0, 3, 0, 0, 5349, 0},
+    {0, 18, 0, 3, 0, 0, 5352, 0},
+    {0, 18, 0, 3, 0, 0, 5355, 0},
+    {0, 18, 0, 3, 0, 0, 5358, 0},
+    {0, 18, 0, 3, 0, 0, 5361, 0},
+    {0, 18, 0, 3, 0, 0, 5364, 0},
+    {0, 18, 0, 3, 0, 0, 5367, 0},
+    {0, 18, 0, 3, 0, 0, 5370, 0},
+    {0, 18, 0, 3, 0, 0, 5373, 0},
+    {0, 18, 0, 3, 0, 0, 5376, 0},
+    {0, 18, 0, 3, 0, 0, 5379, 0},
+    {0, 18, 0, 3, 0, 0, 5382, 0},
+    {0, 18, 0, 3, 0, 0, 5385, 0},
+    {0, 18, 0, 3, 0, 0, 5388, 0},
+    {0, 18, 0, 3, 0, 0, 5391, 0},
+    {0, 18, 0, 3, 0, 0, 5394, 0},
+    {0, 18, 0, 3, 0, 0, 5397, 0},
+    {0, 18, 0, 3, 0, 0, 5400, 0},
+    {0, 18, 0, 3, 0, 0, 5403, 0},
+    {0, 18, 0, 3, 0, 0, 5406, 0},
+    {0, 18, 0, 3, 0, 0, 5409, 0},
+    {0, 18, 0, 3, 0, 0, 5412, 0},
+    {0, 0, 0, 0, 1, 0, 0, 5415},
+    {0, 0, 0, 0, 1, 0, 0, 5416},
+    {0, 0, 0, 0, 1, 0, 0, 5417},
+    {0, 0, 0, 0, 1, 0, 0, 5418},
+    {0, 0, 0, 0, 1, 0, 0, 5419},
+    {0, 0, 0, 0, 1, 0, 0, 5420},
+    {0, 0, 0, 0, 1, 0, 0, 5421},
+    {0, 0, 0, 0, 1, 0, 0, 5422},
+    {0, 0, 0, 0, 1, 0, 0, 5423},
+    {0, 0, 0, 0, 1, 0, 0, 5424},
+    {0, 0, 0, 0, 1, 0, 0, 5425},
+    {0, 0, 0, 0, 1, 0, 0, 5426},
+    {0, 0, 0, 0, 1, 0, 0, 5427},
+    {0, 0, 0, 0, 1, 0, 0, 5428},
+    {0, 0, 0, 0, 1, 0, 0, 5429},
+    {0, 0, 0, 0, 1, 0, 0, 5430},
+    {0, 0, 0, 0, 1, 0, 0, 5431},
+    {0, 0, 0, 0, 1, 0, 0, 5432},
+    {0, 0, 0, 0, 1, 0, 0, 5433},
+    {0, 0, 0, 0, 1, 0, 0, 5434},
+    {0, 0, 0, 0, 1, 0, 0, 5435},
+    {0, 0, 0, 0, 1, 0, 0, 5436},
+    {0, 0, 0, 0, 1, 0, 0, 5437},
+    {0, 0, 0, 0, 1, 0, 0, 5438},
+    {0, 0, 0, 0, 1, 0, 0, 5439},
+    {0, 0, 0, 0, 1, 0, 0, 5440},
+    {0, 0, 0, 0, 1, 0, 0, 5441},
+    {0, 0, 0, 0, 1, 0, 0, 5442},
+    {0, 0, 0, 0, 1, 0, 0, 5443},
+    {0, 0, 0, 0, 1, 0, 0, 5444},
+    {0, 0, 0, 0, 1, 0, 0, 5445},
+    {0, 0, 0, 0, 1, 0, 0, 5446},
+    {0, 0, 0, 0, 1, 0, 0, 5447},
+    {0, 0, 0, 0, 1, 0, 0, 5448},
+    {0, 0, 0, 0, 1, 0, 0, 5449},
+    {0, 0, 0, 0, 1, 0, 0, 5450},
+    {0, 0, 0, 0, 1, 0, 0, 5451},
+    {0, 18, 0, 1, 0, 0, 1003, 0},
+    {0, 18, 0, 1, 0, 0, 1005, 0},
+    {0, 0, 0, 0, 1, 0, 0, 5452},
+    {0, 0, 0, 0, 1, 0, 0, 5453},
+    {0, 0, 0, 0, 1, 0, 0, 5454},
+    {0, 0, 0, 0, 1, 0, 0, 5455},
+    {0, 0, 0, 0, 1, 0, 0, 5456},
+    {0, 0, 0, 0, 1, 0, 0, 5457},
+    {0, 0, 0, 0, 1, 0, 0, 5458},
+    {0, 0, 0, 0, 1, 0, 0, 5459},
+    {0, 0, 0, 0, 1, 0, 0, 5460},
+    {0, 0, 0, 0, 1, 0, 0, 5461},
+    {0, 0, 0, 0, 1, 0, 0, 5462},
+    {0, 0, 0, 0, 1, 0, 0, 5463},
+    {0, 0, 0, 0, 1, 0, 0, 5464},
+    {0, 0, 0, 0, 1, 0, 0, 5465},
+    {0, 0, 0, 0, 1, 0, 0, 5466},
+    {0, 0, 0, 0, 1, 0, 0, 5467},
+    {0, 0, 0, 0, 1, 0, 0, 5468},
+    {0, 0, 0, 0, 1, 0, 0, 5469},
+    {0, 0, 0, 0, 1, 0, 0, 5470},
+    {0, 0, 0, 0, 1, 0, 0, 5471},
+    {0, 0, 0, 0, 1, 0, 0, 5472},
+    {0, 0, 0, 0, 1, 0, 0, 5473},
+    {0, 0, 0, 0, 1, 0, 0, 5474},
+    {0, 0, 0, 0, 1, 0, 0, 5475},
+    {0, 0, 0, 0, 1, 0, 0, 5476},
+    {0, 0, 0, 0, 1, 0, 0, 5477},
+    {0, 0, 0, 0, 1, 0, 0, 5478},
+    {0, 0, 0, 0, 1, 0, 0, 5479},
+    {0, 0, 0, 0, 1, 0, 0, 5480},
+    {0, 0, 0, 0, 1, 0, 0, 5481},
+    {0, 0, 0, 0, 1, 0, 0, 5482},
+    {0, 0, 0, 0, 1, 0, 0, 5483},
+    {0, 0, 0, 0, 1, 0, 0, 5484},
+    {0, 0, 0, 0, 1, 0, 0, 5485},
+    {0, 0, 0, 0, 1, 0, 0, 5486},
+    {0, 0, 0, 0, 1, 0, 0, 5487},
+    {0, 0, 0, 0, 1, 0, 0, 5488},
+    {0, 0, 0, 0, 1, 0, 0, 5489},
+    {0, 18, 0, 1, 0, 0, 5489, 0},
+    {0, 0, 0, 0, 1, 0, 0, 5490},
+    {0, 0, 0, 0, 1, 0, 0, 5491},
+    {0, 0, 0, 0, 1, 0, 0, 5492},
+    {0, 0, 0, 0, 1, 0, 0, 5493},
+    {0, 0, 0, 0, 1, 0, 0, 5494},
+    {0, 0, 0, 0, 1, 0, 0, 5495},
+    {0, 0, 0, 0, 1, 0, 0, 5496},
+    {0, 0, 0, 0, 1, 0, 0, 5497},
+    {0, 0, 0, 0, 1, 0, 0, 5498},
+    {0, 0, 0, 0, 1, 0, 0, 1629},
+    {0, 0, 0, 0, 1, 0, 0, 5499},
+    {0, 0, 0, 0, 1, 0, 0, 5500},
+    {0, 0, 0, 0, 1, 0, 0, 5501},
+    {0, 0, 0, 0, 1, 0, 0, 5502},
+    {0, 0, 0, 0, 1, 0, 0, 5503},
+    {0, 0, 0, 0, 1, 0, 0, 5504},
+    {0, 0, 0, 0, 1, 0, 0, 5505},
+    {0, 0, 0, 0, 1, 0, 0, 5506},
+    {0, 0, 0, 0, 1, 0, 0, 5507},
+    {0, 0, 0, 0, 1, 0, 0, 5508},
+    {0, 0, 0, 0, 1, 0, 0, 5509},
+    {0, 0, 0, 0, 1, 0, 0, 5510},
+    {0, 0, 0, 0, 1, 0, 0, 808},
+    {0, 0, 0, 0, 1, 0, 0, 1620},
+    {0, 0, 0, 0, 1, 0, 0, 1628},
+    {0, 0, 0, 0, 1, 0, 0, 5511},
+    {0, 0, 0, 0, 1, 0, 0, 1630},
+    {0, 0, 0, 0, 1, 0, 0, 5512},
+    {0, 0, 0, 0, 1, 0, 0, 5513},
+    {0, 0, 0, 0, 1, 0, 0, 1632},
+    {0, 0, 0, 0, 1, 0, 0, 5514},
+    {0, 0, 0, 0, 1, 0, 0, 5515},
+    {0, 0, 0, 0, 1, 0, 0, 5516},
+    {0, 0, 0, 0, 1, 0, 0, 5517},
+    {0, 0, 0, 0, 1, 0, 0, 5518},
+    {0, 0, 0, 0, 1, 0, 0, 5519},
+    {0, 0, 0, 0, 1, 0, 0, 5520},
+    {0, 0, 0, 0, 1, 0, 0, 5521},
+    {0, 0, 0, 0, 1, 0, 0, 5522},
+    {0, 0, 0, 0, 1, 0, 0, 5523},
+    {0, 0, 0, 0, 1, 0, 0, 1641},
+    {0, 0, 0, 0, 1, 0, 0, 5524},
+    {0, 0, 0, 0, 1, 0, 0, 5525},
+    {0, 0, 0, 0, 1, 0, 0, 5526},
+    {0, 0, 0, 0, 1, 0, 0, 5527},
+    {0, 0, 0, 0, 1, 0, 0, 5528},
+    {0, 0, 0, 0, 1, 0, 0, 5529},
+    {0, 0, 0, 0, 1, 0, 0, 5530},
+    {0, 18, 0, 1, 0, 0, 5531, 0},
+    {0, 18, 0, 1, 0, 0, 369, 0},
+    {0, 18, 0, 1, 0, 0, 5454, 0},
+    {0, 18, 0, 1, 0, 0, 5532, 0},
+    {0, 18, 0, 1, 0, 0, 3690, 0},
+    {0, 18, 0, 1, 0, 0, 5533, 0},
+    {0, 18, 0, 1, 0, 0, 5534, 0},
+    {0, 23, 1, 1, 0, 5535, 5535, 0},
+    {0, 23, 1, 1, 0, 5536, 5536, 0},
+    {0, 23, 1, 1, 0, 3914, 3914, 0},
+    {0, 23, 1, 1, 0, 5537, 5537, 0},
+    {0, 23, 1, 1, 0, 5538, 5538, 0},
+    {0, 23, 1, 1, 0, 5539, 5539, 0},
+    {0, 23, 1, 1, 0, 5540, 5540, 0},
+    {0, 23, 1, 1, 0, 3968, 3968, 0},
+    {0, 23, 1, 1, 0, 5541, 5541, 0},
+    {0, 23, 1, 1, 0, 3922, 3922, 0},
+    {0, 23, 1, 1, 0, 5542, 5542, 0},
+    {0, 23, 1, 1, 0, 5543, 5543, 0},
+    {0, 23, 1, 1, 0, 5544, 5544, 0},
+    {0, 23, 1, 1, 0, 5545, 5545, 0},
+    {0, 23, 1, 1, 0, 5546, 5546, 0},
+    {0, 23, 1, 1, 0, 5547, 5547, 0},
+    {0, 23, 1, 1, 0, 5548, 5548, 0},
+    {0, 23, 1, 1, 0, 5549, 5549, 0},
+    {0, 23, 1, 1, 0, 5550, 5550, 0},
+    {0, 23, 1, 1, 0, 5551, 5551, 0},
+    {0, 23, 1, 1, 0, 5552, 5552, 0},
+    {0, 23, 1, 1, 0, 5553, 5553, 0},
+    {0, 23, 1, 1, 0, 5554, 5554, 0},
+    {0, 23, 1, 1, 0, 5555, 5555, 0},
+    {0, 23, 1, 1, 0, 5556, 5556, 0},
+    {0, 23, 1, 1, 0, 5557, 5557, 0},
+    {0, 23, 1, 1, 0, 5558, 5558, 0},
+    {0, 23, 1, 1, 0, 5559, 5559, 0},
+    {0, 23, 1, 1, 0, 5560, 5560, 0},
+    {0, 23, 1, 1, 0, 5561, 5561, 0},
+    {0, 23, 1, 1, 0, 5562, 5562, 0},
+    {0, 23, 1, 1, 0, 5563, 5563, 0},
+    {0, 23, 1, 1, 0, 5564, 5564, 0},
+    {0, 23, 1, 1, 0, 5565, 5565, 0},
+    {0, 23, 1, 1, 0, 5566, 5566, 0},
+    {0, 23, 1, 1, 0, 5567, 5567, 0},
+    {0, 23, 1, 1, 0, 5568, 5568, 0},
+    {0, 23, 1, 1, 0, 5569, 5569, 0},
+    {0, 23, 1, 1, 0, 5570, 5570, 0},
+    {0, 23, 1, 1, 0, 5571, 5571, 0},
+    {0, 23, 1, 1, 0, 5572, 5572, 0},
+    {0, 23, 1, 1, 0, 5573, 5573, 0},
+    {0, 23, 1, 1, 0, 5574, 5574, 0},
+    {0, 23, 1, 1, 0, 5575, 5575, 0},
+    {0, 23, 1, 1, 0, 5576, 5576, 0},
+    {0, 23, 1, 1, 0, 5577, 5577, 0},
+    {0, 23, 1, 1, 0, 5578, 5578, 0},
+    {0, 23, 1, 1, 0, 5579, 5579, 0},
+    {0, 23, 1, 1, 0, 5580, 5580, 0},
+    {0, 23, 1, 1, 0, 5581, 5581, 0},
+    {0, 23, 1, 1, 0, 5582, 5582, 0},
+    {0, 23, 1, 1, 0, 3880, 3880, 0},
+    {0, 23, 1, 1, 0, 5583, 5583, 0},
+    {0, 23, 1, 1, 0, 5584, 5584, 0},
+    {0, 23, 1, 1, 0, 5585, 5585, 0},
+    {0, 23, 1, 1, 0, 5586, 5586, 0},
+    {0, 23, 1, 1, 0, 5587, 5587, 0},
+    {0, 23, 1, 1, 0, 5588, 5588, 0},
+    {0, 23, 1, 1, 0, 5589, 5589, 0},
+    {0, 23, 1, 1, 0, 5590, 5590, 0},
+    {0, 23, 1, 1, 0, 5591, 5591, 0},
+    {0, 23, 1, 1, 0, 5592, 5592, 0},
+    {0, 23, 1, 1, 0, 5593, 5593, 0},
+    {0, 23, 1, 1, 0, 3953, 3953, 0},
+    {0, 23, 1, 1, 0, 5594, 5594, 0},
+    {0, 23, 1, 1, 0, 5595, 5595, 0},
+    {0, 23, 1, 1, 0, 5596, 5596, 0},
+    {0, 23, 1, 1, 0, 5597, 5597, 0},
+    {0, 23, 1, 1, 0, 5598, 5598, 0},
+    {0, 23, 1, 1, 0, 5599, 5599, 0},
+    {0, 23, 1, 1, 0, 5600, 5600, 0},
+    {0, 23, 1, 1, 0, 5601, 5601, 0},
+    {0, 23, 1, 1, 0, 5602, 5602, 0},
+    {0, 23, 1, 1, 0, 5603, 5603, 0},
+    {0, 23, 1, 1, 0, 5604, 5604, 0},
+    {0, 23, 1, 1, 0, 5605, 5605, 0},
+    {0, 23, 1, 1, 0, 5606, 5606, 0},
+    {0, 23, 1, 1, 0, 5607, 5607, 0},
+    {0, 23, 1, 1, 0, 5608, 5608, 0},
+    {0, 23, 1, 1, 0, 5609, 5609, 0},
+    {0, 23, 1, 1, 0, 5610, 5610, 0},
+    {0, 23, 1, 1, 0, 5611, 5611, 0},
+    {0, 23, 1, 1, 0, 5612, 5612, 0},
+    {0, 23, 1, 1, 0, 5613, 5613, 0},
+    {0, 23, 1, 1, 0, 5614, 5614, 0},
+    {0, 23, 1, 1, 0, 5615, 5615, 0},
+    {0, 23, 1, 1, 0, 5616, 5616, 0},
+    {0, 23, 1, 1, 0, 5617, 5617, 0},
+    {0, 23, 1, 1, 0, 5618, 5618, 0},
+    {0, 23, 1, 1, 0, 5619, 5619, 0},
+    {0, 23, 1, 1, 0, 5620, 5620, 0},
+    {0, 23, 1, 1, 0, 5621, 5621, 0},
+    {0, 23, 1, 1, 0, 5622, 5622, 0},
+    {0, 23, 1, 1, 0, 5623, 5623, 0},
+    {0, 23, 1, 1, 0, 5624, 5624, 0},
+    {0, 23, 1, 1, 0, 5625, 5625, 0},
+    {0, 23, 1, 1, 0, 5626, 5626, 0},
+    {0, 23, 1, 1, 0, 5627, 5627, 0},
+    {0, 23, 1, 1, 0, 5628, 5628, 0},
+    {0, 23, 1, 1, 0, 5629, 5629, 0},
+    {0, 23, 1, 1, 0, 5630, 5630, 0},
+    {0, 23, 1, 1, 0, 5631, 5631, 0},
+    {0, 23, 1, 1, 0, 5632, 5632, 0},
+    {0, 23, 1, 1, 0, 5633, 5633, 0},
+    {0, 23, 1, 1, 0, 5634, 5634, 0},
+    {0, 23, 1, 1, 0, 5635, 5635, 0},
+    {0, 23, 1, 1, 0, 5636, 5636, 0},
+    {0, 23, 1, 1, 0, 5637, 5637, 0},
+    {0, 23, 1, 1, 0, 5638, 5638, 0},
+    {0, 23, 1, 1, 0, 5639, 5639, 0},
+    {0, 23, 1, 1, 0, 5640, 5640, 0},
+    {0, 23, 1, 1, 0, 3916, 3916, 0},
+    {0, 23, 1, 1, 0, 5641, 5641, 0},
+    {0, 23, 1, 1, 0, 5642, 5642, 0},
+    {0, 23, 1, 1, 0, 5643, 5643, 0},
+    {0, 23, 1, 1, 0, 5644, 5644, 0},
+    {0, 23, 1, 1, 0, 5645, 5645, 0},
+    {0, 23, 1, 1, 0, 5646, 5646, 0},
+    {0, 23, 1, 1, 0, 5647, 5647, 0},
+    {0, 23, 1, 1, 0, 5648, 5648, 0},
+    {0, 23, 1, 1, 0, 5649, 5649, 0},
+    {0, 23, 1, 1, 0, 5650, 5650, 0},
+    {0, 23, 1, 1, 0, 5651, 5651, 0},
+    {0, 23, 1, 1, 0, 5652, 5652, 0},
+    {0, 23, 1, 1, 0, 5653, 5653, 0},
+    {0, 23, 1, 1, 0, 5654, 5654, 0},
+    {0, 23, 1, 1, 0, 5655, 5655, 0},
+    {0, 23, 1, 1, 0, 3793, 3793, 0},
+    {0, 23, 1, 1, 0, 5656, 5656, 0},
+    {0, 23, 1, 1, 0, 5657, 5657, 0},
+    {0, 23, 1, 1, 0, 5658, 5658, 0},
+    {0, 23, 1, 1, 0, 5659, 5659, 0},
+    {0, 23, 1, 1, 0, 5660, 5660, 0},
+    {0, 23, 1, 1, 0, 5661, 5661, 0},
+    {0, 23, 1, 1, 0, 5662, 5662, 0},
+    {0, 23, 1, 1, 0, 5663, 5663, 0},
+    {0, 23, 1, 1, 0, 3774, 3774, 0},
+    {0, 23, 1, 1, 0, 5664, 5664, 0},
+    {0, 23, 1, 1, 0, 5665, 5665, 0},
+    {0, 23, 1, 1, 0, 5666, 5666, 0},
+    {0, 23, 1, 1, 0, 5667, 5667, 0},
+    {0, 23, 1, 1, 0, 5668, 5668, 0},
+    {0, 23, 1, 1, 0, 5669, 5669, 0},
+    {0, 23, 1, 1, 0, 5670, 5670, 0},
+    {0, 23, 1, 1, 0, 5671, 5671, 0},
+    {0, 23, 1, 1, 0, 5672, 5672, 0},
+    {0, 23, 1, 1, 0, 5673, 5673, 0},
+    {0, 23, 1, 1, 0, 5674, 5674, 0},
+    {0, 23, 1, 1, 0, 5675, 5675, 0},
+    {0, 23, 1, 1, 0, 5676, 5676, 0},
+    {0, 23, 1, 1, 0, 5677, 5677, 0},
+    {0, 23, 1, 1, 0, 5678, 5678, 0},
+    {0, 23, 1, 1, 0, 5679, 5679, 0},
+    {0, 23, 1, 1, 0, 5680, 5680, 0},
+    {0, 23, 1, 1, 0, 5681, 5681, 0},
+    {0, 23, 1, 1, 0, 5682, 5682, 0},
+    {0, 23, 1, 1, 0, 5683, 5683, 0},
+    {0, 23, 1, 1, 0, 5684, 5684, 0},
+    {0, 23, 1, 1, 0, 5685, 5685, 0},
+    {0, 23, 1, 1, 0, 5686, 5686, 0},
+    {0, 23, 1, 1, 0, 5687, 5687, 0},
+    {0, 23, 1, 1, 0, 5688, 5688, 0},
+    {0, 23, 1, 1, 0, 5689, 5689, 0},
+    {0, 23, 1, 1, 0, 5690, 5690, 0},
+    {0, 23, 1, 1, 0, 5691, 5691, 0},
+    {0, 23, 1, 1, 0, 5692, 5692, 0},
+    {0, 23, 1, 1, 0, 5693, 5693, 0},
+    {0, 23, 1, 1, 0, 5694, 5694, 0},
+    {0, 23, 1, 1, 0, 5695, 5695, 0},
+    {0, 23, 1, 1, 0, 5696, 5696, 0},
+    {0, 23, 1, 1, 0, 5697, 5697, 0},
+    {0, 23, 1, 1, 0, 5698, 5698, 0},
+    {0, 23, 1, 1, 0, 5699, 5699, 0},
+    {0, 23, 1, 1, 0, 5700, 5700, 0},
+    {0, 23, 1, 1, 0, 5701, 5701, 0},
+    {0, 23, 1, 1, 0, 5702, 5702, 0},
+    {0, 23, 1, 1, 0, 5703, 5703, 0},
+    {0, 23, 1, 1, 0, 5704, 5704, 0},
+    {0, 23, 1, 1, 0, 5705, 5705, 0},
+    {0, 23, 1, 1, 0, 5706, 5706, 0},
+    {0, 23, 1, 1, 0, 5707, 5707, 0},
+    {0, 23, 1, 1, 0, 5708, 5708, 0},
+    {0, 23, 1, 1, 0, 5709, 5709, 0},
+    {0, 23, 1, 1, 0, 5710, 5710, 0},
+    {0, 23, 1, 1, 0, 5711, 5711, 0},
+    {0, 23, 1, 1, 0, 5712, 5712, 0},
+    {0, 23, 1, 1, 0, 5713, 5713, 0},
+    {0, 23, 1, 1, 0, 5714, 5714, 0},
+    {0, 23, 1, 1, 0, 5715, 5715, 0},
+    {0, 23, 1, 1, 0, 5716, 5716, 0},
+    {0, 23, 1, 1, 0, 5717, 5717, 0},
+    {0, 23, 1, 1, 0, 3967, 3967, 0},
+    {0, 23, 1, 1, 0, 5718, 5718, 0},
+    {0, 23, 1, 1, 0, 5719, 5719, 0},
+    {0, 23, 1, 1, 0, 5720, 5720, 0},
+    {0, 23, 1, 1, 0, 5721, 5721, 0},
+    {0, 23, 1, 1, 0, 5722, 5722, 0},
+    {0, 23, 1, 1, 0, 5723, 5723, 0},
+    {0, 23, 1, 1, 0, 5724, 5724, 0},
+    {0, 23, 1, 1, 0, 5725, 5725, 0},
+    {0, 23, 1, 1, 0, 5726, 5726, 0},
+    {0, 23, 1, 1, 0, 5727, 5727, 0},
+    {0, 23, 1, 1, 0, 5728, 5728, 0},
+    {0, 23, 1, 1, 0, 5729, 5729, 0},
+    {0, 23, 1, 1, 0, 4500, 4500, 0},
+    {0, 23, 1, 1, 0, 5730, 5730, 0},
+    {0, 23, 1, 1, 0, 5731, 5731, 0},
+    {0, 23, 1, 1, 0, 5732, 5732, 0},
+    {0, 23, 1, 1, 0, 5733, 5733, 0},
+    {0, 23, 1, 1, 0, 5734, 5734, 0},
+    {0, 23, 1, 1, 0, 5735, 5735, 0},
+    {0, 23, 1, 1, 0, 5736, 5736, 0},
+    {0, 23, 1, 1, 0, 5737, 5737, 0},
+    {0, 23, 1, 1, 0, 5738, 5738, 0},
+    {0, 23, 1, 1, 0, 5739, 5739, 0},
+    {0, 23, 1, 1, 0, 5740, 5740, 0},
+    {0, 23, 1, 1, 0, 5741, 5741, 0},
+    {0, 23, 1, 1, 0, 5742, 5742, 0},
+    {0, 23, 1, 1, 0, 5743, 5743, 0},
+    {0, 23, 1, 1, 0, 5744, 5744, 0},
+    {0, 23, 1, 1, 0, 5745, 5745, 0},
+    {0, 23, 1, 1, 0, 5746, 5746, 0},
+    {0, 23, 1, 1, 0, 5747, 5747, 0},
+    {0, 23, 1, 1, 0, 5748, 5748, 0},
+    {0, 23, 1, 1, 0, 5749, 5749, 0},
+    {0, 23, 1, 1, 0, 5750, 5750, 0},
+    {0, 23, 1, 1, 0, 5751, 5751, 0},
+    {0, 23, 1, 1, 0, 3921, 3921, 0},
+    {0, 23, 1, 1, 0, 5752, 5752, 0},
+    {0, 23, 1, 1, 0, 5753, 5753, 0},
+    {0, 23, 1, 1, 0, 5754, 5754, 0},
+    {0, 23, 1, 1, 0, 5755, 5755, 0},
+    {0, 23, 1, 1, 0, 5756, 5756, 0},
+    {0, 23, 1, 1, 0, 5757, 5757, 0},
+    {0, 23, 1, 1, 0, 5758, 5758, 0},
+    {0, 23, 1, 1, 0, 5759, 5759, 0},
+    {0, 23, 1, 1, 0, 5760, 5760, 0},
+    {0, 23, 1, 1, 0, 5761, 5761, 0},
+    {0, 23, 1, 1, 0, 5762, 5762, 0},
+    {0, 23, 1, 1, 0, 5763, 5763, 0},
+    {0, 23, 1, 1, 0, 5764, 5764, 0},
+    {0, 23, 1, 1, 0, 3872, 3872, 0},
+    {0, 23, 1, 1, 0, 5765, 5765, 0},
+    {0, 23, 1, 1, 0, 5766, 5766, 0},
+    {0, 23, 1, 1, 0, 5767, 5767, 0},
+    {0, 23, 1, 1, 0, 5768, 5768, 0},
+    {0, 23, 1, 1, 0, 5769, 5769, 0},
+    {0, 23, 1, 1, 0, 5770, 5770, 0},
+    {0, 23, 1, 1, 0, 5771, 5771, 0},
+    {0, 23, 1, 1, 0, 5772, 5772, 0},
+    {0, 23, 1, 1, 0, 5773, 5773, 0},
+    {0, 23, 1, 1, 0, 5774, 5774, 0},
+    {0, 23, 1, 1, 0, 5775, 5775, 0},
+    {0, 23, 1, 1, 0, 5776, 5776, 0},
+    {0, 23, 1, 1, 0, 5777, 5777, 0},
+    {0, 23, 1, 1, 0, 5778, 5778, 0},
+    {0, 23, 1, 1, 0, 5779, 5779, 0},
+    {0, 23, 1, 1, 0, 5780, 5780, 0},
+    {0, 23, 1, 1, 0, 3899, 3899, 0},
+    {0, 23, 1, 1, 0, 5781, 5781, 0},
+    {0, 23, 1, 1, 0, 3902, 3902, 0},
+    {0, 23, 1, 1, 0, 5782, 5782, 0},
+    {0, 23, 1, 1, 0, 5783, 5783, 0},
+    {0, 23, 1, 1, 0, 5784, 5784, 0},
+    {0, 23, 1, 1, 0, 5785, 5785, 0},
+    {0, 23, 1, 1, 0, 5786, 5786, 0},
+    {0, 23, 1, 1, 0, 5787, 5787, 0},
+    {0, 23, 1, 1, 0, 5788, 5788, 0},
+    {0, 23, 1, 1, 0, 5789, 5789, 0},
+    {0, 23, 1, 1, 0, 5790, 5790, 0},
+    {0, 23, 1, 1, 0, 5791, 5791, 0},
+    {0, 23, 1, 1, 0, 5792, 5792, 0},
+    {0, 23, 1, 1, 0, 5793, 5793, 0},
+    {0, 23, 1, 1, 0, 5794, 5794, 0},
+    {0, 23, 1, 1, 0, 5795, 5795, 0},
+    {0, 23, 1, 1, 0, 3879, 3879, 0},
+    {0, 23, 1, 1, 0, 5796, 5796, 0},
+    {0, 23, 1, 1, 0, 5797, 5797, 0},
+    {0, 23, 1, 1, 0, 5798, 5798, 0},
+    {0, 23, 1, 1, 0, 5799, 5799, 0},
+    {0, 23, 1, 1, 0, 5800, 5800, 0},
+    {0, 23, 1, 1, 0, 5801, 5801, 0},
+    {0, 23, 1, 1, 0, 5802, 5802, 0},
+    {0, 23, 1, 1, 0, 5803, 5803, 0},
+    {0, 23, 1, 1, 0, 5804, 5804, 0},
+    {0, 23, 1, 1, 0, 5805, 5805, 0},
+    {0, 23, 1, 1, 0, 5806, 5806, 0},
+    {0, 23, 1, 1, 0, 5807, 5807, 0},
+    {0, 23, 1, 1, 0, 5808, 5808, 0},
+    {0, 23, 1, 1, 0, 5809, 5809, 0},
+    {0, 23, 1, 1, 0, 5810, 5810, 0},
+    {0, 23, 1, 1, 0, 5811, 5811, 0},
+    {0, 23, 1, 1, 0, 5812, 5812, 0},
+    {0, 23, 1, 1, 0, 5813, 5813, 0},
+    {0, 23, 1, 1, 0, 5814, 5814, 0},
+    {0, 23, 1, 1, 0, 5815, 5815, 0},
+    {0, 23, 1, 1, 0, 5816, 5816, 0},
+    {0, 23, 1, 1, 0, 5817, 5817, 0},
+    {0, 23, 1, 1, 0, 3800, 3800, 0},
+    {0, 23, 1, 1, 0, 5818, 5818, 0},
+    {0, 23, 1, 1, 0, 5819, 5819, 0},
+    {0, 23, 1, 1, 0, 5820, 5820, 0},
+    {0, 23, 1, 1, 0, 5821, 5821, 0},
+    {0, 23, 1, 1, 0, 5822, 5822, 0},
+    {0, 23, 1, 1, 0, 5823, 5823, 0},
+    {0, 23, 1, 1, 0, 5824, 5824, 0},
+    {0, 23, 1, 1, 0, 5825, 5825, 0},
+    {0, 23, 1, 1, 0, 5826, 5826, 0},
+    {0, 23, 1, 1, 0, 5827, 5827, 0},
+    {0, 23, 1, 1, 0, 5828, 5828, 0},
+    {0, 23, 1, 1, 0, 5829, 5829, 0},
+    {0, 23, 1, 1, 0, 5830, 5830, 0},
+    {0, 23, 1, 1, 0, 5831, 5831, 0},
+    {0, 23, 1, 1, 0, 5832, 5832, 0},
+    {0, 23, 1, 1, 0, 4505, 4505, 0},
+    {0, 23, 1, 1, 0, 5833, 5833, 0},
+    {0, 23, 1, 1, 0, 5834, 5834, 0},
+    {0, 23, 1, 1, 0, 5835, 5835, 0},
+    {0, 23, 1, 1, 0, 5836, 5836, 0},
+    {0, 23, 1, 1, 0, 4509, 4509, 0},
+    {0, 23, 1, 1, 0, 5837, 5837, 0},
+    {0, 23, 1, 1, 0, 5838, 5838, 0},
+    {0, 23, 1, 1, 0, 5839, 5839, 0},
+    {0, 23, 1, 1, 0, 5840, 5840, 0},
+    {0, 23, 1, 1, 0, 5841, 5841, 0},
+    {0, 23, 1, 1, 0, 5842, 5842, 0},
+    {0, 23, 1, 1, 0, 5843, 5843, 0},
+    {0, 23, 1, 1, 0, 5844, 5844, 0},
+    {0, 23, 1, 1, 0, 5845, 5845, 0},
+    {0, 23, 1, 1, 0, 5846, 5846, 0},
+    {0, 23, 1, 1, 0, 5847, 5847, 0},
+    {0, 23, 1, 1, 0, 5848, 5848, 0},
+    {0, 23, 1, 1, 0, 5849, 5849, 0},
+    {0, 23, 1, 1, 0, 5850, 5850, 0},
+    {0, 23, 1, 1, 0, 5851, 5851, 0},
+    {0, 23, 1, 1, 0, 5852, 5852, 0},
+    {0, 23, 1, 1, 0, 5853, 5853, 0},
+    {0, 23, 1, 1, 0, 5854, 5854, 0},
+    {0, 23, 1, 1, 0, 5855, 5855, 0},
+    {0, 23, 1, 1, 0, 5856, 5856, 0},
+    {0, 23, 1, 1, 0, 5857, 5857, 0},
+    {0, 23, 1, 1, 0, 5858, 5858, 0},
+    {0, 23, 1, 1, 0, 5859, 5859, 0},
+    {0, 23, 1, 1, 0, 5860, 5860, 0},
+    {0, 23, 1, 1, 0, 5861, 5861, 0},
+    {0, 23, 1, 1, 0, 5862, 5862, 0},
+    {0, 23, 1, 1, 0, 5863, 5863, 0},
+    {0, 23, 1, 1, 0, 5864, 5864, 0},
+    {0, 23, 1, 1, 0, 5865, 5865, 0},
+    {0, 23, 1, 1, 0, 5866, 5866, 0},
+    {0, 23, 1, 1, 0, 5867, 5867, 0},
+    {0, 23, 1, 1, 0, 5868, 5868, 0},
+    {0, 23, 1, 1, 0, 5869, 5869, 0},
+    {0, 23, 1, 1, 0, 5870, 5870, 0},
+    {0, 23, 1, 1, 0, 5871, 5871, 0},
+    {0, 23, 1, 1, 0, 5872, 5872, 0},
+    {0, 23, 1, 1, 0, 5873, 5873, 0},
+    {0, 23, 1, 1, 0, 5874, 5874, 0},
+    {0, 23, 1, 1, 0, 5875, 5875, 0},
+    {0, 23, 1, 1, 0, 5876, 5876, 0},
+    {0, 23, 1, 1, 0, 5877, 5877, 0},
+    {0, 23, 1, 1, 0, 5878, 5878, 0},
+    {0, 23, 1, 1, 0, 5879, 5879, 0},
+    {0, 23, 1, 1, 0, 5880, 5880, 0},
+    {0, 23, 1, 1, 0, 5881, 5881, 0},
+    {0, 23, 1, 1, 0, 5882, 5882, 0},
+    {0, 23, 1, 1, 0, 5883, 5883, 0},
+    {0, 23, 1, 1, 0, 5884, 5884, 0},
+    {0, 23, 1, 1, 0, 5885, 5885, 0},
+    {0, 23, 1, 1, 0, 5886, 5886, 0},
+    {0, 23, 1, 1, 0, 5887, 5887, 0},
+    {0, 23, 1, 1, 0, 5888, 5888, 0},
+    {0, 23, 1, 1, 0, 5889, 5889, 0},
+    {0, 23, 1, 1, 0, 5890, 5890, 0},
+    {0, 23, 1, 1, 0, 5891, 5891, 0},
+    {0, 23, 1, 1, 0, 5892, 5892, 0},
+    {0, 23, 1, 1, 0, 3833, 3833, 0},
+    {0, 23, 1, 1, 0, 5893, 5893, 0},
+    {0, 23, 1, 1, 0, 5894, 5894, 0},
+    {0, 23, 1, 1, 0, 5895, 5895, 0},
+    {0, 23, 1, 1, 0, 5896, 5896, 0},
+    {0, 23, 1, 1, 0, 5897, 5897, 0},
+    {0, 23, 1, 1, 0, 5898, 5898, 0},
+    {0, 23, 1, 1, 0, 5899, 5899, 0},
+    {0, 23, 1, 1, 0, 5900, 5900, 0},
+    {0, 23, 1, 1, 0, 5901, 5901, 0},
+    {0, 23, 1, 1, 0, 5902, 5902, 0},
+    {0, 23, 1, 1, 0, 5903, 5903, 0},
+    {0, 23, 1, 1, 0, 5904, 5904, 0},
+    {0, 23, 1, 1, 0, 5905, 5905, 0},
+    {0, 23, 1, 1, 0, 5906, 5906, 0},
+    {0, 23, 1, 1, 0, 5907, 5907, 0},
+    {0, 23, 1, 1, 0, 5908, 5908, 0},
+    {0, 23, 1, 1, 0, 5909, 5909, 0},
+    {0, 23, 1, 1, 0, 5910, 5910, 0},
+    {0, 23, 1, 1, 0, 5911, 5911, 0},
+    {0, 23, 1, 1, 0, 5912, 5912, 0},
+    {0, 23, 1, 1, 0, 5913, 5913, 0},
+    {0, 23, 1, 1, 0, 5914, 5914, 0},
+    {0, 23, 1, 1, 0, 5915, 5915, 0},
+    {0, 23, 1, 1, 0, 5916, 5916, 0},
+    {0, 23, 1, 1, 0, 5917, 5917, 0},
+    {0, 23, 1, 1, 0, 5918, 5918, 0},
+    {0, 23, 1, 1, 0, 5919, 5919, 0},
+    {0, 23, 1, 1, 0, 5920, 5920, 0},
+    {0, 23, 1, 1, 0, 5921, 5921, 0},
+    {0, 23, 1, 1, 0, 5922, 5922, 0},
+    {0, 23, 1, 1, 0, 5923, 5923, 0},
+    {0, 23, 1, 1, 0, 5924, 5924, 0},
+    {0, 23, 1, 1, 0, 5925, 5925, 0},
+    {0, 23, 1, 1, 0, 5926, 5926, 0},
+    {0, 23, 1, 1, 0, 5927, 5927, 0},
+    {0, 23, 1, 1, 0, 5928, 5928, 0},
+    {0, 23, 1, 1, 0, 5929, 5929, 0},
+    {0, 23, 1, 1, 0, 5930, 5930, 0},
+    {0, 23, 1, 1, 0, 5931, 5931, 0},
+    {0, 23, 1, 1, 0, 5932, 5932, 0},
+    {0, 23, 1, 1, 0, 5933, 5933, 0},
+    {0, 23, 1, 1, 0, 5934, 5934, 0},
+    {0, 23, 1, 1, 0, 5935, 5935, 0},
+    {0, 23, 1, 1, 0, 5936, 5936, 0},
+    {0, 23, 1, 1, 0, 5937, 5937, 0},
+    {0, 23, 1, 1, 0, 5938, 5938, 0},
+    {0, 23, 1, 1, 0, 5939, 5939, 0},
+    {0, 23, 1, 1, 0, 5940, 5940, 0},
+    {0, 18, 0, 2, 0, 0, 5941, 0},
+    {0, 18, 0, 2, 0, 0, 5943, 0},
+    {0, 18, 0, 2, 0, 0, 5945, 0},
+    {0, 18, 0, 3, 0, 0, 5947, 0},
+    {0, 18, 0, 3, 0, 0, 5950, 0},
+    {0, 18, 0, 2, 0, 0, 5953, 0},
+    {0, 18, 0, 2, 0, 0, 5955, 0},
+    {0, 18, 0, 2, 0, 0, 5957, 0},
+    {0, 18, 0, 2, 0, 0, 5959, 0},
+    {0, 18, 0, 2, 0, 0, 5961, 0},
+    {0, 18, 0, 2, 0, 0, 5963, 0},
+    {0, 23, 2, 2, 0, 5965, 5965, 0},
+    {26, 64, 0, 0, 0, 0, 0, 0},
+    {0, 23, 2, 2, 0, 5967, 5967, 0},
+    {0, 18, 0, 1, 0, 0, 5969, 0},
+    {0, 18, 0, 1, 0, 0, 5970, 0},
+    {0, 18, 0, 1, 0, 0, 5971, 0},
+    {0, 18, 0, 1, 0, 0, 5972, 0},
+    {0, 18, 0, 1, 0, 0, 5973, 0},
+    {0, 18, 0, 1, 0, 0, 5974, 0},
+    {0, 18, 0, 1, 0, 0, 5975, 0},
+    {0, 23, 2, 2, 0, 5976, 5976, 0},
+    {0, 23, 2, 2, 0, 5978, 5978, 0},
+    {0, 23, 3, 3, 0, 5980, 5980, 0},
+    {0, 23, 3, 3, 0, 5983, 5983, 0},
+    {0, 23, 2, 2, 0, 5986, 5986, 0},
+    {0, 23, 2, 2, 0, 5988, 5988, 0},
+    {0, 23, 2, 2, 0, 5990, 5990, 0},
+    {0, 23, 2, 2, 0, 5992, 5992, 0},
+    {0, 23, 2, 2, 0, 5994, 5994, 0},
+    {0, 23, 2, 2, 0, 5996, 5996, 0},
+    {0, 23, 2, 2, 0, 5998, 5998, 0},
+    {0, 23, 2, 2, 0, 6000, 6000, 0},
+    {0, 23, 2, 2, 0, 6002, 6002, 0},
+    {0, 23, 2, 2, 0, 6004, 6004, 0},
+    {0, 23, 2, 2, 0, 6006, 6006, 0},
+    {0, 23, 2, 2, 0, 6008, 6008, 0},
+    {0, 23, 2, 2, 0, 6010, 6010, 0},
+    {0, 23, 2, 2, 0, 6012, 6012, 0},
+    {0, 23, 2, 2, 0, 6014, 6014, 0},
+    {0, 23, 2, 2, 0, 6016, 6016, 0},
+    {0, 23, 2, 2, 0, 6018, 6018, 0},
+    {0, 23, 2, 2, 0, 6020, 6020, 0},
+    {0, 23, 2, 2, 0, 6022, 6022, 0},
+    {0, 23, 2, 2, 0, 6024, 6024, 0},
+    {0, 23, 2, 2, 0, 6026, 6026, 0},
+    {0, 23, 2, 2, 0, 6028, 6028, 0},
+    {0, 23, 2, 2, 0, 6030, 6030, 0},
+    {0, 23, 2, 2, 0, 6032, 6032, 0},
+    {0, 23, 2, 2, 0, 6034, 6034, 0},
+    {0, 23, 2, 2, 0, 6036, 6036, 0},
+    {0, 23, 2, 2, 0, 6038, 6038, 0},
+    {0, 23, 2, 2, 0, 6040, 6040, 0},
+    {0, 18, 0, 2, 0, 0, 6042, 0},
+    {0, 18, 0, 1, 0, 0, 6044, 0},
+    {0, 18, 0, 1, 0, 0, 6045, 0},
+    {0, 18, 0, 1, 0, 0, 6046, 0},
+    {0, 18, 0, 1, 0, 0, 6047, 0},
+    {0, 18, 0, 1, 0, 0, 6048, 0},
+    {0, 18, 0, 1, 0, 0, 6049, 0},
+    {0, 18, 0, 1, 0, 0, 6050, 0},
+    {0, 18, 0, 1, 0, 0, 6051, 0},
+    {0, 18, 0, 1, 0, 0, 6052, 0},
+    {0, 18, 0, 1, 0, 0, 6053, 0},
+    {0, 18, 0, 1, 0, 0, 6054, 0},
+    {0, 18, 0, 1, 0, 0, 6055, 0},
+    {0, 18, 0, 1, 0, 0, 6056, 0},
+    {0, 18, 0, 1, 0, 0, 6057, 0},
+    {0, 18, 0, 1, 0, 0, 6058, 0},
+    {0, 18, 0, 1, 0, 0, 6059, 0},
+    {0, 18, 0, 1, 0, 0, 6060, 0},
+    {0, 18, 0, 1, 0, 0, 6061, 0},
+    {0, 18, 0, 1, 0, 0, 6062, 0},
+    {0, 18, 0, 1, 0, 0, 6063, 0},
+    {0, 18, 0, 1, 0, 0, 6064, 0},
+    {0, 18, 0, 1, 0, 0, 6065, 0},
+    {0, 18, 0, 1, 0, 0, 6066, 0},
+    {0, 18, 0, 1, 0, 0, 6067, 0},
+    {0, 18, 0, 1, 0, 0, 6068, 0},
+    {0, 18, 0, 2, 0, 0, 1255, 0},
+    {0, 18, 0, 1, 0, 0, 6069, 0},
+    {0, 18, 0, 1, 0, 0, 6070, 0},
+    {0, 18, 0, 1, 0, 0, 6071, 0},
+    {0, 18, 0, 2, 0, 0, 1259, 0},
+    {0, 18, 0, 1, 0, 0, 6072, 0},
+    {0, 18, 0, 1, 0, 0, 6073, 0},
+    {0, 18, 0, 1, 0, 0, 6074, 0},
+    {0, 18, 0, 1, 0, 0, 6075, 0},
+    {0, 18, 0, 1, 0, 0, 6076, 0},
+    {0, 18, 0, 1, 0, 0, 6077, 0},
+    {0, 18, 0, 1, 0, 0, 6078, 0},
+    {0, 18, 0, 1, 0, 0, 6079, 0},
+    {0, 18, 0, 1, 0, 0, 6080, 0},
+    {0, 18, 0, 3, 0, 0, 6081, 0},
+    {0, 18, 0, 3, 0, 0, 6084, 0},
+    {0, 18, 0, 3, 0, 0, 6087, 0},
+    {0, 18, 0, 3, 0, 0, 6090, 0},
+    {0, 18, 0, 3, 0, 0, 6093, 0},
+    {0, 18, 0, 3, 0, 0, 6096, 0},
+    {0, 18, 0, 3, 0, 0, 6099, 0},
+    {0, 18, 0, 3, 0, 0, 6102, 0},
+    {0, 18, 0, 1, 0, 0, 6105, 0},
+    {0, 18, 0, 3, 0, 0, 6106, 0},
+    {0, 18, 0, 3, 0, 0, 6109, 0},
+    {0, 18, 0, 3, 0, 0, 6112, 0},
+    {0, 18, 0, 3, 0, 0, 6115, 0},
+    {0, 18, 0, 2, 0, 0, 6118, 0},
+    {0, 18, 0, 2, 0, 0, 6120, 0},
+    {0, 18, 0, 2, 0, 0, 6122, 0},
+    {0, 18, 0, 2, 0, 0, 6124, 0},
+    {0, 18, 0, 2, 0, 0, 6126, 0},
+    {0, 18, 0, 2, 0, 0, 6128, 0},
+    {0, 18, 0, 2, 0, 0, 6130, 0},
+    {0, 18, 0, 2, 0, 0, 6132, 0},
+    {0, 18, 0, 2, 0, 0, 6134, 0},
+    {0, 18, 0, 2, 0, 0, 6136, 0},
+    {0, 18, 0, 2, 0, 0, 6138, 0},
+    {0, 18, 0, 2, 0, 0, 6140, 0},
+    {0, 18, 0, 2, 0, 0, 6142, 0},
+    {0, 18, 0, 2, 0, 0, 6144, 0},
+    {0, 18, 0, 2, 0, 0, 6146, 0},
+    {0, 18, 0, 2, 0, 0, 6148, 0},
+    {0, 18, 0, 2, 0, 0, 6150, 0},
+    {0, 18, 0, 2, 0, 0, 6152, 0},
+    {0, 18, 0, 2, 0, 0, 6154, 0},
+    {0, 18, 0, 2, 0, 0, 6156, 0},
+    {0, 18, 0, 2, 0, 0, 6158, 0},
+    {0, 18, 0, 2, 0, 0, 6160, 0},
+    {0, 18, 0, 2, 0, 0, 6162, 0},
+    {0, 18, 0, 2, 0, 0, 6164, 0},
+    {0, 18, 0, 2, 0, 0, 6166, 0},
+    {0, 18, 0, 2, 0, 0, 6168, 0},
+    {0, 18, 0, 2, 0, 0, 6170, 0},
+    {0, 18, 0, 2, 0, 0, 6172, 0},
+    {0, 18, 0, 2, 0, 0, 6174, 0},
+    {0, 18, 0, 2, 0, 0, 6176, 0},
+    {0, 18, 0, 2, 0, 0, 6178, 0},
+    {0, 18, 0, 2, 0, 0, 6180, 0},
+    {0, 18, 0, 2, 0, 0, 6182, 0},
+    {0, 18, 0, 2, 0, 0, 6184, 0},
+    {0, 18, 0, 2, 0, 0, 6186, 0},
+    {0, 18, 0, 2, 0, 0, 6188, 0},
+    {0, 18, 0, 2, 0, 0, 6190, 0},
+    {0, 18, 0, 2, 0, 0, 6192, 0},
+    {0, 18, 0, 2, 0, 0, 6194, 0},
+    {0, 18, 0, 2, 0, 0, 6196, 0},
+    {0, 18, 0, 2, 0, 0, 6198, 0},
+    {0, 18, 0, 2, 0, 0, 6200, 0},
+    {0, 18, 0, 2, 0, 0, 6202, 0},
+    {0, 18, 0, 2, 0, 0, 6204, 0},
+    {0, 18, 0, 2, 0, 0, 6206, 0},
+    {0, 18, 0, 2, 0, 0, 6208, 0},
+    {0, 18, 0, 2, 0, 0, 6210, 0},
+    {0, 18, 0, 2, 0, 0, 6212, 0},
+    {0, 18, 0, 2, 0, 0, 6214, 0},
+    {0, 18, 0, 2, 0, 0, 6216, 0},
+    {0, 18, 0, 2, 0, 0, 6218, 0},
+    {0, 18, 0, 2, 0, 0, 6220, 0},
+    {0, 18, 0, 2, 0, 0, 6222, 0},
+    {0, 18, 0, 2, 0, 0, 6224, 0},
+    {0, 18, 0, 2, 0, 0, 6226, 0},
+    {0, 18, 0, 2, 0, 0, 6228, 0},
+    {0, 18, 0, 2, 0, 0, 6230, 0},
+    {0, 18, 0, 2, 0, 0, 6232, 0},
+    {0, 18, 0, 2, 0, 0, 6234, 0},
+    {0, 18, 0, 2, 0, 0, 6236, 0},
+    {0, 18, 0, 2, 0, 0, 6238, 0},
+    {0, 18, 0, 2, 0, 0, 6240, 0},
+    {0, 18, 0, 2, 0, 0, 6242, 0},
+    {0, 18, 0, 2, 0, 0, 6244, 0},
+    {0, 18, 0, 2, 0, 0, 6246, 0},
+    {0, 18, 0, 2, 0, 0, 6248, 0},
+    {0, 18, 0, 2, 0, 0, 6250, 0},
+    {0, 18, 0, 2, 0, 0, 6252, 0},
+    {0, 18, 0, 2, 0, 0, 6254, 0},
+    {0, 18, 0, 2, 0, 0, 6256, 0},
+    {0, 18, 0, 2, 0, 0, 6258, 0},
+    {0, 18, 0, 2, 0, 0, 6260, 0},
+    {0, 18, 0, 2, 0, 0, 6262, 0},
+    {0, 18, 0, 2, 0, 0, 6264, 0},
+    {0, 18, 0, 2, 0, 0, 6266, 0},
+    {0, 18, 0, 2, 0, 0, 6268, 0},
+    {0, 18, 0, 2, 0, 0, 6270, 0},
+    {0, 18, 0, 2, 0, 0, 6272, 0},
+    {0, 18, 0, 2, 0, 0, 6274, 0},
+    {0, 18, 0, 2, 0, 0, 6276, 0},
+    {0, 18, 0, 2, 0, 0, 6278, 0},
+    {0, 18, 0, 2, 0, 0, 6280, 0},
+    {0, 18, 0, 2, 0, 0, 6282, 0},
+    {0, 18, 0, 2, 0, 0, 6284, 0},
+    {0, 18, 0, 2, 0, 0, 6286, 0},
+    {0, 18, 0, 2, 0, 0, 6288, 0},
+    {0, 18, 0, 2, 0, 0, 6290, 0},
+    {0, 18, 0, 2, 0, 0, 6292, 0},
+    {0, 18, 0, 2, 0, 0, 6294, 0},
+    {0, 18, 0, 3, 0, 0, 6296, 0},
+    {0, 18, 0, 3, 0, 0, 6299, 0},
+    {0, 18, 0, 3, 0, 0, 6302, 0},
+    {0, 18, 0, 3, 0, 0, 6305, 0},
+    {0, 18, 0, 3, 0, 0, 6308, 0},
+    {0, 18, 0, 3, 0, 0, 6311, 0},
+    {0, 18, 0, 3, 0, 0, 6314, 0},
+    {0, 18, 0, 3, 0, 0, 6317, 0},
+    {0, 18, 0, 3, 0, 0, 6320, 0},
+    {0, 18, 0, 2, 0, 0, 6323, 0},
+    {0, 18, 0, 2, 0, 0, 6325, 0},
+    {0, 18, 0, 2, 0, 0, 6327, 0},
+    {0, 18, 0, 2, 0, 0, 6329, 0},
+    {0, 18, 0, 2, 0, 0, 6331, 0},
+    {0, 18, 0, 2, 0, 0, 6333, 0},
+    {0, 18, 0, 2, 0, 0, 6335, 0},
+    {0, 18, 0, 2, 0, 0, 6337, 0},
+    {0, 18, 0, 2, 0, 0, 6339, 0},
+    {0, 18, 0, 2, 0, 0, 6341, 0},
+    {0, 18, 0, 2, 0, 0, 6343, 0},
+    {0, 18, 0, 2, 0, 0, 6345, 0},
+    {0, 18, 0, 2, 0, 0, 6347, 0},
+    {0, 18, 0, 2, 0, 0, 6349, 0},
+    {0, 18, 0, 2, 0, 0, 6351, 0},
+    {0, 18, 0, 2, 0, 0, 6353, 0},
+    {0, 18, 0, 3, 0, 0, 6355, 0},
+    {0, 18, 0, 3, 0, 0, 6358, 0},
+    {0, 18, 0, 2, 0, 0, 6361, 0},
+    {0, 18, 0, 2, 0, 0, 6363, 0},
+    {0, 18, 0, 2, 0, 0, 6365, 0},
+    {0, 18, 0, 2, 0, 0, 6367, 0},
+    {0, 18, 0, 2, 0, 0, 6369, 0},
+    {0, 18, 0, 2, 0, 0, 6371, 0},
+    {0, 18, 0, 2, 0, 0, 6373, 0},
+    {0, 18, 0, 2, 0, 0, 6375, 0},
+    {0, 18, 0, 2, 0, 0, 6377, 0},
+    {0, 18, 0, 2, 0, 0, 6379, 0},
+    {0, 18, 0, 2, 0, 0, 6381, 0},
+    {0, 18, 0, 3, 0, 0, 6383, 0},
+    {0, 18, 0, 3, 0, 0, 6386, 0},
+    {0, 18, 0, 3, 0, 0, 6389, 0},
+    {0, 18, 0, 2, 0, 0, 6392, 0},
+    {0, 18, 0, 2, 0, 0, 6394, 0},
+    {0, 18, 0, 2, 0, 0, 6396, 0},
+    {0, 18, 0, 2, 0, 0, 6398, 0},
+    {0, 18, 0, 2, 0, 0, 6400, 0},
+    {0, 18, 0, 2, 0, 0, 6402, 0},
+    {0, 18, 0, 2, 0, 0, 6404, 0},
+    {0, 18, 0, 2, 0, 0, 6406, 0},
+    {0, 18, 0, 2, 0, 0, 6408, 0},
+    {0, 18, 0, 2, 0, 0, 6410, 0},
+    {0, 18, 0, 2, 0, 0, 6412, 0},
+    {0, 18, 0, 2, 0, 0, 6414, 0},
+    {0, 18, 0, 2, 0, 0, 6416, 0},
+    {0, 18, 0, 2, 0, 0, 6418, 0},
+    {0, 18, 0, 2, 0, 0, 6420, 0},
+    {0, 18, 0, 2, 0, 0, 6422, 0},
+    {0, 18, 0, 2, 0, 0, 6424, 0},
+    {0, 18, 0, 2, 0, 0, 6426, 0},
+    {0, 18, 0, 2, 0, 0, 6428, 0},
+    {0, 18, 0, 2, 0, 0, 6430, 0},
+    {0, 18, 0, 2, 0, 0, 6432, 0},
+    {0, 18, 0, 2, 0, 0, 6434, 0},
+    {0, 18, 0, 2, 0, 0, 6436, 0},
+    {0, 18, 0, 2, 0, 0, 6438, 0},
+    {0, 18, 0, 2, 0, 0, 6440, 0},
+    {0, 18, 0, 2, 0, 0, 6442, 0},
+    {0, 18, 0, 2, 0, 0, 6444, 0},
+    {0, 18, 0, 2, 0, 0, 6446, 0},
+    {0, 18, 0, 3, 0, 0, 6448, 0},
+    {0, 18, 0, 3, 0, 0, 6451, 0},
+    {0, 18, 0, 3, 0, 0, 6454, 0},
+    {0, 18, 0, 3, 0, 0, 6457, 0},
+    {0, 18, 0, 3, 0, 0, 6460, 0},
+    {0, 18, 0, 3, 0, 0, 6463, 0},
+    {0, 18, 0, 3, 0, 0, 6466, 0},
+    {0, 18, 0, 3, 0, 0, 6469, 0},
+    {0, 18, 0, 3, 0, 0, 6472, 0},
+    {0, 18, 0, 3, 0, 0, 6475, 0},
+    {0, 18, 0, 3, 0, 0, 6478, 0},
+    {0, 18, 0, 3, 0, 0, 6481, 0},
+    {0, 18, 0, 3, 0, 0, 6484, 0},
+    {0, 18, 0, 3, 0, 0, 6487, 0},
+    {0, 18, 0, 3, 0, 0, 6490, 0},
+    {0, 18, 0, 3, 0, 0, 6493, 0},
+    {0, 18, 0, 3, 0, 0, 6496, 0},
+    {0, 18, 0, 3, 0, 0, 6499, 0},
+    {0, 18, 0, 3, 0, 0, 6502, 0},
+    {0, 18, 0, 3, 0, 0, 6505, 0},
+    {0, 18, 0, 3, 0, 0, 6508, 0},
+    {0, 18, 0, 3, 0, 0, 6511, 0},
+    {0, 18, 0, 3, 0, 0, 6514, 0},
+    {0, 18, 0, 3, 0, 0, 6517, 0},
+    {0, 18, 0, 3, 0, 0, 6520, 0},
+    {0, 18, 0, 3, 0, 0, 6523, 0},
+    {0, 18, 0, 3, 0, 0, 6526, 0},
+    {0, 18, 0, 3, 0, 0, 6529, 0},
+    {0, 18, 0, 3, 0, 0, 6532, 0},
+    {0, 18, 0, 3, 0, 0, 6535, 0},
+    {0, 18, 0, 3, 0, 0, 6538, 0},
+    {0, 18, 0, 3, 0, 0, 6541, 0},
+    {0, 18, 0, 3, 0, 0, 6544, 0},
+    {0, 18, 0, 3, 0, 0, 6547, 0},
+    {0, 18, 0, 3, 0, 0, 6550, 0},
+    {0, 18, 0, 3, 0, 0, 6553, 0},
+    {0, 18, 0, 3, 0, 0, 6556, 0},
+    {0, 18, 0, 3, 0, 0, 6559, 0},
+    {0, 18, 0, 3, 0, 0, 6562, 0},
+    {0, 18, 0, 3, 0, 0, 6565, 0},
+    {0, 18, 0, 3, 0, 0, 6568, 0},
+    {0, 18, 0, 3, 0, 0, 6571, 0},
+    {0, 18, 0, 3, 0, 0, 6574, 0},
+    {0, 18, 0, 3, 0, 0, 6577, 0},
+    {0, 18, 0, 3, 0, 0, 6580, 0},
+    {0, 18, 0, 3, 0, 0, 6583, 0},
+    {0, 18, 0, 3, 0, 0, 6586, 0},
+    {0, 18, 0, 3, 0, 0, 6589, 0},
+    {0, 18, 0, 3, 0, 0, 6592, 0},
+    {0, 18, 0, 3, 0, 0, 6595, 0},
+    {0, 18, 0, 3, 0, 0, 6598, 0},
+    {0, 18, 0, 3, 0, 0, 6601, 0},
+    {0, 18, 0, 3, 0, 0, 6604, 0},
+    {0, 18, 0, 3, 0, 0, 6607, 0},
+    {0, 18, 0, 3, 0, 0, 6610, 0},
+    {0, 18, 0, 3, 0, 0, 6613, 0},
+    {0, 18, 0, 3, 0, 0, 6616, 0},
+    {0, 18, 0, 3, 0, 0, 6619, 0},
+    {0, 18, 0, 3, 0, 0, 6622, 0},
+    {0, 18, 0, 3, 0, 0, 6625, 0},
+    {0, 18, 0, 3, 0, 0, 6628, 0},
+    {0, 18, 0, 3, 0, 0, 6631, 0},
+    {0, 18, 0, 3, 0, 0, 6634, 0},
+    {0, 18, 0, 3, 0, 0, 6637, 0},
+    {0, 18, 0, 3, 0, 0, 6640, 0},
+    {0, 18, 0, 3, 0, 0, 6643, 0},
+    {0, 18, 0, 3, 0, 0, 6646, 0},
+    {0, 18, 0, 3, 0, 0, 6649, 0},
+    {0, 18, 0, 3, 0, 0, 6652, 0},
+    {0, 18, 0, 3, 0, 0, 6655, 0},
+    {0, 18, 0, 3, 0, 0, 6658, 0},
+    {0, 18, 0, 3, 0, 0, 6661, 0},
+    {0, 18, 0, 3, 0, 0, 6664, 0},
+    {0, 18, 0, 3, 0, 0, 6667, 0},
+    {0, 18, 0, 3, 0, 0, 6670, 0},
+    {0, 18, 0, 3, 0, 0, 6673, 0},
+    {0, 18, 0, 3, 0, 0, 6676, 0},
+    {0, 18, 0, 3, 0, 0, 6679, 0},
+    {0, 18, 0, 3, 0, 0, 6682, 0},
+    {0, 18, 0, 3, 0, 0, 6685, 0},
+    {0, 18, 0, 3, 0, 0, 6688, 0},
+    {0, 18, 0, 3, 0, 0, 6691, 0},
+    {0, 18, 0, 3, 0, 0, 6694, 0},
+    {0, 18, 0, 3, 0, 0, 6697, 0},
+    {0, 18, 0, 3, 0, 0, 6700, 0},
+    {0, 18, 0, 3, 0, 0, 6703, 0},
+    {0, 18, 0, 3, 0, 0, 6706, 0},
+    {0, 18, 0, 3, 0, 0, 6709, 0},
+    {0, 18, 0, 3, 0, 0, 6712, 0},
+    {0, 18, 0, 3, 0, 0, 6715, 0},
+    {0, 18, 0, 3, 0, 0, 6718, 0},
+    {0, 18, 0, 3, 0, 0, 6721, 0},
+    {0, 18, 0, 3, 0, 0, 6724, 0},
+    {0, 18, 0, 3, 0, 0, 6727, 0},
+    {0, 18, 0, 3, 0, 0, 6730, 0},
+    {0, 18, 0, 3, 0, 0, 6733, 0},
+    {0, 18, 0, 4, 0, 0, 6736, 0},
+    {0, 18, 0, 4, 0, 0, 6740, 0},
+    {0, 18, 0, 4, 0, 0, 6744, 0},
+    {0, 18, 0, 4, 0, 0, 6748, 0},
+    {0, 18, 0, 4, 0, 0, 6752, 0},
+    {0, 18, 0, 4, 0, 0, 6756, 0},
+    {0, 18, 0, 4, 0, 0, 6760, 0},
+    {0, 18, 0, 3, 0, 0, 6764, 0},
+    {0, 18, 0, 18, 0, 0, 6767, 0},
+    {0, 18, 0, 8, 0, 0, 6785, 0},
+    {0, 18, 0, 4, 0, 0, 6793, 0},
+    {0, 18, 0, 1, 0, 0, 6797, 0},
+    {0, 18, 0, 1, 0, 0, 6798, 0},
+    {0, 18, 0, 1, 0, 0, 6799, 0},
+    {0, 18, 0, 1, 0, 0, 6800, 0},
+    {0, 18, 0, 1, 0, 0, 836, 0},
+    {0, 18, 0, 1, 0, 0, 6801, 0},
+    {0, 18, 0, 1, 0, 0, 6802, 0},
+    {0, 18, 0, 1, 0, 0, 6803, 0},
+    {0, 18, 0, 1, 0, 0, 6804, 0},
+    {0, 18, 0, 1, 0, 0, 6805, 0},
+    {0, 18, 0, 1, 0, 0, 6806, 0},
+    {0, 18, 0, 1, 0, 0, 6807, 0},
+    {0, 18, 0, 1, 0, 0, 6808, 0},
+    {0, 18, 0, 1, 0, 0, 6809, 0},
+    {0, 18, 0, 1, 0, 0, 6810, 0},
+    {0, 18, 0, 1, 0, 0, 6811, 0},
+    {0, 18, 0, 1, 0, 0, 6812, 0},
+    {0, 18, 0, 1, 0, 0, 6813, 0},
+    {0, 18, 0, 1, 0, 0, 6814, 0},
+    {0, 18, 0, 1, 0, 0, 6815, 0},
+    {0, 18, 0, 1, 0, 0, 3375, 0},
+    {0, 18, 0, 1, 0, 0, 3376, 0},
+    {0, 18, 0, 1, 0, 0, 6816, 0},
+    {0, 18, 0, 1, 0, 0, 6817, 0},
+    {0, 18, 0, 1, 0, 0, 6818, 0},
+    {0, 18, 0, 1, 0, 0, 6819, 0},
+    {0, 18, 0, 1, 0, 0, 6820, 0},
+    {0, 18, 0, 1, 0, 0, 6821, 0},
+    {0, 18, 0, 1, 0, 0, 6822, 0},
+    {0, 18, 0, 1, 0, 0, 6823, 0},
+    {0, 18, 0, 1, 0, 0, 6824, 0},
+    {0, 18, 0, 1, 0, 0, 6825, 0},
+    {0, 18, 0, 1, 0, 0, 6826, 0},
+    {0, 18, 0, 1, 0, 0, 6827, 0},
+    {0, 18, 0, 1, 0, 0, 6828, 0},
+    {0, 18, 0, 1, 0, 0, 6829, 0},
+    {0, 18, 0, 1, 0, 0, 6830, 0},
+    {0, 18, 0, 1, 0, 0, 6831, 0},
+    {0, 18, 0, 2, 0, 0, 6832, 0},
+    {0, 18, 0, 2, 0, 0, 6834, 0},
+    {0, 18, 0, 2, 0, 0, 6836, 0},
+    {0, 18, 0, 2, 0, 0, 6838, 0},
+    {0, 18, 0, 2, 0, 0, 6840, 0},
+    {0, 18, 0, 2, 0, 0, 6842, 0},
+    {0, 18, 0, 2, 0, 0, 6844, 0},
+    {0, 18, 0, 2, 0, 0, 6846, 0},
+    {0, 18, 0, 2, 0, 0, 6848, 0},
+    {0, 18, 0, 2, 0, 0, 6850, 0},
+    {0, 18, 0, 2, 0, 0, 6852, 0},
+    {0, 18, 0, 2, 0, 0, 6854, 0},
+    {0, 18, 0, 2, 0, 0, 6856, 0},
+    {0, 18, 0, 2, 0, 0, 6858, 0},
+    {0, 18, 0, 1, 0, 0, 6860, 0},
+    {0, 18, 0, 2, 0, 0, 1237, 0},
+    {0, 18, 0, 2, 0, 0, 1239, 0},
+    {0, 18, 0, 2, 0, 0, 1241, 0},
+    {0, 18, 0, 2, 0, 0, 1243, 0},
+    {0, 18, 0, 2, 0, 0, 1245, 0},
+    {0, 18, 0, 1, 0, 0, 6861, 0},
+    {0, 18, 0, 1, 0, 0, 6862, 0},
+    {0, 18, 0, 1, 0, 0, 6863, 0},
+    {0, 18, 0, 1, 0, 0, 6864, 0},
+    {0, 18, 0, 1, 0, 0, 6865, 0},
+    {0, 18, 0, 1, 0, 0, 6866, 0},
+    {0, 18, 0, 1, 0, 0, 6867, 0},
+    {0, 18, 0, 1, 0, 0, 6868, 0},
+    {0, 18, 0, 1, 0, 0, 6869, 0},
+    {0, 18, 0, 1, 0, 0, 6870, 0},
+    {0, 18, 0, 1, 0, 0, 6871, 0},
+    {0, 18, 0, 1, 0, 0, 6872, 0},
+    {0, 18, 0, 1, 0, 0, 6873, 0},
+    {0, 18, 0, 1, 0, 0, 6874, 0},
+    {0, 18, 0, 1, 0, 0, 6875, 0},
+    {0, 18, 0, 1, 0, 0, 6876, 0},
+    {0, 18, 0, 1, 0, 0, 6877, 0},
+    {0, 18, 0, 1, 0, 0, 6878, 0},
+    {0, 18, 0, 1, 0, 0, 6879, 0},
+    {0, 18, 0, 1, 0, 0, 6880, 0},
+    {0, 18, 0, 1, 0, 0, 6881, 0},
+    {0, 18, 0, 1, 0, 0, 6882, 0},
+    {0, 18, 0, 1, 0, 0, 6883, 0},
+    {0, 18, 0, 1, 0, 0, 6884, 0},
+    {0, 18, 0, 1, 0, 0, 6885, 0},
+    {0, 18, 0, 1, 0, 0, 6886, 0},
+    {0, 18, 0, 1, 0, 0, 6887, 0},
+    {0, 18, 0, 1, 0, 0, 6888, 0},
+    {0, 18, 0, 1, 0, 0, 6889, 0},
+    {0, 18, 0, 3, 0, 0, 6890, 0},
+    {0, 18, 0, 3, 0, 0, 6893, 0},
+    {0, 18, 0, 3, 0, 0, 6896, 0},
+    {0, 18, 0, 2, 0, 0, 6899, 0},
+    {0, 18, 0, 1, 0, 0, 6901, 0},
+    {0, 18, 0, 1, 0, 0, 6902, 0},
+    {0, 18, 0, 1, 0, 0, 6903, 0},
+    {0, 18, 0, 1, 1, 0, 1596, 6904},
+    {0, 18, 0, 1, 1, 0, 1598, 6905},
+    {0, 18, 0, 1, 1, 0, 3125, 6906},
+    {0, 18, 0, 1, 1, 0, 1599, 6907},
+    {0, 18, 0, 1, 1, 0, 1600, 6908},
+    {0, 18, 0, 1, 1, 0, 3149, 6909},
+    {0, 18, 0, 1, 1, 0, 1602, 6910},
+    {0, 18, 0, 1, 1, 0, 1603, 6911},
+    {0, 18, 0, 1, 1, 0, 1604, 6912},
+    {0, 18, 0, 1, 1, 0, 1605, 6913},
+    {0, 18, 0, 1, 1, 0, 1606, 6914},
+    {0, 18, 0, 1, 1, 0, 1607, 6915},
+    {0, 18, 0, 1, 1, 0, 1608, 6916},
+    {0, 18, 0, 1, 1, 0, 1609, 6917},
+    {0, 18, 0, 1, 1, 0, 1610, 6918},
+    {0, 18, 0, 1, 1, 0, 1612, 6919},
+    {0, 18, 0, 1, 1, 0, 3139, 6920},
+    {0, 18, 0, 1, 1, 0, 1613, 6921},
+    {0, 18, 0, 1, 1, 0, 3617, 6922},
+    {0, 18, 0, 1, 1, 0, 1614, 6923},
+    {0, 18, 0, 1, 1, 0, 1615, 6924},
+    {0, 18, 0, 1, 1, 0, 3220, 6925},
+    {0, 18, 0, 1, 1, 0, 1616, 6926},
+    {0, 18, 0, 1, 1, 0, 3237, 6927},
+    {0, 18, 0, 1, 1, 0, 3624, 6928},
+    {0, 18, 0, 1, 1, 0, 3147, 6929},
+    {0, 18, 0, 1, 0, 0, 6930, 0},
+    {0, 18, 0, 1, 0, 0, 3042, 0},
+    {0, 18, 0, 1, 0, 0, 6931, 0},
+    {0, 18, 0, 1, 0, 0, 6932, 0},
+    {0, 18, 0, 1, 0, 0, 6933, 0},
+    {0, 18, 0, 1, 0, 0, 6934, 0},
+    {0, 18, 0, 1, 0, 0, 6935, 0},
+    {0, 18, 0, 1, 0, 0, 6936, 0},
+    {0, 18, 0, 1, 0, 0, 6937, 0},
+    {0, 18, 0, 1, 0, 0, 6938, 0},
+    {0, 18, 0, 1, 0, 0, 6939, 0},
+    {0, 18, 0, 1, 0, 0, 6940, 0},
+    {0, 18, 0, 1, 0, 0, 6941, 0},
+    {0, 18, 0, 1, 0, 0, 6942, 0},
+    {0, 18, 0, 1, 0, 0, 6943, 0},
+    {0, 18, 0, 1, 0, 0, 6944, 0},
+    {0, 18, 0, 1, 0, 0, 6945, 0},
+    {0, 18, 0, 1, 0, 0, 6946, 0},
+    {0, 18, 0, 1, 0, 0, 6947, 0},
+    {0, 18, 0, 1, 0, 0, 6948, 0},
+    {0, 18, 0, 1, 0, 0, 6949, 0},
+    {0, 18, 0, 1, 0, 0, 6950, 0},
+    {0, 18, 0, 1, 0, 0, 6951, 0},
+    {0, 18, 0, 1, 0, 0, 6952, 0},
+    {0, 18, 0, 1, 0, 0, 6953, 0},
+    {0, 18, 0, 1, 0, 0, 6954, 0},
+    {0, 18, 0, 1, 0, 0, 6955, 0},
+    {0, 18, 0, 1, 0, 0, 6956, 0},
+    {0, 18, 0, 1, 0, 0, 6957, 0},
+    {0, 18, 0, 1, 0, 0, 6958, 0},
+    {0, 18, 0, 1, 0, 0, 6959, 0},
+    {0, 18, 0, 1, 0, 0, 6960, 0},
+    {0, 18, 0, 1, 0, 0, 6961, 0},
+    {0, 0, 0, 0, 1, 0, 0, 6962},
+    {0, 0, 0, 0, 1, 0, 0, 6963},
+    {0, 0, 0, 0, 1, 0, 0, 6964},
+    {0, 0, 0, 0, 1, 0, 0, 6965},
+    {0, 0, 0, 0, 1, 0, 0, 6966},
+    {0, 0, 0, 0, 1, 0, 0, 6967},
+    {0, 0, 0, 0, 1, 0, 0, 6968},
+    {0, 0, 0, 0, 1, 0, 0, 6969},
+    {0, 0, 0, 0, 1, 0, 0, 6970},
+    {0, 0, 0, 0, 1, 0, 0, 6971},
+    {0, 0, 0, 0, 1, 0, 0, 6972},
+    {0, 0, 0, 0, 1, 0, 0, 6973},
+    {0, 0, 0, 0, 1, 0, 0, 6974},
+    {0, 0, 0, 0, 1, 0, 0, 6975},
+    {0, 0, 0, 0, 1, 0, 0, 6976},
+    {0, 0, 0, 0, 1, 0, 0, 6977},
+    {0, 0, 0, 0, 1, 0, 0, 6978},
+    {0, 0, 0, 0, 1, 0, 0, 6979},
+    {0, 0, 0, 0, 1, 0, 0, 6980},
+    {0, 0, 0, 0, 1, 0, 0, 6981},
+    {0, 0, 0, 0, 1, 0, 0, 6982},
+    {0, 0, 0, 0, 1, 0, 0, 6983},
+    {0, 0, 0, 0, 1, 0, 0, 6984},
+    {0, 0, 0, 0, 1, 0, 0, 6985},
+    {0, 0, 0, 0, 1, 0, 0, 6986},
+    {0, 0, 0, 0, 1, 0, 0, 6987},
+    {0, 0, 0, 0, 1, 0, 0, 6988},
+    {0, 0, 0, 0, 1, 0, 0, 6989},
+    {0, 0, 0, 0, 1, 0, 0, 6990},
+    {0, 0, 0, 0, 1, 0, 0, 6991},
+    {0, 0, 0, 0, 1, 0, 0, 6992},
+    {0, 0, 0, 0, 1, 0, 0, 6993},
+    {0, 0, 0, 0, 1, 0, 0, 6994},
+    {0, 0, 0, 0, 1, 0, 0, 6995},
+    {0, 0, 0, 0, 1, 0, 0, 6996},
+    {0, 0, 0, 0, 1, 0, 0, 6997},
+    {0, 0, 0, 0, 1, 0, 0, 6998},
+    {0, 0, 0, 0, 1, 0, 0, 6999},
+    {0, 0, 0, 0, 1, 0, 0, 7000},
+    {0, 0, 0, 0, 1, 0, 0, 7001},
+    {0, 0, 0, 0, 1, 0, 0, 7002},
+    {0, 0, 0, 0, 1, 0, 0, 7003},
+    {0, 0, 0, 0, 1, 0, 0, 7004},
+    {0, 0, 0, 0, 1, 0, 0, 7005},
+    {0, 0, 0, 0, 1, 0, 0, 7006},
+    {0, 0, 0, 0, 1, 0, 0, 7007},
+    {0, 0, 0, 0, 1, 0, 0, 7008},
+    {0, 0, 0, 0, 1, 0, 0, 7009},
+    {0, 0, 0, 0, 1, 0, 0, 7010},
+    {0, 0, 0, 0, 1, 0, 0, 7011},
+    {0, 0, 0, 0, 1, 0, 0, 7012},
+    {0, 0, 0, 0, 1, 0, 0, 7013},
+    {0, 0, 0, 0, 1, 0, 0, 7014},
+    {0, 0, 0, 0, 1, 0, 0, 7015},
+    {0, 0, 0, 0, 1, 0, 0, 7016},
+    {0, 0, 0, 0, 1, 0, 0, 7017},
+    {0, 0, 0, 0, 1, 0, 0, 7018},
+    {0, 0, 0, 0, 1, 0, 0, 7019},
+    {0, 0, 0, 0, 1, 0, 0, 7020},
+    {0, 0, 0, 0, 1, 0, 0, 7021},
+    {0, 0, 0, 0, 1, 0, 0, 7022},
+    {0, 0, 0, 0, 1, 0, 0, 7023},
+    {0, 0, 0, 0, 1, 0, 0, 7024},
+    {0, 0, 0, 0, 1, 0, 0, 7025},
+    {0, 0, 0, 0, 1, 0, 0, 7026},
+    {0, 0, 0, 0, 1, 0, 0, 7027},
+    {0, 0, 0, 0, 1, 0, 0, 7028},
+    {0, 0, 0, 0, 1, 0, 0, 7029},
+    {0, 0, 0, 0, 1, 0, 0, 7030},
+    {0, 0, 0, 0, 1, 0, 0, 7031},
+    {0, 0, 0, 0, 1, 0, 0, 7032},
+    {0, 0, 0, 0, 1, 0, 0, 7033},
+    {0, 0, 0, 0, 1, 0, 0, 7034},
+    {0, 0, 0, 0, 1, 0, 0, 7035},
+    {0, 0, 0, 0, 1, 0, 0, 7036},
+    {0, 0, 0, 0, 1, 0, 0, 7037},
+    {0, 0, 0, 0, 1, 0, 0, 7038},
+    {0, 0, 0, 0, 1, 0, 0, 7039},
+    {0, 0, 0, 0, 1, 0, 0, 7040},
+    {0, 0, 0, 0, 1, 0, 0, 7041},
+    {0, 0, 0, 0, 1, 0, 0, 7042},
+    {0, 0, 0, 0, 1, 0, 0, 7043},
+    {0, 0, 0, 0, 1, 0, 0, 7044},
+    {0, 0, 0, 0, 1, 0, 0, 7045},
+    {0, 0, 0, 0, 1, 0, 0, 7046},
+    {0, 0, 0, 0, 1, 0, 0, 7047},
+    {0, 0, 0, 0, 1, 0, 0, 7048},
+    {0, 0, 0, 0, 1, 0, 0, 7049},
+    {0, 0, 0, 0, 1, 0, 0, 7050},
+    {0, 0, 0, 0, 1, 0, 0, 7051},
+    {0, 0, 0, 0, 1, 0, 0, 7052},
+    {0, 0, 0, 0, 1, 0, 0, 7053},
+    {0, 0, 0, 0, 1, 0, 0, 7054},
+    {0, 0, 0, 0, 1, 0, 0, 7055},
+    {0, 0, 0, 0, 1, 0, 0, 7056},
+    {0, 0, 0, 0, 1, 0, 0, 7057},
+    {0, 0, 0, 0, 1, 0, 0, 7058},
+    {0, 0, 0, 0, 1, 0, 0, 7059},
+    {0, 0, 0, 0, 1, 0, 0, 7060},
+    {0, 0, 0, 0, 1, 0, 0, 7061},
+    {0, 0, 0, 0, 1, 0, 0, 7062},
+    {0, 0, 0, 0, 1, 0, 0, 7063},
+    {0, 0, 0, 0, 1, 0, 0, 7064},
+    {0, 0, 0, 0, 1, 0, 0, 7065},
+    {0, 0, 0, 0, 1, 0, 0, 7066},
+    {0, 0, 0, 0, 1, 0, 0, 7067},
+    {0, 0, 0, 0, 1, 0, 0, 7068},
+    {0, 0, 0, 0, 1, 0, 0, 7069},
+    {0, 0, 0, 0, 1, 0, 0, 7070},
+    {0, 0, 0, 0, 1, 0, 0, 7071},
+    {0, 0, 0, 0, 1, 0, 0, 7072},
+    {0, 18, 0, 1, 0, 0, 7073, 0},
+    {0, 18, 0, 1, 0, 0, 7074, 0},
+    {0, 18, 0, 1, 0, 0, 66, 0},
+    {0, 18, 0, 1, 0, 0, 7075, 0},
+    {0, 18, 0, 1, 0, 0, 474, 0},
+    {0, 18, 0, 1, 0, 0, 7076, 0},
+    {0, 18, 0, 1, 0, 0, 7077, 0},
+    {0, 18, 0, 1, 0, 0, 7078, 0},
+    {0, 18, 0, 1, 0, 0, 7079, 0},
+    {0, 18, 0, 1, 0, 0, 479, 0},
+    {0, 18, 0, 1, 0, 0, 480, 0},
+    {0, 18, 0, 1, 0, 0, 7080, 0},
+    {0, 18, 0, 1, 0, 0, 7081, 0},
+    {0, 18, 0, 1, 0, 0, 7082, 0},
+    {0, 18, 0, 1, 0, 0, 7083, 0},
+    {0, 18, 0, 1, 0, 0, 7084, 0},
+    {0, 18, 0, 1, 0, 0, 7085, 0},
+    {0, 18, 0, 1, 0, 0, 486, 0},
+    {0, 18, 0, 1, 0, 0, 7086, 0},
+    {0, 18, 0, 1, 0, 0, 7087, 0},
+    {0, 18, 0, 1, 0, 0, 7088, 0},
+    {0, 18, 0, 1, 0, 0, 7089, 0},
+    {0, 18, 0, 1, 0, 0, 7090, 0},
+    {0, 18, 0, 1, 0, 0, 7091, 0},
+    {0, 18, 0, 1, 0, 0, 5511, 0},
+    {0, 18, 0, 1, 0, 0, 7092, 0},
+    {0, 18, 0, 1, 0, 0, 7093, 0},
+    {0, 18, 0, 1, 0, 0, 7094, 0},
+    {0, 18, 0, 1, 0, 0, 7095, 0},
+    {0, 18, 0, 1, 0, 0, 7096, 0},
+    {0, 18, 0, 1, 0, 0, 7097, 0},
+    {0, 18, 0, 1, 0, 0, 113, 0},
+    {0, 18, 0, 1, 0, 0, 7098, 0},
+    {0, 18, 0, 1, 0, 0, 7099, 0},
+    {0, 18, 0, 1, 0, 0, 7100, 0},
+    {0, 18, 0, 1, 0, 0, 7101, 0},
+    {0, 18, 0, 1, 0, 0, 3692, 0},
+    {0, 18, 0, 1, 0, 0, 7102, 0},
+    {0, 18, 0, 1, 0, 0, 501, 0},
+    {0, 18, 0, 1, 0, 0, 7103, 0},
+    {0, 18, 0, 1, 0, 0, 7104, 0},
+    {0, 18, 0, 1, 0, 0, 7105, 0},
+    {0, 18, 0, 1, 0, 0, 7106, 0},
+    {0, 18, 0, 1, 0, 0, 505, 0},
+    {0, 18, 0, 1, 0, 0, 7107, 0},
+    {0, 18, 0, 1, 0, 0, 7108, 0},
+    {0, 18, 0, 1, 0, 0, 7109, 0},
+    {0, 18, 0, 1, 0, 0, 7110, 0},
+    {0, 18, 0, 1, 0, 0, 7111, 0},
+    {0, 18, 0, 1, 0, 0, 7112, 0},
+    {0, 18, 0, 1, 0, 0, 7113, 0},
+    {0, 18, 0, 1, 0, 0, 7114, 0},
+    {0, 18, 0, 1, 0, 0, 7115, 0},
+    {0, 18, 0, 1, 0, 0, 7116, 0},
+    {0, 0, 0, 0, 1, 0, 0, 7117},
+    {0, 0, 0, 0, 1, 0, 0, 7118},
+    {0, 0, 0, 0, 1, 0, 0, 7119},
+    {0, 0, 0, 0, 1, 0, 0, 7120},
+    {0, 0, 0, 0, 1, 0, 0, 7121},
+    {0, 0, 0, 0, 1, 0, 0, 7122},
+    {0, 0, 0, 0, 1, 0, 0, 7123},
+    {0, 0, 0, 0, 1, 0, 0, 7124},
+    {0, 0, 0, 0, 1, 0, 0, 7125},
+    {0, 0, 0, 0, 1, 0, 0, 7126},
+    {0, 0, 0, 0, 1, 0, 0, 7127},
+    {0, 0, 0, 0, 1, 0, 0, 7128},
+    {0, 0, 0, 0, 1, 0, 0, 7129},
+    {0, 0, 0, 0, 1, 0, 0, 7130},
+    {0, 0, 0, 0, 1, 0, 0, 7131},
+    {0, 0, 0, 0, 1, 0, 0, 7132},
+    {0, 0, 0, 0, 1, 0, 0, 7133},
+    {0, 0, 0, 0, 1, 0, 0, 7134},
+    {0, 0, 0, 0, 1, 0, 0, 7135},
+    {0, 0, 0, 0, 1, 0, 0, 7136},
+    {0, 0, 0, 0, 1, 0, 0, 7137},
+    {0, 0, 0, 0, 1, 0, 0, 7138},
+    {0, 0, 0, 0, 1, 0, 0, 7139},
+    {0, 0, 0, 0, 1, 0, 0, 7140},
+    {0, 0, 0, 0, 1, 0, 0, 7141},
+    {0, 0, 0, 0, 1, 0, 0, 7142},
+    {0, 0, 0, 0, 1, 0, 0, 7143},
+    {0, 0, 0, 0, 1, 0, 0, 7144},
+    {0, 0, 0, 0, 1, 0, 0, 7145},
+    {0, 0, 0, 0, 1, 0, 0, 7146},
+    {0, 0, 0, 0, 1, 0, 0, 7147},
+    {0, 0, 0, 0, 1, 0, 0, 7148},
+    {0, 0, 0, 0, 1, 0, 0, 7149},
+    {0, 0, 0, 0, 1, 0, 0, 7150},
+    {0, 0, 0, 0, 1, 0, 0, 7151},
+    {0, 0, 0, 0, 1, 0, 0, 7152},
+    {0, 0, 0, 0, 1, 0, 0, 7153},
+    {0, 0, 0, 0, 1, 0, 0, 7154},
+    {0, 0, 0, 0, 1, 0, 0, 7155},
+    {0, 0, 0, 0, 1, 0, 0, 7156},
+    {0, 0, 0, 0, 1, 0, 0, 7157},
+    {0, 0, 0, 0, 1, 0, 0, 7158},
+    {0, 0, 0, 0, 1, 0, 0, 7159},
+    {0, 0, 0, 0, 1, 0, 0, 7160},
+    {0, 0, 0, 0, 1, 0, 0, 7161},
+    {0, 0, 0, 0, 1, 0, 0, 7162},
+    {0, 0, 0, 0, 1, 0, 0, 7163},
+    {0, 0, 0, 0, 1, 0, 0, 7164},
+    {0, 0, 0, 0, 1, 0, 0, 7165},
+    {0, 0, 0, 0, 1, 0, 0, 7166},
+    {0, 0, 0, 0, 1, 0, 0, 7167},
+    {0, 3, 2, 2, 0, 7168, 7168, 0},
+    {0, 3, 2, 2, 0, 7170, 7170, 0},
+    {0, 3, 2, 2, 0, 7172, 7172, 0},
+    {0, 67, 2, 2, 0, 7174, 7174, 0},
+    {0, 67, 2, 2, 0, 7176, 7176, 0},
+    {0, 3, 2, 2, 0, 7178, 7178, 0},
+    {0, 3, 2, 2, 0, 7180, 7180, 0},
+    {0, 3, 2, 2, 0, 7182, 7182, 0},
+    {0, 3, 2, 2, 0, 7184, 7184, 0},
+    {0, 3, 2, 2, 0, 7186, 7186, 0},
+    {0, 3, 2, 2, 0, 7188, 7188, 0},
+    {0, 3, 2, 2, 0, 7190, 7190, 0},
+    {0, 0, 0, 0, 1, 0, 0, 7192},
+    {0, 0, 0, 0, 1, 0, 0, 7193},
+    {0, 0, 0, 0, 1, 0, 0, 7194},
+    {0, 0, 0, 0, 1, 0, 0, 7195},
+    {0, 0, 0, 0, 1, 0, 0, 7196},
+    {0, 0, 0, 0, 1, 0, 0, 7197},
+    {0, 0, 0, 0, 1, 0, 0, 7198},
+    {0, 0, 0, 0, 1, 0, 0, 7199},
+    {0, 0, 0, 0, 1, 0, 0, 7200},
+    {0, 0, 0, 0, 1, 0, 0, 7201},
+    {0, 0, 0, 0, 1, 0, 0, 7202},
+    {0, 0, 0, 0, 1, 0, 0, 7203},
+    {0, 0, 0, 0, 1, 0, 0, 7204},
+    {0, 0, 0, 0, 1, 0, 0, 7205},
+    {0, 0, 0, 0, 1, 0, 0, 7206},
+    {0, 0, 0, 0, 1, 0, 0, 7207},
+    {0, 0, 0, 0, 1, 0, 0, 7208},
+    {0, 0, 0, 0, 1, 0, 0, 7209},
+    {0, 0, 0, 0, 1, 0, 0, 7210},
+    {0, 0, 0, 0, 1, 0, 0, 7211},
+    {0, 0, 0, 0, 1, 0, 0, 7212},
+    {0, 0, 0, 0, 1, 0, 0, 7213},
+    {0, 0, 0, 0, 1, 0, 0, 7214},
+    {0, 0, 0, 0, 1, 0, 0, 7215},
+    {0, 0, 0, 0, 1, 0, 0, 7216},
+    {0, 0, 0, 0, 1, 0, 0, 7217},
+    {0, 0, 0, 0, 1, 0, 0, 7218},
+    {0, 0, 0, 0, 1, 0, 0, 7219},
+    {0, 0, 0, 0, 1, 0, 0, 7220},
+    {0, 0, 0, 0, 1, 0, 0, 7221},
+    {0, 0, 0, 0, 1, 0, 0, 7222},
+    {0, 0, 0, 0, 1, 0, 0, 7223},
+    {0, 3, 2, 2, 0, 7224, 7224, 0},
+    {0, 0, 0, 0, 1, 0, 0, 7226},
+    {0, 0, 0, 0, 1, 0, 0, 7227},
+    {0, 0, 0, 0, 1, 0, 0, 7228},
+    {0, 0, 0, 0, 1, 0, 0, 7229},
+    {0, 0, 0, 0, 1, 0, 0, 7230},
+    {0, 0, 0, 0, 1, 0, 0, 7231},
+    {0, 0, 0, 0, 1, 0, 0, 7232},
+    {0, 0, 0, 0, 1, 0, 0, 7233},
+    {0, 0, 0, 0, 1, 0, 0, 7234},
+    {0, 0, 0, 0, 1, 0, 0, 7235},
+    {0, 0, 0, 0, 1, 0, 0, 7236},
+    {0, 0, 0, 0, 1, 0, 0, 7237},
+    {0, 0, 0, 0, 1, 0, 0, 7238},
+    {0, 0, 0, 0, 1, 0, 0, 7239},
+    {0, 0, 0, 0, 1, 0, 0, 7240},
+    {0, 0, 0, 0, 1, 0, 0, 7241},
+    {0, 0, 0, 0, 1, 0, 0, 7242},
+    {0, 0, 0, 0, 1, 0, 0, 7243},
+    {0, 0, 0, 0, 1, 0, 0, 7244},
+    {0, 0, 0, 0, 1, 0, 0, 7245},
+    {0, 0, 0, 0, 1, 0, 0, 7246},
+    {0, 0, 0, 0, 1, 0, 0, 7247},
+    {0, 0, 0, 0, 1, 0, 0, 7248},
+    {0, 0, 0, 0, 1, 0, 0, 7249},
+    {0, 0, 0, 0, 1, 0, 0, 7250},
+    {0, 0, 0, 0, 1, 0, 0, 7251},
+    {0, 0, 0, 0, 1, 0, 0, 7252},
+    {0, 0, 0, 0, 1, 0, 0, 7253},
+    {0, 0, 0, 0, 1, 0, 0, 7254},
+    {0, 0, 0, 0, 1, 0, 0, 7255},
+    {0, 0, 0, 0, 1, 0, 0, 7256},
+    {0, 0, 0, 0, 1, 0, 0, 7257},
+    {6, 0, 0, 0, 0, 0, 0, 0},
+    {0, 23, 2, 2, 0, 7258, 7258, 0},
+    {0, 23, 2, 2, 0, 7260, 7260, 0},
+    {0, 23, 3, 3, 0, 7262, 7262, 0},
+    {0, 23, 3, 3, 0, 7265, 7265, 0},
+    {0, 23, 3, 3, 0, 7268, 7268, 0},
+    {0, 23, 3, 3, 0, 7271, 7271, 0},
+    {0, 23, 3, 3, 0, 7274, 7274, 0},
+    {216, 0, 0, 0, 0, 0, 0, 0},
+    {226, 0, 0, 0, 0, 0, 0, 0},
+    {0, 23, 2, 2, 0, 7277, 7277, 0},
+    {0, 23, 2, 2, 0, 7279, 7279, 0},
+    {0, 23, 3, 3, 0, 7281, 7281, 0},
+    {0, 23, 3, 3, 0, 7284, 7284, 0},
+    {0, 23, 3, 3, 0, 7287, 7287, 0},
+    {0, 23, 3, 3, 0, 7290, 7290, 0},
+    {0, 18, 0, 1, 0, 0, 3617, 0},
+    {0, 18, 0, 1, 0, 0, 3237, 0},
+    {0, 18, 0, 1, 0, 0, 3624, 0},
+    {0, 18, 0, 1, 0, 0, 7293, 0},
+    {0, 18, 0, 1, 0, 0, 7294, 0},
+    {0, 18, 0, 1, 0, 0, 7295, 0},
+    {0, 18, 0, 1, 0, 0, 7296, 0},
+    {0, 18, 0, 1, 0, 0, 7297, 0},
+    {0, 18, 0, 1, 0, 0, 7298, 0},
+    {0, 18, 0, 1, 0, 0, 7299, 0},
+    {0, 18, 0, 1, 0, 0, 7300, 0},
+    {0, 18, 0, 1, 0, 0, 937, 0},
+    {0, 18, 0, 1, 0, 0, 7301, 0},
+    {0, 18, 0, 1, 0, 0, 7302, 0},
+    {0, 18, 0, 1, 0, 0, 7303, 0},
+    {0, 18, 0, 1, 0, 0, 7304, 0},
+    {0, 18, 0, 1, 0, 0, 7305, 0},
+    {0, 18, 0, 1, 0, 0, 7306, 0},
+    {0, 18, 0, 1, 0, 0, 7307, 0},
+    {0, 18, 0, 1, 0, 0, 7308, 0},
+    {0, 18, 0, 1, 0, 0, 939, 0},
+    {0, 18, 0, 1, 0, 0, 7309, 0},
+    {0, 18, 0, 1, 0, 0, 7310, 0},
+    {0, 18, 0, 1, 0, 0, 7311, 0},
+    {0, 18, 0, 1, 0, 0, 7312, 0},
+    {0, 18, 0, 1, 0, 0, 3148, 0},
+    {0, 18, 0, 1, 0, 0, 7313, 0},
+    {0, 18, 0, 1, 0, 0, 868, 0},
+    {0, 18, 0, 1, 0, 0, 873, 0},
+    {0, 18, 0, 1, 0, 0, 874, 0},
+    {0, 18, 0, 1, 0, 0, 876, 0},
+    {0, 18, 0, 1, 0, 0, 878, 0},
+    {0, 18, 0, 1, 0, 0, 879, 0},
+    {0, 18, 0, 1, 0, 0, 880, 0},
+    {0, 18, 0, 1, 0, 0, 881, 0},
+    {0, 18, 0, 1, 0, 0, 884, 0},
+    {0, 18, 0, 1, 0, 0, 885, 0},
+    {0, 18, 0, 1, 0, 0, 886, 0},
+    {0, 18, 0, 1, 0, 0, 889, 0},
+    {0, 18, 0, 1, 0, 0, 890, 0},
+    {0, 18, 0, 1, 0, 0, 7314, 0},
+    {0, 18, 0, 1, 0, 0, 7315, 0},
+    {0, 18, 0, 1, 0, 0, 926, 0},
+    {0, 0, 0, 0, 1, 0, 0, 7316},
+    {0, 0, 0, 0, 1, 0, 0, 7317},
+    {0, 0, 0, 0, 1, 0, 0, 7318},
+    {0, 0, 0, 0, 1, 0, 0, 7319},
+    {0, 0, 0, 0, 1, 0, 0, 7320},
+    {0, 0, 0, 0, 1, 0, 0, 7321},
+    {0, 0, 0, 0, 1, 0, 0, 7322},
+    {0, 0, 0, 0, 1, 0, 0, 7323},
+    {0, 0, 0, 0, 1, 0, 0, 7324},
+    {0, 0, 0, 0, 1, 0, 0, 7325},
+    {0, 0, 0, 0, 1, 0, 0, 7326},
+    {0, 0, 0, 0, 1, 0, 0, 7327},
+    {0, 0, 0, 0, 1, 0, 0, 7328},
+    {0, 0, 0, 0, 1, 0, 0, 7329},
+    {0, 0, 0, 0, 1, 0, 0, 7330},
+    {0, 0, 0, 0, 1, 0, 0, 7331},
+    {0, 0, 0, 0, 1, 0, 0, 7332},
+    {0, 0, 0, 0, 1, 0, 0, 7333},
+    {0, 0, 0, 0, 1, 0, 0, 7334},
+    {0, 0, 0, 0, 1, 0, 0, 7335},
+    {0, 0, 0, 0, 1, 0, 0, 7336},
+    {0, 0, 0, 0, 1, 0, 0, 7337},
+    {0, 0, 0, 0, 1, 0, 0, 7338},
+    {0, 0, 0, 0, 1, 0, 0, 7339},
+    {0, 0, 0, 0, 1, 0, 0, 7340},
+    {0, 0, 0, 0, 1, 0, 0, 7341},
+    {0, 0, 0, 0, 1, 0, 0, 7342},
+    {0, 0, 0, 0, 1, 0, 0, 7343},
+    {0, 0, 0, 0, 1, 0, 0, 7344},
+    {0, 0, 0, 0, 1, 0, 0, 7345},
+    {0, 0, 0, 0, 1, 0, 0, 7346},
+    {0, 0, 0, 0, 1, 0, 0, 7347},
+    {0, 0, 0, 0, 1, 0, 0, 7348},
+    {0, 0, 0, 0, 1, 0, 0, 7349},
+    {0, 18, 0, 1, 0, 0, 7350, 0},
+    {0, 18, 0, 1, 0, 0, 7351, 0},
+    {0, 18, 0, 1, 0, 0, 7352, 0},
+    {0, 18, 0, 2, 0, 0, 7353, 0},
+    {0, 18, 0, 2, 0, 0, 7355, 0},
+    {0, 18, 0, 2, 0, 0, 7357, 0},
+    {0, 18, 0, 2, 0, 0, 7359, 0},
+    {0, 18, 0, 2, 0, 0, 7361, 0},
+    {0, 18, 0, 2, 0, 0, 7363, 0},
+    {0, 18, 0, 2, 0, 0, 7365, 0},
+    {0, 18, 0, 2, 0, 0, 7367, 0},
+    {0, 18, 0, 2, 0, 0, 7369, 0},
+    {0, 18, 0, 2, 0, 0, 7371, 0},
+    {0, 18, 0, 2, 0, 0, 7373, 0},
+    {0, 18, 0, 3, 0, 0, 7375, 0},
+    {0, 18, 0, 3, 0, 0, 7378, 0},
+    {0, 18, 0, 3, 0, 0, 7381, 0},
+    {0, 18, 0, 3, 0, 0, 7384, 0},
+    {0, 18, 0, 3, 0, 0, 7387, 0},
+    {0, 18, 0, 3, 0, 0, 7390, 0},
+    {0, 18, 0, 3, 0, 0, 7393, 0},
+    {0, 18, 0, 3, 0, 0, 7396, 0},
+    {0, 18, 0, 3, 0, 0, 7399, 0},
+    {0, 18, 0, 3, 0, 0, 7402, 0},
+    {0, 18, 0, 3, 0, 0, 7405, 0},
+    {0, 18, 0, 3, 0, 0, 7408, 0},
+    {0, 18, 0, 3, 0, 0, 7411, 0},
+    {0, 18, 0, 3, 0, 0, 7414, 0},
+    {0, 18, 0, 3, 0, 0, 7417, 0},
+    {0, 18, 0, 3, 0, 0, 7420, 0},
+    {0, 18, 0, 3, 0, 0, 7423, 0},
+    {0, 18, 0, 3, 0, 0, 7426, 0},
+    {0, 18, 0, 3, 0, 0, 7429, 0},
+    {0, 18, 0, 3, 0, 0, 7432, 0},
+    {0, 18, 0, 3, 0, 0, 7435, 0},
+    {0, 18, 0, 3, 0, 0, 7438, 0},
+    {0, 18, 0, 3, 0, 0, 7441, 0},
+    {0, 18, 0, 3, 0, 0, 7444, 0},
+    {0, 18, 0, 3, 0, 0, 7447, 0},
+    {0, 18, 0, 3, 0, 0, 7450, 0},
+    {0, 18, 0, 3, 0, 0, 7453, 0},
+    {0, 18, 0, 2, 0, 0, 7456, 0},
+    {0, 18, 0, 2, 0, 0, 7458, 0},
+    {0, 18, 0, 2, 0, 0, 7460, 0},
+    {0, 18, 0, 2, 0, 0, 7462, 0},
+    {0, 18, 0, 2, 0, 0, 7464, 0},
+    {0, 18, 0, 3, 0, 0, 7466, 0},
+    {0, 18, 0, 2, 0, 0, 7469, 0},
+    {0, 18, 0, 2, 0, 0, 7471, 0},
+    {0, 18, 0, 2, 0, 0, 7473, 0},
+    {0, 18, 0, 2, 0, 0, 7475, 0},
+    {0, 18, 0, 2, 0, 0, 7477, 0},
+    {0, 18, 0, 2, 0, 0, 7479, 0},
+    {0, 18, 0, 2, 0, 0, 7481, 0},
+    {0, 18, 0, 1, 0, 0, 7483, 0},
+    {0, 18, 0, 1, 0, 0, 7484, 0},
+    {0, 18, 0, 2, 0, 0, 4059, 0},
+    {0, 18, 0, 1, 0, 0, 7485, 0},
+    {0, 18, 0, 1, 0, 0, 7486, 0},
+    {0, 18, 0, 1, 0, 0, 7487, 0},
+    {0, 18, 0, 1, 0, 0, 7488, 0},
+    {0, 18, 0, 1, 0, 0, 7489, 0},
+    {0, 18, 0, 1, 0, 0, 5713, 0},
+    {0, 18, 0, 1, 0, 0, 7490, 0},
+    {0, 18, 0, 1, 0, 0, 7491, 0},
+    {0, 18, 0, 1, 0, 0, 7492, 0},
+    {0, 18, 0, 1, 0, 0, 7493, 0},
+    {0, 18, 0, 1, 0, 0, 7494, 0},
+    {0, 18, 0, 1, 0, 0, 7495, 0},
+    {0, 18, 0, 1, 0, 0, 7496, 0},
+    {0, 18, 0, 1, 0, 0, 7497, 0},
+    {0, 18, 0, 1, 0, 0, 7498, 0},
+    {0, 18, 0, 1, 0, 0, 7499, 0},
+    {0, 18, 0, 1, 0, 0, 7500, 0},
+    {0, 18, 0, 1, 0, 0, 7501, 0},
+    {0, 18, 0, 1, 0, 0, 7502, 0},
+    {0, 18, 0, 1, 0, 0, 7503, 0},
+    {0, 18, 0, 1, 0, 0, 7504, 0},
+    {0, 18, 0, 1, 0, 0, 7505, 0},
+    {0, 18, 0, 1, 0, 0, 7506, 0},
+    {0, 18, 0, 1, 0, 0, 7507, 0},
+    {0, 18, 0, 1, 0, 0, 7508, 0},
+    {0, 18, 0, 1, 0, 0, 7509, 0},
+    {0, 18, 0, 1, 0, 0, 7510, 0},
+    {0, 18, 0, 1, 0, 0, 7511, 0},
+    {0, 18, 0, 1, 0, 0, 7512, 0},
+    {0, 18, 0, 3, 0, 0, 7513, 0},
+    {0, 18, 0, 3, 0, 0, 7516, 0},
+    {0, 18, 0, 3, 0, 0, 7519, 0},
+    {0, 18, 0, 3, 0, 0, 7522, 0},
+    {0, 18, 0, 3, 0, 0, 7525, 0},
+    {0, 18, 0, 3, 0, 0, 7528, 0},
+    {0, 18, 0, 3, 0, 0, 7531, 0},
+    {0, 18, 0, 3, 0, 0, 7534, 0},
+    {0, 18, 0, 3, 0, 0, 7537, 0},
+    {0, 18, 0, 1, 0, 0, 7540, 0},
+    {0, 18, 0, 1, 0, 0, 7541, 0},
+    {0, 23, 1, 1, 0, 7542, 7542, 0},
+    {0, 23, 1, 1, 0, 7543, 7543, 0},
+    {0, 23, 1, 1, 0, 7544, 7544, 0},
+    {0, 23, 1, 1, 0, 7545, 7545, 0},
+    {0, 23, 1, 1, 0, 7546, 7546, 0},
+    {0, 23, 1, 1, 0, 7547, 7547, 0},
+    {0, 23, 1, 1, 0, 7548, 7548, 0},
+    {0, 23, 1, 1, 0, 7549, 7549, 0},
+    {0, 23, 1, 1, 0, 7550, 7550, 0},
+    {0, 23, 1, 1, 0, 7551, 7551, 0},
+    {0, 23, 1, 1, 0, 7552, 7552, 0},
+    {0, 23, 1, 1, 0, 7553, 7553, 0},
+    {0, 23, 1, 1, 0, 7554, 7554, 0},
+    {0, 23, 1, 1, 0, 7555, 7555, 0},
+    {0, 23, 1, 1, 0, 7556, 7556, 0},
+    {0, 23, 1, 1, 0, 7557, 7557, 0},
+    {0, 23, 1, 1, 0, 7558, 7558, 0},
+    {0, 23, 1, 1, 0, 7559, 7559, 0},
+    {0, 23, 1, 1, 0, 7492, 7492, 0},
+    {0, 23, 1, 1, 0, 7560, 7560, 0},
+    {0, 23, 1, 1, 0, 7561, 7561, 0},
+    {0, 23, 1, 1, 0, 7562, 7562, 0},
+    {0, 23, 1, 1, 0, 7563, 7563, 0},
+    {0, 23, 1, 1, 0, 7564, 7564, 0},
+    {0, 23, 1, 1, 0, 7565, 7565, 0},
+    {0, 23, 1, 1, 0, 3772, 3772, 0},
+    {0, 23, 1, 1, 0, 7566, 7566, 0},
+    {0, 23, 1, 1, 0, 7567, 7567, 0},
+    {0, 23, 1, 1, 0, 7568, 7568, 0},
+    {0, 23, 1, 1, 0, 7569, 7569, 0},
+    {0, 23, 1, 1, 0, 7510, 7510, 0},
+    {0, 23, 1, 1, 0, 7570, 7570, 0},
+    {0, 23, 1, 1, 0, 7571, 7571, 0},
+    {0, 23, 1, 1, 0, 7572, 7572, 0},
+    {0, 23, 1, 1, 0, 7573, 7573, 0},
+    {0, 23, 1, 1, 0, 7574, 7574, 0},
+    {0, 23, 1, 1, 0, 7575, 7575, 0},
+    {0, 23, 1, 1, 0, 7576, 7576, 0},
+    {0, 23, 1, 1, 0, 7577, 7577, 0},
+    {0, 23, 1, 1, 0, 7578, 7578, 0},
+    {0, 23, 1, 1, 0, 7579, 7579, 0},
+    {0, 23, 1, 1, 0, 7580, 7580, 0},
+    {0, 23, 1, 1, 0, 7581, 7581, 0},
+    {0, 23, 1, 1, 0, 7582, 7582, 0},
+    {0, 23, 1, 1, 0, 7583, 7583, 0},
+    {0, 23, 1, 1, 0, 7584, 7584, 0},
+    {0, 23, 1, 1, 0, 7585, 7585, 0},
+    {0, 23, 1, 1, 0, 7586, 7586, 0},
+    {0, 23, 1, 1, 0, 7587, 7587, 0},
+    {0, 23, 1, 1, 0, 7588, 7588, 0},
+    {0, 23, 1, 1, 0, 7589, 7589, 0},
+    {0, 23, 1, 1, 0, 7590, 7590, 0},
+    {0, 23, 1, 1, 0, 7591, 7591, 0},
+    {0, 23, 1, 1, 0, 7592, 7592, 0},
+    {0, 23, 1, 1, 0, 7593, 7593, 0},
+    {0, 23, 1, 1, 0, 7594, 7594, 0},
+    {0, 23, 1, 1, 0, 7595, 7595, 0},
+    {0, 23, 1, 1, 0, 7596, 7596, 0},
+    {0, 23, 1, 1, 0, 7597, 7597, 0},
+    {0, 23, 1, 1, 0, 7598, 7598, 0},
+    {0, 23, 1, 1, 0, 7599, 7599, 0},
+    {0, 23, 1, 1, 0, 7600, 7600, 0},
+    {0, 23, 1, 1, 0, 7601, 7601, 0},
+    {0, 23, 1, 1, 0, 7602, 7602, 0},
+    {0, 23, 1, 1, 0, 7603, 7603, 0},
+    {0, 23, 1, 1, 0, 7604, 7604, 0},
+    {0, 23, 1, 1, 0, 7605, 7605, 0},
+    {0, 23, 1, 1, 0, 7606, 7606, 0},
+    {0, 23, 1, 1, 0, 7607, 7607, 0},
+    {0, 23, 1, 1, 0, 7608, 7608, 0},
+    {0, 23, 1, 1, 0, 7609, 7609, 0},
+    {0, 23, 1, 1, 0, 7610, 7610, 0},
+    {0, 23, 1, 1, 0, 7611, 7611, 0},
+    {0, 23, 1, 1, 0, 7612, 7612, 0},
+    {0, 23, 1, 1, 0, 7613, 7613, 0},
+    {0, 23, 1, 1, 0, 7614, 7614, 0},
+    {0, 23, 1, 1, 0, 7615, 7615, 0},
+    {0, 23, 1, 1, 0, 7485, 7485, 0},
+    {0, 23, 1, 1, 0, 7616, 7616, 0},
+    {0, 23, 1, 1, 0, 7617, 7617, 0},
+    {0, 23, 1, 1, 0, 7618, 7618, 0},
+    {0, 23, 1, 1, 0, 7619, 7619, 0},
+    {0, 23, 1, 1, 0, 7620, 7620, 0},
+    {0, 23, 1, 1, 0, 7621, 7621, 0},
+    {0, 23, 1, 1, 0, 7622, 7622, 0},
+    {0, 23, 1, 1, 0, 7623, 7623, 0},
+    {0, 23, 1, 1, 0, 7624, 7624, 0},
+    {0, 23, 1, 1, 0, 7625, 7625, 0},
+    {0, 23, 1, 1, 0, 7626, 7626, 0},
+    {0, 23, 1, 1, 0, 7627, 7627, 0},
+    {0, 23, 1, 1, 0, 7628, 7628, 0},
+    {0, 23, 1, 1, 0, 7629, 7629, 0},
+    {0, 23, 1, 1, 0, 7630, 7630, 0},
+    {0, 23, 1, 1, 0, 7631, 7631, 0},
+    {0, 23, 1, 1, 0, 7632, 7632, 0},
+    {0, 23, 1, 1, 0, 7633, 7633, 0},
+    {0, 23, 1, 1, 0, 7634, 7634, 0},
+    {0, 23, 1, 1, 0, 7635, 7635, 0},
+    {0, 23, 1, 1, 0, 7636, 7636, 0},
+    {0, 23, 1, 1, 0, 3798, 3798, 0},
+    {0, 23, 1, 1, 0, 7637, 7637, 0},
+    {0, 23, 1, 1, 0, 7638, 7638, 0},
+    {0, 23, 1, 1, 0, 7639, 7639, 0},
+    {0, 23, 1, 1, 0, 7640, 7640, 0},
+    {0, 23, 1, 1, 0, 7641, 7641, 0},
+    {0, 23, 1, 1, 0, 7642, 7642, 0},
+    {0, 23, 1, 1, 0, 7643, 7643, 0},
+    {0, 23, 1, 1, 0, 7644, 7644, 0},
+    {0, 23, 1, 1, 0, 7645, 7645, 0},
+    {0, 23, 1, 1, 0, 7646, 7646, 0},
+    {0, 23, 1, 1, 0, 7647, 7647, 0},
+    {0, 23, 1, 1, 0, 7648, 7648, 0},
+    {0, 23, 1, 1, 0, 7649, 7649, 0},
+    {0, 23, 1, 1, 0, 7650, 7650, 0},
+    {0, 23, 1, 1, 0, 7651, 7651, 0},
+    {0, 23, 1, 1, 0, 7652, 7652, 0},
+    {0, 23, 1, 1, 0, 7653, 7653, 0},
+    {0, 23, 1, 1, 0, 7654, 7654, 0},
+    {0, 23, 1, 1, 0, 7655, 7655, 0},
+    {0, 23, 1, 1, 0, 7656, 7656, 0},
+    {0, 23, 1, 1, 0, 7657, 7657, 0},
+    {0, 23, 1, 1, 0, 7658, 7658, 0},
+    {0, 23, 1, 1, 0, 7659, 7659, 0},
+    {0, 23, 1, 1, 0, 7660, 7660, 0},
+    {0, 23, 1, 1, 0, 3810, 3810, 0},
+    {0, 23, 1, 1, 0, 7661, 7661, 0},
+    {0, 23, 1, 1, 0, 7662, 7662, 0},
+    {0, 23, 1, 1, 0, 7663, 7663, 0},
+    {0, 23, 1, 1, 0, 7664, 7664, 0},
+    {0, 23, 1, 1, 0, 7665, 7665, 0},
+    {0, 23, 1, 1, 0, 7666, 7666, 0},
+    {0, 23, 1, 1, 0, 7667, 7667, 0},
+    {0, 23, 1, 1, 0, 7668, 7668, 0},
+    {0, 23, 1, 1, 0, 7669, 7669, 0},
+    {0, 23, 1, 1, 0, 7670, 7670, 0},
+    {0, 23, 1, 1, 0, 7671, 7671, 0},
+    {0, 23, 1, 1, 0, 7672, 7672, 0},
+    {0, 23, 1, 1, 0, 7673, 7673, 0},
+    {0, 23, 1, 1, 0, 7674, 7674, 0},
+    {0, 23, 1, 1, 0, 7675, 7675, 0},
+    {0, 23, 1, 1, 0, 7676, 7676, 0},
+    {0, 23, 1, 1, 0, 7677, 7677, 0},
+    {0, 23, 1, 1, 0, 7678, 7678, 0},
+    {0, 23, 1, 1, 0, 7679, 7679, 0},
+    {0, 23, 1, 1, 0, 7680, 7680, 0},
+    {0, 23, 1, 1, 0, 7681, 7681, 0},
+    {0, 23, 1, 1, 0, 7682, 7682, 0},
+    {0, 23, 1, 1, 0, 7683, 7683, 0},
+    {0, 23, 1, 1, 0, 7684, 7684, 0},
+    {0, 23, 1, 1, 0, 7685, 7685, 0},
+    {0, 23, 1, 1, 0, 7686, 7686, 0},
+    {0, 23, 1, 1, 0, 7687, 7687, 0},
+    {0, 23, 1, 1, 0, 7688, 7688, 0},
+    {0, 23, 1, 1, 0, 7689, 7689, 0},
+    {0, 23, 1, 1, 0, 7690, 7690, 0},
+    {0, 23, 1, 1, 0, 7691, 7691, 0},
+    {0, 23, 1, 1, 0, 7692, 7692, 0},
+    {0, 23, 1, 1, 0, 7693, 7693, 0},
+    {0, 23, 1, 1, 0, 7694, 7694, 0},
+    {0, 23, 1, 1, 0, 7695, 7695, 0},
+    {0, 23, 1, 1, 0, 7696, 7696, 0},
+    {0, 23, 1, 1, 0, 7697, 7697, 0},
+    {0, 23, 1, 1, 0, 7698, 7698, 0},
+    {0, 23, 1, 1, 0, 7699, 7699, 0},
+    {0, 23, 1, 1, 0, 7700, 7700, 0},
+    {0, 23, 1, 1, 0, 7701, 7701, 0},
+    {0, 23, 1, 1, 0, 7702, 7702, 0},
+    {0, 23, 1, 1, 0, 7703, 7703, 0},
+    {0, 23, 1, 1, 0, 7704, 7704, 0},
+    {0, 23, 1, 1, 0, 7705, 7705, 0},
+    {0, 23, 1, 1, 0, 7706, 7706, 0},
+    {0, 23, 1, 1, 0, 7707, 7707, 0},
+    {0, 23, 1, 1, 0, 7708, 7708, 0},
+    {0, 23, 1, 1, 0, 7709, 7709, 0},
+    {0, 23, 1, 1, 0, 7710, 7710, 0},
+    {0, 23, 1, 1, 0, 7711, 7711, 0},
+    {0, 23, 1, 1, 0, 7712, 7712, 0},
+    {0, 23, 1, 1, 0, 7713, 7713, 0},
+    {0, 23, 1, 1, 0, 7714, 7714, 0},
+    {0, 23, 1, 1, 0, 7715, 7715, 0},
+    {0, 23, 1, 1, 0, 7716, 7716, 0},
+    {0, 23, 1, 1, 0, 7717, 7717, 0},
+    {0, 23, 1, 1, 0, 7718, 7718, 0},
+    {0, 23, 1, 1, 0, 7719, 7719, 0},
+    {0, 23, 1, 1, 0, 7720, 7720, 0},
+    {0, 23, 1, 1, 0, 7721, 7721, 0},
+    {0, 23, 1, 1, 0, 7722, 7722, 0},
+    {0, 23, 1, 1, 0, 7723, 7723, 0},
+    {0, 23, 1, 1, 0, 7724, 7724, 0},
+    {0, 23, 1, 1, 0, 7725, 7725, 0},
+    {0, 23, 1, 1, 0, 7726, 7726, 0},
+    {0, 23, 1, 1, 0, 7727, 7727, 0},
+    {0, 23, 1, 1, 0, 7728, 7728, 0},
+    {0, 23, 1, 1, 0, 7729, 7729, 0},
+    {0, 23, 1, 1, 0, 7730, 7730, 0},
+    {0, 23, 1, 1, 0, 7731, 7731, 0},
+    {0, 23, 1, 1, 0, 7732, 7732, 0},
+    {0, 23, 1, 1, 0, 7733, 7733, 0},
+    {0, 23, 1, 1, 0, 7734, 7734, 0},
+    {0, 23, 1, 1, 0, 7735, 7735, 0},
+    {0, 23, 1, 1, 0, 7736, 7736, 0},
+    {0, 23, 1, 1, 0, 7737, 7737, 0},
+    {0, 23, 1, 1, 0, 7738, 7738, 0},
+    {0, 23, 1, 1, 0, 7739, 7739, 0},
+    {0, 23, 1, 1, 0, 7740, 7740, 0},
+    {0, 23, 1, 1, 0, 7741, 7741, 0},
+    {0, 23, 1, 1, 0, 7742, 7742, 0},
+    {0, 23, 1, 1, 0, 7743, 7743, 0},
+    {0, 23, 1, 1, 0, 7744, 7744, 0},
+    {0, 23, 1, 1, 0, 7745, 7745, 0},
+    {0, 23, 1, 1, 0, 7746, 7746, 0},
+    {0, 23, 1, 1, 0, 7747, 7747, 0},
+    {0, 23, 1, 1, 0, 7748, 7748, 0},
+    {0, 23, 1, 1, 0, 7749, 7749, 0},
+    {0, 23, 1, 1, 0, 7750, 7750, 0},
+    {0, 23, 1, 1, 0, 7751, 7751, 0},
+    {0, 23, 1, 1, 0, 7752, 7752, 0},
+    {0, 23, 1, 1, 0, 7753, 7753, 0},
+    {0, 23, 1, 1, 0, 7754, 7754, 0},
+    {0, 23, 1, 1, 0, 7755, 7755, 0},
+    {0, 23, 1, 1, 0, 7756, 7756, 0},
+    {0, 23, 1, 1, 0, 7757, 7757, 0},
+    {0, 23, 1, 1, 0, 7758, 7758, 0},
+    {0, 23, 1, 1, 0, 7759, 7759, 0},
+    {0, 23, 1, 1, 0, 7760, 7760, 0},
+    {0, 23, 1, 1, 0, 7761, 7761, 0},
+    {0, 23, 1, 1, 0, 7762, 7762, 0},
+    {0, 23, 1, 1, 0, 7763, 7763, 0},
+    {0, 23, 1, 1, 0, 7764, 7764, 0},
+    {0, 23, 1, 1, 0, 7765, 7765, 0},
+    {0, 23, 1, 1, 0, 7766, 7766, 0},
+    {0, 23, 1, 1, 0, 7767, 7767, 0},
+    {0, 23, 1, 1, 0, 7768, 7768, 0},
+    {0, 23, 1, 1, 0, 7769, 7769, 0},
+    {0, 23, 1, 1, 0, 7770, 7770, 0},
+    {0, 23, 1, 1, 0, 7771, 7771, 0},
+    {0, 23, 1, 1, 0, 7772, 7772, 0},
+    {0, 23, 1, 1, 0, 7773, 7773, 0},
+    {0, 23, 1, 1, 0, 7774, 7774, 0},
+    {0, 23, 1, 1, 0, 7775, 7775, 0},
+    {0, 23, 1, 1, 0, 7776, 7776, 0},
+    {0, 23, 1, 1, 0, 7777, 7777, 0},
+    {0, 23, 1, 1, 0, 7778, 7778, 0},
+    {0, 23, 1, 1, 0, 7779, 7779, 0},
+    {0, 23, 1, 1, 0, 7780, 7780, 0},
+    {0, 23, 1, 1, 0, 7781, 7781, 0},
+    {0, 23, 1, 1, 0, 7782, 7782, 0},
+    {0, 23, 1, 1, 0, 7783, 7783, 0},
+    {0, 23, 1, 1, 0, 7784, 7784, 0},
+    {0, 23, 1, 1, 0, 7785, 7785, 0},
+    {0, 23, 1, 1, 0, 7786, 7786, 0},
+    {0, 23, 1, 1, 0, 7787, 7787, 0},
+    {0, 23, 1, 1, 0, 7788, 7788, 0},
+    {0, 23, 1, 1, 0, 7789, 7789, 0},
+    {0, 23, 1, 1, 0, 7790, 7790, 0},
+    {0, 23, 1, 1, 0, 7791, 7791, 0},
+    {0, 23, 1, 1, 0, 7792, 7792, 0},
+    {0, 23, 1, 1, 0, 7793, 7793, 0},
+    {0, 23, 1, 1, 0, 7794, 7794, 0},
+    {0, 23, 1, 1, 0, 7795, 7795, 0},
+    {0, 23, 1, 1, 0, 7796, 7796, 0},
+    {0, 23, 1, 1, 0, 7797, 7797, 0},
+    {0, 23, 1, 1, 0, 7798, 7798, 0},
+    {0, 23, 1, 1, 0, 7799, 7799, 0},
+    {0, 23, 1, 1, 0, 7800, 7800, 0},
+    {0, 23, 1, 1, 0, 7801, 7801, 0},
+    {0, 23, 1, 1, 0, 7802, 7802, 0},
+    {0, 23, 1, 1, 0, 7803, 7803, 0},
+    {0, 23, 1, 1, 0, 7804, 7804, 0},
+    {0, 23, 1, 1, 0, 7805, 7805, 0},
+    {0, 23, 1, 1, 0, 7806, 7806, 0},
+    {0, 23, 1, 1, 0, 7807, 7807, 0},
+    {0, 23, 1, 1, 0, 7808, 7808, 0},
+    {0, 23, 1, 1, 0, 7809, 7809, 0},
+    {0, 23, 1, 1, 0, 7810, 7810, 0},
+    {0, 23, 1, 1, 0, 7811, 7811, 0},
+    {0, 23, 1, 1, 0, 7812, 7812, 0},
+    {0, 23, 1, 1, 0, 7813, 7813, 0},
+    {0, 23, 1, 1, 0, 7814, 7814, 0},
+    {0, 23, 1, 1, 0, 7815, 7815, 0},
+    {0, 23, 1, 1, 0, 7816, 7816, 0},
+    {0, 23, 1, 1, 0, 7817, 7817, 0},
+    {0, 23, 1, 1, 0, 7818, 7818, 0},
+    {0, 23, 1, 1, 0, 7819, 7819, 0},
+    {0, 23, 1, 1, 0, 7820, 7820, 0},
+    {0, 23, 1, 1, 0, 7821, 7821, 0},
+    {0, 23, 1, 1, 0, 7822, 7822, 0},
+    {0, 23, 1, 1, 0, 7823, 7823, 0},
+    {0, 23, 1, 1, 0, 7824, 7824, 0},
+    {0, 23, 1, 1, 0, 7825, 7825, 0},
+    {0, 23, 1, 1, 0, 7826, 7826, 0},
+    {0, 23, 1, 1, 0, 7827, 7827, 0},
+    {0, 23, 1, 1, 0, 7828, 7828, 0},
+    {0, 23, 1, 1, 0, 7829, 7829, 0},
+    {0, 23, 1, 1, 0, 7830, 7830, 0},
+    {0, 23, 1, 1, 0, 7831, 7831, 0},
+    {0, 23, 1, 1, 0, 7832, 7832, 0},
+    {0, 23, 1, 1, 0, 7833, 7833, 0},
+    {0, 23, 1, 1, 0, 7834, 7834, 0},
+    {0, 23, 1, 1, 0, 7835, 7835, 0},
+    {0, 23, 1, 1, 0, 7836, 7836, 0},
+    {0, 23, 1, 1, 0, 7837, 7837, 0},
+    {0, 23, 1, 1, 0, 7838, 7838, 0},
+    {0, 23, 1, 1, 0, 7839, 7839, 0},
+    {0, 23, 1, 1, 0, 7840, 7840, 0},
+    {0, 23, 1, 1, 0, 7841, 7841, 0},
+    {0, 23, 1, 1, 0, 7842, 7842, 0},
+    {0, 23, 1, 1, 0, 7843, 7843, 0},
+    {0, 23, 1, 1, 0, 7844, 7844, 0},
+    {0, 23, 1, 1, 0, 7845, 7845, 0},
+    {0, 23, 1, 1, 0, 7846, 7846, 0},
+    {0, 23, 1, 1, 0, 7847, 7847, 0},
+    {0, 23, 1, 1, 0, 7848, 7848, 0},
+    {0, 23, 1, 1, 0, 7849, 7849, 0},
+    {0, 23, 1, 1, 0, 7850, 7850, 0},
+    {0, 23, 1, 1, 0, 7851, 7851, 0},
+    {0, 23, 1, 1, 0, 7852, 7852, 0},
+    {0, 23, 1, 1, 0, 7853, 7853, 0},
+    {0, 23, 1, 1, 0, 7854, 7854, 0},
+    {0, 23, 1, 1, 0, 7855, 7855, 0},
+    {0, 23, 1, 1, 0, 7856, 7856, 0},
+    {0, 23, 1, 1, 0, 7857, 7857, 0},
+    {0, 23, 1, 1, 0, 7858, 7858, 0},
+    {0, 23, 1, 1, 0, 7859, 7859, 0},
+    {0, 23, 1, 1, 0, 7860, 7860, 0},
+    {0, 23, 1, 1, 0, 7861, 7861, 0},
+    {0, 23, 1, 1, 0, 7862, 7862, 0},
+    {0, 23, 1, 1, 0, 7863, 7863, 0},
+    {0, 23, 1, 1, 0, 7864, 7864, 0},
+    {0, 23, 1, 1, 0, 7865, 7865, 0},
+    {0, 23, 1, 1, 0, 7866, 7866, 0},
+    {0, 23, 1, 1, 0, 7867, 7867, 0},
+    {0, 23, 1, 1, 0, 7868, 7868, 0},
+    {0, 23, 1, 1, 0, 7869, 7869, 0},
+    {0, 23, 1, 1, 0, 7870, 7870, 0},
+    {0, 23, 1, 1, 0, 7871, 7871, 0},
+    {0, 23, 1, 1, 0, 7872, 7872, 0},
+    {0, 23, 1, 1, 0, 7873, 7873, 0},
+    {0, 23, 1, 1, 0, 7874, 7874, 0},
+    {0, 23, 1, 1, 0, 7875, 7875, 0},
+    {0, 23, 1, 1, 0, 7876, 7876, 0},
+    {0, 23, 1, 1, 0, 7877, 7877, 0},
+    {0, 23, 1, 1, 0, 7878, 7878, 0},
+    {0, 23, 1, 1, 0, 7879, 7879, 0},
+    {0, 23, 1, 1, 0, 7880, 7880, 0},
+    {0, 23, 1, 1, 0, 7881, 7881, 0},
+    {0, 23, 1, 1, 0, 7882, 7882, 0},
+    {0, 23, 1, 1, 0, 7883, 7883, 0},
+    {0, 23, 1, 1, 0, 7884, 7884, 0},
+    {0, 23, 1, 1, 0, 7885, 7885, 0},
+    {0, 23, 1, 1, 0, 7886, 7886, 0},
+    {0, 23, 1, 1, 0, 7887, 7887, 0},
+    {0, 23, 1, 1, 0, 7888, 7888, 0},
+    {0, 23, 1, 1, 0, 7889, 7889, 0},
+    {0, 23, 1, 1, 0, 7890, 7890, 0},
+    {0, 23, 1, 1, 0, 7891, 7891, 0},
+    {0, 23, 1, 1, 0, 7892, 7892, 0},
+    {0, 23, 1, 1, 0, 7893, 7893, 0},
+    {0, 23, 1, 1, 0, 7894, 7894, 0},
+    {0, 23, 1, 1, 0, 7895, 7895, 0},
+    {0, 23, 1, 1, 0, 7896, 7896, 0},
+    {0, 23, 1, 1, 0, 7897, 7897, 0},
+    {0, 23, 1, 1, 0, 7898, 7898, 0},
+    {0, 23, 1, 1, 0, 7899, 7899, 0},
+    {0, 23, 1, 1, 0, 7900, 7900, 0},
+    {0, 23, 1, 1, 0, 7901, 7901, 0},
+    {0, 23, 1, 1, 0, 7902, 7902, 0},
+    {0, 23, 1, 1, 0, 7903, 7903, 0},
+    {0, 23, 1, 1, 0, 7904, 7904, 0},
+    {0, 23, 1, 1, 0, 7905, 7905, 0},
+    {0, 23, 1, 1, 0, 7906, 7906, 0},
+    {0, 23, 1, 1, 0, 7907, 7907, 0},
+    {0, 23, 1, 1, 0, 7908, 7908, 0},
+    {0, 23, 1, 1, 0, 7909, 7909, 0},
+    {0, 23, 1, 1, 0, 7910, 7910, 0},
+    {0, 23, 1, 1, 0, 7911, 7911, 0},
+    {0, 23, 1, 1, 0, 7912, 7912, 0},
+    {0, 23, 1, 1, 0, 7913, 7913, 0},
+    {0, 23, 1, 1, 0, 7914, 7914, 0},
+    {0, 23, 1, 1, 0, 7915, 7915, 0},
+    {0, 23, 1, 1, 0, 7916, 7916, 0},
+    {0, 23, 1, 1, 0, 7917, 7917, 0},
+    {0, 23, 1, 1, 0, 7918, 7918, 0},
+    {0, 23, 1, 1, 0, 7919, 7919, 0},
+    {0, 23, 1, 1, 0, 7920, 7920, 0},
+    {0, 23, 1, 1, 0, 7921, 7921, 0},
+    {0, 23, 1, 1, 0, 7922, 7922, 0},
+    {0, 23, 1, 1, 0, 7923, 7923, 0},
+    {0, 23, 1, 1, 0, 7924, 7924, 0},
+    {0, 23, 1, 1, 0, 7925, 7925, 0},
+    {0, 23, 1, 1, 0, 7926, 7926, 0},
+    {0, 23, 1, 1, 0, 7927, 7927, 0},
+    {0, 23, 1, 1, 0, 7928, 7928, 0},
+    {0, 23, 1, 1, 0, 3900, 3900, 0},
+    {0, 23, 1, 1, 0, 7929, 7929, 0},
+    {0, 23, 1, 1, 0, 7930, 7930, 0},
+    {0, 23, 1, 1, 0, 7931, 7931, 0},
+    {0, 23, 1, 1, 0, 7932, 7932, 0},
+    {0, 23, 1, 1, 0, 7933, 7933, 0},
+    {0, 23, 1, 1, 0, 7934, 7934, 0},
+    {0, 23, 1, 1, 0, 7935, 7935, 0},
+    {0, 23, 1, 1, 0, 7936, 7936, 0},
+    {0, 23, 1, 1, 0, 7937, 7937, 0},
+    {0, 23, 1, 1, 0, 7938, 7938, 0},
+    {0, 23, 1, 1, 0, 7939, 7939, 0},
+    {0, 23, 1, 1, 0, 3907, 3907, 0},
+    {0, 23, 1, 1, 0, 7940, 7940, 0},
+    {0, 23, 1, 1, 0, 7941, 7941, 0},
+    {0, 23, 1, 1, 0, 7942, 7942, 0},
+    {0, 23, 1, 1, 0, 7943, 7943, 0},
+    {0, 23, 1, 1, 0, 7944, 7944, 0},
+    {0, 23, 1, 1, 0, 7945, 7945, 0},
+    {0, 23, 1, 1, 0, 7946, 7946, 0},
+    {0, 23, 1, 1, 0, 7947, 7947, 0},
+    {0, 23, 1, 1, 0, 7948, 7948, 0},
+    {0, 23, 1, 1, 0, 7949, 7949, 0},
+    {0, 23, 1, 1, 0, 7950, 7950, 0},
+    {0, 23, 1, 1, 0, 7951, 7951, 0},
+    {0, 23, 1, 1, 0, 7952, 7952, 0},
+    {0, 23, 1, 1, 0, 7953, 7953, 0},
+    {0, 23, 1, 1, 0, 7954, 7954, 0},
+    {0, 23, 1, 1, 0, 7955, 7955, 0},
+    {0, 23, 1, 1, 0, 7956, 7956, 0},
+    {0, 23, 1, 1, 0, 7957, 7957, 0},
+    {0, 23, 1, 1, 0, 7958, 7958, 0},
+    {0, 23, 1, 1, 0, 7959, 7959, 0},
+    {0, 23, 1, 1, 0, 7960, 7960, 0},
+    {0, 23, 1, 1, 0, 7961, 7961, 0},
+    {0, 23, 1, 1, 0, 7962, 7962, 0},
+    {0, 23, 1, 1, 0, 7963, 7963, 0},
+    {0, 23, 1, 1, 0, 7964, 7964, 0},
+    {0, 23, 1, 1, 0, 7965, 7965, 0},
+    {0, 23, 1, 1, 0, 7966, 7966, 0},
+    {0, 23, 1, 1, 0, 7967, 7967, 0},
+    {0, 23, 1, 1, 0, 7968, 7968, 0},
+    {0, 23, 1, 1, 0, 7969, 7969, 0},
+    {0, 23, 1, 1, 0, 7970, 7970, 0},
+    {0, 23, 1, 1, 0, 7971, 7971, 0},
+    {0, 23, 1, 1, 0, 7972, 7972, 0},
+    {0, 23, 1, 1, 0, 7973, 7973, 0},
+    {0, 23, 1, 1, 0, 7974, 7974, 0},
+    {0, 23, 1, 1, 0, 7975, 7975, 0},
+    {0, 23, 1, 1, 0, 7976, 7976, 0},
+    {0, 23, 1, 1, 0, 7977, 7977, 0},
+    {0, 23, 1, 1, 0, 7978, 7978, 0},
+    {0, 23, 1, 1, 0, 7979, 7979, 0},
+    {0, 23, 1, 1, 0, 7980, 7980, 0},
+    {0, 23, 1, 1, 0, 7981, 7981, 0},
+    {0, 23, 1, 1, 0, 7982, 7982, 0},
+    {0, 23, 1, 1, 0, 7983, 7983, 0},
+    {0, 23, 1, 1, 0, 7984, 7984, 0},
+    {0, 23, 1, 1, 0, 7985, 7985, 0},
+    {0, 23, 1, 1, 0, 7986, 7986, 0},
+    {0, 23, 1, 1, 0, 7987, 7987, 0},
+    {0, 23, 1, 1, 0, 7988, 7988, 0},
+    {0, 23, 1, 1, 0, 7989, 7989, 0},
+    {0, 23, 1, 1, 0, 7990, 7990, 0},
+    {0, 23, 1, 1, 0, 7991, 7991, 0},
+    {0, 23, 1, 1, 0, 7992, 7992, 0},
+    {0, 23, 1, 1, 0, 7993, 7993, 0},
+    {0, 23, 1, 1, 0, 7994, 7994, 0},
+    {0, 23, 1, 1, 0, 7995, 7995, 0},
+    {0, 23, 1, 1, 0, 7996, 7996, 0},
+    {0, 23, 1, 1, 0, 7997, 7997, 0},
+    {0, 23, 1, 1, 0, 7998, 7998, 0},
+    {0, 23, 1, 1, 0, 7999, 7999, 0},
+    {0, 23, 1, 1, 0, 8000, 8000, 0},
+    {0, 23, 1, 1, 0, 8001, 8001, 0},
+    {0, 23, 1, 1, 0, 3955, 3955, 0},
+    {0, 23, 1, 1, 0, 8002, 8002, 0},
+    {0, 23, 1, 1, 0, 3959, 3959, 0},
+    {0, 23, 1, 1, 0, 8003, 8003, 0},
+    {0, 23, 1, 1, 0, 8004, 8004, 0},
+    {0, 23, 1, 1, 0, 8005, 8005, 0},
+    {0, 23, 1, 1, 0, 8006, 8006, 0},
+    {0, 23, 1, 1, 0, 3964, 3964, 0},
+    {0, 23, 1, 1, 0, 8007, 8007, 0},
+};
+
+const uint32_t kPool[8008] = {
+    97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122, 32, 32, 776, 32, 772, 50, 51, 32, 769, 956,
+    32, 807, 49, 49, 8260, 52, 49, 8260, 50, 51, 8260, 52,
+    65, 768, 224, 65, 769, 225, 65, 770, 226, 65, 771, 227,
+    65, 776, 228, 65, 778, 229, 230, 67, 807, 231, 69, 768,
+    232, 69, 769, 233, 69, 770, 234, 69, 776, 235, 73, 768,
+    236, 73, 769, 237, 73, 770, 238, 73, 776, 239, 240, 78,
+    771, 241, 79, 768, 242, 79, 769, 243, 79, 770, 244, 79,
+    771, 245, 79, 776, 246, 248, 85, 768, 249, 85, 769, 250,
+    85, 770, 251, 85, 776, 252, 89, 769, 253, 254, 97, 768,
+    97, 769, 97, 770, 97, 771, 97, 776, 97, 778, 99, 807,
+    101, 768, 101, 769, 101, 770, 101, 776, 105, 768, 105, 769,
+    105, 770, 105, 776, 110, 771, 111, 768, 111, 769, 111, 770,
+    111, 771, 111, 776, 117, 768, 117, 769, 117, 770, 117, 776,
+    121, 769, 121, 776, 65, 772, 257, 97, 772, 65, 774, 259,
+    97, 774, 65, 808, 261, 97, 808, 67, 769, 263, 99, 769,
+    67, 770, 265, 99, 770, 67, 775, 267, 99, 775, 67, 780,
+    269, 99, 780, 68, 780, 271, 100, 780, 273, 69, 772, 275,
+    101, 772, 69, 774, 277, 101, 774, 69, 775, 279, 101, 775,
+    69, 808, 281, 101, 808, 69, 780, 283, 101, 780, 71, 770,
+    285, 103, 770, 71, 774, 287, 103, 774, 71, 775, 289, 103,
+    775, 71, 807, 291, 103, 807, 72, 770, 293, 104, 770, 295,
+    73, 771, 297, 105, 771, 73, 772, 299, 105, 772, 73, 774,
+    301, 105, 774, 73, 808, 303, 105, 808, 73, 775, 105, 775,
+    73, 74, 307, 105, 106, 74, 770, 309, 106, 770, 75, 807,
+    311, 107, 807, 76, 769, 314, 108, 769, 76, 807, 316, 108,
+    807, 76, 780, 318, 108, 780, 76, 183, 320, 108, 183, 322,
+    78, 769, 324, 110, 769, 78, 807, 326, 110, 807, 78, 780,
+    328, 110, 780, 700, 110, 331, 79, 772, 333, 111, 772, 79,
+    774, 335, 111, 774, 79, 779, 337, 111, 779, 339, 82, 769,
+    341, 114, 769, 82, 807, 343, 114, 807, 82, 780, 345, 114,
+    780, 83, 769, 347, 115, 769, 83, 770, 349, 115, 770, 83,
+    807, 351, 115, 807, 83, 780, 353, 115, 780, 84, 807, 355,
+    116, 807, 84, 780, 357, 116, 780, 359, 85, 771, 361, 117,
+    771, 85, 772, 363, 117, 772, 85, 774, 365, 117, 774, 85,
+    778, 367, 117, 778, 85, 779, 369, 117, 779, 85, 808, 371,
+    117, 808, 87, 770, 373, 119, 770, 89, 770, 375, 121, 770,
+    89, 776, 255, 90, 769, 378, 122, 769, 90, 775, 380, 122,
+    775, 90, 780, 382, 122, 780, 595, 387, 389, 596, 392, 598,
+    599, 396, 477, 601, 603, 402, 608, 611, 617, 616, 409, 623,
+    626, 629, 79, 795, 417, 111, 795, 419, 421, 640, 424, 643,
+    429, 648, 85, 795, 432, 117, 795, 650, 651, 436, 438, 658,
+    441, 445, 68, 90, 780, 454, 68, 122, 780, 100, 122, 780,
+    76, 74, 457, 76, 106, 108, 106, 78, 74, 460, 78, 106,
+    110, 106, 65, 780, 462, 97, 780, 73, 780, 464, 105, 780,
+    79, 780, 466, 111, 780, 85, 780, 468, 117, 780, 85, 776,
+    772, 470, 117, 776, 772, 85, 776, 769, 472, 117, 776, 769,
+    85, 776, 780, 474, 117, 776, 780, 85, 776, 768, 476, 117,
+    776, 768, 65, 776, 772, 479, 97, 776, 772, 65, 775, 772,
+    481, 97, 775, 772, 198, 772, 483, 230, 772, 485, 71, 780,
+    487, 103, 780, 75, 780, 489, 107, 780, 79, 808, 491, 111,
+    808, 79, 808, 772, 493, 111, 808, 772, 439, 780, 495, 658,
+    780, 106, 780, 68, 90, 499, 68, 122, 100, 122, 71, 769,
+    501, 103, 769, 405, 447, 78, 768, 505, 110, 768, 65, 778,
+    769, 507, 97, 778, 769, 198, 769, 509, 230, 769, 216, 769,
+    511, 248, 769, 65, 783, 513, 97, 783, 65, 785, 515, 97,
+    785, 69, 783, 517, 101, 783, 69, 785, 519, 101, 785, 73,
+    783, 521, 105, 783, 73, 785, 523, 105, 785, 79, 783, 525,
+    111, 783, 79, 785, 527, 111, 785, 82, 783, 529, 114, 783,
+    82, 785, 531, 114, 785, 85, 783, 533, 117, 783, 85, 785,
+    535, 117, 785, 83, 806, 537, 115, 806, 84, 806, 539, 116,
+    806, 541, 72, 780, 543, 104, 780, 414, 547, 549, 65, 775,
+    551, 97, 775, 69, 807, 553, 101, 807, 79, 776, 772, 555,
+    111, 776, 772, 79, 771, 772, 557, 111, 771, 772, 79, 775,
+    559, 111, 775, 79, 775, 772, 561, 111, 775, 772, 89, 772,
+    563, 121, 772, 11365, 572, 410, 11366, 578, 384, 649, 652, 583,
+    585, 587, 589, 591, 614, 633, 635, 641, 32, 774, 32, 775,
+    32, 778, 32, 808, 32, 771, 32, 779, 661, 768, 769, 787,
+    776, 769, 881, 883, 697, 887, 32, 837, 59, 1011, 168, 769,
+    32, 776, 769, 913, 769, 940, 183, 917, 769, 941, 919, 769,
+    942, 921, 769, 943, 927, 769, 972, 933, 769, 973, 937, 769,
+    974, 953, 776, 769, 945, 946, 947, 948, 949, 950, 951, 952,
+    953, 954, 955, 957, 958, 959, 960, 961, 963, 964, 965, 966,
+    967, 968, 969, 921, 776, 970, 933, 776, 971, 945, 769, 949,
+    769, 951, 769, 953, 769, 965, 776, 769, 953, 776, 965, 776,
+    959, 769, 965, 769, 969, 769, 983, 933, 978, 769, 978, 776,
+    985, 987, 989, 991, 993, 995, 997, 999, 1001, 1003, 1005, 1007,
+    962, 920, 1016, 931, 1010, 1019, 891, 892, 893, 1045, 768, 1104,
+    1045, 776, 1105, 1106, 1043, 769, 1107, 1108, 1109, 1110, 1030, 776,
+    1111, 1112, 1113, 1114, 1115, 1050, 769, 1116, 1048, 768, 1117, 1059,
+    774, 1118, 1119, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080,
+    1048, 774, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090,
+    1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102,
+    1103, 1080, 774, 1077, 768, 1077, 776, 1075, 769, 1110, 776, 1082,
+    769, 1080, 768, 1091, 774, 1121, 1123, 1125, 1127, 1129, 1131, 1133,
+    1135, 1137, 1139, 1141, 1140, 783, 1143, 1141, 783, 1145, 1147, 1149,
+    1151, 1153, 1163, 1165, 1167, 1169, 1171, 1173, 1175, 1177, 1179, 1181,
+    1183, 1185, 1187, 1189, 1191, 1193, 1195, 1197, 1199, 1201, 1203, 1205,
+    1207, 1209, 1211, 1213, 1215, 1231, 1046, 774, 1218, 1078, 774, 1220,
+    1222, 1224, 1226, 1228, 1230, 1040, 774, 1233, 1072, 774, 1040, 776,
+    1235, 1072, 776, 1237, 1045, 774, 1239, 1077, 774, 1241, 1240, 776,
+    1243, 1241, 776, 1046, 776, 1245, 1078, 776, 1047, 776, 1247, 1079,
+    776, 1249, 1048, 772, 1251, 1080, 772, 1048, 776, 1253, 1080, 776,
+    1054, 776, 1255, 1086, 776, 1257, 1256, 776, 1259, 1257, 776, 1069,
+    776, 1261, 1101, 776, 1059, 772, 1263, 1091, 772, 1059, 776, 1265,
+    1091, 776, 1059, 779, 1267, 1091, 779, 1063, 776, 1269, 1095, 776,
+    1271, 1067, 776, 1273, 1099, 776, 1275, 1277, 1279, 1281, 1283, 1285,
+    1287, 1289, 1291, 1293, 1295, 1297, 1299, 1301, 1303, 1305, 1307, 1309,
+    1311, 1313, 1315, 1317, 1319, 1321, 1323, 1325, 1327, 1377, 1378, 1379,
+    1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
+    1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403,
+    1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1381,
+    1410, 1575, 1619, 1575, 1620, 1608, 1620, 1575, 1621, 1610, 1620, 1575,
+    1652, 1608, 1652, 1735, 1652, 1610, 1652, 1749, 1620, 1729, 1620, 1746,
+    1620, 2344, 2364, 2352, 2364, 2355, 2364, 2325, 2364, 2326, 2364, 2327,
+    2364, 2332, 2364, 2337, 2364, 2338, 2364, 2347, 2364, 2351, 2364, 2503,
+    2494, 2503, 2519, 2465, 2492, 2466, 2492, 2479, 2492, 2610, 2620, 2616,
+    2620, 2582, 2620, 2583, 2620, 2588, 2620, 2603, 2620, 2887, 2902, 2887,
+    2878, 2887, 2903, 2849, 2876, 2850, 2876, 2962, 3031, 3014, 3006, 3015,
+    3006, 3014, 3031, 3142, 3158, 3263, 3285, 3270, 3285, 3270, 3286, 3270,
+    3266, 3270, 3266, 3285, 3398, 3390, 3399, 3390, 3398, 3415, 3545, 3530,
+    3545, 3535, 3545, 3535, 3530, 3545, 3551, 3661, 3634, 3789, 3762, 3755,
+    3737, 3755, 3745, 3851, 3906, 4023, 3916, 4023, 3921, 4023, 3926, 4023,
+    3931, 4023, 3904, 4021, 3953, 3954, 3953, 3956, 4018, 3968, 4018, 3953,
+    3968, 4019, 3968, 4019, 3953, 3968, 3953, 3968, 3986, 4023, 3996, 4023,
+    4001, 4023, 4006, 4023, 4011, 4023, 3984, 4021, 4133, 4142, 11520, 11521,
+    11522, 11523, 11524, 11525, 11526, 11527, 11528, 11529, 11530, 11531, 11532, 11533,
+    11534, 11535, 11536, 11537, 11538, 11539, 11540, 11541, 11542, 11543, 11544, 11545,
+    11546, 11547, 11548, 11549, 11550, 11551, 11552, 11553, 11554, 11555, 11556, 11557,
+    11559, 11565, 4316, 43888, 43889, 43890, 43891, 43892, 43893, 43894, 43895, 43896,
+    43897, 43898, 43899, 43900, 43901, 43902, 43903, 43904, 43905, 43906, 43907, 43908,
+    43909, 43910, 43911, 43912, 43913, 43914, 43915, 43916, 43917, 43918, 43919, 43920,
+    43921, 43922, 43923, 43924, 43925, 43926, 43927, 43928, 43929, 43930, 43931, 43932,
+    43933, 43934, 43935, 43936, 43937, 43938, 43939, 43940, 43941, 43942, 43943, 43944,
+    43945, 43946, 43947, 43948, 43949, 43950, 43951, 43952, 43953, 43954, 43955, 43956,
+    43957, 43958, 43959, 43960, 43961, 43962, 43963, 43964, 43965, 43966, 43967, 5112,
+    5113, 5114, 5115, 5116, 5117, 6917, 6965, 6919, 6965, 6921, 6965, 6923,
+    6965, 6925, 6965, 6929, 6965, 6970, 6965, 6972, 6965, 6974, 6965, 6975,
+    6965, 6978, 6965, 4304, 4305, 4306, 4307, 4308, 4309, 4310, 4311, 4312,
+    4313, 4314, 4315, 4317, 4318, 4319, 4320, 4321, 4322, 4323, 4324, 4325,
+    4326, 4327, 4328, 4329, 4330, 4331, 4332, 4333, 4334, 4335, 4336, 4337,
+    4338, 4339, 4340, 4341, 4342, 4343, 4344, 4345, 4346, 4349, 4350, 4351,
+    65, 198, 66, 68, 69, 398, 71, 72, 73, 74, 75, 76,
+    77, 78, 79, 546, 80, 82, 84, 85, 87, 592, 593, 7426,
+    604, 7446, 7447, 7453, 7461, 594, 597, 607, 609, 613, 618, 7547,
+    669, 621, 7557, 671, 625, 624, 627, 628, 632, 642, 427, 7452,
+    656, 657, 65, 805, 7681, 97, 805, 66, 775, 7683, 98, 775,
+    66, 803, 7685, 98, 803, 66, 817, 7687, 98, 817, 67, 807,
+    769, 7689, 99, 807, 769, 68, 775, 7691, 100, 775, 68, 803,
+    7693, 100, 803, 68, 817, 7695, 100, 817, 68, 807, 7697, 100,
+    807, 68, 813, 7699, 100, 813, 69, 772, 768, 7701, 101, 772,
+    768, 69, 772, 769, 7703, 101, 772, 769, 69, 813, 7705, 101,
+    813, 69, 816, 7707, 101, 816, 69, 807, 774, 7709, 101, 807,
+    774, 70, 775, 7711, 102, 775, 71, 772, 7713, 103, 772, 72,
+    775, 7715, 104, 775, 72, 803, 7717, 104, 803, 72, 776, 7719,
+    104, 776, 72, 807, 7721, 104, 807, 72, 814, 7723, 104, 814,
+    73, 816, 7725, 105, 816, 73, 776, 769, 7727, 105, 776, 769,
+    75, 769, 7729, 107, 769, 75, 803, 7731, 107, 803, 75, 817,
+    7733, 107, 817, 76, 803, 7735, 108, 803, 76, 803, 772, 7737,
+    108, 803, 772, 76, 817, 7739, 108, 817, 76, 813, 7741, 108,
+    813, 77, 769, 7743, 109, 769, 77, 775, 7745, 109, 775, 77,
+    803, 7747, 109, 803, 78, 775, 7749, 110, 775, 78, 803, 7751,
+    110, 803, 78, 817, 7753, 110, 817, 78, 813, 7755, 110, 813,
+    79, 771, 769, 7757, 111, 771, 769, 79, 771, 776, 7759, 111,
+    771, 776, 79, 772, 768, 7761, 111, 772, 768, 79, 772, 769,
+    7763, 111, 772, 769, 80, 769, 7765, 112, 769, 80, 775, 7767,
+    112, 775, 82, 775, 7769, 114, 775, 82, 803, 7771, 114, 803,
+    82, 803, 772, 7773, 114, 803, 772, 82, 817, 7775, 114, 817,
+    83, 775, 7777, 115, 775, 83, 803, 7779, 115, 803, 83, 769,
+    775, 7781, 115, 769, 775, 83, 780, 775, 7783, 115, 780, 775,
+    83, 803, 775, 7785, 115, 803, 775, 84, 775, 7787, 116, 775,
+    84, 803, 7789, 116, 803, 84, 817, 7791, 116, 817, 84, 813,
+    7793, 116, 813, 85, 804, 7795, 117, 804, 85, 816, 7797, 117,
+    816, 85, 813, 7799, 117, 813, 85, 771, 769, 7801, 117, 771,
+    769, 85, 772, 776, 7803, 117, 772, 776, 86, 771, 7805, 118,
+    771, 86, 803, 7807, 118, 803, 87, 768, 7809, 119, 768, 87,
+    769, 7811, 119, 769, 87, 776, 7813, 119, 776, 87, 775, 7815,
+    119, 775, 87, 803, 7817, 119, 803, 88, 775, 7819, 120, 775,
+    88, 776, 7821, 120, 776, 89, 775, 7823, 121, 775, 90, 770,
+    7825, 122, 770, 90, 803, 7827, 122, 803, 90, 817, 7829, 122,
+    817, 104, 817, 116, 776, 119, 778, 121, 778, 97, 702, 383,
+    775, 223, 65, 803, 7841, 97, 803, 65, 777, 7843, 97, 777,
+    65, 770, 769, 7845, 97, 770, 769, 65, 770, 768, 7847, 97,
+    770, 768, 65, 770, 777, 7849, 97, 770, 777, 65, 770, 771,
+    7851, 97, 770, 771, 65, 803, 770, 7853, 97, 803, 770, 65,
+    774, 769, 7855, 97, 774, 769, 65, 774, 768, 7857, 97, 774,
+    768, 65, 774, 777, 7859, 97, 774, 777, 65, 774, 771, 7861,
+    97, 774, 771, 65, 803, 774, 7863, 97, 803, 774, 69, 803,
+    7865, 101, 803, 69, 777, 7867, 101, 777, 69, 771, 7869, 101,
+    771, 69, 770, 769, 7871, 101, 770, 769, 69, 770, 768, 7873,
+    101, 770, 768, 69, 770, 777, 7875, 101, 770, 777, 69, 770,
+    771, 7877, 101, 770, 771, 69, 803, 770, 7879, 101, 803, 770,
+    73, 777, 7881, 105, 777, 73, 803, 7883, 105, 803, 79, 803,
+    7885, 111, 803, 79, 777, 7887, 111, 777, 79, 770, 769, 7889,
+    111, 770, 769, 79, 770, 768, 7891, 111, 770, 768, 79, 770,
+    777, 7893, 111, 770, 777, 79, 770, 771, 7895, 111, 770, 771,
+    79, 803, 770, 7897, 111, 803, 770, 79, 795, 769, 7899, 111,
+    795, 769, 79, 795, 768, 7901, 111, 795, 768, 79, 795, 777,
+    7903, 111, 795, 777, 79, 795, 771, 7905, 111, 795, 771, 79,
+    795, 803, 7907, 111, 795, 803, 85, 803, 7909, 117, 803, 85,
+    777, 7911, 117, 777, 85, 795, 769, 7913, 117, 795, 769, 85,
+    795, 768, 7915, 117, 795, 768, 85, 795, 777, 7917, 117, 795,
+    777, 85, 795, 771, 7919, 117, 795, 771, 85, 795, 803, 7921,
+    117, 795, 803, 89, 768, 7923, 121, 768, 89, 803, 7925, 121,
+    803, 89, 777, 7927, 121, 777, 89, 771, 7929, 121, 771, 7931,
+    7933, 7935, 945, 787, 945, 788, 945, 787, 768, 945, 788, 768,
+    945, 787, 769, 945, 788, 769, 945, 787, 834, 945, 788, 834,
+    913, 787, 7936, 913, 788, 7937, 913, 787, 768, 7938, 913, 788,
+    768, 7939, 913, 787, 769, 7940, 913, 788, 769, 7941, 913, 787,
+    834, 7942, 913, 788, 834, 7943, 949, 787, 949, 788, 949, 787,
+    768, 949, 788, 768, 949, 787, 769, 949, 788, 769, 917, 787,
+    7952, 917, 788, 7953, 917, 787, 768, 7954, 917, 788, 768, 7955,
+    917, 787, 769, 7956, 917, 788, 769, 7957, 951, 787, 951, 788,
+    951, 787, 768, 951, 788, 768, 951, 787, 769, 951, 788, 769,
+    951, 787, 834, 951, 788, 834, 919, 787, 7968, 919, 788, 7969,
+    919, 787, 768, 7970, 919, 788, 768, 7971, 919, 787, 769, 7972,
+    919, 788, 769, 7973, 919, 787, 834, 7974, 919, 788, 834, 7975,
+    953, 787, 953, 788, 953, 787, 768, 953, 788, 768, 953, 787,
+    769, 953, 788, 769, 953, 787, 834, 953, 788, 834, 921, 787,
+    7984, 921, 788, 7985, 921, 787, 768, 7986, 921, 788, 768, 7987,
+    921, 787, 769, 7988, 921, 788, 769, 7989, 921, 787, 834, 7990,
+    921, 788, 834, 7991, 959, 787, 959, 788, 959, 787, 768, 959,
+    788, 768, 959, 787, 769, 959, 788, 769, 927, 787, 8000, 927,
+    788, 8001, 927, 787, 768, 8002, 927, 788, 768, 8003, 927, 787,
+    769, 8004, 927, 788, 769, 8005, 965, 787, 965, 788, 965, 787,
+    768, 965, 788, 768, 965, 787, 769, 965, 788, 769, 965, 787,
+    834, 965, 788, 834, 933, 788, 8017, 933, 788, 768, 8019, 933,
+    788, 769, 8021, 933, 788, 834, 8023, 969, 787, 969, 788, 969,
+    787, 768, 969, 788, 768, 969, 787, 769, 969, 788, 769, 969,
+    787, 834, 969, 788, 834, 937, 787, 8032, 937, 788, 8033, 937,
+    787, 768, 8034, 937, 788, 768, 8035, 937, 787, 769, 8036, 937,
+    788, 769, 8037, 937, 787, 834, 8038, 937, 788, 834, 8039, 945,
+    768, 949, 768, 951, 768, 953, 768, 959, 768, 965, 768, 969,
+    768, 945, 787, 837, 945, 788, 837, 945, 787, 768, 837, 945,
+    788, 768, 837, 945, 787, 769, 837, 945, 788, 769, 837, 945,
+    787, 834, 837, 945, 788, 834, 837, 913, 787, 837, 8064, 913,
+    788, 837, 8065, 913, 787, 768, 837, 8066, 913, 788, 768, 837,
+    8067, 913, 787, 769, 837, 8068, 913, 788, 769, 837, 8069, 913,
+    787, 834, 837, 8070, 913, 788, 834, 837, 8071, 951, 787, 837,
+    951, 788, 837, 951, 787, 768, 837, 951, 788, 768, 837, 951,
+    787, 769, 837, 951, 788, 769, 837, 951, 787, 834, 837, 951,
+    788, 834, 837, 919, 787, 837, 8080, 919, 788, 837, 8081, 919,
+    787, 768, 837, 8082, 919, 788, 768, 837, 8083, 919, 787, 769,
+    837, 8084, 919, 788, 769, 837, 8085, 919, 787, 834, 837, 8086,
+    919, 788, 834, 837, 8087, 969, 787, 837, 969, 788, 837, 969,
+    787, 768, 837, 969, 788, 768, 837, 969, 787, 769, 837, 969,
+    788, 769, 837, 969, 787, 834, 837, 969, 788, 834, 837, 937,
+    787, 837, 8096, 937, 788, 837, 8097, 937, 787, 768, 837, 8098,
+    937, 788, 768, 837, 8099, 937, 787, 769, 837, 8100, 937, 788,
+    769, 837, 8101, 937, 787, 834, 837, 8102, 937, 788, 834, 837,
+    8103, 945, 774, 945, 772, 945, 768, 837, 945, 837, 945, 769,
+    837, 945, 834, 945, 834, 837, 913, 774, 8112, 913, 772, 8113,
+    913, 768, 8048, 8049, 913, 837, 8115, 32, 787, 32, 834, 168,
+    834, 32, 776, 834, 951, 768, 837, 951, 837, 951, 769, 837,
+    951, 834, 951, 834, 837, 917, 768, 8050, 8051, 919, 768, 8052,
+    8053, 919, 837, 8131, 8127, 768, 32, 787, 768, 8127, 769, 32,
+    787, 769, 8127, 834, 32, 787, 834, 953, 774, 953, 772, 953,
+    776, 768, 953, 834, 953, 776, 834, 921, 774, 8144, 921, 772,
+    8145, 921, 768, 8054, 8055, 8190, 768, 32, 788, 768, 8190, 769,
+    32, 788, 769, 8190, 834, 32, 788, 834, 965, 774, 965, 772,
+    965, 776, 768, 961, 787, 961, 788, 965, 834, 965, 776, 834,
+    933, 774, 8160, 933, 772, 8161, 933, 768, 8058, 8059, 929, 788,
+    8165, 168, 768, 32, 776, 768, 96, 969, 768, 837, 969, 837,
+    969, 769, 837, 969, 834, 969, 834, 837, 927, 768, 8056, 8057,
+    937, 768, 8060, 8061, 937, 837, 8179, 180, 32, 788, 8194, 8195,
+    8208, 32, 819, 46, 46, 46, 46, 46, 46, 8242, 8242, 8242,
+    8242, 8242, 8245, 8245, 8245, 8245, 8245, 33, 33, 32, 773, 63,
+    63, 63, 33, 33, 63, 8242, 8242, 8242, 8242, 48, 52, 53,
+    54, 55, 56, 57, 43, 8722, 61, 40, 41, 82, 115, 97,
+    47, 99, 97, 47, 115, 67, 176, 67, 99, 47, 111, 99,
+    47, 117, 400, 176, 70, 78, 111, 81, 83, 77, 84, 69,
+    76, 84, 77, 90, 937, 70, 8526, 1488, 1489, 1490, 1491, 70,
+    65, 88, 915, 928, 8721, 49, 8260, 55, 49, 8260, 57, 49,
+    8260, 49, 48, 49, 8260, 51, 50, 8260, 51, 49, 8260, 53,
+    50, 8260, 53, 51, 8260, 53, 52, 8260, 53, 49, 8260, 54,
+    53, 8260, 54, 49, 8260, 56, 51, 8260, 56, 53, 8260, 56,
+    55, 8260, 56, 49, 8260, 8560, 73, 73, 8561, 73, 73, 73,
+    8562, 73, 86, 8563, 86, 8564, 86, 73, 8565, 86, 73, 73,
+    8566, 86, 73, 73, 73, 8567, 73, 88, 8568, 88, 8569, 88,
+    73, 8570, 88, 73, 73, 8571, 8572, 8573, 8574, 8575, 105, 105,
+    105, 105, 105, 105, 118, 118, 105, 118, 105, 105, 118, 105,
+    105, 105, 105, 120, 120, 105, 120, 105, 105, 8580, 48, 8260,
+    51, 8592, 824, 8594, 824, 8596, 824, 8656, 824, 8660, 824, 8658,
+    824, 8707, 824, 8712, 824, 8715, 824, 8739, 824, 8741, 824, 8747,
+    8747, 8747, 8747, 8747, 8750, 8750, 8750, 8750, 8750, 8764, 824, 8771,
+    824, 8773, 824, 8776, 824, 61, 824, 8801, 824, 8781, 824, 60,
+    824, 62, 824, 8804, 824, 8805, 824, 8818, 824, 8819, 824, 8822,
+    824, 8823, 824, 8826, 824, 8827, 824, 8834, 824, 8835, 824, 8838,
+    824, 8839, 824, 8866, 824, 8872, 824, 8873, 824, 8875, 824, 8828,
+    824, 8829, 824, 8849, 824, 8850, 824, 8882, 824, 8883, 824, 8884,
+    824, 8885, 824, 12296, 12297, 49, 48, 49, 49, 49, 50, 49,
+    51, 49, 52, 49, 53, 49, 54, 49, 55, 49, 56, 49,
+    57, 50, 48, 40, 49, 41, 40, 50, 41, 40, 51, 41,
+    40, 52, 41, 40, 53, 41, 40, 54, 41, 40, 55, 41,
+    40, 56, 41, 40, 57, 41, 40, 49, 48, 41, 40, 49,
+    49, 41, 40, 49, 50, 41, 40, 49, 51, 41, 40, 49,
+    52, 41, 40, 49, 53, 41, 40, 49, 54, 41, 40, 49,
+    55, 41, 40, 49, 56, 41, 40, 49, 57, 41, 40, 50,
+    48, 41, 49, 46, 50, 46, 51, 46, 52, 46, 53, 46,
+    54, 46, 55, 46, 56, 46, 57, 46, 49, 48, 46, 49,
+    49, 46, 49, 50, 46, 49, 51, 46, 49, 52, 46, 49,
+    53, 46, 49, 54, 46, 49, 55, 46, 49, 56, 46, 49,
+    57, 46, 50, 48, 46, 40, 97, 41, 40, 98, 41, 40,
+    99, 41, 40, 100, 41, 40, 101, 41, 40, 102, 41, 40,
+    103, 41, 40, 104, 41, 40, 105, 41, 40, 106, 41, 40,
+    107, 41, 40, 108, 41, 40, 109, 41, 40, 110, 41, 40,
+    111, 41, 40, 112, 41, 40, 113, 41, 40, 114, 41, 40,
+    115, 41, 40, 116, 41, 40, 117, 41, 40, 118, 41, 40,
+    119, 41, 40, 120, 41, 40, 121, 41, 40, 122, 41, 9424,
+    9425, 9426, 9427, 9428, 9429, 9430, 9431, 9432, 9433, 9434, 9435, 9436,
+    9437, 9438, 9439, 9440, 9441, 83, 9442, 9443, 9444, 9445, 9446, 9447,
+    89, 9448, 9449, 8747, 8747, 8747, 8747, 58, 58, 61, 61, 61,
+    61, 61, 61, 10973, 824, 11312, 11313, 11314, 11315, 11316, 11317, 11318,
+    11319, 11320, 11321, 11322, 11323, 11324, 11325, 11326, 11327, 11328, 11329, 11330,
+    11331, 11332, 11333, 11334, 11335, 11336, 11337, 11338, 11339, 11340, 11341, 11342,
+    11343, 11344, 11345, 11346, 11347, 11348, 11349, 11350, 11351, 11352, 11353, 11354,
+    11355, 11356, 11357, 11358, 11359, 11361, 619, 7549, 637, 11368, 11370, 11372,
+    11379, 11382, 575, 576, 11393, 11395, 11397, 11399, 11401, 11403, 11405, 11407,
+    11409, 11411, 11413, 11415, 11417, 11419, 11421, 11423, 11425, 11427, 11429, 11431,
+    11433, 11435, 11437, 11439, 11441, 11443, 11445, 11447, 11449, 11451, 11453, 11455,
+    11457, 11459, 11461, 11463, 11465, 11467, 11469, 11471, 11473, 11475, 11477, 11479,
+    11481, 11483, 11485, 11487, 11489, 11491, 11500, 11502, 11507, 11617, 27597, 40863,
+    19968, 20008, 20022, 20031, 20057, 20101, 20108, 20128, 20154, 20799, 20837, 20843,
+    20866, 20886, 20907, 20960, 20981, 20992, 21147, 21241, 21269, 21274, 21304, 21313,
+    21340, 21353, 21378, 21430, 21448, 21475, 22231, 22303, 22763, 22786, 22794, 22805,
+    22823, 22899, 23376, 23424, 23544, 23567, 23586, 23608, 23662, 23665, 24027, 24037,
+    24049, 24062, 24178, 24186, 24191, 24308, 24318, 24331, 24339, 24400, 24417, 24435,
+    24515, 25096, 25142, 25163, 25903, 25908, 25991, 26007, 26020, 26041, 26080, 26085,
+    26352, 26376, 26408, 27424, 27490, 27513, 27571, 27595, 27604, 27611, 27663, 27668,
+    27700, 28779, 29226, 29238, 29243, 29247, 29255, 29273, 29275, 29356, 29572, 29577,
+    29916, 29926, 29976, 29983, 29992, 30000, 30091, 30098, 30326, 30333, 30382, 30399,
+    30446, 30683, 30690, 30707, 31034, 31160, 31166, 31348, 31435, 31481, 31859, 31992,
+    32566, 32593, 32650, 32701, 32769, 32780, 32786, 32819, 32895, 32905, 33251, 33258,
+    33267, 33276, 33292, 33307, 33311, 33390, 33394, 33400, 34381, 34411, 34880, 34892,
+    34915, 35198, 35211, 35282, 35328, 35895, 35910, 35925, 35960, 35997, 36196, 36208,
+    36275, 36523, 36554, 36763, 36784, 36789, 37009, 37193, 37318, 37324, 37329, 38263,
+    38272, 38428, 38582, 38585, 38632, 38737, 38750, 38754, 38761, 38859, 38893, 38899,
+    38913, 39080, 39131, 39135, 39318, 39321, 39340, 39592, 39640, 39647, 39717, 39727,
+    39730, 39740, 39770, 40165, 40565, 40575, 40613, 40635, 40643, 40653, 40657, 40697,
+    40701, 40718, 40723, 40736, 40763, 40778, 40786, 40845, 40860, 40864, 12306, 21316,
+    21317, 12363, 12441, 12365, 12441, 12367, 12441, 12369, 12441, 12371, 12441, 12373,
+    12441, 12375, 12441, 12377, 12441, 12379, 12441, 12381, 12441, 12383, 12441, 12385,
+    12441, 12388, 12441, 12390, 12441, 12392, 12441, 12399, 12441, 12399, 12442, 12402,
+    12441, 12402, 12442, 12405, 12441, 12405, 12442, 12408, 12441, 12408, 12442, 12411,
+    12441, 12411, 12442, 12358, 12441, 32, 12441, 32, 12442, 12445, 12441, 12424,
+    12426, 12459, 12441, 12461, 12441, 12463, 12441, 12465, 12441, 12467, 12441, 12469,
+    12441, 12471, 12441, 12473, 12441, 12475, 12441, 12477, 12441, 12479, 12441, 12481,
+    12441, 12484, 12441, 12486, 12441, 12488, 12441, 12495, 12441, 12495, 12442, 12498,
+    12441, 12498, 12442, 12501, 12441, 12501, 12442, 12504, 12441, 12504, 12442, 12507,
+    12441, 12507, 12442, 12454, 12441, 12527, 12441, 12528, 12441, 12529, 12441, 12530,
+    12441, 12541, 12441, 12467, 12488, 4352, 4353, 4522, 4354, 4524, 4525, 4355,
+    4356, 4357, 4528, 4529, 4530, 4531, 4532, 4533, 4378, 4358, 4359, 4360,
+    4385, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4449,
+    4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461,
+    4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469, 4448, 4372, 4373, 4551,
+    4552, 4556, 4558, 4563, 4567, 4569, 4380, 4573, 4575, 4381, 4382, 4384,
+    4386, 4387, 4391, 4393, 4395, 4396, 4397, 4398, 4399, 4402, 4406, 4416,
+    4423, 4428, 4593, 4594, 4439, 4440, 4441, 4484, 4485, 4488, 4497, 4498,
+    4500, 4510, 4513, 19977, 22235, 19978, 20013, 19979, 30002, 19993, 19969, 22825,
+    22320, 40, 4352, 41, 40, 4354, 41, 40, 4355, 41, 40, 4357,
+    41, 40, 4358, 41, 40, 4359, 41, 40, 4361, 41, 40, 4363,
+    41, 40, 4364, 41, 40, 4366, 41, 40, 4367, 41, 40, 4368,
+    41, 40, 4369, 41, 40, 4370, 41, 40, 4352, 4449, 41, 40,
+    4354, 4449, 41, 40, 4355, 4449, 41, 40, 4357, 4449, 41, 40,
+    4358, 4449, 41, 40, 4359, 4449, 41, 40, 4361, 4449, 41, 40,
+    4363, 4449, 41, 40, 4364, 4449, 41, 40, 4366, 4449, 41, 40,
+    4367, 4449, 41, 40, 4368, 4449, 41, 40, 4369, 4449, 41, 40,
+    4370, 4449, 41, 40, 4364, 4462, 41, 40, 4363, 4457, 4364, 4453,
+    4523, 41, 40, 4363, 4457, 4370, 4462, 41, 40, 19968, 41, 40,
+    20108, 41, 40, 19977, 41, 40, 22235, 41, 40, 20116, 41, 40,
+    20845, 41, 40, 19971, 41, 40, 20843, 41, 40, 20061, 41, 40,
+    21313, 41, 40, 26376, 41, 40, 28779, 41, 40, 27700, 41, 40,
+    26408, 41, 40, 37329, 41, 40, 22303, 41, 40, 26085, 41, 40,
+    26666, 41, 40, 26377, 41, 40, 31038, 41, 40, 21517, 41, 40,
+    29305, 41, 40, 36001, 41, 40, 31069, 41, 40, 21172, 41, 40,
+    20195, 41, 40, 21628, 41, 40, 23398, 41, 40, 30435, 41, 40,
+    20225, 41, 40, 36039, 41, 40, 21332, 41, 40, 31085, 41, 40,
+    20241, 41, 40, 33258, 41, 40, 33267, 41, 21839, 24188, 31631, 80,
+    84, 69, 50, 49, 50, 50, 50, 51, 50, 52, 50, 53,
+    50, 54, 50, 55, 50, 56, 50, 57, 51, 48, 51, 49,
+    51, 50, 51, 51, 51, 52, 51, 53, 4352, 4449, 4354, 4449,
+    4355, 4449, 4357, 4449, 4358, 4449, 4359, 4449, 4361, 4449, 4363, 4449,
+    4364, 4449, 4366, 4449, 4367, 4449, 4368, 4449, 4369, 4449, 4370, 4449,
+    4366, 4449, 4535, 4352, 4457, 4364, 4462, 4363, 4468, 4363, 4462, 20116,
+    20845, 19971, 20061, 26666, 26377, 31038, 21517, 29305, 36001, 31069, 21172, 31192,
+    30007, 36969, 20778, 21360, 27880, 38917, 20241, 20889, 27491, 24038, 21491, 21307,
+    23447, 23398, 30435, 20225, 36039, 21332, 22812, 51, 54, 51, 55, 51,
+    56, 51, 57, 52, 48, 52, 49, 52, 50, 52, 51, 52,
+    52, 52, 53, 52, 54, 52, 55, 52, 56, 52, 57, 53,
+    48, 49, 26376, 50, 26376, 51, 26376, 52, 26376, 53, 26376, 54,
+    26376, 55, 26376, 56, 26376, 57, 26376, 49, 48, 26376, 49, 49,
+    26376, 49, 50, 26376, 72, 103, 101, 114, 103, 101, 86, 76,
+    84, 68, 12450, 12452, 12454, 12456, 12458, 12459, 12461, 12463, 12465, 12467,
+    12469, 12471, 12473, 12475, 12477, 12479, 12481, 12484, 12486, 12488, 12490, 12491,
+    12492, 12493, 12494, 12495, 12498, 12501, 12504, 12507, 12510, 12511, 12512, 12513,
+    12514, 12516, 12518, 12520, 12521, 12522, 12523, 12524, 12525, 12527, 12528, 12529,
+    12530, 20196, 21644, 12450, 12495, 12442, 12540, 12488, 12450, 12523, 12501, 12449,
+    12450, 12531, 12504, 12442, 12450, 12450, 12540, 12523, 12452, 12491, 12531, 12463,
+    12441, 12452, 12531, 12481, 12454, 12457, 12531, 12456, 12473, 12463, 12540, 12488,
+    12441, 12456, 12540, 12459, 12540, 12458, 12531, 12473, 12458, 12540, 12512, 12459,
+    12452, 12522, 12459, 12521, 12483, 12488, 12459, 12525, 12522, 12540, 12459, 12441,
+    12525, 12531, 12459, 12441, 12531, 12510, 12461, 12441, 12459, 12441, 12461, 12441,
+    12491, 12540, 12461, 12517, 12522, 12540, 12461, 12441, 12523, 12479, 12441, 12540,
+    12461, 12525, 12461, 12525, 12463, 12441, 12521, 12512, 12461, 12525, 12513, 12540,
+    12488, 12523, 12461, 12525, 12527, 12483, 12488, 12463, 12441, 12521, 12512, 12463,
+    12441, 12521, 12512, 12488, 12531, 12463, 12523, 12475, 12441, 12452, 12525, 12463,
+    12525, 12540, 12493, 12465, 12540, 12473, 12467, 12523, 12490, 12467, 12540, 12507,
+    12442, 12469, 12452, 12463, 12523, 12469, 12531, 12481, 12540, 12512, 12471, 12522,
+    12531, 12463, 12441, 12475, 12531, 12481, 12475, 12531, 12488, 12479, 12441, 12540,
+    12473, 12486, 12441, 12471, 12488, 12441, 12523, 12488, 12531, 12490, 12494, 12494,
+    12483, 12488, 12495, 12452, 12484, 12495, 12442, 12540, 12475, 12531, 12488, 12495,
+    12442, 12540, 12484, 12495, 12441, 12540, 12524, 12523, 12498, 12442, 12450, 12473,
+    12488, 12523, 12498, 12442, 12463, 12523, 12498, 12442, 12467, 12498, 12441, 12523,
+    12501, 12449, 12521, 12483, 12488, 12441, 12501, 12451, 12540, 12488, 12501, 12441,
+    12483, 12471, 12455, 12523, 12501, 12521, 12531, 12504, 12463, 12479, 12540, 12523,
+    12504, 12442, 12477, 12504, 12442, 12491, 12498, 12504, 12523, 12484, 12504, 12442,
+    12531, 12473, 12504, 12442, 12540, 12471, 12441, 12504, 12441, 12540, 12479, 12507,
+    12442, 12452, 12531, 12488, 12507, 12441, 12523, 12488, 12507, 12531, 12507, 12442,
+    12531, 12488, 12441, 12507, 12540, 12523, 12507, 12540, 12531, 12510, 12452, 12463,
+    12525, 12510, 12452, 12523, 12510, 12483, 12495, 12510, 12523, 12463, 12510, 12531,
+    12471, 12519, 12531, 12511, 12463, 12525, 12531, 12511, 12522, 12511, 12522, 12495,
+    12441, 12540, 12523, 12513, 12459, 12441, 12513, 12459, 12441, 12488, 12531, 12513,
+    12540, 12488, 12523, 12516, 12540, 12488, 12441, 12516, 12540, 12523, 12518, 12450,
+    12531, 12522, 12483, 12488, 12523, 12522, 12521, 12523, 12498, 12442, 12540, 12523,
+    12540, 12501, 12441, 12523, 12524, 12512, 12524, 12531, 12488, 12465, 12441, 12531,
+    12527, 12483, 12488, 48, 28857, 49, 28857, 50, 28857, 51, 28857, 52,
+    28857, 53, 28857, 54, 28857, 55, 28857, 56, 28857, 57, 28857, 49,
+    48, 28857, 49, 49, 28857, 49, 50, 28857, 49, 51, 28857, 49,
+    52, 28857, 49, 53, 28857, 49, 54, 28857, 49, 55, 28857, 49,
+    56, 28857, 49, 57, 28857, 50, 48, 28857, 50, 49, 28857, 50,
+    50, 28857, 50, 51, 28857, 50, 52, 28857, 104, 80, 97, 100,
+    97, 65, 85, 98, 97, 114, 111, 86, 112, 99, 100, 109,
+    100, 109, 50, 100, 109, 51, 73, 85, 24179, 25104, 26157, 21644,
+    22823, 27491, 26126, 27835, 26666, 24335, 20250, 31038, 112, 65, 110, 65,
+    956, 65, 109, 65, 107, 65, 75, 66, 77, 66, 71, 66,
+    99, 97, 108, 107, 99, 97, 108, 112, 70, 110, 70, 956,
+    70, 956, 103, 109, 103, 107, 103, 72, 122, 107, 72, 122,
+    77, 72, 122, 71, 72, 122, 84, 72, 122, 956, 108, 109,
+    108, 100, 108, 107, 108, 102, 109, 110, 109, 956, 109, 109,
+    109, 99, 109, 107, 109, 109, 109, 50, 99, 109, 50, 109,
+    50, 107, 109, 50, 109, 109, 51, 99, 109, 51, 109, 51,
+    107, 109, 51, 109, 8725, 115, 109, 8725, 115, 50, 80, 97,
+    107, 80, 97, 77, 80, 97, 71, 80, 97, 114, 97, 100,
+    114, 97, 100, 8725, 115, 114, 97, 100, 8725, 115, 50, 112,
+    115, 110, 115, 956, 115, 109, 115, 112, 86, 110, 86, 956,
+    86, 109, 86, 107, 86, 77, 86, 112, 87, 110, 87, 956,
+    87, 109, 87, 107, 87, 77, 87, 107, 937, 77, 937, 97,
+    46, 109, 46, 66, 113, 99, 99, 99, 100, 67, 8725, 107,
+    103, 67, 111, 46, 100, 66, 71, 121, 104, 97, 72, 80,
+    105, 110, 75, 75, 75, 77, 107, 116, 108, 109, 108, 110,
+    108, 111, 103, 108, 120, 109, 98, 109, 105, 108, 109, 111,
+    108, 80, 72, 112, 46, 109, 46, 80, 80, 77, 80, 82,
+    115, 114, 83, 118, 87, 98, 86, 8725, 109, 65, 8725, 109,
+    49, 26085, 50, 26085, 51, 26085, 52, 26085, 53, 26085, 54, 26085,
+    55, 26085, 56, 26085, 57, 26085, 49, 48, 26085, 49, 49, 26085,
+    49, 50, 26085, 49, 51, 26085, 49, 52, 26085, 49, 53, 26085,
+    49, 54, 26085, 49, 55, 26085, 49, 56, 26085, 49, 57, 26085,
+    50, 48, 26085, 50, 49, 26085, 50, 50, 26085, 50, 51, 26085,
+    50, 52, 26085, 50, 53, 26085, 50, 54, 26085, 50, 55, 26085,
+    50, 56, 26085, 50, 57, 26085, 51, 48, 26085, 51, 49, 26085,
+    103, 97, 108, 42561, 42563, 42565, 42567, 42569, 42571, 42573, 42575, 42577,
+    42579, 42581, 42583, 42585, 42587, 42589, 42591, 42593, 42595, 42597, 42599, 42601,
+    42603, 42605, 42625, 42627, 42629, 42631, 42633, 42635, 42637, 42639, 42641, 42643,
+    42645, 42647, 42649, 42651, 42787, 42789, 42791, 42793, 42795, 42797, 42799, 42803,
+    42805, 42807, 42809, 42811, 42813, 42815, 42817, 42819, 42821, 42823, 42825, 42827,
+    42829, 42831, 42833, 42835, 42837, 42839, 42841, 42843, 42845, 42847, 42849, 42851,
+    42853, 42855, 42857, 42859, 42861, 42863, 42874, 42876, 7545, 42879, 42881, 42883,
+    42885, 42887, 42892, 42897, 42899, 42903, 42905, 42907, 42909, 42911, 42913, 42915,
+    42917, 42919, 42921, 620, 670, 647, 43859, 42933, 42935, 42937, 42939, 42941,
+    42943, 42945, 42947, 42900, 7566, 42952, 42954, 42961, 42967, 42969, 42998, 294,
+    43831, 43858, 653, 35912, 26356, 36040, 28369, 20018, 21477, 22865, 21895, 22856,
+    25078, 30313, 32645, 34367, 34746, 35064, 37007, 27138, 27931, 28889, 29662, 33853,
+    37226, 39409, 20098, 21365, 27396, 29211, 34349, 40478, 23888, 28651, 34253, 35172,
+    25289, 33240, 34847, 24266, 26391, 28010, 29436, 37070, 20358, 20919, 21214, 25796,
+    27347, 29200, 30439, 34310, 34396, 36335, 38706, 39791, 40442, 30860, 31103, 32160,
+    33737, 37636, 35542, 22751, 24324, 31840, 32894, 29282, 30922, 36034, 38647, 22744,
+    23650, 27155, 28122, 28431, 32047, 32311, 38475, 21202, 32907, 20956, 20940, 31260,
+    32190, 33777, 38517, 35712, 25295, 35582, 20025, 23527, 24594, 29575, 30064, 21271,
+    30971, 20415, 24489, 19981, 27852, 25976, 32034, 21443, 22622, 30465, 33865, 35498,
+    27578, 27784, 25342, 33509, 25504, 30053, 20142, 20841, 20937, 26753, 31975, 33391,
+    35538, 37327, 21237, 21570, 24300, 26053, 28670, 31018, 38317, 39530, 40599, 40654,
+    26310, 27511, 36706, 24180, 24976, 25088, 25754, 28451, 29001, 29833, 31178, 32244,
+    32879, 36646, 34030, 36899, 37706, 21015, 21155, 21693, 28872, 35010, 24265, 24565,
+    25467, 27566, 31806, 29557, 20196, 22265, 23994, 24604, 29618, 29801, 32666, 32838,
+    37428, 38646, 38728, 38936, 20363, 31150, 37300, 38584, 24801, 20102, 20698, 23534,
+    23615, 26009, 29134, 30274, 34044, 36988, 26248, 38446, 21129, 26491, 26611, 27969,
+    28316, 29705, 30041, 30827, 32016, 39006, 25134, 38520, 20523, 23833, 28138, 36650,
+    24459, 24900, 26647, 38534, 21033, 21519, 23653, 26131, 26446, 26792, 27877, 29702,
+    30178, 32633, 35023, 35041, 38626, 21311, 28346, 21533, 29136, 29848, 34298, 38563,
+    40023, 40607, 26519, 28107, 33256, 31520, 31890, 29376, 28825, 35672, 20160, 33590,
+    21050, 20999, 24230, 25299, 31958, 23429, 27934, 26292, 36667, 38477, 24275, 20800,
+    21952, 22618, 26228, 20958, 29482, 30410, 31036, 31070, 31077, 31119, 38742, 31934,
+    34322, 35576, 36920, 37117, 39151, 39164, 39208, 40372, 37086, 38583, 20398, 20711,
+    20813, 21193, 21220, 21329, 21917, 22022, 22120, 22592, 22696, 23652, 24724, 24936,
+    24974, 25074, 25935, 26082, 26257, 26757, 28023, 28186, 28450, 29038, 29227, 29730,
+    30865, 31049, 31048, 31056, 31062, 31117, 31118, 31296, 31361, 31680, 32265, 32321,
+    32626, 32773, 33261, 33401, 33879, 35088, 35222, 35585, 35641, 36051, 36104, 36790,
+    38627, 38911, 38971, 24693, 148206, 33304, 20006, 20917, 20840, 20352, 20805, 20864,
+    21191, 21242, 21845, 21913, 21986, 22707, 22852, 22868, 23138, 23336, 24274, 24281,
+    24425, 24493, 24792, 24910, 24840, 24928, 25140, 25540, 25628, 25682, 25942, 26395,
+    26454, 28379, 28363, 28702, 30631, 29237, 29359, 29809, 29958, 30011, 30237, 30239,
+    30427, 30452, 30538, 30528, 30924, 31409, 31867, 32091, 32574, 33618, 33775, 34681,
+    35137, 35206, 35519, 35531, 35565, 35722, 36664, 36978, 37273, 37494, 38524, 38875,
+    38923, 39698, 141386, 141380, 144341, 15261, 16408, 16441, 152137, 154832, 163539, 40771,
+    40846, 102, 102, 102, 105, 102, 108, 102, 102, 105, 102, 102,
+    108, 115, 116, 1396, 1398, 1396, 1381, 1396, 1387, 1406, 1398, 1396,
+    1389, 1497, 1460, 1522, 1463, 1506, 1492, 1499, 1500, 1501, 1512, 1514,
+    1513, 1473, 1513, 1474, 1513, 1468, 1473, 1513, 1468, 1474, 1488, 1463,
+    1488, 1464, 1488, 1468, 1489, 1468, 1490, 1468, 1491, 1468, 1492, 1468,
+    1493, 1468, 1494, 1468, 1496, 1468, 1497, 1468, 1498, 1468, 1499, 1468,
+    1500, 1468, 1502, 1468, 1504, 1468, 1505, 1468, 1507, 1468, 1508, 1468,
+    1510, 1468, 1511, 1468, 1512, 1468, 1513, 1468, 1514, 1468, 1493, 1465,
+    1489, 1471, 1499, 1471, 1508, 1471, 1488, 1500, 1649, 1659, 1662, 1664,
+    1658, 1663, 1657, 1700, 1702, 1668, 1667, 1670, 1671, 1677, 1676, 1678,
+    1672, 1688, 1681, 1705, 1711, 1715, 1713, 1722, 1723, 1729, 1726, 1746,
+    1709, 1735, 1734, 1736, 1739, 1733, 1737, 1744, 1609, 1610, 1620, 1575,
+    1610, 1620, 1749, 1610, 1620, 1608, 1610, 1620, 1735, 1610, 1620, 1734,
+    1610, 1620, 1736, 1610, 1620, 1744, 1610, 1620, 1609, 1740, 1610, 1620,
+    1580, 1610, 1620, 1581, 1610, 1620, 1605, 1610, 1620, 1610, 1576, 1580,
+    1576, 1581, 1576, 1582, 1576, 1605, 1576, 1609, 1576, 1610, 1578, 1580,
+    1578, 1581, 1578, 1582, 1578, 1605, 1578, 1609, 1578, 1610, 1579, 1580,
+    1579, 1605, 1579, 1609, 1579, 1610, 1580, 1581, 1580, 1605, 1581, 1580,
+    1581, 1605, 1582, 1580, 1582, 1581, 1582, 1605, 1587, 1580, 1587, 1581,
+    1587, 1582, 1587, 1605, 1589, 1581, 1589, 1605, 1590, 1580, 1590, 1581,
+    1590, 1582, 1590, 1605, 1591, 1581, 1591, 1605, 1592, 1605, 1593, 1580,
+    1593, 1605, 1594, 1580, 1594, 1605, 1601, 1580, 1601, 1581, 1601, 1582,
+    1601, 1605, 1601, 1609, 1601, 1610, 1602, 1581, 1602, 1605, 1602, 1609,
+    1602, 1610, 1603, 1575, 1603, 1580, 1603, 1581, 1603, 1582, 1603, 1604,
+    1603, 1605, 1603, 1609, 1603, 1610, 1604, 1580, 1604, 1581, 1604, 1582,
+    1604, 1605, 1604, 1609, 1604, 1610, 1605, 1580, 1605, 1581, 1605, 1582,
+    1605, 1605, 1605, 1609, 1605, 1610, 1606, 1580, 1606, 1581, 1606, 1582,
+    1606, 1605, 1606, 1609, 1606, 1610, 1607, 1580, 1607, 1605, 1607, 1609,
+    1607, 1610, 1610, 1580, 1610, 1581, 1610, 1582, 1610, 1605, 1610, 1609,
+    1610, 1610, 1584, 1648, 1585, 1648, 1609, 1648, 32, 1612, 1617, 32,
+    1613, 1617, 32, 1614, 1617, 32, 1615, 1617, 32, 1616, 1617, 32,
+    1617, 1648, 1610, 1620, 1585, 1610, 1620, 1586, 1610, 1620, 1606, 1576,
+    1585, 1576, 1586, 1576, 1606, 1578, 1585, 1578, 1586, 1578, 1606, 1579,
+    1585, 1579, 1586, 1579, 1606, 1605, 1575, 1606, 1585, 1606, 1586, 1606,
+    1606, 1610, 1585, 1610, 1586, 1610, 1606, 1610, 1620, 1582, 1610, 1620,
+    1607, 1576, 1607, 1578, 1607, 1589, 1582, 1604, 1607, 1606, 1607, 1607,
+    1648, 1610, 1607, 1579, 1607, 1587, 1607, 1588, 1605, 1588, 1607, 1600,
+    1614, 1617, 1600, 1615, 1617, 1600, 1616, 1617, 1591, 1609, 1591, 1610,
+    1593, 1609, 1593, 1610, 1594, 1609, 1594, 1610, 1587, 1609, 1587, 1610,
+    1588, 1609, 1588, 1610, 1581, 1609, 1581, 1610, 1580, 1609, 1580, 1610,
+    1582, 1609, 1582, 1610, 1589, 1609, 1589, 1610, 1590, 1609, 1590, 1610,
+    1588, 1580, 1588, 1581, 1588, 1582, 1588, 1585, 1587, 1585, 1589, 1585,
+    1590, 1585, 1575, 1611, 1578, 1580, 1605, 1578, 1581, 1580, 1578, 1581,
+    1605, 1578, 1582, 1605, 1578, 1605, 1580, 1578, 1605, 1581, 1578, 1605,
+    1582, 1580, 1605, 1581, 1581, 1605, 1610, 1581, 1605, 1609, 1587, 1581,
+    1580, 1587, 1580, 1581, 1587, 1580, 1609, 1587, 1605, 1581, 1587, 1605,
+    1580, 1587, 1605, 1605, 1589, 1581, 1581, 1589, 1605, 1605, 1588, 1581,
+    1605, 1588, 1580, 1610, 1588, 1605, 1582, 1588, 1605, 1605, 1590, 1581,
+    1609, 1590, 1582, 1605, 1591, 1605, 1581, 1591, 1605, 1605, 1591, 1605,
+    1610, 1593, 1580, 1605, 1593, 1605, 1605, 1593, 1605, 1609, 1594, 1605,
+    1605, 1594, 1605, 1610, 1594, 1605, 1609, 1601, 1582, 1605, 1602, 1605,
+    1581, 1602, 1605, 1605, 1604, 1581, 1605, 1604, 1581, 1610, 1604, 1581,
+    1609, 1604, 1580, 1580, 1604, 1582, 1605, 1604, 1605, 1581, 1605, 1581,
+    1580, 1605, 1581, 1605, 1605, 1581, 1610, 1605, 1580, 1581, 1605, 1580,
+    1605, 1605, 1582, 1580, 1605, 1582, 1605, 1605, 1580, 1582, 1607, 1605,
+    1580, 1607, 1605, 1605, 1606, 1581, 1605, 1606, 1581, 1609, 1606, 1580,
+    1605, 1606, 1580, 1609, 1606, 1605, 1610, 1606, 1605, 1609, 1610, 1605,
+    1605, 1576, 1582, 1610, 1578, 1580, 1610, 1578, 1580, 1609, 1578, 1582,
+    1610, 1578, 1582, 1609, 1578, 1605, 1610, 1578, 1605, 1609, 1580, 1605,
+    1610, 1580, 1581, 1609, 1580, 1605, 1609, 1587, 1582, 1609, 1589, 1581,
+    1610, 1588, 1581, 1610, 1590, 1581, 1610, 1604, 1580, 1610, 1604, 1605,
+    1610, 1610, 1581, 1610, 1610, 1580, 1610, 1610, 1605, 1610, 1605, 1605,
+    1610, 1602, 1605, 1610, 1606, 1581, 1610, 1593, 1605, 1610, 1603, 1605,
+    1610, 1606, 1580, 1581, 1605, 1582, 1610, 1604, 1580, 1605, 1603, 1605,
+    1605, 1580, 1581, 1610, 1581, 1580, 1610, 1605, 1580, 1610, 1601, 1605,
+    1610, 1576, 1581, 1610, 1587, 1582, 1610, 1606, 1580, 1610, 1589, 1604,
+    1746, 1602, 1604, 1746, 1575, 1604, 1604, 1607, 1575, 1603, 1576, 1585,
+    1605, 1581, 1605, 1583, 1589, 1604, 1593, 1605, 1585, 1587, 1608, 1604,
+    1593, 1604, 1610, 1607, 1608, 1587, 1604, 1605, 1589, 1604, 1609, 1589,
+    1604, 1609, 32, 1575, 1604, 1604, 1607, 32, 1593, 1604, 1610, 1607,
+    32, 1608, 1587, 1604, 1605, 1580, 1604, 32, 1580, 1604, 1575, 1604,
+    1607, 1585, 1740, 1575, 1604, 44, 12289, 12290, 58, 33, 63, 12310,
+    12311, 8212, 8211, 95, 123, 125, 12308, 12309, 12304, 12305, 12298, 12299,
+    12300, 12301, 12302, 12303, 91, 93, 35, 38, 42, 45, 60, 62,
+    92, 36, 37, 64, 32, 1611, 1600, 1611, 32, 1612, 32, 1613,
+    32, 1614, 1600, 1614, 32, 1615, 1600, 1615, 32, 1616, 1600, 1616,
+    32, 1617, 1600, 1617, 32, 1618, 1600, 1618, 1569, 1575, 1576, 1577,
+    1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589,
+    1590, 1591, 1592, 1593, 1594, 1601, 1602, 1603, 1604, 1605, 1606, 1607,
+    1608, 1610, 1604, 1575, 1619, 1604, 1575, 1620, 1604, 1575, 1621, 1604,
+    1575, 34, 39, 47, 65345, 65346, 65347, 65348, 65349, 65350, 65351, 65352,
+    65353, 65354, 65355, 65356, 65357, 65358, 65359, 65360, 65361, 65362, 65363, 65364,
+    65365, 65366, 65367, 65368, 65369, 65370, 94, 124, 126, 10629, 10630, 12539,
+    12449, 12451, 12453, 12455, 12457, 12515, 12517, 12519, 12483, 12540, 12531, 12441,
+    12442, 162, 163, 172, 166, 165, 8361, 9474, 8592, 8593, 8594, 8595,
+    9632, 9675, 66600, 66601, 66602, 66603, 66604, 66605, 66606, 66607, 66608, 66609,
+    66610, 66611, 66612, 66613, 66614, 66615, 66616, 66617, 66618, 66619, 66620, 66621,
+    66622, 66623, 66624, 66625, 66626, 66627, 66628, 66629, 66630, 66631, 66632, 66633,
+    66634, 66635, 66636, 66637, 66638, 66639, 66776, 66777, 66778, 66779, 66780, 66781,
+    66782, 66783, 66784, 66785, 66786, 66787, 66788, 66789, 66790, 66791, 66792, 66793,
+    66794, 66795, 66796, 66797, 66798, 66799, 66800, 66801, 66802, 66803, 66804, 66805,
+    66806, 66807, 66808, 66809, 66810, 66811, 66967, 66968, 66969, 66970, 66971, 66972,
+    66973, 66974, 66975, 66976, 66977, 66979, 66980, 66981, 66982, 66983, 66984, 66985,
+    66986, 66987, 66988, 66989, 66990, 66991, 66992, 66993, 66995, 66996, 66997, 66998,
+    66999, 67000, 67001, 67003, 67004, 720, 721, 665, 675, 43878, 677, 676,
+    7569, 600, 606, 681, 612, 610, 667, 668, 615, 644, 682, 683,
+    122628, 42894, 622, 122629, 654, 122630, 630, 631, 634, 122632, 638, 680,
+    678, 43879, 679, 11377, 655, 673, 674, 664, 448, 449, 450, 122634,
+    122654, 68800, 68801, 68802, 68803, 68804, 68805, 68806, 68807, 68808, 68809, 68810,
+    68811, 68812, 68813, 68814, 68815, 68816, 68817, 68818, 68819, 68820, 68821, 68822,
+    68823, 68824, 68825, 68826, 68827, 68828, 68829, 68830, 68831, 68832, 68833, 68834,
+    68835, 68836, 68837, 68838, 68839, 68840, 68841, 68842, 68843, 68844, 68845, 68846,
+    68847, 68848, 68849, 68850, 69785, 69818, 69787, 69818, 69797, 69818, 69937, 69927,
+    69938, 69927, 70471, 70462, 70471, 70487, 70841, 70842, 70841, 70832, 70841, 70845,
+    71096, 71087, 71097, 71087, 71872, 71873, 71874, 71875, 71876, 71877, 71878, 71879,
+    71880, 71881, 71882, 71883, 71884, 71885, 71886, 71887, 71888, 71889, 71890, 71891,
+    71892, 71893, 71894, 71895, 71896, 71897, 71898, 71899, 71900, 71901, 71902, 71903,
+    71989, 71984, 93792, 93793, 93794, 93795, 93796, 93797, 93798, 93799, 93800, 93801,
+    93802, 93803, 93804, 93805, 93806, 93807, 93808, 93809, 93810, 93811, 93812, 93813,
+    93814, 93815, 93816, 93817, 93818, 93819, 93820, 93821, 93822, 93823, 119127, 119141,
+    119128, 119141, 119128, 119141, 119150, 119128, 119141, 119151, 119128, 119141, 119152, 119128,
+    119141, 119153, 119128, 119141, 119154, 119225, 119141, 119226, 119141, 119225, 119141, 119150,
+    119226, 119141, 119150, 119225, 119141, 119151, 119226, 119141, 119151, 305, 567, 913,
+    914, 916, 917, 918, 919, 921, 922, 923, 924, 925, 926, 927,
+    929, 932, 934, 935, 936, 8711, 8706, 988, 125218, 125219, 125220, 125221,
+    125222, 125223, 125224, 125225, 125226, 125227, 125228, 125229, 125230, 125231, 125232, 125233,
+    125234, 125235, 125236, 125237, 125238, 125239, 125240, 125241, 125242, 125243, 125244, 125245,
+    125246, 125247, 125248, 125249, 125250, 125251, 1646, 1697, 1647, 48, 46, 48,
+    44, 49, 44, 50, 44, 51, 44, 52, 44, 53, 44, 54,
+    44, 55, 44, 56, 44, 57, 44, 40, 65, 41, 40, 66,
+    41, 40, 67, 41, 40, 68, 41, 40, 69, 41, 40, 70,
+    41, 40, 71, 41, 40, 72, 41, 40, 73, 41, 40, 74,
+    41, 40, 75, 41, 40, 76, 41, 40, 77, 41, 40, 78,
+    41, 40, 79, 41, 40, 80, 41, 40, 81, 41, 40, 82,
+    41, 40, 83, 41, 40, 84, 41, 40, 85, 41, 40, 86,
+    41, 40, 87, 41, 40, 88, 41, 40, 89, 41, 40, 90,
+    41, 12308, 83, 12309, 67, 68, 87, 90, 72, 86, 83, 68,
+    83, 83, 80, 80, 86, 87, 67, 77, 67, 77, 68, 77,
+    82, 68, 74, 12411, 12363, 12467, 12467, 23383, 21452, 22810, 35299, 20132,
+    26144, 28961, 21069, 24460, 20877, 26032, 21021, 32066, 36009, 22768, 21561, 28436,
+    25237, 25429, 36938, 25351, 25171, 31105, 31354, 21512, 28288, 30003, 21106, 21942,
+    37197, 12308, 26412, 12309, 12308, 19977, 12309, 12308, 20108, 12309, 12308, 23433,
+    12309, 12308, 28857, 12309, 12308, 25171, 12309, 12308, 30423, 12309, 12308, 21213,
+    12309, 12308, 25943, 12309, 24471, 21487, 20029, 20024, 20033, 131362, 20320, 20411,
+    20482, 20602, 20633, 20687, 13470, 132666, 20820, 20836, 20855, 132380, 13497, 20839,
+    132427, 20887, 20900, 20172, 20908, 168415, 20995, 13535, 21051, 21062, 21111, 13589,
+    21253, 21254, 21321, 21338, 21363, 21373, 21375, 133676, 28784, 21450, 21471, 133987,
+    21483, 21489, 21510, 21662, 21560, 21576, 21608, 21666, 21750, 21776, 21843, 21859,
+    21892, 21931, 21939, 21954, 22294, 22295, 22097, 22132, 22766, 22478, 22516, 22541,
+    22411, 22578, 22577, 22700, 136420, 22770, 22775, 22790, 22818, 22882, 136872, 136938,
+    23020, 23067, 23079, 23000, 23142, 14062, 14076, 23304, 23358, 137672, 23491, 23512,
+    23539, 138008, 23551, 23558, 24403, 14209, 23648, 23744, 23693, 138724, 23875, 138726,
+    23918, 23915, 23932, 24033, 24034, 14383, 24061, 24104, 24125, 24169, 14434, 139651,
+    14460, 24240, 24243, 24246, 172946, 140081, 33281, 24354, 14535, 144056, 156122, 24418,
+    24427, 14563, 24474, 24525, 24535, 24569, 24705, 14650, 14620, 141012, 24775, 24904,
+    24908, 24954, 25010, 24996, 25007, 25054, 25104, 25115, 25181, 25265, 25300, 25424,
+    142092, 25405, 25340, 25448, 25475, 25572, 142321, 25634, 25541, 25513, 14894, 25705,
+    25726, 25757, 25719, 14956, 25964, 143370, 26083, 26360, 26185, 15129, 15112, 15076,
+    20882, 20885, 26368, 26268, 32941, 17369, 26401, 26462, 26451, 144323, 15177, 26618,
+    26501, 26706, 144493, 26766, 26655, 26900, 26946, 27043, 27114, 27304, 145059, 27355,
+    15384, 27425, 145575, 27476, 15438, 27506, 27551, 27579, 146061, 138507, 146170, 27726,
+    146620, 27839, 27853, 27751, 27926, 27966, 28009, 28024, 28037, 146718, 27956, 28207,
+    28270, 15667, 28359, 147153, 28153, 28526, 147294, 147342, 28614, 28729, 28699, 15766,
+    28746, 28797, 28791, 28845, 132389, 28997, 148067, 29084, 148395, 29224, 29264, 149000,
+    29312, 29333, 149301, 149524, 29562, 29579, 16044, 29605, 16056, 29767, 29788, 29829,
+    29898, 16155, 29988, 150582, 30014, 150674, 139679, 30224, 151457, 151480, 151620, 16380,
+    16392, 151795, 151794, 151833, 151859, 30494, 30495, 30603, 16454, 16534, 152605, 30798,
+    16611, 153126, 153242, 153285, 31211, 16687, 31306, 31311, 153980, 154279, 31470, 16898,
+    154539, 31686, 31689, 16935, 154752, 31954, 17056, 31976, 31971, 32000, 155526, 32099,
+    17153, 32199, 32258, 32325, 17204, 156200, 156231, 17241, 156377, 32634, 156478, 32661,
+    32762, 156890, 156963, 32864, 157096, 32880, 144223, 17365, 32946, 33027, 17419, 33086,
+    23221, 157607, 157621, 144275, 144284, 33284, 36766, 17515, 33425, 33419, 33437, 21171,
+    33457, 33459, 33469, 33510, 158524, 33565, 33635, 33709, 33571, 33725, 33767, 33619,
+    33738, 33740, 33756, 158774, 159083, 158933, 17707, 34033, 34035, 34070, 160714, 34148,
+    159532, 17757, 17761, 159665, 159954, 17771, 34384, 34407, 34409, 34473, 34440, 34574,
+    34530, 34600, 34667, 34694, 17879, 34785, 34817, 17913, 34912, 161383, 35031, 35038,
+    17973, 35066, 13499, 161966, 162150, 18110, 18119, 35488, 162984, 36011, 36033, 36123,
+    36215, 163631, 133124, 36299, 36284, 36336, 133342, 36564, 165330, 165357, 37012, 37105,
+    37137, 165678, 37147, 37432, 37591, 37592, 37500, 37881, 37909, 166906, 38283, 18837,
+    38327, 167287, 18918, 38595, 23986, 38691, 168261, 168474, 19054, 19062, 38880, 168970,
+    19122, 169110, 38953, 169398, 39138, 19251, 39209, 39335, 39362, 39422, 19406, 170800,
+    40000, 40189, 19662, 19693, 40295, 172238, 19704, 172293, 172558, 172689, 19798, 40702,
+    40709, 40719, 40726, 173568,
+};
+
+const CompositionPair kCompositions[941] = {
+    {0x003C, 0x0338, 0x226E},
+    {0x003D, 0x0338, 0x2260},
+    {0x003E, 0x0338, 0x226F},
+    {0x0041, 0x0300, 0x00C0},
+    {0x0041, 0x0301, 0x00C1},
+    {0x0041, 0x0302, 0x00C2},
+    {0x0041, 0x0303, 0x00C3},
+    {0x0041, 0x0304, 0x0100},
+    {0x0041, 0x0306, 0x0102},
+    {0x0041, 0x0307, 0x0226},
+    {0x0041, 0x0308, 0x00C4},
+    {0x0041, 0x0309, 0x1EA2},
+    {0x0041, 0x030A, 0x00C5},
+    {0x0041, 0x030C, 0x01CD},
+    {0x0041, 0x030F, 0x0200},
+    {0x0041, 0x0311, 0x0202},
+    {0x0041, 0x0323, 0x1EA0},
+    {0x0041, 0x0325, 0x1E00},
+    {0x0041, 0x0328, 0x0104},
+    {0x0042, 0x0307, 0x1E02},
+    {0x0042, 0x0323, 0x1E04},
+    {0x0042, 0x0331, 0x1E06},
+    {0x0043, 0x0301, 0x0106},
+    {0x0043, 0x0302, 0x0108},
+    {0x0043, 0x0307, 0x010A},
+    {0x0043, 0x030C, 0x010C},
+    {0x0043, 0x0327, 0x00C7},
+    {0x0044, 0x0307, 0x1E0A},
+    {0x0044, 0x030C, 0x010E},
+    {0x0044, 0x0323, 0x1E0C},
+    {0x0044, 0x0327, 0x1E10},
+    {0x0044, 0x032D, 0x1E12},
+    {0x0044, 0x0331, 0x1E0E},
+    {0x0045, 0x0300, 0x00C8},
+    {0x0045, 0x0301, 0x00C9},
+    {0x0045, 0x0302, 0x00CA},
+    {0x0045, 0x0303, 0x1EBC},
+    {0x0045, 0x0304, 0x0112},
+    {0x0045, 0x0306, 0x0114},
+    {0x0045, 0x0307, 0x0116},
+    {0x0045, 0x0308, 0x00CB},
+    {0x0045, 0x0309, 0x1EBA},
+    {0x0045, 0x030C, 0x011A},
+    {0x0045, 0x030F, 0x0204},
+    {0x0045, 0x0311, 0x0206},
+    {0x0045, 0x0323, 0x1EB8},
+    {0x0045, 0x0327, 0x0228},
+    {0x0045, 0x0328, 0x0118},
+    {0x0045, 0x032D, 0x1E18},
+    {0x0045, 0x0330, 0x1E1A},
+    {0x0046, 0x0307, 0x1E1E},
+    {0x0047, 0x0301, 0x01F4},
+    {0x0047, 0x0302, 0x011C},
+    {0x0047, 0x0304, 0x1E20},
+    {0x0047, 0x0306, 0x011E},
+    {0x0047, 0x0307, 0x0120},
+    {0x0047, 0x030C, 0x01E6},
+    {0x0047, 0x0327, 0x0122},
+    {0x0048, 0x0302, 0x0124},
+    {0x0048, 0x0307, 0x1E22},
+    {0x0048, 0x0308, 0x1E26},
+    {0x0048, 0x030C, 0x021E},
+    {0x0048, 0x0323, 0x1E24},
+    {0x0048, 0x0327, 0x1E28},
+    {0x0048, 0x032E, 0x1E2A},
+    {0x0049, 0x0300, 0x00CC},
+    {0x0049, 0x0301, 0x00CD},
+    {0x0049, 0x0302, 0x00CE},
+    {0x0049, 0x0303, 0x0128},
+    {0x0049, 0x0304, 0x012A},
+    {0x0049, 0x0306, 0x012C},
+    {0x0049, 0x0307, 0x0130},
+    {0x0049, 0x0308, 0x00CF},
+    {0x0049, 0x0309, 0x1EC8},
+    {0x0049, 0x030C, 0x01CF},
+    {0x0049, 0x030F, 0x0208},
+    {0x0049, 0x0311, 0x020A},
+    {0x0049, 0x0323, 0x1ECA},
+    {0x0049, 0x0328, 0x012E},
+    {0x0049, 0x0330, 0x1E2C},
+    {0x004A, 0x0302, 0x0134},
+    {0x004B, 0x0301, 0x1E30},
+    {0x004B, 0x030C, 0x01E8},
+    {0x004B, 0x0323, 0x1E32},
+    {0x004B, 0x0327, 0x0136},
+    {0x004B, 0x0331, 0x1E34},
+    {0x004C, 0x0301, 0x0139},
+    {0x004C, 0x030C, 0x013D},
+    {0x004C, 0x0323, 0x1E36},
+    {0x004C, 0x0327, 0x013B},
+    {0x004C, 0x032D, 0x1E3C},
+    {0x004C, 0x0331, 0x1E3A},
+    {0x004D, 0x0301, 0x1E3E},
+    {0x004D, 0x0307, 0x1E40},
+    {0x004D, 0x0323, 0x1E42},
+    {0x004E, 0x0300, 0x01F8},
+    {0x004E, 0x0301, 0x0143},
+    {0x004E, 0x0303, 0x00D1},
+    {0x004E, 0x0307, 0x1E44},
+    {0x004E, 0x030C, 0x0147},
+    {0x004E, 0x0323, 0x1E46},
+    {0x004E, 0x0327, 0x0145},
+    {0x004E, 0x032D, 0x1E4A},
+    {0x004E, 0x0331, 0x1E48},
+    {0x004F, 0x0300, 0x00D2},
+    {0x004F, 0x0301, 0x00D3},
+    {0x004F, 0x0302, 0x00D4},
+    {0x004F, 0x0303, 0x00D5},
+    {0x004F, 0x0304, 0x014C},
+    {0x004F, 0x0306, 0x014E},
+    {0x004F, 0x0307, 0x022E},
+    {0x004F, 0x0308, 0x00D6},
+    {0x004F, 0x0309, 0x1ECE},
+    {0x004F, 0x030B, 0x0150},
+    {0x004F, 0x030C, 0x01D1},
+    {0x004F, 0x030F, 0x020C},
+    {0x004F, 0x0311, 0x020E},
+    {0x004F, 0x031B, 0x01A0},
+    {0x004F, 0x0323, 0x1ECC},
+    {0x004F, 0x0328, 0x01EA},
+    {0x0050, 0x0301, 0x1E54},
+    {0x0050, 0x0307, 0x1E56},
+    {0x0052, 0x0301, 0x0154},
+    {0x0052, 0x0307, 0x1E58},
+    {0x0052, 0x030C, 0x0158},
+    {0x0052, 0x030F, 0x0210},
+    {0x0052, 0x0311, 0x0212},
+    {0x0052, 0x0323, 0x1E5A},
+    {0x0052, 0x0327, 0x0156},
+    {0x0052, 0x0331, 0x1E5E},
+    {0x0053, 0x0301, 0x015A},
+    {0x0053, 0x0302, 0x015C},
+    {0x0053, 0x0307, 0x1E60},
+    {0x0053, 0x030C, 0x0160},
+    {0x0053, 0x0323, 0x1E62},
+    {0x0053, 0x0326, 0x0218},
+    {0x0053, 0x0327, 0x015E},
+    {0x0054, 0x0307, 0x1E6A},
+    {0x0054, 0x030C, 0x0164},
+    {0x0054, 0x0323, 0x1E6C},
+    {0x0054, 0x0326, 0x021A},
+    {0x0054, 0x0327, 0x0162},
+    {0x0054, 0x032D, 0x1E70},
+    {0x0054, 0x0331, 0x1E6E},
+    {0x0055, 0x0300, 0x00D9},
+    {0x0055, 0x0301, 0x00DA},
+    {0x0055, 0x0302, 0x00DB},
+    {0x0055, 0x0303, 0x0168},
+    {0x0055, 0x0304, 0x016A},
+    {0x0055, 0x0306, 0x016C},
+    {0x0055, 0x0308, 0x00DC},
+    {0x0055, 0x0309, 0x1EE6},
+    {0x0055, 0x030A, 0x016E},
+    {0x0055, 0x030B, 0x0170},
+    {0x0055, 0x030C, 0x01D3},
+    {0x0055, 0x030F, 0x0214},
+    {0x0055, 0x0311, 0x0216},
+    {0x0055, 0x031B, 0x01AF},
+    {0x0055, 0x0323, 0x1EE4},
+    {0x0055, 0x0324, 0x1E72},
+    {0x0055, 0x0328, 0x0172},
+    {0x0055, 0x032D, 0x1E76},
+    {0x0055, 0x0330, 0x1E74},
+    {0x0056, 0x0303, 0x1E7C},
+    {0x0056, 0x0323, 0x1E7E},
+    {0x0057, 0x0300, 0x1E80},
+    {0x0057, 0x0301, 0x1E82},
+    {0x0057, 0x0302, 0x0174},
+    {0x0057, 0x0307, 0x1E86},
+    {0x0057, 0x0308, 0x1E84},
+    {0x0057, 0x0323, 0x1E88},
+    {0x0058, 0x0307, 0x1E8A},
+    {0x0058, 0x0308, 0x1E8C},
+    {0x0059, 0x0300, 0x1EF2},
+    {0x0059, 0x0301, 0x00DD},
+    {0x0059, 0x0302, 0x0176},
+    {0x0059, 0x0303, 0x1EF8},
+    {0x0059, 0x0304, 0x0232},
+    {0x0059, 0x0307, 0x1E8E},
+    {0x0059, 0x0308, 0x0178},
+    {0x0059, 0x0309, 0x1EF6},
+    {0x0059, 0x0323, 0x1EF4},
+    {0x005A, 0x0301, 0x0179},
+    {0x005A, 0x0302, 0x1E90},
+    {0x005A, 0x0307, 0x017B},
+    {0x005A, 0x030C, 0x017D},
+    {0x005A, 0x0323, 0x1E92},
+    {0x005A, 0x0331, 0x1E94},
+    {0x0061, 0x0300, 0x00E0},
+    {0x0061, 0x0301, 0x00E1},
+    {0x0061, 0x0302, 0x00E2},
+    {0x0061, 0x0303, 0x00E3},
+    {0x0061, 0x0304, 0x0101},
+    {0x0061, 0x0306, 0x0103},
+    {0x0061, 0x0307, 0x0227},
+    {0x0061, 0x0308, 0x00E4},
+    {0x0061, 0x0309, 0x1EA3},
+    {0x0061, 0x030A, 0x00E5},
+    {0x0061, 0x030C, 0x01CE},
+    {0x0061, 0x030F, 0x0201},
+    {0x0061, 0x0311, 0x0203},
+    {0x0061, 0x0323, 0x1EA1},
+    {0x0061, 0x0325, 0x1E01},
+    {0x0061, 0x0328, 0x0105},
+    {0x0062, 0x0307, 0x1E03},
+    {0x0062, 0x0323, 0x1E05},
+    {0x0062, 0x0331, 0x1E07},
+    {0x0063, 0x0301, 0x0107},
+    {0x0063, 0x0302, 0x0109},
+    {0x0063, 0x0307, 0x010B},
+    {0x0063, 0x030C, 0x010D},
+    {0x0063, 0x0327, 0x00E7},
+    {0x0064, 0x0307, 0x1E0B},
+    {0x0064, 0x030C, 0x010F},
+    {0x0064, 0x0323, 0x1E0D},
+    {0x0064, 0x0327, 0x1E11},
+    {0x0064, 0x032D, 0x1E13},
+    {0x0064, 0x0331, 0x1E0F},
+    {0x0065, 0x0300, 0x00E8},
+    {0x0065, 0x0301, 0x00E9},
+    {0x0065, 0x0302, 0x00EA},
+    {0x0065, 0x0303, 0x1EBD},
+    {0x0065, 0x0304, 0x0113},
+    {0x0065, 0x0306, 0x0115},
+    {0x0065, 0x0307, 0x0117},
+    {0x0065, 0x0308, 0x00EB},
+    {0x0065, 0x0309, 0x1EBB},
+    {0x0065, 0x030C, 0x011B},
+    {0x0065, 0x030F, 0x0205},
+    {0x0065, 0x0311, 0x0207},
+    {0x0065, 0x0323, 0x1EB9},
+    {0x0065, 0x0327, 0x0229},
+    {0x0065, 0x0328, 0x0119},
+    {0x0065, 0x032D, 0x1E19},
+    {0x0065, 0x0330, 0x1E1B},
+    {0x0066, 0x0307, 0x1E1F},
+    {0x0067, 0x0301, 0x01F5},
+    {0x0067, 0x0302, 0x011D},
+    {0x0067, 0x0304, 0x1E21},
+    {0x0067, 0x0306, 0x011F},
+    {0x0067, 0x0307, 0x0121},
+    {0x0067, 0x030C, 0x01E7},
+    {0x0067, 0x0327, 0x0123},
+    {0x0068, 0x0302, 0x0125},
+    {0x0068, 0x0307, 0x1E23},
+    {0x0068, 0x0308, 0x1E27},
+    {0x0068, 0x030C, 0x021F},
+    {0x0068, 0x0323, 0x1E25},
+    {0x0068, 0x0327, 0x1E29},
+    {0x0068, 0x032E, 0x1E2B},
+    {0x0068, 0x0331, 0x1E96},
+    {0x0069, 0x0300, 0x00EC},
+    {0x0069, 0x0301, 0x00ED},
+    {0x0069, 0x0302, 0x00EE},
+    {0x0069, 0x0303, 0x0129},
+    {0x0069, 0x0304, 0x012B},
+    {0x0069, 0x0306, 0x012D},
+    {0x0069, 0x0308, 0x00EF},
+    {0x0069, 0x0309, 0x1EC9},
+    {0x0069, 0x030C, 0x01D0},
+    {0x0069, 0x030F, 0x0209},
+    {0x0069, 0x0311, 0x020B},
+    {0x0069, 0x0323, 0x1ECB},
+    {0x0069, 0x0328, 0x012F},
+    {0x0069, 0x0330, 0x1E2D},
+    {0x006A, 0x0302, 0x0135},
+    {0x006A, 0x030C, 0x01F0},
+    {0x006B, 0x0301, 0x1E31},
+    {0x006B, 0x030C, 0x01E9},
+    {0x006B, 0x0323, 0x1E33},
+    {0x006B, 0x0327, 0x0137},
+    {0x006B, 0x0331, 0x1E35},
+    {0x006C, 0x0301, 0x013A},
+    {0x006C, 0x030C, 0x013E},
+    {0x006C, 0x0323, 0x1E37},
+    {0x006C, 0x0327, 0x013C},
+    {0x006C, 0x032D, 0x1E3D},
+    {0x006C, 0x0331, 0x1E3B},
+    {0x006D, 0x0301, 0x1E3F},
+    {0x006D, 0x0307, 0x1E41},
+    {0x006D, 0x0323, 0x1E43},
+    {0x006E, 0x0300, 0x01F9},
+    {0x006E, 0x0301, 0x0144},
+    {0x006E, 0x0303, 0x00F1},
+    {0x006E, 0x0307, 0x1E45},
+    {0x006E, 0x030C, 0x0148},
+    {0x006E, 0x0323, 0x1E47},
+    {0x006E, 0x0327, 0x0146},
+    {0x006E, 0x032D, 0x1E4B},
+    {0x006E, 0x0331, 0x1E49},
+    {0x006F, 0x0300, 0x00F2},
+    {0x006F, 0x0301, 0x00F3},
+    {0x006F, 0x0302, 0x00F4},
+    {0x006F, 0x0303, 0x00F5},
+    {0x006F, 0x0304, 0x014D},
+    {0x006F, 0x0306, 0x014F},
+    {0x006F, 0x0307, 0x022F},
+    {0x006F, 0x0308, 0x00F6},
+    {0x006F, 0x0309, 0x1ECF},
+    {0x006F, 0x030B, 0x0151},
+    {0x006F, 0x030C, 0x01D2},
+    {0x006F, 0x030F, 0x020D},
+    {0x006F, 0x0311, 0x020F},
+    {0x006F, 0x031B, 0x01A1},
+    {0x006F, 0x0323, 0x1ECD},
+    {0x006F, 0x0328, 0x01EB},
+    {0x0070, 0x0301, 0x1E55},
+    {0x0070, 0x0307, 0x1E57},
+    {0x0072, 0x0301, 0x0155},
+    {0x0072, 0x0307, 0x1E59},
+    {0x0072, 0x030C, 0x0159},
+    {0x0072, 0x030F, 0x0211},
+    {0x0072, 0x0311, 0x0213},
+    {0x0072, 0x0323, 0x1E5B},
+    {0x0072, 0x0327, 0x0157},
+    {0x0072, 0x0331, 0x1E5F},
+    {0x0073, 0x0301, 0x015B},
+    {0x0073, 0x0302, 0x015D},
+    {0x0073, 0x0307, 0x1E61},
+    {0x0073, 0x030C, 0x0161},
+    {0x0073, 0x0323, 0x1E63},
+    {0x0073, 0x0326, 0x0219},
+    {0x0073, 0x0327, 0x015F},
+    {0x0074, 0x0307, 0x1E6B},
+    {0x0074, 0x0308, 0x1E97},
+    {0x0074, 0x030C, 0x0165},
+    {0x0074, 0x0323, 0x1E6D},
+    {0x0074, 0x0326, 0x021B},
+    {0x0074, 0x0327, 0x0163},
+    {0x0074, 0x032D, 0x1E71},
+    {0x0074, 0x0331, 0x1E6F},
+    {0x0075, 0x0300, 0x00F9},
+    {0x0075, 0x0301, 0x00FA},
+    {0x0075, 0x0302, 0x00FB},
+    {0x0075, 0x0303, 0x0169},
+    {0x0075, 0x0304, 0x016B},
+    {0x0075, 0x0306, 0x016D},
+    {0x0075, 0x0308, 0x00FC},
+    {0x0075, 0x0309, 0x1EE7},
+    {0x0075, 0x030A, 0x016F},
+    {0x0075, 0x030B, 0x0171},
+    {0x0075, 0x030C, 0x01D4},
+    {0x0075, 0x030F, 0x0215},
+    {0x0075, 0x0311, 0x0217},
+    {0x0075, 0x031B, 0x01B0},
+    {0x0075, 0x0323, 0x1EE5},
+    {0x0075, 0x0324, 0x1E73},
+    {0x0075, 0x0328, 0x0173},
+    {0x0075, 0x032D, 0x1E77},
+    {0x0075, 0x0330, 0x1E75},
+    {0x0076, 0x0303, 0x1E7D},
+    {0x0076, 0x0323, 0x1E7F},
+    {0x0077, 0x0300, 0x1E81},
+    {0x0077, 0x0301, 0x1E83},
+    {0x0077, 0x0302, 0x0175},
+    {0x0077, 0x0307, 0x1E87},
+    {0x0077, 0x0308, 0x1E85},
+    {0x0077, 0x030A, 0x1E98},
+    {0x0077, 0x0323, 0x1E89},
+    {0x0078, 0x0307, 0x1E8B},
+    {0x0078, 0x0308, 0x1E8D},
+    {0x0079, 0x0300, 0x1EF3},
+    {0x0079, 0x0301, 0x00FD},
+    {0x0079, 0x0302, 0x0177},
+    {0x0079, 0x0303, 0x1EF9},
+    {0x0079, 0x0304, 0x0233},
+    {0x0079, 0x0307, 0x1E8F},
+    {0x0079, 0x0308, 0x00FF},
+    {0x0079, 0x0309, 0x1EF7},
+    {0x0079, 0x030A, 0x1E99},
+    {0x0079, 0x0323, 0x1EF5},
+    {0x007A, 0x0301, 0x017A},
+    {0x007A, 0x0302, 0x1E91},
+    {0x007A, 0x0307, 0x017C},
+    {0x007A, 0x030C, 0x017E},
+    {0x007A, 0x0323, 0x1E93},
+    {0x007A, 0x0331, 0x1E95},
+    {0x00A8, 0x0300, 0x1FED},
+    {0x00A8, 0x0301, 0x0385},
+    {0x00A8, 0x0342, 0x1FC1},
+    {0x00C2, 0x0300, 0x1EA6},
+    {0x00C2, 0x0301, 0x1EA4},
+    {0x00C2, 0x0303, 0x1EAA},
+    {0x00C2, 0x0309, 0x1EA8},
+    {0x00C4, 0x0304, 0x01DE},
+    {0x00C5, 0x0301, 0x01FA},
+    {0x00C6, 0x0301, 0x01FC},
+    {0x00C6, 0x0304, 0x01E2},
+    {0x00C7, 0x0301, 0x1E08},
+    {0x00CA, 0x0300, 0x1EC0},
+    {0x00CA, 0x0301, 0x1EBE},
+    {0x00CA, 0x0303, 0x1EC4},
+    {0x00CA, 0x0309, 0x1EC2},
+    {0x00CF, 0x0301, 0x1E2E},
+    {0x00D4, 0x0300, 0x1ED2},
+    {0x00D4, 0x0301, 0x1ED0},
+    {0x00D4, 0x0303, 0x1ED6},
+    {0x00D4, 0x0309, 0x1ED4},
+    {0x00D5, 0x0301, 0x1E4C},
+    {0x00D5, 0x0304, 0x022C},
+    {0x00D5, 0x0308, 0x1E4E},
+    {0x00D6, 0x0304, 0x022A},
+    {0x00D8, 0x0301, 0x01FE},
+    {0x00DC, 0x0300, 0x01DB},
+    {0x00DC, 0x0301, 0x01D7},
+    {0x00DC, 0x0304, 0x01D5},
+    {0x00DC, 0x030C, 0x01D9},
+    {0x00E2, 0x0300, 0x1EA7},
+    {0x00E2, 0x0301, 0x1EA5},
+    {0x00E2, 0x0303, 0x1EAB},
+    {0x00E2, 0x0309, 0x1EA9},
+    {0x00E4, 0x0304, 0x01DF},
+    {0x00E5, 0x0301, 0x01FB},
+    {0x00E6, 0x0301, 0x01FD},
+    {0x00E6, 0x0304, 0x01E3},
+    {0x00E7, 0x0301, 0x1E09},
+    {0x00EA, 0x0300, 0x1EC1},
+    {0x00EA, 0x0301, 0x1EBF},
+    {0x00EA, 0x0303, 0x1EC5},
+    {0x00EA, 0x0309, 0x1EC3},
+    {0x00EF, 0x0301, 0x1E2F},
+    {0x00F4, 0x0300, 0x1ED3},
+    {0x00F4, 0x0301, 0x1ED1},
+    {0x00F4, 0x0303, 0x1ED7},
+    {0x00F4, 0x0309, 0x1ED5},
+    {0x00F5, 0x0301, 0x1E4D},
+    {0x00F5, 0x0304, 0x022D},
+    {0x00F5, 0x0308, 0x1E4F},
+    {0x00F6, 0x0304, 0x022B},
+    {0x00F8, 0x0301, 0x01FF},
+    {0x00FC, 0x0300, 0x01DC},
+    {0x00FC, 0x0301, 0x01D8},
+    {0x00FC, 0x0304, 0x01D6},
+    {0x00FC, 0x030C, 0x01DA},
+    {0x0102, 0x0300, 0x1EB0},
+    {0x0102, 0x0301, 0x1EAE},
+    {0x0102, 0x0303, 0x1EB4},
+    {0x0102, 0x0309, 0x1EB2},
+    {0x0103, 0x0300, 0x1EB1},
+    {0x0103, 0x0301, 0x1EAF},
+    {0x0103, 0x0303, 0x1EB5},
+    {0x0103, 0x0309, 0x1EB3},
+    {0x0112, 0x0300, 0x1E14},
+    {0x0112, 0x0301, 0x1E16},
+    {0x0113, 0x0300, 0x1E15},
+    {0x0113, 0x0301, 0x1E17},
+    {0x014C, 0x0300, 0x1E50},
+    {0x014C, 0x0301, 0x1E52},
+    {0x014D, 0x0300, 0x1E51},
+    {0x014D, 0x0301, 0x1E53},
+    {0x015A, 0x0307, 0x1E64},
+    {0x015B, 0x0307, 0x1E65},
+    {0x0160, 0x0307, 0x1E66},
+    {0x0161, 0x0307, 0x1E67},
+    {0x0168, 0x0301, 0x1E78},
+    {0x0169, 0x0301, 0x1E79},
+    {0x016A, 0x0308, 0x1E7A},
+    {0x016B, 0x0308, 0x1E7B},
+    {0x017F, 0x0307, 0x1E9B},
+    {0x01A0, 0x0300, 0x1EDC},
+    {0x01A0, 0x0301, 0x1EDA},
+    {0x01A0, 0x0303, 0x1EE0},
+    {0x01A0, 0x0309, 0x1EDE},
+    {0x01A0, 0x0323, 0x1EE2},
+    {0x01A1, 0x0300, 0x1EDD},
+    {0x01A1, 0x0301, 0x1EDB},
+    {0x01A1, 0x0303, 0x1EE1},
+    {0x01A1, 0x0309, 0x1EDF},
+    {0x01A1, 0x0323, 0x1EE3},
+    {0x01AF, 0x0300, 0x1EEA},
+    {0x01AF, 0x0301, 0x1EE8},
+    {0x01AF, 0x0303, 0x1EEE},
+    {0x01AF, 0x0309, 0x1EEC},
+    {0x01AF, 0x0323, 0x1EF0},
+    {0x01B0, 0x0300, 0x1EEB},
+    {0x01B0, 0x0301, 0x1EE9},
+    {0x01B0, 0x0303, 0x1EEF},
+    {0x01B0, 0x0309, 0x1EED},
+    {0x01B0, 0x0323, 0x1EF1},
+    {0x01B7, 0x030C, 0x01EE},
+    {0x01EA, 0x0304, 0x01EC},
+    {0x01EB, 0x0304, 0x01ED},
+    {0x0226, 0x0304, 0x01E0},
+    {0x0227, 0x0304, 0x01E1},
+    {0x0228, 0x0306, 0x1E1C},
+    {0x0229, 0x0306, 0x1E1D},
+    {0x022E, 0x0304, 0x0230},
+    {0x022F, 0x0304, 0x0231},
+    {0x0292, 0x030C, 0x01EF},
+    {0x0391, 0x0300, 0x1FBA},
+    {0x0391, 0x0301, 0x0386},
+    {0x0391, 0x0304, 0x1FB9},
+    {0x0391, 0x0306, 0x1FB8},
+    {0x0391, 0x0313, 0x1F08},
+    {0x0391, 0x0314, 0x1F09},
+    {0x0391, 0x0345, 0x1FBC},
+    {0x0395, 0x0300, 0x1FC8},
+    {0x0395, 0x0301, 0x0388},
+    {0x0395, 0x0313, 0x1F18},
+    {0x0395, 0x0314, 0x1F19},
+    {0x0397, 0x0300, 0x1FCA},
+    {0x0397, 0x0301, 0x0389},
+    {0x0397, 0x0313, 0x1F28},
+    {0x0397, 0x0314, 0x1F29},
+    {0x0397, 0x0345, 0x1FCC},
+    {0x0399, 0x0300, 0x1FDA},
+    {0x0399, 0x0301, 0x038A},
+    {0x0399, 0x0304, 0x1FD9},
+    {0x0399, 0x0306, 0x1FD8},
+    {0x0399, 0x0308, 0x03AA},
+    {0x0399, 0x0313, 0x1F38},
+    {0x0399, 0x0314, 0x1F39},
+    {0x039F, 0x0300, 0x1FF8},
+    {0x039F, 0x0301, 0x038C},
+    {0x039F, 0x0313, 0x1F48},
+    {0x039F, 0x0314, 0x1F49},
+    {0x03A1, 0x0314, 0x1FEC},
+    {0x03A5, 0x0300, 0x1FEA},
+    {0x03A5, 0x0301, 0x038E},
+    {0x03A5, 0x0304, 0x1FE9},
+    {0x03A5, 0x0306, 0x1FE8},
+    {0x03A5, 0x0308, 0x03AB},
+    {0x03A5, 0x0314, 0x1F59},
+    {0x03A9, 0x0300, 0x1FFA},
+    {0x03A9, 0x0301, 0x038F},
+    {0x03A9, 0x0313, 0x1F68},
+    {0x03A9, 0x0314, 0x1F69},
+    {0x03A9, 0x0345, 0x1FFC},
+    {0x03AC, 0x0345, 0x1FB4},
+    {0x03AE, 0x0345, 0x1FC4},
+    {0x03B1, 0x0300, 0x1F70},
+    {0x03B1, 0x0301, 0x03AC},
+    {0x03B1, 0x0304, 0x1FB1},
+    {0x03B1, 0x0306, 0x1FB0},
+    {0x03B1, 0x0313, 0x1F00},
+    {0x03B1, 0x0314, 0x1F01},
+    {0x03B1, 0x0342, 0x1FB6},
+    {0x03B1, 0x0345, 0x1FB3},
+    {0x03B5, 0x0300, 0x1F72},
+    {0x03B5, 0x0301, 0x03AD},
+    {0x03B5, 0x0313, 0x1F10},
+    {0x03B5, 0x0314, 0x1F11},
+    {0x03B7, 0x0300, 0x1F74},
+    {0x03B7, 0x0301, 0x03AE},
+    {0x03B7, 0x0313, 0x1F20},
+    {0x03B7, 0x0314, 0x1F21},
+    {0x03B7, 0x0342, 0x1FC6},
+    {0x03B7, 0x0345, 0x1FC3},
+    {0x03B9, 0x0300, 0x1F76},
+    {0x03B9, 0x0301, 0x03AF},
+    {0x03B9, 0x0304, 0x1FD1},
+    {0x03B9, 0x0306, 0x1FD0},
+    {0x03B9, 0x0308, 0x03CA},
+    {0x03B9, 0x0313, 0x1F30},
+    {0x03B9, 0x0314, 0x1F31},
+    {0x03B9, 0x0342, 0x1FD6},
+    {0x03BF, 0x0300, 0x1F78},
+    {0x03BF, 0x0301, 0x03CC},
+    {0x03BF, 0x0313, 0x1F40},
+    {0x03BF, 0x0314, 0x1F41},
+    {0x03C1, 0x0313, 0x1FE4},
+    {0x03C1, 0x0314, 0x1FE5},
+    {0x03C5, 0x0300, 0x1F7A},
+    {0x03C5, 0x0301, 0x03CD},
+    {0x03C5, 0x0304, 0x1FE1},
+    {0x03C5, 0x0306, 0x1FE0},
+    {0x03C5, 0x0308, 0x03CB},
+    {0x03C5, 0x0313, 0x1F50},
+    {0x03C5, 0x0314, 0x1F51},
+    {0x03C5, 0x0342, 0x1FE6},
+    {0x03C9, 0x0300, 0x1F7C},
+    {0x03C9, 0x0301, 0x03CE},
+    {0x03C9, 0x0313, 0x1F60},
+    {0x03C9, 0x0314, 0x1F61},
+    {0x03C9, 0x0342, 0x1FF6},
+    {0x03C9, 0x0345, 0x1FF3},
+    {0x03CA, 0x0300, 0x1FD2},
+    {0x03CA, 0x0301, 0x0390},
+    {0x03CA, 0x0342, 0x1FD7},
+    {0x03CB, 0x0300, 0x1FE2},
+    {0x03CB, 0x0301, 0x03B0},
+    {0x03CB, 0x0342, 0x1FE7},
+    {0x03CE, 0x0345, 0x1FF4},
+    {0x03D2, 0x0301, 0x03D3},
+    {0x03D2, 0x0308, 0x03D4},
+    {0x0406, 0x0308, 0x0407},
+    {0x0410, 0x0306, 0x04D0},
+    {0x0410, 0x0308, 0x04D2},
+    {0x0413, 0x0301, 0x0403},
+    {0x0415, 0x0300, 0x0400},
+    {0x0415, 0x0306, 0x04D6},
+    {0x0415, 0x0308, 0x0401},
+    {0x0416, 0x0306, 0x04C1},
+    {0x0416, 0x0308, 0x04DC},
+    {0x0417, 0x0308, 0x04DE},
+    {0x0418, 0x0300, 0x040D},
+    {0x0418, 0x0304, 0x04E2},
+    {0x0418, 0x0306, 0x0419},
+    {0x0418, 0x0308, 0x04E4},
+    {0x041A, 0x0301, 0x040C},
+    {0x041E, 0x0308, 0x04E6},
+    {0x0423, 0x0304, 0x04EE},
+    {0x0423, 0x0306, 0x040E},
+    {0x0423, 0x0308, 0x04F0},
+    {0x0423, 0x030B, 0x04F2},
+    {0x0427, 0x0308, 0x04F4},
+    {0x042B, 0x0308, 0x04F8},
+    {0x042D, 0x0308, 0x04EC},
+    {0x0430, 0x0306, 0x04D1},
+    {0x0430, 0x0308, 0x04D3},
+    {0x0433, 0x0301, 0x0453},
+    {0x0435, 0x0300, 0x0450},
+    {0x0435, 0x0306, 0x04D7},
+    {0x0435, 0x0308, 0x0451},
+    {0x0436, 0x0306, 0x04C2},
+    {0x0436, 0x0308, 0x04DD},
+    {0x0437, 0x0308, 0x04DF},
+    {0x0438, 0x0300, 0x045D},
+    {0x0438, 0x0304, 0x04E3},
+    {0x0438, 0x0306, 0x0439},
+    {0x0438, 0x0308, 0x04E5},
+    {0x043A, 0x0301, 0x045C},
+    {0x043E, 0x0308, 0x04E7},
+    {0x0443, 0x0304, 0x04EF},
+    {0x0443, 0x0306, 0x045E},
+    {0x0443, 0x0308, 0x04F1},
+    {0x0443, 0x030B, 0x04F3},
+    {0x0447, 0x0308, 0x04F5},
+    {0x044B, 0x0308, 0x04F9},
+    {0x044D, 0x0308, 0x04ED},
+    {0x0456, 0x0308, 0x0457},
+    {0x0474, 0x030F, 0x0476},
+    {0x0475, 0x030F, 0x0477},
+    {0x04D8, 0x0308, 0x04DA},
+    {0x04D9, 0x0308, 0x04DB},
+    {0x04E8, 0x0308, 0x04EA},
+    {0x04E9, 0x0308, 0x04EB},
+    {0x0627, 0x0653, 0x0622},
+    {0x0627, 0x0654, 0x0623},
+    {0x0627, 0x0655, 0x0625},
+    {0x0648, 0x0654, 0x0624},
+    {0x064A, 0x0654, 0x0626},
+    {0x06C1, 0x0654, 0x06C2},
+    {0x06D2, 0x0654, 0x06D3},
+    {0x06D5, 0x0654, 0x06C0},
+    {0x0928, 0x093C, 0x0929},
+    {0x0930, 0x093C, 0x0931},
+    {0x0933, 0x093C, 0x0934},
+    {0x09C7, 0x09BE, 0x09CB},
+    {0x09C7, 0x09D7, 0x09CC},
+    {0x0B47, 0x0B3E, 0x0B4B},
+    {0x0B47, 0x0B56, 0x0B48},
+    {0x0B47, 0x0B57, 0x0B4C},
+    {0x0B92, 0x0BD7, 0x0B94},
+    {0x0BC6, 0x0BBE, 0x0BCA},
+    {0x0BC6, 0x0BD7, 0x0BCC},
+    {0x0BC7, 0x0BBE, 0x0BCB},
+    {0x0C46, 0x0C56, 0x0C48},
+    {0x0CBF, 0x0CD5, 0x0CC0},
+    {0x0CC6, 0x0CC2, 0x0CCA},
+    {0x0CC6, 0x0CD5, 0x0CC7},
+    {0x0CC6, 0x0CD6, 0x0CC8},
+    {0x0CCA, 0x0CD5, 0x0CCB},
+    {0x0D46, 0x0D3E, 0x0D4A},
+    {0x0D46, 0x0D57, 0x0D4C},
+    {0x0D47, 0x0D3E, 0x0D4B},
+    {0x0DD9, 0x0DCA, 0x0DDA},
+    {0x0DD9, 0x0DCF, 0x0DDC},
+    {0x0DD9, 0x0DDF, 0x0DDE},
+    {0x0DDC, 0x0DCA, 0x0DDD},
+    {0x1025, 0x102E, 0x1026},
+    {0x1B05, 0x1B35, 0x1B06},
+    {0x1B07, 0x1B35, 0x1B08},
+    {0x1B09, 0x1B35, 0x1B0A},
+    {0x1B0B, 0x1B35, 0x1B0C},
+    {0x1B0D, 0x1B35, 0x1B0E},
+    {0x1B11, 0x1B35, 0x1B12},
+    {0x1B3A, 0x1B35, 0x1B3B},
+    {0x1B3C, 0x1B35, 0x1B3D},
+    {0x1B3E, 0x1B35, 0x1B40},
+    {0x1B3F, 0x1B35, 0x1B41},
+    {0x1B42, 0x1B35, 0x1B43},
+    {0x1E36, 0x0304, 0x1E38},
+    {0x1E37, 0x0304, 0x1E39},
+    {0x1E5A, 0x0304, 0x1E5C},
+    {0x1E5B, 0x0304, 0x1E5D},
+    {0x1E62, 0x0307, 0x1E68},
+    {0x1E63, 0x0307, 0x1E69},
+    {0x1EA0, 0x0302, 0x1EAC},
+    {0x1EA0, 0x0306, 0x1EB6},
+    {0x1EA1, 0x0302, 0x1EAD},
+    {0x1EA1, 0x0306, 0x1EB7},
+    {0x1EB8, 0x0302, 0x1EC6},
+    {0x1EB9, 0x0302, 0x1EC7},
+    {0x1ECC, 0x0302, 0x1ED8},
+    {0x1ECD, 0x0302, 0x1ED9},
+    {0x1F00, 0x0300, 0x1F02},
+    {0x1F00, 0x0301, 0x1F04},
+    {0x1F00, 0x0342, 0x1F06},
+    {0x1F00, 0x0345, 0x1F80},
+    {0x1F01, 0x0300, 0x1F03},
+    {0x1F01, 0x0301, 0x1F05},
+    {0x1F01, 0x0342, 0x1F07},
+    {0x1F01, 0x0345, 0x1F81},
+    {0x1F02, 0x0345, 0x1F82},
+    {0x1F03, 0x0345, 0x1F83},
+    {0x1F04, 0x0345, 0x1F84},
+    {0x1F05, 0x0345, 0x1F85},
+    {0x1F06, 0x0345, 0x1F86},
+    {0x1F07, 0x0345, 0x1F87},
+    {0x1F08, 0x0300, 0x1F0A},
+    {0x1F08, 0x0301, 0x1F0C},
+    {0x1F08, 0x0342, 0x1F0E},
+    {0x1F08, 0x0345, 0x1F88},
+    {0x1F09, 0x0300, 0x1F0B},
+    {0x1F09, 0x0301, 0x1F0D},
+    {0x1F09, 0x0342, 0x1F0F},
+    {0x1F09, 0x0345, 0x1F89},
+    {0x1F0A, 0x0345, 0x1F8A},
+    {0x1F0B, 0x0345, 0x1F8B},
+    {0x1F0C, 0x0345, 0x1F8C},
+    {0x1F0D, 0x0345, 0x1F8D},
+    {0x1F0E, 0x0345, 0x1F8E},
+    {0x1F0F, 0x0345, 0x1F8F},
+    {0x1F10, 0x0300, 0x1F12},
+    {0x1F10, 0x0301, 0x1F14},
+    {0x1F11, 0x0300, 0x1F13},
+    {0x1F11, 0x0301, 0x1F15},
+    {0x1F18, 0x0300, 0x1F1A},
+    {0x1F18, 0x0301, 0x1F1C},
+    {0x1F19, 0x0300, 0x1F1B},
+    {0x1F19, 0x0301, 0x1F1D},
+    {0x1F20, 0x0300, 0x1F22},
+    {0x1F20, 0x0301, 0x1F24},
+    {0x1F20, 0x0342, 0x1F26},
+    {0x1F20, 0x0345, 0x1F90},
+    {0x1F21, 0x0300, 0x1F23},
+    {0x1F21, 0x0301, 0x1F25},
+    {0x1F21, 0x0342, 0x1F27},
+    {0x1F21, 0x0345, 0x1F91},
+    {0x1F22, 0x0345, 0x1F92},
+    {0x1F23, 0x0345, 0x1F93},
+    {0x1F24, 0x0345, 0x1F94},
+    {0x1F25, 0x0345, 0x1F95},
+    {0x1F26, 0x0345, 0x1F96},
+    {0x1F27, 0x0345, 0x1F97},
+    {0x1F28, 0x0300, 0x1F2A},
+    {0x1F28, 0x0301, 0x1F2C},
+    {0x1F28, 0x0342, 0x1F2E},
+    {0x1F28, 0x0345, 0x1F98},
+    {0x1F29, 0x0300, 0x1F2B},
+    {0x1F29, 0x0301, 0x1F2D},
+    {0x1F29, 0x0342, 0x1F2F},
+    {0x1F29, 0x0345, 0x1F99},
+    {0x1F2A, 0x0345, 0x1F9A},
+    {0x1F2B, 0x0345, 0x1F9B},
+    {0x1F2C, 0x0345, 0x1F9C},
+    {0x1F2D, 0x0345, 0x1F9D},
+    {0x1F2E, 0x0345, 0x1F9E},
+    {0x1F2F, 0x0345, 0x1F9F},
+    {0x1F30, 0x0300, 0x1F32},
+    {0x1F30, 0x0301, 0x1F34},
+    {0x1F30, 0x0342, 0x1F36},
+    {0x1F31, 0x0300, 0x1F33},
+    {0x1F31, 0x0301, 0x1F35},
+    {0x1F31, 0x0342, 0x1F37},
+    {0x1F38, 0x0300, 0x1F3A},
+    {0x1F38, 0x0301, 0x1F3C},
+    {0x1F38, 0x0342, 0x1F3E},
+    {0x1F39, 0x0300, 0x1F3B},
+    {0x1F39, 0x0301, 0x1F3D},
+    {0x1F39, 0x0342, 0x1F3F},
+    {0x1F40, 0x0300, 0x1F42},
+    {0x1F40, 0x0301, 0x1F44},
+    {0x1F41, 0x0300, 0x1F43},
+    {0x1F41, 0x0301, 0x1F45},
+    {0x1F48, 0x0300, 0x1F4A},
+    {0x1F48, 0x0301, 0x1F4C},
+    {0x1F49, 0x0300, 0x1F4B},
+    {0x1F49, 0x0301, 0x1F4D},
+    {0x1F50, 0x0300, 0x1F52},
+    {0x1F50, 0x0301, 0x1F54},
+    {0x1F50, 0x0342, 0x1F56},
+    {0x1F51, 0x0300, 0x1F53},
+    {0x1F51, 0x0301, 0x1F55},
+    {0x1F51, 0x0342, 0x1F57},
+    {0x1F59, 0x0300, 0x1F5B},
+    {0x1F59, 0x0301, 0x1F5D},
+    {0x1F59, 0x0342, 0x1F5F},
+    {0x1F60, 0x0300, 0x1F62},
+    {0x1F60, 0x0301, 0x1F64},
+    {0x1F60, 0x0342, 0x1F66},
+    {0x1F60, 0x0345, 0x1FA0},
+    {0x1F61, 0x0300, 0x1F63},
+    {0x1F61, 0x0301, 0x1F65},
+    {0x1F61, 0x0342, 0x1F67},
+    {0x1F61, 0x0345, 0x1FA1},
+    {0x1F62, 0x0345, 0x1FA2},
+    {0x1F63, 0x0345, 0x1FA3},
+    {0x1F64, 0x0345, 0x1FA4},
+    {0x1F65, 0x0345, 0x1FA5},
+    {0x1F66, 0x0345, 0x1FA6},
+    {0x1F67, 0x0345, 0x1FA7},
+    {0x1F68, 0x0300, 0x1F6A},
+    {0x1F68, 0x0301, 0x1F6C},
+    {0x1F68, 0x0342, 0x1F6E},
+    {0x1F68, 0x0345, 0x1FA8},
+    {0x1F69, 0x0300, 0x1F6B},
+    {0x1F69, 0x0301, 0x1F6D},
+    {0x1F69, 0x0342, 0x1F6F},
+    {0x1F69, 0x0345, 0x1FA9},
+    {0x1F6A, 0x0345, 0x1FAA},
+    {0x1F6B, 0x0345, 0x1FAB},
+    {0x1F6C, 0x0345, 0x1FAC},
+    {0x1F6D, 0x0345, 0x1FAD},
+    {0x1F6E, 0x0345, 0x1FAE},
+    {0x1F6F, 0x0345, 0x1FAF},
+    {0x1F70, 0x0345, 0x1FB2},
+    {0x1F74, 0x0345, 0x1FC2},
+    {0x1F7C, 0x0345, 0x1FF2},
+    {0x1FB6, 0x0345, 0x1FB7},
+    {0x1FBF, 0x0300, 0x1FCD},
+    {0x1FBF, 0x0301, 0x1FCE},
+    {0x1FBF, 0x0342, 0x1FCF},
+    {0x1FC6, 0x0345, 0x1FC7},
+    {0x1FF6, 0x0345, 0x1FF7},
+    {0x1FFE, 0x0300, 0x1FDD},
+    {0x1FFE, 0x0301, 0x1FDE},
+    {0x1FFE, 0x0342, 0x1FDF},
+    {0x2190, 0x0338, 0x219A},
+    {0x2192, 0x0338, 0x219B},
+    {0x2194, 0x0338, 0x21AE},
+    {0x21D0, 0x0338, 0x21CD},
+    {0x21D2, 0x0338, 0x21CF},
+    {0x21D4, 0x0338, 0x21CE},
+    {0x2203, 0x0338, 0x2204},
+    {0x2208, 0x0338, 0x2209},
+    {0x220B, 0x0338, 0x220C},
+    {0x2223, 0x0338, 0x2224},
+    {0x2225, 0x0338, 0x2226},
+    {0x223C, 0x0338, 0x2241},
+    {0x2243, 0x0338, 0x2244},
+    {0x2245, 0x0338, 0x2247},
+    {0x2248, 0x0338, 0x2249},
+    {0x224D, 0x0338, 0x226D},
+    {0x2261, 0x0338, 0x2262},
+    {0x2264, 0x0338, 0x2270},
+    {0x2265, 0x0338, 0x2271},
+    {0x2272, 0x0338, 0x2274},
+    {0x2273, 0x0338, 0x2275},
+    {0x2276, 0x0338, 0x2278},
+    {0x2277, 0x0338, 0x2279},
+    {0x227A, 0x0338, 0x2280},
+    {0x227B, 0x0338, 0x2281},
+    {0x227C, 0x0338, 0x22E0},
+    {0x227D, 0x0338, 0x22E1},
+    {0x2282, 0x0338, 0x2284},
+    {0x2283, 0x0338, 0x2285},
+    {0x2286, 0x0338, 0x2288},
+    {0x2287, 0x0338, 0x2289},
+    {0x2291, 0x0338, 0x22E2},
+    {0x2292, 0x0338, 0x22E3},
+    {0x22A2, 0x0338, 0x22AC},
+    {0x22A8, 0x0338, 0x22AD},
+    {0x22A9, 0x0338, 0x22AE},
+    {0x22AB, 0x0338, 0x22AF},
+    {0x22B2, 0x0338, 0x22EA},
+    {0x22B3, 0x0338, 0x22EB},
+    {0x22B4, 0x0338, 0x22EC},
+    {0x22B5, 0x0338, 0x22ED},
+    {0x3046, 0x3099, 0x3094},
+    {0x304B, 0x3099, 0x304C},
+    {0x304D, 0x3099, 0x304E},
+    {0x304F, 0x3099, 0x3050},
+    {0x3051, 0x3099, 0x3052},
+    {0x3053, 0x3099, 0x3054},
+    {0x3055, 0x3099, 0x3056},
+    {0x3057, 0x3099, 0x3058},
+    {0x3059, 0x3099, 0x305A},
+    {0x305B, 0x3099, 0x305C},
+    {0x305D, 0x3099, 0x305E},
+    {0x305F, 0x3099, 0x3060},
+    {0x3061, 0x3099, 0x3062},
+    {0x3064, 0x3099, 0x3065},
+    {0x3066, 0x3099, 0x3067},
+    {0x3068, 0x3099, 0x3069},
+    {0x306F, 0x3099, 0x3070},
+    {0x306F, 0x309A, 0x3071},
+    {0x3072, 0x3099, 0x3073},
+    {0x3072, 0x309A, 0x3074},
+    {0x3075, 0x3099, 0x3076},
+    {0x3075, 0x309A, 0x3077},
+    {0x3078, 0x3099, 0x3079},
+    {0x3078, 0x309A, 0x307A},
+    {0x307B, 0x3099, 0x307C},
+    {0x307B, 0x309A, 0x307D},
+    {0x309D, 0x3099, 0x309E},
+    {0x30A6, 0x3099, 0x30F4},
+    {0x30AB, 0x3099, 0x30AC},
+    {0x30AD, 0x3099, 0x30AE},
+    {0x30AF, 0x3099, 0x30B0},
+    {0x30B1, 0x3099, 0x30B2},
+    {0x30B3, 0x3099, 0x30B4},
+    {0x30B5, 0x3099, 0x30B6},
+    {0x30B7, 0x3099, 0x30B8},
+    {0x30B9, 0x3099, 0x30BA},
+    {0x30BB, 0x3099, 0x30BC},
+    {0x30BD, 0x3099, 0x30BE},
+    {0x30BF, 0x3099, 0x30C0},
+    {0x30C1, 0x3099, 0x30C2},
+    {0x30C4, 0x3099, 0x30C5},
+    {0x30C6, 0x3099, 0x30C7},
+    {0x30C8, 0x3099, 0x30C9},
+    {0x30CF, 0x3099, 0x30D0},
+    {0x30CF, 0x309A, 0x30D1},
+    {0x30D2, 0x3099, 0x30D3},
+    {0x30D2, 0x309A, 0x30D4},
+    {0x30D5, 0x3099, 0x30D6},
+    {0x30D5, 0x309A, 0x30D7},
+    {0x30D8, 0x3099, 0x30D9},
+    {0x30D8, 0x309A, 0x30DA},
+    {0x30DB, 0x3099, 0x30DC},
+    {0x30DB, 0x309A, 0x30DD},
+    {0x30EF, 0x3099, 0x30F7},
+    {0x30F0, 0x3099, 0x30F8},
+    {0x30F1, 0x3099, 0x30F9},
+    {0x30F2, 0x3099, 0x30FA},
+    {0x30FD, 0x3099, 0x30FE},
+    {0x11099, 0x110BA, 0x1109A},
+    {0x1109B, 0x110BA, 0x1109C},
+    {0x110A5, 0x110BA, 0x110AB},
+    {0x11131, 0x11127, 0x1112E},
+    {0x11132, 0x11127, 0x1112F},
+    {0x11347, 0x1133E, 0x1134B},
+    {0x11347, 0x11357, 0x1134C},
+    {0x114B9, 0x114B0, 0x114BC},
+    {0x114B9, 0x114BA, 0x114BB},
+    {0x114B9, 0x114BD, 0x114BE},
+    {0x115B8, 0x115AF, 0x115BA},
+    {0x115B9, 0x115AF, 0x115BB},
+    {0x11935, 0x11930, 0x11938},
+};
+
+const size_t kNumCompositions = 941;
+
+} // namespace data
+} // namespace unicode
+} // namespace tokenizers
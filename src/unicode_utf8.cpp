@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+// UTF-8 helpers shared by the normalizers, pre-tokenizers and regex scanners.
+// Kept apart from unicode_normalization.cpp so that users of these functions do
+// not link in the normalization tables.
+
+// Local
+#include <pytorch/tokenizers/simd_utils.h>
+#include <pytorch/tokenizers/unicode_normalization.h>
+
+namespace tokenizers {
+namespace unicode {
+
+size_t decode_utf8(const char* data, size_t size, uint32_t& cp) {
+  const auto* s = reinterpret_cast<const unsigned char*>(data);
+  const unsigned char c = s[0];
+  if (c < 0x80) {
+    cp = c;
+    return 1;
+  }
+  size_t len;
+  uint32_t min;
+  if ((c & 0xE0) == 0xC0) {
+    len = 2;
+    min = 0x80;
+    cp = c & 0x1F;
+  } else if ((c & 0xF0) == 0xE0) {
+    len = 3;
+    min = 0x800;
+    cp = c & 0x0F;
+  } else if ((c & 0xF8) == 0xF0) {
+    len = 4;
+    min = 0x10000;
+    cp = c & 0x07;
+  } else {
+    cp = kInvalidCodepoint;
+    return 1;
+  }
+  if (len > size) {
+    cp = kInvalidCodepoint;
+    return 1;
+  }
+  for (size_t i = 1; i < len; ++i) {
+    if ((s[i] & 0xC0) != 0x80) {
+      cp = kInvalidCodepoint;
+      return 1;
+    }
+    cp = (cp << 6) | (s[i] & 0x3F);
+  }
+  if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+    cp = kInvalidCodepoint;
+    return 1;
+  }
+  return len;
+}
+
+void append_utf8(uint32_t cp, std::string& out) {
+  if (cp < 0x80) {
+    out.push_back(static_cast<char>(cp));
+  } else if (cp < 0x800) {
+    out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+    out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+  } else if (cp < 0x10000) {
+    out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+  } else {
+    out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+    out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+  }
+}
+
+void append_utf16_as_utf8(std::u16string_view input, std::string& out) {
+  // At most 3 bytes per code unit
+  const size_t start = out.size();
+  out.resize(start + 3 * input.size());
+  char* dst = out.data() + start;
+  const char16_t* src = input.data();
+  const size_t size = input.size();
+  size_t i = 0;
+  while (i < size) {
+    const size_t ascii = detail::narrow_ascii_utf16(src + i, dst, size - i);
+    i += ascii;
+    dst += ascii;
+    if (i == size) {
+      break;
+    }
+    uint32_t cp = src[i++];
+    if (cp >= 0xD800 && cp <= 0xDBFF && i < size && src[i] >= 0xDC00 &&
+        src[i] <= 0xDFFF) {
+      cp = 0x10000 + ((cp - 0xD800) << 10) + (src[i++] - 0xDC00);
+    } else if (cp >= 0xD800 && cp <= 0xDFFF) {
+      cp = 0xFFFD;
+    }
+    if (cp < 0x800) {
+      *dst++ = static_cast<char>(0xC0 | (cp >> 6));
+      *dst++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+      *dst++ = static_cast<char>(0xE0 | (cp >> 12));
+      *dst++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+      *dst++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+      *dst++ = static_cast<char>(0xF0 | (cp >> 18));
+      *dst++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+      *dst++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+      *dst++ = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+  }
+  out.resize(dst - out.data());
+}
+
+size_t utf16_length(const char* data, size_t size) {
+  size_t length = 0;
+  size_t i = 0;
+  while (i < size) {
+    const size_t ascii = detail::ascii_prefix_length(data + i, size - i);
+    length += ascii;
+    i += ascii;
+    for (; i < size && static_cast<unsigned char>(data[i]) >= 0x80; ++i) {
+      const auto c = static_cast<unsigned char>(data[i]);
+      // Lead bytes count once, and 4-byte sequences encode a surrogate pair
+      length += (c >= 0xC0) + (c >= 0xF0);
+    }
+  }
+  return length;
+}
+
+} // namespace unicode
+} // namespace tokenizers
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <pytorch/tokenizers/warm_start.h>
+
+// Local
+#include <pytorch/tokenizers/log.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace tokenizers {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+size_t page_size() {
+#ifndef _WIN32
+  const long size = sysconf(_SC_PAGESIZE);
+  if (size > 0) {
+    return static_cast<size_t>(size);
+  }
+#endif
+  return 4096;
+}
+
+// Read one byte of every page of the region
+size_t prefault(const MemoryRegion& region, size_t page) {
+  if (region.size == 0) {
+    return 0;
+  }
+  const auto* bytes = static_cast<const volatile uint8_t*>(region.data);
+  uint8_t sink = 0;
+  for (size_t offset = 0; offset < region.size; offset += page) {
+    sink ^= bytes[offset];
+  }
+  sink ^= bytes[region.size - 1];
+  (void)sink;
+  return region.size;
+}
+
+bool lock(const MemoryRegion& region, size_t page) {
+#ifndef _WIN32
+  // mlock works on whole pages
+  const auto begin = reinterpret_cast<uintptr_t>(region.data) & ~(page - 1);
+  const auto end = reinterpret_cast<uintptr_t>(region.data) + region.size;
+  return mlock(reinterpret_cast<const void*>(begin), end - begin) == 0;
+#else
+  (void)region;
+  (void)page;
+  return false;
+#endif
+}
+
+} // namespace
+
+Result<WarmStartReport> warm_start(
+    const Tokenizer& tokenizer,
+    const WarmStartOptions& options) {
+  if (!tokenizer.is_loaded()) {
+    return Error::Uninitialized;
+  }
+  const auto start = Clock::now();
+  WarmStartReport report;
+
+  const auto regions = tokenizer.memory_regions();
+  const size_t page = page_size();
+  if (options.prefault) {
+    for (const auto& region : regions) {
+      report.bytes_prefaulted += prefault(region, page);
+    }
+    report.prefault_time = Clock::now() - start;
+  }
+  if (options.lock_memory) {
+    const auto lock_start = Clock::now();
+    for (const auto& region : regions) {
+      if (region.size == 0) {
+        continue;
+      }
+      if (lock(region, page)) {
+        report.bytes_locked += region.size;
+      } else {
+        ++report.lock_failures;
+      }
+    }
+    report.lock_time = Clock::now() - lock_start;
+    if (report.lock_failures > 0) {
+      TK_LOG(
+          Info,
+          "warm_start: could not lock %zu memory regions",
+          report.lock_failures);
+    }
+  }
+
+  const auto& corpus =
+      options.corpus.empty() ? warm_start_corpus() : options.corpus;
+  std::vector<std::vector<uint64_t>> encoded(corpus.size());
+  // Cleared for a tokenizer loaded without decoding
+  bool decode = true;
+  for (size_t round = 0; round < options.rounds; ++round) {
+    const auto encode_start = Clock::now();
+    for (size_t i = 0; i < corpus.size(); ++i) {
+      auto tokens = tokenizer.encode(corpus[i], 0, 0);
+      if (!tokens.ok()) {
+        if (tokens.error() == Error::Unsupported) {
+          // Loaded for decoding only, there is nothing more to warm up
+          report.total_time = Clock::now() - start;
+          return report;
+        }
+        return tokens.error();
+      }
+      encoded[i] = std::move(*tokens);
+    }
+    const auto decode_start = Clock::now();
+    for (const auto& tokens : encoded) {
+      uint64_t prev = tokenizer.bos_tok();
+      for (size_t j = 0; decode && j < tokens.size(); ++j) {
+        const auto piece = tokenizer.decode(prev, tokens[j]);
+        if (!piece.ok()) {
+          if (piece.error() != Error::Unsupported) {
+            return piece.error();
+          }
+          decode = false;
+        }
+        prev = tokens[j];
+      }
+      report.tokens_encoded += tokens.size();
+    }
+    const auto end = Clock::now();
+    report.encode_time += decode_start - encode_start;
+    report.decode_time += end - decode_start;
+    report.round_times.push_back(end - encode_start);
+    report.texts_encoded += corpus.size();
+  }
+
+  report.total_time = Clock::now() - start;
+  return report;
+}
+
+const std::vector<std::string>& warm_start_corpus() {
+  static const std::vector<std::string> corpus = {
+      "The quick brown fox jumps over the lazy dog. It's 7:30am and we're "
+      "running late; they'll catch up, won't they?",
+      "In 1969, 600 million people watched the landing. Prices rose 3.5% to "
+      "$1,234.56 (up from $999) on 2024-01-15.",
+      "def encode(self, text: str) -> list[int]:\n"
+      "    return [self.vocab[t] for t in text.split()]\n",
+      "for (size_t i = 0; i < n; ++i) {\n\tsum += a[i] * b[i];\n}\n",
+      "{\"id\": 42, \"name\": \"warm start\", \"tags\": [\"a\", \"b\"]}",
+      "   leading spaces, trailing tabs\t\t\n\n\nand blank lines\r\n",
+      "Ünïcödé façade naïve café résumé Straße größer",
+      "Привет, как дела? Ελληνικά κείμενα. שלום עולם. مرحبا بالعالم",
+      "東京は日本の首都です。中文文本测试。한국어 텍스트입니다.",
+      "नमस्ते दुनिया। ภาษาไทย ยินดีต้อนรับ",
+      "Emoji 😀🎉👍🏽 and symbols ©®™ ≤≥≠ ∑∫√ → ← ★",
+      "https://example.com/path?query=value&x=1 user@example.com #hashtag",
+      "ALLCAPS camelCaseIdentifier snake_case_name kebab-case-name 0xDEADBEEF",
+  };
+  return corpus;
+}
+
+} // namespace tokenizers
@@ -21,6 +21,113 @@ def define_common_targets():
         ],
     )
 
+    runtime.cxx_test(
+        name = "test_bpe_trainer",
+        srcs = [
+            "test_bpe_trainer.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:bpe_trainer",
+            "//pytorch/tokenizers:hf_tokenizer",
+            "//pytorch/tokenizers:tiktoken",
+        ],
+    )
+
+    runtime.cxx_test(
+        name = "test_chat_encoder",
+        srcs = [
+            "test_chat_encoder.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:chat_encoder",
+            "//pytorch/tokenizers:tiktoken",
+        ],
+        env = {
+            "RESOURCES_PATH": "$(location :resources)/resources",
+        },
+        platforms = [CXX, ANDROID],  # Cannot bundle resources on Apple platform.
+    )
+
+    runtime.cxx_test(
+        name = "test_closed_form_pieces",
+        srcs = [
+            "test_closed_form_pieces.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:piece_cache",
+            "//pytorch/tokenizers:tiktoken",
+        ],
+        env = {
+            "RESOURCES_PATH": "$(location :resources)/resources",
+        },
+        platforms = [CXX, ANDROID],  # Cannot bundle resources on Apple platform.
+    )
+
+    runtime.cxx_test(
+        name = "test_executor",
+        srcs = [
+            "test_executor.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:executor",
+        ],
+    )
+
+    runtime.cxx_test(
+        name = "test_token_profile",
+        srcs = [
+            "test_token_profile.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:tiktoken",
+            "//pytorch/tokenizers:token_profile",
+        ],
+        env = {
+            "RESOURCES_PATH": "$(location :resources)/resources",
+        },
+        platforms = [CXX, ANDROID],  # Cannot bundle resources on Apple platform.
+    )
+
+    runtime.cxx_test(
+        name = "test_token_stream",
+        srcs = [
+            "test_token_stream.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:token_stream",
+        ],
+    )
+
+    runtime.cxx_test(
+        name = "test_traffic_capture",
+        srcs = [
+            "test_traffic_capture.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:tiktoken",
+            "//pytorch/tokenizers:traffic_capture",
+        ],
+        env = {
+            "RESOURCES_PATH": "$(location :resources)/resources",
+        },
+        platforms = [CXX, ANDROID],  # Cannot bundle resources on Apple platform.
+    )
+
+    runtime.cxx_test(
+        name = "test_c_api",
+        srcs = [
+            "test_c_api.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:c_api",
+            "//pytorch/tokenizers:tiktoken",
+        ],
+        env = {
+            "RESOURCES_PATH": "$(location :resources)/resources",
+        },
+        platforms = [CXX, ANDROID],  # Cannot bundle resources on Apple platform.
+    )
+
     runtime.cxx_test(
         name = "test_llama2c_tokenizer",
         srcs = [
@@ -35,6 +142,21 @@ def define_common_targets():
         platforms = [CXX, ANDROID],  # Cannot bundle resources on Apple platform.
     )
 
+    runtime.cxx_test(
+        name = "test_piece_cache",
+        srcs = [
+            "test_piece_cache.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:piece_cache",
+            "//pytorch/tokenizers:tiktoken",
+        ],
+        env = {
+            "RESOURCES_PATH": "$(location :resources)/resources",
+        },
+        platforms = [CXX],  # Needs POSIX shared memory and fork.
+    )
+
     runtime.cxx_test(
         name = "test_pre_tokenizer",
         srcs = [
@@ -92,6 +214,59 @@ def define_common_targets():
         platforms = [CXX, ANDROID],  # Cannot bundle resources on Apple platform.
     )
 
+    runtime.cxx_test(
+        name = "test_tokenizer_handle",
+        srcs = [
+            "test_tokenizer_handle.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:tiktoken",
+        ],
+        env = {
+            "RESOURCES_PATH": "$(location :resources)/resources",
+        },
+        platforms = [CXX, ANDROID],  # Cannot bundle resources on Apple platform.
+    )
+
+    runtime.cxx_test(
+        name = "test_warm_start",
+        srcs = [
+            "test_warm_start.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:llama2c_tokenizer",
+            "//pytorch/tokenizers:piece_cache",
+            "//pytorch/tokenizers:tiktoken",
+            "//pytorch/tokenizers:warm_start",
+        ],
+        env = {
+            "RESOURCES_PATH": "$(location :resources)/resources",
+        },
+        platforms = [CXX],  # Uses SharedPieceCache.
+    )
+
+    runtime.cxx_test(
+        name = "test_native_regex",
+        srcs = [
+            "test_native_regex.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:regex_lookahead",
+            "//pytorch/tokenizers:headers",
+        ],
+    )
+
+    runtime.cxx_test(
+        name = "test_pike_regex",
+        srcs = [
+            "test_pike_regex.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:regex_lookahead",
+            "//pytorch/tokenizers:headers",
+        ],
+    )
+
     runtime.cxx_test(
         name = "test_regex",
         srcs = [
@@ -103,6 +278,22 @@ def define_common_targets():
         ],
     )
 
+    runtime.cxx_test(
+        name = "test_regex_autotune",
+        srcs = [
+            "test_regex_autotune.cpp",
+        ],
+        deps = [
+            "//pytorch/tokenizers:regex_lookahead",
+            "//pytorch/tokenizers:tiktoken",
+            "//pytorch/tokenizers:warm_start",
+        ],
+        env = {
+            "RESOURCES_PATH": "$(location :resources)/resources",
+        },
+        platforms = [CXX, ANDROID],  # Cannot bundle resources on Apple platform.
+    )
+
     runtime.filegroup(
         name = "resources",
         srcs = native.glob([
@@ -32,4 +32,15 @@ TEST(Base64Test, TestInvalidStringDecodeReturnsError) {
   EXPECT_EQ(result.error(), Error::Base64DecodeFailure);
 }
 
+TEST(Base64Test, TestEncodeRoundTrip) {
+  EXPECT_EQ(base64::encode("llama"), "bGxhbWE=");
+  EXPECT_EQ(base64::encode("ll"), "bGw=");
+  EXPECT_EQ(base64::encode("lla"), "bGxh");
+  EXPECT_EQ(base64::encode(""), "");
+  const std::string bytes("\x00\xff\x80 \n", 5);
+  auto result = base64::decode(base64::encode(bytes));
+  EXPECT_TRUE(result.ok());
+  EXPECT_EQ(result.get(), bytes);
+}
+
 } // namespace tokenizers
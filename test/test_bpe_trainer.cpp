@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <cstdio>
+#include <map>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <pytorch/tokenizers/bpe_trainer.h>
+#include <pytorch/tokenizers/hf_tokenizer.h>
+#include <pytorch/tokenizers/tiktoken.h>
+
+using namespace ::testing;
+
+namespace tokenizers {
+
+namespace {
+
+const std::string kPattern =
+    R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+)";
+
+PreTokenizer::Ptr split_pre_tokenizer() {
+  return PreTokenizerConfig("Split")
+      .set_pattern(kPattern)
+      .set_behavior("Isolated")
+      .create();
+}
+
+// Deterministic pseudo-random documents over a small vocabulary
+std::vector<std::string> make_corpus(size_t num_documents) {
+  const std::vector<std::string> words = {
+      "the",     "tokenizer", "learns",  "merges", "from",  "a",
+      "corpus",  "of",        "text",    "lower",  "newest", "widest",
+      "Ünïcödé", "😀",        "42",      "1999",   "don't", "it's",
+  };
+  uint32_t state = 12345;
+  std::vector<std::string> documents;
+  for (size_t d = 0; d < num_documents; ++d) {
+    std::string document;
+    for (int w = 0; w < 20; ++w) {
+      state = state * 1103515245 + 12345;
+      document += words[(state >> 16) % words.size()];
+      document += (state & 7) == 0 ? ".\n" : " ";
+    }
+    documents.push_back(std::move(document));
+  }
+  return documents;
+}
+
+// Textbook BPE: recount every pair before each merge
+std::vector<std::pair<uint32_t, uint32_t>> naive_merges(
+    const std::map<std::string, uint64_t>& counts,
+    size_t num_merges,
+    uint64_t min_frequency) {
+  std::vector<std::pair<std::vector<uint32_t>, uint64_t>> words;
+  for (const auto& [text, count] : counts) {
+    std::vector<uint32_t> symbols;
+    for (const char c : text) {
+      symbols.push_back(static_cast<uint8_t>(c));
+    }
+    words.emplace_back(std::move(symbols), count);
+  }
+  std::vector<std::string> vocab;
+  for (int i = 0; i < 256; ++i) {
+    vocab.emplace_back(1, static_cast<char>(i));
+  }
+  std::vector<std::pair<uint32_t, uint32_t>> merges;
+  while (merges.size() < num_merges) {
+    std::map<std::pair<uint32_t, uint32_t>, uint64_t> pairs;
+    for (const auto& [symbols, count] : words) {
+      for (size_t i = 0; i + 1 < symbols.size(); ++i) {
+        pairs[{symbols[i], symbols[i + 1]}] += count;
+      }
+    }
+    std::pair<uint32_t, uint32_t> best;
+    uint64_t best_count = 0;
+    for (const auto& [pair, count] : pairs) {
+      if (count > best_count) {
+        best = pair;
+        best_count = count;
+      }
+    }
+    if (best_count < std::max<uint64_t>(1, min_frequency)) {
+      break;
+    }
+    merges.push_back(best);
+    const std::string bytes = vocab[best.first] + vocab[best.second];
+    uint32_t merged = std::find(vocab.begin(), vocab.end(), bytes) -
+        vocab.begin();
+    if (merged == vocab.size()) {
+      vocab.push_back(bytes);
+    }
+    for (auto& [symbols, count] : words) {
+      std::vector<uint32_t> out;
+      for (size_t i = 0; i < symbols.size(); ++i) {
+        if (i + 1 < symbols.size() && symbols[i] == best.first &&
+            symbols[i + 1] == best.second) {
+          out.push_back(merged);
+          ++i;
+        } else {
+          out.push_back(symbols[i]);
+        }
+      }
+      symbols = std::move(out);
+    }
+  }
+  return merges;
+}
+
+std::string temp_path(const std::string& suffix) {
+  return std::tmpnam(nullptr) + suffix;
+}
+
+} // namespace
+
+TEST(BPETrainerTest, LearnsMostFrequentPairsFirst) {
+  BPETrainerConfig config;
+  config.vocab_size = 256 + 3;
+  BPETrainer trainer(split_pre_tokenizer(), config);
+  trainer.add_word("aaab", 2);
+  trainer.add_word("aab", 3);
+  ASSERT_EQ(trainer.train(), Error::Ok);
+
+  // (a, a) occurs 2 * 2 + 3 = 7 times. The words become "aa a b" and "aa b",
+  // so (aa, b) follows with 3. (aa, a) and (a, b) then tie at 2 and the
+  // lower pair of ids wins.
+  ASSERT_EQ(trainer.merges().size(), 3);
+  EXPECT_EQ(trainer.vocab().size(), 259);
+  EXPECT_EQ(trainer.vocab()[256], "aa");
+  EXPECT_EQ(trainer.vocab()[257], "aab");
+  EXPECT_EQ(trainer.vocab()[258], "ab");
+  EXPECT_EQ(
+      trainer.merges()[0], std::make_pair(uint32_t('a'), uint32_t('a')));
+  EXPECT_EQ(trainer.merges()[1], std::make_pair(256u, uint32_t('b')));
+}
+
+TEST(BPETrainerTest, MinFrequencyStopsTraining) {
+  BPETrainerConfig config;
+  config.vocab_size = 1000;
+  config.min_frequency = 3;
+  BPETrainer trainer(split_pre_tokenizer(), config);
+  trainer.add_word("xy", 3);
+  trainer.add_word("zw", 2);
+  ASSERT_EQ(trainer.train(), Error::Ok);
+  ASSERT_EQ(trainer.vocab().size(), 257);
+  EXPECT_EQ(trainer.vocab()[256], "xy");
+}
+
+TEST(BPETrainerTest, MatchesNaiveTraining) {
+  BPETrainerConfig config;
+  config.vocab_size = 256 + 150;
+  config.num_threads = 4;
+  BPETrainer trainer(split_pre_tokenizer(), config);
+  const auto corpus = make_corpus(200);
+  ASSERT_EQ(trainer.feed(corpus), Error::Ok);
+  ASSERT_EQ(trainer.train(), Error::Ok);
+
+  std::map<std::string, uint64_t> counts;
+  const auto pre_tokenizer = split_pre_tokenizer();
+  for (const auto& document : corpus) {
+    for (const auto& word : pre_tokenizer->pre_tokenize(document)) {
+      ++counts[word];
+    }
+  }
+  EXPECT_EQ(trainer.num_words(), counts.size());
+  EXPECT_EQ(
+      trainer.merges(),
+      naive_merges(counts, trainer.merges().size(), config.min_frequency));
+  EXPECT_GT(trainer.merges().size(), 50);
+}
+
+TEST(BPETrainerTest, ThreadCountDoesNotChangeResult) {
+  const auto corpus = make_corpus(100);
+  std::vector<std::vector<std::string>> vocabs;
+  for (const size_t threads : {1, 3, 8}) {
+    BPETrainerConfig config;
+    config.vocab_size = 400;
+    config.num_threads = threads;
+    config.num_shards = threads;
+    BPETrainer trainer(split_pre_tokenizer(), config);
+    // Feed in several calls from several threads
+    std::vector<std::thread> feeders;
+    for (size_t i = 0; i < 4; ++i) {
+      feeders.emplace_back([&, i] {
+        std::vector<std::string> part(
+            corpus.begin() + i * 25, corpus.begin() + (i + 1) * 25);
+        EXPECT_EQ(trainer.feed(part), Error::Ok);
+      });
+    }
+    for (auto& feeder : feeders) {
+      feeder.join();
+    }
+    ASSERT_EQ(trainer.train(), Error::Ok);
+    vocabs.push_back(trainer.vocab());
+  }
+  EXPECT_EQ(vocabs[0], vocabs[1]);
+  EXPECT_EQ(vocabs[0], vocabs[2]);
+}
+
+TEST(BPETrainerTest, SaveTiktoken) {
+  BPETrainerConfig config;
+  config.vocab_size = 500;
+  BPETrainer trainer(split_pre_tokenizer(), config);
+  EXPECT_EQ(trainer.save_tiktoken(temp_path(".model")), Error::Uninitialized);
+  ASSERT_EQ(trainer.feed(make_corpus(100)), Error::Ok);
+  ASSERT_EQ(trainer.train(), Error::Ok);
+  const std::string path = temp_path(".model");
+  ASSERT_EQ(trainer.save_tiktoken(path), Error::Ok);
+
+  Tiktoken tokenizer(kPattern, {"<|begin_of_text|>", "<|end_of_text|>"}, 0, 1);
+  ASSERT_EQ(tokenizer.load(path), Error::Ok);
+  std::remove(path.c_str());
+  EXPECT_EQ(tokenizer.vocab_size(), trainer.vocab().size() + 2);
+
+  const std::string text = "the newest tokenizer learns merges. Ünïcödé 😀";
+  const auto tokens = tokenizer.encode(text, 0, 0);
+  ASSERT_TRUE(tokens.ok());
+  EXPECT_LT(tokens->size(), text.size() / 3);
+  std::string decoded;
+  uint64_t prev = tokenizer.bos_tok();
+  for (const uint64_t token : *tokens) {
+    decoded += tokenizer.decode(prev, token).get();
+    prev = token;
+  }
+  EXPECT_EQ(decoded, text);
+}
+
+TEST(BPETrainerTest, SaveHFTokenizer) {
+  BPETrainerConfig config;
+  config.vocab_size = 500;
+  config.special_tokens = {"<|begin_of_text|>", "<|end_of_text|>"};
+  BPETrainer trainer(split_pre_tokenizer(), config);
+  // Count words the way the GPT-2 ByteLevel pre-tokenizer of the artifact
+  // splits this corpus: a leading space or newline starts a new word
+  for (const auto& document : make_corpus(100)) {
+    std::vector<std::string> words = {""};
+    for (const char c : document) {
+      if ((c == ' ' || c == '\n') && !words.back().empty()) {
+        words.emplace_back();
+      }
+      words.back() += c;
+    }
+    for (const auto& word : words) {
+      trainer.add_word(word);
+    }
+  }
+  ASSERT_EQ(trainer.train(), Error::Ok);
+  const std::string path = temp_path(".json");
+  ASSERT_EQ(trainer.save_hf_tokenizer(path), Error::Ok);
+
+  HFTokenizer tokenizer;
+  ASSERT_EQ(tokenizer.load(path), Error::Ok);
+  std::remove(path.c_str());
+  EXPECT_EQ(tokenizer.vocab_size(), trainer.vocab().size() + 2);
+  EXPECT_EQ(tokenizer.bos_tok(), trainer.vocab().size());
+  EXPECT_EQ(tokenizer.eos_tok(), trainer.vocab().size() + 1);
+
+  const std::string text = "the widest corpus of text";
+  const auto tokens = tokenizer.encode(text, 1, 0);
+  ASSERT_TRUE(tokens.ok());
+  EXPECT_EQ(tokens->size(), 6);
+  std::string decoded;
+  for (size_t i = 1; i < tokens->size(); ++i) {
+    decoded += tokenizer.decode((*tokens)[i - 1], (*tokens)[i]).get();
+  }
+  EXPECT_EQ(decoded, text);
+}
+
+} // namespace tokenizers
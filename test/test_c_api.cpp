@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <pytorch/tokenizers/c_api.h>
+#include <pytorch/tokenizers/tiktoken.h>
+
+using namespace ::testing;
+
+namespace {
+
+std::string resource_path(const std::string& name) {
+  return std::getenv("RESOURCES_PATH") + std::string("/") + name;
+}
+
+// Flatten strings into the bytes + offsets layout of the C API
+void flatten(
+    const std::vector<std::string>& texts,
+    std::string& bytes,
+    std::vector<size_t>& offsets) {
+  offsets = {0};
+  for (const auto& text : texts) {
+    bytes += text;
+    offsets.push_back(bytes.size());
+  }
+}
+
+// A foreign pool that starts a thread per task
+struct ThreadPerTask {
+  std::vector<std::thread> threads;
+
+  static void submit(void* context, tk_task_fn task, void* arg) {
+    static_cast<ThreadPerTask*>(context)->threads.emplace_back(task, arg);
+  }
+};
+
+} // namespace
+
+class CApiTest : public Test {
+ public:
+  void SetUp() override {
+    model_path_ = resource_path("test_tiktoken_tokenizer.model");
+    ASSERT_EQ(
+        tk_tokenizer_load("tiktoken", model_path_.c_str(), &tokenizer_), TK_OK);
+    ASSERT_EQ(reference_.load(model_path_), tokenizers::Error::Ok);
+  }
+
+  void TearDown() override {
+    tk_tokenizer_free(tokenizer_);
+  }
+
+  std::string model_path_;
+  tk_tokenizer* tokenizer_ = nullptr;
+  tokenizers::Tiktoken reference_;
+};
+
+TEST_F(CApiTest, LoadErrors) {
+  tk_tokenizer* tokenizer = nullptr;
+  EXPECT_EQ(
+      tk_tokenizer_load("unknown", model_path_.c_str(), &tokenizer),
+      TK_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(
+      tk_tokenizer_load("tiktoken", "invalid_path", &tokenizer),
+      TK_ERROR_LOAD_FAILURE);
+  EXPECT_EQ(tokenizer, nullptr);
+  EXPECT_EQ(
+      tk_tokenizer_load("tiktoken", model_path_.c_str(), nullptr),
+      TK_ERROR_INVALID_ARGUMENT);
+  EXPECT_STREQ(
+      tk_status_string(TK_ERROR_LOAD_FAILURE),
+      "failed to load tokenizer artifact");
+  EXPECT_EQ(tk_api_version(), TK_C_API_VERSION);
+}
+
+TEST_F(CApiTest, Properties) {
+  EXPECT_EQ(tk_vocab_size(tokenizer_), reference_.vocab_size());
+  EXPECT_EQ(tk_bos_token(tokenizer_), reference_.bos_tok());
+  EXPECT_EQ(tk_eos_token(tokenizer_), reference_.eos_tok());
+}
+
+TEST_F(CApiTest, EncodeBatch) {
+  const std::vector<std::string> texts = {
+      "hello world", "", "Ünïcödé 😀 text", "<|begin_of_text|>a b c"};
+  std::string bytes;
+  std::vector<size_t> text_offsets;
+  flatten(texts, bytes, text_offsets);
+
+  std::vector<uint64_t> ids(256);
+  std::vector<size_t> id_offsets(texts.size() + 1);
+  size_t required = 0;
+  ASSERT_EQ(
+      tk_encode_batch(
+          tokenizer_,
+          bytes.data(),
+          text_offsets.data(),
+          texts.size(),
+          1,
+          0,
+          ids.data(),
+          ids.size(),
+          id_offsets.data(),
+          &required),
+      TK_OK);
+  EXPECT_EQ(required, id_offsets.back());
+
+  for (size_t i = 0; i < texts.size(); ++i) {
+    const auto expected = reference_.encode(texts[i], 1, 0);
+    ASSERT_TRUE(expected.ok());
+    const std::vector<uint64_t> actual(
+        ids.begin() + id_offsets[i], ids.begin() + id_offsets[i + 1]);
+    EXPECT_EQ(actual, expected.get()) << texts[i];
+  }
+}
+
+TEST_F(CApiTest, EncodeBatchBufferTooSmall) {
+  const std::vector<std::string> texts = {"hello world", "more text here"};
+  std::string bytes;
+  std::vector<size_t> text_offsets;
+  flatten(texts, bytes, text_offsets);
+
+  std::vector<size_t> id_offsets(texts.size() + 1);
+  size_t required = 0;
+  EXPECT_EQ(
+      tk_encode_batch(
+          tokenizer_,
+          bytes.data(),
+          text_offsets.data(),
+          texts.size(),
+          0,
+          0,
+          nullptr,
+          0,
+          id_offsets.data(),
+          &required),
+      TK_ERROR_BUFFER_TOO_SMALL);
+
+  std::vector<uint64_t> ids(required);
+  EXPECT_EQ(
+      tk_encode_batch(
+          tokenizer_,
+          bytes.data(),
+          text_offsets.data(),
+          texts.size(),
+          0,
+          0,
+          ids.data(),
+          ids.size(),
+          id_offsets.data(),
+          nullptr),
+      TK_OK);
+  EXPECT_EQ(id_offsets.back(), required);
+
+  const size_t bad_offsets[] = {4, 2};
+  EXPECT_EQ(
+      tk_encode_batch(
+          tokenizer_,
+          bytes.data(),
+          bad_offsets,
+          1,
+          0,
+          0,
+          ids.data(),
+          ids.size(),
+          id_offsets.data(),
+          nullptr),
+      TK_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(CApiTest, EncodeBatchOnCallerExecutor) {
+  std::vector<std::string> texts;
+  for (int i = 0; i < 64; ++i) {
+    texts.push_back("text number " + std::to_string(i) + " of the batch");
+  }
+  std::string bytes;
+  std::vector<size_t> text_offsets;
+  flatten(texts, bytes, text_offsets);
+
+  EXPECT_EQ(
+      tk_set_executor(ThreadPerTask::submit, nullptr, 0),
+      TK_ERROR_INVALID_ARGUMENT);
+  ThreadPerTask pool;
+  ASSERT_EQ(tk_set_executor(ThreadPerTask::submit, &pool, 4), TK_OK);
+  std::vector<uint64_t> ids(4096);
+  std::vector<size_t> id_offsets(texts.size() + 1);
+  const auto status = tk_encode_batch(
+      tokenizer_,
+      bytes.data(),
+      text_offsets.data(),
+      texts.size(),
+      0,
+      0,
+      ids.data(),
+      ids.size(),
+      id_offsets.data(),
+      nullptr);
+  ASSERT_EQ(tk_set_executor(nullptr, nullptr, 0), TK_OK);
+  for (auto& thread : pool.threads) {
+    thread.join();
+  }
+  ASSERT_EQ(status, TK_OK);
+  // The calling thread takes part in the batch
+  EXPECT_EQ(pool.threads.size(), 3);
+
+  for (size_t i = 0; i < texts.size(); ++i) {
+    const auto expected = reference_.encode(texts[i], 0, 0);
+    ASSERT_TRUE(expected.ok());
+    const std::vector<uint64_t> actual(
+        ids.begin() + id_offsets[i], ids.begin() + id_offsets[i + 1]);
+    EXPECT_EQ(actual, expected.get()) << texts[i];
+  }
+}
+
+TEST_F(CApiTest, EncodeUtf16) {
+  const std::u16string text = u"naïve 😀 text";
+  const auto expected = reference_.encode("naïve 😀 text", 1, 0);
+  ASSERT_TRUE(expected.ok());
+  const auto* units = reinterpret_cast<const uint16_t*>(text.data());
+
+  size_t required = 0;
+  EXPECT_EQ(
+      tk_encode_utf16(
+          tokenizer_, units, text.size(), 1, 0, nullptr, 0, nullptr, &required),
+      TK_ERROR_BUFFER_TOO_SMALL);
+  ASSERT_EQ(required, expected->size());
+
+  std::vector<uint64_t> ids(required);
+  std::vector<size_t> ends(required);
+  ASSERT_EQ(
+      tk_encode_utf16(
+          tokenizer_,
+          units,
+          text.size(),
+          1,
+          0,
+          ids.data(),
+          ids.size(),
+          ends.data(),
+          nullptr),
+      TK_OK);
+  EXPECT_EQ(ids, expected.get());
+  // The BOS token is empty, and the last token ends with the text
+  EXPECT_EQ(ends.front(), 0);
+  EXPECT_EQ(ends.back(), text.size());
+  EXPECT_TRUE(std::is_sorted(ends.begin(), ends.end()));
+}
+
+TEST_F(CApiTest, DecodeBatchRoundTrip) {
+  const std::vector<std::string> texts = {
+      "hello world", "Ünïcödé 😀 text", "", "line\nbreaks\n"};
+  std::string bytes;
+  std::vector<size_t> text_offsets;
+  flatten(texts, bytes, text_offsets);
+
+  std::vector<uint64_t> ids(256);
+  std::vector<size_t> id_offsets(texts.size() + 1);
+  ASSERT_EQ(
+      tk_encode_batch(
+          tokenizer_,
+          bytes.data(),
+          text_offsets.data(),
+          texts.size(),
+          0,
+          0,
+          ids.data(),
+          ids.size(),
+          id_offsets.data(),
+          nullptr),
+      TK_OK);
+
+  std::vector<size_t> decoded_offsets(texts.size() + 1);
+  size_t required = 0;
+  ASSERT_EQ(
+      tk_decode_batch(
+          tokenizer_,
+          ids.data(),
+          id_offsets.data(),
+          texts.size(),
+          nullptr,
+          0,
+          decoded_offsets.data(),
+          &required),
+      TK_ERROR_BUFFER_TOO_SMALL);
+  EXPECT_EQ(required, bytes.size());
+
+  std::string decoded(required, '\0');
+  ASSERT_EQ(
+      tk_decode_batch(
+          tokenizer_,
+          ids.data(),
+          id_offsets.data(),
+          texts.size(),
+          decoded.data(),
+          decoded.size(),
+          decoded_offsets.data(),
+          nullptr),
+      TK_OK);
+  EXPECT_EQ(decoded, bytes);
+  EXPECT_EQ(decoded_offsets, text_offsets);
+}
+
+TEST_F(CApiTest, WarmStart) {
+  uint64_t elapsed_ns = 0;
+  EXPECT_EQ(
+      tk_warm_start(tokenizer_, nullptr, nullptr, 0, 0, &elapsed_ns), TK_OK);
+  EXPECT_GT(elapsed_ns, 0);
+
+  const std::vector<std::string> texts = {
+      "hello world", "Ünïcödé 😀 text"};
+  std::string bytes;
+  std::vector<size_t> offsets;
+  flatten(texts, bytes, offsets);
+  EXPECT_EQ(
+      tk_warm_start(
+          tokenizer_,
+          bytes.data(),
+          offsets.data(),
+          texts.size(),
+          TK_WARM_START_NO_PREFAULT,
+          nullptr),
+      TK_OK);
+  EXPECT_EQ(
+      tk_warm_start(
+          tokenizer_, bytes.data(), nullptr, texts.size(), 0, nullptr),
+      TK_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(
+      tk_warm_start(nullptr, nullptr, nullptr, 0, 0, nullptr),
+      TK_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(CApiTest, StreamDecoderHoldsBackPartialCharacters) {
+  const std::string text = "emoji 😀🎉 and ünïcödé";
+  const auto tokens = reference_.encode(text, 0, 0);
+  ASSERT_TRUE(tokens.ok());
+
+  tk_stream_decoder* decoder = nullptr;
+  ASSERT_EQ(tk_stream_decoder_new(tokenizer_, &decoder), TK_OK);
+  std::string output;
+  char buffer[64];
+  for (const uint64_t token : tokens.get()) {
+    size_t written = 0;
+    ASSERT_EQ(
+        tk_stream_decoder_push(
+            decoder, token, buffer, sizeof(buffer), &written),
+        TK_OK);
+    const std::string chunk(buffer, written);
+    // Every chunk ends on a character boundary
+    if (!chunk.empty()) {
+      const auto last = static_cast<unsigned char>(chunk.back());
+      EXPECT_TRUE(last < 0x80 || (last & 0xC0) == 0x80) << chunk;
+    }
+    output += chunk;
+    EXPECT_EQ(text.compare(0, output.size(), output), 0);
+  }
+  size_t written = 0;
+  ASSERT_EQ(
+      tk_stream_decoder_flush(decoder, buffer, sizeof(buffer), &written),
+      TK_OK);
+  output.append(buffer, written);
+  EXPECT_EQ(output, text);
+  tk_stream_decoder_free(decoder);
+}
+
+TEST_F(CApiTest, StreamDecoderSmallBuffer) {
+  const std::string text = "a longer piece of text, 😀";
+  const auto tokens = reference_.encode(text, 0, 0);
+  ASSERT_TRUE(tokens.ok());
+
+  tk_stream_decoder* decoder = nullptr;
+  ASSERT_EQ(tk_stream_decoder_new(tokenizer_, &decoder), TK_OK);
+  std::string output;
+  char buffer[2];
+  for (const uint64_t token : tokens.get()) {
+    size_t written = 0;
+    ASSERT_EQ(
+        tk_stream_decoder_push(
+            decoder, token, buffer, sizeof(buffer), &written),
+        TK_OK);
+    output.append(buffer, written);
+  }
+  // The rest does not fit: nothing is written or dropped
+  size_t written = 0;
+  ASSERT_EQ(
+      tk_stream_decoder_flush(decoder, buffer, sizeof(buffer), &written),
+      TK_ERROR_BUFFER_TOO_SMALL);
+  std::string rest(written, '\0');
+  ASSERT_EQ(
+      tk_stream_decoder_flush(decoder, rest.data(), rest.size(), &written),
+      TK_OK);
+  output += rest;
+  EXPECT_EQ(output, text);
+  tk_stream_decoder_free(decoder);
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <gtest/gtest.h>
+#include <pytorch/tokenizers/chat_encoder.h>
+#include <pytorch/tokenizers/tiktoken.h>
+
+using namespace ::testing;
+
+namespace tokenizers {
+
+namespace {
+
+std::string model_path() {
+  return std::getenv("RESOURCES_PATH") +
+      std::string("/test_tiktoken_tokenizer.model");
+}
+
+// Text of the tokens of the encoding whose loss mask is set
+std::string trained_text(
+    const Tokenizer& tokenizer,
+    const ChatEncoding& encoding) {
+  std::string text;
+  for (size_t i = 0; i < encoding.tokens.size(); ++i) {
+    if (encoding.loss_mask[i]) {
+      text += tokenizer.decode(0, encoding.tokens[i]).get();
+    }
+  }
+  return text;
+}
+
+const std::vector<ChatMessage> kConversation = {
+    {"system", "You are a helpful assistant."},
+    {"user", "What is 12 + 30?"},
+    {"assistant", "12 + 30 = 42."},
+    {"user", "Thanks! Now in ünïcödé 😀"},
+    {"assistant", "  Leading spaces,\n\nnewlines and ünïcödé 😀"},
+};
+
+} // namespace
+
+class ChatEncoderTest : public Test {
+ public:
+  void SetUp() override {
+    ASSERT_EQ(tokenizer_.load(model_path()), Error::Ok);
+  }
+
+  Tiktoken tokenizer_;
+};
+
+TEST_F(ChatEncoderTest, MatchesEncodingTheRenderedText) {
+  ChatEncoder encoder(tokenizer_, ChatTemplate::llama3());
+  const std::string rendered = encoder.render(kConversation);
+  EXPECT_EQ(
+      rendered.rfind(
+          "<|begin_of_text|><|start_header_id|>system<|end_header_id|>\n\n"
+          "You are",
+          0),
+      0);
+
+  const auto encoding = encoder.encode(kConversation);
+  ASSERT_TRUE(encoding.ok());
+  const auto expected = tokenizer_.encode(rendered, 0, 0);
+  ASSERT_TRUE(expected.ok());
+  EXPECT_EQ(encoding->tokens, *expected);
+  EXPECT_EQ(encoding->segment_ids.size(), expected->size());
+  EXPECT_EQ(encoding->role_ids.size(), expected->size());
+  EXPECT_EQ(encoding->loss_mask.size(), expected->size());
+}
+
+TEST_F(ChatEncoderTest, AnnotatesEveryToken) {
+  ChatEncoder encoder(tokenizer_, ChatTemplate::llama3());
+  const auto encoding = encoder.encode(kConversation);
+  ASSERT_TRUE(encoding.ok());
+
+  // <|begin_of_text|> is outside of the messages
+  EXPECT_EQ(encoding->tokens[0], tokenizer_.bos_tok());
+  EXPECT_EQ(encoding->segment_ids[0], -1);
+  EXPECT_EQ(encoding->role_ids[0], -1);
+  EXPECT_EQ(encoding->loss_mask[0], 0);
+
+  // Segment and role ids follow the messages
+  for (size_t i = 1; i < encoding->tokens.size(); ++i) {
+    ASSERT_GE(encoding->segment_ids[i], encoding->segment_ids[i - 1]);
+    const auto& message = kConversation[encoding->segment_ids[i]];
+    EXPECT_EQ(
+        ChatTemplate::llama3().roles[encoding->role_ids[i]], message.role);
+    if (encoding->loss_mask[i]) {
+      EXPECT_EQ(message.role, "assistant");
+    }
+  }
+  EXPECT_EQ(encoding->segment_ids.back(), kConversation.size() - 1);
+
+  // Only the content and end of turn of the assistant messages are trained
+  EXPECT_EQ(
+      trained_text(tokenizer_, *encoding),
+      kConversation[2].content + "<|eot_id|>" + kConversation[4].content +
+          "<|eot_id|>");
+}
+
+TEST_F(ChatEncoderTest, SpecialTokensInContentAreEncodedAsRendered) {
+  ChatEncoder encoder(tokenizer_, ChatTemplate::llama3());
+  const std::vector<ChatMessage> messages = {
+      {"user", "<|eot_id|>"}, {"assistant", ""}, {"assistant", "ok"}};
+  const auto encoding = encoder.encode(messages);
+  ASSERT_TRUE(encoding.ok());
+  EXPECT_EQ(
+      encoding->tokens, *tokenizer_.encode(encoder.render(messages), 0, 0));
+  EXPECT_EQ(
+      trained_text(tokenizer_, *encoding), "<|eot_id|>ok<|eot_id|>");
+}
+
+TEST_F(ChatEncoderTest, GenerationPrompt) {
+  auto chat_template = ChatTemplate::llama3();
+  chat_template.end = "<|start_header_id|>assistant<|end_header_id|>\n\n";
+  ChatEncoder encoder(tokenizer_, chat_template);
+  const auto encoding = encoder.encode({{"user", "Hi"}});
+  ASSERT_TRUE(encoding.ok());
+  ASSERT_GE(encoding->tokens.size(), 4);
+  for (size_t i = encoding->tokens.size() - 4; i < encoding->tokens.size();
+       ++i) {
+    EXPECT_EQ(encoding->segment_ids[i], -1);
+    EXPECT_EQ(encoding->loss_mask[i], 0);
+  }
+}
+
+TEST_F(ChatEncoderTest, ChatML) {
+  Tiktoken tokenizer({"<|im_start|>", "<|im_end|>"}, 0, 1);
+  ASSERT_EQ(tokenizer.load(model_path()), Error::Ok);
+  ChatEncoder encoder(tokenizer, ChatTemplate::chatml());
+  const std::vector<ChatMessage> messages = {
+      {"user", "Hello"}, {"assistant", "Hi there"}};
+  const auto encoding = encoder.encode(messages);
+  ASSERT_TRUE(encoding.ok());
+  EXPECT_EQ(
+      encoding->tokens, *tokenizer.encode(encoder.render(messages), 0, 0));
+  EXPECT_EQ(trained_text(tokenizer, *encoding), "Hi there<|im_end|>\n");
+}
+
+TEST_F(ChatEncoderTest, UnknownRole) {
+  ChatEncoder encoder(tokenizer_, ChatTemplate::llama3());
+  EXPECT_EQ(
+      encoder.encode({{"narrator", "Once upon a time"}}).error(),
+      Error::EncodeFailure);
+}
+
+} // namespace tokenizers
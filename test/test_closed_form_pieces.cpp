@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <limits>
+
+#include <gtest/gtest.h>
+#include <pytorch/tokenizers/closed_form_pieces.h>
+#include <pytorch/tokenizers/tiktoken.h>
+
+using namespace ::testing;
+
+namespace tokenizers {
+
+namespace {
+
+std::string resource_path(const std::string& name) {
+  return std::getenv("RESOURCES_PATH") + std::string("/") + name;
+}
+
+// Code and tables, with runs longer than any single-token run
+std::string tabular_text() {
+  std::string text = "def f(x):\n    if x:\n\t\treturn 1\n\n\n";
+  for (size_t n = 1; n <= 300; n += 7) {
+    text += std::string(n, ' ') + "x" + std::string(n, '\n');
+    text += std::string(n % 40 + 1, '\t') + "y" + std::string(n, '=') + " ";
+    text += std::string(n, '-') + "|" + std::string(n % 9 + 1, '*') + "\r\n";
+  }
+  for (size_t value = 0; value < 2000; value += 37) {
+    text += std::to_string(value) + "," + std::to_string(value * 7919) + ";";
+  }
+  return text + "   007 | 1,234.56 | !!! ??? ... ### \n\n";
+}
+
+// A piece is a token if it merges into one
+template <typename Encode>
+ClosedFormPieces::TokenLookup token_lookup(const Encode& encode) {
+  return [encode](std::string_view piece) -> std::optional<uint64_t> {
+    const Result<std::vector<uint64_t>> tokens = encode(piece);
+    if (!tokens.ok() || tokens->size() != 1) {
+      return std::nullopt;
+    }
+    return tokens->front();
+  };
+}
+
+} // namespace
+
+TEST(ClosedFormPiecesTest, MatchesMerge) {
+  const std::string text = tabular_text();
+  Tiktoken reference;
+  reference.set_closed_form_pieces(false);
+  reference.set_merge_batch_size(1);
+  ASSERT_EQ(
+      reference.load(resource_path("test_tiktoken_tokenizer.model")),
+      Error::Ok);
+  EXPECT_TRUE(reference.closed_form_pieces().empty());
+  const auto expected = reference.encode(text, 1, 1);
+  ASSERT_TRUE(expected.ok());
+
+  auto cache = SharedPieceCache::open("", 256);
+  ASSERT_TRUE(cache.ok());
+  for (const size_t batch_size : {1, 8}) {
+    for (const bool use_cache : {false, true}) {
+      Tiktoken tokenizer;
+      tokenizer.set_merge_batch_size(batch_size);
+      ASSERT_EQ(
+          tokenizer.load(resource_path("test_tiktoken_tokenizer.model")),
+          Error::Ok);
+      ASSERT_FALSE(tokenizer.closed_form_pieces().empty());
+      if (use_cache) {
+        ASSERT_EQ(tokenizer.set_piece_cache(*cache), Error::Ok);
+      }
+      const auto out = tokenizer.encode(text, 1, 1);
+      ASSERT_TRUE(out.ok());
+      EXPECT_EQ(*out, *expected)
+          << "batch size " << batch_size << " cache " << use_cache;
+    }
+  }
+}
+
+TEST(ClosedFormPiecesTest, TablesMatchEncoder) {
+  Tiktoken tokenizer;
+  tokenizer.set_closed_form_pieces(false);
+  ASSERT_EQ(
+      tokenizer.load(resource_path("test_tiktoken_tokenizer.model")),
+      Error::Ok);
+  // Every piece is encoded on its own: no regex split, no special tokens
+  const auto encode = [&tokenizer](std::string_view piece) {
+    std::vector<uint64_t> tokens;
+    EXPECT_EQ(
+        tokenizer.visit_pieces(
+            std::string(piece),
+            [&tokens](std::string_view, const auto& piece_tokens, bool) {
+              tokens.insert(
+                  tokens.end(), piece_tokens.begin(), piece_tokens.end());
+            }),
+        Error::Ok);
+    return tokens;
+  };
+  ClosedFormPieces tables;
+  ASSERT_EQ(
+      tables.build(
+          token_lookup(encode),
+          [&encode](std::string_view piece) -> Result<std::vector<uint64_t>> {
+            return encode(piece);
+          }),
+      Error::Ok);
+
+  std::vector<uint64_t> tokens;
+  for (size_t value = 0; value < 1000; ++value) {
+    for (const auto& piece :
+         {std::to_string(value),
+          std::string(value < 10 ? 1 : 0, '0') + std::to_string(value)}) {
+      tokens.clear();
+      ASSERT_TRUE(tables.lookup(piece, tokens)) << piece;
+      EXPECT_EQ(tokens, encode(piece)) << piece;
+    }
+  }
+  std::vector<size_t> lengths;
+  for (size_t n = 1; n <= 300; ++n) {
+    lengths.push_back(n);
+  }
+  // Composed past the verified lengths
+  for (const size_t n : {511, 512, 513, 777, 1024, 1500}) {
+    lengths.push_back(n);
+  }
+  for (const char c : {' ', '\t', '\n', '=', '-', '#'}) {
+    ASSERT_GT(tables.max_run(c), 0) << int(c);
+    for (const size_t n : lengths) {
+      if (n > tables.max_run(c)) {
+        break;
+      }
+      const std::string piece(n, c);
+      tokens.clear();
+      ASSERT_TRUE(tables.lookup(piece, tokens)) << int(c) << " x " << n;
+      EXPECT_EQ(tokens, encode(piece)) << int(c) << " x " << n;
+    }
+  }
+
+  tokens.clear();
+  EXPECT_FALSE(tables.lookup("1234", tokens));
+  EXPECT_FALSE(tables.lookup("12a", tokens));
+  EXPECT_FALSE(tables.lookup(" \n", tokens));
+  EXPECT_FALSE(tables.lookup("aaaa", tokens));
+  EXPECT_FALSE(tables.lookup("", tokens));
+  EXPECT_TRUE(tokens.empty());
+}
+
+TEST(ClosedFormPiecesTest, CompositionIsVerified) {
+  // Runs up to 4 bytes are one token. Runs of " " merge from the left, runs
+  // of "-" from the right, so blocks only compose runs of " ". Other pieces,
+  // digit groups among them, fail to encode.
+  const auto encode =
+      [](std::string_view piece) -> Result<std::vector<uint64_t>> {
+    if (piece.empty() || piece.find_first_not_of(piece[0]) != piece.npos) {
+      return Error::EncodeFailure;
+    }
+    const uint64_t base = static_cast<uint8_t>(piece[0]) * 1000;
+    std::vector<uint64_t> tokens;
+    if (piece[0] == '-') {
+      tokens.push_back(base + piece.size() % 4);
+      tokens.insert(tokens.end(), piece.size() / 4, base + 4);
+      if (piece.size() % 4 == 0) {
+        tokens.erase(tokens.begin());
+      }
+    } else {
+      tokens.insert(tokens.end(), piece.size() / 4, base + 4);
+      if (piece.size() % 4 != 0) {
+        tokens.push_back(base + piece.size() % 4);
+      }
+    }
+    return tokens;
+  };
+  ClosedFormPieces tables;
+  ASSERT_EQ(tables.build(token_lookup(encode), encode), Error::Ok);
+
+  EXPECT_EQ(tables.max_run(' '), std::numeric_limits<size_t>::max());
+  EXPECT_EQ(tables.max_run('-'), ClosedFormPieces::kMinRunTable);
+  EXPECT_EQ(tables.max_run('a'), 0);
+  std::vector<uint64_t> tokens;
+  EXPECT_TRUE(tables.lookup(std::string(1001, ' '), tokens));
+  EXPECT_EQ(tokens, *encode(std::string(1001, ' ')));
+  EXPECT_FALSE(tables.lookup(std::string(17, '-'), tokens));
+  EXPECT_FALSE(tables.lookup("7", tokens));
+}
+
+} // namespace tokenizers
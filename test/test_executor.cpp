@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <gtest/gtest.h>
+
+#include <pytorch/tokenizers/executor.h>
+
+using namespace tokenizers;
+
+namespace {
+
+// Every index of [0, size) is visited exactly once
+void expect_covers(Executor& executor, size_t size, size_t grain) {
+  std::vector<std::atomic<int>> visits(size);
+  executor.parallel_for(size, grain, [&](size_t begin, size_t end) {
+    ASSERT_LT(begin, end);
+    ASSERT_LE(end, size);
+    for (size_t i = begin; i < end; ++i) {
+      visits[i].fetch_add(1);
+    }
+  });
+  for (size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(visits[i].load(), 1) << "index " << i << " of " << size;
+  }
+}
+
+} // namespace
+
+TEST(ExecutorTest, Inline) {
+  InlineExecutor executor;
+  EXPECT_EQ(executor.concurrency(), 1);
+  const auto caller = std::this_thread::get_id();
+  bool ran = false;
+  executor.submit([&] { ran = std::this_thread::get_id() == caller; });
+  EXPECT_TRUE(ran);
+  expect_covers(executor, 0, 1);
+  expect_covers(executor, 1000, 1);
+}
+
+TEST(ExecutorTest, WorkStealingParallelFor) {
+  WorkStealingExecutor executor(4);
+  EXPECT_EQ(executor.concurrency(), 4);
+  for (size_t size : {0, 1, 3, 17, 1000}) {
+    for (size_t grain : {1, 8, 5000}) {
+      expect_covers(executor, size, grain);
+    }
+  }
+}
+
+TEST(ExecutorTest, WorkStealingNested) {
+  // Inner loops run on workers that the outer loop keeps busy
+  WorkStealingExecutor executor(2);
+  std::atomic<size_t> total{0};
+  executor.parallel_for(8, 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      executor.parallel_for(100, 1, [&](size_t inner_begin, size_t inner_end) {
+        total.fetch_add(inner_end - inner_begin);
+      });
+    }
+  });
+  EXPECT_EQ(total.load(), 800);
+}
+
+TEST(ExecutorTest, WorkStealingRunsPendingTasksOnDestruction) {
+  std::atomic<int> count{0};
+  {
+    WorkStealingExecutor executor(2);
+    for (int i = 0; i < 100; ++i) {
+      executor.submit([&executor, &count] {
+        // Submitted from a worker
+        executor.submit([&count] { count.fetch_add(1); });
+        count.fetch_add(1);
+      });
+    }
+  }
+  EXPECT_EQ(count.load(), 200);
+}
+
+TEST(ExecutorTest, Callback) {
+  // A caller-owned pool, here a single thread draining a queue
+  WorkStealingExecutor pool(1);
+  std::atomic<int> submitted{0};
+  CallbackExecutor executor(
+      [&](Executor::Task task) {
+        submitted.fetch_add(1);
+        pool.submit(std::move(task));
+      },
+      3);
+  EXPECT_EQ(executor.concurrency(), 3);
+  expect_covers(executor, 1000, 1);
+  // The calling thread takes part, so two helper tasks are enough
+  EXPECT_EQ(submitted.load(), 2);
+}
+
+TEST(ExecutorTest, DefaultExecutor) {
+  const auto builtin = default_executor();
+  ASSERT_NE(builtin, nullptr);
+  EXPECT_EQ(default_executor(), builtin);
+
+  auto custom = std::make_shared<InlineExecutor>();
+  set_default_executor(custom);
+  EXPECT_EQ(default_executor(), custom);
+  set_default_executor(nullptr);
+  EXPECT_EQ(default_executor(), builtin);
+}
+
+TEST(ExecutorTest, ParallelForParts) {
+  WorkStealingExecutor executor(3);
+  for (size_t size : {0, 2, 10, 1001}) {
+    std::vector<std::pair<size_t, size_t>> ranges(4, {size, size});
+    parallel_for_parts(executor, size, 4, [&](size_t part, size_t b, size_t e) {
+      ranges[part] = {b, e};
+    });
+    // Contiguous, in part order
+    size_t next = 0;
+    for (const auto& [begin, end] : ranges) {
+      EXPECT_EQ(begin, std::min(next, size)) << size;
+      EXPECT_LE(begin, end);
+      next = end;
+    }
+    EXPECT_EQ(next, size);
+  }
+}
@@ -111,6 +111,34 @@ TEST(HFTokenizerTest, TestDecode) {
   }
 }
 
+TEST(HFTokenizerTest, TestEncodeOnlyAndDecodeOnly) {
+  auto path = _get_resource_path("test_hf_tokenizer.json");
+  HFTokenizer reference;
+  ASSERT_EQ(reference.load(path), Error::Ok);
+  const std::string text = "Hello world!";
+  const auto expected = reference.encode(text, 1, 0);
+  ASSERT_TRUE(expected.ok());
+
+  HFTokenizer encoder;
+  encoder.set_mode(TokenizerMode::EncodeOnly);
+  ASSERT_EQ(encoder.load(path), Error::Ok);
+  const auto encoded = encoder.encode(text, 1, 0);
+  ASSERT_TRUE(encoded.ok());
+  EXPECT_EQ(encoded.get(), expected.get());
+  EXPECT_EQ(encoder.decode(1, 8).error(), Error::Unsupported);
+
+  HFTokenizer decoder;
+  decoder.set_mode(TokenizerMode::DecodeOnly);
+  ASSERT_EQ(decoder.load(path), Error::Ok);
+  EXPECT_EQ(decoder.vocab_size(), reference.vocab_size());
+  for (const uint64_t token : expected.get()) {
+    const auto result = decoder.decode(0, token);
+    ASSERT_TRUE(result.ok());
+    EXPECT_EQ(result.get(), reference.decode(0, token).get());
+  }
+  EXPECT_EQ(decoder.encode(text, 1, 0).error(), Error::Unsupported);
+}
+
 // Test that BPE merges are correctly parsed from legacy string format ("a b")
 // This is the standard HuggingFace tokenizer.json format
 TEST(HFTokenizerTest, TestBPEMergeLegacyFormat) {
@@ -287,4 +315,83 @@ TEST(HFTokenizerTest, TestBPEMergeEncode) {
   // verify that merges are parsed and the tokenizer loads successfully.
 }
 
+TEST(HFTokenizerTest, TestRegexStats) {
+  // A Split pattern RE2 compiles, replicated as configured
+  const char* json = R"({
+    "version": "1.0",
+    "model": {
+      "type": "BPE",
+      "vocab": {"a": 0, "b": 1, "c": 2, " ": 3, "ab": 4},
+      "merges": ["a b"]
+    },
+    "normalizer": null,
+    "pre_tokenizer": {
+      "type": "Split",
+      "pattern": {"Regex": "[abc]+| "},
+      "behavior": "Isolated",
+      "invert": false
+    },
+    "added_tokens": []
+  })";
+
+  TempFile tmpfile(json);
+  HFTokenizer tokenizer;
+  RegexOptions options;
+  options.num_replicas = 3;
+  tokenizer.set_regex_options(options);
+  ASSERT_EQ(tokenizer.load(tmpfile.path()), Error::Ok);
+  for (int i = 0; i < 4; ++i) {
+    auto result = tokenizer.encode("abc ab", /*bos=*/0, /*eos=*/0);
+    ASSERT_TRUE(result.ok());
+    EXPECT_EQ(result.get(), std::vector<uint64_t>({4, 2, 3, 4}));
+  }
+
+  const auto stats = tokenizer.regex_stats();
+  EXPECT_GE(stats.replicas, 3);
+  EXPECT_GE(stats.searches, 4);
+}
+
+TEST(HFTokenizerTest, TestSequenceSplitsOnce) {
+  // Metaspace rewrites the text, so the sequence cannot give offsets. The
+  // Split regex must still run once per encode, not once per path tried.
+  const char* json = R"({
+    "version": "1.0",
+    "model": {
+      "type": "BPE",
+      "vocab": {"a": 0, "b": 1, "c": 2, "_": 3, "ab": 4},
+      "merges": ["a b"]
+    },
+    "normalizer": null,
+    "pre_tokenizer": {
+      "type": "Sequence",
+      "pretokenizers": [
+        {
+          "type": "Split",
+          "pattern": {"Regex": "[abc]+| "},
+          "behavior": "Isolated",
+          "invert": false
+        },
+        {
+          "type": "Metaspace",
+          "replacement": "_",
+          "prepend_scheme": "never",
+          "split": false
+        }
+      ]
+    },
+    "added_tokens": []
+  })";
+
+  TempFile tmpfile(json);
+  HFTokenizer tokenizer;
+  ASSERT_EQ(tokenizer.load(tmpfile.path()), Error::Ok);
+  const auto before = tokenizer.regex_stats().searches;
+  for (int i = 0; i < 4; ++i) {
+    auto result = tokenizer.encode("abc ab", /*bos=*/0, /*eos=*/0);
+    ASSERT_TRUE(result.ok());
+    EXPECT_EQ(result.get(), std::vector<uint64_t>({4, 2, 3, 4}));
+  }
+  EXPECT_EQ(tokenizer.regex_stats().searches - before, 4);
+}
+
 } // namespace tokenizers
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "pytorch/tokenizers/native_regex.h"
+#include "pytorch/tokenizers/pcre2_regex.h"
+#include "pytorch/tokenizers/re2_regex.h"
+
+using namespace tokenizers;
+
+namespace {
+
+const std::string kTiktokenPattern =
+    R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+)";
+const std::string kLlama3Pattern =
+    R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+)";
+
+std::vector<std::string> split(const IRegex& regex, const std::string& text) {
+  std::vector<std::string> pieces;
+  for (const auto& match : regex.find_all(text)) {
+    pieces.push_back(text.substr(match.start, match.end - match.start));
+  }
+  return pieces;
+}
+
+const std::vector<std::string> kSamples = {
+    "",
+    "Hello world",
+    "I'm sure they'll say it's what we've got, I'D SAY WE'RE DONE",
+    "  leading and trailing spaces  ",
+    "tabs\tand\fform\vfeeds \t\n\r\n  \n x",
+    "numbers 1 12 123 1234 12345 ٣٤٥٦ ²³",
+    "punctuation!!! ... ?! (parens) [brackets] {braces} @#$%^&*",
+    "mixed 'quotes' and \"double quotes\" don't 'S 'ſ",
+    "Ünïcödé wörds, Ελληνικά, русский текст, עברית, العربية",
+    "中文字符和标点。日本語のテキスト、カタカナ！한국어 문장",
+    "emoji 😀🎉 👍🏽 and 👨‍👩‍👧 families",
+    "no break　ideographic em space",
+    "line one\nline two\r\n\r\nline three\n\n\n",
+    "   \n   ",
+    "ends with spaces   ",
+    "á combining è marks",
+};
+
+// Random text over characters that exercise every branch of the pattern,
+// plus invalid UTF-8
+std::string random_text(std::mt19937& rng, bool invalid_utf8) {
+  static const std::vector<std::string> kAlphabet = {
+      "a",      "Z",        "'",            "s",      "T",  "r",
+      "e",      "l",        "7",            " ",      " ",  "\t",
+      "\n",     "\r",       "\v",           "\f",     "!",  ".",
+      "-",      "\"",       "_",            "$",      "é",  "Ω",
+      "٣",      "²",        "中",           "😀",     "ſ",  "\xc2\xa0",
+      "\xcc\x81", "\xe2\x80\xa8", "\xe3\x80\x80", "\xc2\x85"};
+  static const std::vector<std::string> kInvalid = {
+      "\xff", "\x80", "\xc3", "\xe4\xb8", "\xed\xa0\x80", "\xc0\xaf"};
+  std::uniform_int_distribution<size_t> length(0, 40);
+  std::uniform_int_distribution<size_t> pick(0, kAlphabet.size() - 1);
+  std::uniform_int_distribution<size_t> pick_invalid(0, kInvalid.size() - 1);
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::string text;
+  for (size_t i = 0, n = length(rng); i < n; ++i) {
+    if (invalid_utf8 && percent(rng) < 5) {
+      text += kInvalid[pick_invalid(rng)];
+    } else {
+      text += kAlphabet[pick(rng)];
+    }
+  }
+  return text;
+}
+
+} // namespace
+
+TEST(NativeRegexTest, Cl100kMatchesRe2) {
+  Cl100kRegex native;
+  ASSERT_EQ(native.compile(kTiktokenPattern), Error::Ok);
+  Re2Regex re2;
+  ASSERT_EQ(re2.compile("(" + kTiktokenPattern + ")"), Error::Ok);
+
+  for (const auto& text : kSamples) {
+    EXPECT_EQ(split(native, text), split(re2, text)) << text;
+  }
+  std::mt19937 rng(42);
+  for (int i = 0; i < 2000; ++i) {
+    const std::string text = random_text(rng, /*invalid_utf8=*/true);
+    ASSERT_EQ(split(native, text), split(re2, text)) << text;
+  }
+}
+
+TEST(NativeRegexTest, Cl100kLookaheadMatchesPcre2) {
+  Cl100kRegex native;
+  ASSERT_EQ(native.compile(kLlama3Pattern), Error::Ok);
+  Pcre2Regex pcre2;
+  ASSERT_EQ(pcre2.compile(kLlama3Pattern), Error::Ok);
+
+  for (const auto& text : kSamples) {
+    EXPECT_EQ(split(native, text), split(pcre2, text)) << text;
+  }
+  std::mt19937 rng(7);
+  for (int i = 0; i < 2000; ++i) {
+    const std::string text = random_text(rng, /*invalid_utf8=*/false);
+    ASSERT_EQ(split(native, text), split(pcre2, text)) << text;
+  }
+}
+
+TEST(NativeRegexTest, Cl100kLookahead) {
+  Cl100kRegex native;
+  ASSERT_EQ(native.compile(kLlama3Pattern), Error::Ok);
+  EXPECT_EQ(
+      split(native, "a   b  \n c   "),
+      (std::vector<std::string>{"a", "  ", " b", "  \n", " c", "   "}));
+}
+
+TEST(NativeRegexTest, Cl100kRejectsOtherPatterns) {
+  Cl100kRegex native;
+  EXPECT_EQ(native.compile("\\w+"), Error::RegexFailure);
+  EXPECT_EQ(
+      native.compile(kTiktokenPattern.substr(1)), Error::RegexFailure);
+  EXPECT_EQ(native.compile("(" + kTiktokenPattern + ")"), Error::Ok);
+}
+
+TEST(NativeRegexTest, LiteralMatchesRe2) {
+  const std::vector<std::string> tokens = {
+      "<|begin_of_text|>",
+      "<|end|>",
+      "<|end_of_text|>",
+      "[INST]",
+      "a.b",
+      std::string("nul\0byte", 8)};
+  std::string escaped;
+  std::string quoted;
+  for (const auto& token : tokens) {
+    if (!escaped.empty()) {
+      escaped += "|";
+      quoted += "|";
+    }
+    escaped += IRegex::escape(token);
+    quoted += re2::RE2::QuoteMeta(token);
+  }
+
+  Re2Regex re2;
+  ASSERT_EQ(re2.compile("(" + quoted + ")"), Error::Ok);
+  LiteralRegex from_escape;
+  ASSERT_EQ(from_escape.compile("(" + escaped + ")"), Error::Ok);
+  LiteralRegex from_quote_meta;
+  ASSERT_EQ(from_quote_meta.compile("((" + quoted + "))"), Error::Ok);
+
+  const std::string text = std::string("<|begin_of_text|>[INST] a.b axb ") +
+      "<|end|><|end_of_text|> <|end_of_text| <|<|end|>" +
+      std::string("nul\0byte", 8) + "[INST";
+  const auto expected = split(re2, text);
+  EXPECT_EQ(expected.size(), 7);
+  EXPECT_EQ(split(from_escape, text), expected);
+  EXPECT_EQ(split(from_quote_meta, text), expected);
+}
+
+TEST(NativeRegexTest, LiteralRejectsRegexSyntax) {
+  LiteralRegex literal;
+  EXPECT_EQ(literal.compile("a|b*"), Error::RegexFailure);
+  EXPECT_EQ(literal.compile("\\d+"), Error::RegexFailure);
+  EXPECT_EQ(literal.compile("(a)|(b)"), Error::RegexFailure);
+  EXPECT_EQ(literal.compile("a||b"), Error::RegexFailure);
+  EXPECT_EQ(literal.compile(""), Error::RegexFailure);
+  EXPECT_EQ(literal.compile("a|\\(b\\)"), Error::Ok);
+}
+
+TEST(NativeRegexTest, CreateNativeRegex) {
+  auto cl100k = create_native_regex(kTiktokenPattern);
+  ASSERT_TRUE(cl100k.ok());
+  EXPECT_NE(dynamic_cast<Cl100kRegex*>(cl100k->get()), nullptr);
+
+  auto literal = create_native_regex("(<s>|</s>)");
+  ASSERT_TRUE(literal.ok());
+  EXPECT_NE(dynamic_cast<LiteralRegex*>(literal->get()), nullptr);
+
+  EXPECT_EQ(create_native_regex("[a-z]+").error(), Error::RegexFailure);
+}
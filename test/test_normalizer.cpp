@@ -122,3 +122,206 @@ TEST(NormalizerTest, ConfigBuilder) {
   std::string result = normalizer->normalize(input);
   EXPECT_EQ(result, expected);
 }
+
+TEST(NormalizerTest, UnicodeNormalizationForms) {
+  // "ﬁ" (ligature) + "é" (precomposed) + "e" + U+0301 combining acute
+  const std::string input = "\xEF\xAC\x81\xC3\xA9" "e\xCC\x81";
+  EXPECT_EQ(NFCNormalizer().normalize(input), "\xEF\xAC\x81\xC3\xA9\xC3\xA9");
+  EXPECT_EQ(NFDNormalizer().normalize(input), "\xEF\xAC\x81" "e\xCC\x81" "e\xCC\x81");
+  EXPECT_EQ(NFKCNormalizer().normalize(input), "fi\xC3\xA9\xC3\xA9");
+  EXPECT_EQ(NFKDNormalizer().normalize(input), "fie\xCC\x81" "e\xCC\x81");
+}
+
+TEST(NormalizerTest, UnicodeNormalizationReordersMarks) {
+  // a + U+0301 (ccc 230) + U+0323 (ccc 220) -> ạ́ with the dot below first
+  const std::string input = "a\xCC\x81\xCC\xA3";
+  EXPECT_EQ(NFDNormalizer().normalize(input), "a\xCC\xA3\xCC\x81");
+  EXPECT_EQ(NFCNormalizer().normalize(input), "\xE1\xBA\xA1\xCC\x81");
+}
+
+TEST(NormalizerTest, UnicodeNormalizationHangul) {
+  // 한 decomposes algorithmically into conjoining jamo and back
+  const std::string syllable = "\xED\x95\x9C";
+  const std::string jamo = "\xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB";
+  EXPECT_EQ(NFDNormalizer().normalize(syllable), jamo);
+  EXPECT_EQ(NFCNormalizer().normalize(jamo), syllable);
+}
+
+TEST(NormalizerTest, NormalizeIntoUnchanged) {
+  // Already normalized inputs are reported as unchanged
+  std::string out;
+  EXPECT_FALSE(NFCNormalizer().normalize_into("caf\xC3\xA9 ok", out));
+  EXPECT_FALSE(NFDNormalizer().normalize_into("plain ascii text", out));
+  EXPECT_FALSE(LowercaseNormalizer().normalize_into("already lower", out));
+  EXPECT_FALSE(StripNormalizer().normalize_into("no padding", out));
+  EXPECT_FALSE(StripAccentsNormalizer().normalize_into("cafe", out));
+  EXPECT_FALSE(PrependNormalizer("▁").normalize_into("", out));
+  EXPECT_FALSE(BertNormalizer().normalize_into("hello world", out));
+  EXPECT_TRUE(LowercaseNormalizer().normalize_into("Hello", out));
+  EXPECT_EQ(out, "hello");
+}
+
+TEST(NormalizerTest, LowercaseNormalizer) {
+  LowercaseNormalizer normalizer;
+  // Long enough to exercise the vectorized ASCII path on both sides of a
+  // multi-byte character
+  EXPECT_EQ(
+      normalizer.normalize("THE QUICK BROWN FOX \xC3\x89T\xC3\x89 JUMPS OVER"),
+      "the quick brown fox \xC3\xA9t\xC3\xA9 jumps over");
+  // Capital sigma maps to σ regardless of position, İ expands to i + U+0307
+  EXPECT_EQ(normalizer.normalize("\xCE\xA3\xCE\xA3"), "\xCF\x83\xCF\x83");
+  EXPECT_EQ(normalizer.normalize("\xC4\xB0"), "i\xCC\x87");
+}
+
+TEST(NormalizerTest, StripNormalizer) {
+  EXPECT_EQ(StripNormalizer().normalize("  \t hello  \n"), "hello");
+  EXPECT_EQ(StripNormalizer(true, false).normalize("  hello  "), "hello  ");
+  EXPECT_EQ(StripNormalizer(false, true).normalize("  hello  "), "  hello");
+  // U+3000 ideographic space is whitespace
+  EXPECT_EQ(StripNormalizer().normalize("\xE3\x80\x80hi\xE3\x80\x80"), "hi");
+  EXPECT_EQ(StripNormalizer().normalize("   "), "");
+}
+
+TEST(NormalizerTest, StripAccentsAfterNFD) {
+  auto normalizer = NormalizerConfig("Sequence")
+                        .set_normalizers(
+                            {NormalizerConfig("NFD"),
+                             NormalizerConfig("StripAccents"),
+                             NormalizerConfig("Lowercase")})
+                        .create();
+  EXPECT_EQ(normalizer->normalize("Cr\xC3\xA8me Br\xC3\xBBl\xC3\xA9" "e"), "creme brulee");
+}
+
+TEST(NormalizerTest, PrependNormalizer) {
+  PrependNormalizer normalizer("▁");
+  EXPECT_EQ(normalizer.normalize("hello"), "▁hello");
+  EXPECT_EQ(normalizer.normalize(""), "");
+}
+
+TEST(NormalizerTest, BertNormalizer) {
+  BertNormalizer normalizer;
+  // Control characters are removed, whitespace becomes a space, CJK
+  // ideographs are isolated, accents are stripped and text is lowercased
+  EXPECT_EQ(
+      normalizer.normalize("H\xC3\xA9llo\tW\x01orld\xE4\xBD\xA0\xE5\xA5\xBD"),
+      "hello world \xE4\xBD\xA0  \xE5\xA5\xBD ");
+
+  BertNormalizer keep_case(true, false, false, false);
+  EXPECT_EQ(keep_case.normalize("H\xC3\xA9llo\xE4\xBD\xA0"), "H\xC3\xA9llo\xE4\xBD\xA0");
+}
+
+TEST(NormalizerTest, NewNormalizersFromJson) {
+  auto strip = NormalizerConfig()
+                   .parse_json(
+                       {{"type", "Strip"},
+                        {"strip_left", false},
+                        {"strip_right", true}})
+                   .create();
+  EXPECT_EQ(strip->normalize(" a "), " a");
+
+  auto prepend =
+      NormalizerConfig().parse_json({{"type", "Prepend"}, {"prepend", "▁"}})
+          .create();
+  EXPECT_EQ(prepend->normalize("a"), "▁a");
+
+  auto bert = NormalizerConfig()
+                  .parse_json(
+                      {{"type", "BertNormalizer"},
+                       {"clean_text", true},
+                       {"handle_chinese_chars", true},
+                       {"strip_accents", nullptr},
+                       {"lowercase", false}})
+                  .create();
+  // strip_accents follows lowercase when unset
+  EXPECT_EQ(bert->normalize("\xC3\x89t\xC3\xA9"), "\xC3\x89t\xC3\xA9");
+
+  for (const auto* type : {"NFD", "NFKC", "NFKD", "Lowercase", "StripAccents"}) {
+    EXPECT_NE(NormalizerConfig().parse_json({{"type", type}}).create(), nullptr);
+  }
+}
+
+// Charsmap with \t, \n -> " ", \x01 -> "", U+FF21 -> "A", U+FB01 -> "fi",
+// U+2122 -> "TM", U+2026 -> "...", U+3000 -> " ", U+00E0 -> itself, and
+// U+00E9 and "e" U+0301 to each other
+const char* kPrecompiledCharsmap =
+    "uAMAAAAIAAAAAACAAAAAAAEJAAABAACAAwAAgAAAAAAFAACACjUAAAgAAIALAACACT0AAAAA"
+    "AAAPAACAAAAAABMAAIAAAAAAAAAAABYAAIAAAAAAAAAAABgAAIAAAAAAGwAAgAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABlkAEAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAIEBAgAAAAAAAAAAAAAAAACAHAIAAAAAAAAAAAAAAAAAhAQCAIAEAgCADQIAAAAAAAAA"
+    "AAAAAAAAgQECAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "qa0CAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAKCFAgAAAAAApp0CAAAAAACijQIAAAAAAAAA"
+    "AAC85AIAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAKGBAgAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAArKwCAAAAAADDJAMAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAMwkAwAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA4qwDAOPEAwAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAO/4AwAAIAAgAMOpAMOgAGXMgQAu"
+    "Li4AVE0AIABmaQBBAA==";
+
+// Charsmap with "``" -> "\"" and "`" -> "'"
+const char* kPrecompiledQuotesCharsmap =
+    "jAEAAAAEAAAAAAAAAAAAgAIAAIAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"
+    "AAAAAAAAAAAAAAAAAABgjQEAYIUBACcAIgA=";
+
+Normalizer::Ptr precompiled(const char* charsmap) {
+  return NormalizerConfig()
+      .parse_json({{"type", "Precompiled"}, {"precompiled_charsmap", charsmap}})
+      .create();
+}
+
+TEST(NormalizerTest, PrecompiledNormalizer) {
+  const auto normalizer = precompiled(kPrecompiledCharsmap);
+  EXPECT_EQ(normalizer->normalize("a\tb\nc\x01" "d"), "a b cd");
+  EXPECT_EQ(
+      normalizer->normalize(
+          "\xEF\xBC\xA1\xEF\xAC\x81 \xE2\x84\xA2\xE2\x80\xA6\xE3\x80\x80x"),
+      "Afi TM... x");
+  // Longest match: "e" U+0301 is a key, "e" alone is not
+  EXPECT_EQ(
+      normalizer->normalize("caf\xC3\xA9 cafe\xCC\x81 e"),
+      "cafe\xCC\x81 caf\xC3\xA9 e");
+  // Invalid UTF-8 is copied as it is
+  EXPECT_EQ(normalizer->normalize("\xFF\xC3\tz"), "\xFF\xC3 z");
+
+  // Unmapped text and characters mapped to themselves are not copied
+  std::string out = "stale";
+  EXPECT_FALSE(
+      normalizer->normalize_into("plain \xC3\xA0 text \xF0\x9F\x98\x80", out));
+  EXPECT_TRUE(normalizer->normalize_into("reuse\tthe buffer", out));
+  EXPECT_EQ(out, "reuse the buffer");
+  EXPECT_TRUE(normalizer->normalize_into("\xE2\x80\xA6", out));
+  EXPECT_EQ(out, "...");
+}
+
+TEST(NormalizerTest, PrecompiledNormalizerPrintableAscii) {
+  const auto normalizer = precompiled(kPrecompiledQuotesCharsmap);
+  EXPECT_EQ(normalizer->normalize("``quote` ```"), "\"quote' \"'");
+  std::string out;
+  EXPECT_FALSE(normalizer->normalize_into("no quotes", out));
+}
+
+TEST(NormalizerTest, PrecompiledNormalizerEmptyOrInvalid) {
+  for (const auto& config :
+       {nlohmann::json{{"type", "Precompiled"}, {"precompiled_charsmap", ""}},
+        nlohmann::json{
+            {"type", "Precompiled"}, {"precompiled_charsmap", nullptr}}}) {
+    const auto normalizer = NormalizerConfig().parse_json(config).create();
+    std::string out;
+    EXPECT_FALSE(normalizer->normalize_into("a\tb", out));
+  }
+  // Trie size larger than the charsmap
+  EXPECT_THROW(precompiled("/////w=="), std::runtime_error);
+  EXPECT_THROW(precompiled("not base64"), std::runtime_error);
+}
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <pytorch/tokenizers/piece_cache.h>
+#include <pytorch/tokenizers/tiktoken.h>
+
+using namespace ::testing;
+
+namespace tokenizers {
+
+namespace {
+
+constexpr uint64_t kFingerprint = 0x1234;
+
+// Tokens a piece is cached with in the tests
+std::vector<uint64_t> tokens_of(const std::string& piece) {
+  std::vector<uint64_t> tokens;
+  for (size_t i = 0; i < piece.size() && tokens.size() < 4; i += 3) {
+    tokens.push_back(static_cast<uint8_t>(piece[i]) * 1000 + i);
+  }
+  return tokens;
+}
+
+void insert(PieceCache& cache, const std::string& piece) {
+  const auto tokens = tokens_of(piece);
+  cache.insert(kFingerprint, piece, tokens.data(), tokens.size());
+}
+
+std::string segment_name() {
+  return "/tokenizers-test-" + std::to_string(getpid());
+}
+
+} // namespace
+
+TEST(PieceCacheTest, InsertAndLookup) {
+  auto cache = SharedPieceCache::open("", 64);
+  ASSERT_TRUE(cache.ok());
+  EXPECT_EQ((*cache)->num_slots(), 64);
+
+  std::vector<uint64_t> tokens = {7};
+  EXPECT_FALSE((*cache)->lookup(kFingerprint, "hello", tokens));
+  insert(**cache, "hello");
+  ASSERT_TRUE((*cache)->lookup(kFingerprint, "hello", tokens));
+  // Tokens are appended
+  EXPECT_EQ(tokens.size(), 3);
+  EXPECT_EQ(tokens[0], 7);
+  EXPECT_EQ(
+      std::vector<uint64_t>(tokens.begin() + 1, tokens.end()),
+      tokens_of("hello"));
+
+  // Other models and pieces do not match
+  tokens.clear();
+  EXPECT_FALSE((*cache)->lookup(kFingerprint + 1, "hello", tokens));
+  EXPECT_FALSE((*cache)->lookup(kFingerprint, "hellO", tokens));
+  EXPECT_TRUE(tokens.empty());
+
+  // Entries that do not fit are not stored
+  const std::string long_piece(SharedPieceCache::kMaxPieceBytes + 1, 'x');
+  insert(**cache, long_piece);
+  EXPECT_FALSE((*cache)->lookup(kFingerprint, long_piece, tokens));
+  const std::vector<uint64_t> too_many(SharedPieceCache::kMaxTokens + 1, 1);
+  (*cache)->insert(kFingerprint, "many", too_many.data(), too_many.size());
+  EXPECT_FALSE((*cache)->lookup(kFingerprint, "many", tokens));
+  const uint64_t wide = uint64_t(1) << 40;
+  (*cache)->insert(kFingerprint, "wide", &wide, 1);
+  EXPECT_FALSE((*cache)->lookup(kFingerprint, "wide", tokens));
+
+  const auto stats = (*cache)->stats();
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.inserts, 1);
+  EXPECT_EQ(stats.evictions, 0);
+}
+
+TEST(PieceCacheTest, BoundedCapacityEvictsOldEntries) {
+  auto cache = SharedPieceCache::open("", 8);
+  ASSERT_TRUE(cache.ok());
+  for (int i = 0; i < 1000; ++i) {
+    insert(**cache, "piece" + std::to_string(i));
+  }
+  size_t hits = 0;
+  for (int i = 0; i < 1000; ++i) {
+    const std::string piece = "piece" + std::to_string(i);
+    std::vector<uint64_t> tokens;
+    if ((*cache)->lookup(kFingerprint, piece, tokens)) {
+      EXPECT_EQ(tokens, tokens_of(piece));
+      ++hits;
+    }
+  }
+  EXPECT_LE(hits, 8);
+  EXPECT_GT(hits, 0);
+  EXPECT_GT((*cache)->stats().evictions, 900);
+}
+
+TEST(PieceCacheTest, SharedAcrossProcesses) {
+  const std::string name = segment_name();
+  SharedPieceCache::unlink(name);
+  auto cache = SharedPieceCache::open(name, 1024);
+  ASSERT_TRUE(cache.ok());
+
+  const pid_t child = fork();
+  ASSERT_GE(child, 0);
+  if (child == 0) {
+    auto child_cache = SharedPieceCache::open(name, 1024);
+    if (!child_cache.ok()) {
+      _exit(1);
+    }
+    insert(**child_cache, "from the child");
+    _exit(0);
+  }
+  int status = 0;
+  ASSERT_EQ(waitpid(child, &status, 0), child);
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+
+  std::vector<uint64_t> tokens;
+  ASSERT_TRUE((*cache)->lookup(kFingerprint, "from the child", tokens));
+  EXPECT_EQ(tokens, tokens_of("from the child"));
+
+  // All processes must agree on the geometry
+  EXPECT_EQ(SharedPieceCache::open(name, 2048).error(), Error::LoadFailure);
+  EXPECT_EQ(SharedPieceCache::unlink(name), Error::Ok);
+}
+
+TEST(PieceCacheTest, CorruptedEntriesAreRejected) {
+  const std::string name = segment_name();
+  SharedPieceCache::unlink(name);
+  auto cache = SharedPieceCache::open(name, 64);
+  ASSERT_TRUE(cache.ok());
+  insert(**cache, "victim");
+  std::vector<uint64_t> tokens;
+  ASSERT_TRUE((*cache)->lookup(kFingerprint, "victim", tokens));
+
+  // Map the raw segment: a 128-byte header, then 128-byte slots of a sequence
+  // number and 15 payload words
+  const int fd = shm_open(name.c_str(), O_RDWR, 0);
+  ASSERT_GE(fd, 0);
+  const size_t size = 128 + 64 * 128;
+  auto* bytes = static_cast<uint8_t*>(
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+  close(fd);
+  ASSERT_NE(bytes, MAP_FAILED);
+
+  // Flip a bit in the tokens of every slot
+  for (size_t slot = 0; slot < 64; ++slot) {
+    bytes[128 + slot * 128 + 8 + 9 * 8] ^= 1;
+  }
+  tokens.clear();
+  EXPECT_FALSE((*cache)->lookup(kFingerprint, "victim", tokens));
+  EXPECT_TRUE(tokens.empty());
+  EXPECT_GE((*cache)->stats().rejected_reads, 1);
+
+  // Undo it, but leave the slots looking like a writer is updating them
+  for (size_t slot = 0; slot < 64; ++slot) {
+    bytes[128 + slot * 128 + 8 + 9 * 8] ^= 1;
+    bytes[128 + slot * 128] |= 1;
+  }
+  EXPECT_FALSE((*cache)->lookup(kFingerprint, "victim", tokens));
+  // Writers skip claimed slots rather than wait for them
+  insert(**cache, "other");
+
+  for (size_t slot = 0; slot < 64; ++slot) {
+    bytes[128 + slot * 128] &= ~1;
+  }
+  EXPECT_TRUE((*cache)->lookup(kFingerprint, "victim", tokens));
+  EXPECT_EQ(tokens, tokens_of("victim"));
+
+  munmap(bytes, size);
+  SharedPieceCache::unlink(name);
+}
+
+TEST(PieceCacheTest, ConcurrentReadersAndWriters) {
+  auto cache = SharedPieceCache::open("", 256);
+  ASSERT_TRUE(cache.ok());
+  std::vector<std::thread> threads;
+  std::atomic<size_t> wrong{0};
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < 20000; ++i) {
+        const std::string piece = "p" + std::to_string((i * 7 + t) % 2000);
+        std::vector<uint64_t> tokens;
+        if ((*cache)->lookup(kFingerprint, piece, tokens)) {
+          wrong += tokens != tokens_of(piece);
+        } else {
+          insert(**cache, piece);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(wrong, 0);
+  EXPECT_GT((*cache)->stats().hits, 0);
+}
+
+TEST(PieceCacheTest, TiktokenWithCache) {
+  const std::string path = std::getenv("RESOURCES_PATH") +
+      std::string("/test_tiktoken_tokenizer.model");
+  Tiktoken reference;
+  ASSERT_EQ(reference.load(path), Error::Ok);
+
+  auto cache = SharedPieceCache::open("", 4096);
+  ASSERT_TRUE(cache.ok());
+  Tiktoken tokenizer;
+  EXPECT_EQ(tokenizer.set_piece_cache(*cache), Error::Uninitialized);
+  ASSERT_EQ(tokenizer.load(path), Error::Ok);
+  ASSERT_EQ(tokenizer.set_piece_cache(*cache), Error::Ok);
+
+  const std::string text =
+      "Supercalifragilisticexpialidocious antidisestablishmentarianism, "
+      "pneumonoultramicroscopic 12345 ünïcödé 😀😀 <|begin_of_text|>tokens";
+  const auto expected = reference.encode(text, 1, 1);
+  ASSERT_TRUE(expected.ok());
+  for (int round = 0; round < 2; ++round) {
+    const auto tokens = tokenizer.encode(text, 1, 1);
+    ASSERT_TRUE(tokens.ok());
+    EXPECT_EQ(*tokens, *expected);
+  }
+  const auto stats = (*cache)->stats();
+  EXPECT_GT(stats.inserts, 0);
+  EXPECT_EQ(stats.hits, stats.inserts);
+
+  // A second instance of the same model shares the entries
+  Tiktoken other;
+  ASSERT_EQ(other.load(path), Error::Ok);
+  ASSERT_EQ(other.set_piece_cache(*cache), Error::Ok);
+  const auto tokens = other.encode(text, 1, 1);
+  ASSERT_TRUE(tokens.ok());
+  EXPECT_EQ(*tokens, *expected);
+  EXPECT_EQ((*cache)->stats().hits, 2 * stats.inserts);
+}
+
+} // namespace tokenizers
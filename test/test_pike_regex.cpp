@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "pytorch/tokenizers/pcre2_regex.h"
+#include "pytorch/tokenizers/pike_regex.h"
+
+using namespace tokenizers;
+
+namespace {
+
+const std::vector<std::string> kPatterns = {
+    // Llama 3 / cl100k with lookahead
+    R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+)",
+    // GPT-2
+    R"('s|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+)",
+    // o200k
+    R"([^\r\n\p{L}\p{N}]?[\p{Lu}\p{Lt}\p{Lm}\p{Lo}\p{M}]*[\p{Ll}\p{Lm}\p{Lo}\p{M}]+(?i:'s|'t|'re|'ve|'m|'ll|'d)?|[^\r\n\p{L}\p{N}]?[\p{Lu}\p{Lt}\p{Lm}\p{Lo}\p{M}]+[\p{Ll}\p{Lm}\p{Lo}\p{M}]*(?i:'s|'t|'re|'ve|'m|'ll|'d)?|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n/]*|\s*[\r\n]+|\s+(?!\S)|\s+)",
+    // Qwen 2
+    R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+)",
+    // Lazy and counted quantifiers, scripts and negated properties
+    R"(a+?e|r{2,3}?|l{2}|[\d-]+|\p{Han}+|\P{L}{2}|(?i)[a-k]+)",
+    // Anchors, positive lookahead and hex escapes
+    R"(\s+$|^[\p{L}\p{N}_]+|.+?(?=\s)|\x{4E2D}|[^\x00-\x7F]+)",
+};
+
+std::vector<std::string> split(const IRegex& regex, const std::string& text) {
+  std::vector<std::string> pieces;
+  for (const auto& match : regex.find_all(text)) {
+    pieces.push_back(text.substr(match.start, match.end - match.start));
+  }
+  return pieces;
+}
+
+std::string random_text(std::mt19937& rng) {
+  static const std::vector<std::string> kAlphabet = {
+      "a",   "Z",      "'",      "s",      "S",          "r",
+      "e",   "l",      "k",      "K",      "7",          " ",
+      " ",   "\t",     "\n",     "\r",     "\v",         "!",
+      ".",   "-",      "_",      "é",      "Ω",          "٣",
+      "²",   "中",     "😀",     "ſ",      "\xe2\x84\xaa", "\xc2\xa0",
+      "\xcc\x81", "\xe2\x80\xa8", "\xe3\x80\x80", "\xc2\x85"};
+  std::uniform_int_distribution<size_t> length(0, 40);
+  std::uniform_int_distribution<size_t> pick(0, kAlphabet.size() - 1);
+  std::string text;
+  for (size_t i = 0, n = length(rng); i < n; ++i) {
+    text += kAlphabet[pick(rng)];
+  }
+  return text;
+}
+
+} // namespace
+
+TEST(PikeRegexTest, MatchesPcre2) {
+  std::mt19937 rng(42);
+  for (const auto& pattern : kPatterns) {
+    PikeRegex pike;
+    ASSERT_EQ(pike.compile(pattern), Error::Ok) << pattern;
+    Pcre2Regex pcre2;
+    ASSERT_EQ(pcre2.compile(pattern), Error::Ok) << pattern;
+    for (int i = 0; i < 2000; ++i) {
+      const std::string text = random_text(rng);
+      ASSERT_EQ(split(pike, text), split(pcre2, text))
+          << pattern << " on " << text;
+    }
+  }
+}
+
+TEST(PikeRegexTest, Quantifiers) {
+  PikeRegex greedy;
+  ASSERT_EQ(greedy.compile("<.+>|a{2,3}"), Error::Ok);
+  EXPECT_EQ(
+      split(greedy, "<a><b> aaaaa"),
+      (std::vector<std::string>{"<a><b>", "aaa", "aa"}));
+
+  PikeRegex lazy;
+  ASSERT_EQ(lazy.compile("<.+?>|a{2,3}?"), Error::Ok);
+  EXPECT_EQ(
+      split(lazy, "<a><b> aaaaa"),
+      (std::vector<std::string>{"<a>", "<b>", "aa", "aa"}));
+}
+
+TEST(PikeRegexTest, Lookahead) {
+  PikeRegex regex;
+  ASSERT_EQ(regex.compile(R"(\s+(?!\S)|\s+|\S+)"), Error::Ok);
+  EXPECT_EQ(
+      split(regex, "a   b  \n c   "),
+      (std::vector<std::string>{
+          "a", "  ", " ", "b", "  \n", " ", "c", "   "}));
+}
+
+TEST(PikeRegexTest, CaseInsensitive) {
+  PikeRegex regex;
+  ASSERT_EQ(regex.compile("(?i:'s|'k)"), Error::Ok);
+  // Including the two non-ASCII code points that fold to ASCII letters
+  EXPECT_EQ(
+      split(regex, "'s 'S 'ſ 'k 'K '\xe2\x84\xaa 'x"),
+      (std::vector<std::string>{
+          "'s", "'S", "'ſ", "'k", "'K", "'\xe2\x84\xaa"}));
+}
+
+TEST(PikeRegexTest, InvalidUtf8NeverMatches) {
+  PikeRegex regex;
+  ASSERT_EQ(regex.compile("[^a]+"), Error::Ok);
+  EXPECT_EQ(
+      split(regex, "b\xff\xc3z"), (std::vector<std::string>{"b", "z"}));
+}
+
+TEST(PikeRegexTest, EmptyMatches) {
+  PikeRegex regex;
+  ASSERT_EQ(regex.compile("x*"), Error::Ok);
+  const auto matches = regex.find_all("a中x");
+  ASSERT_EQ(matches.size(), 3);
+  EXPECT_EQ(matches[0].start, 0);
+  EXPECT_EQ(matches[0].end, 0);
+  // Steps over whole code points
+  EXPECT_EQ(matches[1].start, 1);
+  EXPECT_EQ(matches[1].end, 1);
+  EXPECT_EQ(matches[2].start, 4);
+  EXPECT_EQ(matches[2].end, 5);
+}
+
+TEST(PikeRegexTest, LongInputs) {
+  // Backtracking engines recurse per repetition here
+  PikeRegex regex;
+  ASSERT_EQ(regex.compile(kPatterns[1]), Error::Ok);
+  const std::string text = std::string(1 << 20, ' ') + "x";
+  const auto matches = regex.find_all(text);
+  ASSERT_EQ(matches.size(), 2);
+  EXPECT_EQ(matches[0].start, 0);
+  EXPECT_EQ(matches[0].end, text.size() - 2);
+  EXPECT_EQ(matches[1].start, text.size() - 2);
+  EXPECT_EQ(matches[1].end, text.size());
+}
+
+TEST(PikeRegexTest, RejectsUnsupportedSyntax) {
+  for (const std::string pattern :
+       {"(a)\\1",
+        "(?<=a)b",
+        "\\bfoo",
+        "a++",
+        "a**",
+        "[[:alpha:]]",
+        "(?!ab)",
+        "(?=a|b)",
+        "(?i)é",
+        "(?i)\\p{L}",
+        "\\p{Foo}",
+        "a{2000}",
+        "(a",
+        "a)",
+        "[a",
+        "*a",
+        "(?x)a"}) {
+    PikeRegex regex;
+    EXPECT_EQ(regex.compile(pattern), Error::RegexFailure) << pattern;
+  }
+}
+
+TEST(PikeRegexTest, CreateRegex) {
+  ASSERT_NE(get_regex_engine(RegexEngine::Pike), nullptr);
+  RegexOptions options;
+  options.engine = RegexEngine::Pike;
+  auto regex = create_regex(kPatterns[0], options);
+  ASSERT_TRUE(regex.ok());
+  EXPECT_NE(dynamic_cast<PikeRegex*>(regex->get()), nullptr);
+  EXPECT_EQ(create_regex("(a)\\1", options).error(), Error::RegexFailure);
+
+  auto created = create_pike_regex("\\p{L}+");
+  ASSERT_TRUE(created.ok());
+  EXPECT_EQ(
+      split(**created, "Hello, wörld"),
+      (std::vector<std::string>{"Hello", "wörld"}));
+}
@@ -84,6 +84,15 @@ TEST_F(ByteLevelPreTokenizerTest, PreTokenizeNoPrefix) {
   assert_split_match(ptok, "Hello World", {"Hello", "ĠWorld"});
 }
 
+TEST_F(ByteLevelPreTokenizerTest, PreTokenizeWhitespaceRuns) {
+  ByteLevelPreTokenizer ptok(false);
+  assert_split_match(
+      ptok, "Hello   world\n\n  x", {"Hello", "ĠĠ", "Ġworld", "ĊĊĠ", "Ġx"});
+  // Long runs used to overflow the stack of the std::regex fallback
+  const std::string spaces(1 << 20, ' ');
+  EXPECT_EQ(ptok.pre_tokenize(spaces + "x").size(), 2);
+}
+
 TEST_F(ByteLevelPreTokenizerTest, PreTokenizeCustomRegex) {
   ByteLevelPreTokenizer ptok(false, R"(o)");
   assert_split_match(ptok, "Hello World", {"Hell", "o", "ĠW", "o", "rld"});
@@ -366,23 +375,323 @@ TEST_F(PreTokenizerConfigTest, SplitWithUnsupportedBehavior) {
           .parse_json(json{
               {"type", "Split"},
               {"pattern", {{"String", "-"}}},
-              {"behavior", "MergedWithNext"},
+              {"behavior", "MergedWithSomething"},
               {"invert", false},
           })
           .create(),
       std::runtime_error);
 }
 
+TEST_F(PreTokenizerConfigTest, SplitWithMergedWithNext) {
+  PreTokenizerConfig config;
+  const auto ptok = config
+                        .parse_json(json{
+                            {"type", "Split"},
+                            {"pattern", {{"String", "-"}}},
+                            {"behavior", "MergedWithNext"},
+                        })
+                        .create();
+  assert_split_match(
+      *ptok, "the-final--countdown", {"the", "-final", "-", "-countdown"});
+}
+
+TEST_F(PreTokenizerConfigTest, SplitWithContiguous) {
+  PreTokenizerConfig config;
+  const auto ptok = config
+                        .parse_json(json{
+                            {"type", "Split"},
+                            {"pattern", {{"String", "-"}}},
+                            {"behavior", "Contiguous"},
+                        })
+                        .create();
+  assert_split_match(
+      *ptok, "the-final--countdown", {"the", "-", "final", "--", "countdown"});
+}
+
 TEST_F(PreTokenizerConfigTest, SplitWithInvertTrue) {
   PreTokenizerConfig config;
+  const auto ptok = config
+                        .parse_json(json{
+                            {"type", "Split"},
+                            {"pattern", {{"String", "-"}}},
+                            {"behavior", "MergedWithPrevious"},
+                            {"invert", true},
+                        })
+                        .create();
+  // The text between the delimiters is merged into the previous delimiter
+  assert_split_match(
+      *ptok, "-the-final--countdown", {"-the", "-final", "-", "-countdown"});
+}
+
+TEST_F(PreTokenizerConfigTest, SplitRegexWithInvertRemoved) {
+  PreTokenizerConfig config;
+  const auto ptok = config
+                        .parse_json(json{
+                            {"type", "Split"},
+                            {"pattern", {{"Regex", R"(\d+)"}}},
+                            {"behavior", "Removed"},
+                            {"invert", true},
+                        })
+                        .create();
+  assert_split_match(*ptok, "ab12cd345", {"12", "345"});
+}
+
+// WhitespacePreTokenizer //////////////////////////////////////////////////////
+class WhitespacePreTokenizerTest : public ::testing::Test {};
+
+TEST_F(WhitespacePreTokenizerTest, PreTokenize) {
+  WhitespacePreTokenizer ptok;
+  assert_split_match(
+      ptok,
+      "Hey man!  How are you?!",
+      {"Hey", "man", "!", "How", "are", "you", "?!"});
+  // Marks, digits and connector punctuation are word characters
+  assert_split_match(
+      ptok,
+      "café n\xcc\x83" "o snake_case42 こんにちは。",
+      {"café",
+       "n\xcc\x83" "o",
+       "snake_case42",
+       "こんにちは",
+       "。"});
+  // Non-ASCII whitespace separates words
+  assert_split_match(ptok, "a b　c", {"a", "b", "c"});
+  assert_split_match(ptok, "   ", {});
+}
+
+TEST_F(WhitespacePreTokenizerTest, WhitespaceSplit) {
+  WhitespaceSplitPreTokenizer ptok;
+  assert_split_match(
+      ptok, "Hey man!  How are\tyou?!\n", {"Hey", "man!", "How", "are", "you?!"});
+  assert_split_match(ptok, "", {});
+}
+
+// PunctuationPreTokenizer /////////////////////////////////////////////////////
+class PunctuationPreTokenizerTest : public ::testing::Test {};
+
+TEST_F(PunctuationPreTokenizerTest, Isolated) {
+  PunctuationPreTokenizer ptok;
+  // ASCII symbols count as punctuation, like in tokenizers
+  assert_split_match(
+      ptok,
+      "Hey friend!     How are you?!?$",
+      {"Hey friend", "!", "     How are you", "?", "!", "?", "$"});
+  assert_split_match(
+      ptok, "¿Qué」", {"¿", "Qué", "」"});
+}
+
+TEST_F(PunctuationPreTokenizerTest, Behaviors) {
+  assert_split_match(
+      PunctuationPreTokenizer(SplitDelimiterBehavior::Removed),
+      "a,b..c",
+      {"a", "b", "c"});
+  assert_split_match(
+      PunctuationPreTokenizer(SplitDelimiterBehavior::Contiguous),
+      "a,b..c",
+      {"a", ",", "b", "..", "c"});
+  assert_split_match(
+      PunctuationPreTokenizer(SplitDelimiterBehavior::MergedWithPrevious),
+      "a,b..c",
+      {"a,", "b.", ".", "c"});
+}
+
+// CharDelimiterSplitPreTokenizer //////////////////////////////////////////////
+class CharDelimiterSplitPreTokenizerTest : public ::testing::Test {};
+
+TEST_F(CharDelimiterSplitPreTokenizerTest, PreTokenize) {
+  CharDelimiterSplitPreTokenizer ptok("x");
+  assert_split_match(ptok, "helloxthere", {"hello", "there"});
+  assert_split_match(ptok, "xhelloxxthere", {"hello", "there"});
+
+  CharDelimiterSplitPreTokenizer utf8_ptok("▁");
+  assert_split_match(
+      utf8_ptok, "▁hello▁there▁", {"hello", "there"});
+
+  EXPECT_THROW(CharDelimiterSplitPreTokenizer(""), std::runtime_error);
+  EXPECT_THROW(CharDelimiterSplitPreTokenizer("ab"), std::runtime_error);
+}
+
+// UnicodeScriptsPreTokenizer //////////////////////////////////////////////////
+class UnicodeScriptsPreTokenizerTest : public ::testing::Test {};
+
+TEST_F(UnicodeScriptsPreTokenizerTest, PreTokenize) {
+  UnicodeScriptsPreTokenizer ptok;
+  // Kana is grouped with Han and spaces never split
+  assert_split_match(
+      ptok,
+      "どこで生れ。Yes",
+      {"どこで生れ", "。", "Yes"});
+  assert_split_match(
+      ptok,
+      "カード Hello world",
+      {"カード ", "Hello world"});
+  assert_split_match(ptok, "Hello, world", {"Hello", ", ", "world"});
+  assert_split_match(
+      ptok, "Привет world",
+      {"Привет ", "world"});
+}
+
+// BertPreTokenizer ////////////////////////////////////////////////////////////
+class BertPreTokenizerTest : public ::testing::Test {};
+
+TEST_F(BertPreTokenizerTest, PreTokenize) {
+  BertPreTokenizer ptok;
+  assert_split_match(
+      ptok,
+      "Hey friend!     How are you?!?",
+      {"Hey", "friend", "!", "How", "are", "you", "?", "!", "?"});
+  assert_split_match(
+      ptok,
+      "don't　stop。",
+      {"don", "'", "t", "stop", "。"});
+}
+
+// MetaspacePreTokenizer ///////////////////////////////////////////////////////
+class MetaspacePreTokenizerTest : public ::testing::Test {};
+
+TEST_F(MetaspacePreTokenizerTest, PreTokenize) {
+  MetaspacePreTokenizer ptok;
+  assert_split_match(
+      ptok, "Hey friend!", {"▁Hey", "▁friend!"});
+  assert_split_match(
+      ptok, " Hey  friend!", {"▁Hey", "▁", "▁friend!"});
+  assert_split_match(ptok, "▁Hey", {"▁Hey"});
+  assert_split_match(ptok, "", {});
+}
+
+TEST_F(MetaspacePreTokenizerTest, Options) {
+  assert_split_match(
+      MetaspacePreTokenizer(
+          "▁", MetaspacePreTokenizer::PrependScheme::Never, true),
+      "Hey friend!",
+      {"Hey", "▁friend!"});
+  assert_split_match(
+      MetaspacePreTokenizer(
+          "_", MetaspacePreTokenizer::PrependScheme::Always, false),
+      "Hey friend!",
+      {"_Hey_friend!"});
+  EXPECT_THROW(MetaspacePreTokenizer(""), std::runtime_error);
+}
+
+// Offsets /////////////////////////////////////////////////////////////////////
+class PreTokenizerOffsetsTest : public ::testing::Test {};
+
+TEST_F(PreTokenizerOffsetsTest, SplittingPreTokenizers) {
+  const std::string input = "Hello, world 42!";
+  std::vector<Match> offsets;
+  ASSERT_TRUE(WhitespacePreTokenizer().pre_tokenize_offsets(input, offsets));
+  ASSERT_EQ(offsets.size(), 5);
+  EXPECT_EQ(offsets[1].start, 5);
+  EXPECT_EQ(offsets[1].end, 6);
+  EXPECT_EQ(offsets[4].start, 15);
+  EXPECT_EQ(offsets[4].end, 16);
+
+  // Offsets are appended
+  ASSERT_TRUE(BertPreTokenizer().pre_tokenize_offsets(input, offsets));
+  EXPECT_EQ(offsets.size(), 10);
+
+  // Rewriting pre-tokenizers do not support offsets
+  offsets.clear();
+  EXPECT_FALSE(MetaspacePreTokenizer().pre_tokenize_offsets(input, offsets));
+  EXPECT_FALSE(ByteLevelPreTokenizer().pre_tokenize_offsets(input, offsets));
+  EXPECT_TRUE(offsets.empty());
+  EXPECT_TRUE(WhitespacePreTokenizer().supports_offsets());
+  EXPECT_FALSE(MetaspacePreTokenizer().supports_offsets());
+  EXPECT_FALSE(ByteLevelPreTokenizer().supports_offsets());
+}
+
+TEST_F(PreTokenizerOffsetsTest, Sequence) {
+  SequencePreTokenizer ptok(
+      {PreTokenizer::Ptr(new WhitespaceSplitPreTokenizer()),
+       PreTokenizer::Ptr(new PunctuationPreTokenizer()),
+       PreTokenizer::Ptr(new DigitsPreTokenizer(true))});
+  const std::string input = "Call me at 555-12, ok?";
+  std::vector<Match> offsets;
+  EXPECT_TRUE(ptok.supports_offsets());
+  ASSERT_TRUE(ptok.pre_tokenize_offsets(input, offsets));
+  std::vector<std::string> pieces;
+  for (const auto& offset : offsets) {
+    pieces.push_back(input.substr(offset.start, offset.end - offset.start));
+  }
+  const std::vector<std::string> expected = {
+      "Call", "me", "at", "5", "5", "5", "-", "1", "2", ",", "ok", "?"};
+  EXPECT_EQ(pieces, expected);
+  assert_split_match(ptok, input, expected);
+
+  // A rewriting step makes the whole sequence fall back to strings
+  SequencePreTokenizer mixed(
+      {PreTokenizer::Ptr(new WhitespaceSplitPreTokenizer()),
+       PreTokenizer::Ptr(new MetaspacePreTokenizer())});
+  offsets.clear();
+  EXPECT_FALSE(mixed.supports_offsets());
+  EXPECT_FALSE(mixed.pre_tokenize_offsets(input, offsets));
+  assert_split_match(
+      mixed, "a b", {"▁a", "▁b"});
+}
+
+TEST_F(PreTokenizerConfigTest, NewTypesFromJson) {
+  assert_split_match(
+      *PreTokenizerConfig().parse_json(json{{"type", "Whitespace"}}).create(),
+      "a, b",
+      {"a", ",", "b"});
+  assert_split_match(
+      *PreTokenizerConfig()
+           .parse_json(json{{"type", "WhitespaceSplit"}})
+           .create(),
+      "a, b",
+      {"a,", "b"});
+  assert_split_match(
+      *PreTokenizerConfig()
+           .parse_json(json{{"type", "Punctuation"}, {"behavior", "Removed"}})
+           .create(),
+      "a, b",
+      {"a", " b"});
+  assert_split_match(
+      *PreTokenizerConfig()
+           .parse_json(json{{"type", "CharDelimiterSplit"}, {"delimiter", ","}})
+           .create(),
+      "a, b",
+      {"a", " b"});
+  assert_split_match(
+      *PreTokenizerConfig()
+           .parse_json(json{{"type", "UnicodeScripts"}})
+           .create(),
+      "a, b",
+      {"a", ", ", "b"});
+  assert_split_match(
+      *PreTokenizerConfig()
+           .parse_json(json{{"type", "BertPreTokenizer"}})
+           .create(),
+      "a, b",
+      {"a", ",", "b"});
+  assert_split_match(
+      *PreTokenizerConfig()
+           .parse_json(json{
+               {"type", "Metaspace"},
+               {"replacement", "▁"},
+               {"prepend_scheme", "first"},
+               {"split", false},
+           })
+           .create(),
+      "a, b",
+      {"▁a,▁b"});
+  // Legacy Metaspace config
+  assert_split_match(
+      *PreTokenizerConfig()
+           .parse_json(json{
+               {"type", "Metaspace"},
+               {"replacement", "▁"},
+               {"add_prefix_space", false},
+           })
+           .create(),
+      "a, b",
+      {"a,", "▁b"});
+
   EXPECT_THROW(
-      config
-          .parse_json(json{
-              {"type", "Split"},
-              {"pattern", {{"String", "-"}}},
-              {"behavior", "MergedWithPrevious"},
-              {"invert", true},
-          })
+      PreTokenizerConfig()
+          .parse_json(json{{"type", "Metaspace"}, {"prepend_scheme", "bad"}})
           .create(),
       std::runtime_error);
+  EXPECT_THROW(
+      PreTokenizerConfig("CharDelimiterSplit").create(), std::runtime_error);
 }
@@ -47,6 +47,7 @@ class TestPythonBindings(unittest.TestCase):
         self.assertTrue(hasattr(pytorch_tokenizers.Error, "ParseFailure"))
         self.assertTrue(hasattr(pytorch_tokenizers.Error, "DecodeFailure"))
         self.assertTrue(hasattr(pytorch_tokenizers.Error, "RegexFailure"))
+        self.assertTrue(hasattr(pytorch_tokenizers.Error, "Unsupported"))
 
     def test_tokenizer_creation(self):
         """Test that tokenizers can be created"""
@@ -129,3 +130,24 @@ class TestPythonBindings(unittest.TestCase):
         eos_token = hf_tokenizer.eos_tok()
         self.assertIsInstance(bos_token, int)
         self.assertIsInstance(eos_token, int)
+
+    def test_encode_bytes_like_input(self):
+        """Test that encode takes str, bytes and bytes-like input alike"""
+        tokenizer_path = os.path.join(
+            os.path.dirname(__file__), "resources/test_hf_tokenizer.json"
+        )
+        hf_tokenizer = pytorch_tokenizers.CppHFTokenizer()
+        hf_tokenizer.load(tokenizer_path)
+
+        text = "Hello world! ünïcödé"
+        expected = hf_tokenizer.encode(text, 1, 0)
+        data = text.encode("utf-8")
+        self.assertEqual(hf_tokenizer.encode(data, 1, 0), expected)
+        self.assertEqual(hf_tokenizer.encode(bytearray(data), 1, 0), expected)
+        self.assertEqual(hf_tokenizer.encode(memoryview(data), 1, 0), expected)
+        # A slice of a larger buffer
+        padded = memoryview(b"xx" + data + b"yy")[2:-2]
+        self.assertEqual(hf_tokenizer.encode(padded, 1, 0), expected)
+
+        with self.assertRaises(TypeError):
+            hf_tokenizer.encode(42, 1, 0)
@@ -8,6 +8,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 #include "pytorch/tokenizers/pcre2_regex.h"
 #include "pytorch/tokenizers/re2_regex.h"
 #include "pytorch/tokenizers/regex.h"
@@ -105,3 +108,63 @@ TEST_F(RegexTest, ComplexPatternWithNegativeLookahead) {
       text.substr(matches[5].start, matches[5].end - matches[5].start),
       " test");
 }
+
+// Test that replicas give the same matches and spread threads across them
+TEST_F(RegexTest, Re2Replicas) {
+  RegexOptions options;
+  options.num_replicas = 4;
+  auto regex = TK_UNWRAP_THROW(create_regex("\\w+", options));
+  ASSERT_NE(dynamic_cast<Re2Regex*>(regex.get()), nullptr);
+  EXPECT_EQ(regex->stats().replicas, 4);
+
+  const std::string text = "the quick brown fox";
+  std::vector<std::thread> threads;
+  std::atomic<int> failures{0};
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < 100; ++j) {
+        auto matches = regex->find_all(text);
+        if (matches.size() != 4 || matches[3].start != 16 ||
+            matches[3].end != 19) {
+          failures.fetch_add(1);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(failures.load(), 0);
+  EXPECT_EQ(regex->stats().searches, 800);
+}
+
+// Test that a small DFA budget shows up as cache resets in the stats
+TEST_F(RegexTest, Re2DfaCacheResets) {
+  const std::string pattern = "[^\\r\\n\\p{L}\\p{N}]?\\p{L}+|\\p{N}{1,3}";
+  std::string text;
+  for (uint32_t cp = 0x4E00; cp < 0x5E00; ++cp) {
+    // Encode CJK ideographs so the DFA has to build many distinct states
+    text += static_cast<char>(0xE0 | (cp >> 12));
+    text += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+    text += static_cast<char>(0x80 | (cp & 0x3F));
+    text += ' ';
+  }
+
+  RegexOptions small;
+  small.max_mem = 64 << 10;
+  auto constrained = TK_UNWRAP_THROW(create_regex(pattern, small));
+  auto unconstrained = TK_UNWRAP_THROW(create_regex(pattern));
+
+  const auto expected = unconstrained->find_all(text);
+  const auto matches = constrained->find_all(text);
+  ASSERT_EQ(matches.size(), expected.size());
+  for (size_t i = 0; i < matches.size(); ++i) {
+    EXPECT_EQ(matches[i].start, expected[i].start);
+    EXPECT_EQ(matches[i].end, expected[i].end);
+  }
+
+  const auto stats = constrained->stats();
+  EXPECT_EQ(stats.searches, 1);
+  EXPECT_GT(stats.dfa_cache_resets + stats.dfa_search_failures, 0);
+  EXPECT_EQ(unconstrained->stats().dfa_cache_resets, 0);
+}
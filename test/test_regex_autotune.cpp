@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <pytorch/tokenizers/pcre2_regex.h>
+#include <pytorch/tokenizers/regex_autotune.h>
+#include <pytorch/tokenizers/tiktoken.h>
+#include <pytorch/tokenizers/warm_start.h>
+
+using namespace ::testing;
+
+namespace tokenizers {
+
+namespace {
+
+// The RE2 spelling of the cl100k pattern, which the native scanner handles
+const std::string kCl100kPattern =
+    R"((?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+)";
+
+const RegexEngineTiming* find_timing(
+    const RegexAutotuneResult& result,
+    RegexEngine engine) {
+  for (const auto& timing : result.timings) {
+    if (timing.engine == engine) {
+      return &timing;
+    }
+  }
+  return nullptr;
+}
+
+// Finds nothing, quickly
+class NoMatchRegex : public IRegex {
+ public:
+  Error compile(const std::string&) override {
+    return Error::Ok;
+  }
+
+  std::vector<Match> find_all(std::string_view) const override {
+    return {};
+  }
+};
+
+Result<std::unique_ptr<IRegex>> create_no_match_regex(
+    const std::string&,
+    const RegexOptions&) {
+  return std::unique_ptr<IRegex>(new NoMatchRegex());
+}
+
+} // namespace
+
+TEST(RegexAutotuneTest, BenchmarksEveryEngine) {
+  const auto result = autotune_regex(kCl100kPattern);
+  ASSERT_TRUE(result.ok());
+  EXPECT_FALSE(result->from_cache);
+  for (const auto engine : {RegexEngine::Native, RegexEngine::RE2}) {
+    const auto* timing = find_timing(*result, engine);
+    ASSERT_NE(timing, nullptr) << regex_engine_name(engine);
+    EXPECT_TRUE(timing->agrees) << regex_engine_name(engine);
+    EXPECT_GT(timing->nanos_per_byte, 0);
+  }
+  const auto* chosen = find_timing(*result, result->engine);
+  ASSERT_NE(chosen, nullptr);
+  EXPECT_TRUE(chosen->agrees);
+  for (const auto& timing : result->timings) {
+    if (timing.agrees) {
+      EXPECT_LE(chosen->nanos_per_byte, timing.nanos_per_byte);
+    }
+  }
+}
+
+TEST(RegexAutotuneTest, RejectsEnginesThatDisagree) {
+  const auto std_engine = get_regex_engine(RegexEngine::Std);
+  register_regex_engine(RegexEngine::Std, create_no_match_regex);
+  const auto result = autotune_regex("\\w+", {"some words to match"});
+  register_regex_engine(RegexEngine::Std, std_engine);
+
+  ASSERT_TRUE(result.ok());
+  const auto* timing = find_timing(*result, RegexEngine::Std);
+  ASSERT_NE(timing, nullptr);
+  EXPECT_FALSE(timing->agrees);
+  EXPECT_NE(result->engine, RegexEngine::Std);
+  // The native scanners do not handle this pattern
+  EXPECT_EQ(find_timing(*result, RegexEngine::Native), nullptr);
+}
+
+TEST(RegexAutotuneTest, ExplicitEngine) {
+  RegexOptions options;
+  options.engine = RegexEngine::PCRE2;
+  auto regex = create_regex("\\w+", options);
+  ASSERT_TRUE(regex.ok());
+  EXPECT_NE(dynamic_cast<Pcre2Regex*>(regex->get()), nullptr);
+
+  options.engine = RegexEngine::Native;
+  EXPECT_EQ(create_regex("\\w+", options).error(), Error::RegexFailure);
+}
+
+TEST(RegexAutotuneTest, CachesTheChoice) {
+  const std::string path = std::tmpnam(nullptr);
+  RegexOptions options;
+  options.autotune = true;
+  options.autotune_cache = path;
+
+  const auto tuned = autotune_regex(kCl100kPattern, {}, options);
+  ASSERT_TRUE(tuned.ok());
+  EXPECT_FALSE(tuned->from_cache);
+  const auto cached = autotune_regex(kCl100kPattern, {}, options);
+  ASSERT_TRUE(cached.ok());
+  EXPECT_TRUE(cached->from_cache);
+  EXPECT_EQ(cached->engine, tuned->engine);
+  EXPECT_TRUE(cached->timings.empty());
+
+  // Other patterns are tuned and recorded next to it
+  ASSERT_TRUE(autotune_regex("[0-9]+", {"a 123 b 4"}, options).ok());
+  EXPECT_TRUE(autotune_regex(kCl100kPattern, {}, options)->from_cache);
+  EXPECT_TRUE(autotune_regex("[0-9]+", {}, options)->from_cache);
+
+  auto regex = create_regex(kCl100kPattern, options);
+  ASSERT_TRUE(regex.ok());
+  const auto matches = (*regex)->find_all("Hello world's 12345");
+  EXPECT_EQ(matches.size(), 6);
+  std::remove(path.c_str());
+  std::remove((path + ".lock").c_str());
+}
+
+TEST(RegexAutotuneTest, ConcurrentTunersKeepEveryChoice) {
+  const std::string path = std::tmpnam(nullptr);
+  RegexOptions options;
+  options.autotune = true;
+  options.autotune_cache = path;
+
+  std::vector<std::string> patterns;
+  for (int i = 1; i <= 8; ++i) {
+    patterns.push_back("[0-9]{" + std::to_string(i) + "}");
+  }
+  std::vector<std::thread> threads;
+  for (const auto& pattern : patterns) {
+    threads.emplace_back([&pattern, &options] {
+      EXPECT_TRUE(autotune_regex(pattern, {"a 12345678 b"}, options).ok());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& pattern : patterns) {
+    EXPECT_TRUE(autotune_regex(pattern, {}, options)->from_cache) << pattern;
+  }
+  std::remove(path.c_str());
+  std::remove((path + ".lock").c_str());
+}
+
+TEST(RegexAutotuneTest, TokenizerEncodesTheSame) {
+  const std::string model = std::getenv("RESOURCES_PATH") +
+      std::string("/test_tiktoken_tokenizer.model");
+  Tiktoken reference;
+  ASSERT_EQ(reference.load(model), Error::Ok);
+  Tiktoken tuned;
+  RegexOptions options;
+  options.autotune = true;
+  tuned.set_regex_options(options);
+  ASSERT_EQ(tuned.load(model), Error::Ok);
+
+  for (const auto& text : warm_start_corpus()) {
+    EXPECT_EQ(*tuned.encode(text, 1, 1), *reference.encode(text, 1, 1));
+  }
+}
+
+} // namespace tokenizers
@@ -26,6 +26,8 @@ using namespace ::testing;
 using ::base64::decode;
 using ::tokenizers::Error;
 using ::tokenizers::Result;
+using ::tokenizers::detail::MapDirection;
+using ::tokenizers::detail::MapProbeBound;
 using ::tokenizers::detail::StringIntegerMap;
 using ::tokenizers::detail::StringIntegerMapTypeBuilder;
 using TokenizerMap = std::unordered_map<std::string, std::uint64_t>;
@@ -194,6 +196,122 @@ TEST_F(StringIntegerMapTest, CreateFromModel) {
   }
 }
 
+TEST_F(StringIntegerMapTest, BatchedLookup) {
+  const auto res = loadModel();
+  ASSERT_EQ(res.ok(), true);
+  const auto& model = res.get();
+  StringIntegerMap map(model);
+
+  // More keys than one internal batch, with misses mixed in
+  std::vector<std::string> keys;
+  for (const auto& [model_key, model_value] : model) {
+    keys.push_back(model_key);
+    if (keys.size() % 3 == 0) {
+      keys.push_back(model_key + "\xff\xfe");
+    }
+    if (keys.size() >= 100) {
+      break;
+    }
+  }
+  std::vector<std::string_view> views(keys.begin(), keys.end());
+  std::vector<std::optional<std::uint64_t>> results(views.size());
+  map.tryGetIntegers(views.data(), views.size(), results.data());
+  for (std::size_t i = 0; i < views.size(); ++i) {
+    EXPECT_EQ(results[i], map.tryGetInteger(views[i])) << views[i];
+  }
+}
+
+TEST_F(StringIntegerMapTest, SingleDirection) {
+  const auto res = loadModel();
+  ASSERT_EQ(res.ok(), true);
+  const auto& model = res.get();
+  StringIntegerMap both(model);
+  StringIntegerMap encode(model, MapDirection::StringToInteger);
+  StringIntegerMap decode(model, MapDirection::IntegerToString);
+  EXPECT_EQ(encode.direction(), MapDirection::StringToInteger);
+  EXPECT_EQ(decode.direction(), MapDirection::IntegerToString);
+
+  for (const auto& [model_key, model_value] : model) {
+    EXPECT_THAT(encode.tryGetInteger(model_key), Optional(model_value));
+    EXPECT_FALSE(encode.tryGetString(model_value));
+    EXPECT_FALSE(decode.tryGetInteger(model_key));
+    EXPECT_THAT(decode.tryGetString(model_value), Optional(model_key));
+  }
+
+  // The elements are visited in the same order in every direction
+  using Elements = std::vector<std::pair<std::string_view, std::uint64_t>>;
+  const auto elements = [](const auto& map) {
+    Elements result;
+    map.forEachElement([&result](std::string_view str, std::uint64_t integer) {
+      result.emplace_back(str, integer);
+    });
+    return result;
+  };
+  const auto both_elements = elements(both);
+  EXPECT_EQ(both_elements.size(), model.size());
+  EXPECT_EQ(elements(encode), both_elements);
+  EXPECT_EQ(elements(decode), both_elements);
+
+  const auto buffer_size = [](const auto& map) {
+    std::size_t size = 0;
+    map.forEachBuffer([&size](const void*, std::size_t buffer_size) {
+      size += buffer_size;
+    });
+    return size;
+  };
+  EXPECT_LT(buffer_size(encode), buffer_size(both));
+  EXPECT_LT(buffer_size(decode), buffer_size(both));
+}
+
+TEST_F(StringIntegerMapTest, BoundedChains) {
+  const auto res = loadModel();
+  ASSERT_EQ(res.ok(), true);
+  const auto& model = res.get();
+  StringIntegerMap map(model);
+
+  for (const auto* stats :
+       {&map.stringChainStats(), &map.integerChainStats()}) {
+    EXPECT_TRUE(stats->bound_met);
+    EXPECT_GE(stats->bucket_count, model.size());
+    EXPECT_LE(stats->max_chain_length, MapProbeBound().max_chain_length);
+    EXPECT_GE(stats->mean_chain_length, 1.0);
+    EXPECT_LE(stats->mean_chain_length, stats->max_chain_length);
+  }
+  EXPECT_EQ(
+      StringIntegerMap(model, MapDirection::StringToInteger)
+          .integerChainStats()
+          .bucket_count,
+      0);
+}
+
+TEST_F(StringIntegerMapTest, RebuildsSpreadStridedIntegers) {
+  // With the identity hash and as many buckets as elements, multiples of the
+  // element count all land in one bucket until the hash is seeded
+  constexpr std::uint64_t kCount = 1000;
+  std::unordered_map<std::string, std::uint64_t> source;
+  for (std::uint64_t i = 0; i < kCount; ++i) {
+    source.emplace(std::to_string(i), i * kCount);
+  }
+
+  MapProbeBound unbounded;
+  unbounded.max_chain_length = 0;
+  StringIntegerMap strided(source, MapDirection::Both, unbounded);
+  EXPECT_EQ(strided.integerChainStats().max_chain_length, kCount);
+  EXPECT_EQ(strided.integerChainStats().rebuilds, 0);
+
+  StringIntegerMap map(source);
+  const auto& stats = map.integerChainStats();
+  EXPECT_TRUE(stats.bound_met);
+  EXPECT_NE(stats.seed, 0);
+  EXPECT_GE(stats.rebuilds, 1);
+  EXPECT_LE(stats.max_chain_length, MapProbeBound().max_chain_length);
+  for (const auto& [str, integer] : source) {
+    EXPECT_THAT(map.tryGetInteger(str), Optional(integer));
+    EXPECT_THAT(map.tryGetString(integer), Optional(std::string_view(str)));
+    EXPECT_FALSE(map.tryGetString(integer + 1));
+  }
+}
+
 #if defined(TEST_MEMORY_COMPARISON) && TEST_MEMORY_COMPARISON
 
 TEST_F(StringIntegerMapTest, MemoryConsumptionComparison) {
@@ -322,3 +440,27 @@ TYPED_TEST(StringIntegerMapHashTest, HashCollisions) {
   EXPECT_FALSE(map.tryGetString(100));
   EXPECT_FALSE(map.tryGetString(1000));
 }
+
+TEST(StringIntegerMapBoundTest, UnmetBound) {
+  // Every string hashes alike, so no layout spreads them
+  using Map = StringIntegerMapTypeBuilder<>::WithStringHash<FixedHash<0>>::Map;
+  std::unordered_map<std::string, std::uint64_t> source = {
+      {"a", 0}, {"b", 1}, {"c", 2}, {"d", 3}};
+  MapProbeBound bound;
+  bound.max_chain_length = 2;
+  bound.seeds_per_bucket_count = 2;
+  bound.max_buckets_per_element = 4;
+  Map map(source, MapDirection::Both, bound);
+
+  const auto& stats = map.stringChainStats();
+  EXPECT_FALSE(stats.bound_met);
+  EXPECT_EQ(stats.max_chain_length, 4);
+  EXPECT_EQ(stats.mean_chain_length, 4.0);
+  // Bucket counts of 1, 2 and 4 per element, two seeds each
+  EXPECT_EQ(stats.rebuilds, 5);
+  EXPECT_EQ(stats.bucket_count, 4);
+  for (const auto& [str, integer] : source) {
+    EXPECT_THAT(map.tryGetInteger(str), Optional(integer));
+  }
+  EXPECT_FALSE(map.tryGetInteger("e"));
+}
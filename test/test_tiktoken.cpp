@@ -93,6 +93,100 @@ TEST_F(TiktokenTest, TestEncode) {
   EXPECT_EQ(out.get()[2], 1917);
 }
 
+TEST_F(TiktokenTest, TestEncodeView) {
+  ASSERT_EQ(tokenizer_->load(modelPath_), Error::Ok);
+  // A view into a larger buffer, not NUL terminated at its end
+  const std::string buffer =
+      "xx<|begin_of_text|>hello world ünïcödé<|end_of_text|> 123yy";
+  const std::string_view view(buffer.data() + 2, buffer.size() - 4);
+  auto out = tokenizer_->encode_view(view, 1, 1);
+  ASSERT_EQ(out.error(), Error::Ok);
+  EXPECT_EQ(out.get(), tokenizer_->encode(std::string(view), 1, 1).get());
+  EXPECT_EQ(out.get().front(), 128000);
+  EXPECT_EQ(out.get().back(), 128001);
+}
+
+TEST_F(TiktokenTest, TestEncodeManySpecialTokens) {
+  Tiktoken tokenizer(kPattern, _get_special_tokens(), 0, 1);
+  ASSERT_EQ(tokenizer.load(modelPath_), Error::Ok);
+  // Text between special tokens is encoded on its own, including none
+  std::string text;
+  std::vector<uint64_t> expected;
+  for (size_t i = 0; i < 300; ++i) {
+    const std::string words =
+        i % 3 == 0 ? "" : " hello world " + std::to_string(i);
+    const std::string special =
+        "<|reserved_special_token_" + std::to_string(i % 50) + "|>";
+    for (const auto& part : {words, special}) {
+      text += part;
+      const auto tokens = tokenizer.encode(part, 0, 0);
+      ASSERT_EQ(tokens.error(), Error::Ok);
+      expected.insert(expected.end(), tokens->begin(), tokens->end());
+    }
+  }
+  text += "the end";
+  const auto tail = tokenizer.encode("the end", 0, 0);
+  expected.insert(expected.end(), tail->begin(), tail->end());
+
+  const auto out = tokenizer.encode(text, 0, 0);
+  ASSERT_EQ(out.error(), Error::Ok);
+  EXPECT_EQ(out.get(), expected);
+
+  std::vector<uint64_t> visited;
+  ASSERT_EQ(
+      tokenizer.visit_pieces(
+          text,
+          [&visited](std::string_view, const auto& tokens, bool) {
+            visited.insert(visited.end(), tokens.begin(), tokens.end());
+          }),
+      Error::Ok);
+  EXPECT_EQ(visited, expected);
+}
+
+TEST_F(TiktokenTest, TestEncodeWithRegexReplicas) {
+#ifdef TOKENIZERS_MINIMAL
+  GTEST_SKIP() << "Replicas are an RE2 option, and RE2 is not built";
+#endif
+  Tiktoken tokenizer(kPattern, _get_special_tokens(), 0, 1);
+  RegexOptions options;
+  options.num_replicas = 2;
+  options.max_mem = 1 << 20;
+  tokenizer.set_regex_options(options);
+  ASSERT_EQ(tokenizer.load(modelPath_), Error::Ok);
+
+  auto out = tokenizer.encode("hello world", 1, 0);
+  ASSERT_EQ(out.error(), Error::Ok);
+  EXPECT_EQ(out.get(), std::vector<uint64_t>({128000, 15339, 1917}));
+
+  // The main pattern and the special token pattern are both replicated
+  const auto stats = tokenizer.regex_stats();
+  EXPECT_EQ(stats.replicas, 4);
+  EXPECT_GE(stats.searches, 2);
+}
+
+TEST_F(TiktokenTest, TestEncodeMergeBatchSizes) {
+  // Rare words and non-ASCII text need many merges per piece
+  const std::string text =
+      "Antidisestablishmentarianism and floccinaucinihilipilification, "
+      "naïve café façade, Привет мир, こんにちは世界, 🤖🚀 123456789 "
+      "hello world hello world\n\n  \tindentation_with_underscores()";
+
+  Tiktoken reference(kPattern, _get_special_tokens(), 0, 1);
+  reference.set_merge_batch_size(1);
+  ASSERT_EQ(reference.load(modelPath_), Error::Ok);
+  const auto expected = reference.encode(text, 1, 1);
+  ASSERT_EQ(expected.error(), Error::Ok);
+
+  for (const size_t batch_size : {2, 3, 8, 64}) {
+    Tiktoken tokenizer(kPattern, _get_special_tokens(), 0, 1);
+    tokenizer.set_merge_batch_size(batch_size);
+    ASSERT_EQ(tokenizer.load(modelPath_), Error::Ok);
+    const auto out = tokenizer.encode(text, 1, 1);
+    ASSERT_EQ(out.error(), Error::Ok);
+    EXPECT_EQ(out.get(), expected.get()) << "batch size " << batch_size;
+  }
+}
+
 TEST_F(TiktokenTest, TestDecode) {
   Error res = tokenizer_->load(modelPath_.c_str());
   EXPECT_EQ(res, Error::Ok);
@@ -105,6 +199,98 @@ TEST_F(TiktokenTest, TestDecode) {
   }
 }
 
+TEST_F(TiktokenTest, TestEncodeOnly) {
+  Tiktoken tokenizer(kPattern, _get_special_tokens(), 0, 1);
+  tokenizer.set_mode(TokenizerMode::EncodeOnly);
+  ASSERT_EQ(tokenizer.load(modelPath_), Error::Ok);
+  ASSERT_EQ(tokenizer_->load(modelPath_), Error::Ok);
+
+  const std::string text = "hello world <|end_of_text|> naïve café";
+  const auto expected = tokenizer_->encode(text, 1, 1);
+  ASSERT_EQ(expected.error(), Error::Ok);
+  const auto out = tokenizer.encode(text, 1, 1);
+  ASSERT_EQ(out.error(), Error::Ok);
+  EXPECT_EQ(out.get(), expected.get());
+
+  EXPECT_EQ(tokenizer.decode(0, 15339).error(), Error::Unsupported);
+
+  size_t size = 0;
+  for (const auto& region : tokenizer.memory_regions()) {
+    size += region.size;
+  }
+  size_t full_size = 0;
+  for (const auto& region : tokenizer_->memory_regions()) {
+    full_size += region.size;
+  }
+  EXPECT_LT(size, full_size);
+}
+
+TEST_F(TiktokenTest, TestDecodeOnly) {
+  Tiktoken tokenizer(kPattern, _get_special_tokens(), 0, 1);
+  tokenizer.set_mode(TokenizerMode::DecodeOnly);
+  ASSERT_EQ(tokenizer.load(modelPath_), Error::Ok);
+  EXPECT_EQ(tokenizer.vocab_size(), 128256);
+  EXPECT_EQ(tokenizer.bos_tok(), 128000);
+
+  std::vector<std::string> expected = {"<|begin_of_text|>", "hello", " world"};
+  std::vector<uint64_t> tokens = {128000, 15339, 1917};
+  for (size_t i = 0; i < tokens.size(); i++) {
+    const auto out = tokenizer.decode(0, tokens[i]);
+    ASSERT_EQ(out.error(), Error::Ok);
+    EXPECT_EQ(out.get(), expected[i]);
+  }
+
+  EXPECT_EQ(tokenizer.encode("hello", 0, 0).error(), Error::Unsupported);
+}
+
+TEST_F(TiktokenTest, TestEncodeUtf16) {
+  Tiktoken tokenizer(kPattern, _get_special_tokens(), 0, 1);
+  ASSERT_EQ(tokenizer.load(modelPath_), Error::Ok);
+
+  // Long ASCII runs, 2 and 3 byte characters, a surrogate pair and an
+  // unpaired surrogate
+  const std::u16string text = u"hello world, this is plain ASCII naïve café "
+                              u"中文 😀😀 <|end_of_text|> done \xD800 end";
+  const std::string utf8 = "hello world, this is plain ASCII naïve café "
+                           "中文 😀😀 <|end_of_text|> done \xEF\xBF\xBD end";
+  const auto expected = tokenizer.encode(utf8, 1, 1);
+  ASSERT_EQ(expected.error(), Error::Ok);
+  const auto out = tokenizer.encode_utf16(text, 1, 1);
+  ASSERT_EQ(out.error(), Error::Ok);
+  EXPECT_EQ(out.get(), expected.get());
+
+  std::vector<size_t> ends;
+  const auto with_offsets = tokenizer.encode_utf16_with_offsets(text, ends);
+  ASSERT_EQ(with_offsets.error(), Error::Ok);
+  ASSERT_EQ(ends.size(), with_offsets->size());
+  EXPECT_EQ(ends.back(), text.size());
+  std::u16string decoded;
+  size_t start = 0;
+  for (size_t i = 0; i < ends.size(); ++i) {
+    ASSERT_LE(start, ends[i]);
+    // Never between the two halves of a surrogate pair
+    ASSERT_FALSE(
+        ends[i] < text.size() && text[ends[i]] >= 0xDC00 &&
+        text[ends[i]] <= 0xDFFF && text[ends[i] - 1] >= 0xD800 &&
+        text[ends[i] - 1] <= 0xDBFF);
+    decoded += text.substr(start, ends[i] - start);
+    start = ends[i];
+  }
+  EXPECT_EQ(decoded, text);
+
+  // On ASCII, code units and bytes coincide
+  const std::string ascii = "The quick brown fox jumps over the lazy dog";
+  std::vector<size_t> byte_ends;
+  ASSERT_EQ(tokenizer.encode_with_offsets(ascii, byte_ends).error(), Error::Ok);
+  ASSERT_EQ(
+      tokenizer
+          .encode_utf16_with_offsets(
+              std::u16string(ascii.begin(), ascii.end()), ends)
+          .error(),
+      Error::Ok);
+  EXPECT_EQ(ends, byte_ends);
+}
+
 TEST_F(TiktokenTest, TokenizerDecodeOutOfRangeFails) {
   Error res = tokenizer_->load(modelPath_.c_str());
   EXPECT_EQ(res, Error::Ok);
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <cstdio>
+#include <fstream>
+
+#include <gtest/gtest.h>
+#include <pytorch/tokenizers/tiktoken.h>
+#include <pytorch/tokenizers/token_profile.h>
+
+using namespace ::testing;
+
+namespace tokenizers {
+
+namespace {
+
+// Deterministic pseudo-random documents over a small vocabulary
+std::vector<std::string> make_corpus(size_t num_documents) {
+  const std::vector<std::string> words = {
+      "the",
+      "tokenizer",
+      "profiles",
+      "pieces",
+      "of",
+      "a",
+      "corpus",
+      "ünïcödé",
+      "😀",
+      "12345",
+      "don't",
+      "<|begin_of_text|>",
+      "\n\n",
+      "  ",
+      "Supercalifragilistic",
+  };
+  uint32_t state = 42;
+  std::vector<std::string> documents;
+  for (size_t d = 0; d < num_documents; ++d) {
+    std::string document;
+    for (int w = 0; w < 30; ++w) {
+      state = state * 1103515245 + 12345;
+      document += words[(state >> 16) % words.size()];
+      document += ' ';
+    }
+    documents.push_back(std::move(document));
+  }
+  return documents;
+}
+
+bool same_profile(const TokenProfile& a, const TokenProfile& b) {
+  if (a.pieces.size() != b.pieces.size() ||
+      a.cache_simulations.size() != b.cache_simulations.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.pieces.size(); ++i) {
+    if (a.pieces[i].piece != b.pieces[i].piece ||
+        a.pieces[i].count != b.pieces[i].count ||
+        a.pieces[i].num_tokens != b.pieces[i].num_tokens) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < a.cache_simulations.size(); ++i) {
+    const auto& x = a.cache_simulations[i];
+    const auto& y = b.cache_simulations[i];
+    if (x.capacity != y.capacity || x.lookups != y.lookups ||
+        x.lru_hits != y.lru_hits || x.static_hits != y.static_hits) {
+      return false;
+    }
+  }
+  return a.num_documents == b.num_documents && a.num_bytes == b.num_bytes &&
+      a.num_pieces == b.num_pieces && a.num_tokens == b.num_tokens &&
+      a.token_counts == b.token_counts &&
+      a.piece_length_histogram == b.piece_length_histogram &&
+      a.merge_count_histogram == b.merge_count_histogram;
+}
+
+} // namespace
+
+class TokenProfileTest : public Test {
+ public:
+  void SetUp() override {
+    ASSERT_EQ(
+        tokenizer_.load(
+            std::getenv("RESOURCES_PATH") +
+            std::string("/test_tiktoken_tokenizer.model")),
+        Error::Ok);
+  }
+
+  Tiktoken tokenizer_;
+};
+
+TEST_F(TokenProfileTest, VisitPiecesMatchesEncode) {
+  const std::string text =
+      "Hello world<|begin_of_text|> supercalifragilistic 12345\n\n ünïcödé";
+  std::vector<uint64_t> tokens;
+  std::string pieces;
+  size_t num_special = 0;
+  ASSERT_EQ(
+      tokenizer_.visit_pieces(
+          text,
+          [&](std::string_view piece,
+              const std::vector<uint64_t>& piece_tokens,
+              bool special) {
+            tokens.insert(
+                tokens.end(), piece_tokens.begin(), piece_tokens.end());
+            pieces += piece;
+            num_special += special;
+          }),
+      Error::Ok);
+  EXPECT_EQ(tokens, *tokenizer_.encode(text, 0, 0));
+  EXPECT_EQ(pieces, text);
+  EXPECT_EQ(num_special, 1);
+}
+
+TEST_F(TokenProfileTest, CountsMatchEncoding) {
+  const auto corpus = make_corpus(50);
+  TokenProfileConfig config;
+  config.num_threads = 3;
+  const auto profile = profile_corpus(tokenizer_, corpus, config);
+  ASSERT_TRUE(profile.ok());
+
+  std::vector<uint64_t> expected(tokenizer_.vocab_size(), 0);
+  uint64_t num_tokens = 0;
+  uint64_t num_bytes = 0;
+  for (const auto& document : corpus) {
+    const auto tokens = tokenizer_.encode(document, 0, 0);
+    ASSERT_TRUE(tokens.ok());
+    for (const uint64_t token : *tokens) {
+      ++expected[token];
+      ++num_tokens;
+    }
+    num_bytes += document.size();
+  }
+  EXPECT_EQ(profile->token_counts, expected);
+  EXPECT_EQ(profile->num_tokens, num_tokens);
+  EXPECT_EQ(profile->num_bytes, num_bytes);
+  EXPECT_EQ(profile->num_documents, corpus.size());
+
+  uint64_t piece_total = 0;
+  uint64_t lookups = 0;
+  size_t distinct_lookups = 0;
+  for (size_t i = 0; i < profile->pieces.size(); ++i) {
+    const auto& piece = profile->pieces[i];
+    piece_total += piece.count;
+    if (piece.num_tokens > 1) {
+      lookups += piece.count;
+      ++distinct_lookups;
+    }
+    if (i > 0) {
+      EXPECT_LE(piece.count, profile->pieces[i - 1].count);
+    }
+  }
+  EXPECT_EQ(piece_total, profile->num_pieces);
+  uint64_t histogram_total = 0;
+  for (const uint64_t count : profile->piece_length_histogram) {
+    histogram_total += count;
+  }
+  EXPECT_EQ(histogram_total, profile->num_pieces);
+
+  ASSERT_EQ(profile->cache_simulations.size(), config.cache_sizes.size());
+  for (const auto& simulation : profile->cache_simulations) {
+    EXPECT_EQ(simulation.lookups, lookups);
+    // The vocabulary of the corpus fits in every simulated cache, so only the
+    // first lookup of each piece misses
+    EXPECT_EQ(simulation.lru_hits, lookups - distinct_lookups);
+    EXPECT_EQ(simulation.static_hits, lookups);
+  }
+}
+
+TEST_F(TokenProfileTest, SmallCaches) {
+  TokenProfileConfig config;
+  config.cache_sizes = {0, 1, 2};
+  const auto profile = profile_corpus(tokenizer_, make_corpus(20), config);
+  ASSERT_TRUE(profile.ok());
+  const auto& simulations = profile->cache_simulations;
+  EXPECT_EQ(simulations[0].lru_hits, 0);
+  EXPECT_EQ(simulations[0].static_hits, 0);
+  EXPECT_LE(simulations[1].lru_hits, simulations[2].lru_hits);
+  EXPECT_LE(simulations[1].static_hits, simulations[2].static_hits);
+  EXPECT_LT(simulations[2].static_hits, simulations[2].lookups);
+}
+
+TEST_F(TokenProfileTest, IndependentOfThreadCount) {
+  const auto corpus = make_corpus(40);
+  TokenProfileConfig config;
+  config.num_threads = 1;
+  const auto single = profile_corpus(tokenizer_, corpus, config);
+  config.num_threads = 7;
+  const auto multi = profile_corpus(tokenizer_, corpus, config);
+  ASSERT_TRUE(single.ok());
+  ASSERT_TRUE(multi.ok());
+  EXPECT_TRUE(same_profile(*single, *multi));
+}
+
+TEST_F(TokenProfileTest, SaveAndLoad) {
+  TokenProfileConfig config;
+  config.max_pieces = 5;
+  const auto profile = profile_corpus(tokenizer_, make_corpus(30), config);
+  ASSERT_TRUE(profile.ok());
+  EXPECT_EQ(profile->pieces.size(), 5);
+  EXPECT_EQ(profile->top_pieces(2).size(), 2);
+  EXPECT_EQ(profile->top_pieces(2)[0], profile->pieces[0].piece);
+
+  const std::string path = std::tmpnam(nullptr);
+  ASSERT_EQ(save_token_profile(*profile, path), Error::Ok);
+  const auto loaded = load_token_profile(path);
+  ASSERT_TRUE(loaded.ok());
+  EXPECT_TRUE(same_profile(*profile, *loaded));
+
+  // The profile is compact: much smaller than the vocabulary-sized counts
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  EXPECT_LT(static_cast<size_t>(file.tellg()), tokenizer_.vocab_size());
+  file.close();
+
+  // Corruption is detected
+  {
+    std::fstream corrupt(
+        path, std::ios::binary | std::ios::in | std::ios::out);
+    corrupt.seekg(12);
+    const char byte = static_cast<char>(corrupt.get() ^ 1);
+    corrupt.seekp(12);
+    corrupt.put(byte);
+  }
+  EXPECT_EQ(load_token_profile(path).error(), Error::ParseFailure);
+  std::remove(path.c_str());
+  EXPECT_EQ(load_token_profile(path).error(), Error::LoadFailure);
+}
+
+TEST_F(TokenProfileTest, LoadBoundsVocabularySize) {
+  // A hand-written profile with no counts, pieces or simulations, and a
+  // valid checksum
+  const auto write = [](const std::string& path, uint64_t vocab_size) {
+    std::string data = "TKPROF01";
+    data.append(4, '\0');
+    for (; vocab_size >= 0x80; vocab_size >>= 7) {
+      data += static_cast<char>((vocab_size & 0x7F) | 0x80);
+    }
+    data += static_cast<char>(vocab_size);
+    data.append(5, '\0');
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char c : data) {
+      hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001b3ULL;
+    }
+    for (int i = 0; i < 8; ++i) {
+      data += static_cast<char>(hash >> (8 * i));
+    }
+    std::ofstream(path, std::ios::binary) << data;
+  };
+
+  const std::string path = std::tmpnam(nullptr);
+  write(path, 1000);
+  const auto loaded = load_token_profile(path);
+  ASSERT_TRUE(loaded.ok());
+  EXPECT_EQ(loaded->token_counts.size(), 1000);
+
+  // Rejected before the counts are allocated
+  write(path, uint64_t(1) << 32);
+  EXPECT_EQ(load_token_profile(path).error(), Error::ParseFailure);
+  std::remove(path.c_str());
+}
+
+} // namespace tokenizers
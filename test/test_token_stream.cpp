@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+#include <random>
+
+#include <gtest/gtest.h>
+#include <pytorch/tokenizers/token_stream.h>
+
+using namespace ::testing;
+
+namespace tokenizers {
+
+namespace {
+
+constexpr uint64_t kVocabSize = 128256;
+
+// Zipf-like frequencies spread over the vocabulary, as in real token streams
+std::vector<uint64_t> make_tokens(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::vector<uint64_t> ids(kVocabSize);
+  std::iota(ids.begin(), ids.end(), 0);
+  std::shuffle(ids.begin(), ids.end(), rng);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::vector<uint64_t> tokens(count);
+  for (auto& token : tokens) {
+    const double u = uniform(rng);
+    const auto rank =
+        static_cast<uint64_t>(std::pow(double(kVocabSize), u * u * u)) - 1;
+    token = ids[rank];
+  }
+  return tokens;
+}
+
+std::string encode(
+    const std::vector<uint64_t>& tokens,
+    TokenStreamCoding coding,
+    uint32_t block_size = 512) {
+  TokenStreamConfig config;
+  config.vocab_size = kVocabSize;
+  config.block_size = block_size;
+  config.coding = coding;
+  TokenStreamWriter writer(config);
+  // Uneven appends that straddle blocks
+  for (size_t i = 0; i < tokens.size(); i += 700) {
+    EXPECT_EQ(
+        writer.append(
+            tokens.data() + i, std::min<size_t>(700, tokens.size() - i)),
+        Error::Ok);
+  }
+  auto data = writer.finish();
+  EXPECT_TRUE(data.ok());
+  return std::move(*data);
+}
+
+} // namespace
+
+TEST(TokenStreamTest, RoundTrip) {
+  for (const auto coding :
+       {TokenStreamCoding::Plain,
+        TokenStreamCoding::Delta,
+        TokenStreamCoding::Ranked}) {
+    for (const size_t count : {0, 1, 127, 128, 512, 5000}) {
+      const auto tokens = make_tokens(count, 42);
+      TokenStreamReader reader;
+      ASSERT_EQ(reader.load_from_memory(encode(tokens, coding)), Error::Ok);
+      EXPECT_EQ(reader.size(), count);
+      EXPECT_EQ(reader.vocab_size(), kVocabSize);
+      EXPECT_EQ(reader.coding(), coding);
+      const auto decoded = reader.read_all();
+      ASSERT_TRUE(decoded.ok());
+      EXPECT_EQ(*decoded, tokens) << static_cast<int>(coding) << " " << count;
+    }
+  }
+}
+
+TEST(TokenStreamTest, RandomAccess) {
+  const auto tokens = make_tokens(10000, 7);
+  std::mt19937 rng(3);
+  for (const auto coding :
+       {TokenStreamCoding::Plain,
+        TokenStreamCoding::Delta,
+        TokenStreamCoding::Ranked}) {
+    TokenStreamReader reader;
+    ASSERT_EQ(reader.load_from_memory(encode(tokens, coding)), Error::Ok);
+    for (int i = 0; i < 200; ++i) {
+      const size_t begin = rng() % tokens.size();
+      const size_t count =
+          rng() % std::min<size_t>(1500, tokens.size() - begin);
+      // Straight into batch buffers of the usual types
+      std::vector<int32_t> batch32(count);
+      ASSERT_EQ(reader.read(begin, count, batch32.data()), Error::Ok);
+      std::vector<int64_t> batch64(count);
+      ASSERT_EQ(reader.read(begin, count, batch64.data()), Error::Ok);
+      std::vector<uint32_t> batch(count);
+      ASSERT_EQ(reader.read(begin, count, batch.data()), Error::Ok);
+      for (size_t j = 0; j < count; ++j) {
+        ASSERT_EQ(batch32[j], tokens[begin + j]);
+        ASSERT_EQ(batch64[j], tokens[begin + j]);
+        ASSERT_EQ(batch[j], tokens[begin + j]);
+      }
+    }
+    std::vector<uint64_t> out(2);
+    EXPECT_EQ(reader.read(tokens.size() - 1, 2, out.data()), Error::OutOfRange);
+    EXPECT_EQ(reader.read(tokens.size(), 0, out.data()), Error::Ok);
+  }
+}
+
+TEST(TokenStreamTest, Compression) {
+  const auto tokens = make_tokens(1000000, 11);
+  // 17 bits for a 128k vocabulary instead of 32
+  const size_t plain = encode(tokens, TokenStreamCoding::Plain, 4096).size();
+  EXPECT_LT(plain, tokens.size() * 17 / 8 * 1.01);
+  // Frequent tokens get the small ranks
+  const size_t ranked = encode(tokens, TokenStreamCoding::Ranked, 128).size();
+  EXPECT_LT(ranked, plain);
+
+  // Sorted ids only store small deltas
+  std::vector<uint64_t> sorted = tokens;
+  std::sort(sorted.begin(), sorted.end());
+  const size_t delta = encode(sorted, TokenStreamCoding::Delta).size();
+  EXPECT_LT(delta, sorted.size() * 4 / 8);
+}
+
+TEST(TokenStreamTest, GivenRanking) {
+  TokenStreamConfig config;
+  config.vocab_size = 1000;
+  config.coding = TokenStreamCoding::Ranked;
+  config.ranking = {999, 500, 3};
+  TokenStreamWriter writer(config);
+  const std::vector<uint64_t> tokens = {999, 3, 500, 0, 999, 998};
+  ASSERT_EQ(writer.append(tokens.data(), tokens.size()), Error::Ok);
+  TokenStreamReader reader;
+  ASSERT_EQ(reader.load_from_memory(*writer.finish()), Error::Ok);
+  EXPECT_EQ(*reader.read_all(), tokens);
+
+  config.ranking = {1, 1};
+  TokenStreamWriter duplicate(config);
+  EXPECT_EQ(duplicate.append(tokens.data(), 1), Error::EncodeFailure);
+
+  // The writer's rank table is bounded
+  config.ranking.clear();
+  config.vocab_size = uint64_t(1) << 32;
+  TokenStreamWriter huge(config);
+  EXPECT_EQ(huge.append(tokens.data(), 1), Error::EncodeFailure);
+}
+
+TEST(TokenStreamTest, RejectsBadInput) {
+  TokenStreamConfig config;
+  config.vocab_size = 100;
+  TokenStreamWriter writer(config);
+  const std::vector<uint64_t> tokens = {1, 2, 100};
+  EXPECT_EQ(writer.append(tokens.data(), tokens.size()), Error::OutOfRange);
+  EXPECT_EQ(writer.size(), 0);
+
+  config.block_size = 100;
+  TokenStreamWriter bad_block(config);
+  EXPECT_EQ(bad_block.append(tokens.data(), 1), Error::EncodeFailure);
+
+  TokenStreamReader reader;
+  std::vector<uint64_t> out(1);
+  EXPECT_EQ(reader.read(0, 1, out.data()), Error::Uninitialized);
+  EXPECT_EQ(reader.load_from_memory("not a stream"), Error::ParseFailure);
+
+  const std::string data =
+      encode(make_tokens(3000, 5), TokenStreamCoding::Delta);
+  for (const size_t size : {size_t(0), size_t(40), data.size() - 1}) {
+    EXPECT_EQ(
+        reader.load_from_memory(data.substr(0, size)), Error::ParseFailure)
+        << size;
+  }
+  std::string corrupt = data;
+  corrupt[data.size() - 8] ^= 1;
+  EXPECT_EQ(reader.load_from_memory(corrupt), Error::ParseFailure);
+}
+
+TEST(TokenStreamTest, RejectsCorruptHeaders) {
+  TokenStreamConfig config;
+  config.vocab_size = uint64_t(1) << 32;
+  TokenStreamWriter writer(config);
+  const std::vector<uint64_t> tokens = {0, 5, 4000000000};
+  ASSERT_EQ(writer.append(tokens.data(), tokens.size()), Error::Ok);
+  std::string data = *writer.finish();
+
+  // A plain stream read as ranked, with nothing listed: every id ranks as
+  // itself, and the vocabulary is never materialized
+  data[8] = static_cast<char>(TokenStreamCoding::Ranked);
+  TokenStreamReader reader;
+  ASSERT_EQ(reader.load_from_memory(data), Error::Ok);
+  EXPECT_EQ(*reader.read_all(), tokens);
+
+  // Ids at or past a vocabulary size that still fits the block widths
+  config.vocab_size = 1000;
+  TokenStreamWriter small(config);
+  std::vector<uint64_t> ids(256, 7);
+  ids[200] = 999;
+  ASSERT_EQ(small.append(ids.data(), ids.size()), Error::Ok);
+  data = *small.finish();
+  data[16] = static_cast<char>(600 & 0xff);
+  data[17] = static_cast<char>(600 >> 8);
+  ASSERT_EQ(reader.load_from_memory(data), Error::Ok);
+  std::vector<uint32_t> out(ids.size());
+  EXPECT_EQ(reader.read(0, 100, out.data()), Error::Ok);
+  EXPECT_EQ(reader.read(0, out.size(), out.data()), Error::ParseFailure);
+  EXPECT_EQ(reader.read_all().error(), Error::ParseFailure);
+}
+
+TEST(TokenStreamTest, RejectsOverlongBlocks) {
+  TokenStreamConfig config;
+  config.vocab_size = 1 << 20;
+  config.block_size = 128;
+  TokenStreamWriter writer(config);
+  const std::vector<uint64_t> ids(256, 7);
+  ASSERT_EQ(writer.append(ids.data(), ids.size()), Error::Ok);
+  std::string data = *writer.finish();
+  const auto put = [&](size_t offset, uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; ++i) {
+      data[offset + i] = static_cast<char>(value >> (8 * i));
+    }
+  };
+
+  // The first block claims a width and an exception that put its end past
+  // the end of the stream, and the index moves the second block there
+  const size_t block = 40;
+  put(block, 10 | (1 << 8), 4);
+  put(block + 4, 1, 4);
+  put(data.size() - 8, block + 8 + 160 + 4 + 4, 8);
+  TokenStreamReader reader;
+  EXPECT_EQ(reader.load_from_memory(data), Error::ParseFailure);
+
+  // A second block offset that is merely truncated
+  ASSERT_EQ(writer.append(ids.data(), ids.size()), Error::Ok);
+  data = *writer.finish();
+  put(data.size() - 8, data.size() - 20, 8);
+  EXPECT_EQ(reader.load_from_memory(data), Error::ParseFailure);
+}
+
+TEST(TokenStreamTest, SaveAndLoad) {
+  const auto tokens = make_tokens(3000, 9);
+  TokenStreamConfig config;
+  config.vocab_size = kVocabSize;
+  TokenStreamWriter writer(config);
+  ASSERT_EQ(writer.append(tokens.data(), tokens.size()), Error::Ok);
+  const std::string path = std::tmpnam(nullptr);
+  ASSERT_EQ(writer.save(path), Error::Ok);
+
+  TokenStreamReader reader;
+  ASSERT_EQ(reader.load(path), Error::Ok);
+  EXPECT_EQ(*reader.read_all(), tokens);
+  std::remove(path.c_str());
+  EXPECT_EQ(reader.load(path), Error::LoadFailure);
+}
+
+} // namespace tokenizers
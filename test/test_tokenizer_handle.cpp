@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <gtest/gtest.h>
+#include <pytorch/tokenizers/tiktoken.h>
+#include <pytorch/tokenizers/tokenizer_handle.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace ::testing;
+
+namespace tokenizers {
+
+namespace {
+
+static inline std::string _get_resource_path(const std::string& name) {
+  return std::getenv("RESOURCES_PATH") + std::string("/") + name;
+}
+
+// Minimal loaded tokenizer that reports when it is destroyed
+class CountingTokenizer : public Tokenizer {
+ public:
+  CountingTokenizer(uint64_t id, std::atomic<int>& destroyed)
+      : id_(id), destroyed_(destroyed) {}
+
+  ~CountingTokenizer() override {
+    destroyed_.fetch_add(1);
+  }
+
+  Error load(const std::string&) override {
+    initialized_ = true;
+    return Error::Ok;
+  }
+
+  Result<std::vector<uint64_t>>
+  encode(const std::string&, int8_t, int8_t) const override {
+    return std::vector<uint64_t>{id_};
+  }
+
+  Result<std::string> decode(uint64_t, uint64_t) const override {
+    return std::to_string(id_);
+  }
+
+ private:
+  uint64_t id_;
+  std::atomic<int>& destroyed_;
+};
+
+std::unique_ptr<Tokenizer> _make_counting(
+    uint64_t id,
+    std::atomic<int>& destroyed) {
+  auto tok = std::make_unique<CountingTokenizer>(id, destroyed);
+  tok->load("");
+  return tok;
+}
+
+} // namespace
+
+TEST(TokenizerHandleTest, EncodeBeforeLoad) {
+  TokenizerHandle handle([] { return std::make_unique<Tiktoken>(); });
+  EXPECT_FALSE(handle.is_loaded());
+  EXPECT_EQ(handle.encode("hello world").error(), Error::Uninitialized);
+  EXPECT_EQ(handle.decode(0, 0).error(), Error::Uninitialized);
+}
+
+TEST(TokenizerHandleTest, LoadAndEncode) {
+  TokenizerHandle handle([] { return std::make_unique<Tiktoken>(); });
+  EXPECT_EQ(
+      handle.load(_get_resource_path("test_tiktoken_tokenizer.model")),
+      Error::Ok);
+  EXPECT_TRUE(handle.is_loaded());
+  EXPECT_EQ(handle.generation(), 1);
+
+  auto out = handle.encode("hello world", 1, 0);
+  ASSERT_EQ(out.error(), Error::Ok);
+  EXPECT_EQ(out.get(), std::vector<uint64_t>({128000, 15339, 1917}));
+  EXPECT_EQ(handle.decode(0, 1917).get(), " world");
+}
+
+TEST(TokenizerHandleTest, FailedLoadKeepsCurrentModel) {
+  TokenizerHandle handle([] { return std::make_unique<Tiktoken>(); });
+  ASSERT_EQ(
+      handle.load(_get_resource_path("test_tiktoken_tokenizer.model")),
+      Error::Ok);
+  EXPECT_EQ(handle.load("invalid_path"), Error::LoadFailure);
+  EXPECT_EQ(handle.generation(), 1);
+  EXPECT_EQ(handle.encode("hello world").get().size(), 2);
+}
+
+TEST(TokenizerHandleTest, PublishRejectsUnloaded) {
+  TokenizerHandle handle([] { return std::make_unique<Tiktoken>(); });
+  EXPECT_EQ(handle.publish(std::make_unique<Tiktoken>()), Error::Uninitialized);
+  EXPECT_EQ(handle.publish(nullptr), Error::Uninitialized);
+}
+
+TEST(TokenizerHandleTest, PublishReclaimsPreviousModel) {
+  std::atomic<int> destroyed{0};
+  TokenizerHandle handle(_make_counting(1, destroyed));
+  EXPECT_EQ(handle.encode("").get()[0], 1);
+
+  EXPECT_EQ(handle.publish(_make_counting(2, destroyed)), Error::Ok);
+  EXPECT_EQ(destroyed.load(), 1);
+  EXPECT_EQ(handle.encode("").get()[0], 2);
+  EXPECT_EQ(handle.generation(), 2);
+}
+
+TEST(TokenizerHandleTest, PinnedModelOutlivesPublish) {
+  std::atomic<int> destroyed{0};
+  TokenizerHandle handle(_make_counting(1, destroyed));
+
+  std::atomic<bool> published{false};
+  std::thread publisher;
+  {
+    auto guard = handle.acquire();
+    publisher = std::thread([&] {
+      EXPECT_EQ(handle.publish(_make_counting(2, destroyed)), Error::Ok);
+      published = true;
+    });
+
+    // New readers see the new model while the old one is still pinned
+    while (handle.generation() != 2) {
+      std::this_thread::yield();
+    }
+    EXPECT_EQ(handle.encode("").get()[0], 2);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(published.load());
+    EXPECT_EQ(destroyed.load(), 0);
+    EXPECT_EQ(guard->encode("", 0, 0).get()[0], 1);
+  }
+  publisher.join();
+  EXPECT_TRUE(published.load());
+  EXPECT_EQ(destroyed.load(), 1);
+}
+
+TEST(TokenizerHandleTest, ConcurrentEncodeDuringReload) {
+  const auto model_path = _get_resource_path("test_tiktoken_tokenizer.model");
+  TokenizerHandle handle([] { return std::make_unique<Tiktoken>(); });
+  ASSERT_EQ(handle.load(model_path), Error::Ok);
+
+  std::atomic<bool> stop{false};
+  std::atomic<int> failures{0};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back([&] {
+      while (!stop.load()) {
+        auto out = handle.encode("hello world");
+        if (!out.ok() ||
+            out.get() != std::vector<uint64_t>({15339, 1917})) {
+          failures.fetch_add(1);
+        }
+      }
+    });
+  }
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(handle.load(model_path), Error::Ok);
+  }
+  stop = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(failures.load(), 0);
+  EXPECT_EQ(handle.generation(), 4);
+}
+
+} // namespace tokenizers
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <pytorch/tokenizers/tiktoken.h>
+#include <pytorch/tokenizers/traffic_capture.h>
+
+using namespace ::testing;
+
+namespace tokenizers {
+
+namespace {
+
+std::unique_ptr<Tokenizer> load_tiktoken() {
+  auto tokenizer = std::make_unique<Tiktoken>();
+  EXPECT_EQ(
+      tokenizer->load(
+          std::getenv("RESOURCES_PATH") +
+          std::string("/test_tiktoken_tokenizer.model")),
+      Error::Ok);
+  return tokenizer;
+}
+
+int byte_class(char c) {
+  const auto byte = static_cast<unsigned char>(c);
+  if (std::islower(byte)) {
+    return 1;
+  }
+  if (std::isupper(byte)) {
+    return 2;
+  }
+  if (std::isdigit(byte)) {
+    return 3;
+  }
+  return byte < 0x80 ? 4 : 5;
+}
+
+} // namespace
+
+TEST(TrafficCaptureTest, RoundTrip) {
+  const std::string path = std::tmpnam(nullptr);
+  auto recorder = TrafficRecorder::open(path);
+  ASSERT_TRUE(recorder.ok());
+  CapturingTokenizer tokenizer(load_tiktoken(), *recorder);
+  EXPECT_TRUE(tokenizer.is_loaded());
+  EXPECT_EQ(tokenizer.vocab_size(), tokenizer.wrapped().vocab_size());
+
+  const std::vector<std::string> texts = {
+      "Hello world", "<|begin_of_text|>ünïcödé 😀", ""};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 2; ++t) {
+    threads.emplace_back([&] {
+      for (const auto& text : texts) {
+        const auto tokens = tokenizer.encode(text, 1, 0);
+        ASSERT_TRUE(tokens.ok());
+        EXPECT_EQ(*tokens, *tokenizer.wrapped().encode(text, 1, 0));
+        ASSERT_TRUE(tokenizer.decode(tokens->front(), tokens->back()).ok());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ((*recorder)->size(), 12);
+  ASSERT_EQ((*recorder)->flush(), Error::Ok);
+
+  TrafficLogReader log;
+  ASSERT_EQ(log.load(path), Error::Ok);
+  EXPECT_FALSE(log.redacted());
+  EXPECT_FALSE(log.truncated());
+  ASSERT_EQ(log.records().size(), 12);
+  for (const auto& record : log.records()) {
+    ASSERT_LT(record.thread, 1u << 20);
+    if (record.kind == TrafficCallKind::Encode) {
+      EXPECT_NE(
+          std::find(texts.begin(), texts.end(), record.text), texts.end());
+      EXPECT_EQ(record.bos, 1);
+      EXPECT_EQ(record.eos, 0);
+    } else {
+      EXPECT_EQ(record.kind, TrafficCallKind::Decode);
+      EXPECT_LT(record.token, tokenizer.vocab_size());
+    }
+  }
+  // Calls of one thread are logged in order
+  for (size_t i = 1; i < log.records().size(); ++i) {
+    const auto& a = log.records()[i - 1];
+    const auto& b = log.records()[i];
+    if (a.thread == b.thread) {
+      EXPECT_LE(a.start_us, b.start_us);
+    }
+  }
+  std::remove(path.c_str());
+}
+
+TEST(TrafficCaptureTest, RedactionKeepsShape) {
+  const std::string path = std::tmpnam(nullptr);
+  TrafficCaptureOptions options;
+  options.redact = true;
+  options.redaction_key = 1234;
+  options.preserved = {"<|begin_of_text|>"};
+  auto recorder = TrafficRecorder::open(path, options);
+  ASSERT_TRUE(recorder.ok());
+
+  const std::string text =
+      "<|begin_of_text|>Secret Agent 007: ünïcödé, 分词器 😀 Secret Agent";
+  const std::string redacted = (*recorder)->redact(text);
+  ASSERT_EQ(redacted.size(), text.size());
+  EXPECT_NE(redacted, text);
+  EXPECT_EQ(redacted.substr(0, 17), "<|begin_of_text|>");
+  EXPECT_EQ(redacted.find("Secret"), std::string::npos);
+  for (size_t i = 0; i < text.size(); ++i) {
+    EXPECT_EQ(byte_class(redacted[i]), byte_class(text[i])) << i;
+    if (byte_class(text[i]) == 4) {
+      EXPECT_EQ(redacted[i], text[i]);
+    }
+  }
+  // Repeated text stays repeated
+  const size_t first = text.find("Secret Agent");
+  const size_t second = text.rfind("Secret Agent");
+  EXPECT_EQ(redacted.substr(first, 12), redacted.substr(second, 12));
+  // Multi-byte characters stay valid UTF-8 in the same block
+  const size_t emoji = text.find("😀");
+  EXPECT_EQ(redacted.substr(emoji, 3), text.substr(emoji, 3));
+  EXPECT_GE(static_cast<unsigned char>(redacted[emoji + 3]), 0x80);
+  EXPECT_LE(static_cast<unsigned char>(redacted[emoji + 3]), 0xBF);
+
+  (*recorder)->record_encode(
+      text, 0, 0, TrafficRecorder::Clock::now(), TrafficRecorder::Clock::now());
+  for (uint64_t token = 0; token < 100; ++token) {
+    (*recorder)->record_decode(
+        token,
+        token,
+        100,
+        TrafficRecorder::Clock::now(),
+        TrafficRecorder::Clock::now());
+  }
+  ASSERT_EQ((*recorder)->flush(), Error::Ok);
+
+  TrafficLogReader log;
+  ASSERT_EQ(log.load(path), Error::Ok);
+  EXPECT_TRUE(log.redacted());
+  ASSERT_EQ(log.records().size(), 101);
+  EXPECT_EQ(log.records()[0].text, redacted);
+  // Decoded ids are a permutation of the vocabulary
+  std::vector<bool> seen(100, false);
+  size_t moved = 0;
+  for (size_t i = 1; i < log.records().size(); ++i) {
+    const auto& record = log.records()[i];
+    ASSERT_LT(record.token, 100);
+    EXPECT_EQ(record.prev_token, record.token);
+    EXPECT_FALSE(seen[record.token]);
+    seen[record.token] = true;
+    moved += record.token != i - 1;
+  }
+  EXPECT_GT(moved, 0);
+  std::remove(path.c_str());
+}
+
+TEST(TrafficCaptureTest, TruncatedLog) {
+  const std::string path = std::tmpnam(nullptr);
+  {
+    auto recorder = TrafficRecorder::open(path);
+    ASSERT_TRUE(recorder.ok());
+    CapturingTokenizer tokenizer(load_tiktoken(), *recorder);
+    ASSERT_TRUE(tokenizer.encode("first call", 0, 0).ok());
+    ASSERT_TRUE(tokenizer.encode("second call", 0, 0).ok());
+  }
+  std::ifstream in(path, std::ios::binary);
+  std::string data(
+      (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  in.close();
+  std::ofstream(path, std::ios::binary | std::ios::trunc)
+      << data.substr(0, data.size() - 3);
+
+  TrafficLogReader log;
+  ASSERT_EQ(log.load(path), Error::Ok);
+  EXPECT_TRUE(log.truncated());
+  ASSERT_EQ(log.records().size(), 1);
+  EXPECT_EQ(log.records()[0].text, "first call");
+
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << "not a log";
+  EXPECT_EQ(log.load(path), Error::ParseFailure);
+  std::remove(path.c_str());
+  EXPECT_EQ(log.load(path), Error::LoadFailure);
+}
+
+} // namespace tokenizers
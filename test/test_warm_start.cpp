@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+// @lint-ignore-every LICENSELINT
+
+#include <gtest/gtest.h>
+#include <pytorch/tokenizers/llama2c_tokenizer.h>
+#include <pytorch/tokenizers/piece_cache.h>
+#include <pytorch/tokenizers/tiktoken.h>
+#include <pytorch/tokenizers/warm_start.h>
+
+using namespace ::testing;
+
+namespace tokenizers {
+
+namespace {
+
+std::string resource_path(const std::string& name) {
+  return std::getenv("RESOURCES_PATH") + std::string("/") + name;
+}
+
+size_t total_size(const std::vector<MemoryRegion>& regions) {
+  size_t size = 0;
+  for (const auto& region : regions) {
+    size += region.size;
+  }
+  return size;
+}
+
+} // namespace
+
+TEST(WarmStartTest, RequiresLoadedTokenizer) {
+  Tiktoken tokenizer;
+  EXPECT_TRUE(tokenizer.memory_regions().empty());
+  EXPECT_EQ(warm_start(tokenizer).error(), Error::Uninitialized);
+}
+
+TEST(WarmStartTest, BuiltInCorpus) {
+  Tiktoken tokenizer;
+  ASSERT_EQ(
+      tokenizer.load(resource_path("test_tiktoken_tokenizer.model")),
+      Error::Ok);
+  const auto regions = tokenizer.memory_regions();
+  ASSERT_FALSE(regions.empty());
+
+  const auto report = warm_start(tokenizer);
+  ASSERT_TRUE(report.ok());
+  EXPECT_EQ(report->bytes_prefaulted, total_size(regions));
+  EXPECT_EQ(report->bytes_locked, 0);
+  EXPECT_EQ(report->round_times.size(), 2);
+  EXPECT_EQ(report->texts_encoded, 2 * warm_start_corpus().size());
+  EXPECT_GT(report->tokens_encoded, report->texts_encoded);
+  EXPECT_GE(
+      report->total_time,
+      report->prefault_time + report->encode_time + report->decode_time);
+}
+
+TEST(WarmStartTest, SingleDirection) {
+  Tiktoken encoder;
+  encoder.set_mode(TokenizerMode::EncodeOnly);
+  ASSERT_EQ(
+      encoder.load(resource_path("test_tiktoken_tokenizer.model")), Error::Ok);
+  const auto encoded = warm_start(encoder);
+  ASSERT_TRUE(encoded.ok());
+  EXPECT_EQ(encoded->texts_encoded, 2 * warm_start_corpus().size());
+
+  Tiktoken decoder;
+  decoder.set_mode(TokenizerMode::DecodeOnly);
+  ASSERT_EQ(
+      decoder.load(resource_path("test_tiktoken_tokenizer.model")), Error::Ok);
+  const auto decoded = warm_start(decoder);
+  ASSERT_TRUE(decoded.ok());
+  EXPECT_EQ(decoded->bytes_prefaulted, total_size(decoder.memory_regions()));
+  EXPECT_EQ(decoded->texts_encoded, 0);
+}
+
+TEST(WarmStartTest, PrimesPieceCache) {
+  Tiktoken tokenizer;
+  ASSERT_EQ(
+      tokenizer.load(resource_path("test_tiktoken_tokenizer.model")),
+      Error::Ok);
+  auto cache = SharedPieceCache::open("", 4096);
+  ASSERT_TRUE(cache.ok());
+  ASSERT_EQ(tokenizer.set_piece_cache(*cache), Error::Ok);
+
+  WarmStartOptions options;
+  options.prefault = false;
+  options.rounds = 1;
+  options.corpus = {"Supercalifragilisticexpialidocious pneumonoultramicro"};
+  const auto report = warm_start(tokenizer, options);
+  ASSERT_TRUE(report.ok());
+  EXPECT_EQ(report->bytes_prefaulted, 0);
+  EXPECT_EQ(report->texts_encoded, 1);
+
+  // Serving the warm-up text again only hits the cache
+  const auto warm = (*cache)->stats();
+  EXPECT_GT(warm.inserts, 0);
+  ASSERT_TRUE(tokenizer.encode(options.corpus[0], 0, 0).ok());
+  const auto served = (*cache)->stats();
+  EXPECT_EQ(served.misses, warm.misses);
+  EXPECT_EQ(served.hits - warm.hits, warm.inserts);
+}
+
+TEST(WarmStartTest, LockMemory) {
+  Tiktoken tokenizer;
+  ASSERT_EQ(
+      tokenizer.load(resource_path("test_tiktoken_tokenizer.model")),
+      Error::Ok);
+  WarmStartOptions options;
+  options.lock_memory = true;
+  options.rounds = 0;
+  const auto report = warm_start(tokenizer, options);
+  ASSERT_TRUE(report.ok());
+  EXPECT_TRUE(report->round_times.empty());
+  // Whether mlock succeeds depends on RLIMIT_MEMLOCK, but every region is
+  // either locked or reported
+  const auto regions = tokenizer.memory_regions();
+  if (report->lock_failures == 0) {
+    EXPECT_EQ(report->bytes_locked, total_size(regions));
+  } else {
+    EXPECT_LT(report->bytes_locked, total_size(regions));
+  }
+}
+
+TEST(WarmStartTest, Llama2cPrefaultOnly) {
+  Llama2cTokenizer tokenizer;
+  ASSERT_EQ(
+      tokenizer.load(resource_path("test_llama2c_tokenizer.bin")), Error::Ok);
+  const auto regions = tokenizer.memory_regions();
+  EXPECT_EQ(regions.size(), 3);
+  EXPECT_EQ(
+      total_size(regions),
+      tokenizer.vocab_size() *
+          (sizeof(char*) + sizeof(float) + sizeof(TokenIndex)));
+  // The test artifact has an empty vocabulary, so skip the corpus
+  WarmStartOptions options;
+  options.rounds = 0;
+  const auto report = warm_start(tokenizer, options);
+  ASSERT_TRUE(report.ok());
+  EXPECT_EQ(report->bytes_prefaulted, total_size(regions));
+  EXPECT_EQ(report->tokens_encoded, 0);
+}
+
+} // namespace tokenizers